@@ -16,6 +16,7 @@
 #define BOOST_TEST_MAIN
 
 #include <boost/array.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 #include <memory>
 #include <boost/test/floating_point_comparison.hpp>
@@ -244,7 +245,9 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientGeneratorHypersonicLocalInclinat
     }
 }
 
-std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface( )
+std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface(
+        const unsigned int numberOfThreads = 1, const std::string& coefficientCacheDirectory = "",
+        const int numberOfAngleOfAttackPoints = 7 )
 {
 
     // Create test capsule.
@@ -277,9 +280,9 @@ std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterf
 
     std::vector< std::vector< double > > independentVariableDataPoints( 3 );
     independentVariableDataPoints[ 0 ] = getDefaultHypersonicLocalInclinationMachPoints( "Full" );
-    std::vector< double > angleOfAttackPoints( 7 );
+    std::vector< double > angleOfAttackPoints( numberOfAngleOfAttackPoints );
 
-    for ( int i = 0; i < 7; i++ )
+    for ( int i = 0; i < numberOfAngleOfAttackPoints; i++ )
     {
         angleOfAttackPoints[ i ] = static_cast< double >( i - 6 ) * 5.0 * PI / 180.0;
     }
@@ -302,7 +305,7 @@ std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterf
     return std::make_shared< HypersonicLocalInclinationAnalysis >(
                 independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
                 invertOrders, selectedMethods, PI * pow( capsule->getMiddleRadius( ), 2.0 ),
-                3.9116, momentReference );
+                3.9116, momentReference, numberOfThreads, coefficientCacheDirectory );
 }
 
 //! Apollo capsule test case.
@@ -391,6 +394,71 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
                        toleranceAerodynamicCoefficients5 );
 }
 
+//! Test parallel generation of coefficients, and caching of coefficients on disk.
+BOOST_AUTO_TEST_CASE( testParallelAndCachedCoefficientGeneration )
+{
+    const boost::filesystem::path cacheDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+
+    // Generate coefficients with single thread, and with multiple threads (writing them to cache).
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > serialCoefficientInterface =
+            getApolloCoefficientInterface( 1 );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > parallelCoefficientInterface =
+            getApolloCoefficientInterface( 4, cacheDirectory.string( ) );
+    BOOST_CHECK_EQUAL( parallelCoefficientInterface->areCoefficientsReadFromCache( ), false );
+
+    const boost::filesystem::path cacheFilePath =
+            cacheDirectory / parallelCoefficientInterface->getCoefficientCacheFileName( );
+    BOOST_CHECK_EQUAL( boost::filesystem::exists( cacheFilePath ), true );
+
+    // Read coefficients from cache.
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > cachedCoefficientInterface =
+            getApolloCoefficientInterface( 1, cacheDirectory.string( ) );
+    BOOST_CHECK_EQUAL( cachedCoefficientInterface->areCoefficientsReadFromCache( ), true );
+
+    // Check that all coefficients are identical.
+    boost::array< int, 3 > independentVariables;
+    for( int i = 0; i < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 0 ); i++ )
+    {
+        independentVariables[ 0 ] = i;
+        for( int j = 0; j < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 1 ); j++ )
+        {
+            independentVariables[ 1 ] = j;
+            for( int k = 0; k < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 2 ); k++ )
+            {
+                independentVariables[ 2 ] = k;
+                Vector6d serialCoefficients =
+                        serialCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                Vector6d parallelCoefficients =
+                        parallelCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                Vector6d cachedCoefficients =
+                        cachedCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                for( int l = 0; l < 6; l++ )
+                {
+                    BOOST_CHECK_EQUAL( parallelCoefficients( l ), serialCoefficients( l ) );
+                    BOOST_CHECK_EQUAL( cachedCoefficients( l ), serialCoefficients( l ) );
+                }
+            }
+        }
+    }
+
+    // Check that cache is not used for different independent variables.
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > modifiedCoefficientInterface =
+            getApolloCoefficientInterface( 1, cacheDirectory.string( ), 5 );
+    BOOST_CHECK_EQUAL( modifiedCoefficientInterface->areCoefficientsReadFromCache( ), false );
+    BOOST_CHECK( modifiedCoefficientInterface->getCoefficientCacheFileName( ) !=
+                 parallelCoefficientInterface->getCoefficientCacheFileName( ) );
+
+    // Check that corrupted cache file is not used (and is replaced).
+    boost::filesystem::resize_file( cacheFilePath, boost::filesystem::file_size( cacheFilePath ) / 2 );
+    BOOST_CHECK_EQUAL( getApolloCoefficientInterface( 1, cacheDirectory.string( ) )->areCoefficientsReadFromCache( ),
+                       false );
+    BOOST_CHECK_EQUAL( getApolloCoefficientInterface( 1, cacheDirectory.string( ) )->areCoefficientsReadFromCache( ),
+                       true );
+
+    boost::filesystem::remove_all( cacheDirectory );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
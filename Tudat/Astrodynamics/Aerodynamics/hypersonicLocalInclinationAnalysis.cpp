@@ -13,17 +13,22 @@
  *
  */
 
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
 #include <string>
 
-#include <boost/bind.hpp>
-#include <functional>
-#include <boost/lambda/lambda.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/pointer_cast.hpp>
 #include <memory>
 
 #include <Eigen/Geometry>
 
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
@@ -41,6 +46,52 @@ using mathematical_constants::PI;
 
 using namespace geometric_shapes;
 
+//! Identifier at start of hypersonic local inclination coefficient cache file.
+static const char coefficientCacheFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'H', 'L', 'I' };
+
+//! Version of hypersonic local inclination coefficient cache file format (and of the coefficient computation).
+static const std::uint32_t coefficientCacheFileVersion = 1;
+
+//! Function to update a 64-bit FNV-1a hash with the binary representation of a block of data.
+static void updateCoefficientCacheKey( std::uint64_t& hash, const void* data, const std::size_t dataSize )
+{
+    const unsigned char* bytes = static_cast< const unsigned char* >( data );
+    for( std::size_t i = 0; i < dataSize; i++ )
+    {
+        hash ^= static_cast< std::uint64_t >( bytes[ i ] );
+        hash *= 1099511628211ULL;
+    }
+}
+
+//! Function to update a 64-bit FNV-1a hash with a vector of values (including its size).
+template< typename ValueType >
+static void updateCoefficientCacheKey( std::uint64_t& hash, const std::vector< ValueType >& values )
+{
+    const std::uint64_t numberOfValues = values.size( );
+    updateCoefficientCacheKey( hash, &numberOfValues, sizeof( numberOfValues ) );
+    if( numberOfValues > 0 )
+    {
+        updateCoefficientCacheKey( hash, values.data( ), numberOfValues * sizeof( ValueType ) );
+    }
+}
+
+//! Function to set pressure coefficients of panels for which the inclination is positive (compression) or
+//! non-positive (expansion), using a given pressure function of the inclination.
+template< typename PressureFunction >
+static void setPanelPressureCoefficients( const Eigen::VectorXd& inclinations,
+                                          const bool setCompressionPressures,
+                                          const PressureFunction& pressureFunction,
+                                          Eigen::VectorXd& pressureCoefficients )
+{
+    for( int i = 0; i < inclinations.rows( ); i++ )
+    {
+        if( ( inclinations( i ) > 0.0 ) == setCompressionPressures )
+        {
+            pressureCoefficients( i ) = pressureFunction( inclinations( i ) );
+        }
+    }
+}
+
 //! Returns default values of mach number for use in HypersonicLocalInclinationAnalysis.
 std::vector< double > getDefaultHypersonicLocalInclinationMachPoints(
         const std::string& machRegime )
@@ -125,12 +176,16 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const std::vector< std::vector< int > >& selectedMethods,
         const double referenceArea,
         const double referenceLength,
-        const Eigen::Vector3d& momentReferencePoint )
+        const Eigen::Vector3d& momentReferencePoint,
+        const unsigned int numberOfThreads,
+        const std::string& coefficientCacheDirectory )
     : AerodynamicCoefficientGenerator< 3, 6 >(
           dataPointsOfIndependentVariables, referenceLength, referenceArea, referenceLength,
           momentReferencePoint, { mach_number_dependent, angle_of_attack_dependent, angle_of_sideslip_dependent },true, false ),
-      stagnationPressureCoefficient( 2.0 ),
       ratioOfSpecificHeats( 1.4 ),
+      numberOfThreads_( numberOfThreads ),
+      coefficientCacheDirectory_( coefficientCacheDirectory ),
+      areCoefficientsReadFromCache_( false ),
       selectedMethods_( selectedMethods )
 {
     // Set geometry if it is a single surface.
@@ -201,20 +256,34 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
-    inclination_.resize( vehicleParts_.size( ) );
-    pressureCoefficient_.resize( vehicleParts_.size( ) );
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
+    // Check selected methods.
+    if( selectedMethods_.size( ) != 2 || selectedMethods_[ 0 ].size( ) < vehicleParts_.size( ) ||
+            selectedMethods_[ 1 ].size( ) < vehicleParts_.size( ) )
+    {
+        throw std::runtime_error( "Error in hypersonic local inclination analysis, selected methods are "
+                                  "inconsistent with number of vehicle parts" );
+    }
+
+    for( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
     {
-        inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
+        const int compressionMethod = selectedMethods_[ 0 ][ i ];
+        if( compressionMethod < 0 || compressionMethod > 9 || compressionMethod == 2 || compressionMethod == 3 )
         {
-            inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
+            throw std::runtime_error( "Error, compression local inclination method number "
+                                      + std::to_string( compressionMethod ) + " not recognized" );
+        }
+
+        const int expansionMethod = selectedMethods_[ 1 ][ i ];
+        if( expansionMethod < 0 || expansionMethod > 6 || expansionMethod == 2 )
+        {
+            throw std::runtime_error( "Error, expansion local inclination method number "
+                                      + std::to_string( expansionMethod ) + " not recognized" );
         }
     }
 
+    // Set panel properties of all parts in flat arrays.
+    setPanelProperties( );
+
     boost::array< int, 3 > numberOfPointsPerIndependentVariables;
     for( int i = 0; i < 3; i++ )
     {
@@ -244,392 +313,448 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
     return aerodynamicCoefficients_( independentVariables );
 }
 
-//! Generate aerodynamic database.
-void HypersonicLocalInclinationAnalysis::generateCoefficients( )
+//! Get the name of the file in which the coefficients are cached.
+std::string HypersonicLocalInclinationAnalysis::getCoefficientCacheFileName( ) const
+{
+    std::ostringstream fileName;
+    fileName << "hypersonicLocalInclinationCoefficients_" << std::hex << std::setw( 16 ) << std::setfill( '0' )
+             << computeCoefficientCacheKey( ) << ".bin";
+    return fileName.str( );
+}
+
+//! Set flat arrays of panel properties of all vehicle parts.
+void HypersonicLocalInclinationAnalysis::setPanelProperties( )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
-    boost::array< int, 3 > independentVariableIndices;
+    panelSurfaceNormals_.resize( vehicleParts_.size( ) );
+    areaWeightedPanelSurfaceNormals_.resize( vehicleParts_.size( ) );
+    areaWeightedPanelMomentArms_.resize( vehicleParts_.size( ) );
 
-    // Iterate over all combinations of independent variables.
-    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        independentVariableIndices[ 0 ] = i;
-        for ( unsigned  int j = 0 ; j < dataPointsOfIndependentVariables_[
-              1 ].size( ) ; j++ )
+        const int numberOfPanelLines = vehicleParts_[ k ]->getNumberOfLines( ) - 1;
+        const int numberOfPanelPoints = vehicleParts_[ k ]->getNumberOfPoints( ) - 1;
+        const int numberOfPanels = std::max( numberOfPanelLines, 0 ) * std::max( numberOfPanelPoints, 0 );
+
+        panelSurfaceNormals_[ k ].resize( numberOfPanels, 3 );
+        areaWeightedPanelSurfaceNormals_[ k ].resize( numberOfPanels, 3 );
+        areaWeightedPanelMomentArms_[ k ].resize( numberOfPanels, 3 );
+
+        // Set properties of each panel, ordered by line, then point.
+        int panelIndex = 0;
+        for ( int i = 0 ; i < numberOfPanelLines ; i++ )
         {
-            independentVariableIndices[ 1 ] = j;
-            for ( unsigned  int k = 0 ; k < dataPointsOfIndependentVariables_[
-                  2 ].size( ) ; k++ )
+            for ( int j = 0 ; j < numberOfPanelPoints ; j++ )
             {
-                independentVariableIndices[ 2 ] = k;
-
-                determineVehicleCoefficients( independentVariableIndices );
+                const Eigen::Vector3d panelSurfaceNormal = vehicleParts_[ k ]->getPanelSurfaceNormal( i, j );
+                const double panelArea = vehicleParts_[ k ]->getPanelArea( i, j );
+                const Eigen::Vector3d referenceDistance =
+                        vehicleParts_[ k ]->getPanelCentroid( i, j ) - momentReferencePoint_;
+
+                panelSurfaceNormals_[ k ].row( panelIndex ) = panelSurfaceNormal.transpose( );
+                areaWeightedPanelSurfaceNormals_[ k ].row( panelIndex ) = panelArea * panelSurfaceNormal.transpose( );
+                areaWeightedPanelMomentArms_[ k ].row( panelIndex ) =
+                        panelArea * ( referenceDistance.cross( panelSurfaceNormal ) ).transpose( );
+                panelIndex++;
             }
         }
     }
 }
 
-//! Generate aerodynamic coefficients at a single set of independent variables.
-void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
-        const boost::array< int, 3 > independentVariableIndices )
+//! Generate aerodynamic database.
+void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 {
-    // Declare coefficients vector and initialize to zeros.
-    Vector6d coefficients = Vector6d::Zero( );
-
-    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
-    // to aerodynamicCoefficients_.
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
+    // Read coefficients from cache, if available.
+    std::string cacheFilePath;
+    if( !coefficientCacheDirectory_.empty( ) )
     {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
+        cacheFilePath = ( boost::filesystem::path( coefficientCacheDirectory_ ) / getCoefficientCacheFileName( ) ).string( );
+        if( readCoefficientsFromCache( cacheFilePath ) )
+        {
+            areCoefficientsReadFromCache_ = true;
+            return;
+        }
     }
 
-    aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
-    isCoefficientGenerated_( independentVariableIndices ) = 1;
-}
-
-//! Determine aerodynamic coefficients of a single vehicle part.
-Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
-{
-    // Declare and determine angles of attack and sideslip for analysis.
-    double angleOfAttack =  dataPointsOfIndependentVariables_[ 1 ]
-            [ independentVariableIndices[ 1 ] ];
-
-    double angleOfSideslip =  dataPointsOfIndependentVariables_[ 2 ]
-            [ independentVariableIndices[ 2 ] ];
-
-    // Declare partCoefficient vector.
-    Vector6d partCoefficients = Vector6d::Zero( );
-
-    // Check whether the inclinations of the vehicle part have already been computed.
-    if ( previouslyComputedInclinations_.count( std::pair< double, double >(
-                                                    angleOfAttack, angleOfSideslip ) ) == 0 )
+    // Iterate over all combinations of angle of attack and sideslip (distributed over threads), and compute
+    // coefficients at all Mach numbers from a single set of panel inclinations.
+    const int numberOfMachPoints = dataPointsOfIndependentVariables_[ 0 ].size( );
+    const int numberOfAngleOfAttackPoints = dataPointsOfIndependentVariables_[ 1 ].size( );
+    const int numberOfAngleOfSideslipPoints = dataPointsOfIndependentVariables_[ 2 ].size( );
+    utilities::executeParallelTasks(
+                numberOfAngleOfAttackPoints * numberOfAngleOfSideslipPoints,
+                [ & ]( const int taskIndex )
     {
-        // Determine panel inclinations for part.
-        determineInclinations( angleOfAttack, angleOfSideslip );
+        boost::array< int, 3 > independentVariableIndices;
+        independentVariableIndices[ 1 ] = taskIndex / numberOfAngleOfSideslipPoints;
+        independentVariableIndices[ 2 ] = taskIndex % numberOfAngleOfSideslipPoints;
 
-        // Add panel inclinations to container
-        previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ] = inclination_;
-    }
+        std::vector< Eigen::VectorXd > panelInclinations;
+        std::vector< Eigen::VectorXd > pressureCoefficients;
+        determineInclinations( dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ],
+                               dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ],
+                               panelInclinations );
 
-    else
+        for( int i = 0; i < numberOfMachPoints; i++ )
+        {
+            independentVariableIndices[ 0 ] = i;
+            aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                        dataPointsOfIndependentVariables_[ 0 ][ i ], panelInclinations, pressureCoefficients );
+            isCoefficientGenerated_( independentVariableIndices ) = 1;
+        }
+    }, numberOfThreads_ );
+
+    // Write coefficients to cache.
+    if( !cacheFilePath.empty( ) )
     {
-        // Fetch inclinations from container
-        inclination_ = previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ];
+        writeCoefficientsToCache( cacheFilePath );
     }
-
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
-
-    // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
-
-    // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
-
-    return partCoefficients;
 }
 
-//! Determine the pressure coefficients on a single vehicle part.
-void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+//! Generate aerodynamic coefficients at a single set of independent variables.
+void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
+        const boost::array< int, 3 > independentVariableIndices )
 {
-    // Retrieve Mach number.
-    double machNumber = dataPointsOfIndependentVariables_[ 0 ]
-            [ independentVariableIndices[ 0 ] ];
-
-    // Determine stagnation point pressure coefficients. Value is computed once
-    // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure(
-                machNumber, ratioOfSpecificHeats );
-
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
+    std::vector< Eigen::VectorXd > panelInclinations;
+    std::vector< Eigen::VectorXd > pressureCoefficients;
+    determineInclinations( dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ],
+                           dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ],
+                           panelInclinations );
+
+    aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ],
+                panelInclinations, pressureCoefficients );
+    isCoefficientGenerated_( independentVariableIndices ) = 1;
 }
 
-//! Determine force coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
-        const int partNumber )
+//! Determine aerodynamic coefficients of vehicle for given panel inclinations and Mach number.
+Vector6d HypersonicLocalInclinationAnalysis::computeVehicleCoefficients(
+        const double machNumber, const std::vector< Eigen::VectorXd >& panelInclinations,
+        std::vector< Eigen::VectorXd >& pressureCoefficients ) const
 {
-    // Declare force coefficient vector and intialize to zeros.
-    Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
+    // Declare coefficients vector and initialize to zeros.
+    Vector6d coefficients = Vector6d::Zero( );
 
-    // Loop over all panels and add pressures, scaled by panel area, to force
-    // coefficients.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    // Loop over all vehicle parts, calculate pressure coefficients and resulting aerodynamic coefficients.
+    pressureCoefficients.resize( vehicleParts_.size( ) );
+    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++)
-        {
-            forceCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
-        }
+        pressureCoefficients[ i ].resize( panelInclinations[ i ].rows( ) );
+        updateCompressionPressures( machNumber, i, panelInclinations[ i ], pressureCoefficients[ i ] );
+        updateExpansionPressures( machNumber, i, panelInclinations[ i ], pressureCoefficients[ i ] );
+
+        coefficients.segment( 0, 3 ) += calculateForceCoefficients( i, pressureCoefficients[ i ] );
+        coefficients.segment( 3, 3 ) += calculateMomentCoefficients( i, pressureCoefficients[ i ] );
     }
 
-    // Normalize result by reference area.
-    forceCoefficients /= referenceArea_;
+    return coefficients;
+}
 
-    return forceCoefficients;
+//! Determine force coefficients from pressure coefficients.
+Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
+        const int partNumber, const Eigen::VectorXd& pressureCoefficients ) const
+{
+    // Sum pressures, scaled by panel area, along panel surface normals, and normalize result by reference area.
+    return -( areaWeightedPanelSurfaceNormals_[ partNumber ].transpose( ) * pressureCoefficients ) / referenceArea_;
 }
 
 //! Determine moment coefficients from pressure coefficients.
 Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
-        const int partNumber )
+        const int partNumber, const Eigen::VectorXd& pressureCoefficients ) const
 {
-    // Declare moment coefficient vector and intialize to zeros.
-    Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
-
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance;
-
-    // Loop over all panels and add moments due pressures.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-    {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->getPanelCentroid( i, j ) -
-                                  momentReferencePoint_ );
-
-            momentCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->
-                                               getPanelSurfaceNormal( i, j ) ) );
-        }
-    }
-
-    // Scale result by reference length and area.
-    momentCoefficients /= ( referenceLength_ * referenceArea_ );
-
-    return momentCoefficients;
+    // Sum moments due to pressures, and scale result by reference length and area.
+    return -( areaWeightedPanelMomentArms_[ partNumber ].transpose( ) * pressureCoefficients ) /
+            ( referenceLength_ * referenceArea_ );
 }
 
-//! Determines the inclination angle of panels on a single part.
+//! Determines the inclination angle of panels on all parts.
 void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
-                                                                const double angleOfSideslip )
+                                                                const double angleOfSideslip,
+                                                                std::vector< Eigen::VectorXd >& panelInclinations ) const
 {
-    // Declare free-stream velocity vector.
-    Eigen::Vector3d freestreamVelocityDirection;
-
     // Set freestream velocity vector in body frame.
-    double freestreamVelocityDirectionX = cos( angleOfAttack )* cos( angleOfSideslip );
-    double freestreamVelocityDirectionY = sin( angleOfSideslip );
-    double freestreamVelocityDirectionZ = sin( angleOfAttack ) * cos( angleOfSideslip );
-    freestreamVelocityDirection( 0 ) = freestreamVelocityDirectionX;
-    freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
-    freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
-
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
+    Eigen::Vector3d freestreamVelocityDirection;
+    freestreamVelocityDirection( 0 ) = cos( angleOfAttack )* cos( angleOfSideslip );
+    freestreamVelocityDirection( 1 ) = sin( angleOfSideslip );
+    freestreamVelocityDirection( 2 ) = sin( angleOfAttack ) * cos( angleOfSideslip );
 
-    // Loop over all panels of given vehicle part and set inclination angles.
+    // Determine inclination angles of all panels from inner product between surface normal and free-stream
+    // direction (cosine of inclination angle).
+    panelInclinations.resize( vehicleParts_.size( ) );
     for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->
-                        getPanelSurfaceNormal( i, j ).
-                        dot( freestreamVelocityDirection );
-
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
-            }
-        }
+        panelInclinations[ k ] = ( PI / 2.0 ) - ( panelSurfaceNormals_[ k ] * freestreamVelocityDirection ).array( ).acos( );
     }
 }
 
-//! Determine compression pressure coefficients on all parts.
+//! Determine compression pressure coefficients on a single part.
 void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
-                                                                     const int partNumber )
+                                                                     const int partNumber,
+                                                                     const Eigen::VectorXd& inclinations,
+                                                                     Eigen::VectorXd& pressureCoefficients ) const
 {
-    int method = selectedMethods_[ 0 ][ partNumber ];
-
-    std::function< double( double ) > pressureFunction;
-
     // Switch to analyze part using correct method.
-    switch( method )
+    switch( selectedMethods_[ 0 ][ partNumber ] )
     {
     case 0:
-        pressureFunction =
-                std::bind( aerodynamics::computeNewtonianPressureCoefficient, std::placeholders::_1 );
+        // Newtonian method, evaluated for all panels at once.
+        pressureCoefficients = ( inclinations.array( ) > 0.0 ).select(
+                    2.0 * inclinations.array( ).sin( ).square( ), pressureCoefficients.array( ) );
         break;
 
     case 1:
-        pressureFunction =
-                std::bind( aerodynamics::computeModifiedNewtonianPressureCoefficient, std::placeholders::_1,
-                             stagnationPressureCoefficient );
-        break;
-
-    case 2:
-        // Method currently disabled.
-        break;
-
-    case 3:
-        // Method currently disabled.
+    {
+        // Modified Newtonian method, evaluated for all panels at once.
+        const double stagnationPressureCoefficient = computeStagnationPressure( machNumber, ratioOfSpecificHeats );
+        pressureCoefficients = ( inclinations.array( ) > 0.0 ).select(
+                    stagnationPressureCoefficient * inclinations.array( ).sin( ).square( ),
+                    pressureCoefficients.array( ) );
         break;
-
+    }
     case 4:
-        pressureFunction =
-                std::bind( aerodynamics::computeEmpiricalTangentWedgePressureCoefficient, std::placeholders::_1,
-                             machNumber );
+        setPanelPressureCoefficients( inclinations, true, [ & ]( const double inclination )
+        {
+            return computeEmpiricalTangentWedgePressureCoefficient( inclination, machNumber );
+        }, pressureCoefficients );
         break;
 
     case 5:
-        pressureFunction =
-                std::bind( aerodynamics::computeEmpiricalTangentConePressureCoefficient, std::placeholders::_1,
-                             machNumber );
+        setPanelPressureCoefficients( inclinations, true, [ & ]( const double inclination )
+        {
+            return computeEmpiricalTangentConePressureCoefficient( inclination, machNumber );
+        }, pressureCoefficients );
         break;
 
     case 6:
-        pressureFunction =
-                std::bind( aerodynamics::computeModifiedDahlemBuckPressureCoefficient, std::placeholders::_1,
-                             machNumber );
+        setPanelPressureCoefficients( inclinations, true, [ & ]( const double inclination )
+        {
+            return computeModifiedDahlemBuckPressureCoefficient( inclination, machNumber );
+        }, pressureCoefficients );
         break;
 
     case 7:
-        pressureFunction =
-                std::bind( aerodynamics::computeVanDykeUnifiedPressureCoefficient, std::placeholders::_1,
-                             machNumber, ratioOfSpecificHeats, 1 );
+        setPanelPressureCoefficients( inclinations, true, [ & ]( const double inclination )
+        {
+            return computeVanDykeUnifiedPressureCoefficient( inclination, machNumber, ratioOfSpecificHeats, 1 );
+        }, pressureCoefficients );
         break;
 
     case 8:
-        pressureFunction =
-                std::bind( aerodynamics::computeSmythDeltaWingPressureCoefficient, std::placeholders::_1,
-                             machNumber );
+        setPanelPressureCoefficients( inclinations, true, [ & ]( const double inclination )
+        {
+            return computeSmythDeltaWingPressureCoefficient( inclination, machNumber );
+        }, pressureCoefficients );
         break;
 
     case 9:
-        pressureFunction =
-                std::bind( aerodynamics::computeHankeyFlatSurfacePressureCoefficient, std::placeholders::_1,
-                             machNumber );
+        setPanelPressureCoefficients( inclinations, true, [ & ]( const double inclination )
+        {
+            return computeHankeyFlatSurfacePressureCoefficient( inclination, machNumber );
+        }, pressureCoefficients );
         break;
 
     default:
-        break;
-    }
-
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
-    {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            if ( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] =
-                        pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
-        }
+        throw std::runtime_error( "Error, compression local inclination method number "
+                                  + std::to_string( selectedMethods_[ 0 ][ partNumber ] ) + " not recognized" );
     }
 }
 
-//! Determines expansion pressure coefficients on all parts.
+//! Determines expansion pressure coefficients on a single part.
 void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
-                                                                   const int partNumber )
+                                                                   const int partNumber,
+                                                                   const Eigen::VectorXd& inclinations,
+                                                                   Eigen::VectorXd& pressureCoefficients ) const
 {
     // Get analysis method of part to analyze.
     int method = selectedMethods_[ 1 ][ partNumber ];
 
     if ( method == 0 || method == 1 || method == 4 )
     {
-        std::function< double( ) > pressureFunction;
+        // Determine (constant) pressure coefficient of all expansion panels.
+        double expansionPressureCoefficient = 0.0;
         switch( method )
         {
         case 0:
-            pressureFunction = std::bind( &aerodynamics::computeVacuumPressureCoefficient,
-                                            machNumber, ratioOfSpecificHeats );
+            expansionPressureCoefficient = computeVacuumPressureCoefficient( machNumber, ratioOfSpecificHeats );
             break;
 
         case 1:
-            pressureFunction = [ ]( ){ return 0.0; };
+            expansionPressureCoefficient = 0.0;
             break;
 
         case 4:
-            pressureFunction = std::bind( &aerodynamics::computeHighMachBasePressure,
-                                            machNumber );
+            expansionPressureCoefficient = computeHighMachBasePressure( machNumber );
             break;
-
         }
 
-        // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        pressureCoefficients = ( inclinations.array( ) <= 0.0 ).select(
+                    expansionPressureCoefficient, pressureCoefficients.array( ) );
+    }
+
+    else if( method == 3 || method == 5 )
+    {
+        // Calculate freestream Prandtl-Meyer function (not used for method 5).
+        const double freestreamPrandtlMeyerFunction = ( method == 3 ) ?
+                    computePrandtlMeyerFunction( machNumber, ratioOfSpecificHeats ) : -1.0;
+        setPanelPressureCoefficients( inclinations, false, [ & ]( const double inclination )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( );
-                }
-            }
-        }
+            return computePrandtlMeyerFreestreamPressureCoefficient(
+                        inclination, machNumber, ratioOfSpecificHeats, freestreamPrandtlMeyerFunction );
+        }, pressureCoefficients );
     }
 
-    else if( method == 3 || method == 5 || method == 6 )
+    else if( method == 6 )
     {
+        setPanelPressureCoefficients( inclinations, false, [ & ]( const double inclination )
+        {
+            return computeAcmEmpiricalPressureCoefficient( inclination, machNumber );
+        }, pressureCoefficients );
+    }
 
-        std::function< double( double ) > pressureFunction;
+    else
+    {
+        std::string errorMessage = "Error, expansion local inclination method number "
+                + std::to_string( method ) + " not recognized";
+        throw std::runtime_error( errorMessage );
+    }
+}
 
-        // Declare local variable.
-        double freestreamPrandtlMeyerFunction;
+//! Compute hash of all inputs that influence the coefficients.
+std::uint64_t HypersonicLocalInclinationAnalysis::computeCoefficientCacheKey( ) const
+{
+    std::uint64_t cacheKey = 14695981039346656037ULL;
+    updateCoefficientCacheKey( cacheKey, &coefficientCacheFileVersion, sizeof( coefficientCacheFileVersion ) );
 
-        // Switch to analyze part using correct method.
-        switch( method )
+    // Add independent variables, reference quantities and selected methods.
+    for( unsigned int i = 0; i < dataPointsOfIndependentVariables_.size( ); i++ )
+    {
+        updateCoefficientCacheKey( cacheKey, dataPointsOfIndependentVariables_[ i ] );
+    }
+    updateCoefficientCacheKey( cacheKey, &referenceArea_, sizeof( referenceArea_ ) );
+    updateCoefficientCacheKey( cacheKey, &referenceLength_, sizeof( referenceLength_ ) );
+    updateCoefficientCacheKey( cacheKey, momentReferencePoint_.data( ), 3 * sizeof( double ) );
+    updateCoefficientCacheKey( cacheKey, &ratioOfSpecificHeats, sizeof( ratioOfSpecificHeats ) );
+    for( unsigned int i = 0; i < selectedMethods_.size( ); i++ )
+    {
+        updateCoefficientCacheKey( cacheKey, selectedMethods_[ i ] );
+    }
+
+    // Add panel properties.
+    for( unsigned int i = 0; i < vehicleParts_.size( ); i++ )
+    {
+        const std::uint64_t numberOfPanels = panelSurfaceNormals_[ i ].rows( );
+        updateCoefficientCacheKey( cacheKey, &numberOfPanels, sizeof( numberOfPanels ) );
+        updateCoefficientCacheKey( cacheKey, panelSurfaceNormals_[ i ].data( ), 3 * numberOfPanels * sizeof( double ) );
+        updateCoefficientCacheKey( cacheKey, areaWeightedPanelSurfaceNormals_[ i ].data( ),
+                                   3 * numberOfPanels * sizeof( double ) );
+        updateCoefficientCacheKey( cacheKey, areaWeightedPanelMomentArms_[ i ].data( ),
+                                   3 * numberOfPanels * sizeof( double ) );
+    }
+
+    return cacheKey;
+}
+
+//! Read coefficients from cache file.
+bool HypersonicLocalInclinationAnalysis::readCoefficientsFromCache( const std::string& cacheFilePath )
+{
+    std::ifstream cacheFile( cacheFilePath.c_str( ), std::ios::binary );
+    if( !cacheFile.good( ) )
+    {
+        return false;
+    }
+
+    // Read and check header.
+    char fileIdentifier[ 8 ];
+    std::uint32_t fileVersion;
+    std::uint64_t cacheKey;
+    std::uint32_t numberOfPoints[ 3 ];
+    cacheFile.read( fileIdentifier, sizeof( fileIdentifier ) );
+    cacheFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    cacheFile.read( reinterpret_cast< char* >( &cacheKey ), sizeof( cacheKey ) );
+    cacheFile.read( reinterpret_cast< char* >( numberOfPoints ), sizeof( numberOfPoints ) );
+    if( !cacheFile.good( ) ||
+            !std::equal( fileIdentifier, fileIdentifier + 8, coefficientCacheFileIdentifier ) ||
+            fileVersion != coefficientCacheFileVersion || cacheKey != computeCoefficientCacheKey( ) )
+    {
+        return false;
+    }
+
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        if( numberOfPoints[ i ] != dataPointsOfIndependentVariables_[ i ].size( ) )
         {
-        case 3:
-            // Calculate freestream Prandtl-Meyer function.
-            freestreamPrandtlMeyerFunction = aerodynamics::computePrandtlMeyerFunction(
-                        machNumber, ratioOfSpecificHeats );
-            pressureFunction =
-                    std::bind( &aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient,
-                                 std::placeholders::_1, machNumber, ratioOfSpecificHeats,
-                                 freestreamPrandtlMeyerFunction );
-            break;
+            return false;
+        }
+    }
 
-        case 5:
-            pressureFunction =
-                    std::bind( &aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient,
-                                 std::placeholders::_1, machNumber, ratioOfSpecificHeats, -1 );
-            break;
+    // Read coefficients (in storage order of multi-array).
+    boost::multi_array< Eigen::Vector6d, 3 > cachedCoefficients( aerodynamicCoefficients_ );
+    for( Eigen::Vector6d* coefficientIterator = cachedCoefficients.data( );
+         coefficientIterator != cachedCoefficients.data( ) + cachedCoefficients.num_elements( ); coefficientIterator++ )
+    {
+        cacheFile.read( reinterpret_cast< char* >( coefficientIterator->data( ) ), 6 * sizeof( double ) );
+    }
 
-        case 6:
-            pressureFunction = std::bind( &aerodynamics::computeAcmEmpiricalPressureCoefficient,
-                                            std::placeholders::_1, machNumber );
-            break;
+    if( !cacheFile.good( ) )
+    {
+        return false;
+    }
+
+    aerodynamicCoefficients_ = cachedCoefficients;
+    std::fill( isCoefficientGenerated_.origin( ),
+               isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 1 );
+    return true;
+}
+
+//! Write coefficients to cache file.
+void HypersonicLocalInclinationAnalysis::writeCoefficientsToCache( const std::string& cacheFilePath ) const
+{
+    try
+    {
+        // Write to temporary file first, and rename afterwards, so that incomplete files are never read.
+        const boost::filesystem::path finalFilePath( cacheFilePath );
+        if( !finalFilePath.parent_path( ).empty( ) && !boost::filesystem::exists( finalFilePath.parent_path( ) ) )
+        {
+            boost::filesystem::create_directories( finalFilePath.parent_path( ) );
         }
+        const boost::filesystem::path temporaryFilePath =
+                finalFilePath.parent_path( ) / boost::filesystem::unique_path( "%%%%-%%%%-%%%%.tmp" );
 
-        // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            std::ofstream cacheFile( temporaryFilePath.string( ).c_str( ), std::ios::binary );
+
+            const std::uint64_t cacheKey = computeCoefficientCacheKey( );
+            std::uint32_t numberOfPoints[ 3 ];
+            for( unsigned int i = 0; i < 3; i++ )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
+                numberOfPoints[ i ] = dataPointsOfIndependentVariables_[ i ].size( );
+            }
+            cacheFile.write( coefficientCacheFileIdentifier, sizeof( coefficientCacheFileIdentifier ) );
+            cacheFile.write( reinterpret_cast< const char* >( &coefficientCacheFileVersion ),
+                             sizeof( coefficientCacheFileVersion ) );
+            cacheFile.write( reinterpret_cast< const char* >( &cacheKey ), sizeof( cacheKey ) );
+            cacheFile.write( reinterpret_cast< const char* >( numberOfPoints ), sizeof( numberOfPoints ) );
+
+            for( const Eigen::Vector6d* coefficientIterator = aerodynamicCoefficients_.data( );
+                 coefficientIterator != aerodynamicCoefficients_.data( ) + aerodynamicCoefficients_.num_elements( );
+                 coefficientIterator++ )
+            {
+                cacheFile.write( reinterpret_cast< const char* >( coefficientIterator->data( ) ), 6 * sizeof( double ) );
+            }
+
+            if( !cacheFile.good( ) )
+            {
+                cacheFile.close( );
+                boost::filesystem::remove( temporaryFilePath );
+                throw std::runtime_error( "could not write file " + temporaryFilePath.string( ) );
             }
         }
-    }
 
-    else
+        boost::filesystem::rename( temporaryFilePath, finalFilePath );
+    }
+    catch( std::exception& error )
     {
-        std::string errorMessage = "Error, expansion local inclination method number "
-                + std::to_string( method ) + " not recognized";
-        throw std::runtime_error( errorMessage );
+        std::cerr << "Warning, hypersonic local inclination coefficients could not be cached: "
+                  << error.what( ) << std::endl;
     }
 }
 
@@ -18,7 +18,7 @@
 #ifndef TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 #define TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 
-#include <map>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -62,11 +62,15 @@ std::vector< double > getDefaultHypersonicLocalInclinationAngleOfSideslipPoints(
  * methods. These methods assume that the local pressure on the vehicle is only
  * dependent on the local inclination angle w.r.t. the freestream flow and
  * freestream conditions, such as Mach number and ratio of specific heats.
- * All aerodynamic coefficients can be calculated using the generateCoefficients function, or on an
- * as needed basis by using the getAerodynamicCoefficientsDataPoint function. Note that during the
- * panel inclination determination process, a geometry with outward surface-normals is assumed.
- * The resulting coefficients are expressed in the same reference frame as that of the input
+ * All aerodynamic coefficients are calculated upon construction, using the generateCoefficients function.
+ * Note that during the panel inclination determination process, a geometry with outward surface-normals is
+ * assumed. The resulting coefficients are expressed in the same reference frame as that of the input
  * geometry.
+ * The panel properties are stored in flat (structure-of-arrays) form, so that the inclinations and pressure
+ * coefficients of all panels of a part are computed with vectorized operations. The coefficients at the
+ * different combinations of angle of attack and sideslip may be computed concurrently, and the resulting
+ * coefficients may be stored in (and reloaded from) a cache file, which is identified by a hash of the
+ * geometry, independent variable grid, reference quantities and selected methods.
  */
 class HypersonicLocalInclinationAnalysis: public AerodynamicCoefficientGenerator< 3, 6 >
 {
@@ -99,6 +103,12 @@ public:
      *  and moments.
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
+     *  \param numberOfThreads Number of threads over which the combinations of angle of attack and angle of
+     *  sideslip are distributed when generating the coefficients (default 1).
+     *  \param coefficientCacheDirectory Directory in which generated coefficients are cached. If a cache file
+     *  for the current geometry, independent variables, reference quantities and methods exists in this
+     *  directory, the coefficients are read from it; if not, they are generated and written to it. No cache
+     *  is used if empty (default).
      */
     HypersonicLocalInclinationAnalysis(
             const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -109,7 +119,9 @@ public:
             const std::vector< std::vector< int > >& selectedMethods,
             const double referenceArea,
             const double referenceLength,
-            const Eigen::Vector3d& momentReferencePoint );
+            const Eigen::Vector3d& momentReferencePoint,
+            const unsigned int numberOfThreads = 1,
+            const std::string& coefficientCacheDirectory = "" );
 
     //! Default destructor.
     /*!
@@ -129,16 +141,6 @@ public:
     Eigen::Vector6d getAerodynamicCoefficientsDataPoint(
             const boost::array< int, 3 > independentVariables );
 
-    //! Determine inclination angles of panels on a given part.
-    /*!
-     * Determines panel inclinations for all panels on all parts for given attitude.
-     * Outward pointing surface-normals are assumed!
-     * \param angleOfAttack Angle of attack at which to determine inclination angles.
-     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
-     */
-    void determineInclinations( const double angleOfAttack,
-                                const double angleOfSideslip );
-
     //! Get the number of vehicle parts.
     /*!
      *  Returns the number of vehicle parts.
@@ -161,6 +163,24 @@ public:
          return vehicleParts_[ vehicleIndex ];
      }
 
+    //! Get the name of the file in which the coefficients are cached.
+    /*!
+     * Returns the name of the file in which the coefficients are cached (in the directory provided to the
+     * constructor). The name contains a hash of all inputs that influence the coefficients.
+     * \return Name of cache file.
+     */
+    std::string getCoefficientCacheFileName( ) const;
+
+    //! Get boolean denoting whether the coefficients were read from a cache file.
+    /*!
+     * Returns boolean denoting whether the coefficients were read from a cache file, instead of being generated.
+     * \return True if coefficients were read from a cache file.
+     */
+    bool areCoefficientsReadFromCache( ) const
+    {
+        return areCoefficientsReadFromCache_;
+    }
+
 
     //! Overload ostream to print class information.
     /*!
@@ -176,52 +196,67 @@ public:
 
 private:
 
+    //! Set flat arrays of panel properties of all vehicle parts.
+    /*!
+     * Sets flat arrays of panel properties (surface normals, and area-weighted force and moment contributions)
+     * of all vehicle parts, from the LaWGS meshes in vehicleParts_.
+     */
+    void setPanelProperties( );
+
     //! Generate aerodynamic database.
     /*!
-     * Generates aerodynamic database. Settings of geometry,
-     * reference quantities, database point settings and analysis methods
-     * should have been set previously.
+     * Generates aerodynamic database, or reads it from the cache file (if a cache directory is used, and a
+     * valid cache file exists). Panel properties, reference quantities, database point settings and analysis
+     * methods should have been set previously. The combinations of angle of attack and sideslip are
+     * distributed over numberOfThreads_ threads, with the panel inclinations for each combination computed
+     * only once, and reused for all Mach numbers.
      */
     void generateCoefficients( );
 
     //! Generate aerodynamic coefficients at a single set of independent variables.
     /*!
      * Generates aerodynamic coefficients at a single set of independent variables.
-     * Determines values and sets corresponding entry in vehicleCoefficients_ array.
+     * Determines values and sets corresponding entry in aerodynamicCoefficients_ array.
      * \param independentVariableIndices Array of indices from lists of Mach number,
      *          angle of attack and angle of sideslip points at which to perform analysis.
      */
     void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices );
 
-    //! Determine aerodynamic coefficients for a single LaWGS part.
+    //! Determine aerodynamic coefficients of vehicle for given panel inclinations and Mach number.
     /*!
-     * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     * \return Force and moment coefficients for requested vehicle part.
+     * Determines aerodynamic coefficients of vehicle (sum of all parts) for given panel inclinations and Mach
+     * number.
+     * \param machNumber Mach number at which to perform analysis.
+     * \param panelInclinations Inclinations of all panels (per part) at the current angles of attack and sideslip.
+     * \param pressureCoefficients Pressure coefficients of all panels (per part), used as work array.
+     * \return Force and moment coefficients of vehicle.
      */
-    Eigen::Vector6d determinePartCoefficients(
-            const int partNumber, const boost::array< int, 3 > independentVariableIndices );
+    Eigen::Vector6d computeVehicleCoefficients(
+            const double machNumber, const std::vector< Eigen::VectorXd >& panelInclinations,
+            std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
 
-    //! Determine pressure coefficients on a given part.
+    //! Determine inclination angles of panels on all parts.
     /*!
-     * Determines pressure coefficients on a single vehicle part.
-     * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
+     * Determines panel inclinations for all panels on all parts for given attitude.
+     * Outward pointing surface-normals are assumed!
+     * \param angleOfAttack Angle of attack at which to determine inclination angles.
+     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \param panelInclinations Inclinations of all panels, per part (returned by reference).
      */
-    void determinePressureCoefficients( const int partNumber,
-                                        const boost::array< int, 3 > independentVariableIndices );
+    void determineInclinations( const double angleOfAttack,
+                                const double angleOfSideslip,
+                                std::vector< Eigen::VectorXd >& panelInclinations ) const;
 
     //! Determine force coefficients of a part.
     /*!
      * Sums the pressure coefficients of given part and determines force coefficients from it by
      * non-dimensionalization with reference area.
      * \param partNumber Index from vehicleParts_ array for which determine coefficients.
+     * \param pressureCoefficients Pressure coefficients of panels of part.
      * \return Force coefficients for requested vehicle part.
      */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
+    Eigen::Vector3d calculateForceCoefficients( const int partNumber,
+                                                const Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Determine moment coefficients of a part.
     /*!
@@ -229,27 +264,60 @@ private:
      * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
      * dimensionalization is performed by product of referenceLength and referenceArea.
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
+     * \param pressureCoefficients Pressure coefficients of panels of part.
      * \return Moment coefficients for requested vehicle part.
      */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    Eigen::Vector3d calculateMomentCoefficients( const int partNumber,
+                                                 const Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Determine the compression pressure coefficients of a given part.
     /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
+     * Sets the pressure coefficients of panels on given part and at given Mach number for which
      * inclination > 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Inclinations of panels of part.
+     * \param pressureCoefficients Pressure coefficients of panels of part (modified by reference).
      */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    void updateCompressionPressures( const double machNumber, const int partNumber,
+                                     const Eigen::VectorXd& inclinations,
+                                     Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Determine the expansion pressure coefficients of a given part.
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
+     * Sets the pressure coefficients of panels on given part and at given Mach number for
      * which inclination <= 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Inclinations of panels of part.
+     * \param pressureCoefficients Pressure coefficients of panels of part (modified by reference).
+     */
+    void updateExpansionPressures( const double machNumber, const int partNumber,
+                                   const Eigen::VectorXd& inclinations,
+                                   Eigen::VectorXd& pressureCoefficients ) const;
+
+    //! Read coefficients from cache file.
+    /*!
+     * Reads coefficients from cache file, if it exists and is consistent with the current settings.
+     * \param cacheFilePath Path of cache file.
+     * \return True if coefficients were read successfully.
+     */
+    bool readCoefficientsFromCache( const std::string& cacheFilePath );
+
+    //! Write coefficients to cache file.
+    /*!
+     * Writes coefficients to cache file (a warning is printed if this fails).
+     * \param cacheFilePath Path of cache file.
+     */
+    void writeCoefficientsToCache( const std::string& cacheFilePath ) const;
+
+    //! Compute hash of all inputs that influence the coefficients.
+    /*!
+     * Computes hash of all inputs that influence the coefficients (panel properties, independent variables,
+     * reference quantities and selected methods), used to identify the cache file.
+     * \return Hash of all inputs that influence the coefficients.
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    std::uint64_t computeCoefficientCacheKey( ) const;
 
     //! Array of vehicle parts.
     /*!
@@ -264,40 +332,37 @@ private:
      */
     boost::multi_array< bool, 3 > isCoefficientGenerated_;
 
-    //! Three-dimensional array of panel inclination angles.
+    //! Surface normals of panels of each part.
     /*!
-     * Three-dimensional array of panel inclination angles at current values of
-     * independent variables. Indices indicate part-line-point.
+     * Surface normals of panels of each part, with one row per panel (panels ordered by line, then point).
      */
-    std::vector< std::vector< std::vector< double > > > inclination_;
+    std::vector< Eigen::Matrix< double, Eigen::Dynamic, 3 > > panelSurfaceNormals_;
 
-    //! Map of angle of attack and -sideslip pair and associated panel inclinations.
-    /*!
-     * Map of angle of attack and -sideslip pair and associated panel inclinations.
-     */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > >
-    previouslyComputedInclinations_;
+    //! Surface normals of panels of each part, multiplied by panel area.
+    std::vector< Eigen::Matrix< double, Eigen::Dynamic, 3 > > areaWeightedPanelSurfaceNormals_;
 
-    //! Three-dimensional array of panel pressure coefficients.
+    //! Cross product of moment arm and surface normal of panels of each part, multiplied by panel area.
     /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
+     * Cross product of moment arm (from momentReferencePoint to panel centroid) and surface normal of panels of
+     * each part, multiplied by panel area.
      */
-    std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
-
-    //! Stagnation pressure coefficient.
-    /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
-     */
-    double stagnationPressureCoefficient;
+    std::vector< Eigen::Matrix< double, Eigen::Dynamic, 3 > > areaWeightedPanelMomentArms_;
 
     //! Ratio of specific heats.
     /*!
      * Ratio of specific heat at constant pressure to specific heat at constant pressure.
      */
     double ratioOfSpecificHeats;
-    \
+
+    //! Number of threads used to generate the coefficients.
+    unsigned int numberOfThreads_;
+
+    //! Directory in which generated coefficients are cached (no cache used if empty).
+    std::string coefficientCacheDirectory_;
+
+    //! Boolean denoting whether the coefficients were read from a cache file.
+    bool areCoefficientsReadFromCache_;
+
     //! Array of selected methods.
     /*!
      * Array of selected methods, first index represents compression/expansion,
@@ -106,6 +106,10 @@ void TabulatedAtmosphere::createAtmosphereInterpolators( )
                                   "density, pressure and temperature." );
     }
 
+    // Initialize independent variables used for interpolation (NaN values ensure that first request is interpolated)
+    currentIndependentVariableData_ = std::vector< double >( numberOfIndependentVariables_, TUDAT_NAN );
+    interpolatedIndependentVariableData_ = std::vector< double >( numberOfIndependentVariables_, TUDAT_NAN );
+
     // Assign values to default boundary handling methods
     if ( boundaryHandling_.empty( ) )
     {
@@ -186,35 +190,17 @@ void TabulatedAtmosphere::createAtmosphereInterpolators( )
             }
         }
 
-        // Create interpolators for density, pressure and temperature
-        interpolatorForDensity_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                    independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 0 ) ),
-                    huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 0 ) ).at( 0 ) );
-        interpolatorForPressure_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                    independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 1 ) ),
-                    huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 1 ) ).at( 0 ) );
-        interpolatorForTemperature_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                    independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 2 ) ),
-                    huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 2 ) ).at( 0 ) );
-
-        // Create remaining interpolators, if requested by user
-        if ( dependentVariablesDependency_.at( 3 ) )
-        {
-            interpolatorForGasConstant_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                        independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 3 ) ),
-                        huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 3 ) ).at( 0 ) );
-        }
-        if ( dependentVariablesDependency_.at( 4 ) )
-        {
-            interpolatorForSpecificHeatRatio_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                        independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 4 ) ),
-                        huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 4 ) ).at( 0 ) );
-        }
-        if ( dependentVariablesDependency_.at( 5 ) )
+        // Create interpolators for variables requested by user
+        oneDimensionalInterpolators_.resize( dependentVariablesDependency_.size( ) );
+        for ( unsigned int j = 0; j < dependentVariablesDependency_.size( ); j++ )
         {
-            interpolatorForMolarMass_ = std::make_shared< CubicSplineInterpolatorDouble >(
-                        independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( 5 ) ),
-                        huntingAlgorithm, boundaryHandling_.at( 0 ), defaultExtrapolationValue_.at( dependentVariableIndices_.at( 5 ) ).at( 0 ) );
+            if ( dependentVariablesDependency_.at( j ) )
+            {
+                oneDimensionalInterpolators_.at( j ) = std::make_shared< CubicSplineInterpolatorDouble >(
+                            independentVariablesData_.at( 0 ), dependentVariablesData.at( dependentVariableIndices_.at( j ) ),
+                            huntingAlgorithm, boundaryHandling_.at( 0 ),
+                            defaultExtrapolationValue_.at( dependentVariableIndices_.at( j ) ).at( 0 ) );
+            }
         }
         break;
     }
@@ -253,42 +239,44 @@ void TabulatedAtmosphere::createMultiDimensionalAtmosphereInterpolators( )
     // Assign independent variables
     independentVariablesData_ = tabulatedAtmosphereData.second;
 
-    // Create interpolators for density, pressure and temperature
-    interpolatorForDensity_ =
-            std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 0 ) ),
-                huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 0 ) ) );
-    interpolatorForPressure_ =
-            std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 1 ) ),
-                huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 1 ) ) );
-    interpolatorForTemperature_ =
-            std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 2 ) ),
-                huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 2 ) ) );
-
-    // Create remaining interpolators, if requested by user
-    if ( dependentVariablesDependency_.at( 3 ) )
+    // Combine dependent variables into single table, so that they can be interpolated in a single pass
+    const unsigned int numberOfDependentVariables = dependentVariables_.size( );
+    boost::multi_array< Eigen::Vector6d, static_cast< size_t >( NumberOfIndependentVariables ) > combinedDependentVariables;
+    combinedDependentVariables.resize( reinterpret_cast< boost::array< size_t, NumberOfIndependentVariables > const& >(
+                                           *tabulatedAtmosphereData.first.at( 0 ).shape( ) ) );
+    for ( unsigned int i = 0; i < numberOfDependentVariables; i++ )
     {
-        interpolatorForGasConstant_ =
-                std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                    independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 3 ) ),
-                    huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 3 ) ) );
+        if ( tabulatedAtmosphereData.first.at( i ).num_elements( ) != combinedDependentVariables.num_elements( ) )
+        {
+            throw std::runtime_error( "Error, in tabulated atmosphere. Atmosphere table files have inconsistent sizes." );
+        }
     }
-    if ( dependentVariablesDependency_.at( 4 ) )
+    for ( unsigned int j = 0; j < combinedDependentVariables.num_elements( ); j++ )
     {
-        interpolatorForSpecificHeatRatio_ =
-                std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                    independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 4 ) ),
-                    huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 4 ) ) );
+        combinedDependentVariables.data( )[ j ].setZero( );
+        for ( unsigned int i = 0; i < numberOfDependentVariables; i++ )
+        {
+            combinedDependentVariables.data( )[ j ]( i ) = tabulatedAtmosphereData.first.at( i ).data( )[ j ];
+        }
     }
-    if ( dependentVariablesDependency_.at( 5 ) )
+
+    // Combine default extrapolation values
+    std::vector< std::pair< Eigen::Vector6d, Eigen::Vector6d > > combinedDefaultExtrapolationValues(
+                NumberOfIndependentVariables, std::make_pair( Eigen::Vector6d::Zero( ), Eigen::Vector6d::Zero( ) ) );
+    for ( unsigned int i = 0; i < numberOfDependentVariables; i++ )
     {
-        interpolatorForMolarMass_ =
-                std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                    independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 5 ) ),
-                    huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 5 ) ) );
+        for ( unsigned int k = 0; k < NumberOfIndependentVariables; k++ )
+        {
+            combinedDefaultExtrapolationValues.at( k ).first( i ) = defaultExtrapolationValue_.at( i ).at( k ).first;
+            combinedDefaultExtrapolationValues.at( k ).second( i ) = defaultExtrapolationValue_.at( i ).at( k ).second;
+        }
     }
+
+    // Create interpolator for all dependent variables
+    multiDimensionalInterpolator_ =
+            std::make_shared< MultiLinearInterpolator< double, Eigen::Vector6d, NumberOfIndependentVariables > >(
+                independentVariablesData_, combinedDependentVariables, huntingAlgorithm, boundaryHandling_,
+                combinedDefaultExtrapolationValues );
 }
 
 } // namespace aerodynamics
@@ -23,11 +23,13 @@
 
 #include <Eigen/Core>
 
+#include "Tudat/Basics/basicTypedefs.h"
 #include "Tudat/Basics/utilityMacros.h"
 
 #include "Tudat/Astrodynamics/Aerodynamics/standardAtmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/linearInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
@@ -217,29 +219,7 @@ public:
     double getDensity( const double altitude, const double longitude = 0.0,
                        const double latitude = 0.0, const double time = 0.0 )
     {
-        // Get list of independent variables
-        std::vector< double > independentVariableData;
-        for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-        {
-            switch ( independentVariables_.at( i ) )
-            {
-            case altitude_dependent_atmosphere:
-                independentVariableData.push_back( altitude );
-                break;
-            case longitude_dependent_atmosphere:
-                independentVariableData.push_back( longitude );
-                break;
-            case latitude_dependent_atmosphere:
-                independentVariableData.push_back( latitude );
-                break;
-            case time_dependent_atmosphere:
-                independentVariableData.push_back( time );
-                break;
-            }
-        }
-
-        // Give output
-        return interpolatorForDensity_->interpolate( independentVariableData );
+        return getDependentVariable( density_dependent_atmosphere, altitude, longitude, latitude, time );
     }
 
     //! Get local pressure.
@@ -254,29 +234,7 @@ public:
     double getPressure( const double altitude, const double longitude = 0.0,
                         const double latitude = 0.0, const double time = 0.0 )
     {
-        // Get list of independent variables
-        std::vector< double > independentVariableData;
-        for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-        {
-            switch ( independentVariables_.at( i ) )
-            {
-            case altitude_dependent_atmosphere:
-                independentVariableData.push_back( altitude );
-                break;
-            case longitude_dependent_atmosphere:
-                independentVariableData.push_back( longitude );
-                break;
-            case latitude_dependent_atmosphere:
-                independentVariableData.push_back( latitude );
-                break;
-            case time_dependent_atmosphere:
-                independentVariableData.push_back( time );
-                break;
-            }
-        }
-
-        // Give output
-        return interpolatorForPressure_->interpolate( independentVariableData );
+        return getDependentVariable( pressure_dependent_atmosphere, altitude, longitude, latitude, time );
     }
 
     //! Get local temperature.
@@ -291,29 +249,7 @@ public:
     double getTemperature( const double altitude, const double longitude = 0.0,
                            const double latitude = 0.0, const double time = 0.0 )
     {
-        // Get list of independent variables
-        std::vector< double > independentVariableData;
-        for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-        {
-            switch ( independentVariables_.at( i ) )
-            {
-            case altitude_dependent_atmosphere:
-                independentVariableData.push_back( altitude );
-                break;
-            case longitude_dependent_atmosphere:
-                independentVariableData.push_back( longitude );
-                break;
-            case latitude_dependent_atmosphere:
-                independentVariableData.push_back( latitude );
-                break;
-            case time_dependent_atmosphere:
-                independentVariableData.push_back( time );
-                break;
-            }
-        }
-
-        // Give output
-        return interpolatorForTemperature_->interpolate( independentVariableData );
+        return getDependentVariable( temperature_dependent_atmosphere, altitude, longitude, latitude, time );
     }
 
     //! Get specific gas constant.
@@ -330,29 +266,7 @@ public:
     {
         if ( dependentVariablesDependency_.at( gas_constant_dependent_atmosphere ) )
         {
-            // Get list of independent variables
-            std::vector< double > independentVariableData;
-            for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-            {
-                switch ( independentVariables_.at( i ) )
-                {
-                case altitude_dependent_atmosphere:
-                    independentVariableData.push_back( altitude );
-                    break;
-                case longitude_dependent_atmosphere:
-                    independentVariableData.push_back( longitude );
-                    break;
-                case latitude_dependent_atmosphere:
-                    independentVariableData.push_back( latitude );
-                    break;
-                case time_dependent_atmosphere:
-                    independentVariableData.push_back( time );
-                    break;
-                }
-            }
-
-            // Give output
-            return interpolatorForGasConstant_->interpolate( independentVariableData );
+            return getDependentVariable( gas_constant_dependent_atmosphere, altitude, longitude, latitude, time );
         }
         else
         {
@@ -374,29 +288,7 @@ public:
     {
         if ( dependentVariablesDependency_.at( specific_heat_ratio_dependent_atmosphere ) )
         {
-            // Get list of independent variables
-            std::vector< double > independentVariableData;
-            for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-            {
-                switch ( independentVariables_.at( i ) )
-                {
-                case altitude_dependent_atmosphere:
-                    independentVariableData.push_back( altitude );
-                    break;
-                case longitude_dependent_atmosphere:
-                    independentVariableData.push_back( longitude );
-                    break;
-                case latitude_dependent_atmosphere:
-                    independentVariableData.push_back( latitude );
-                    break;
-                case time_dependent_atmosphere:
-                    independentVariableData.push_back( time );
-                    break;
-                }
-            }
-
-            // Give output
-            return interpolatorForSpecificHeatRatio_->interpolate( independentVariableData );
+            return getDependentVariable( specific_heat_ratio_dependent_atmosphere, altitude, longitude, latitude, time );
         }
         else
         {
@@ -418,29 +310,7 @@ public:
     {
         if ( dependentVariablesDependency_.at( molar_mass_dependent_atmosphere ) )
         {
-            // Get list of independent variables
-            std::vector< double > independentVariableData;
-            for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-            {
-                switch ( independentVariables_.at( i ) )
-                {
-                case altitude_dependent_atmosphere:
-                    independentVariableData.push_back( altitude );
-                    break;
-                case longitude_dependent_atmosphere:
-                    independentVariableData.push_back( longitude );
-                    break;
-                case latitude_dependent_atmosphere:
-                    independentVariableData.push_back( latitude );
-                    break;
-                case time_dependent_atmosphere:
-                    independentVariableData.push_back( time );
-                    break;
-                }
-            }
-
-            // Give output
-            return interpolatorForMolarMass_->interpolate( independentVariableData );
+            return getDependentVariable( molar_mass_dependent_atmosphere, altitude, longitude, latitude, time );
         }
         else
         {
@@ -470,6 +340,59 @@ protected:
 
 private:
 
+    //! Function to retrieve the value of a single dependent variable at the specified conditions.
+    /*!
+     *  Function to retrieve the value of a single dependent variable at the specified conditions. If more than one
+     *  independent variable is used, all dependent variables are interpolated in a single pass and stored, so that
+     *  subsequent requests for other dependent variables at the same conditions (e.g. density, pressure and temperature
+     *  when updating the flight conditions) do not require a new interpolation.
+     *  \param dependentVariable Dependent variable that is to be retrieved (must be present in the atmosphere table).
+     *  \param altitude Altitude at which dependent variable is to be computed.
+     *  \param longitude Longitude at which dependent variable is to be computed.
+     *  \param latitude Latitude at which dependent variable is to be computed.
+     *  \param time Time at which dependent variable is to be computed.
+     *  \return Dependent variable at specified conditions.
+     */
+    double getDependentVariable( const AtmosphereDependentVariables dependentVariable, const double altitude,
+                                 const double longitude, const double latitude, const double time )
+    {
+        // Set list of independent variables
+        for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
+        {
+            switch ( independentVariables_.at( i ) )
+            {
+            case altitude_dependent_atmosphere:
+                currentIndependentVariableData_[ i ] = altitude;
+                break;
+            case longitude_dependent_atmosphere:
+                currentIndependentVariableData_[ i ] = longitude;
+                break;
+            case latitude_dependent_atmosphere:
+                currentIndependentVariableData_[ i ] = latitude;
+                break;
+            case time_dependent_atmosphere:
+                currentIndependentVariableData_[ i ] = time;
+                break;
+            }
+        }
+
+        // Give output
+        if ( numberOfIndependentVariables_ == 1 )
+        {
+            return oneDimensionalInterpolators_[ dependentVariable ]->interpolate( currentIndependentVariableData_[ 0 ] );
+        }
+        else
+        {
+            // Interpolate all dependent variables, if conditions have changed
+            if ( currentIndependentVariableData_ != interpolatedIndependentVariableData_ )
+            {
+                currentDependentVariables_ = multiDimensionalInterpolator_->interpolate( currentIndependentVariableData_ );
+                interpolatedIndependentVariableData_ = currentIndependentVariableData_;
+            }
+            return currentDependentVariables_( dependentVariableIndices_[ dependentVariable ] );
+        }
+    }
+
     //! Function to create the interpolators based on the tabulated atmosphere files.
     /*!
      *  Function to create the interpolators based on the tabulated atmosphere files, and the provided interpolation settings. This
@@ -525,23 +448,23 @@ private:
     //! Ratio of specific heats of the atmosphere at constant pressure and constant volume.
     double ratioOfSpecificHeats_;
 
-    //! Interpolation for density. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForDensity_;
-
-    //! Interpolation for pressure. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForPressure_;
+    //! Interpolators for each dependent variable (indexed by AtmosphereDependentVariables), if only one independent
+    //! variable is used (cubic spline interpolation).
+    std::vector< std::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > >
+    oneDimensionalInterpolators_;
 
-    //! Interpolation for temperature. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForTemperature_;
+    //! Interpolator for all dependent variables at once, if more than one independent variable is used (multi-linear
+    //! interpolation). Entry i of the interpolated vector corresponds to the i-th entry of dependentVariables_.
+    std::shared_ptr< interpolators::Interpolator< double, Eigen::Vector6d > > multiDimensionalInterpolator_;
 
-    //! Interpolation for specific gas constant. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForGasConstant_;
+    //! Values of independent variables at which dependent variables are to be computed (size is kept constant).
+    std::vector< double > currentIndependentVariableData_;
 
-    //! Interpolation for ratio of specific heats. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForSpecificHeatRatio_;
+    //! Values of independent variables at which currentDependentVariables_ were last computed.
+    std::vector< double > interpolatedIndependentVariableData_;
 
-    //! Interpolation for molar mass. Note that type of interpolator depends on number of independent variables specified.
-    std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForMolarMass_;
+    //! Dependent variables, as computed by multiDimensionalInterpolator_ at interpolatedIndependentVariableData_.
+    Eigen::Vector6d currentDependentVariables_;
 
     //! Behavior of interpolator when independent variable is outside range.
     std::vector< interpolators::BoundaryInterpolationType > boundaryHandling_;
@@ -0,0 +1,257 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/batchOrbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/modifiedEquinoctialElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unifiedStateModelQuaternionElementConversions.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace mathematical_constants;
+using namespace orbital_element_conversions;
+
+BOOST_AUTO_TEST_SUITE( test_batch_orbital_element_conversions )
+
+//! Function to generate a batch of random elliptical Keplerian elements.
+StateBatch6d getRandomKeplerianElements( const int numberOfStates, const double maximumEccentricity )
+{
+    boost::random::mt19937 randomNumberGenerator( 42 );
+    boost::random::uniform_real_distribution< > unitDistribution( 0.0, 1.0 );
+
+    StateBatch6d keplerianElements( numberOfStates, 6 );
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        keplerianElements( i, semiMajorAxisIndex ) = 7.0E6 + 4.0E7 * unitDistribution( randomNumberGenerator );
+        keplerianElements( i, eccentricityIndex ) = maximumEccentricity * unitDistribution( randomNumberGenerator );
+        keplerianElements( i, inclinationIndex ) = PI * unitDistribution( randomNumberGenerator );
+        keplerianElements( i, argumentOfPeriapsisIndex ) = 2.0 * PI * unitDistribution( randomNumberGenerator );
+        keplerianElements( i, longitudeOfAscendingNodeIndex ) = 2.0 * PI * unitDistribution( randomNumberGenerator );
+        keplerianElements( i, trueAnomalyIndex ) = 2.0 * PI * unitDistribution( randomNumberGenerator );
+    }
+    return keplerianElements;
+}
+
+//! Function to check whether Cartesian states are equal, to within tolerance w.r.t. norm of position and velocity.
+void checkCartesianStatesClose( const Eigen::Vector6d& expectedCartesianElements,
+                                const Eigen::Vector6d& computedCartesianElements )
+{
+    BOOST_CHECK_SMALL( ( computedCartesianElements - expectedCartesianElements ).segment( 0, 3 ).norm( ) /
+                       expectedCartesianElements.segment( 0, 3 ).norm( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( computedCartesianElements - expectedCartesianElements ).segment( 3, 3 ).norm( ) /
+                       expectedCartesianElements.segment( 3, 3 ).norm( ), 1.0E-14 );
+}
+
+//! Test batch conversion of mean to eccentric anomaly against single-state conversion.
+BOOST_AUTO_TEST_CASE( testBatchMeanToEccentricAnomalyConversion )
+{
+    // Define grid of eccentricities (including near-parabolic values) and mean anomalies (including values outside of
+    // [0, 2 PI)).
+    std::vector< double > eccentricityValues = { 0.0, 1.0E-8, 0.01, 0.1, 0.3, 0.5, 0.7, 0.9, 0.95, 0.99, 0.999, 0.9999,
+                                                 1.0 - 1.0E-8 };
+    const int numberOfMeanAnomalies = 2001;
+
+    Eigen::ArrayXd eccentricities( eccentricityValues.size( ) * numberOfMeanAnomalies );
+    Eigen::ArrayXd meanAnomalies( eccentricityValues.size( ) * numberOfMeanAnomalies );
+    for( unsigned int i = 0; i < eccentricityValues.size( ); i++ )
+    {
+        for( int j = 0; j < numberOfMeanAnomalies; j++ )
+        {
+            eccentricities( i * numberOfMeanAnomalies + j ) = eccentricityValues.at( i );
+            meanAnomalies( i * numberOfMeanAnomalies + j ) =
+                    -4.0 * PI + 8.0 * PI * static_cast< double >( j ) / static_cast< double >( numberOfMeanAnomalies - 1 );
+        }
+    }
+
+    Eigen::ArrayXd eccentricAnomalies = convertMeanAnomaliesToEccentricAnomalies( eccentricities, meanAnomalies );
+
+    for( int i = 0; i < eccentricities.rows( ); i++ )
+    {
+        double expectedEccentricAnomaly = convertMeanAnomalyToEccentricAnomaly( eccentricities( i ), meanAnomalies( i ) );
+
+        // Compare solutions, accounting for wrapping of solutions close to 0 and 2 PI.
+        double eccentricAnomalyDifference = eccentricAnomalies( i ) - expectedEccentricAnomaly;
+        eccentricAnomalyDifference -= 2.0 * PI * std::round( eccentricAnomalyDifference / ( 2.0 * PI ) );
+        BOOST_CHECK_SMALL( eccentricAnomalyDifference, 1.0E-12 );
+
+        // Check range of solution
+        BOOST_CHECK( eccentricAnomalies( i ) >= 0.0 && eccentricAnomalies( i ) < 2.0 * PI + 1.0E-12 );
+    }
+
+    // Check that eccentricities outside of elliptical range are rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        convertMeanAnomaliesToEccentricAnomalies( Eigen::ArrayXd::Constant( 2, 1.5 ), Eigen::ArrayXd::Zero( 2 ) );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+//! Test batch conversion of mean to eccentric anomaly against single-state conversion, for high eccentricities close to
+//! periapsis.
+BOOST_AUTO_TEST_CASE( testBatchMeanToEccentricAnomalyConversionNearPeriapsis )
+{
+    // Define grid of high eccentricities and log-spaced mean anomalies (of both signs) in range [1E-10, 1E-2].
+    std::vector< double > eccentricityValues = { 0.95, 0.99, 0.999, 0.9999, 1.0 - 1.0E-8 };
+    const int numberOfMeanAnomalyMagnitudes = 81;
+
+    Eigen::ArrayXd eccentricities( 2 * eccentricityValues.size( ) * numberOfMeanAnomalyMagnitudes );
+    Eigen::ArrayXd meanAnomalies( 2 * eccentricityValues.size( ) * numberOfMeanAnomalyMagnitudes );
+    int currentIndex = 0;
+    for( unsigned int i = 0; i < eccentricityValues.size( ); i++ )
+    {
+        for( int j = 0; j < numberOfMeanAnomalyMagnitudes; j++ )
+        {
+            double meanAnomalyMagnitude = std::pow(
+                        10.0, -10.0 + 8.0 * static_cast< double >( j ) /
+                        static_cast< double >( numberOfMeanAnomalyMagnitudes - 1 ) );
+            for( int sign = -1; sign <= 1; sign += 2 )
+            {
+                eccentricities( currentIndex ) = eccentricityValues.at( i );
+                meanAnomalies( currentIndex ) = sign * meanAnomalyMagnitude;
+                currentIndex++;
+            }
+        }
+    }
+
+    Eigen::ArrayXd eccentricAnomalies = convertMeanAnomaliesToEccentricAnomalies( eccentricities, meanAnomalies );
+
+    const double epsilon = std::numeric_limits< double >::epsilon( );
+    for( int i = 0; i < eccentricities.rows( ); i++ )
+    {
+        // Check that solution is on the same side of periapsis as the mean anomaly.
+        double eccentricAnomaly = eccentricAnomalies( i );
+        if( eccentricAnomaly > PI )
+        {
+            eccentricAnomaly -= 2.0 * PI;
+        }
+        BOOST_CHECK( ( meanAnomalies( i ) > 0.0 ) == ( eccentricAnomaly > 0.0 ) );
+
+        // Check residual of Kepler's equation, allowing for round-off in the eccentric anomaly mapped to [0, 2 PI].
+        double keplerFunctionDerivative = 1.0 - eccentricities( i ) * std::cos( eccentricAnomaly );
+        BOOST_CHECK_SMALL( eccentricAnomaly - eccentricities( i ) * std::sin( eccentricAnomaly ) - meanAnomalies( i ),
+                           10.0 * epsilon * ( std::fabs( eccentricAnomaly ) + 2.0 * PI * keplerFunctionDerivative ) );
+
+        // Compare with single-state solution. Its root finder terminates on a tolerance of the residual of Kepler's
+        // equation (after reduction of the mean anomaly to [0, 2 PI)), which is amplified by 1 / ( 1 - e cos E ) in the
+        // eccentric anomaly.
+        double expectedEccentricAnomaly = convertMeanAnomalyToEccentricAnomaly( eccentricities( i ), meanAnomalies( i ) );
+        double eccentricAnomalyDifference = eccentricAnomalies( i ) - expectedEccentricAnomaly;
+        eccentricAnomalyDifference -= 2.0 * PI * std::round( eccentricAnomalyDifference / ( 2.0 * PI ) );
+        BOOST_CHECK_SMALL( eccentricAnomalyDifference, 1.0E-12 + ( 200.0 + 4.0 * PI ) * epsilon / keplerFunctionDerivative );
+    }
+}
+
+//! Test batch conversions and propagation of Keplerian elements against single-state conversions.
+BOOST_AUTO_TEST_CASE( testBatchKeplerianElementConversions )
+{
+    const double earthGravitationalParameter = 3.986004418E14;
+    const int numberOfStates = 1000;
+    StateBatch6d keplerianElements = getRandomKeplerianElements( numberOfStates, 0.99 );
+
+    Eigen::ArrayXd propagationTimes = Eigen::ArrayXd::LinSpaced( numberOfStates, -1.0E6, 1.0E6 );
+
+    StateBatch6d cartesianElements =
+            convertKeplerianToCartesianElementsBatch( keplerianElements, earthGravitationalParameter );
+    StateBatch6d propagatedKeplerianElements =
+            propagateKeplerOrbitsBatch( keplerianElements, propagationTimes, earthGravitationalParameter );
+    BatchFlags flipSingularityToZeroInclination = getModifiedEquinoctialSingularityFlipFlagsBatch( keplerianElements );
+    StateBatch6d modifiedEquinoctialElements = convertKeplerianToModifiedEquinoctialElementsBatch( keplerianElements );
+    StateBatch6d reconvertedKeplerianElements = convertModifiedEquinoctialToKeplerianElementsBatch(
+                modifiedEquinoctialElements, flipSingularityToZeroInclination );
+    StateBatch7d unifiedStateModelElements = convertKeplerianToUnifiedStateModelQuaternionsElementsBatch(
+                keplerianElements, earthGravitationalParameter );
+    StateBatch6d cartesianElementsFromUnifiedStateModel = convertUnifiedStateModelQuaternionsToCartesianElementsBatch(
+                unifiedStateModelElements, earthGravitationalParameter );
+
+    // Direct conversion from modified equinoctial to Cartesian elements (only compared for states with singularity at 180
+    // degrees inclination, for which the single-state conversion is implemented).
+    StateBatch6d cartesianElementsFromModifiedEquinoctial = convertModifiedEquinoctialToCartesianElementsBatch(
+                modifiedEquinoctialElements, earthGravitationalParameter );
+
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        Eigen::Vector6d currentKeplerianElements = keplerianElements.row( i ).transpose( );
+
+        // Check Kepler to Cartesian conversion.
+        Eigen::Vector6d expectedCartesianElements =
+                convertKeplerianToCartesianElements( currentKeplerianElements, earthGravitationalParameter );
+        checkCartesianStatesClose( expectedCartesianElements, cartesianElements.row( i ).transpose( ) );
+
+        // Check Kepler propagation.
+        Eigen::Vector6d expectedPropagatedKeplerianElements = propagateKeplerOrbit(
+                    currentKeplerianElements, propagationTimes( i ), earthGravitationalParameter );
+        for( int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_EQUAL( propagatedKeplerianElements( i, j ), expectedPropagatedKeplerianElements( j ) );
+        }
+        double trueAnomalyDifference =
+                propagatedKeplerianElements( i, trueAnomalyIndex ) - expectedPropagatedKeplerianElements( trueAnomalyIndex );
+        trueAnomalyDifference -= 2.0 * PI * std::round( trueAnomalyDifference / ( 2.0 * PI ) );
+        BOOST_CHECK_SMALL( trueAnomalyDifference, 1.0E-10 );
+
+        // Check Kepler to MEE conversion, and back.
+        Eigen::Vector6d expectedModifiedEquinoctialElements =
+                convertKeplerianToModifiedEquinoctialElements( currentKeplerianElements );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    expectedModifiedEquinoctialElements, Eigen::Vector6d( modifiedEquinoctialElements.row( i ) ), 1.0E-14 );
+
+        Eigen::Vector6d expectedReconvertedKeplerianElements = convertModifiedEquinoctialToKeplerianElements(
+                    expectedModifiedEquinoctialElements, flipSingularityToZeroInclination( i ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    expectedReconvertedKeplerianElements, Eigen::Vector6d( reconvertedKeplerianElements.row( i ) ), 1.0E-13 );
+
+        if( !flipSingularityToZeroInclination( i ) )
+        {
+            Eigen::Vector6d expectedCartesianElementsFromModifiedEquinoctial = convertModifiedEquinoctialToCartesianElements(
+                        expectedModifiedEquinoctialElements, earthGravitationalParameter, false );
+            checkCartesianStatesClose( expectedCartesianElementsFromModifiedEquinoctial,
+                                       cartesianElementsFromModifiedEquinoctial.row( i ).transpose( ) );
+        }
+
+        // Check Kepler to USM conversion, and USM to Cartesian conversion.
+        Eigen::Vector7d expectedUnifiedStateModelElements = convertKeplerianToUnifiedStateModelQuaternionsElements(
+                    currentKeplerianElements, earthGravitationalParameter );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    expectedUnifiedStateModelElements, Eigen::Vector7d( unifiedStateModelElements.row( i ) ), 1.0E-14 );
+
+        Eigen::Vector6d expectedCartesianElementsFromUnifiedStateModel = convertUnifiedStateModelQuaternionsToCartesianElements(
+                    expectedUnifiedStateModelElements, earthGravitationalParameter );
+        checkCartesianStatesClose( expectedCartesianElementsFromUnifiedStateModel,
+                                   cartesianElementsFromUnifiedStateModel.row( i ).transpose( ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
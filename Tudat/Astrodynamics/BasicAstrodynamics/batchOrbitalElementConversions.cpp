@@ -0,0 +1,506 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/batchOrbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
+
+namespace tudat
+{
+
+namespace orbital_element_conversions
+{
+
+using mathematical_constants::PI;
+
+//! Function to compute the element-wise four-quadrant inverse tangent of two arrays.
+Eigen::ArrayXd computeArrayAtan2( const Eigen::ArrayXd& sineTerms, const Eigen::ArrayXd& cosineTerms )
+{
+    return sineTerms.binaryExpr( cosineTerms, [ ]( const double y, const double x ){ return std::atan2( y, x ); } );
+}
+
+//! Function to compute the element-wise modulo of an array (see basic_mathematics::computeModulo).
+Eigen::ArrayXd computeArrayModulo( const Eigen::ArrayXd& dividends, const double divisor )
+{
+    return dividends - divisor * ( dividends / divisor ).floor( );
+}
+
+//! Function to check whether the eccentricities in a batch are all elliptical.
+static void checkBatchEccentricitiesElliptical( const Eigen::ArrayXd& eccentricities )
+{
+    if( ( ( eccentricities < 0.0 ) || ( eccentricities >= 1.0 ) ).any( ) )
+    {
+        throw std::runtime_error( "Error in batch orbital element conversion, eccentricities must be in range [0, 1)" );
+    }
+}
+
+//! Function to check whether the inclinations in a batch are all in the range [0, PI].
+static void checkBatchInclinations( const Eigen::ArrayXd& inclinations )
+{
+    if( ( ( inclinations < 0.0 ) || ( inclinations > PI ) ).any( ) )
+    {
+        throw std::runtime_error( "Error in batch orbital element conversion, inclinations must be in range [0, PI]" );
+    }
+}
+
+//! Convert a batch of mean anomalies to eccentric anomalies, for elliptical orbits.
+Eigen::ArrayXd convertMeanAnomaliesToEccentricAnomalies(
+        const Eigen::ArrayXd& eccentricities,
+        const Eigen::ArrayXd& meanAnomalies,
+        const int numberOfIterations )
+{
+    checkBatchEccentricitiesElliptical( eccentricities );
+    if( eccentricities.rows( ) != meanAnomalies.rows( ) )
+    {
+        throw std::runtime_error( "Error when converting batch of mean to eccentric anomalies, input sizes are inconsistent" );
+    }
+
+    // Reduce mean anomalies to [-PI, PI], for which the starter is defined (without modifying values already in range, so
+    // that small negative mean anomalies do not lose precision).
+    Eigen::ArrayXd reducedMeanAnomalies = meanAnomalies - 2.0 * PI * ( meanAnomalies / ( 2.0 * PI ) ).round( );
+
+    // Set initial guess (Danby, 1992).
+    Eigen::ArrayXd eccentricAnomalies = reducedMeanAnomalies + 0.85 * eccentricities * reducedMeanAnomalies.sign( );
+
+    // For high eccentricities and small mean anomalies, replace initial guess by root of cubic approximation of Kepler's
+    // equation, M = ( 1 - e ) E + e E^3 / 6, for which the above starter is inaccurate. The root is computed for all
+    // states (with eccentricity bounded from below, to prevent division by zero), and selected where applicable.
+    Eigen::ArrayXd boundedEccentricities = eccentricities.max( 0.5 );
+    Eigen::ArrayXd cubicLinearTerms = 2.0 * ( 1.0 - boundedEccentricities ) / boundedEccentricities;
+    Eigen::ArrayXd cubicConstantTerms = 3.0 * reducedMeanAnomalies.abs( ) / boundedEccentricities;
+    Eigen::ArrayXd cubicIntermediateTerms =
+            ( cubicConstantTerms + ( cubicConstantTerms.square( ) + cubicLinearTerms.cube( ) ).sqrt( ) ).pow( 1.0 / 3.0 );
+    eccentricAnomalies = ( ( eccentricities > 0.8 ) && ( reducedMeanAnomalies.abs( ) < 0.1 ) ).select(
+                reducedMeanAnomalies.sign( ) * ( cubicIntermediateTerms - cubicLinearTerms / cubicIntermediateTerms ),
+                eccentricAnomalies );
+
+    // Iterate Kepler's equation with quartic convergence (Danby and Burkardt, 1983).
+    Eigen::ArrayXd sineTerms, cosineTerms, function, firstDerivative, firstCorrection, secondCorrection;
+    for( int i = 0; i < numberOfIterations; i++ )
+    {
+        sineTerms = eccentricities * eccentricAnomalies.sin( );
+        cosineTerms = eccentricities * eccentricAnomalies.cos( );
+        function = eccentricAnomalies - sineTerms - reducedMeanAnomalies;
+        firstDerivative = 1.0 - cosineTerms;
+
+        firstCorrection = -function / firstDerivative;
+        secondCorrection = -function / ( firstDerivative + 0.5 * firstCorrection * sineTerms );
+        eccentricAnomalies -= function / ( firstDerivative + 0.5 * secondCorrection * sineTerms +
+                                           secondCorrection * secondCorrection * cosineTerms / 6.0 );
+    }
+
+    // Map eccentric anomalies to [0, 2 PI), consistent with single-state function.
+    return eccentricAnomalies + 2.0 * PI * ( reducedMeanAnomalies < 0.0 ).cast< double >( );
+}
+
+//! Convert a batch of eccentric anomalies to mean anomalies, for elliptical orbits.
+Eigen::ArrayXd convertEccentricAnomaliesToMeanAnomalies(
+        const Eigen::ArrayXd& eccentricAnomalies,
+        const Eigen::ArrayXd& eccentricities )
+{
+    return eccentricAnomalies - eccentricities * eccentricAnomalies.sin( );
+}
+
+//! Convert a batch of eccentric anomalies to true anomalies, for elliptical orbits.
+Eigen::ArrayXd convertEccentricAnomaliesToTrueAnomalies(
+        const Eigen::ArrayXd& eccentricAnomalies,
+        const Eigen::ArrayXd& eccentricities )
+{
+    Eigen::ArrayXd cosineOfEccentricAnomalies = eccentricAnomalies.cos( );
+    Eigen::ArrayXd denominators = 1.0 - eccentricities * cosineOfEccentricAnomalies;
+
+    return computeArrayAtan2(
+                ( 1.0 - eccentricities.square( ) ).sqrt( ) * eccentricAnomalies.sin( ) / denominators,
+                ( cosineOfEccentricAnomalies - eccentricities ) / denominators );
+}
+
+//! Convert a batch of true anomalies to eccentric anomalies, for elliptical orbits.
+Eigen::ArrayXd convertTrueAnomaliesToEccentricAnomalies(
+        const Eigen::ArrayXd& trueAnomalies,
+        const Eigen::ArrayXd& eccentricities )
+{
+    Eigen::ArrayXd cosineOfTrueAnomalies = trueAnomalies.cos( );
+    Eigen::ArrayXd denominators = 1.0 + eccentricities * cosineOfTrueAnomalies;
+
+    return computeArrayAtan2(
+                ( 1.0 - eccentricities.square( ) ).sqrt( ) * trueAnomalies.sin( ) / denominators,
+                ( eccentricities + cosineOfTrueAnomalies ) / denominators );
+}
+
+//! Convert a batch of Keplerian elements to Cartesian elements.
+StateBatch6d convertKeplerianToCartesianElementsBatch(
+        const StateBatch6d& keplerianElements,
+        const double centralBodyGravitationalParameter )
+{
+    const double tolerance = std::numeric_limits< double >::epsilon( );
+
+    Eigen::ArrayXd eccentricities = keplerianElements.col( eccentricityIndex ).array( );
+    Eigen::ArrayXd trueAnomalies = keplerianElements.col( trueAnomalyIndex ).array( );
+
+    // Pre-compute sines and cosines of involved angles.
+    Eigen::ArrayXd cosineOfInclination = keplerianElements.col( inclinationIndex ).array( ).cos( );
+    Eigen::ArrayXd sineOfInclination = keplerianElements.col( inclinationIndex ).array( ).sin( );
+    Eigen::ArrayXd cosineOfArgumentOfPeriapsis = keplerianElements.col( argumentOfPeriapsisIndex ).array( ).cos( );
+    Eigen::ArrayXd sineOfArgumentOfPeriapsis = keplerianElements.col( argumentOfPeriapsisIndex ).array( ).sin( );
+    Eigen::ArrayXd cosineOfLongitudeOfAscendingNode =
+            keplerianElements.col( longitudeOfAscendingNodeIndex ).array( ).cos( );
+    Eigen::ArrayXd sineOfLongitudeOfAscendingNode =
+            keplerianElements.col( longitudeOfAscendingNodeIndex ).array( ).sin( );
+    Eigen::ArrayXd cosineOfTrueAnomaly = trueAnomalies.cos( );
+    Eigen::ArrayXd sineOfTrueAnomaly = trueAnomalies.sin( );
+
+    // Compute semi-latus rectum (given as first element for (near-)parabolic orbits).
+    Eigen::ArrayXd semiLatusRectum = ( ( eccentricities - 1.0 ).abs( ) > tolerance ).select(
+                keplerianElements.col( semiMajorAxisIndex ).array( ) * ( 1.0 - eccentricities.square( ) ),
+                keplerianElements.col( semiLatusRectumIndex ).array( ) );
+
+    // Compute position and velocity in perifocal frame.
+    Eigen::ArrayXd radialDistance = semiLatusRectum / ( 1.0 + eccentricities * cosineOfTrueAnomaly );
+    Eigen::ArrayXd xPositionPerifocal = radialDistance * cosineOfTrueAnomaly;
+    Eigen::ArrayXd yPositionPerifocal = radialDistance * sineOfTrueAnomaly;
+
+    Eigen::ArrayXd velocityScaling = ( centralBodyGravitationalParameter / semiLatusRectum ).sqrt( );
+    Eigen::ArrayXd xVelocityPerifocal = -velocityScaling * sineOfTrueAnomaly;
+    Eigen::ArrayXd yVelocityPerifocal = velocityScaling * ( eccentricities + cosineOfTrueAnomaly );
+
+    // Compute the transformation matrix entries.
+    Eigen::ArrayXd transformationEntry00 = cosineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis -
+            sineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis * cosineOfInclination;
+    Eigen::ArrayXd transformationEntry01 = -cosineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis -
+            sineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis * cosineOfInclination;
+    Eigen::ArrayXd transformationEntry10 = sineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis +
+            cosineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis * cosineOfInclination;
+    Eigen::ArrayXd transformationEntry11 = -sineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis +
+            cosineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis * cosineOfInclination;
+    Eigen::ArrayXd transformationEntry20 = sineOfArgumentOfPeriapsis * sineOfInclination;
+    Eigen::ArrayXd transformationEntry21 = cosineOfArgumentOfPeriapsis * sineOfInclination;
+
+    // Transform position and velocity to inertial frame.
+    StateBatch6d cartesianElements( keplerianElements.rows( ), 6 );
+    cartesianElements.col( xCartesianPositionIndex ) =
+            transformationEntry00 * xPositionPerifocal + transformationEntry01 * yPositionPerifocal;
+    cartesianElements.col( yCartesianPositionIndex ) =
+            transformationEntry10 * xPositionPerifocal + transformationEntry11 * yPositionPerifocal;
+    cartesianElements.col( zCartesianPositionIndex ) =
+            transformationEntry20 * xPositionPerifocal + transformationEntry21 * yPositionPerifocal;
+    cartesianElements.col( xCartesianVelocityIndex ) =
+            transformationEntry00 * xVelocityPerifocal + transformationEntry01 * yVelocityPerifocal;
+    cartesianElements.col( yCartesianVelocityIndex ) =
+            transformationEntry10 * xVelocityPerifocal + transformationEntry11 * yVelocityPerifocal;
+    cartesianElements.col( zCartesianVelocityIndex ) =
+            transformationEntry20 * xVelocityPerifocal + transformationEntry21 * yVelocityPerifocal;
+
+    return cartesianElements;
+}
+
+//! Propagate a batch of elliptical Kepler orbits.
+StateBatch6d propagateKeplerOrbitsBatch(
+        const StateBatch6d& initialKeplerianElements,
+        const Eigen::ArrayXd& propagationTimes,
+        const double centralBodyGravitationalParameter,
+        const int numberOfIterations )
+{
+    Eigen::ArrayXd eccentricities = initialKeplerianElements.col( eccentricityIndex ).array( );
+    Eigen::ArrayXd semiMajorAxes = initialKeplerianElements.col( semiMajorAxisIndex ).array( );
+    checkBatchEccentricitiesElliptical( eccentricities );
+    if( propagationTimes.rows( ) != initialKeplerianElements.rows( ) )
+    {
+        throw std::runtime_error( "Error when propagating batch of Kepler orbits, input sizes are inconsistent" );
+    }
+
+    // Compute mean anomaly at end of propagation.
+    Eigen::ArrayXd finalMeanAnomalies =
+            convertEccentricAnomaliesToMeanAnomalies(
+                convertTrueAnomaliesToEccentricAnomalies(
+                    initialKeplerianElements.col( trueAnomalyIndex ).array( ), eccentricities ), eccentricities ) +
+            ( centralBodyGravitationalParameter / semiMajorAxes.cube( ) ).sqrt( ) * propagationTimes;
+
+    // Convert final mean anomaly to true anomaly.
+    StateBatch6d finalKeplerianElements = initialKeplerianElements;
+    finalKeplerianElements.col( trueAnomalyIndex ) =
+            convertEccentricAnomaliesToTrueAnomalies(
+                convertMeanAnomaliesToEccentricAnomalies( eccentricities, finalMeanAnomalies, numberOfIterations ),
+                eccentricities ).matrix( );
+
+    return finalKeplerianElements;
+}
+
+//! Function to determine, for a batch of Keplerian elements, whether the modified equinoctial singularity is to be flipped.
+BatchFlags getModifiedEquinoctialSingularityFlipFlagsBatch( const StateBatch6d& keplerianElements )
+{
+    checkBatchInclinations( keplerianElements.col( inclinationIndex ).array( ) );
+    return ( keplerianElements.col( inclinationIndex ).array( ) > PI / 2.0 );
+}
+
+//! Convert a batch of Keplerian elements to modified equinoctial elements.
+StateBatch6d convertKeplerianToModifiedEquinoctialElementsBatch(
+        const StateBatch6d& keplerianElements,
+        const BatchFlags& flipSingularityToZeroInclination )
+{
+    const double singularityTolerance = 5.0 * std::numeric_limits< double >::epsilon( );
+
+    Eigen::ArrayXd eccentricities = keplerianElements.col( eccentricityIndex ).array( );
+    Eigen::ArrayXd inclinations = keplerianElements.col( inclinationIndex ).array( );
+    Eigen::ArrayXd longitudesOfAscendingNode = keplerianElements.col( longitudeOfAscendingNodeIndex ).array( );
+    checkBatchInclinations( inclinations );
+
+    // Set sign of longitude of ascending node in composite angle, depending on equation set.
+    Eigen::ArrayXd retrogradeFactors = flipSingularityToZeroInclination.select(
+                Eigen::ArrayXd::Constant( keplerianElements.rows( ), -1.0 ),
+                Eigen::ArrayXd::Constant( keplerianElements.rows( ), 1.0 ) );
+    Eigen::ArrayXd argumentOfPeriapsisAndAscendingNode =
+            keplerianElements.col( argumentOfPeriapsisIndex ).array( ) + retrogradeFactors * longitudesOfAscendingNode;
+
+    Eigen::ArrayXd tangentOfHalfInclination = ( 0.5 * inclinations ).tan( );
+    tangentOfHalfInclination = flipSingularityToZeroInclination.select(
+                tangentOfHalfInclination.inverse( ), tangentOfHalfInclination );
+
+    StateBatch6d modifiedEquinoctialElements( keplerianElements.rows( ), 6 );
+    modifiedEquinoctialElements.col( semiLatusRectumIndex ) =
+            ( ( eccentricities - 1.0 ).abs( ) < singularityTolerance ).select(
+                keplerianElements.col( semiLatusRectumIndex ).array( ),
+                keplerianElements.col( semiMajorAxisIndex ).array( ) * ( 1.0 - eccentricities.square( ) ) );
+    modifiedEquinoctialElements.col( fElementIndex ) = eccentricities * argumentOfPeriapsisAndAscendingNode.cos( );
+    modifiedEquinoctialElements.col( gElementIndex ) = eccentricities * argumentOfPeriapsisAndAscendingNode.sin( );
+    modifiedEquinoctialElements.col( hElementIndex ) = tangentOfHalfInclination * longitudesOfAscendingNode.cos( );
+    modifiedEquinoctialElements.col( kElementIndex ) = tangentOfHalfInclination * longitudesOfAscendingNode.sin( );
+    modifiedEquinoctialElements.col( trueLongitudeIndex ) = computeArrayModulo(
+                argumentOfPeriapsisAndAscendingNode + keplerianElements.col( trueAnomalyIndex ).array( ), 2.0 * PI );
+
+    return modifiedEquinoctialElements;
+}
+
+//! Convert a batch of Keplerian elements to modified equinoctial elements, selecting the singularity from the inclination.
+StateBatch6d convertKeplerianToModifiedEquinoctialElementsBatch(
+        const StateBatch6d& keplerianElements )
+{
+    return convertKeplerianToModifiedEquinoctialElementsBatch(
+                keplerianElements, getModifiedEquinoctialSingularityFlipFlagsBatch( keplerianElements ) );
+}
+
+//! Convert a batch of modified equinoctial elements to Keplerian elements.
+StateBatch6d convertModifiedEquinoctialToKeplerianElementsBatch(
+        const StateBatch6d& modifiedEquinoctialElements,
+        const BatchFlags& flipSingularityToZeroInclination )
+{
+    const double singularityTolerance = 5.0 * std::numeric_limits< double >::epsilon( );
+
+    Eigen::ArrayXd fElements = modifiedEquinoctialElements.col( fElementIndex ).array( );
+    Eigen::ArrayXd gElements = modifiedEquinoctialElements.col( gElementIndex ).array( );
+    Eigen::ArrayXd hElements = modifiedEquinoctialElements.col( hElementIndex ).array( );
+    Eigen::ArrayXd kElements = modifiedEquinoctialElements.col( kElementIndex ).array( );
+
+    Eigen::ArrayXd retrogradeFactors = flipSingularityToZeroInclination.select(
+                Eigen::ArrayXd::Constant( modifiedEquinoctialElements.rows( ), -1.0 ),
+                Eigen::ArrayXd::Constant( modifiedEquinoctialElements.rows( ), 1.0 ) );
+
+    StateBatch6d keplerianElements( modifiedEquinoctialElements.rows( ), 6 );
+
+    // Compute eccentricity and semi-major axis (semi-latus rectum for (near-)parabolic orbits).
+    Eigen::ArrayXd eccentricities = ( fElements.square( ) + gElements.square( ) ).sqrt( );
+    keplerianElements.col( eccentricityIndex ) = eccentricities;
+    keplerianElements.col( semiMajorAxisIndex ) =
+            ( ( eccentricities - 1.0 ).abs( ) > singularityTolerance ).select(
+                modifiedEquinoctialElements.col( semiLatusRectumIndex ).array( ) / ( 1.0 - eccentricities.square( ) ),
+                modifiedEquinoctialElements.col( semiLatusRectumIndex ).array( ) );
+
+    // Compute longitude of ascending node and inclination.
+    Eigen::ArrayXd longitudesOfAscendingNode = computeArrayAtan2( kElements, hElements );
+    keplerianElements.col( longitudeOfAscendingNodeIndex ) = computeArrayModulo( longitudesOfAscendingNode, 2.0 * PI );
+
+    Eigen::ArrayXd hSquaredPlusKSquared = hElements.square( ) + kElements.square( );
+    hSquaredPlusKSquared = flipSingularityToZeroInclination.select(
+                hSquaredPlusKSquared.inverse( ), hSquaredPlusKSquared );
+    keplerianElements.col( inclinationIndex ) = 2.0 * hSquaredPlusKSquared.sqrt( ).atan( );
+
+    // Compute argument of periapsis (zero for circular orbits) and true anomaly.
+    Eigen::ArrayXd isOrbitCircular = ( eccentricities < singularityTolerance ).cast< double >( );
+    Eigen::ArrayXd argumentOfPeriapsisAndLongitude =
+            isOrbitCircular * retrogradeFactors * longitudesOfAscendingNode +
+            ( 1.0 - isOrbitCircular ) * computeArrayAtan2( gElements, fElements );
+
+    keplerianElements.col( argumentOfPeriapsisIndex ) =
+            ( 1.0 - isOrbitCircular ) * computeArrayModulo(
+                argumentOfPeriapsisAndLongitude - retrogradeFactors * longitudesOfAscendingNode, 2.0 * PI );
+    keplerianElements.col( trueAnomalyIndex ) = computeArrayModulo(
+                modifiedEquinoctialElements.col( trueLongitudeIndex ).array( ) - argumentOfPeriapsisAndLongitude,
+                2.0 * PI );
+
+    return keplerianElements;
+}
+
+//! Convert a batch of modified equinoctial elements to Cartesian elements.
+StateBatch6d convertModifiedEquinoctialToCartesianElementsBatch(
+        const StateBatch6d& modifiedEquinoctialElements,
+        const double centralBodyGravitationalParameter )
+{
+    Eigen::ArrayXd semiLatusRectum = modifiedEquinoctialElements.col( semiLatusRectumIndex ).array( );
+    Eigen::ArrayXd fElements = modifiedEquinoctialElements.col( fElementIndex ).array( );
+    Eigen::ArrayXd gElements = modifiedEquinoctialElements.col( gElementIndex ).array( );
+    Eigen::ArrayXd hElements = modifiedEquinoctialElements.col( hElementIndex ).array( );
+    Eigen::ArrayXd kElements = modifiedEquinoctialElements.col( kElementIndex ).array( );
+    Eigen::ArrayXd sineTrueLongitude = modifiedEquinoctialElements.col( trueLongitudeIndex ).array( ).sin( );
+    Eigen::ArrayXd cosineTrueLongitude = modifiedEquinoctialElements.col( trueLongitudeIndex ).array( ).cos( );
+
+    // Compute intermediate quantities.
+    Eigen::ArrayXd parameterW = 1.0 + fElements * cosineTrueLongitude + gElements * sineTrueLongitude;
+    Eigen::ArrayXd parameterSSquared = 1.0 + hElements.square( ) + kElements.square( );
+    Eigen::ArrayXd parameterAlphaSquared = hElements.square( ) - kElements.square( );
+    Eigen::ArrayXd twoHK = 2.0 * hElements * kElements;
+
+    Eigen::ArrayXd positionScaling = semiLatusRectum / ( parameterW * parameterSSquared );
+    Eigen::ArrayXd velocityScaling =
+            1.0 / ( parameterSSquared * ( semiLatusRectum / centralBodyGravitationalParameter ).sqrt( ) );
+
+    // Compute Cartesian elements.
+    StateBatch6d cartesianElements( modifiedEquinoctialElements.rows( ), 6 );
+    cartesianElements.col( xCartesianPositionIndex ) = positionScaling *
+            ( cosineTrueLongitude + parameterAlphaSquared * cosineTrueLongitude + twoHK * sineTrueLongitude );
+    cartesianElements.col( yCartesianPositionIndex ) = positionScaling *
+            ( sineTrueLongitude - parameterAlphaSquared * sineTrueLongitude + twoHK * cosineTrueLongitude );
+    cartesianElements.col( zCartesianPositionIndex ) = positionScaling *
+            2.0 * ( hElements * sineTrueLongitude - kElements * cosineTrueLongitude );
+    cartesianElements.col( xCartesianVelocityIndex ) = -velocityScaling *
+            ( sineTrueLongitude + parameterAlphaSquared * sineTrueLongitude - twoHK * cosineTrueLongitude + gElements -
+              twoHK * fElements + parameterAlphaSquared * gElements );
+    cartesianElements.col( yCartesianVelocityIndex ) = -velocityScaling *
+            ( -cosineTrueLongitude + parameterAlphaSquared * cosineTrueLongitude + twoHK * sineTrueLongitude - fElements +
+              twoHK * gElements + parameterAlphaSquared * fElements );
+    cartesianElements.col( zCartesianVelocityIndex ) = velocityScaling *
+            2.0 * ( hElements * cosineTrueLongitude + kElements * sineTrueLongitude + fElements * hElements +
+                    gElements * kElements );
+
+    return cartesianElements;
+}
+
+//! Convert a batch of Keplerian elements to unified state model elements with quaternions.
+StateBatch7d convertKeplerianToUnifiedStateModelQuaternionsElementsBatch(
+        const StateBatch6d& keplerianElements,
+        const double centralBodyGravitationalParameter )
+{
+    const double singularityTolerance = 20.0 * std::numeric_limits< double >::epsilon( );
+
+    Eigen::ArrayXd eccentricities = keplerianElements.col( eccentricityIndex ).array( );
+    Eigen::ArrayXd inclinations = keplerianElements.col( inclinationIndex ).array( );
+    Eigen::ArrayXd longitudesOfAscendingNode = keplerianElements.col( longitudeOfAscendingNodeIndex ).array( );
+    if( ( eccentricities < 0.0 ).any( ) )
+    {
+        throw std::runtime_error( "Error in batch orbital element conversion, eccentricities must be non-negative" );
+    }
+    checkBatchInclinations( inclinations );
+
+    // Compute hodograph elements (first element is semi-latus rectum for (near-)parabolic orbits).
+    Eigen::ArrayXd semiLatusRectum = ( ( eccentricities - 1.0 ).abs( ) < singularityTolerance ).select(
+                keplerianElements.col( semiLatusRectumIndex ).array( ),
+                keplerianElements.col( semiMajorAxisIndex ).array( ) * ( 1.0 - eccentricities.square( ) ) );
+    Eigen::ArrayXd cHodographElements = ( centralBodyGravitationalParameter / semiLatusRectum ).sqrt( );
+    Eigen::ArrayXd rHodographElements = eccentricities * cHodographElements;
+    Eigen::ArrayXd longitudeOfPeriapsis =
+            longitudesOfAscendingNode + keplerianElements.col( argumentOfPeriapsisIndex ).array( );
+
+    // Compute quaternion elements.
+    Eigen::ArrayXd argumentOfLatitude = keplerianElements.col( argumentOfPeriapsisIndex ).array( ) +
+            keplerianElements.col( trueAnomalyIndex ).array( );
+    Eigen::ArrayXd halfSumAngle = 0.5 * ( longitudesOfAscendingNode + argumentOfLatitude );
+    Eigen::ArrayXd halfDifferenceAngle = 0.5 * ( longitudesOfAscendingNode - argumentOfLatitude );
+    Eigen::ArrayXd cosineOfHalfInclination = ( 0.5 * inclinations ).cos( );
+    Eigen::ArrayXd sineOfHalfInclination = ( 0.5 * inclinations ).sin( );
+
+    StateBatch7d unifiedStateModelElements( keplerianElements.rows( ), 7 );
+    unifiedStateModelElements.col( CHodographUSM7Index ) = cHodographElements;
+    unifiedStateModelElements.col( Rf1HodographUSM7Index ) = -rHodographElements * longitudeOfPeriapsis.sin( );
+    unifiedStateModelElements.col( Rf2HodographUSM7Index ) = rHodographElements * longitudeOfPeriapsis.cos( );
+    unifiedStateModelElements.col( etaUSM7Index ) = cosineOfHalfInclination * halfSumAngle.cos( );
+    unifiedStateModelElements.col( epsilon1USM7Index ) = sineOfHalfInclination * halfDifferenceAngle.cos( );
+    unifiedStateModelElements.col( epsilon2USM7Index ) = sineOfHalfInclination * halfDifferenceAngle.sin( );
+    unifiedStateModelElements.col( epsilon3USM7Index ) = cosineOfHalfInclination * halfSumAngle.sin( );
+
+    return unifiedStateModelElements;
+}
+
+//! Convert a batch of unified state model elements with quaternions to Cartesian elements.
+StateBatch6d convertUnifiedStateModelQuaternionsToCartesianElementsBatch(
+        const StateBatch7d& unifiedStateModelElements,
+        const double centralBodyGravitationalParameter,
+        const bool forceQuaternionNormalization )
+{
+    const double singularityTolerance = 20.0 * std::numeric_limits< double >::epsilon( );
+
+    // Retrieve (and, if required, normalize) quaternion elements.
+    Eigen::ArrayXd eta = unifiedStateModelElements.col( etaUSM7Index ).array( );
+    Eigen::ArrayXd epsilon1 = unifiedStateModelElements.col( epsilon1USM7Index ).array( );
+    Eigen::ArrayXd epsilon2 = unifiedStateModelElements.col( epsilon2USM7Index ).array( );
+    Eigen::ArrayXd epsilon3 = unifiedStateModelElements.col( epsilon3USM7Index ).array( );
+
+    Eigen::ArrayXd quaternionNorms = ( eta.square( ) + epsilon1.square( ) + epsilon2.square( ) + epsilon3.square( ) ).sqrt( );
+    if( ( ( quaternionNorms - 1.0 ).abs( ) > singularityTolerance ).any( ) )
+    {
+        if( !forceQuaternionNormalization )
+        {
+            throw std::runtime_error( "Error in batch unified state model conversion, the norm of the quaternions should be "
+                                      "equal to one" );
+        }
+        eta /= quaternionNorms;
+        epsilon1 /= quaternionNorms;
+        epsilon2 /= quaternionNorms;
+        epsilon3 /= quaternionNorms;
+    }
+
+    Eigen::ArrayXd denominator = epsilon3.square( ) + eta.square( );
+    if( ( ( epsilon3.abs( ) < singularityTolerance ) && ( eta.abs( ) < singularityTolerance ) ).any( ) )
+    {
+        throw std::runtime_error( "Error in batch unified state model conversion, pure-retrograde orbit (inclination = PI) "
+                                  "cannot be converted" );
+    }
+
+    // Compute auxiliary parameters.
+    Eigen::ArrayXd cosineLambda = ( eta.square( ) - epsilon3.square( ) ) / denominator;
+    Eigen::ArrayXd sineLambda = 2.0 * epsilon3 * eta / denominator;
+
+    Eigen::ArrayXd cHodographElements = unifiedStateModelElements.col( CHodographUSM7Index ).array( );
+    Eigen::ArrayXd rf1HodographElements = unifiedStateModelElements.col( Rf1HodographUSM7Index ).array( );
+    Eigen::ArrayXd rf2HodographElements = unifiedStateModelElements.col( Rf2HodographUSM7Index ).array( );
+    Eigen::ArrayXd auxiliaryParameter1 = rf1HodographElements * cosineLambda + rf2HodographElements * sineLambda;
+    Eigen::ArrayXd auxiliaryParameter2 =
+            cHodographElements - rf1HodographElements * sineLambda + rf2HodographElements * cosineLambda;
+
+    // Compute first two columns of rotation matrix from quaternion (as Eigen::Quaterniond::toRotationMatrix).
+    Eigen::ArrayXd rotationEntry00 = 1.0 - 2.0 * ( epsilon2.square( ) + epsilon3.square( ) );
+    Eigen::ArrayXd rotationEntry10 = 2.0 * ( epsilon1 * epsilon2 + epsilon3 * eta );
+    Eigen::ArrayXd rotationEntry20 = 2.0 * ( epsilon1 * epsilon3 - epsilon2 * eta );
+    Eigen::ArrayXd rotationEntry01 = 2.0 * ( epsilon1 * epsilon2 - epsilon3 * eta );
+    Eigen::ArrayXd rotationEntry11 = 1.0 - 2.0 * ( epsilon1.square( ) + epsilon3.square( ) );
+    Eigen::ArrayXd rotationEntry21 = 2.0 * ( epsilon2 * epsilon3 + epsilon1 * eta );
+
+    // Compute Cartesian elements.
+    Eigen::ArrayXd radialDistance = centralBodyGravitationalParameter / cHodographElements / auxiliaryParameter2;
+
+    StateBatch6d cartesianElements( unifiedStateModelElements.rows( ), 6 );
+    cartesianElements.col( xCartesianPositionIndex ) = radialDistance * rotationEntry00;
+    cartesianElements.col( yCartesianPositionIndex ) = radialDistance * rotationEntry10;
+    cartesianElements.col( zCartesianPositionIndex ) = radialDistance * rotationEntry20;
+    cartesianElements.col( xCartesianVelocityIndex ) =
+            rotationEntry00 * auxiliaryParameter1 + rotationEntry01 * auxiliaryParameter2;
+    cartesianElements.col( yCartesianVelocityIndex ) =
+            rotationEntry10 * auxiliaryParameter1 + rotationEntry11 * auxiliaryParameter2;
+    cartesianElements.col( zCartesianVelocityIndex ) =
+            rotationEntry20 * auxiliaryParameter1 + rotationEntry21 * auxiliaryParameter2;
+
+    return cartesianElements;
+}
+
+} // namespace orbital_element_conversions
+
+} // namespace tudat
@@ -0,0 +1,251 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Danby, J.M.A. Fundamentals of Celestial Mechanics, 2nd edition, Willmann-Bell, 1992.
+ *      Danby, J.M.A., Burkardt, T.M., "The solution of Kepler's equation, I", Celestial Mechanics,
+ *          31, 95-107, 1983.
+ *      Hintz, G.R. "Survey of Orbit Element Sets", Journal of Guidance, Control, and Dynamics,
+ *          Vol. 31, No. 3, May-June 2008.
+ *      Vittaldev, V. (2010). The unified state model: Derivation and application in astrodynamics
+ *          and navigation. Master's thesis, Delft University of Technology.
+ *
+ *    Notes
+ *      The functions in this file convert batches of states at once. The states are stored as
+ *      structure-of-arrays: each row of the input/output matrices is a single state, and (since
+ *      Eigen matrices are column-major) each element type is stored contiguously. All operations
+ *      are written as Eigen array expressions without data-dependent branches, so that the
+ *      compiler can vectorize them over the states. Singular cases that are handled by branches
+ *      in the single-state conversions are handled by selecting between the two results instead.
+ *
+ */
+
+#ifndef TUDAT_BATCH_ORBITAL_ELEMENT_CONVERSIONS_H
+#define TUDAT_BATCH_ORBITAL_ELEMENT_CONVERSIONS_H
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace orbital_element_conversions
+{
+
+//! Typedef for a batch of six-element states (one state per row, one element type per column).
+typedef Eigen::Matrix< double, Eigen::Dynamic, 6 > StateBatch6d;
+
+//! Typedef for a batch of seven-element states (one state per row, one element type per column).
+typedef Eigen::Matrix< double, Eigen::Dynamic, 7 > StateBatch7d;
+
+//! Typedef for a list of flags, one per state in a batch.
+typedef Eigen::Array< bool, Eigen::Dynamic, 1 > BatchFlags;
+
+//! Function to compute the element-wise four-quadrant inverse tangent of two arrays.
+/*!
+ * Function to compute the element-wise four-quadrant inverse tangent of two arrays (see std::atan2).
+ * \param sineTerms Terms proportional to the sine of the angles (first argument of std::atan2).
+ * \param cosineTerms Terms proportional to the cosine of the angles (second argument of std::atan2).
+ * \return Angles, in range [-PI, PI].
+ */
+Eigen::ArrayXd computeArrayAtan2( const Eigen::ArrayXd& sineTerms, const Eigen::ArrayXd& cosineTerms );
+
+//! Function to compute the element-wise modulo of an array.
+/*!
+ * Function to compute the element-wise modulo of an array, with the remainder in the range [0, divisor) (see
+ * basic_mathematics::computeModulo).
+ * \param dividends Numbers to be divided by divisor.
+ * \param divisor Number that divides dividends.
+ * \return Remainders of division of dividends by divisor.
+ */
+Eigen::ArrayXd computeArrayModulo( const Eigen::ArrayXd& dividends, const double divisor );
+
+//! Convert a batch of mean anomalies to eccentric anomalies, for elliptical orbits.
+/*!
+ * Converts a batch of mean anomalies to eccentric anomalies for elliptical orbits, by solving Kepler's equation with a
+ * fixed number of iterations for all states. The initial guess is the starter of (Danby, 1992): E0 = M + 0.85 e sign(M)
+ * (with M reduced to [-PI, PI]), except for e > 0.8 and |M| < 0.1, where it is the root of the cubic approximation
+ * M = ( 1 - e ) E + e E^3 / 6 of Kepler's equation. Each iteration is the quartic-convergent correction of (Danby and
+ * Burkardt, 1983). For the default number of iterations, the result agrees with convertMeanAnomalyToEccentricAnomaly to
+ * within the tolerance of its root finder for all eccentricities in [0, 1). Note that, for near-parabolic orbits close to
+ * periapsis, this tolerance (on the residual of Kepler's equation) is amplified in the eccentric anomaly by
+ * dE/dM = 1 / ( 1 - e cos E ). As for the single-state function, the returned eccentric anomalies are in the range
+ * [0, 2 PI].
+ * \param eccentricities Eccentricities of the orbits, in range [0, 1).                              [-]
+ * \param meanAnomalies Mean anomalies of the orbits (any value).                                   [rad]
+ * \param numberOfIterations Number of iterations of Kepler's equation, performed for all states.
+ * \return Eccentric anomalies of the orbits.                                                       [rad]
+ */
+Eigen::ArrayXd convertMeanAnomaliesToEccentricAnomalies(
+        const Eigen::ArrayXd& eccentricities,
+        const Eigen::ArrayXd& meanAnomalies,
+        const int numberOfIterations = 3 );
+
+//! Convert a batch of eccentric anomalies to mean anomalies, for elliptical orbits.
+/*!
+ * Converts a batch of eccentric anomalies to mean anomalies for elliptical orbits (see
+ * convertEccentricAnomalyToMeanAnomaly).
+ * \param eccentricAnomalies Eccentric anomalies of the orbits.                                     [rad]
+ * \param eccentricities Eccentricities of the orbits, in range [0, 1).                              [-]
+ * \return Mean anomalies of the orbits.                                                            [rad]
+ */
+Eigen::ArrayXd convertEccentricAnomaliesToMeanAnomalies(
+        const Eigen::ArrayXd& eccentricAnomalies,
+        const Eigen::ArrayXd& eccentricities );
+
+//! Convert a batch of eccentric anomalies to true anomalies, for elliptical orbits.
+/*!
+ * Converts a batch of eccentric anomalies to true anomalies for elliptical orbits (see
+ * convertEllipticalEccentricAnomalyToTrueAnomaly).
+ * \param eccentricAnomalies Eccentric anomalies of the orbits.                                     [rad]
+ * \param eccentricities Eccentricities of the orbits, in range [0, 1).                              [-]
+ * \return True anomalies of the orbits, in range [-PI, PI].                                        [rad]
+ */
+Eigen::ArrayXd convertEccentricAnomaliesToTrueAnomalies(
+        const Eigen::ArrayXd& eccentricAnomalies,
+        const Eigen::ArrayXd& eccentricities );
+
+//! Convert a batch of true anomalies to eccentric anomalies, for elliptical orbits.
+/*!
+ * Converts a batch of true anomalies to eccentric anomalies for elliptical orbits (see
+ * convertTrueAnomalyToEllipticalEccentricAnomaly).
+ * \param trueAnomalies True anomalies of the orbits.                                               [rad]
+ * \param eccentricities Eccentricities of the orbits, in range [0, 1).                              [-]
+ * \return Eccentric anomalies of the orbits, in range [-PI, PI].                                   [rad]
+ */
+Eigen::ArrayXd convertTrueAnomaliesToEccentricAnomalies(
+        const Eigen::ArrayXd& trueAnomalies,
+        const Eigen::ArrayXd& eccentricities );
+
+//! Convert a batch of Keplerian elements to Cartesian elements.
+/*!
+ * Converts a batch of Keplerian elements to Cartesian elements (see convertKeplerianToCartesianElements). As for the
+ * single-state function, the first element of a (near-)parabolic orbit is taken to be the semi-latus rectum.
+ * \param keplerianElements Keplerian elements of the states, one state per row, with the order of the columns defined by
+ *          the KeplerianElementIndices enum.
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body.                       [m^3/s^2]
+ * \return Cartesian elements of the states, one state per row, with the order of the columns defined by the
+ *          CartesianElementIndices enum.
+ */
+StateBatch6d convertKeplerianToCartesianElementsBatch(
+        const StateBatch6d& keplerianElements,
+        const double centralBodyGravitationalParameter );
+
+//! Propagate a batch of elliptical Kepler orbits.
+/*!
+ * Propagates a batch of elliptical Kepler orbits, each over its own propagation time (for instance to bring a catalog of
+ * orbits with different epochs to a common epoch). The mean anomaly is converted to the eccentric anomaly with
+ * convertMeanAnomaliesToEccentricAnomalies, so that the results agree with propagateKeplerOrbit.
+ * \param initialKeplerianElements Initial Keplerian elements of the states, one state per row. All eccentricities must be
+ *          in range [0, 1).
+ * \param propagationTimes Propagation time of each of the states.                                          [s]
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body.                       [m^3/s^2]
+ * \param numberOfIterations Number of iterations of Kepler's equation, performed for all states.
+ * \return Keplerian elements of the states after propagation, with the true anomaly in range [-PI, PI].
+ */
+StateBatch6d propagateKeplerOrbitsBatch(
+        const StateBatch6d& initialKeplerianElements,
+        const Eigen::ArrayXd& propagationTimes,
+        const double centralBodyGravitationalParameter,
+        const int numberOfIterations = 3 );
+
+//! Function to determine, for a batch of Keplerian elements, whether the modified equinoctial singularity is to be flipped.
+/*!
+ * Function to determine, for a batch of Keplerian elements, whether the singularity of the modified equinoctial elements is
+ * to be flipped to zero inclination, which is the case for retrograde orbits (see isOrbitRetrograde).
+ * \param keplerianElements Keplerian elements of the states, one state per row.
+ * \return Flag for each state, denoting whether the singularity is to be flipped to zero inclination.
+ */
+BatchFlags getModifiedEquinoctialSingularityFlipFlagsBatch( const StateBatch6d& keplerianElements );
+
+//! Convert a batch of Keplerian elements to modified equinoctial elements.
+/*!
+ * Converts a batch of Keplerian elements to modified equinoctial elements (see
+ * convertKeplerianToModifiedEquinoctialElements).
+ * \param keplerianElements Keplerian elements of the states, one state per row. All inclinations must be in the range
+ *          [0, PI].
+ * \param flipSingularityToZeroInclination Flag for each state, denoting whether the set of equations for the 0 degrees
+ *          inclination singular case (true) or the 180 degrees case (false) is to be used. The same flags are required
+ *          for the conversion back to Keplerian elements.
+ * \return Modified equinoctial elements of the states, one state per row, with the order of the columns defined by the
+ *          ModifiedEquinoctialElementVectorIndices enum.
+ */
+StateBatch6d convertKeplerianToModifiedEquinoctialElementsBatch(
+        const StateBatch6d& keplerianElements,
+        const BatchFlags& flipSingularityToZeroInclination );
+
+//! Convert a batch of Keplerian elements to modified equinoctial elements, selecting the singularity from the inclination.
+/*!
+ * Converts a batch of Keplerian elements to modified equinoctial elements, with the singularity of each state flipped to
+ * zero inclination if the orbit is retrograde (see getModifiedEquinoctialSingularityFlipFlagsBatch).
+ * \param keplerianElements Keplerian elements of the states, one state per row. All inclinations must be in the range
+ *          [0, PI].
+ * \return Modified equinoctial elements of the states, one state per row.
+ */
+StateBatch6d convertKeplerianToModifiedEquinoctialElementsBatch(
+        const StateBatch6d& keplerianElements );
+
+//! Convert a batch of modified equinoctial elements to Keplerian elements.
+/*!
+ * Converts a batch of modified equinoctial elements to Keplerian elements (see
+ * convertModifiedEquinoctialToKeplerianElements).
+ * \param modifiedEquinoctialElements Modified equinoctial elements of the states, one state per row.
+ * \param flipSingularityToZeroInclination Flag for each state, denoting whether the set of equations for the 0 degrees
+ *          inclination singular case (true) or the 180 degrees case (false) is to be used.
+ * \return Keplerian elements of the states, one state per row.
+ */
+StateBatch6d convertModifiedEquinoctialToKeplerianElementsBatch(
+        const StateBatch6d& modifiedEquinoctialElements,
+        const BatchFlags& flipSingularityToZeroInclination );
+
+//! Convert a batch of modified equinoctial elements to Cartesian elements.
+/*!
+ * Converts a batch of modified equinoctial elements, with the singularity at 180 degrees inclination, directly to Cartesian
+ * elements (see convertModifiedEquinoctialToCartesianElements).
+ * \param modifiedEquinoctialElements Modified equinoctial elements of the states, one state per row.
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body.                       [m^3/s^2]
+ * \return Cartesian elements of the states, one state per row.
+ */
+StateBatch6d convertModifiedEquinoctialToCartesianElementsBatch(
+        const StateBatch6d& modifiedEquinoctialElements,
+        const double centralBodyGravitationalParameter );
+
+//! Convert a batch of Keplerian elements to unified state model elements with quaternions.
+/*!
+ * Converts a batch of Keplerian elements to unified state model elements with quaternions (see
+ * convertKeplerianToUnifiedStateModelQuaternionsElements).
+ * \param keplerianElements Keplerian elements of the states, one state per row. All eccentricities must be non-negative,
+ *          and all inclinations must be in range [0, PI].
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body.                       [m^3/s^2]
+ * \return Unified state model elements of the states, one state per row, with the order of the columns defined by the
+ *          UnifiedStateModelQuaternionsElementIndices enum.
+ */
+StateBatch7d convertKeplerianToUnifiedStateModelQuaternionsElementsBatch(
+        const StateBatch6d& keplerianElements,
+        const double centralBodyGravitationalParameter );
+
+//! Convert a batch of unified state model elements with quaternions to Cartesian elements.
+/*!
+ * Converts a batch of unified state model elements with quaternions to Cartesian elements (see
+ * convertUnifiedStateModelQuaternionsToCartesianElements).
+ * \param unifiedStateModelElements Unified state model elements of the states, one state per row.
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body.                       [m^3/s^2]
+ * \param forceQuaternionNormalization Boolean denoting whether quaternions with a norm different from one are to be
+ *          normalized (if false, an exception is thrown for such quaternions).
+ * \return Cartesian elements of the states, one state per row.
+ */
+StateBatch6d convertUnifiedStateModelQuaternionsToCartesianElementsBatch(
+        const StateBatch7d& unifiedStateModelElements,
+        const double centralBodyGravitationalParameter,
+        const bool forceQuaternionNormalization = false );
+
+} // namespace orbital_element_conversions
+
+} // namespace tudat
+
+#endif // TUDAT_BATCH_ORBITAL_ELEMENT_CONVERSIONS_H
@@ -0,0 +1,156 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Basics/parallelExecution.h"
+
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationAnglesCache.h"
+#include "Tudat/Astrodynamics/Ephemerides/itrsToGcrsRotationModel.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace earth_orientation;
+
+BOOST_AUTO_TEST_SUITE( test_earth_orientation_angles_cache )
+
+//! Test whether cached (interpolated) Earth orientation angles are consistent with directly computed ones.
+BOOST_AUTO_TEST_CASE( testEarthOrientationAnglesCache )
+{
+    std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator = createStandardEarthOrientationCalculator( );
+    std::shared_ptr< EarthOrientationAnglesCache > anglesCache = std::make_shared< EarthOrientationAnglesCache >(
+                anglesCalculator, basic_astrodynamics::tdb_scale, 60.0, 8, 1440 );
+
+    // Test times inside of, and at boundaries of, a number of windows (also before J2000).
+    std::vector< double > testTimes;
+    for( int i = 0; i < 50; i++ )
+    {
+        testTimes.push_back( 3.0E8 + static_cast< double >( i ) * 4321.123456 );
+    }
+    testTimes.push_back( 3.0E8 + 86400.0 );
+    testTimes.push_back( -1.0E8 + 12.345 );
+    testTimes.push_back( -86400.0 * 10.0 );
+
+    std::pair< Eigen::Vector5d, double > directAngles, cachedAngles;
+    std::pair< Eigen::Vector5d, Time > directAnglesLong, cachedAnglesLong;
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        directAngles = anglesCalculator->getRotationAnglesFromItrsToGcrs< double >(
+                    testTimes.at( i ), basic_astrodynamics::tdb_scale );
+        cachedAngles = anglesCache->getRotationAnglesFromItrsToGcrs( testTimes.at( i ) );
+
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( directAngles.first( j ) - cachedAngles.first( j ) ), 1.0E-11 );
+        }
+        BOOST_CHECK_SMALL( std::fabs( directAngles.second - cachedAngles.second ), 1.0E-6 );
+
+        directAnglesLong = anglesCalculator->getRotationAnglesFromItrsToGcrs< Time >(
+                    testTimes.at( i ), basic_astrodynamics::tdb_scale );
+        cachedAnglesLong = anglesCache->getRotationAnglesFromItrsToGcrs( Time( testTimes.at( i ) ) );
+        BOOST_CHECK_SMALL( std::fabs( static_cast< double >(
+                                          ( directAnglesLong.second - cachedAnglesLong.second ).getSeconds< long double >( ) ) ),
+                           1.0E-9 );
+    }
+    BOOST_CHECK_EQUAL( anglesCache->getNumberOfComputedWindows( ), 5 );
+
+    // Check consistency of rotation model with and without cache.
+    ephemerides::GcrsToItrsRotationModel directRotationModel( anglesCalculator );
+    ephemerides::GcrsToItrsRotationModel cachedRotationModel(
+                anglesCalculator, basic_astrodynamics::tdb_scale, "GCRS", anglesCache );
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        Eigen::Matrix3d rotationDifference =
+                directRotationModel.getRotationToBaseFrame( testTimes.at( i ) ).toRotationMatrix( ) -
+                cachedRotationModel.getRotationToBaseFrame( testTimes.at( i ) ).toRotationMatrix( );
+        Eigen::Matrix3d rotationDerivativeDifference =
+                directRotationModel.getDerivativeOfRotationToBaseFrame( testTimes.at( i ) ) -
+                cachedRotationModel.getDerivativeOfRotationToBaseFrame( testTimes.at( i ) );
+        BOOST_CHECK_SMALL( rotationDifference.cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+        BOOST_CHECK_SMALL( rotationDerivativeDifference.cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    }
+
+    // Check that concurrent access from multiple threads provides identical results as serial access.
+    anglesCache->clear( );
+    BOOST_CHECK_EQUAL( anglesCache->getNumberOfComputedWindows( ), 0 );
+    std::vector< Eigen::Vector5d > parallelAngles( testTimes.size( ) );
+    utilities::executeParallelTasks(
+                testTimes.size( ), [ & ]( const int i )
+    {
+        parallelAngles[ i ] = anglesCache->getRotationAnglesFromItrsToGcrs( testTimes.at( i ) ).first;
+    }, 4 );
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        cachedAngles = anglesCache->getRotationAnglesFromItrsToGcrs( testTimes.at( i ) );
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_EQUAL( parallelAngles[ i ]( j ), cachedAngles.first( j ) );
+        }
+    }
+    BOOST_CHECK_EQUAL( anglesCache->getNumberOfComputedWindows( ), 5 );
+
+    // Check that process-wide caches are shared by identifier.
+    std::shared_ptr< EarthOrientationAnglesCache > sharedCache = getSharedEarthOrientationAnglesCache(
+                "test", [ & ]( ){ return anglesCache; } );
+    BOOST_CHECK_EQUAL( sharedCache, anglesCache );
+    sharedCache = getSharedEarthOrientationAnglesCache(
+                "test", [ & ]( ){ return std::make_shared< EarthOrientationAnglesCache >( anglesCalculator ); } );
+    BOOST_CHECK_EQUAL( sharedCache, anglesCache );
+    clearSharedEarthOrientationAnglesCaches( );
+    sharedCache = getSharedEarthOrientationAnglesCache(
+                "test", [ & ]( ){ return std::make_shared< EarthOrientationAnglesCache >( anglesCalculator ); } );
+    BOOST_CHECK( sharedCache != anglesCache );
+}
+
+//! Test whether cached Earth orientation angles are correct in a window containing a leap second.
+BOOST_AUTO_TEST_CASE( testEarthOrientationAnglesCacheAtLeapSecond )
+{
+    std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator = createStandardEarthOrientationCalculator( );
+
+    // Check that a cache with (discontinuous) UTC input cannot be created.
+    BOOST_CHECK_THROW( std::make_shared< EarthOrientationAnglesCache >( anglesCalculator, basic_astrodynamics::utc_scale ),
+                       std::runtime_error );
+
+    // Leap second inserted at end of 31-12-2016: 01-01-2017 00:00:00 UTC is 6209.5 days after J2000, and TT - UTC = 69.184 s
+    const double leapSecondTime = 6209.5 * 86400.0 + 69.184;
+    std::shared_ptr< EarthOrientationAnglesCache > anglesCache = std::make_shared< EarthOrientationAnglesCache >(
+                anglesCalculator, basic_astrodynamics::tt_scale, 60.0, 8, 1440 );
+
+    std::pair< Eigen::Vector5d, double > directAngles, cachedAngles;
+    double currentTime;
+    for( int i = -100; i <= 100; i++ )
+    {
+        currentTime = leapSecondTime + static_cast< double >( i ) * 12.3456789;
+        directAngles = anglesCalculator->getRotationAnglesFromItrsToGcrs< double >(
+                    currentTime, basic_astrodynamics::tt_scale );
+        cachedAngles = anglesCache->getRotationAnglesFromItrsToGcrs( currentTime );
+
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( directAngles.first( j ) - cachedAngles.first( j ) ), 1.0E-11 );
+        }
+        BOOST_CHECK_SMALL( std::fabs( directAngles.second - cachedAngles.second ), 1.0E-6 );
+    }
+    BOOST_CHECK_EQUAL( anglesCache->getNumberOfComputedWindows( ), 1 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,219 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationAnglesCache.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Constructor
+EarthOrientationAnglesCache::EarthOrientationAnglesCache(
+        const std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator,
+        const basic_astrodynamics::TimeScales inputTimeScale,
+        const double timeStep,
+        const int interpolationOrder,
+        const int numberOfTimeStepsPerWindow ):
+    anglesCalculator_( anglesCalculator ), inputTimeScale_( inputTimeScale ), timeStep_( timeStep ),
+    interpolationOrder_( interpolationOrder ), numberOfTimeStepsPerWindow_( numberOfTimeStepsPerWindow )
+{
+    // The difference between UT1 and the input time must be continuous to be interpolated, which is not the case for UTC.
+    if( inputTimeScale_ == basic_astrodynamics::utc_scale )
+    {
+        throw std::runtime_error( "Error when creating Earth orientation angles cache, input time scale cannot be UTC, "
+                                  "since it is discontinuous at leap seconds" );
+    }
+
+    if( !( timeStep_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating Earth orientation angles cache, time step must be positive" );
+    }
+
+    if( interpolationOrder_ < 2 || interpolationOrder_ % 2 != 0 )
+    {
+        throw std::runtime_error(
+                    "Error when creating Earth orientation angles cache, interpolation order must be even and at least 2" );
+    }
+
+    if( numberOfTimeStepsPerWindow_ < 1 )
+    {
+        throw std::runtime_error(
+                    "Error when creating Earth orientation angles cache, number of time steps per window must be positive" );
+    }
+
+    // Set barycentric weights for equidistant nodes: w_j = (-1)^j * (n-1 choose j)
+    barycentricWeights_.resize( interpolationOrder_ );
+    double currentBinomialCoefficient = 1.0;
+    for( int j = 0; j < interpolationOrder_; j++ )
+    {
+        barycentricWeights_[ j ] = ( ( j % 2 == 0 ) ? 1.0 : -1.0 ) * currentBinomialCoefficient;
+        currentBinomialCoefficient *= static_cast< double >( interpolationOrder_ - 1 - j ) / static_cast< double >( j + 1 );
+    }
+}
+
+//! Function to retrieve the rotation angles from ITRS to GCRS at given time value.
+std::pair< Eigen::Vector5d, double > EarthOrientationAnglesCache::getRotationAnglesFromItrsToGcrs( const double timeValue )
+{
+    Eigen::Vector6d interpolatedValues = getInterpolatedValues( timeValue );
+    return std::make_pair( Eigen::Vector5d( interpolatedValues.segment( 0, 5 ) ), timeValue + interpolatedValues( 5 ) );
+}
+
+//! Function to retrieve the rotation angles from ITRS to GCRS at given time value, in extended (Time class) format.
+std::pair< Eigen::Vector5d, Time > EarthOrientationAnglesCache::getRotationAnglesFromItrsToGcrs( const Time& timeValue )
+{
+    Eigen::Vector6d interpolatedValues = getInterpolatedValues( timeValue.getSeconds< double >( ) );
+    return std::make_pair( Eigen::Vector5d( interpolatedValues.segment( 0, 5 ) ), timeValue + interpolatedValues( 5 ) );
+}
+
+//! Function to remove all windows with computed angles from the cache.
+void EarthOrientationAnglesCache::clear( )
+{
+    std::lock_guard< std::mutex > windowsLock( windowsMutex_ );
+    windows_.clear( );
+    std::atomic_store( &lastUsedWindow_, std::shared_ptr< const AnglesWindow >( ) );
+}
+
+//! Function to retrieve the number of windows for which the angles have been computed.
+int EarthOrientationAnglesCache::getNumberOfComputedWindows( )
+{
+    std::lock_guard< std::mutex > windowsLock( windowsMutex_ );
+    return static_cast< int >( windows_.size( ) );
+}
+
+//! Function to retrieve the interpolated angles and difference between UT1 and input time
+Eigen::Vector6d EarthOrientationAnglesCache::getInterpolatedValues( const double timeValue )
+{
+    // Determine grid point directly preceding (or at) requested time, and window in which it is located.
+    const double numberOfTimeSteps = timeValue / timeStep_;
+    const double precedingGridPoint = std::floor( numberOfTimeSteps );
+    const double fractionOfTimeStep = numberOfTimeSteps - precedingGridPoint;
+    const long long precedingGridPointIndex = static_cast< long long >( precedingGridPoint );
+
+    long long windowIndex = precedingGridPointIndex / numberOfTimeStepsPerWindow_;
+    if( precedingGridPointIndex % numberOfTimeStepsPerWindow_ < 0 )
+    {
+        windowIndex--;
+    }
+
+    // Retrieve window, using most recently used window if possible.
+    std::shared_ptr< const AnglesWindow > currentWindow = std::atomic_load( &lastUsedWindow_ );
+    if( currentWindow == nullptr || currentWindow->windowIndex != windowIndex )
+    {
+        currentWindow = getWindow( windowIndex );
+        std::atomic_store( &lastUsedWindow_, currentWindow );
+    }
+
+    // Interpolated nodes are located at -n/2+1,..., n/2 time steps w.r.t. preceding grid point.
+    const int firstNodeIndex = static_cast< int >( precedingGridPointIndex - windowIndex * numberOfTimeStepsPerWindow_ );
+    const int halfInterpolationOrder = interpolationOrder_ / 2;
+
+    if( fractionOfTimeStep == 0.0 )
+    {
+        return currentWindow->values.col( firstNodeIndex + halfInterpolationOrder - 1 );
+    }
+
+    // Evaluate Lagrange interpolant in barycentric form.
+    Eigen::Vector6d weightedSum = Eigen::Vector6d::Zero( );
+    double sumOfWeights = 0.0;
+    double currentWeight;
+    for( int j = 0; j < interpolationOrder_; j++ )
+    {
+        currentWeight = barycentricWeights_[ j ] /
+                ( fractionOfTimeStep - static_cast< double >( j - halfInterpolationOrder + 1 ) );
+        weightedSum += currentWeight * currentWindow->values.col( firstNodeIndex + j );
+        sumOfWeights += currentWeight;
+    }
+
+    return weightedSum / sumOfWeights;
+}
+
+//! Function to retrieve the window with given index, computing it if it is not yet in the cache
+std::shared_ptr< const EarthOrientationAnglesCache::AnglesWindow > EarthOrientationAnglesCache::getWindow(
+        const long long windowIndex )
+{
+    // Lock is retained while computing window, so that window is computed only once, and calculator is not used concurrently.
+    std::lock_guard< std::mutex > windowsLock( windowsMutex_ );
+
+    auto windowIterator = windows_.find( windowIndex );
+    if( windowIterator != windows_.end( ) )
+    {
+        return windowIterator->second;
+    }
+
+    // Window contains grid points required to interpolate at any time from its first up to (excluding) its last time step.
+    const int halfInterpolationOrder = interpolationOrder_ / 2;
+    const int numberOfGridPoints = numberOfTimeStepsPerWindow_ + interpolationOrder_ - 1;
+    const long long firstGridPointIndex = windowIndex * numberOfTimeStepsPerWindow_ - halfInterpolationOrder + 1;
+
+    std::shared_ptr< AnglesWindow > newWindow = std::make_shared< AnglesWindow >( );
+    newWindow->windowIndex = windowIndex;
+    newWindow->values.resize( 6, numberOfGridPoints );
+
+    std::pair< Eigen::Vector5d, Time > currentAnglesAndUt1;
+    double currentTime;
+    for( int i = 0; i < numberOfGridPoints; i++ )
+    {
+        currentTime = static_cast< double >( firstGridPointIndex + i ) * timeStep_;
+        currentAnglesAndUt1 = anglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( currentTime, inputTimeScale_ );
+        newWindow->values.block( 0, i, 5, 1 ) = currentAnglesAndUt1.first;
+        newWindow->values( 5, i ) = static_cast< double >(
+                    ( currentAnglesAndUt1.second - Time( currentTime ) ).getSeconds< long double >( ) );
+    }
+
+    windows_[ windowIndex ] = newWindow;
+    return newWindow;
+}
+
+//! Function to retrieve the mutex protecting the process-wide Earth orientation angles caches
+static std::mutex& getSharedEarthOrientationAnglesCachesMutex( )
+{
+    static std::mutex sharedCachesMutex;
+    return sharedCachesMutex;
+}
+
+//! Function to retrieve the process-wide Earth orientation angles caches, with their identifiers as key
+static std::map< std::string, std::shared_ptr< EarthOrientationAnglesCache > >& getSharedEarthOrientationAnglesCaches( )
+{
+    static std::map< std::string, std::shared_ptr< EarthOrientationAnglesCache > > sharedCaches;
+    return sharedCaches;
+}
+
+//! Function to retrieve a process-wide Earth orientation angles cache, creating it if it does not yet exist.
+std::shared_ptr< EarthOrientationAnglesCache > getSharedEarthOrientationAnglesCache(
+        const std::string& cacheIdentifier,
+        const std::function< std::shared_ptr< EarthOrientationAnglesCache >( ) > cacheCreationFunction )
+{
+    std::lock_guard< std::mutex > sharedCachesLock( getSharedEarthOrientationAnglesCachesMutex( ) );
+
+    std::map< std::string, std::shared_ptr< EarthOrientationAnglesCache > >& sharedCaches =
+            getSharedEarthOrientationAnglesCaches( );
+    if( sharedCaches.count( cacheIdentifier ) == 0 )
+    {
+        sharedCaches[ cacheIdentifier ] = cacheCreationFunction( );
+    }
+    return sharedCaches.at( cacheIdentifier );
+}
+
+//! Function to remove all process-wide Earth orientation angles caches (see getSharedEarthOrientationAnglesCache).
+void clearSharedEarthOrientationAnglesCaches( )
+{
+    std::lock_guard< std::mutex > sharedCachesLock( getSharedEarthOrientationAnglesCachesMutex( ) );
+    getSharedEarthOrientationAnglesCaches( ).clear( );
+}
+
+} // namespace earth_orientation
+
+} // namespace tudat
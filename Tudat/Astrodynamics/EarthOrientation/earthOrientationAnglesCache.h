@@ -0,0 +1,212 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_EARTHORIENTATIONANGLESCACHE_H
+#define TUDAT_EARTHORIENTATIONANGLESCACHE_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/timeType.h"
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Class to cache the Earth orientation angles (ITRS<->GCRS) on a regular time grid.
+/*!
+ *  Class to cache the Earth orientation angles (ITRS<->GCRS), as computed by an EarthOrientationAnglesCalculator, on a
+ *  regular time grid. The angles are sampled in windows of a fixed number of time steps, which are created the first time
+ *  that a time inside of them is requested, so that the (costly) precession-nutation series and short-period corrections
+ *  are evaluated only once per grid point. In between grid points, the angles (X, Y, s, x_p, y_p) and the difference
+ *  between UT1 and the input time are retrieved by equidistant Lagrange interpolation. The difference between UT1 and the
+ *  input time is interpolated (rather than UT1 itself) to retain the full resolution of the input time when computing the
+ *  Earth rotation angle. The angles are assumed to be smooth at the resolution of the time step. All functions of this
+ *  class are thread-safe.
+ */
+class EarthOrientationAnglesCache
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param anglesCalculator Object from which the Earth orientation angles are computed at the grid points.
+     *  \param inputTimeScale Time scale in which the input times of this object are provided. UTC is not permitted, since
+     *  the difference between UT1 and UTC is discontinuous at leap seconds (and cannot be interpolated).
+     *  \param timeStep Time step between grid points at which the angles are computed.
+     *  \param interpolationOrder Number of grid points used for the Lagrange interpolation (must be even).
+     *  \param numberOfTimeStepsPerWindow Number of time steps in a single window that is created at once.
+     */
+    EarthOrientationAnglesCache(
+            const std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator,
+            const basic_astrodynamics::TimeScales inputTimeScale = basic_astrodynamics::tdb_scale,
+            const double timeStep = 60.0,
+            const int interpolationOrder = 8,
+            const int numberOfTimeStepsPerWindow = 1440 );
+
+    //! Function to retrieve the rotation angles from ITRS to GCRS at given time value.
+    /*!
+     *  Function to retrieve the (interpolated) rotation angles from ITRS to GCRS at given time value.
+     *  \param timeValue Number of seconds since J2000 (in input time scale) at which orientation is to be evaluated.
+     *  \return Rotation angles for ITRS<->GCRS transformation at given epoch. First pair entry is: X, Y, s, x_p, y_p. Second
+     *  defines UT1.
+     */
+    std::pair< Eigen::Vector5d, double > getRotationAnglesFromItrsToGcrs( const double timeValue );
+
+    //! Function to retrieve the rotation angles from ITRS to GCRS at given time value, in extended (Time class) format.
+    /*!
+     *  Function to retrieve the (interpolated) rotation angles from ITRS to GCRS at given time value, in extended (Time class)
+     *  format.
+     *  \param timeValue Time since J2000 (in input time scale) at which orientation is to be evaluated.
+     *  \return Rotation angles for ITRS<->GCRS transformation at given epoch. First pair entry is: X, Y, s, x_p, y_p. Second
+     *  defines UT1.
+     */
+    std::pair< Eigen::Vector5d, Time > getRotationAnglesFromItrsToGcrs( const Time& timeValue );
+
+    //! Function to remove all windows with computed angles from the cache.
+    void clear( );
+
+    //! Function to retrieve the object from which the Earth orientation angles are computed at the grid points.
+    /*!
+     *  Function to retrieve the object from which the Earth orientation angles are computed at the grid points.
+     *  \return Object from which the Earth orientation angles are computed at the grid points.
+     */
+    std::shared_ptr< EarthOrientationAnglesCalculator > getAnglesCalculator( )
+    {
+        return anglesCalculator_;
+    }
+
+    //! Function to retrieve the time scale in which the input times of this object are provided.
+    /*!
+     *  Function to retrieve the time scale in which the input times of this object are provided.
+     *  \return Time scale in which the input times of this object are provided.
+     */
+    basic_astrodynamics::TimeScales getInputTimeScale( )
+    {
+        return inputTimeScale_;
+    }
+
+    //! Function to retrieve the time step between grid points at which the angles are computed.
+    /*!
+     *  Function to retrieve the time step between grid points at which the angles are computed.
+     *  \return Time step between grid points at which the angles are computed.
+     */
+    double getTimeStep( )
+    {
+        return timeStep_;
+    }
+
+    //! Function to retrieve the number of grid points used for the Lagrange interpolation.
+    /*!
+     *  Function to retrieve the number of grid points used for the Lagrange interpolation.
+     *  \return Number of grid points used for the Lagrange interpolation.
+     */
+    int getInterpolationOrder( )
+    {
+        return interpolationOrder_;
+    }
+
+    //! Function to retrieve the number of windows for which the angles have been computed.
+    /*!
+     *  Function to retrieve the number of windows for which the angles have been computed.
+     *  \return Number of windows for which the angles have been computed.
+     */
+    int getNumberOfComputedWindows( );
+
+private:
+
+    //! Angles computed at the grid points of a single window.
+    struct AnglesWindow
+    {
+        //! Index of the window.
+        long long windowIndex;
+
+        //! Values at the grid points, with entries X, Y, s, x_p, y_p, UT1 minus input time (rows) per grid point (column).
+        Eigen::Matrix< double, 6, Eigen::Dynamic > values;
+    };
+
+    //! Function to retrieve the interpolated angles and difference between UT1 and input time
+    /*!
+     *  Function to retrieve the interpolated angles and difference between UT1 and input time
+     *  \param timeValue Number of seconds since J2000 (in input time scale) at which orientation is to be evaluated.
+     *  \return Interpolated X, Y, s, x_p, y_p, UT1 minus input time.
+     */
+    Eigen::Vector6d getInterpolatedValues( const double timeValue );
+
+    //! Function to retrieve the window with given index, computing it if it is not yet in the cache
+    /*!
+     *  Function to retrieve the window with given index, computing it if it is not yet in the cache
+     *  \param windowIndex Index of the window that is to be retrieved.
+     *  \return Window with given index.
+     */
+    std::shared_ptr< const AnglesWindow > getWindow( const long long windowIndex );
+
+    //! Object from which the Earth orientation angles are computed at the grid points.
+    std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator_;
+
+    //! Time scale in which the input times of this object are provided.
+    basic_astrodynamics::TimeScales inputTimeScale_;
+
+    //! Time step between grid points at which the angles are computed.
+    double timeStep_;
+
+    //! Number of grid points used for the Lagrange interpolation.
+    int interpolationOrder_;
+
+    //! Number of time steps in a single window.
+    int numberOfTimeStepsPerWindow_;
+
+    //! Barycentric weights of the equidistant Lagrange interpolation
+    std::vector< double > barycentricWeights_;
+
+    //! Windows for which the angles have been computed, with the window index as key.
+    std::map< long long, std::shared_ptr< const AnglesWindow > > windows_;
+
+    //! Window that was used most recently (only accessed through std::atomic_load/std::atomic_store).
+    std::shared_ptr< const AnglesWindow > lastUsedWindow_;
+
+    //! Mutex protecting the windows_ map and the angles calculator.
+    std::mutex windowsMutex_;
+};
+
+//! Function to retrieve a process-wide Earth orientation angles cache, creating it if it does not yet exist.
+/*!
+ *  Function to retrieve a process-wide Earth orientation angles cache, creating it if it does not yet exist. This allows the
+ *  angles that have been computed in one simulation to be reused in subsequent ones that use identical Earth orientation
+ *  settings (as identified by the cacheIdentifier).
+ *  \param cacheIdentifier String that uniquely identifies the settings of the Earth orientation model and of the cache.
+ *  \param cacheCreationFunction Function that creates the cache, called only if no cache with given identifier exists.
+ *  \return Cache with given identifier.
+ */
+std::shared_ptr< EarthOrientationAnglesCache > getSharedEarthOrientationAnglesCache(
+        const std::string& cacheIdentifier,
+        const std::function< std::shared_ptr< EarthOrientationAnglesCache >( ) > cacheCreationFunction );
+
+//! Function to remove all process-wide Earth orientation angles caches (see getSharedEarthOrientationAnglesCache).
+void clearSharedEarthOrientationAnglesCaches( );
+
+} // namespace earth_orientation
+
+} // namespace tudat
+
+#endif // TUDAT_EARTHORIENTATIONANGLESCACHE_H
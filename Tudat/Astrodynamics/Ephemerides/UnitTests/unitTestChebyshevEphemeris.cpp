@@ -0,0 +1,192 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_chebyshevEphemeris )
+
+//! Function to create Kepler ephemeris of eccentric low Earth orbit, used as reference in tests below.
+std::shared_ptr< ephemerides::KeplerEphemeris > getReferenceKeplerEphemeris( )
+{
+    Eigen::Vector6d keplerianElements;
+    keplerianElements << 7000.0E3, 0.05, 0.8, 1.0, 2.0, 0.5;
+    return std::make_shared< ephemerides::KeplerEphemeris >(
+                keplerianElements, 0.0, 398600.4415e9, "Earth", "J2000" );
+}
+
+//! Test Chebyshev series evaluation against direct evaluation of Chebyshev polynomials.
+BOOST_AUTO_TEST_CASE( testChebyshevSeriesEvaluation )
+{
+    ephemerides::ChebyshevCoefficientMatrix coefficients = ephemerides::ChebyshevCoefficientMatrix::Random( 9, 6 );
+    for( int i = 0; i <= 20; i++ )
+    {
+        const double normalizedTime = -1.0 + 0.1 * static_cast< double >( i );
+
+        Eigen::Vector6d expectedValue = Eigen::Vector6d::Zero( );
+        for( int j = 0; j < coefficients.rows( ); j++ )
+        {
+            expectedValue += coefficients.row( j ).transpose( ) *
+                    std::cos( static_cast< double >( j ) * std::acos( normalizedTime ) );
+        }
+
+        const Eigen::Vector6d computedValue =
+                ephemerides::evaluateCartesianChebyshevSeries( coefficients, normalizedTime );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_SMALL( computedValue( j ) - expectedValue( j ), 1.0E-13 );
+        }
+    }
+}
+
+//! Test fit of Chebyshev ephemeris to state function, and evaluation of resulting ephemeris.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisFit )
+{
+    std::shared_ptr< ephemerides::KeplerEphemeris > keplerEphemeris = getReferenceKeplerEphemeris( );
+
+    const double startTime = 1000.0;
+    const double endTime = startTime + 2.0 * 86400.0;
+    const double positionTolerance = 1.0E-3;
+    const double velocityTolerance = 1.0E-6;
+
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > chebyshevEphemeris =
+            ephemerides::fitChebyshevEphemeris(
+                [ = ]( const double time ){ return keplerEphemeris->getCartesianState( time ); },
+                startTime, endTime, 16, positionTolerance, velocityTolerance, 86400.0, 100000, "Earth", "J2000" );
+
+    // Check properties of fitted ephemeris.
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getStartTime( ), startTime );
+    BOOST_CHECK_CLOSE_FRACTION( chebyshevEphemeris->getEndTime( ), endTime, 1.0E-15 );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getNumberOfCoefficientsPerSegment( ), 16 );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getCoefficients( ).rows( ),
+                       16 * chebyshevEphemeris->getNumberOfSegments( ) );
+
+    // Check that ephemeris requires less than half the memory of a tabulated state history with 60 s time step.
+    BOOST_CHECK( chebyshevEphemeris->getCoefficients( ).rows( ) < ( endTime - startTime ) / 60.0 / 2.0 );
+
+    // Check fit error at many (incl. segment boundary) epochs, allowing small margin over tolerance between check points
+    const int numberOfTestTimes = 5001;
+    for( int i = 0; i < numberOfTestTimes; i++ )
+    {
+        const double testTime = startTime + ( endTime - startTime ) * static_cast< double >( i ) /
+                static_cast< double >( numberOfTestTimes - 1 );
+        const Eigen::Vector6d stateError =
+                chebyshevEphemeris->getCartesianState( testTime ) - keplerEphemeris->getCartesianState( testTime );
+        BOOST_CHECK_SMALL( stateError.segment( 0, 3 ).norm( ), 2.0 * positionTolerance );
+        BOOST_CHECK_SMALL( stateError.segment( 3, 3 ).norm( ), 2.0 * velocityTolerance );
+    }
+
+    // Check that evaluation outside of validity interval is not allowed.
+    BOOST_CHECK_THROW( chebyshevEphemeris->getCartesianState( startTime - 1.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( chebyshevEphemeris->getCartesianState( endTime + 1.0 ), std::runtime_error );
+
+    // Check that fit fails if tolerances cannot be met with maximum number of segments.
+    BOOST_CHECK_THROW( ephemerides::fitChebyshevEphemeris(
+                           [ = ]( const double time ){ return keplerEphemeris->getCartesianState( time ); },
+                           startTime, endTime, 8, positionTolerance, velocityTolerance, TUDAT_NAN, 4 ),
+                       std::runtime_error );
+}
+
+//! Test fit of Chebyshev ephemeris to tabulated state history.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisFitFromStateHistory )
+{
+    std::shared_ptr< ephemerides::KeplerEphemeris > keplerEphemeris = getReferenceKeplerEphemeris( );
+
+    std::map< double, Eigen::Vector6d > stateHistory;
+    for( int i = 0; i <= 1440; i++ )
+    {
+        const double currentTime = 30.0 * static_cast< double >( i );
+        stateHistory[ currentTime ] = keplerEphemeris->getCartesianState( currentTime );
+    }
+
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > chebyshevEphemeris =
+            ephemerides::fitChebyshevEphemeris( stateHistory, 16, 1.0E-2, 1.0E-5 );
+
+    // Check that first and last three states are outside of validity interval.
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getStartTime( ), 90.0 );
+    BOOST_CHECK_CLOSE_FRACTION( chebyshevEphemeris->getEndTime( ), 43110.0, 1.0E-15 );
+
+    for( int i = 0; i < 1000; i++ )
+    {
+        const double testTime = 43.0 * static_cast< double >( i ) + 100.0;
+        const Eigen::Vector6d stateError =
+                chebyshevEphemeris->getCartesianState( testTime ) - keplerEphemeris->getCartesianState( testTime );
+        BOOST_CHECK_SMALL( stateError.segment( 0, 3 ).norm( ), 2.0E-2 );
+        BOOST_CHECK_SMALL( stateError.segment( 3, 3 ).norm( ), 2.0E-5 );
+    }
+}
+
+//! Test writing Chebyshev ephemeris to, and reading it from, binary file.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisBinaryFile )
+{
+    std::shared_ptr< ephemerides::KeplerEphemeris > keplerEphemeris = getReferenceKeplerEphemeris( );
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > chebyshevEphemeris =
+            ephemerides::fitChebyshevEphemeris(
+                [ = ]( const double time ){ return keplerEphemeris->getCartesianState( time ); },
+                -3600.0, 36000.0, 12, 1.0E-3, 1.0E-6, TUDAT_NAN, 100000, "Earth", "J2000" );
+
+    const std::string fileName = input_output::getTudatRootPath( ) +
+            "Astrodynamics/Ephemerides/UnitTests/chebyshevEphemerisTest.dat";
+    ephemerides::writeChebyshevEphemerisToBinaryFile( chebyshevEphemeris, fileName );
+
+    // Check file size (header + coefficients).
+    BOOST_CHECK_EQUAL( boost::filesystem::file_size( fileName ),
+                       192 + chebyshevEphemeris->getCoefficients( ).size( ) * sizeof( double ) );
+
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > readEphemeris =
+            ephemerides::readChebyshevEphemerisFromBinaryFile( fileName );
+    boost::filesystem::remove( fileName );
+
+    // Check that read ephemeris is identical to original.
+    BOOST_CHECK_EQUAL( readEphemeris->getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK_EQUAL( readEphemeris->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( readEphemeris->getStartTime( ), chebyshevEphemeris->getStartTime( ) );
+    BOOST_CHECK_EQUAL( readEphemeris->getSegmentDuration( ), chebyshevEphemeris->getSegmentDuration( ) );
+    BOOST_CHECK_EQUAL( readEphemeris->getNumberOfSegments( ), chebyshevEphemeris->getNumberOfSegments( ) );
+    BOOST_CHECK_EQUAL( readEphemeris->getNumberOfCoefficientsPerSegment( ),
+                       chebyshevEphemeris->getNumberOfCoefficientsPerSegment( ) );
+    BOOST_CHECK( readEphemeris->getCoefficients( ) == chebyshevEphemeris->getCoefficients( ) );
+
+    for( int i = 0; i < 100; i++ )
+    {
+        const double testTime = -3600.0 + 396.0 * static_cast< double >( i );
+        BOOST_CHECK( readEphemeris->getCartesianState( testTime ) ==
+                     chebyshevEphemeris->getCartesianState( testTime ) );
+    }
+
+    // Check that reading non-existent or invalid file fails.
+    BOOST_CHECK_THROW( ephemerides::readChebyshevEphemerisFromBinaryFile( fileName ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
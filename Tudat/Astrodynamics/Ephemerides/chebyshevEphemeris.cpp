@@ -0,0 +1,407 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Identifier at start of binary Chebyshev ephemeris file.
+static const char chebyshevEphemerisFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'C', 'H', 'B' };
+
+//! Version of binary Chebyshev ephemeris file format.
+static const std::int32_t chebyshevEphemerisFileVersion = 1;
+
+//! Size of frame name entries in binary Chebyshev ephemeris file header.
+static const int chebyshevEphemerisFileFrameNameSize = 64;
+
+//! Total size of binary Chebyshev ephemeris file header.
+static const int chebyshevEphemerisFileHeaderSize = 192;
+
+//! Function to evaluate a Chebyshev series for all six Cartesian state elements.
+Eigen::Vector6d evaluateCartesianChebyshevSeries(
+        const Eigen::Ref< const ChebyshevCoefficientMatrix >& coefficients,
+        const double normalizedTime )
+{
+    // Evaluate series using Clenshaw's recurrence, for all state elements simultaneously.
+    Eigen::Matrix< double, 1, 6 > currentTerm = Eigen::Matrix< double, 1, 6 >::Zero( );
+    Eigen::Matrix< double, 1, 6 > previousTerm = Eigen::Matrix< double, 1, 6 >::Zero( );
+    Eigen::Matrix< double, 1, 6 > newTerm;
+    const double twiceNormalizedTime = 2.0 * normalizedTime;
+    for( int i = coefficients.rows( ) - 1; i > 0; i-- )
+    {
+        newTerm = coefficients.row( i ) + twiceNormalizedTime * currentTerm - previousTerm;
+        previousTerm = currentTerm;
+        currentTerm = newTerm;
+    }
+    return ( coefficients.row( 0 ) + normalizedTime * currentTerm - previousTerm ).transpose( );
+}
+
+//! Constructor
+ChebyshevEphemeris::ChebyshevEphemeris( const ChebyshevCoefficientMatrix& coefficients,
+                                        const int numberOfCoefficientsPerSegment,
+                                        const double startTime,
+                                        const double segmentDuration,
+                                        const std::string& referenceFrameOrigin,
+                                        const std::string& referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    coefficients_( coefficients ), numberOfCoefficientsPerSegment_( numberOfCoefficientsPerSegment ),
+    startTime_( startTime ), segmentDuration_( segmentDuration )
+{
+    if( numberOfCoefficientsPerSegment_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, number of coefficients per segment must be "
+                                  "at least 1." );
+    }
+
+    if( !( segmentDuration_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, segment duration must be positive." );
+    }
+
+    if( coefficients_.rows( ) == 0 || coefficients_.rows( ) % numberOfCoefficientsPerSegment_ != 0 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, number of coefficient rows (" +
+                                  std::to_string( coefficients_.rows( ) ) + ") is not a non-zero multiple of "
+                                  "number of coefficients per segment (" +
+                                  std::to_string( numberOfCoefficientsPerSegment_ ) + ")." );
+    }
+
+    numberOfSegments_ = coefficients_.rows( ) / numberOfCoefficientsPerSegment_;
+}
+
+//! Function to get state from ephemeris.
+Eigen::Vector6d ChebyshevEphemeris::getCartesianState( const double secondsSinceEpoch )
+{
+    // Determine segment directly from time, as all segments are of equal duration.
+    const double timeSinceStart = secondsSinceEpoch - startTime_;
+    int segmentIndex = static_cast< int >( std::floor( timeSinceStart / segmentDuration_ ) );
+    if( segmentIndex == numberOfSegments_ && !( secondsSinceEpoch > getEndTime( ) ) )
+    {
+        segmentIndex = numberOfSegments_ - 1;
+    }
+
+    if( !( timeSinceStart >= 0.0 ) || segmentIndex < 0 || segmentIndex >= numberOfSegments_ )
+    {
+        throw std::runtime_error( "Error when evaluating Chebyshev ephemeris, requested time " +
+                                  std::to_string( secondsSinceEpoch ) + " is outside of validity interval [" +
+                                  std::to_string( startTime_ ) + ", " + std::to_string( getEndTime( ) ) + "]." );
+    }
+
+    const double normalizedTime =
+            2.0 * ( timeSinceStart - static_cast< double >( segmentIndex ) * segmentDuration_ ) / segmentDuration_ - 1.0;
+    return evaluateCartesianChebyshevSeries(
+                coefficients_.block( segmentIndex * numberOfCoefficientsPerSegment_, 0,
+                                     numberOfCoefficientsPerSegment_, 6 ), normalizedTime );
+}
+
+//! Function to compute the Chebyshev coefficients that interpolate a state function on a single time interval.
+ChebyshevCoefficientMatrix computeCartesianChebyshevCoefficients(
+        const std::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double intervalStartTime,
+        const double intervalEndTime,
+        const int numberOfCoefficients )
+{
+    const double intervalMidTime = 0.5 * ( intervalStartTime + intervalEndTime );
+    const double intervalHalfDuration = 0.5 * ( intervalEndTime - intervalStartTime );
+    const double numberOfNodes = static_cast< double >( numberOfCoefficients );
+
+    // Evaluate state function at Chebyshev nodes.
+    std::vector< double > nodeAngles( numberOfCoefficients );
+    ChebyshevCoefficientMatrix statesAtNodes( numberOfCoefficients, 6 );
+    for( int k = 0; k < numberOfCoefficients; k++ )
+    {
+        nodeAngles[ k ] = mathematical_constants::PI * ( static_cast< double >( k ) + 0.5 ) / numberOfNodes;
+        statesAtNodes.row( k ) =
+                stateFunction( intervalMidTime + intervalHalfDuration * std::cos( nodeAngles[ k ] ) ).transpose( );
+    }
+
+    // Compute coefficients from discrete cosine transform of node values.
+    ChebyshevCoefficientMatrix coefficients = ChebyshevCoefficientMatrix::Zero( numberOfCoefficients, 6 );
+    for( int j = 0; j < numberOfCoefficients; j++ )
+    {
+        for( int k = 0; k < numberOfCoefficients; k++ )
+        {
+            coefficients.row( j ) += std::cos( static_cast< double >( j ) * nodeAngles[ k ] ) * statesAtNodes.row( k );
+        }
+        coefficients.row( j ) *= ( ( j == 0 ) ? 1.0 : 2.0 ) / numberOfNodes;
+    }
+
+    return coefficients;
+}
+
+//! Function to create a Chebyshev ephemeris from a state function, with a bounded fitting error.
+std::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemeris(
+        const std::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double startTime,
+        const double endTime,
+        const int numberOfCoefficientsPerSegment,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const double initialSegmentDuration,
+        const int maximumNumberOfSegments,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation )
+{
+    if( !( endTime > startTime ) )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, end time must be larger than start time." );
+    }
+
+    if( numberOfCoefficientsPerSegment < 1 )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, number of coefficients per segment must be "
+                                  "at least 1." );
+    }
+
+    // Set initial number of segments
+    int numberOfSegments = 1;
+    if( initialSegmentDuration == initialSegmentDuration )
+    {
+        if( !( initialSegmentDuration > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when fitting Chebyshev ephemeris, initial segment duration must be "
+                                      "positive." );
+        }
+        numberOfSegments = std::max(
+                    1, static_cast< int >( std::ceil( ( endTime - startTime ) / initialSegmentDuration ) ) );
+    }
+
+    // Compute normalized times at which fit is checked: interval boundaries, and halfway (in angle) between nodes.
+    std::vector< double > checkNormalizedTimes;
+    for( int k = 0; k <= numberOfCoefficientsPerSegment; k++ )
+    {
+        checkNormalizedTimes.push_back(
+                    std::cos( mathematical_constants::PI * static_cast< double >( k ) /
+                              static_cast< double >( numberOfCoefficientsPerSegment ) ) );
+    }
+
+    // Increase the number of segments until fit is within tolerance in all segments.
+    ChebyshevCoefficientMatrix coefficients;
+    double segmentDuration;
+    while( true )
+    {
+        segmentDuration = ( endTime - startTime ) / static_cast< double >( numberOfSegments );
+        coefficients.resize( numberOfSegments * numberOfCoefficientsPerSegment, 6 );
+
+        // Compute coefficients for each segment, and maximum ratio of fit error to tolerance over all segments.
+        double maximumErrorRatio = 0.0;
+        for( int i = 0; i < numberOfSegments; i++ )
+        {
+            const double segmentStartTime = startTime + static_cast< double >( i ) * segmentDuration;
+            coefficients.block( i * numberOfCoefficientsPerSegment, 0, numberOfCoefficientsPerSegment, 6 ) =
+                    computeCartesianChebyshevCoefficients(
+                        stateFunction, segmentStartTime, segmentStartTime + segmentDuration,
+                        numberOfCoefficientsPerSegment );
+
+            for( unsigned int j = 0; j < checkNormalizedTimes.size( ); j++ )
+            {
+                const Eigen::Vector6d stateError =
+                        evaluateCartesianChebyshevSeries(
+                            coefficients.block( i * numberOfCoefficientsPerSegment, 0,
+                                                numberOfCoefficientsPerSegment, 6 ), checkNormalizedTimes.at( j ) ) -
+                        stateFunction( segmentStartTime + 0.5 * segmentDuration * ( checkNormalizedTimes.at( j ) + 1.0 ) );
+                maximumErrorRatio = std::max(
+                            maximumErrorRatio, std::max( stateError.segment( 0, 3 ).norm( ) / positionTolerance,
+                                                         stateError.segment( 3, 3 ).norm( ) / velocityTolerance ) );
+            }
+        }
+
+        if( maximumErrorRatio <= 1.0 )
+        {
+            break;
+        }
+        else if( numberOfSegments >= maximumNumberOfSegments || maximumErrorRatio != maximumErrorRatio )
+        {
+            throw std::runtime_error( "Error when fitting Chebyshev ephemeris, tolerances not met with maximum number "
+                                      "of segments (" + std::to_string( maximumNumberOfSegments ) + ")." );
+        }
+
+        // Estimate required number of segments, using the fact that the fit error scales with the segment duration to
+        // the power of the number of coefficients (with 10 % margin).
+        const double requiredSegmentRatio = 1.1 * std::pow(
+                    maximumErrorRatio, 1.0 / static_cast< double >( numberOfCoefficientsPerSegment ) );
+        numberOfSegments = static_cast< int >( std::min(
+                    static_cast< double >( maximumNumberOfSegments ),
+                    std::max( static_cast< double >( numberOfSegments + 1 ),
+                              std::ceil( requiredSegmentRatio * static_cast< double >( numberOfSegments ) ) ) ) );
+    }
+
+    return std::make_shared< ChebyshevEphemeris >(
+                coefficients, numberOfCoefficientsPerSegment, startTime, segmentDuration,
+                referenceFrameOrigin, referenceFrameOrientation );
+}
+
+//! Function to create a Chebyshev ephemeris from a (numerically propagated) state history, with a bounded fitting error.
+std::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemeris(
+        const std::map< double, Eigen::Vector6d >& stateHistory,
+        const int numberOfCoefficientsPerSegment,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const double initialSegmentDuration,
+        const int maximumNumberOfSegments,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation )
+{
+    if( stateHistory.size( ) < 8 )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris to state history, at least 8 states are "
+                                  "required." );
+    }
+
+    std::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > > stateInterpolator =
+            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > >(
+                stateHistory, 8 );
+
+    // Fit only over the range where the interpolator uses the full (centered) Lagrange polynomials.
+    std::map< double, Eigen::Vector6d >::const_iterator fitStartIterator = stateHistory.begin( );
+    std::map< double, Eigen::Vector6d >::const_reverse_iterator fitEndIterator = stateHistory.rbegin( );
+    std::advance( fitStartIterator, 3 );
+    std::advance( fitEndIterator, 3 );
+
+    return fitChebyshevEphemeris(
+                [ = ]( const double time ){ return stateInterpolator->interpolate( time ); },
+                fitStartIterator->first, fitEndIterator->first, numberOfCoefficientsPerSegment,
+                positionTolerance, velocityTolerance, initialSegmentDuration, maximumNumberOfSegments,
+                referenceFrameOrigin, referenceFrameOrientation );
+}
+
+//! Function to write a Chebyshev ephemeris to a binary file.
+void writeChebyshevEphemerisToBinaryFile( const std::shared_ptr< ChebyshevEphemeris > ephemeris,
+                                          const std::string& fileName )
+{
+    const std::string referenceFrameOrigin = ephemeris->getReferenceFrameOrigin( );
+    const std::string referenceFrameOrientation = ephemeris->getReferenceFrameOrientation( );
+    if( referenceFrameOrigin.size( ) >= chebyshevEphemerisFileFrameNameSize ||
+            referenceFrameOrientation.size( ) >= chebyshevEphemerisFileFrameNameSize )
+    {
+        throw std::runtime_error( "Error when writing Chebyshev ephemeris to file " + fileName +
+                                  ", frame names must be shorter than " +
+                                  std::to_string( chebyshevEphemerisFileFrameNameSize ) + " characters." );
+    }
+
+    // Fill header.
+    char header[ chebyshevEphemerisFileHeaderSize ];
+    std::memset( header, 0, chebyshevEphemerisFileHeaderSize );
+
+    const std::int32_t numberOfCoefficientsPerSegment = ephemeris->getNumberOfCoefficientsPerSegment( );
+    const std::int64_t numberOfSegments = ephemeris->getNumberOfSegments( );
+    const double startTime = ephemeris->getStartTime( );
+    const double segmentDuration = ephemeris->getSegmentDuration( );
+
+    std::memcpy( header, chebyshevEphemerisFileIdentifier, 8 );
+    std::memcpy( header + 8, &chebyshevEphemerisFileVersion, 4 );
+    std::memcpy( header + 12, &numberOfCoefficientsPerSegment, 4 );
+    std::memcpy( header + 16, &numberOfSegments, 8 );
+    std::memcpy( header + 24, &startTime, 8 );
+    std::memcpy( header + 32, &segmentDuration, 8 );
+    std::memcpy( header + 40, referenceFrameOrigin.c_str( ), referenceFrameOrigin.size( ) );
+    std::memcpy( header + 40 + chebyshevEphemerisFileFrameNameSize, referenceFrameOrientation.c_str( ),
+                 referenceFrameOrientation.size( ) );
+
+    // Write header and coefficients.
+    std::ofstream outputFile( fileName.c_str( ), std::ios::binary | std::ios::trunc );
+    if( !outputFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing Chebyshev ephemeris, could not open file " + fileName );
+    }
+
+    const ChebyshevCoefficientMatrix& coefficients = ephemeris->getCoefficients( );
+    outputFile.write( header, chebyshevEphemerisFileHeaderSize );
+    outputFile.write( reinterpret_cast< const char* >( coefficients.data( ) ),
+                      static_cast< std::streamsize >( coefficients.size( ) * sizeof( double ) ) );
+
+    if( !outputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when writing Chebyshev ephemeris to file " + fileName );
+    }
+}
+
+//! Function to read a Chebyshev ephemeris from a binary file.
+std::shared_ptr< ChebyshevEphemeris > readChebyshevEphemerisFromBinaryFile( const std::string& fileName )
+{
+    std::ifstream inputFile( fileName.c_str( ), std::ios::binary );
+    if( !inputFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris, could not open file " + fileName );
+    }
+
+    // Read and check header.
+    char header[ chebyshevEphemerisFileHeaderSize ];
+    inputFile.read( header, chebyshevEphemerisFileHeaderSize );
+    if( !inputFile.good( ) || std::memcmp( header, chebyshevEphemerisFileIdentifier, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris, file " + fileName +
+                                  " is not a Chebyshev ephemeris file." );
+    }
+
+    std::int32_t fileVersion;
+    std::int32_t numberOfCoefficientsPerSegment;
+    std::int64_t numberOfSegments;
+    double startTime;
+    double segmentDuration;
+    std::memcpy( &fileVersion, header + 8, 4 );
+    std::memcpy( &numberOfCoefficientsPerSegment, header + 12, 4 );
+    std::memcpy( &numberOfSegments, header + 16, 8 );
+    std::memcpy( &startTime, header + 24, 8 );
+    std::memcpy( &segmentDuration, header + 32, 8 );
+
+    if( fileVersion != chebyshevEphemerisFileVersion )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris from file " + fileName +
+                                  ", file version " + std::to_string( fileVersion ) + " not supported." );
+    }
+
+    if( numberOfCoefficientsPerSegment < 1 || numberOfSegments < 1 )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris from file " + fileName +
+                                  ", invalid coefficient block size." );
+    }
+
+    const char* originEntry = header + 40;
+    const char* orientationEntry = header + 40 + chebyshevEphemerisFileFrameNameSize;
+    const std::string referenceFrameOrigin(
+                originEntry, std::find( originEntry, originEntry + chebyshevEphemerisFileFrameNameSize, '\0' ) );
+    const std::string referenceFrameOrientation(
+                orientationEntry, std::find( orientationEntry, orientationEntry + chebyshevEphemerisFileFrameNameSize,
+                                             '\0' ) );
+
+    // Read coefficients in single block.
+    ChebyshevCoefficientMatrix coefficients( numberOfSegments * numberOfCoefficientsPerSegment, 6 );
+    inputFile.read( reinterpret_cast< char* >( coefficients.data( ) ),
+                    static_cast< std::streamsize >( coefficients.size( ) * sizeof( double ) ) );
+    if( !inputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris from file " + fileName +
+                                  ", file is truncated." );
+    }
+
+    return std::make_shared< ChebyshevEphemeris >(
+                coefficients, numberOfCoefficientsPerSegment, startTime, segmentDuration,
+                referenceFrameOrigin, referenceFrameOrientation );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
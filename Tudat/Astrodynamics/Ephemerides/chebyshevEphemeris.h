@@ -0,0 +1,276 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_CHEBYSHEV_EPHEMERIS_H
+#define TUDAT_CHEBYSHEV_EPHEMERIS_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Typedef for matrix containing Chebyshev coefficients of Cartesian state (one row per coefficient, stored row-major).
+typedef Eigen::Matrix< double, Eigen::Dynamic, 6, Eigen::RowMajor > ChebyshevCoefficientMatrix;
+
+//! Function to evaluate a Chebyshev series for all six Cartesian state elements.
+/*!
+ * Function to evaluate a Chebyshev series (of the first kind) for all six Cartesian state elements, using Clenshaw's
+ * recurrence algorithm.
+ * \param coefficients Chebyshev coefficients (one row per degree, one column per state element).
+ * \param normalizedTime Independent variable of Chebyshev polynomials (nominally in range [-1,1]).
+ * \return Value of Chebyshev series for each of the six state elements.
+ */
+Eigen::Vector6d evaluateCartesianChebyshevSeries(
+        const Eigen::Ref< const ChebyshevCoefficientMatrix >& coefficients,
+        const double normalizedTime );
+
+//! Class for ephemeris defined by piecewise Chebyshev polynomials of the Cartesian state.
+/*!
+ * Class for ephemeris defined by piecewise Chebyshev polynomials of the Cartesian state. The validity interval of the
+ * ephemeris is divided into segments of equal duration, so that the segment of any given time is found directly (in
+ * constant time). In each segment, each of the six Cartesian state elements is represented by a Chebyshev series with
+ * the same number of coefficients. The coefficients of all segments are stored contiguously, in order of segment, then
+ * degree, then state element, which is also the layout of the binary file written by
+ * writeChebyshevEphemerisToBinaryFile. Such an ephemeris is typically created from a (numerically propagated)
+ * trajectory by the fitChebyshevEphemeris function. Since the object is not modified after construction, the state
+ * may be retrieved concurrently from multiple threads without locking.
+ */
+class ChebyshevEphemeris: public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param coefficients Chebyshev coefficients of all segments, with numberOfCoefficientsPerSegment consecutive rows
+     * for each segment (in order of degree).
+     * \param numberOfCoefficientsPerSegment Number of Chebyshev coefficients (i.e. degree + 1) per segment.
+     * \param startTime Start time of validity interval of ephemeris.
+     * \param segmentDuration Duration of each segment.
+     * \param referenceFrameOrigin Origin of reference frame in which ephemeris is defined.
+     * \param referenceFrameOrientation Orientation of reference frame in which ephemeris is defined.
+     */
+    ChebyshevEphemeris( const ChebyshevCoefficientMatrix& coefficients,
+                        const int numberOfCoefficientsPerSegment,
+                        const double startTime,
+                        const double segmentDuration,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Destructor
+    ~ChebyshevEphemeris( ){ }
+
+    //! Function to get state from ephemeris.
+    /*!
+     * Function to get state from ephemeris, by evaluating the Chebyshev series of the segment in which the requested
+     * time lies. An exception is thrown if the time is outside the validity interval of the ephemeris.
+     * \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     * \return State from ephemeris.
+     */
+    Eigen::Vector6d getCartesianState( const double secondsSinceEpoch );
+
+    //! Function to retrieve the Chebyshev coefficients of all segments.
+    /*!
+     * Function to retrieve the Chebyshev coefficients of all segments.
+     * \return Chebyshev coefficients of all segments.
+     */
+    const ChebyshevCoefficientMatrix& getCoefficients( )
+    {
+        return coefficients_;
+    }
+
+    //! Function to retrieve the number of Chebyshev coefficients per segment.
+    /*!
+     * Function to retrieve the number of Chebyshev coefficients per segment.
+     * \return Number of Chebyshev coefficients per segment.
+     */
+    int getNumberOfCoefficientsPerSegment( )
+    {
+        return numberOfCoefficientsPerSegment_;
+    }
+
+    //! Function to retrieve the number of segments.
+    /*!
+     * Function to retrieve the number of segments.
+     * \return Number of segments.
+     */
+    int getNumberOfSegments( )
+    {
+        return numberOfSegments_;
+    }
+
+    //! Function to retrieve the start time of validity interval of ephemeris.
+    /*!
+     * Function to retrieve the start time of validity interval of ephemeris.
+     * \return Start time of validity interval of ephemeris.
+     */
+    double getStartTime( )
+    {
+        return startTime_;
+    }
+
+    //! Function to retrieve the end time of validity interval of ephemeris.
+    /*!
+     * Function to retrieve the end time of validity interval of ephemeris.
+     * \return End time of validity interval of ephemeris.
+     */
+    double getEndTime( )
+    {
+        return startTime_ + static_cast< double >( numberOfSegments_ ) * segmentDuration_;
+    }
+
+    //! Function to retrieve the duration of each segment.
+    /*!
+     * Function to retrieve the duration of each segment.
+     * \return Duration of each segment.
+     */
+    double getSegmentDuration( )
+    {
+        return segmentDuration_;
+    }
+
+private:
+
+    //! Chebyshev coefficients of all segments.
+    ChebyshevCoefficientMatrix coefficients_;
+
+    //! Number of Chebyshev coefficients per segment.
+    int numberOfCoefficientsPerSegment_;
+
+    //! Number of segments.
+    int numberOfSegments_;
+
+    //! Start time of validity interval of ephemeris.
+    double startTime_;
+
+    //! Duration of each segment.
+    double segmentDuration_;
+
+};
+
+//! Function to compute the Chebyshev coefficients that interpolate a state function on a single time interval.
+/*!
+ * Function to compute the Chebyshev coefficients that interpolate a state function on a single time interval. The
+ * state function is evaluated at the Chebyshev nodes (roots of the Chebyshev polynomial of degree
+ * numberOfCoefficients) of the interval, from which the coefficients are computed by a discrete cosine transform.
+ * \param stateFunction Function returning the Cartesian state as a function of time.
+ * \param intervalStartTime Start time of interval.
+ * \param intervalEndTime End time of interval.
+ * \param numberOfCoefficients Number of Chebyshev coefficients (i.e. degree + 1) that is to be computed.
+ * \return Chebyshev coefficients (one row per degree, one column per state element).
+ */
+ChebyshevCoefficientMatrix computeCartesianChebyshevCoefficients(
+        const std::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double intervalStartTime,
+        const double intervalEndTime,
+        const int numberOfCoefficients );
+
+//! Function to create a Chebyshev ephemeris from a state function, with a bounded fitting error.
+/*!
+ * Function to create a Chebyshev ephemeris from a state function, with a bounded fitting error. The interval is
+ * initially divided in segments of (at most) initialSegmentDuration. The Chebyshev coefficients of each segment are
+ * computed by computeCartesianChebyshevCoefficients, and the fitting error is evaluated at the segment boundaries and
+ * halfway between the Chebyshev nodes (where the interpolation error is largest). If the position or velocity error in
+ * any segment exceeds the tolerance, the number of segments is increased (based on the maximum ratio of error and
+ * tolerance), and the fit is repeated.
+ * \param stateFunction Function returning the Cartesian state as a function of time.
+ * \param startTime Start time of validity interval of ephemeris.
+ * \param endTime End time of validity interval of ephemeris.
+ * \param numberOfCoefficientsPerSegment Number of Chebyshev coefficients (i.e. degree + 1) per segment.
+ * \param positionTolerance Maximum allowed position error (norm) at the fitting check points.
+ * \param velocityTolerance Maximum allowed velocity error (norm) at the fitting check points.
+ * \param initialSegmentDuration Initial (maximum) segment duration (entire interval if NaN).
+ * \param maximumNumberOfSegments Maximum number of segments; exception is thrown if tolerances cannot be met with
+ * this number of segments.
+ * \param referenceFrameOrigin Origin of reference frame in which ephemeris is defined.
+ * \param referenceFrameOrientation Orientation of reference frame in which ephemeris is defined.
+ * \return Chebyshev ephemeris, fitted to state function
+ */
+std::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemeris(
+        const std::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double startTime,
+        const double endTime,
+        const int numberOfCoefficientsPerSegment,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const double initialSegmentDuration = TUDAT_NAN,
+        const int maximumNumberOfSegments = 1000000,
+        const std::string& referenceFrameOrigin = "SSB",
+        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+//! Function to create a Chebyshev ephemeris from a (numerically propagated) state history, with a bounded fitting error.
+/*!
+ * Function to create a Chebyshev ephemeris from a (numerically propagated) state history, with a bounded fitting
+ * error. The state history is interpolated by an 8th order Lagrange interpolator, to which the Chebyshev segments are
+ * fitted (see fitChebyshevEphemeris function taking a state function). To prevent the (less accurate) boundary
+ * interpolation from affecting the fit, the first and last three states are only used as interpolation nodes, and are
+ * outside of the validity interval of the resulting ephemeris.
+ * \param stateHistory State history (key: time) to which the ephemeris is to be fitted.
+ * \param numberOfCoefficientsPerSegment Number of Chebyshev coefficients (i.e. degree + 1) per segment.
+ * \param positionTolerance Maximum allowed position error (norm) at the fitting check points.
+ * \param velocityTolerance Maximum allowed velocity error (norm) at the fitting check points.
+ * \param initialSegmentDuration Initial (maximum) segment duration (entire interval if NaN).
+ * \param maximumNumberOfSegments Maximum number of segments; exception is thrown if tolerances cannot be met with
+ * this number of segments.
+ * \param referenceFrameOrigin Origin of reference frame in which ephemeris is defined.
+ * \param referenceFrameOrientation Orientation of reference frame in which ephemeris is defined.
+ * \return Chebyshev ephemeris, fitted to state history
+ */
+std::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemeris(
+        const std::map< double, Eigen::Vector6d >& stateHistory,
+        const int numberOfCoefficientsPerSegment,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const double initialSegmentDuration = TUDAT_NAN,
+        const int maximumNumberOfSegments = 1000000,
+        const std::string& referenceFrameOrigin = "SSB",
+        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+//! Function to write a Chebyshev ephemeris to a binary file.
+/*!
+ * Function to write a Chebyshev ephemeris to a binary file. The file consists of a fixed-size header (identifier,
+ * format version, number of coefficients per segment, number of segments, start time, segment duration and frame
+ * origin/orientation, padded to 192 bytes), followed directly by the coefficients as contiguous doubles, in the same
+ * layout as ChebyshevEphemeris::getCoefficients. The coefficient block is 8-byte aligned, so that it can be
+ * memory-mapped directly. Values are written in the byte order of the current machine.
+ * \param ephemeris Ephemeris that is to be written to file.
+ * \param fileName Name of file to which ephemeris is to be written.
+ */
+void writeChebyshevEphemerisToBinaryFile( const std::shared_ptr< ChebyshevEphemeris > ephemeris,
+                                          const std::string& fileName );
+
+//! Function to read a Chebyshev ephemeris from a binary file.
+/*!
+ * Function to read a Chebyshev ephemeris from a binary file, as written by writeChebyshevEphemerisToBinaryFile.
+ * \param fileName Name of file from which ephemeris is to be read.
+ * \return Chebyshev ephemeris, as read from file.
+ */
+std::shared_ptr< ChebyshevEphemeris > readChebyshevEphemerisFromBinaryFile( const std::string& fileName );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CHEBYSHEV_EPHEMERIS_H
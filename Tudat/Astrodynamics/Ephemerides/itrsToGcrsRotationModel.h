@@ -20,6 +20,7 @@
 #include "Tudat/Mathematics/Interpolators/interpolator.h"
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
 #include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationAnglesCache.h"
 
 namespace tudat
 {
@@ -30,8 +31,8 @@ namespace ephemerides
 
 //! Class for rotation from ITRS to GCRS, according to IERS 2010 models.
 /*!
- *  Class for rotation from ITRS to GCRS, according to IERS 2010 models and rotation angle corrections. Angles may be provided by an interpolator
- *  to prevent this cllass becoming a computational bottleneck.
+ *  Class for rotation from ITRS to GCRS, according to IERS 2010 models and rotation angle corrections. Angles may be provided by an
+ *  EarthOrientationAnglesCache (interpolating precomputed angles) to prevent this class becoming a computational bottleneck.
  */
 class GcrsToItrsRotationModel: public RotationalEphemeris
 {
@@ -64,17 +65,32 @@ public:
      *  \param anglesCalculator Class performing calculation to obtain earth orientation angle.
      *  \param timeScale Time scale in which input to this class (in getRotationToBaseFrame, getDerivativeOfRotationFromFrame) is provided,
      *  needed for correct input to EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs.
+     *  \param baseFrame Name of base frame (GCRS or J2000)
+     *  \param anglesCache Cache of earth orientation angles, computed by anglesCalculator in inputTimeScale, from which the
+     *  angles are interpolated (if nullptr, default, angles are computed directly by anglesCalculator).
      */
     GcrsToItrsRotationModel( const std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator,
                              const basic_astrodynamics::TimeScales inputTimeScale  = basic_astrodynamics::tdb_scale,
-                             const std::string& baseFrame = "GCRS" ):
-        RotationalEphemeris( baseFrame, "ITRS" ), anglesCalculator_( anglesCalculator ), inputTimeScale_( inputTimeScale ),
-        frameBias_( Eigen::Matrix3d::Identity( ) )
+                             const std::string& baseFrame = "GCRS",
+                             const std::shared_ptr< earth_orientation::EarthOrientationAnglesCache > anglesCache = nullptr ):
+        RotationalEphemeris( baseFrame, "ITRS" ), anglesCalculator_( anglesCalculator ), anglesCache_( anglesCache ),
+        inputTimeScale_( inputTimeScale ), frameBias_( Eigen::Matrix3d::Identity( ) )
 
     {
+        if( anglesCache_ != nullptr )
+        {
+            if( anglesCache_->getAnglesCalculator( ) != anglesCalculator_ )
+            {
+                throw std::runtime_error( "Error in GCRS<->ITRS model, angles cache uses different angles calculator" );
+            }
+            else if( anglesCache_->getInputTimeScale( ) != inputTimeScale_ )
+            {
+                throw std::runtime_error( "Error in GCRS<->ITRS model, angles cache uses different input time scale" );
+            }
+        }
+
         functionToGetRotationAngles = std::bind(
-                    &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
-                    anglesCalculator, std::placeholders::_1, inputTimeScale );
+                    &GcrsToItrsRotationModel::getRotationAngles< double >, this, std::placeholders::_1 );
         if( baseFrame == "J2000" )
         {
             frameBias_ = sofa_interface::getFrameBias(
@@ -95,8 +111,7 @@ public:
     Eigen::Quaterniond getRotationToBaseFrame( const double ephemerisTime )
     {
         return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< double >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< double >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+                    getRotationAngles< double >( ephemerisTime ), ephemerisTime );
     }
 
     //! Function to calculate the rotation quaternion from ITRS to base frame
@@ -109,8 +124,7 @@ public:
     Eigen::Quaterniond getRotationToBaseFrameFromExtendedTime( const Time ephemerisTime )
     {
         return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< Time >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+                    getRotationAngles< Time >( ephemerisTime ), ephemerisTime );
     }
 
 
@@ -182,9 +196,38 @@ public:
         return inputTimeScale_;
     }
 
+    //! Function to retrieve cache of earth orientation angles (nullptr if angles are computed directly)
+    /*!
+     * Function to retrieve cache of earth orientation angles (nullptr if angles are computed directly)
+     * \return Cache of earth orientation angles
+     */
+    std::shared_ptr< earth_orientation::EarthOrientationAnglesCache > getAnglesCache( )
+    {
+        return anglesCache_;
+    }
+
 
 private:
 
+    //! Function to retrieve the earth orientation angles and UT1, from the cache if it is used.
+    /*!
+     * Function to retrieve the earth orientation angles and UT1, from the cache if it is used.
+     * \param ephemerisTime Time at which angles are to be retrieved.
+     * \return Rotation angles (X, Y, s, x_p, y_p) and UT1 at given epoch.
+     */
+    template< typename TimeType >
+    std::pair< Eigen::Vector5d, TimeType > getRotationAngles( const TimeType ephemerisTime )
+    {
+        if( anglesCache_ != nullptr )
+        {
+            return anglesCache_->getRotationAnglesFromItrsToGcrs( ephemerisTime );
+        }
+        else
+        {
+            return anglesCalculator_->getRotationAnglesFromItrsToGcrs< TimeType >( ephemerisTime, inputTimeScale_ );
+        }
+    }
+
     //! Function providing the earth orientation angles as a function of time
     /*!
      * Function providing the earth orientation angles as a function of time.
@@ -200,6 +243,9 @@ private:
      */
     std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator_;
 
+    //! Cache of earth orientation angles (nullptr if angles are computed directly by anglesCalculator_)
+    std::shared_ptr< earth_orientation::EarthOrientationAnglesCache > anglesCache_;
+
     //! Time scale in which the input time for class functions are interpreted
     basic_astrodynamics::TimeScales inputTimeScale_;
 
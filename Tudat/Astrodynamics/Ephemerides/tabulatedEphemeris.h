@@ -17,6 +17,7 @@
 
 #include <Eigen/Core>
 
+#include "Tudat/Basics/propagationHistory.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
@@ -269,6 +270,108 @@ std::shared_ptr< Ephemeris > getTabulatedEphemeris(
 
 }
 
+//! Create an interpolator for a tabulated Cartesian state from time-sorted vectors of times and states
+/*!
+ * Create an interpolator for a tabulated Cartesian state from time-sorted vectors of times and states, for instance as
+ * retrieved from a (contiguous) propagation history. For Lagrange interpolation, the interpolator is created directly from
+ * the vectors, without creating an intermediate map of the states.
+ * \param times Times at which the states are given, in increasing order
+ * \param states States at the given times
+ * \param interpolatorSettings Interpolation settings for the state
+ * \return Interpolator for the Cartesian state
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >
+createTabulatedStateInterpolator(
+        const std::vector< TimeType >& times,
+        const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& states,
+        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings )
+{
+    typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
+
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, StateType > > stateInterpolator;
+    std::shared_ptr< interpolators::LagrangeInterpolatorSettings > lagrangeInterpolatorSettings =
+            std::dynamic_pointer_cast< interpolators::LagrangeInterpolatorSettings >( interpolatorSettings );
+    if( lagrangeInterpolatorSettings != nullptr && lagrangeInterpolatorSettings->getBoundaryHandling( ).size( ) == 1 )
+    {
+        if( lagrangeInterpolatorSettings->getUseLongDoubleTimeStep( ) )
+        {
+            stateInterpolator = std::make_shared< interpolators::LagrangeInterpolator< TimeType, StateType, long double > >(
+                        times, states, lagrangeInterpolatorSettings->getInterpolatorOrder( ),
+                        lagrangeInterpolatorSettings->getSelectedLookupScheme( ),
+                        lagrangeInterpolatorSettings->getLagrangeBoundaryHandling( ),
+                        lagrangeInterpolatorSettings->getBoundaryHandling( ).at( 0 ) );
+        }
+        else
+        {
+            stateInterpolator = std::make_shared< interpolators::LagrangeInterpolator< TimeType, StateType, double > >(
+                        times, states, lagrangeInterpolatorSettings->getInterpolatorOrder( ),
+                        lagrangeInterpolatorSettings->getSelectedLookupScheme( ),
+                        lagrangeInterpolatorSettings->getLagrangeBoundaryHandling( ),
+                        lagrangeInterpolatorSettings->getBoundaryHandling( ).at( 0 ) );
+        }
+    }
+    else
+    {
+        std::map< TimeType, StateType > stateMap;
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            stateMap[ times.at( i ) ] = states.at( i );
+        }
+        stateInterpolator = interpolators::createOneDimensionalInterpolator( stateMap, interpolatorSettings );
+    }
+    return stateInterpolator;
+}
+
+//! Create an interpolator for a tabulated Cartesian state from a (contiguous) propagation history
+/*!
+ * Create an interpolator for a tabulated Cartesian state from a (contiguous) propagation history, for instance as
+ * produced by a numerical propagation, without creating an intermediate map of the states (for Lagrange interpolation).
+ * \param stateHistory History of (concatenated) states, from which the Cartesian state of the body is to be retrieved
+ * \param startRow Row in state history at which the Cartesian state of the body starts
+ * \param interpolatorSettings Interpolation settings for the state
+ * \return Interpolator for the Cartesian state
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >
+createTabulatedStateInterpolator(
+        const PropagationHistory< TimeType, StateScalarType >& stateHistory,
+        const int startRow,
+        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings )
+{
+    // Retrieve time-sorted states of body
+    std::vector< TimeType > times;
+    std::vector< Eigen::Matrix< StateScalarType, 6, 1 > > states;
+    stateHistory.getSortedTimesAndStates( startRow, 6, times, states );
+
+    return createTabulatedStateInterpolator( times, states, interpolatorSettings );
+}
+
+//! Create a tabulated ephemeris from a (contiguous) propagation history
+/*!
+ * Create a tabulated ephemeris from a (contiguous) propagation history, for instance as produced by a numerical
+ * propagation, without creating an intermediate map of the states (see createTabulatedStateInterpolator).
+ * \param stateHistory History of (concatenated) states, from which the Cartesian state of the body is to be retrieved
+ * \param startRow Row in state history at which the Cartesian state of the body starts
+ * \param interpolatorSettings Interpolation settings for tabulated ephemeris
+ * \param referenceFrameOrigin Origin of reference frame in which state is defined.
+ * \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+ * \return Tabulated ephemeris, as created from the propagation history
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< TabulatedCartesianEphemeris< StateScalarType, TimeType > > createTabulatedCartesianEphemeris(
+        const PropagationHistory< TimeType, StateScalarType >& stateHistory,
+        const int startRow = 0,
+        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
+        std::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ),
+        const std::string referenceFrameOrigin = "SSB",
+        const std::string referenceFrameOrientation = "ECLIPJ2000" )
+{
+    return std::make_shared< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                createTabulatedStateInterpolator( stateHistory, startRow, interpolatorSettings ),
+                referenceFrameOrigin, referenceFrameOrientation );
+}
+
 } // namespace ephemerides
 
 } // namespace tudat
@@ -0,0 +1,137 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      This program is not a unit test, and is not registered with ctest, since its output (evaluation times) depends
+ *      on the machine and build type. It compares the run time of the multi-point spherical harmonic acceleration
+ *      function with that of repeated calls to the single-point function, at degree/order 20, 70 and 200, and returns a
+ *      non-zero exit code only if both functions do not produce the same accelerations.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+#include "Tudat/Mathematics/BasicMathematics/multiPointSphericalHarmonics.h"
+#include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
+
+//! Function to generate random geodesy-normalized coefficients, with magnitude following Kaula's rule.
+void getRandomCoefficients( const int numberOfDegrees, Eigen::MatrixXd& cosineCoefficients,
+                            Eigen::MatrixXd& sineCoefficients )
+{
+    std::mt19937 generator( 42 );
+    std::uniform_real_distribution< double > distribution( -1.0, 1.0 );
+
+    cosineCoefficients = Eigen::MatrixXd::Zero( numberOfDegrees, numberOfDegrees );
+    sineCoefficients = Eigen::MatrixXd::Zero( numberOfDegrees, numberOfDegrees );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int i = 2; i < numberOfDegrees; i++ )
+    {
+        for( int j = 0; j <= i; j++ )
+        {
+            cosineCoefficients( i, j ) = 1.0E-5 / static_cast< double >( i * i ) * distribution( generator );
+            if( j > 0 )
+            {
+                sineCoefficients( i, j ) = 1.0E-5 / static_cast< double >( i * i ) * distribution( generator );
+            }
+        }
+    }
+}
+
+//! Function to generate random positions, with distances between 1.0 and 2.0 times the reference radius.
+Eigen::Matrix3Xd getRandomPositions( const int numberOfPositions, const double referenceRadius )
+{
+    std::mt19937 generator( 1 );
+    std::uniform_real_distribution< double > distribution( -1.0, 1.0 );
+
+    Eigen::Matrix3Xd positions( 3, numberOfPositions );
+    for( int i = 0; i < numberOfPositions; i++ )
+    {
+        Eigen::Vector3d direction;
+        do
+        {
+            direction << distribution( generator ), distribution( generator ), distribution( generator );
+        }
+        while( direction.norm( ) < 0.1 || direction.norm( ) > 1.0 );
+        positions.col( i ) = referenceRadius * ( 1.5 + 0.5 * distribution( generator ) ) * direction.normalized( );
+    }
+    return positions;
+}
+
+//! Execute benchmark of multi-point spherical harmonic acceleration function against single-point function.
+int main( )
+{
+    using namespace tudat;
+
+    const double gravitationalParameter = 3.986004418e14;
+    const double referenceRadius = 6378137.0;
+
+    std::vector< int > maximumDegrees = { 20, 70, 200 };
+    std::vector< int > numberOfPositions = { 4096, 1024, 256 };
+
+    bool areResultsEqual = true;
+    for( unsigned int i = 0; i < maximumDegrees.size( ); i++ )
+    {
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        getRandomCoefficients( maximumDegrees.at( i ) + 1, cosineCoefficients, sineCoefficients );
+        const Eigen::Matrix3Xd positions = getRandomPositions( numberOfPositions.at( i ), referenceRadius );
+
+        // Evaluate accelerations one point at a time.
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+                std::make_shared< basic_mathematics::SphericalHarmonicsCache >(
+                    cosineCoefficients.rows( ), cosineCoefficients.cols( ) + 1 );
+        std::map< std::pair< int, int >, Eigen::Vector3d > dummyAccelerationPerTerm;
+        Eigen::Matrix3Xd singlePointAccelerations( 3, positions.cols( ) );
+        for( int j = 0; j < positions.cols( ); j++ )
+        {
+            singlePointAccelerations.col( j ) = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                        positions.col( j ), gravitationalParameter, referenceRadius, cosineCoefficients,
+                        sineCoefficients, sphericalHarmonicsCache, dummyAccelerationPerTerm, false );
+        }
+        const double singlePointTime =
+                std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        // Evaluate accelerations for all points at once.
+        startTime = std::chrono::steady_clock::now( );
+        const Eigen::Matrix3Xd multiPointAccelerations = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                    positions, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                    std::make_shared< basic_mathematics::MultiPointSphericalHarmonicsCache >( ) );
+        const double multiPointTime =
+                std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        std::cout << "Degree/order " << maximumDegrees.at( i ) << ", " << numberOfPositions.at( i )
+                  << " positions: single-point " << singlePointTime << " s, multi-point " << multiPointTime
+                  << " s, speed-up " << singlePointTime / multiPointTime << std::endl;
+
+        double maximumRelativeDifference = 0.0;
+        for( int j = 0; j < positions.cols( ); j++ )
+        {
+            maximumRelativeDifference = std::max(
+                        maximumRelativeDifference,
+                        ( multiPointAccelerations.col( j ) - singlePointAccelerations.col( j ) ).norm( ) /
+                        singlePointAccelerations.col( j ).norm( ) );
+        }
+        if( maximumRelativeDifference > 1.0E-12 )
+        {
+            std::cerr << "Error, multi-point accelerations at degree/order " << maximumDegrees.at( i )
+                      << " differ from single-point accelerations." << std::endl;
+            areResultsEqual = false;
+        }
+    }
+
+    return areResultsEqual ? 0 : 1;
+}
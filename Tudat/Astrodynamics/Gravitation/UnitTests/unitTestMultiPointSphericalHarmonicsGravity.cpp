@@ -0,0 +1,221 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <random>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+#include "Tudat/Mathematics/BasicMathematics/multiPointSphericalHarmonics.h"
+#include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to generate random geodesy-normalized coefficients, with magnitude following Kaula's rule.
+void getRandomCoefficients( const int numberOfDegrees, const int numberOfOrders,
+                            Eigen::MatrixXd& cosineCoefficients, Eigen::MatrixXd& sineCoefficients )
+{
+    std::mt19937 generator( 42 );
+    std::uniform_real_distribution< double > distribution( -1.0, 1.0 );
+
+    cosineCoefficients = Eigen::MatrixXd::Zero( numberOfDegrees, numberOfOrders );
+    sineCoefficients = Eigen::MatrixXd::Zero( numberOfDegrees, numberOfOrders );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int i = 2; i < numberOfDegrees; i++ )
+    {
+        for( int j = 0; ( j <= i ) && ( j < numberOfOrders ); j++ )
+        {
+            cosineCoefficients( i, j ) = 1.0E-5 / static_cast< double >( i * i ) * distribution( generator );
+            if( j > 0 )
+            {
+                sineCoefficients( i, j ) = 1.0E-5 / static_cast< double >( i * i ) * distribution( generator );
+            }
+        }
+    }
+}
+
+//! Function to generate random positions, with distances between 1.0 and 2.0 times the reference radius.
+Eigen::Matrix3Xd getRandomPositions( const int numberOfPositions, const double referenceRadius )
+{
+    std::mt19937 generator( 1 );
+    std::uniform_real_distribution< double > distribution( -1.0, 1.0 );
+
+    Eigen::Matrix3Xd positions( 3, numberOfPositions );
+    for( int i = 0; i < numberOfPositions; i++ )
+    {
+        Eigen::Vector3d direction;
+        do
+        {
+            direction << distribution( generator ), distribution( generator ), distribution( generator );
+        }
+        while( direction.norm( ) < 0.1 || direction.norm( ) > 1.0 );
+        positions.col( i ) = referenceRadius * ( 1.5 + 0.5 * distribution( generator ) ) * direction.normalized( );
+    }
+    return positions;
+}
+
+//! Function to compute accelerations at list of positions, using single-point spherical harmonic acceleration function.
+Eigen::Matrix3Xd computeSinglePointAccelerations(
+        const Eigen::Matrix3Xd& positions,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) )
+{
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            std::make_shared< basic_mathematics::SphericalHarmonicsCache >(
+                cosineCoefficients.rows( ), cosineCoefficients.cols( ) + 1 );
+    std::map< std::pair< int, int >, Eigen::Vector3d > dummyAccelerationPerTerm;
+
+    Eigen::Matrix3Xd accelerations( 3, positions.cols( ) );
+    for( int i = 0; i < positions.cols( ); i++ )
+    {
+        accelerations.col( i ) = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                    positions.col( i ), gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                    sphericalHarmonicsCache, dummyAccelerationPerTerm, false, accelerationRotation );
+    }
+    return accelerations;
+}
+
+//! Function to compute maximum (over all points) relative difference between two lists of accelerations
+double getMaximumRelativeDifference( const Eigen::Matrix3Xd& accelerations, const Eigen::Matrix3Xd& expectedAccelerations )
+{
+    double maximumRelativeDifference = 0.0;
+    for( int i = 0; i < accelerations.cols( ); i++ )
+    {
+        maximumRelativeDifference = std::max(
+                    maximumRelativeDifference,
+                    ( accelerations.col( i ) - expectedAccelerations.col( i ) ).norm( ) /
+                    expectedAccelerations.col( i ).norm( ) );
+    }
+    return maximumRelativeDifference;
+}
+
+BOOST_AUTO_TEST_SUITE( test_MultiPointSphericalHarmonicsGravity )
+
+//! Test whether multi-point acceleration function reproduces single-point acceleration function
+BOOST_AUTO_TEST_CASE( testMultiPointSphericalHarmonicAcceleration )
+{
+    const double gravitationalParameter = 3.986004418e14;
+    const double referenceRadius = 6378137.0;
+
+    const Eigen::Matrix3Xd positions = getRandomPositions( 100, referenceRadius );
+
+    // Rotation from body-fixed to inertial frame.
+    const Eigen::Matrix3d accelerationRotation =
+            Eigen::AngleAxisd( 0.3, Eigen::Vector3d( 1.0, -2.0, 0.5 ).normalized( ) ).toRotationMatrix( );
+
+    // Test for square and for order-truncated coefficient matrices
+    for( int test = 0; test < 2; test++ )
+    {
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        getRandomCoefficients( 51, ( test == 0 ) ? 51 : 13, cosineCoefficients, sineCoefficients );
+
+        const Eigen::Matrix3Xd expectedAccelerations = computeSinglePointAccelerations(
+                    positions, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                    accelerationRotation );
+
+        // Test different block sizes, reusing same cache.
+        std::shared_ptr< basic_mathematics::MultiPointSphericalHarmonicsCache > multiPointCache =
+                std::make_shared< basic_mathematics::MultiPointSphericalHarmonicsCache >( );
+        std::vector< int > blockSizes = { 1, 7, 64, 1000 };
+        for( unsigned int i = 0; i < blockSizes.size( ); i++ )
+        {
+            const Eigen::Matrix3Xd accelerations = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                        positions, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                        multiPointCache, accelerationRotation, blockSizes.at( i ) );
+
+            BOOST_CHECK_EQUAL( accelerations.cols( ), positions.cols( ) );
+            BOOST_CHECK_SMALL( getMaximumRelativeDifference( accelerations, expectedAccelerations ), 1.0E-13 );
+        }
+    }
+}
+
+//! Test multi-point acceleration computation of SphericalHarmonicsGravitationalAccelerationModel
+BOOST_AUTO_TEST_CASE( testMultiPointSphericalHarmonicAccelerationModel )
+{
+    const double gravitationalParameter = 3.986004418e14;
+    const double referenceRadius = 6378137.0;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomCoefficients( 21, 21, cosineCoefficients, sineCoefficients );
+
+    const Eigen::Matrix3Xd positions = getRandomPositions( 20, referenceRadius );
+    const Eigen::Vector3d centralBodyPosition( 1.0E8, -2.0E7, 3.0E6 );
+    const Eigen::Quaterniond rotationToInertialFrame =
+            Eigen::Quaterniond( Eigen::AngleAxisd( -1.2, Eigen::Vector3d( 0.2, 0.1, 1.0 ).normalized( ) ) );
+
+    // Create acceleration model, with position of body undergoing acceleration set by reference.
+    Eigen::Vector3d currentPosition = centralBodyPosition + positions.col( 0 );
+    gravitation::SphericalHarmonicsGravitationalAccelerationModel accelerationModel(
+                [ & ]( ){ return currentPosition; },
+                gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                [ & ]( ){ return centralBodyPosition; },
+                [ & ]( ){ return rotationToInertialFrame; } );
+
+    // Compute accelerations one by one by updating model.
+    Eigen::Matrix3Xd expectedAccelerations( 3, positions.cols( ) );
+    for( int i = 0; i < positions.cols( ); i++ )
+    {
+        currentPosition = centralBodyPosition + positions.col( i );
+        accelerationModel.resetTime( TUDAT_NAN );
+        accelerationModel.updateMembers( static_cast< double >( i ) );
+        expectedAccelerations.col( i ) = accelerationModel.getAcceleration( );
+    }
+
+    const Eigen::Matrix3Xd accelerations = accelerationModel.getAccelerationsAtInertialRelativePositions( positions );
+    BOOST_CHECK_SMALL( getMaximumRelativeDifference( accelerations, expectedAccelerations ), 1.0E-13 );
+
+    // Check that state of acceleration model is not modified.
+    BOOST_CHECK_EQUAL( ( accelerationModel.getAcceleration( ) - expectedAccelerations.col( positions.cols( ) - 1 ) ).norm( ),
+                       0.0 );
+}
+
+//! Test multi-point acceleration function against single-point acceleration function, at degree/order 20, 70, 200
+BOOST_AUTO_TEST_CASE( testMultiPointSphericalHarmonicAccelerationHighDegree )
+{
+    const double gravitationalParameter = 3.986004418e14;
+    const double referenceRadius = 6378137.0;
+
+    std::vector< int > maximumDegrees = { 20, 70, 200 };
+    std::vector< int > numberOfPositions = { 4096, 1024, 256 };
+
+    for( unsigned int i = 0; i < maximumDegrees.size( ); i++ )
+    {
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        getRandomCoefficients( maximumDegrees.at( i ) + 1, maximumDegrees.at( i ) + 1,
+                               cosineCoefficients, sineCoefficients );
+        const Eigen::Matrix3Xd positions = getRandomPositions( numberOfPositions.at( i ), referenceRadius );
+
+        const Eigen::Matrix3Xd singlePointAccelerations = computeSinglePointAccelerations(
+                    positions, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients );
+        const Eigen::Matrix3Xd multiPointAccelerations = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                    positions, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                    std::make_shared< basic_mathematics::MultiPointSphericalHarmonicsCache >( ) );
+
+        BOOST_CHECK_SMALL( getMaximumRelativeDifference( multiPointAccelerations, singlePointAccelerations ), 1.0E-12 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
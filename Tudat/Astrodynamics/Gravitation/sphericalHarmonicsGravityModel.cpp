@@ -9,6 +9,7 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
@@ -127,6 +128,131 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
     return accelerationRotation * ( transformationToCartesianCoordinates * sphericalGradient );
 }
 
+//! Compute gravitational accelerations at multiple positions due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization.
+Eigen::Matrix3Xd computeGeodesyNormalizedGravitationalAccelerationSum(
+        const Eigen::Matrix3Xd& positionsOfBodiesSubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        std::shared_ptr< basic_mathematics::MultiPointSphericalHarmonicsCache > sphericalHarmonicsCache,
+        const Eigen::Matrix3d& accelerationRotation,
+        const int maximumBlockSize )
+{
+    // Set highest degree and order.
+    const int highestDegree = cosineHarmonicCoefficients.rows( );
+    const int highestOrder = std::min( cosineHarmonicCoefficients.cols( ), cosineHarmonicCoefficients.rows( ) );
+
+    if( maximumBlockSize < 1 )
+    {
+        throw std::runtime_error( "Error when computing multi-point spherical harmonic acceleration, block size must be positive" );
+    }
+
+    if( sphericalHarmonicsCache->getMaximumDegree( ) != highestDegree - 1 ||
+            sphericalHarmonicsCache->getMaximumOrder( ) != highestOrder - 1 )
+    {
+        sphericalHarmonicsCache->resetMaximumDegreeAndOrder( highestDegree - 1, highestOrder - 1 );
+    }
+
+    // Compute spherical coordinates of all positions.
+    const int numberOfPositions = positionsOfBodiesSubjectToAcceleration.cols( );
+    const Eigen::ArrayXd radii = positionsOfBodiesSubjectToAcceleration.colwise( ).norm( ).transpose( ).array( );
+    const Eigen::ArrayXd sinesOfLatitude = positionsOfBodiesSubjectToAcceleration.row( 2 ).transpose( ).array( ) / radii;
+    Eigen::ArrayXd longitudes( numberOfPositions );
+    for( int i = 0; i < numberOfPositions; i++ )
+    {
+        longitudes( i ) = std::atan2( positionsOfBodiesSubjectToAcceleration( 1, i ),
+                                      positionsOfBodiesSubjectToAcceleration( 0, i ) );
+    }
+
+    // Compute gradient premultiplier.
+    const double preMultiplier = gravitationalParameter / equatorialRadius;
+
+    Eigen::Matrix3Xd accelerations = Eigen::Matrix3Xd::Zero( 3, numberOfPositions );
+
+    // Declare per-point sums of terms, for current block.
+    Eigen::ArrayXd radialGradient, latitudeGradient, longitudeGradient;
+    Eigen::ArrayXd radialCosineSum, radialSineSum, latitudeCosineSum, latitudeSineSum, cosineSum, sineSum;
+    Eigen::ArrayXd scaledLegendrePolynomial, scaledLegendrePolynomialDerivative;
+
+    for( int blockStart = 0; blockStart < numberOfPositions; blockStart += maximumBlockSize )
+    {
+        const int blockSize = std::min( maximumBlockSize, numberOfPositions - blockStart );
+
+        sphericalHarmonicsCache->update( radii.segment( blockStart, blockSize ),
+                                         sinesOfLatitude.segment( blockStart, blockSize ),
+                                         longitudes.segment( blockStart, blockSize ),
+                                         equatorialRadius );
+
+        radialGradient.setZero( blockSize );
+        latitudeGradient.setZero( blockSize );
+        longitudeGradient.setZero( blockSize );
+
+        // Loop through all orders.
+        for( int order = 0; order < highestOrder; order++ )
+        {
+            if( order > 0 )
+            {
+                sphericalHarmonicsCache->incrementOrder( );
+            }
+
+            radialCosineSum.setZero( blockSize );
+            radialSineSum.setZero( blockSize );
+            latitudeCosineSum.setZero( blockSize );
+            latitudeSineSum.setZero( blockSize );
+            cosineSum.setZero( blockSize );
+            sineSum.setZero( blockSize );
+
+            // Sum contributions of all degrees at current order, excluding the longitude-dependent factors.
+            for( int degree = order; degree < highestDegree; degree++ )
+            {
+                const double cosineCoefficient = cosineHarmonicCoefficients( degree, order );
+                const double sineCoefficient = sineHarmonicCoefficients( degree, order );
+                const double degreePlusOne = static_cast< double >( degree ) + 1.0;
+
+                scaledLegendrePolynomial = sphericalHarmonicsCache->getReferenceRadiusRatioPowers( degree + 1 ) *
+                        sphericalHarmonicsCache->getLegendrePolynomials( degree );
+                scaledLegendrePolynomialDerivative =
+                        sphericalHarmonicsCache->getReferenceRadiusRatioPowers( degree + 1 ) *
+                        sphericalHarmonicsCache->getLegendrePolynomialDerivatives( degree );
+
+                radialCosineSum -= ( degreePlusOne * cosineCoefficient ) * scaledLegendrePolynomial;
+                radialSineSum -= ( degreePlusOne * sineCoefficient ) * scaledLegendrePolynomial;
+                latitudeCosineSum += cosineCoefficient * scaledLegendrePolynomialDerivative;
+                latitudeSineSum += sineCoefficient * scaledLegendrePolynomialDerivative;
+                cosineSum += cosineCoefficient * scaledLegendrePolynomial;
+                sineSum += sineCoefficient * scaledLegendrePolynomial;
+            }
+
+            // Add contributions of current order to potential gradient.
+            radialGradient += radialCosineSum * sphericalHarmonicsCache->getCosinesOfMultipleLongitude( order ) +
+                    radialSineSum * sphericalHarmonicsCache->getSinesOfMultipleLongitude( order );
+            latitudeGradient += latitudeCosineSum * sphericalHarmonicsCache->getCosinesOfMultipleLongitude( order ) +
+                    latitudeSineSum * sphericalHarmonicsCache->getSinesOfMultipleLongitude( order );
+            longitudeGradient += static_cast< double >( order ) * (
+                        sineSum * sphericalHarmonicsCache->getCosinesOfMultipleLongitude( order ) -
+                        cosineSum * sphericalHarmonicsCache->getSinesOfMultipleLongitude( order ) );
+        }
+
+        radialGradient *= preMultiplier / radii.segment( blockStart, blockSize );
+        latitudeGradient *= preMultiplier * sphericalHarmonicsCache->getCosinesOfLatitude( );
+        longitudeGradient *= preMultiplier;
+
+        // Convert from spherical gradient to Cartesian gradient (which equals acceleration vector).
+        for( int i = 0; i < blockSize; i++ )
+        {
+            accelerations.col( blockStart + i ) =
+                    accelerationRotation * ( coordinate_conversions::getSphericalToCartesianGradientMatrix(
+                                                 positionsOfBodiesSubjectToAcceleration.col( blockStart + i ) ) *
+                                             Eigen::Vector3d( radialGradient( i ), latitudeGradient( i ),
+                                                              longitudeGradient( i ) ) );
+        }
+    }
+
+    return accelerations;
+}
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 Eigen::Vector3d computeSingleGeodesyNormalizedGravitationalAcceleration(
         const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
@@ -26,6 +26,7 @@
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModelBase.h"
+#include "Tudat/Mathematics/BasicMathematics/multiPointSphericalHarmonics.h"
 #include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
 
 namespace tudat
@@ -93,6 +94,46 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
         const bool saveSeparateTerms = 0,
         const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) );
 
+//! Compute gravitational accelerations at multiple positions due to multiple spherical harmonics terms, defined using
+//! geodesy-normalization.
+/*!
+ * This function computes the acceleration caused by gravitational spherical harmonics, with the coefficients expressed
+ * using a geodesy-normalization, at a list of positions. The result is identical (to within numerical rounding) to that
+ * of calling the single-position computeGeodesyNormalizedGravitationalAccelerationSum function for each position
+ * separately. The positions are processed in blocks, for which the Legendre polynomials, the sines and cosines of the
+ * order times the longitude and the powers of the ratio of reference radius and distance are computed simultaneously
+ * for all points in the block (see MultiPointSphericalHarmonicsCache). The summation over the coefficients is done
+ * order by order, so that the trigonometric functions of the longitude are applied once per order, instead of once per
+ * term.
+ * \param positionsOfBodiesSubjectToAcceleration Cartesian position vectors (one per column) with respect to the
+ *          reference frame that is associated with the harmonic coefficients.
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics
+ *          [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic
+ *          coefficients. The row index indicates the degree and the column index indicates the order
+ *          of coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients.
+ *          The row index indicates the degree and the column index indicates the order of
+ *          coefficients. The matrix must be equal in size to cosineHarmonicCoefficients.
+ * \param sphericalHarmonicsCache Cache object for computing terms in spherical harmonics potential gradient calculation
+ *          for a block of points simultaneously. The maximum degree and order of the cache are reset by this function if
+ *          they are not consistent with the coefficient matrices.
+ * \param accelerationRotation Rotation from body-fixed frame (in which coefficients are defined) to inertial frame.
+ * \param maximumBlockSize Maximum number of positions for which the terms are computed simultaneously.
+ * \return Cartesian acceleration vectors (one per column, in same order as input positions) resulting from the
+ *          summation of all harmonic terms.
+ */
+Eigen::Matrix3Xd computeGeodesyNormalizedGravitationalAccelerationSum(
+        const Eigen::Matrix3Xd& positionsOfBodiesSubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        std::shared_ptr< basic_mathematics::MultiPointSphericalHarmonicsCache > sphericalHarmonicsCache,
+        const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ),
+        const int maximumBlockSize = 64 );
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 /*!
  * This function computes the acceleration caused by a single gravitational spherical harmonics
@@ -412,6 +453,35 @@ public:
         return returnVector;
    }
 
+    //! Function to compute the spherical harmonic acceleration in inertial frame at a list of positions
+    /*!
+     * Function to compute the spherical harmonic acceleration in inertial frame at a list of positions, using the current
+     * gravitational parameter, coefficients and body-fixed frame orientation (as set by the last call to updateMembers).
+     * The accelerations are computed for all positions simultaneously (see multi-point
+     * computeGeodesyNormalizedGravitationalAccelerationSum function), which is considerably faster than updating the
+     * model for each position separately. The current state of this acceleration model is not modified.
+     * \param inertialRelativePositions Position vectors (one per column) from body exerting acceleration to points at
+     * which the acceleration is to be computed, in inertial frame.
+     * \return Spherical harmonic accelerations (one per column) in inertial frame.
+     */
+    Eigen::Matrix3Xd getAccelerationsAtInertialRelativePositions( const Eigen::Matrix3Xd& inertialRelativePositions )
+    {
+        if( multiPointSphericalHarmonicsCache_ == nullptr )
+        {
+            multiPointSphericalHarmonicsCache_ =
+                    std::make_shared< basic_mathematics::MultiPointSphericalHarmonicsCache >( );
+        }
+
+        const Eigen::Matrix3d rotationToIntegrationFrame = rotationToIntegrationFrame_.toRotationMatrix( );
+        return computeGeodesyNormalizedGravitationalAccelerationSum(
+                    rotationToIntegrationFrame.transpose( ) * inertialRelativePositions,
+                    gravitationalParameter,
+                    equatorialRadius,
+                    cosineHarmonicCoefficients,
+                    sineHarmonicCoefficients, multiPointSphericalHarmonicsCache_,
+                    rotationToIntegrationFrame );
+    }
+
     //! Function to retrieve the spherical harmonics cache for this acceleration.
     /*!
      *  Function to retrieve the spherical harmonics cache for this acceleration.
@@ -602,6 +672,9 @@ private:
     //!  Spherical harmonics cache for this acceleration
     std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache_;
 
+    //!  Spherical harmonics cache for evaluating this acceleration at multiple positions simultaneously (created on first use)
+    std::shared_ptr< basic_mathematics::MultiPointSphericalHarmonicsCache > multiPointSphericalHarmonicsCache_;
+
     //! Current acceleration in inertial frame, as computed by last call to updateMembers function
     Eigen::Vector3d currentAcceleration_;
 
@@ -0,0 +1,181 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertTransferGrid.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace mission_segments;
+
+BOOST_AUTO_TEST_SUITE( test_lambert_transfer_grid )
+
+//! Test the Householder Izzo Lambert routine against the secant-based Izzo Lambert routine.
+BOOST_AUTO_TEST_CASE( testSolveLambertProblemIzzoHouseholder )
+{
+    const double gravitationalParameter = 398600.4418e9;
+
+    boost::random::mt19937 randomNumberGenerator( 42 );
+    boost::random::uniform_real_distribution< > unitDistribution( 0.0, 1.0 );
+
+    // Solve Lambert problems with random geometries and times of flight (covering elliptical and hyperbolic transfers,
+    // short- and long-way, prograde and retrograde).
+    Eigen::Vector3d positionAtDeparture, positionAtArrival;
+    Eigen::Vector3d expectedVelocityAtDeparture, expectedVelocityAtArrival, velocityAtDeparture, velocityAtArrival;
+    for( int i = 0; i < 1000; i++ )
+    {
+        for( int j = 0; j < 3; j++ )
+        {
+            positionAtDeparture( j ) = 4.0E7 * ( unitDistribution( randomNumberGenerator ) - 0.5 );
+            positionAtArrival( j ) = 4.0E7 * ( unitDistribution( randomNumberGenerator ) - 0.5 );
+        }
+        const double timeOfFlight = 600.0 + 2.0E5 * unitDistribution( randomNumberGenerator );
+        const bool isRetrograde = ( i % 2 == 1 );
+
+        solveLambertProblemIzzo( positionAtDeparture, positionAtArrival, timeOfFlight, gravitationalParameter,
+                                 expectedVelocityAtDeparture, expectedVelocityAtArrival, isRetrograde, 1.0E-14, 100 );
+        double xParameter = solveLambertProblemIzzoHouseholder(
+                    positionAtDeparture, positionAtArrival, timeOfFlight, gravitationalParameter,
+                    velocityAtDeparture, velocityAtArrival, isRetrograde );
+
+        BOOST_CHECK_SMALL( ( velocityAtDeparture - expectedVelocityAtDeparture ).norm( ) /
+                           expectedVelocityAtDeparture.norm( ), 1.0E-10 );
+        BOOST_CHECK_SMALL( ( velocityAtArrival - expectedVelocityAtArrival ).norm( ) /
+                           expectedVelocityAtArrival.norm( ), 1.0E-10 );
+
+        // Check that solution is reproduced when starting from converged x-parameter.
+        solveLambertProblemIzzoHouseholder(
+                    positionAtDeparture, positionAtArrival, timeOfFlight, gravitationalParameter,
+                    velocityAtDeparture, velocityAtArrival, isRetrograde, xParameter, 1.0E-13, 2 );
+        BOOST_CHECK_SMALL( ( velocityAtDeparture - expectedVelocityAtDeparture ).norm( ) /
+                           expectedVelocityAtDeparture.norm( ), 1.0E-10 );
+    }
+
+    // Check that invalid time of flight is rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        solveLambertProblemIzzoHouseholder( positionAtDeparture, positionAtArrival, -1.0, gravitationalParameter,
+                                            velocityAtDeparture, velocityAtArrival );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+//! Test the computation of Earth-Mars transfers on a grid of departure and arrival times.
+BOOST_AUTO_TEST_CASE( testLambertTransferGrid )
+{
+    using namespace orbital_element_conversions;
+
+    const double sunGravitationalParameter = 1.32712440018E20;
+
+    // Define (approximate) Keplerian orbits of Earth and Mars.
+    Eigen::Vector6d earthKeplerElements, marsKeplerElements;
+    earthKeplerElements << 1.0 * physical_constants::ASTRONOMICAL_UNIT, 0.0167, 0.0, 1.9933, 0.0, 0.5;
+    marsKeplerElements << 1.524 * physical_constants::ASTRONOMICAL_UNIT, 0.0934, 0.0323, 5.0004, 0.8650, 2.0;
+
+    std::function< Eigen::Vector6d( const double ) > earthStateFunction = [ & ]( const double time )
+    {
+        return convertKeplerianToCartesianElements(
+                    propagateKeplerOrbit( earthKeplerElements, time, sunGravitationalParameter ),
+                    sunGravitationalParameter );
+    };
+    std::function< Eigen::Vector6d( const double ) > marsStateFunction = [ & ]( const double time )
+    {
+        return convertKeplerianToCartesianElements(
+                    propagateKeplerOrbit( marsKeplerElements, time, sunGravitationalParameter ),
+                    sunGravitationalParameter );
+    };
+
+    // Define grid of departure and arrival times (including arrival times before departure times).
+    std::vector< double > departureTimes, arrivalTimes;
+    for( int i = 0; i < 40; i++ )
+    {
+        departureTimes.push_back( static_cast< double >( i ) * 5.0 * physical_constants::JULIAN_DAY );
+    }
+    for( int j = 0; j < 60; j++ )
+    {
+        arrivalTimes.push_back( ( 100.0 + static_cast< double >( j ) * 5.0 ) * physical_constants::JULIAN_DAY );
+    }
+
+    LambertTransferGrid transferGrid( earthStateFunction, marsStateFunction, departureTimes, arrivalTimes,
+                                      sunGravitationalParameter, 1 );
+    LambertTransferGrid parallelTransferGrid( earthStateFunction, marsStateFunction, departureTimes, arrivalTimes,
+                                              sunGravitationalParameter, 4 );
+
+    Eigen::MatrixXd departureDeltaVs = transferGrid.getDepartureDeltaVs( );
+    Eigen::MatrixXd arrivalDeltaVs = transferGrid.getArrivalDeltaVs( );
+    Eigen::MatrixXd totalDeltaVs = transferGrid.getTotalDeltaVs( );
+    BOOST_CHECK_EQUAL( departureDeltaVs.rows( ), 40 );
+    BOOST_CHECK_EQUAL( departureDeltaVs.cols( ), 60 );
+
+    Eigen::Vector3d expectedVelocityAtDeparture, expectedVelocityAtArrival;
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+        {
+            if( arrivalTimes.at( j ) <= departureTimes.at( i ) )
+            {
+                // Check that combinations without transfer are set to NaN.
+                BOOST_CHECK( departureDeltaVs( i, j ) != departureDeltaVs( i, j ) );
+                BOOST_CHECK( arrivalDeltaVs( i, j ) != arrivalDeltaVs( i, j ) );
+                BOOST_CHECK( parallelTransferGrid.getDepartureDeltaVs( )( i, j ) !=
+                             parallelTransferGrid.getDepartureDeltaVs( )( i, j ) );
+            }
+            else
+            {
+                // Compare to direct solution of single Lambert problem.
+                Eigen::Vector6d departureState = earthStateFunction( departureTimes.at( i ) );
+                Eigen::Vector6d arrivalState = marsStateFunction( arrivalTimes.at( j ) );
+                solveLambertProblemIzzo( departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ),
+                                         arrivalTimes.at( j ) - departureTimes.at( i ), sunGravitationalParameter,
+                                         expectedVelocityAtDeparture, expectedVelocityAtArrival, false, 1.0E-14, 100 );
+
+                double expectedDepartureDeltaV = ( expectedVelocityAtDeparture - departureState.segment( 3, 3 ) ).norm( );
+                double expectedArrivalDeltaV = ( expectedVelocityAtArrival - arrivalState.segment( 3, 3 ) ).norm( );
+                BOOST_CHECK_SMALL( std::fabs( departureDeltaVs( i, j ) - expectedDepartureDeltaV ), 1.0E-5 );
+                BOOST_CHECK_SMALL( std::fabs( arrivalDeltaVs( i, j ) - expectedArrivalDeltaV ), 1.0E-5 );
+                BOOST_CHECK_EQUAL( totalDeltaVs( i, j ), departureDeltaVs( i, j ) + arrivalDeltaVs( i, j ) );
+
+                // Check that results are independent of number of threads.
+                BOOST_CHECK_EQUAL( parallelTransferGrid.getDepartureDeltaVs( )( i, j ), departureDeltaVs( i, j ) );
+                BOOST_CHECK_EQUAL( parallelTransferGrid.getArrivalDeltaVs( )( i, j ), arrivalDeltaVs( i, j ) );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
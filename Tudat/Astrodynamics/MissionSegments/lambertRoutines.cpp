@@ -13,6 +13,8 @@
  *      Izzo, D. lambert_problem.h, keptoolbox.
  *      Gooding, R.H. A procedure for the solution of Lambert's orbital boundary-value problem,
  *          Celestial Mechanics and Dynamical Astronomy, 48:145-165, 1990.
+ *      Izzo, D. Revisiting Lambert's problem, Celestial Mechanics and Dynamical Astronomy,
+ *          121:1-15, 2015.
  *
  */
 
@@ -352,6 +354,218 @@ double computeTimeOfFlightIzzo( const double xParameter, const double semiPerime
 
 }
 
+//! Compute normalized time-of-flight of a zero-revolution Lambert transfer, as a function of Izzo's x-parameter.
+double computeNormalizedTimeOfFlightIzzo( const double xParameter, const double lambdaParameter )
+{
+    const double distanceToParabola = std::fabs( xParameter - 1.0 );
+
+    // Use Lagrange's equation at intermediate distance from parabolic case.
+    if( distanceToParabola < 0.2 && distanceToParabola > 0.01 )
+    {
+        const double semiMajorAxis = 1.0 / ( 1.0 - xParameter * xParameter );
+        if( semiMajorAxis > 0.0 )
+        {
+            const double alphaParameter = 2.0 * std::acos( xParameter );
+            double betaParameter = 2.0 * std::asin( std::sqrt( lambdaParameter * lambdaParameter / semiMajorAxis ) );
+            if( lambdaParameter < 0.0 )
+            {
+                betaParameter = -betaParameter;
+            }
+            return semiMajorAxis * std::sqrt( semiMajorAxis ) *
+                    ( ( alphaParameter - std::sin( alphaParameter ) ) - ( betaParameter - std::sin( betaParameter ) ) ) / 2.0;
+        }
+        else
+        {
+            const double alphaParameter = 2.0 * boost::math::acosh( xParameter );
+            double betaParameter = 2.0 * boost::math::asinh(
+                        std::sqrt( -lambdaParameter * lambdaParameter / semiMajorAxis ) );
+            if( lambdaParameter < 0.0 )
+            {
+                betaParameter = -betaParameter;
+            }
+            return -semiMajorAxis * std::sqrt( -semiMajorAxis ) *
+                    ( ( betaParameter - std::sinh( betaParameter ) ) - ( alphaParameter - std::sinh( alphaParameter ) ) ) / 2.0;
+        }
+    }
+
+    const double energyParameter = xParameter * xParameter - 1.0;
+    const double zParameter = std::sqrt( 1.0 + lambdaParameter * lambdaParameter * energyParameter );
+
+    // Use Battin's series close to parabolic case.
+    if( distanceToParabola <= 0.01 )
+    {
+        const double etaParameter = zParameter - lambdaParameter * xParameter;
+        const double hypergeometricArgument = 0.5 * ( 1.0 - lambdaParameter - xParameter * etaParameter );
+
+        // Evaluate hypergeometric function 2F1( 3, 1, 5/2, S1 ).
+        double hypergeometricSum = 1.0, hypergeometricTerm = 1.0;
+        for( int j = 0; std::fabs( hypergeometricTerm ) > 1.0E-14; j++ )
+        {
+            hypergeometricTerm *= ( 3.0 + j ) * ( 1.0 + j ) / ( 2.5 + j ) * hypergeometricArgument / ( j + 1.0 );
+            hypergeometricSum += hypergeometricTerm;
+        }
+
+        return ( etaParameter * etaParameter * etaParameter * 4.0 / 3.0 * hypergeometricSum +
+                 4.0 * lambdaParameter * etaParameter ) / 2.0;
+    }
+
+    // Use Lancaster's equation far from parabolic case.
+    const double yParameter = std::sqrt( std::fabs( energyParameter ) );
+    const double gParameter = xParameter * zParameter - lambdaParameter * energyParameter;
+    double dParameter;
+    if( energyParameter < 0.0 )
+    {
+        dParameter = std::acos( gParameter );
+    }
+    else
+    {
+        dParameter = std::log( yParameter * ( zParameter - lambdaParameter * xParameter ) + gParameter );
+    }
+    return ( xParameter - lambdaParameter * zParameter - dParameter / yParameter ) / energyParameter;
+}
+
+//! Solve Lambert Problem using Izzo's (2015) algorithm with Householder iterations.
+double solveLambertProblemIzzoHouseholder( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                           const Eigen::Vector3d& cartesianPositionAtArrival,
+                                           const double timeOfFlight,
+                                           const double gravitationalParameter,
+                                           Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                           Eigen::Vector3d& cartesianVelocityAtArrival,
+                                           const bool isRetrograde,
+                                           const double initialGuessXParameter,
+                                           const double convergenceTolerance,
+                                           const unsigned int maximumNumberOfIterations )
+{
+    // Sanity check for specified time-of-flight.
+    if ( timeOfFlight <= 0.0 )
+    {
+        throw std::runtime_error( "Specified time-of-flight must be strictly positive: " + std::to_string( timeOfFlight ) );
+    }
+
+    // Compute transfer geometry.
+    const double radiusAtDeparture = cartesianPositionAtDeparture.norm( );
+    const double radiusAtArrival = cartesianPositionAtArrival.norm( );
+    const double chord = ( cartesianPositionAtArrival - cartesianPositionAtDeparture ).norm( );
+    const double semiPerimeter = ( chord + radiusAtDeparture + radiusAtArrival ) / 2.0;
+
+    const Eigen::Vector3d radialUnitVectorAtDeparture = cartesianPositionAtDeparture / radiusAtDeparture;
+    const Eigen::Vector3d radialUnitVectorAtArrival = cartesianPositionAtArrival / radiusAtArrival;
+    const Eigen::Vector3d angularMomentumUnitVector =
+            radialUnitVectorAtDeparture.cross( radialUnitVectorAtArrival ).normalized( );
+
+    double lambdaParameter = std::sqrt( 1.0 - chord / semiPerimeter );
+    Eigen::Vector3d transverseUnitVectorAtDeparture, transverseUnitVectorAtArrival;
+
+    // Transfer angle is larger than 180 degrees as seen from above the z-axis.
+    if( angularMomentumUnitVector.z( ) < 0.0 )
+    {
+        lambdaParameter = -lambdaParameter;
+        transverseUnitVectorAtDeparture = radialUnitVectorAtDeparture.cross( angularMomentumUnitVector ).normalized( );
+        transverseUnitVectorAtArrival = radialUnitVectorAtArrival.cross( angularMomentumUnitVector ).normalized( );
+    }
+    else
+    {
+        transverseUnitVectorAtDeparture = angularMomentumUnitVector.cross( radialUnitVectorAtDeparture ).normalized( );
+        transverseUnitVectorAtArrival = angularMomentumUnitVector.cross( radialUnitVectorAtArrival ).normalized( );
+    }
+
+    if( isRetrograde )
+    {
+        lambdaParameter = -lambdaParameter;
+        transverseUnitVectorAtDeparture = -transverseUnitVectorAtDeparture;
+        transverseUnitVectorAtArrival = -transverseUnitVectorAtArrival;
+    }
+
+    const double lambdaSquared = lambdaParameter * lambdaParameter;
+    const double lambdaCubed = lambdaSquared * lambdaParameter;
+
+    // Compute normalized time-of-flight.
+    const double normalizedTimeOfFlight =
+            std::sqrt( 2.0 * gravitationalParameter / ( semiPerimeter * semiPerimeter * semiPerimeter ) ) * timeOfFlight;
+
+    // Set initial guess.
+    double xParameter = initialGuessXParameter;
+    if( !( xParameter == xParameter ) )
+    {
+        const double minimumEnergyTimeOfFlight = std::acos( lambdaParameter ) + lambdaParameter * std::sqrt( 1.0 - lambdaSquared );
+        const double parabolicTimeOfFlight = 2.0 / 3.0 * ( 1.0 - lambdaCubed );
+        if( normalizedTimeOfFlight >= minimumEnergyTimeOfFlight )
+        {
+            xParameter = -( normalizedTimeOfFlight - minimumEnergyTimeOfFlight ) /
+                    ( normalizedTimeOfFlight - minimumEnergyTimeOfFlight + 4.0 );
+        }
+        else if( normalizedTimeOfFlight <= parabolicTimeOfFlight )
+        {
+            xParameter = parabolicTimeOfFlight * ( parabolicTimeOfFlight - normalizedTimeOfFlight ) /
+                    ( 2.0 / 5.0 * ( 1.0 - lambdaSquared * lambdaCubed ) * normalizedTimeOfFlight ) + 1.0;
+        }
+        else
+        {
+            xParameter = std::pow( normalizedTimeOfFlight / minimumEnergyTimeOfFlight,
+                                   std::log( 2.0 ) / std::log( parabolicTimeOfFlight / minimumEnergyTimeOfFlight ) ) - 1.0;
+        }
+    }
+
+    // Solve time-of-flight equation using Householder iterations.
+    double currentTimeOfFlight, oneMinusXSquared, yParameter, yParameterCubed;
+    double firstDerivative, secondDerivative, thirdDerivative, timeOfFlightError, newXParameter;
+    bool isConverged = false;
+    for( unsigned int i = 0; i < maximumNumberOfIterations && !isConverged; i++ )
+    {
+        currentTimeOfFlight = computeNormalizedTimeOfFlightIzzo( xParameter, lambdaParameter );
+
+        // Compute derivatives of time-of-flight w.r.t. x-parameter.
+        oneMinusXSquared = 1.0 - xParameter * xParameter;
+        yParameter = std::sqrt( 1.0 - lambdaSquared * oneMinusXSquared );
+        yParameterCubed = yParameter * yParameter * yParameter;
+        firstDerivative = ( 3.0 * currentTimeOfFlight * xParameter - 2.0 +
+                            2.0 * lambdaCubed * xParameter / yParameter ) / oneMinusXSquared;
+        secondDerivative = ( 3.0 * currentTimeOfFlight + 5.0 * xParameter * firstDerivative +
+                             2.0 * ( 1.0 - lambdaSquared ) * lambdaCubed / yParameterCubed ) / oneMinusXSquared;
+        thirdDerivative = ( 7.0 * xParameter * secondDerivative + 8.0 * firstDerivative -
+                            6.0 * ( 1.0 - lambdaSquared ) * lambdaSquared * lambdaCubed * xParameter /
+                            ( yParameterCubed * yParameter * yParameter ) ) / oneMinusXSquared;
+
+        // Perform Householder step.
+        timeOfFlightError = currentTimeOfFlight - normalizedTimeOfFlight;
+        newXParameter = xParameter - timeOfFlightError *
+                ( firstDerivative * firstDerivative - timeOfFlightError * secondDerivative / 2.0 ) /
+                ( firstDerivative * ( firstDerivative * firstDerivative - timeOfFlightError * secondDerivative ) +
+                  thirdDerivative * timeOfFlightError * timeOfFlightError / 6.0 );
+
+        isConverged = ( std::fabs( newXParameter - xParameter ) <= convergenceTolerance );
+        xParameter = newXParameter;
+    }
+
+    if( !isConverged )
+    {
+        throw std::runtime_error( "Householder Lambert solver did not converge within the maximum number of iterations: " +
+                                  std::to_string( maximumNumberOfIterations ) );
+    }
+
+    // Reconstruct velocities at departure and arrival from radial and transverse components.
+    const double gammaParameter = std::sqrt( gravitationalParameter * semiPerimeter / 2.0 );
+    const double rhoParameter = ( radiusAtDeparture - radiusAtArrival ) / chord;
+    const double sigmaParameter = std::sqrt( 1.0 - rhoParameter * rhoParameter );
+    yParameter = std::sqrt( 1.0 - lambdaSquared + lambdaSquared * xParameter * xParameter );
+
+    const double radialVelocityAtDeparture = gammaParameter *
+            ( ( lambdaParameter * yParameter - xParameter ) - rhoParameter * ( lambdaParameter * yParameter + xParameter ) ) /
+            radiusAtDeparture;
+    const double radialVelocityAtArrival = -gammaParameter *
+            ( ( lambdaParameter * yParameter - xParameter ) + rhoParameter * ( lambdaParameter * yParameter + xParameter ) ) /
+            radiusAtArrival;
+    const double transverseVelocityFactor = gammaParameter * sigmaParameter *
+            ( yParameter + lambdaParameter * xParameter );
+
+    cartesianVelocityAtDeparture = radialVelocityAtDeparture * radialUnitVectorAtDeparture +
+            transverseVelocityFactor / radiusAtDeparture * transverseUnitVectorAtDeparture;
+    cartesianVelocityAtArrival = radialVelocityAtArrival * radialUnitVectorAtArrival +
+            transverseVelocityFactor / radiusAtArrival * transverseUnitVectorAtArrival;
+
+    return xParameter;
+}
+
 //! Solve Lambert Problem using Gooding's algorithm.
 void solveLambertProblemGooding( const Eigen::Vector3d& cartesianPositionAtDeparture,
                                  const Eigen::Vector3d& cartesianPositionAtArrival,
@@ -13,6 +13,8 @@
  *      Izzo, D. lambert_problem.h, keptoolbox.
  *      Gooding, R.H. A procedure for the solution of Lambert's orbital boundary-value problem,
  *          Celestial Mechanics and Dynamical Astronomy, 48:145-165, 1990.
+ *      Izzo, D. Revisiting Lambert's problem, Celestial Mechanics and Dynamical Astronomy,
+ *          121:1-15, 2015.
  *
  */
 
@@ -23,6 +25,7 @@
 
 #include <Eigen/Core>
 
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/Mathematics/RootFinders/newtonRaphson.h"
 #include "Tudat/Mathematics/RootFinders/rootFinder.h"
 #include "Tudat/Mathematics/RootFinders/terminationConditions.h"
@@ -83,6 +86,51 @@ double computeTimeOfFlightIzzo( const double xParameter, const double semiPerime
                                 const double chord, const bool isLongway,
                                 const double semiMajorAxisOfTheMinimumEnergyEllipse );
 
+//! Compute normalized time-of-flight of a zero-revolution Lambert transfer, as a function of Izzo's x-parameter.
+/*!
+ * Computes the normalized time-of-flight T = sqrt( 2 mu / s^3 ) t of a zero-revolution Lambert transfer as a function of
+ * the x-parameter, for a transfer geometry defined by the lambda-parameter (Izzo, 2015). Depending on the distance of x
+ * from 1, Battin's series, Lagrange's equation or Lancaster's equation is used, to prevent loss of accuracy close to
+ * the parabolic case (x = 1).
+ * \param xParameter x-parameter, x > -1 (x < 1 for ellipses, x > 1 for hyperbolas).
+ * \param lambdaParameter Lambda-parameter of the transfer geometry, in range [-1, 1].
+ * \return Normalized time-of-flight.
+ */
+double computeNormalizedTimeOfFlightIzzo( const double xParameter, const double lambdaParameter );
+
+//! Solve Lambert Problem using Izzo's (2015) algorithm with Householder iterations.
+/*!
+ * Solves the zero-revolution Lambert Problem using the algorithm of (Izzo, 2015), in which the time-of-flight equation
+ * is solved for the x-parameter by means of Householder (third-order) iterations, starting from an initial guess that
+ * is computed from the transfer geometry or provided by the user. Convergence is typically reached in 2-3 iterations,
+ * and the computational cost is much lower than that of solveLambertProblemIzzo, in particular when a good initial
+ * guess is available, such as the solution of a Lambert problem with similar departure and arrival conditions (see
+ * LambertTransferGrid). Note that, as for solveLambertProblemIzzo, the plane of motion is determined from the sign of
+ * the z-component of the cross product of the departure and arrival positions.
+ * \param cartesianPositionAtDeparture Cartesian position at departure. [Input]
+ * \param cartesianPositionAtArrival Cartesian position at arrival. [Input]
+ * \param timeOfFlight Time-of-flight between departure and arrival. [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param cartesianVelocityAtDeparture Velocity at departure. [Output]
+ * \param cartesianVelocityAtArrival Velocity at arrival. [Output]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ * \param initialGuessXParameter Initial guess for the x-parameter; if NaN, the initial guess of (Izzo, 2015) is used.
+ *          [Input, Optional]
+ * \param convergenceTolerance Convergence tolerance on the x-parameter. [Input, Optional]
+ * \param maximumNumberOfIterations Maximum number of Householder iterations. [Input, Optional]
+ * \return Converged x-parameter, which may be used as initial guess for Lambert problems with similar geometry.
+ */
+double solveLambertProblemIzzoHouseholder( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                           const Eigen::Vector3d& cartesianPositionAtArrival,
+                                           const double timeOfFlight,
+                                           const double gravitationalParameter,
+                                           Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                           Eigen::Vector3d& cartesianVelocityAtArrival,
+                                           const bool isRetrograde = false,
+                                           const double initialGuessXParameter = TUDAT_NAN,
+                                           const double convergenceTolerance = 1.0E-13,
+                                           const unsigned int maximumNumberOfIterations = 15 );
+
 //! Solve Lambert Problem using Gooding's algorithm.
 /*!
  * Solves the Lambert Problem using Lancaster and Blanchard's algorithm with further improvements
@@ -0,0 +1,111 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertTransferGrid.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Constructor, computes the transfers for all combinations of departure and arrival times.
+LambertTransferGrid::LambertTransferGrid(
+        const std::function< Eigen::Vector6d( const double ) > departureBodyStateFunction,
+        const std::function< Eigen::Vector6d( const double ) > arrivalBodyStateFunction,
+        const std::vector< double >& departureTimes,
+        const std::vector< double >& arrivalTimes,
+        const double gravitationalParameter,
+        const unsigned int numberOfThreads,
+        const bool isRetrograde ):
+    departureTimes_( departureTimes ), arrivalTimes_( arrivalTimes ),
+    gravitationalParameter_( gravitationalParameter ), isRetrograde_( isRetrograde )
+{
+    const int numberOfDepartureTimes = static_cast< int >( departureTimes_.size( ) );
+    const int numberOfArrivalTimes = static_cast< int >( arrivalTimes_.size( ) );
+
+    // Evaluate states of departure and arrival bodies once per time.
+    departureBodyStates_.resize( 6, numberOfDepartureTimes );
+    for( int i = 0; i < numberOfDepartureTimes; i++ )
+    {
+        departureBodyStates_.col( i ) = departureBodyStateFunction( departureTimes_.at( i ) );
+    }
+
+    arrivalBodyStates_.resize( 6, numberOfArrivalTimes );
+    for( int j = 0; j < numberOfArrivalTimes; j++ )
+    {
+        arrivalBodyStates_.col( j ) = arrivalBodyStateFunction( arrivalTimes_.at( j ) );
+    }
+
+    // Compute transfers, distributing departure times over threads.
+    departureDeltaVs_ = Eigen::MatrixXd::Constant( numberOfDepartureTimes, numberOfArrivalTimes, TUDAT_NAN );
+    arrivalDeltaVs_ = Eigen::MatrixXd::Constant( numberOfDepartureTimes, numberOfArrivalTimes, TUDAT_NAN );
+
+    utilities::executeParallelTasks(
+                numberOfDepartureTimes,
+                std::bind( &LambertTransferGrid::computeTransfersFromDepartureTime, this, std::placeholders::_1 ),
+                numberOfThreads );
+}
+
+//! Function to compute the transfers for all arrival times, for a single departure time.
+void LambertTransferGrid::computeTransfersFromDepartureTime( const int departureTimeIndex )
+{
+    const double departureTime = departureTimes_.at( departureTimeIndex );
+    const Eigen::Vector3d positionAtDeparture = departureBodyStates_.block( 0, departureTimeIndex, 3, 1 );
+
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    double initialGuessXParameter = TUDAT_NAN;
+    for( unsigned int j = 0; j < arrivalTimes_.size( ); j++ )
+    {
+        const double timeOfFlight = arrivalTimes_.at( j ) - departureTime;
+        if( !( timeOfFlight > 0.0 ) )
+        {
+            initialGuessXParameter = TUDAT_NAN;
+            continue;
+        }
+
+        // Solve Lambert problem, using solution for previous arrival time as initial guess. If the solver fails to
+        // converge from this initial guess, retry with the default initial guess.
+        bool isSolutionFound = false;
+        const double initialGuesses[ 2 ] = { initialGuessXParameter, TUDAT_NAN };
+        const int numberOfInitialGuesses = ( initialGuessXParameter == initialGuessXParameter ) ? 2 : 1;
+        for( int k = 0; k < numberOfInitialGuesses && !isSolutionFound; k++ )
+        {
+            try
+            {
+                initialGuessXParameter = solveLambertProblemIzzoHouseholder(
+                            positionAtDeparture, arrivalBodyStates_.block( 0, j, 3, 1 ), timeOfFlight,
+                            gravitationalParameter_, velocityAtDeparture, velocityAtArrival, isRetrograde_,
+                            initialGuesses[ k ] );
+                isSolutionFound = true;
+            }
+            catch( std::runtime_error const& ){ }
+        }
+
+        if( isSolutionFound )
+        {
+            departureDeltaVs_( departureTimeIndex, j ) =
+                    ( velocityAtDeparture - departureBodyStates_.block( 3, departureTimeIndex, 3, 1 ) ).norm( );
+            arrivalDeltaVs_( departureTimeIndex, j ) = ( velocityAtArrival - arrivalBodyStates_.block( 3, j, 3, 1 ) ).norm( );
+        }
+        else
+        {
+            initialGuessXParameter = TUDAT_NAN;
+        }
+    }
+}
+
+} // namespace mission_segments
+} // namespace tudat
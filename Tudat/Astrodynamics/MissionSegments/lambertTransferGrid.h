@@ -0,0 +1,180 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Izzo, D. Revisiting Lambert's problem, Celestial Mechanics and Dynamical Astronomy,
+ *          121:1-15, 2015.
+ *
+ */
+
+#ifndef TUDAT_LAMBERT_TRANSFER_GRID_H
+#define TUDAT_LAMBERT_TRANSFER_GRID_H
+
+#include <functional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Class to compute zero-revolution Lambert transfers on a grid of departure and arrival times.
+/*!
+ * Class to compute zero-revolution Lambert transfers between two bodies on a grid of departure and arrival times, for
+ * instance to produce porkchop plots or to search launch windows. The states of the departure and arrival bodies are
+ * evaluated once per departure/arrival time (sequentially, so that the state functions need not be thread-safe). The
+ * Lambert problems are then solved with solveLambertProblemIzzoHouseholder, distributing the departure times over a
+ * number of threads. For each departure time, the arrival times are processed in order, and the solution of the
+ * preceding arrival time is used as initial guess, which reduces the number of Householder iterations. The resulting
+ * Delta V's are stored in matrices, with the rows corresponding to the departure times and the columns to the arrival
+ * times. For combinations of departure and arrival time without valid transfer (arrival before departure, or no
+ * convergence of the Lambert solver), the Delta V's are set to NaN. The results are independent of the number of threads.
+ */
+class LambertTransferGrid
+{
+public:
+
+    //! Constructor, computes the transfers for all combinations of departure and arrival times.
+    /*!
+     * Constructor, computes the transfers for all combinations of departure and arrival times.
+     * \param departureBodyStateFunction Function returning the Cartesian state of the departure body (w.r.t. the central
+     * body) as a function of time.
+     * \param arrivalBodyStateFunction Function returning the Cartesian state of the arrival body (w.r.t. the central body)
+     * as a function of time.
+     * \param departureTimes List of departure times.
+     * \param arrivalTimes List of arrival times.
+     * \param gravitationalParameter Gravitational parameter of the central body.
+     * \param numberOfThreads Number of threads over which the departure times are distributed.
+     * \param isRetrograde Boolean flag to indicate direction of motion of the transfers.
+     */
+    LambertTransferGrid(
+            const std::function< Eigen::Vector6d( const double ) > departureBodyStateFunction,
+            const std::function< Eigen::Vector6d( const double ) > arrivalBodyStateFunction,
+            const std::vector< double >& departureTimes,
+            const std::vector< double >& arrivalTimes,
+            const double gravitationalParameter,
+            const unsigned int numberOfThreads = 1,
+            const bool isRetrograde = false );
+
+    //! Function to retrieve the Delta V's at departure.
+    /*!
+     * Function to retrieve the Delta V's at departure (norm of difference between transfer velocity and departure body
+     * velocity), with the rows corresponding to the departure times and the columns to the arrival times.
+     * \return Delta V's at departure.
+     */
+    const Eigen::MatrixXd& getDepartureDeltaVs( ) const
+    {
+        return departureDeltaVs_;
+    }
+
+    //! Function to retrieve the Delta V's at arrival.
+    /*!
+     * Function to retrieve the Delta V's at arrival (norm of difference between transfer velocity and arrival body
+     * velocity), with the rows corresponding to the departure times and the columns to the arrival times.
+     * \return Delta V's at arrival.
+     */
+    const Eigen::MatrixXd& getArrivalDeltaVs( ) const
+    {
+        return arrivalDeltaVs_;
+    }
+
+    //! Function to retrieve the total Delta V's of the transfers.
+    /*!
+     * Function to retrieve the total Delta V's of the transfers (sum of Delta V at departure and arrival), with the rows
+     * corresponding to the departure times and the columns to the arrival times.
+     * \return Total Delta V's of the transfers.
+     */
+    Eigen::MatrixXd getTotalDeltaVs( ) const
+    {
+        return departureDeltaVs_ + arrivalDeltaVs_;
+    }
+
+    //! Function to retrieve the states of the departure body at the departure times.
+    /*!
+     * Function to retrieve the states of the departure body at the departure times (one column per departure time).
+     * \return States of the departure body at the departure times.
+     */
+    const Eigen::Matrix< double, 6, Eigen::Dynamic >& getDepartureBodyStates( ) const
+    {
+        return departureBodyStates_;
+    }
+
+    //! Function to retrieve the states of the arrival body at the arrival times.
+    /*!
+     * Function to retrieve the states of the arrival body at the arrival times (one column per arrival time).
+     * \return States of the arrival body at the arrival times.
+     */
+    const Eigen::Matrix< double, 6, Eigen::Dynamic >& getArrivalBodyStates( ) const
+    {
+        return arrivalBodyStates_;
+    }
+
+    //! Function to retrieve the list of departure times.
+    /*!
+     * Function to retrieve the list of departure times.
+     * \return List of departure times.
+     */
+    std::vector< double > getDepartureTimes( ) const
+    {
+        return departureTimes_;
+    }
+
+    //! Function to retrieve the list of arrival times.
+    /*!
+     * Function to retrieve the list of arrival times.
+     * \return List of arrival times.
+     */
+    std::vector< double > getArrivalTimes( ) const
+    {
+        return arrivalTimes_;
+    }
+
+private:
+
+    //! Function to compute the transfers for all arrival times, for a single departure time.
+    /*!
+     * Function to compute the transfers for all arrival times, for a single departure time, using the solution for the
+     * preceding arrival time as initial guess.
+     * \param departureTimeIndex Index of the departure time.
+     */
+    void computeTransfersFromDepartureTime( const int departureTimeIndex );
+
+    //! List of departure times.
+    std::vector< double > departureTimes_;
+
+    //! List of arrival times.
+    std::vector< double > arrivalTimes_;
+
+    //! Gravitational parameter of the central body.
+    double gravitationalParameter_;
+
+    //! Boolean flag to indicate direction of motion of the transfers.
+    bool isRetrograde_;
+
+    //! States of the departure body at the departure times (one column per departure time).
+    Eigen::Matrix< double, 6, Eigen::Dynamic > departureBodyStates_;
+
+    //! States of the arrival body at the arrival times (one column per arrival time).
+    Eigen::Matrix< double, 6, Eigen::Dynamic > arrivalBodyStates_;
+
+    //! Delta V's at departure (rows: departure times, columns: arrival times).
+    Eigen::MatrixXd departureDeltaVs_;
+
+    //! Delta V's at arrival (rows: departure times, columns: arrival times).
+    Eigen::MatrixXd arrivalDeltaVs_;
+};
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_LAMBERT_TRANSFER_GRID_H
@@ -230,6 +230,77 @@ BOOST_AUTO_TEST_CASE( testLightWithSpice )
                                 1E-14 );
 }
 
+//! Function to compute state on circular orbit in xy-plane, used to test light-time warm start.
+Eigen::Vector6d getCircularOrbitState( const double time, const double radius, const double meanMotion,
+                                       const double phase )
+{
+    Eigen::Vector6d state;
+    const double angle = meanMotion * time + phase;
+    state << radius * std::cos( angle ), radius * std::sin( angle ), 0.0,
+            -radius * meanMotion * std::sin( angle ), radius * meanMotion * std::cos( angle ), 0.0;
+    return state;
+}
+
+//! Test warm-started light-time calculation, and associated iteration statistics.
+BOOST_AUTO_TEST_CASE( testLightTimeWarmStart )
+{
+    // Define transmitter and receiver on circular orbits, at Earth and Mars distance
+    std::function< Eigen::Vector6d( const double ) > transmitterStateFunction =
+            std::bind( &getCircularOrbitState, std::placeholders::_1, 1.496E11, 1.99E-7, 0.1 );
+    std::function< Eigen::Vector6d( const double ) > receiverStateFunction =
+            std::bind( &getCircularOrbitState, std::placeholders::_1, 2.28E11, 1.06E-7, 2.0 );
+
+    std::shared_ptr< LightTimeCalculator< > > coldStartCalculator =
+            std::make_shared< LightTimeCalculator< > >( transmitterStateFunction, receiverStateFunction );
+    std::shared_ptr< LightTimeCalculator< > > warmStartCalculator =
+            std::make_shared< LightTimeCalculator< > >( transmitterStateFunction, receiverStateFunction );
+    BOOST_CHECK_EQUAL( warmStartCalculator->getUseWarmStart( ), false );
+    warmStartCalculator->setWarmStartSettings( true );
+    BOOST_CHECK_EQUAL( warmStartCalculator->getUseWarmStart( ), true );
+
+    // Compute light times for pass with 1 s sampling, with input time at reception and transmission
+    const int numberOfObservations = 3600;
+    for( int i = 0; i < 2; i++ )
+    {
+        bool isTimeAtReception = ( i == 0 );
+        coldStartCalculator->resetIterationStatistics( );
+        warmStartCalculator->resetIterationStatistics( );
+        for( int j = 0; j < numberOfObservations; j++ )
+        {
+            double observationTime = 1.0E7 + static_cast< double >( j );
+            double coldStartLightTime = coldStartCalculator->calculateLightTime( observationTime, isTimeAtReception );
+            double warmStartLightTime = warmStartCalculator->calculateLightTime( observationTime, isTimeAtReception );
+
+            BOOST_CHECK_SMALL( warmStartLightTime - coldStartLightTime, 1.0E-11 );
+        }
+
+        // Check iteration statistics
+        BOOST_CHECK_EQUAL( coldStartCalculator->getTotalNumberOfLightTimeSolutions( ), numberOfObservations );
+        BOOST_CHECK_EQUAL( warmStartCalculator->getTotalNumberOfLightTimeSolutions( ), numberOfObservations );
+        BOOST_CHECK_EQUAL( coldStartCalculator->getTotalNumberOfStateEvaluations( ),
+                           coldStartCalculator->getTotalNumberOfIterations( ) + 2 * numberOfObservations );
+        BOOST_CHECK_EQUAL( warmStartCalculator->getTotalNumberOfStateEvaluations( ),
+                           warmStartCalculator->getTotalNumberOfIterations( ) + 2 * numberOfObservations );
+
+        // Check that, after the first few observations, the warm start converges in a minimal number of iterations.
+        BOOST_CHECK_EQUAL( warmStartCalculator->getNumberOfIterationsOfLastSolution( ), 2 );
+        BOOST_CHECK( coldStartCalculator->getNumberOfIterationsOfLastSolution( ) > 2 );
+        BOOST_CHECK( warmStartCalculator->getTotalNumberOfIterations( ) <
+                     coldStartCalculator->getTotalNumberOfIterations( ) * 2 / 3 );
+    }
+
+    // Check that warm start is not used for large gap in observation times
+    warmStartCalculator->calculateLightTime( 2.0E7, true );
+    BOOST_CHECK_EQUAL( warmStartCalculator->getNumberOfIterationsOfLastSolution( ),
+                       ( coldStartCalculator->calculateLightTime( 2.0E7, true ),
+                         coldStartCalculator->getNumberOfIterationsOfLastSolution( ) ) );
+
+    // Check that light time is identical to cold start when warm start is disabled.
+    warmStartCalculator->setWarmStartSettings( false );
+    BOOST_CHECK_EQUAL( warmStartCalculator->calculateLightTime( 2.0E7 + 1.0, true ),
+                       coldStartCalculator->calculateLightTime( 2.0E7 + 1.0, true ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,266 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+#include "Tudat/Astrodynamics/ObservationModels/linkVisibilityWindows.h"
+#include "Tudat/SimulationSetup/tudatEstimationHeader.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace observation_models;
+using namespace simulation_setup;
+using namespace orbital_element_conversions;
+
+BOOST_AUTO_TEST_SUITE( test_link_visibility_windows )
+
+//! Test whether precomputed visibility windows reproduce viability of observations computed directly from margin function.
+BOOST_AUTO_TEST_CASE( testLinkVisibilityWindows )
+{
+    // Define margin function representative of elevation angle at rotating station (rise/set once per period).
+    const double period = 86400.0;
+    const double angularFrequency = 2.0 * mathematical_constants::PI / period;
+    const double minimumElevationSine = 0.3;
+    std::function< double( const double ) > viabilityMarginFunction = [ & ]( const double time )
+    {
+        return std::sin( angularFrequency * time ) - minimumElevationSine;
+    };
+
+    const double startTime = 1.0E7, endTime = startTime + 10.0 * period;
+    const double gridTimeStep = 1800.0, boundaryTolerance = 1.0E-2;
+    LinkVisibilityWindows visibilityWindows(
+                viabilityMarginFunction, startTime, endTime, gridTimeStep, boundaryTolerance );
+
+    // Check windows w.r.t. analytical rise/set times.
+    const double riseTimeOffset = std::asin( minimumElevationSine ) / angularFrequency;
+    const double setTimeOffset = ( mathematical_constants::PI - std::asin( minimumElevationSine ) ) / angularFrequency;
+    std::vector< std::pair< double, double > > windows = visibilityWindows.getVisibilityWindows( );
+    BOOST_CHECK_EQUAL( windows.size( ), 10 );
+    for( unsigned int i = 0; i < windows.size( ); i++ )
+    {
+        double periodStartTime = std::round( ( windows.at( i ).first - riseTimeOffset ) / period ) * period;
+        BOOST_CHECK_SMALL( std::fabs( windows.at( i ).first - ( periodStartTime + riseTimeOffset - boundaryTolerance ) ),
+                           boundaryTolerance );
+        BOOST_CHECK_SMALL( std::fabs( windows.at( i ).second - ( periodStartTime + setTimeOffset + boundaryTolerance ) ),
+                           boundaryTolerance );
+    }
+
+    // Check that filtered observation times are consistent with direct evaluation of margin function (excluding times close
+    // to window boundaries).
+    std::vector< double > observationTimes;
+    for( double currentTime = startTime; currentTime <= endTime; currentTime += 60.0 )
+    {
+        observationTimes.push_back( currentTime );
+    }
+    std::vector< double > filteredObservationTimes = visibilityWindows.filterObservationTimes( observationTimes );
+
+    unsigned int filteredIndex = 0;
+    int numberOfViableTimes = 0;
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        bool isTimeFiltered = ( filteredIndex < filteredObservationTimes.size( ) &&
+                                filteredObservationTimes.at( filteredIndex ) == observationTimes.at( i ) );
+        if( isTimeFiltered )
+        {
+            filteredIndex++;
+        }
+
+        double currentMargin = viabilityMarginFunction( observationTimes.at( i ) );
+        if( std::fabs( currentMargin ) > 2.0 * boundaryTolerance * angularFrequency )
+        {
+            BOOST_CHECK_EQUAL( isTimeFiltered, ( currentMargin > 0.0 ) );
+        }
+        BOOST_CHECK_EQUAL( isTimeFiltered, visibilityWindows.isTimeInVisibilityWindow( observationTimes.at( i ) ) );
+
+        if( currentMargin > 0.0 )
+        {
+            numberOfViableTimes++;
+        }
+    }
+    BOOST_CHECK_EQUAL( filteredIndex, filteredObservationTimes.size( ) );
+    BOOST_CHECK( std::abs( static_cast< int >( filteredObservationTimes.size( ) ) - numberOfViableTimes ) <= 20 );
+
+    // Check that number of evaluations of margin function is much smaller than number of observation times
+    BOOST_CHECK( visibilityWindows.getNumberOfViabilityMarginEvaluations( ) <
+                 static_cast< int >( observationTimes.size( ) ) / 10 );
+
+    // Check that times outside of interval are not in windows
+    BOOST_CHECK( !visibilityWindows.isTimeInVisibilityWindow( startTime - period ) );
+    BOOST_CHECK( !visibilityWindows.isTimeInVisibilityWindow( endTime + period ) );
+}
+
+//! Test visibility windows for discontinuous viability, and for viability at start and end of interval.
+BOOST_AUTO_TEST_CASE( testLinkVisibilityWindowsEdgeCases )
+{
+    // Define margin that is non-viable (with margin exactly equal to zero) in two intervals.
+    std::function< double( const double ) > viabilityMarginFunction = [ ]( const double time )
+    {
+        return ( ( time > 1000.0 && time < 2500.0 ) || ( time > 7000.0 && time < 7150.0 ) ) ? 0.0 : 1.0;
+    };
+
+    LinkVisibilityWindows visibilityWindows( viabilityMarginFunction, 0.0, 10000.0, 100.0, 1.0E-3 );
+    std::vector< std::pair< double, double > > windows = visibilityWindows.getVisibilityWindows( );
+
+    BOOST_CHECK_EQUAL( windows.size( ), 3 );
+    BOOST_CHECK_CLOSE_FRACTION( windows.at( 0 ).first, -1.0E-3, std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_SMALL( std::fabs( windows.at( 0 ).second - 1000.0 ), 2.0E-3 );
+    BOOST_CHECK_SMALL( std::fabs( windows.at( 1 ).first - 2500.0 ), 2.0E-3 );
+    BOOST_CHECK_SMALL( std::fabs( windows.at( 1 ).second - 7000.0 ), 2.0E-3 );
+    BOOST_CHECK_SMALL( std::fabs( windows.at( 2 ).first - 7150.0 ), 2.0E-3 );
+    BOOST_CHECK_CLOSE_FRACTION( windows.at( 2 ).second, 10000.0 + 1.0E-3, std::numeric_limits< double >::epsilon( ) );
+
+    BOOST_CHECK( visibilityWindows.isTimeInVisibilityWindow( 0.0 ) );
+    BOOST_CHECK( !visibilityWindows.isTimeInVisibilityWindow( 1500.0 ) );
+    BOOST_CHECK( !visibilityWindows.isTimeInVisibilityWindow( 7075.0 ) );
+    BOOST_CHECK( visibilityWindows.isTimeInVisibilityWindow( 10000.0 ) );
+
+    // Check that never-viable link has no windows
+    LinkVisibilityWindows emptyVisibilityWindows( [ ]( const double ){ return -1.0; }, 0.0, 10000.0, 100.0 );
+    BOOST_CHECK_EQUAL( emptyVisibilityWindows.getVisibilityWindows( ).size( ), 0 );
+    BOOST_CHECK( !emptyVisibilityWindows.isTimeInVisibilityWindow( 500.0 ) );
+
+    // Check that invalid input is rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        LinkVisibilityWindows invalidVisibilityWindows( viabilityMarginFunction, 0.0, 10000.0, 0.0 );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+//! Test whether observations simulated with precomputed visibility windows are identical to those simulated without them,
+//! for a station link with both elevation angle and occultation viability conditions.
+BOOST_AUTO_TEST_CASE( testSimulatedObservationsWithVisibilityWindows )
+{
+    const double initialTime = 1.0E7;
+    const double finalTime = initialTime + 2.0 * physical_constants::JULIAN_DAY;
+
+    // Create rotating Earth and Moon from analytical models, with vehicle in Keplerian orbit about the Moon (occulted by the
+    // Moon once per orbit).
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+    bodySettings[ "Earth" ]->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+                "ECLIPJ2000", "IAU_Earth",
+                Eigen::Quaterniond( Eigen::AngleAxisd( 0.4, Eigen::Vector3d::UnitX( ) ) ), initialTime,
+                2.0 * mathematical_constants::PI / physical_constants::JULIAN_DAY );
+    bodySettings[ "Earth" ]->shapeModelSettings = std::make_shared< SphericalBodyShapeSettings >( 6378137.0 );
+
+    bodySettings[ "Moon" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Moon" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                ( Eigen::Vector6d( ) << 3.844E8, 0.0, 0.0, 0.0, 0.0, 0.0 ).finished( ), "SSB", "ECLIPJ2000" );
+    bodySettings[ "Moon" ]->shapeModelSettings = std::make_shared< SphericalBodyShapeSettings >( 1737.4E3 );
+
+    Eigen::Vector6d vehicleKeplerianElements;
+    vehicleKeplerianElements << 2500.0E3, 0.05, 1.0, 0.5, 0.3, 3.5;
+    bodySettings[ "Vehicle" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Vehicle" ]->ephemerisSettings = std::make_shared< KeplerEphemerisSettings >(
+                vehicleKeplerianElements, initialTime, 4.9028E12, "Moon", "ECLIPJ2000" );
+
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+    createGroundStation( bodyMap.at( "Earth" ), "Station1", ( Eigen::Vector3d( ) << 4.0E6, 2.0E6, 4.3E6 ).finished( ) );
+
+    // Create one-way range link from station to vehicle, with minimum elevation angle and occultation by the Moon.
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair( "Earth", "Station1" );
+    linkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+    std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable;
+    linkEndsPerObservable[ one_way_range ].push_back( linkEnds );
+
+    ObservationSettingsMap observationSettingsMap;
+    observationSettingsMap.insert( std::make_pair( linkEnds, std::make_shared< ObservationSettings >( one_way_range ) ) );
+    std::map< ObservableType, std::shared_ptr< ObservationSimulatorBase< double, double > > > observationSimulators =
+            createObservationSimulators( observationSettingsMap, bodyMap );
+
+    std::vector< std::shared_ptr< ObservationViabilitySettings > > observationViabilitySettings;
+    observationViabilitySettings.push_back( std::make_shared< ObservationViabilitySettings >(
+                                                minimum_elevation_angle, std::make_pair( "Earth", "" ), "",
+                                                10.0 * mathematical_constants::PI / 180.0 ) );
+    observationViabilitySettings.push_back( std::make_shared< ObservationViabilitySettings >(
+                                                body_occultation, std::make_pair( "Earth", "" ), "Moon" ) );
+    PerObservableObservationViabilityCalculatorList viabilityCalculators = createObservationViabilityCalculators(
+                bodyMap, linkEndsPerObservable, observationViabilitySettings );
+    BOOST_CHECK_EQUAL( viabilityCalculators.at( one_way_range ).at( linkEnds ).size( ), 2 );
+
+    // Simulate observations without (test 0) and with (test 1) precomputed visibility windows.
+    std::vector< double > observationTimes;
+    for( double currentTime = initialTime; currentTime < finalTime; currentTime += 60.0 )
+    {
+        observationTimes.push_back( currentTime );
+    }
+
+    std::vector< std::pair< Eigen::VectorXd, std::vector< double > > > simulatedObservationsList;
+    for( int test = 0; test < 2; test++ )
+    {
+        std::map< ObservableType, std::map< LinkEnds, std::shared_ptr< ObservationSimulationTimeSettings< double > > > >
+                observationTimeSettings;
+        observationTimeSettings[ one_way_range ][ linkEnds ] =
+                std::make_shared< TabulatedObservationSimulationTimeSettings< double > >(
+                    receiver, observationTimes, ( test == 0 ) ? TUDAT_NAN : 300.0 );
+
+        std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::VectorXd,
+                std::pair< std::vector< double >, LinkEndType > > > > simulatedObservations =
+                simulateObservations< double, double >( observationTimeSettings, observationSimulators, viabilityCalculators );
+        simulatedObservationsList.push_back(
+                    std::make_pair( simulatedObservations.at( one_way_range ).at( linkEnds ).first,
+                                    simulatedObservations.at( one_way_range ).at( linkEnds ).second.first ) );
+    }
+
+    // Check that viability conditions reject part of the observations, and that occultations reject observations for which the
+    // elevation angle is sufficient.
+    const unsigned int numberOfViableObservations = simulatedObservationsList.at( 0 ).second.size( );
+    BOOST_CHECK( numberOfViableObservations > 0 );
+    BOOST_CHECK( numberOfViableObservations < observationTimes.size( ) / 2 );
+
+    PerObservableObservationViabilityCalculatorList elevationViabilityCalculators;
+    elevationViabilityCalculators[ one_way_range ][ linkEnds ].push_back(
+                viabilityCalculators.at( one_way_range ).at( linkEnds ).at( 0 ) );
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > > observationsToSimulate;
+    observationsToSimulate[ one_way_range ][ linkEnds ] = std::make_pair( observationTimes, receiver );
+    const unsigned int numberOfElevationViableObservations = simulateObservations< double, double >(
+                createObservationSimulationTimeSettingsMap( observationsToSimulate ), observationSimulators,
+                elevationViabilityCalculators ).at( one_way_range ).at( linkEnds ).second.first.size( );
+    BOOST_CHECK( numberOfElevationViableObservations > numberOfViableObservations );
+
+    // Check that observation times and values are identical.
+    BOOST_CHECK_EQUAL( simulatedObservationsList.at( 1 ).second.size( ), numberOfViableObservations );
+    BOOST_CHECK_EQUAL( simulatedObservationsList.at( 1 ).first.rows( ), simulatedObservationsList.at( 0 ).first.rows( ) );
+    if( simulatedObservationsList.at( 1 ).second.size( ) == numberOfViableObservations )
+    {
+        for( unsigned int i = 0; i < numberOfViableObservations; i++ )
+        {
+            BOOST_CHECK_EQUAL( simulatedObservationsList.at( 1 ).second.at( i ), simulatedObservationsList.at( 0 ).second.at( i ) );
+            BOOST_CHECK_EQUAL( simulatedObservationsList.at( 1 ).first( i ), simulatedObservationsList.at( 0 ).first( i ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
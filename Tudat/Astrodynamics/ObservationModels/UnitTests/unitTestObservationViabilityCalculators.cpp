@@ -687,6 +687,10 @@ BOOST_AUTO_TEST_CASE( testObservationViabilityCalculators )
                 {
                     isSingleViabilityConditionMet = currentViabilityCalculators.at( k )->isObservationViable(
                                 linkEndStates, linkEndTimes );
+
+                    // Check consistency of viability margin (used for visibility windows) with viability check
+                    BOOST_CHECK_EQUAL( currentViabilityCalculators.at( k )->computeViabilityMargin(
+                                           linkEndStates, linkEndTimes ) > 0.0, isSingleViabilityConditionMet );
                     if( !isSingleViabilityConditionMet )
                     {
                         currentObservationIsViable = false;
@@ -249,6 +249,31 @@ BOOST_AUTO_TEST_CASE( testOneWayRangeModel )
         BOOST_CHECK_SMALL( observationDifferences.at( 5 ) - observationBiases.at( 3 )( 0 ), 1.0E-4 );
     }
 
+    // Create observation models with and without warm-started light-time iteration
+    std::shared_ptr< OneWayRangeObservationModel< double, double > > coldStartObservationModel =
+            std::dynamic_pointer_cast< OneWayRangeObservationModel< double, double > >(
+                ObservationModelCreator< 1, double, double >::createObservationModel(
+                    linkEnds, std::make_shared< ObservationSettings >(
+                        one_way_range, lightTimeCorrectionSettings ), bodyMap ) );
+    std::shared_ptr< OneWayRangeObservationModel< double, double > > warmStartObservationModel =
+            std::dynamic_pointer_cast< OneWayRangeObservationModel< double, double > >(
+                ObservationModelCreator< 1, double, double >::createObservationModel(
+                    linkEnds, std::make_shared< ObservationSettings >(
+                        one_way_range, lightTimeCorrectionSettings, nullptr,
+                        std::make_shared< LightTimeWarmStartSettings >( ) ), bodyMap ) );
+    BOOST_CHECK_EQUAL( coldStartObservationModel->getLightTimeCalculator( )->getUseWarmStart( ), false );
+    BOOST_CHECK_EQUAL( warmStartObservationModel->getLightTimeCalculator( )->getUseWarmStart( ), true );
+
+    // Check that warm start reproduces ranges to within light-time tolerance, using fewer iterations.
+    for( int i = 0; i < 100; i++ )
+    {
+        double currentObservationTime = receiverObservationTime + 10.0 * static_cast< double >( i );
+        BOOST_CHECK_SMALL( warmStartObservationModel->computeIdealObservations( currentObservationTime, receiver )( 0 ) -
+                           coldStartObservationModel->computeIdealObservations( currentObservationTime, receiver )( 0 ),
+                           1.0E-11 * physical_constants::SPEED_OF_LIGHT );
+    }
+    BOOST_CHECK( warmStartObservationModel->getLightTimeCalculator( )->getTotalNumberOfIterations( ) <
+                 coldStartObservationModel->getLightTimeCalculator( )->getTotalNumberOfIterations( ) );
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <boost/make_shared.hpp>
+#include <deque>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -180,7 +181,15 @@ public:
         stateFunctionOfReceivingBody_( positionFunctionOfReceivingBody ),
         correctionFunctions_( correctionFunctions ),
         iterateCorrections_( iterateCorrections ),
-        currentCorrection_( 0.0 ){ }
+        currentCorrection_( 0.0 ),
+        useWarmStart_( false ),
+        warmStartExtrapolationOrder_( 2 ),
+        maximumWarmStartTimeInterval_( 600.0 ),
+        previousSolutionsAreAtReception_( true ),
+        numberOfIterationsOfLastSolution_( 0 ),
+        totalNumberOfIterations_( 0 ),
+        totalNumberOfLightTimeSolutions_( 0 ),
+        totalNumberOfStateEvaluations_( 0 ){ }
 
     //! Class constructor.
     /*!
@@ -199,7 +208,15 @@ public:
         stateFunctionOfTransmittingBody_( positionFunctionOfTransmittingBody ),
         stateFunctionOfReceivingBody_( positionFunctionOfReceivingBody ),
         iterateCorrections_( iterateCorrections ),
-        currentCorrection_( 0.0 )
+        currentCorrection_( 0.0 ),
+        useWarmStart_( false ),
+        warmStartExtrapolationOrder_( 2 ),
+        maximumWarmStartTimeInterval_( 600.0 ),
+        previousSolutionsAreAtReception_( true ),
+        numberOfIterationsOfLastSolution_( 0 ),
+        totalNumberOfIterations_( 0 ),
+        totalNumberOfLightTimeSolutions_( 0 ),
+        totalNumberOfStateEvaluations_( 0 )
     {
         for( unsigned int i = 0; i < correctionFunctions.size( ); i++ )
         {
@@ -281,12 +298,15 @@ public:
             const ObservationScalarType tolerance =
             ( getDefaultLightTimeTolerance< ObservationScalarType >( ) ) )
     {
-        // Initialize reception and transmission times and states to initial guess (zero light time)
-        TimeType receptionTime = time;
-        TimeType transmissionTime = time;
+        // Initialize reception and transmission times and states to initial guess (zero light time, or extrapolated
+        // previous solutions if warm start is used)
+        ObservationScalarType initialLightTimeGuess = getInitialLightTimeGuess( time, isTimeAtReception );
+        TimeType receptionTime = isTimeAtReception ? time : time + initialLightTimeGuess;
+        TimeType transmissionTime = isTimeAtReception ? time - initialLightTimeGuess : time;
         StateType receiverState = stateFunctionOfReceivingBody_( receptionTime );
         StateType transmitterState =
                 stateFunctionOfTransmittingBody_( transmissionTime );
+        totalNumberOfStateEvaluations_ += 2;
 
         // Set initial light-time correction.
         setTotalLightTimeCorrection(
@@ -333,6 +353,7 @@ public:
                 transmissionTime = time;
                 receiverState = ( stateFunctionOfReceivingBody_( receptionTime ) );
             }
+            totalNumberOfStateEvaluations_++;
             newLightTimeCalculation = calculateNewLightTimeEstime( receiverState, transmitterState );
 
             // Check for convergence.
@@ -373,6 +394,15 @@ public:
             counter++;
         }
 
+        // Update iteration statistics and list of previous solutions.
+        numberOfIterationsOfLastSolution_ = counter;
+        totalNumberOfIterations_ += counter;
+        totalNumberOfLightTimeSolutions_++;
+        if( useWarmStart_ )
+        {
+            addPreviousLightTimeSolution( time, isTimeAtReception, newLightTimeCalculation );
+        }
+
         // Set output variables and return the light time.
         receiverStateOutput = receiverState;
         transmitterStateOutput = transmitterState;
@@ -380,6 +410,101 @@ public:
         return newLightTimeCalculation;
     }
 
+    //! Function to set whether the light-time iteration is warm-started from previous solutions.
+    /*!
+     *  Function to set whether the light-time iteration is warm-started from previous solutions. If warm start is used,
+     *  the initial light-time guess is obtained by polynomial (Lagrange) extrapolation of the most recent light-time
+     *  solutions (as a function of input time), instead of using a zero light time. For densely sampled observations,
+     *  this reduces the number of iterations (and therefore the number of link end state evaluations) per solution.
+     *  The previous solutions are only used if they were computed with the same reference link end (reception or
+     *  transmission), and the input time is within the given interval of the most recent solution; otherwise the
+     *  iteration is started from a zero light time, and the list of previous solutions is restarted.
+     *  Note that, when using a warm start, the light time is converged from a different initial guess, so that the
+     *  result may differ from the result without warm start at the level of the convergence tolerance, and depends on
+     *  the order in which light times are computed.
+     *  \param useWarmStart Boolean denoting whether warm start is to be used.
+     *  \param extrapolationOrder Order of polynomial used to extrapolate previous solutions (0 is use most recent
+     *  solution directly), uses the extrapolationOrder + 1 most recent solutions.
+     *  \param maximumTimeInterval Maximum difference between input time and time of most recent solution for which
+     *  warm start is used.
+     */
+    void setWarmStartSettings( const bool useWarmStart,
+                               const int extrapolationOrder = 2,
+                               const double maximumTimeInterval = 600.0 )
+    {
+        if( extrapolationOrder < 0 )
+        {
+            throw std::runtime_error( "Error when setting light-time warm start, extrapolation order must be positive, is " +
+                                      std::to_string( extrapolationOrder ) );
+        }
+
+        useWarmStart_ = useWarmStart;
+        warmStartExtrapolationOrder_ = extrapolationOrder;
+        maximumWarmStartTimeInterval_ = maximumTimeInterval;
+        previousLightTimeSolutions_.clear( );
+    }
+
+    //! Function to retrieve whether the light-time iteration is warm-started from previous solutions.
+    /*!
+     *  Function to retrieve whether the light-time iteration is warm-started from previous solutions.
+     *  \return Boolean denoting whether warm start is used.
+     */
+    bool getUseWarmStart( )
+    {
+        return useWarmStart_;
+    }
+
+    //! Function to retrieve the number of iterations used for the most recent light-time solution.
+    /*!
+     *  Function to retrieve the number of iterations used for the most recent light-time solution. Each iteration
+     *  requires a single evaluation of the state function of the link end at which the time is not fixed.
+     *  \return Number of iterations used for the most recent light-time solution.
+     */
+    int getNumberOfIterationsOfLastSolution( )
+    {
+        return numberOfIterationsOfLastSolution_;
+    }
+
+    //! Function to retrieve the total number of iterations used since creation (or last reset of statistics).
+    /*!
+     *  Function to retrieve the total number of iterations used since creation (or last reset of statistics).
+     *  \return Total number of iterations used since creation (or last reset of statistics).
+     */
+    int getTotalNumberOfIterations( )
+    {
+        return totalNumberOfIterations_;
+    }
+
+    //! Function to retrieve the total number of light-time solutions since creation (or last reset of statistics).
+    /*!
+     *  Function to retrieve the total number of light-time solutions since creation (or last reset of statistics).
+     *  \return Total number of light-time solutions since creation (or last reset of statistics).
+     */
+    int getTotalNumberOfLightTimeSolutions( )
+    {
+        return totalNumberOfLightTimeSolutions_;
+    }
+
+    //! Function to retrieve the total number of link end state evaluations since creation (or last reset of statistics).
+    /*!
+     *  Function to retrieve the total number of link end state (i.e. ephemeris) evaluations performed in the light-time
+     *  solution since creation (or last reset of statistics).
+     *  \return Total number of link end state evaluations since creation (or last reset of statistics).
+     */
+    int getTotalNumberOfStateEvaluations( )
+    {
+        return totalNumberOfStateEvaluations_;
+    }
+
+    //! Function to reset the iteration statistics of the light-time solution.
+    void resetIterationStatistics( )
+    {
+        numberOfIterationsOfLastSolution_ = 0;
+        totalNumberOfIterations_ = 0;
+        totalNumberOfLightTimeSolutions_ = 0;
+        totalNumberOfStateEvaluations_ = 0;
+    }
+
     //! Function to get the part wrt linkend position
     /*!
      *  Function to get the part wrt linkend position
@@ -453,6 +578,116 @@ protected:
     //! Current light-time correction.
     double currentCorrection_;
 
+    //! Boolean denoting whether the light-time iteration is warm-started from previous solutions.
+    bool useWarmStart_;
+
+    //! Order of polynomial used to extrapolate previous solutions when using warm start.
+    int warmStartExtrapolationOrder_;
+
+    //! Maximum difference between input time and time of most recent solution for which warm start is used.
+    double maximumWarmStartTimeInterval_;
+
+    //! List of most recent light-time solutions (input time and light time), in order of computation.
+    std::deque< std::pair< TimeType, ObservationScalarType > > previousLightTimeSolutions_;
+
+    //! Boolean denoting whether the input times of previousLightTimeSolutions_ are at reception (or transmission)
+    bool previousSolutionsAreAtReception_;
+
+    //! Number of iterations used for the most recent light-time solution.
+    int numberOfIterationsOfLastSolution_;
+
+    //! Total number of iterations used since creation (or last reset of statistics).
+    int totalNumberOfIterations_;
+
+    //! Total number of light-time solutions since creation (or last reset of statistics).
+    int totalNumberOfLightTimeSolutions_;
+
+    //! Total number of link end state evaluations since creation (or last reset of statistics).
+    int totalNumberOfStateEvaluations_;
+
+    //! Function to compute the initial guess of the light time for the iterative solution.
+    /*!
+     *  Function to compute the initial guess of the light time for the iterative solution. If warm start is not used,
+     *  or no suitable previous solutions are available, zero is returned. Otherwise, the previous solutions are
+     *  extrapolated to the current time using a Lagrange polynomial.
+     *  \param time Time at reception or transmission.
+     *  \param isTimeAtReception True if input time is at reception, false if at transmission.
+     *  \return Initial guess of the light time.
+     */
+    ObservationScalarType getInitialLightTimeGuess( const TimeType time, const bool isTimeAtReception )
+    {
+        ObservationScalarType initialLightTimeGuess = mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 );
+        if( useWarmStart_ && previousLightTimeSolutions_.size( ) > 0 )
+        {
+            if( ( previousSolutionsAreAtReception_ != isTimeAtReception ) ||
+                    !( std::fabs( static_cast< double >( time - previousLightTimeSolutions_.back( ).first ) ) <=
+                       maximumWarmStartTimeInterval_ ) )
+            {
+                previousLightTimeSolutions_.clear( );
+            }
+            else
+            {
+                // Extrapolate previous solutions using Lagrange polynomial
+                for( unsigned int i = 0; i < previousLightTimeSolutions_.size( ); i++ )
+                {
+                    ObservationScalarType basisPolynomialValue =
+                            mathematical_constants::getFloatingInteger< ObservationScalarType >( 1 );
+                    for( unsigned int j = 0; j < previousLightTimeSolutions_.size( ); j++ )
+                    {
+                        if( i != j )
+                        {
+                            basisPolynomialValue *=
+                                    static_cast< ObservationScalarType >( time - previousLightTimeSolutions_.at( j ).first ) /
+                                    static_cast< ObservationScalarType >(
+                                        previousLightTimeSolutions_.at( i ).first - previousLightTimeSolutions_.at( j ).first );
+                        }
+                    }
+                    initialLightTimeGuess += basisPolynomialValue * previousLightTimeSolutions_.at( i ).second;
+                }
+            }
+        }
+        return initialLightTimeGuess;
+    }
+
+    //! Function to add a light-time solution to the list of previous solutions used for warm start.
+    /*!
+     *  Function to add a light-time solution to the list of previous solutions used for warm start. If the list
+     *  already contains a solution at the same time, this solution is replaced. Only the warmStartExtrapolationOrder_ + 1
+     *  most recent solutions are retained.
+     *  \param time Time at reception or transmission.
+     *  \param isTimeAtReception True if input time is at reception, false if at transmission.
+     *  \param lightTime Light time solution at given time.
+     */
+    void addPreviousLightTimeSolution( const TimeType time, const bool isTimeAtReception,
+                                       const ObservationScalarType lightTime )
+    {
+        if( previousSolutionsAreAtReception_ != isTimeAtReception )
+        {
+            previousLightTimeSolutions_.clear( );
+            previousSolutionsAreAtReception_ = isTimeAtReception;
+        }
+
+        // Remove any solution at same time, to prevent singular extrapolation polynomial
+        for( typename std::deque< std::pair< TimeType, ObservationScalarType > >::iterator solutionIterator =
+             previousLightTimeSolutions_.begin( ); solutionIterator != previousLightTimeSolutions_.end( ); )
+        {
+            if( solutionIterator->first == time )
+            {
+                solutionIterator = previousLightTimeSolutions_.erase( solutionIterator );
+            }
+            else
+            {
+                solutionIterator++;
+            }
+        }
+
+        previousLightTimeSolutions_.push_back( std::make_pair( time, lightTime ) );
+        while( static_cast< int >( previousLightTimeSolutions_.size( ) ) > warmStartExtrapolationOrder_ + 1 )
+        {
+            previousLightTimeSolutions_.pop_front( );
+        }
+    }
+
     //! Function to calculate a new light-time estimate from the link-ends states.
     /*!
      *  Function to calculate a new light-time estimate from the states of the two ends of the
@@ -0,0 +1,160 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Tudat/Mathematics/BasicMathematics/functionProxy.h"
+#include "Tudat/Mathematics/RootFinders/bisection.h"
+
+#include "Tudat/Astrodynamics/ObservationModels/linkVisibilityWindows.h"
+
+namespace tudat
+{
+
+namespace observation_models
+{
+
+//! Constructor
+LinkVisibilityWindows::LinkVisibilityWindows(
+        const std::function< double( const double ) > viabilityMarginFunction,
+        const double startTime,
+        const double endTime,
+        const double gridTimeStep,
+        const double boundaryTolerance ):
+    boundaryTolerance_( boundaryTolerance ), numberOfViabilityMarginEvaluations_( 0 )
+{
+    if( !( gridTimeStep > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when computing link visibility windows, grid time step must be positive" );
+    }
+
+    if( !( boundaryTolerance_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when computing link visibility windows, boundary tolerance must be positive" );
+    }
+
+    if( endTime < startTime )
+    {
+        throw std::runtime_error( "Error when computing link visibility windows, end time is before start time" );
+    }
+
+    // Function to check viability at given time, counting the number of margin evaluations.
+    std::function< bool( const double ) > isObservationViableAtTime = [ & ]( const double time )
+    {
+        numberOfViabilityMarginEvaluations_++;
+        return ( viabilityMarginFunction( time ) > 0.0 );
+    };
+
+    // Evaluate viability on grid, and find window boundaries between grid points at which viability changes.
+    const int numberOfGridIntervals = static_cast< int >( std::ceil( ( endTime - startTime ) / gridTimeStep ) );
+
+    double previousGridTime = startTime;
+    bool isPreviousGridTimeViable = isObservationViableAtTime( startTime );
+    double currentWindowStartTime = startTime;
+
+    double currentGridTime;
+    bool isCurrentGridTimeViable;
+    for( int i = 1; i <= numberOfGridIntervals; i++ )
+    {
+        currentGridTime = ( i == numberOfGridIntervals ) ? endTime : ( startTime + static_cast< double >( i ) * gridTimeStep );
+        isCurrentGridTimeViable = isObservationViableAtTime( currentGridTime );
+
+        if( isCurrentGridTimeViable != isPreviousGridTimeViable )
+        {
+            double windowBoundary = findWindowBoundary( isObservationViableAtTime, previousGridTime, currentGridTime );
+            if( isCurrentGridTimeViable )
+            {
+                currentWindowStartTime = windowBoundary;
+            }
+            else
+            {
+                addVisibilityWindow( currentWindowStartTime, windowBoundary );
+            }
+        }
+
+        previousGridTime = currentGridTime;
+        isPreviousGridTimeViable = isCurrentGridTimeViable;
+    }
+
+    // Close window that is open at end of interval.
+    if( isPreviousGridTimeViable )
+    {
+        addVisibilityWindow( currentWindowStartTime, endTime );
+    }
+}
+
+//! Function to check whether a given time is inside one of the visibility windows.
+bool LinkVisibilityWindows::isTimeInVisibilityWindow( const double time ) const
+{
+    // Find first window starting after requested time; requested time can only be in window preceding it.
+    std::vector< double >::const_iterator nextWindowIterator =
+            std::upper_bound( windowStartTimes_.begin( ), windowStartTimes_.end( ), time );
+    if( nextWindowIterator == windowStartTimes_.begin( ) )
+    {
+        return false;
+    }
+
+    return ( time <= windowEndTimes_.at( std::distance( windowStartTimes_.begin( ), nextWindowIterator ) - 1 ) );
+}
+
+//! Function to retrieve the list of visibility windows.
+std::vector< std::pair< double, double > > LinkVisibilityWindows::getVisibilityWindows( ) const
+{
+    std::vector< std::pair< double, double > > visibilityWindows;
+    for( unsigned int i = 0; i < windowStartTimes_.size( ); i++ )
+    {
+        visibilityWindows.push_back( std::make_pair( windowStartTimes_.at( i ), windowEndTimes_.at( i ) ) );
+    }
+    return visibilityWindows;
+}
+
+//! Function to find the boundary of a visibility window between two times at which the viability differs.
+double LinkVisibilityWindows::findWindowBoundary(
+        const std::function< bool( const double ) >& isObservationViableAtTime,
+        const double lowerBoundTime,
+        const double upperBoundTime )
+{
+    // Only sign of margin is used, so that a margin of exactly zero (non-viable) is handled consistently.
+    std::function< double( const double ) > rootFunction = [ & ]( const double time )
+    {
+        return isObservationViableAtTime( time ) ? 1.0 : -1.0;
+    };
+
+    root_finders::Bisection::TerminationFunction terminationConditionFunction =
+            std::bind( &root_finders::termination_conditions::RootAbsoluteToleranceTerminationCondition< double >::
+                       checkTerminationCondition,
+                       std::make_shared< root_finders::termination_conditions::
+                       RootAbsoluteToleranceTerminationCondition< double > >( boundaryTolerance_ ),
+                       std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
+                       std::placeholders::_5 );
+    root_finders::Bisection bisection( terminationConditionFunction, lowerBoundTime, upperBoundTime );
+
+    return bisection.execute( std::make_shared< basic_mathematics::FunctionProxy< double, double > >( rootFunction ) );
+}
+
+//! Function to add a visibility window to the list, padded by the boundary tolerance.
+void LinkVisibilityWindows::addVisibilityWindow( const double windowStartTime, const double windowEndTime )
+{
+    if( windowEndTimes_.size( ) > 0 && windowStartTime - boundaryTolerance_ <= windowEndTimes_.back( ) )
+    {
+        windowEndTimes_.back( ) = windowEndTime + boundaryTolerance_;
+    }
+    else
+    {
+        windowStartTimes_.push_back( windowStartTime - boundaryTolerance_ );
+        windowEndTimes_.push_back( windowEndTime + boundaryTolerance_ );
+    }
+}
+
+} // namespace observation_models
+
+} // namespace tudat
@@ -0,0 +1,205 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_LINKVISIBILITYWINDOWS_H
+#define TUDAT_LINKVISIBILITYWINDOWS_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Tudat/Astrodynamics/ObservationModels/observationModel.h"
+#include "Tudat/Astrodynamics/ObservationModels/observationViabilityCalculator.h"
+
+namespace tudat
+{
+
+namespace observation_models
+{
+
+//! Class to compute and store the time windows in which observations of a single link are viable.
+/*!
+ *  Class to compute and store the time windows in which observations of a single link are viable, from a function that
+ *  returns the viability margin of an observation (positive if viable, see
+ *  ObservationViabilityCalculator::computeViabilityMargin) as a function of observation time. The margin is evaluated on a
+ *  coarse grid, and the boundaries of the windows (e.g. rise/set times, start/end of occultation) are found by a bisection root
+ *  finder between each pair of subsequent grid points at which the viability differs. Subsequently, the viability at any time
+ *  is obtained by a lookup in the list of windows, which is much less expensive than the evaluation of the observation and
+ *  viability calculators. NOTE: windows in which observations are (not) viable, that are shorter than the grid time step,
+ *  may be missed by this approach. Windows are padded by the boundary tolerance, so that observations close to a window
+ *  boundary are not incorrectly rejected.
+ */
+class LinkVisibilityWindows
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, computes the visibility windows from the viability margin function.
+     *  \param viabilityMarginFunction Function returning the margin by which an observation is viable (positive if viable) as a
+     *  function of observation time.
+     *  \param startTime Start time of the interval in which the visibility windows are to be computed.
+     *  \param endTime End time of the interval in which the visibility windows are to be computed.
+     *  \param gridTimeStep Time step of the grid on which the viability margin is evaluated to detect window boundaries.
+     *  \param boundaryTolerance Tolerance in the times of the window boundaries (windows are padded by this value).
+     */
+    LinkVisibilityWindows(
+            const std::function< double( const double ) > viabilityMarginFunction,
+            const double startTime,
+            const double endTime,
+            const double gridTimeStep,
+            const double boundaryTolerance = 1.0E-3 );
+
+    //! Destructor
+    ~LinkVisibilityWindows( ){ }
+
+    //! Function to check whether a given time is inside one of the visibility windows.
+    /*!
+     *  Function to check whether a given time is inside one of the (padded) visibility windows, by a binary search in the list
+     *  of windows.
+     *  \param time Time that is to be checked.
+     *  \return True if the time is inside a visibility window, false if not.
+     */
+    bool isTimeInVisibilityWindow( const double time ) const;
+
+    //! Function to retrieve the observation times that are inside one of the visibility windows.
+    /*!
+     *  Function to retrieve the observation times that are inside one of the visibility windows, retaining their order.
+     *  \param observationTimes Observation times that are to be filtered.
+     *  \return Observation times inside one of the visibility windows.
+     */
+    template< typename TimeType >
+    std::vector< TimeType > filterObservationTimes( const std::vector< TimeType >& observationTimes ) const
+    {
+        std::vector< TimeType > filteredObservationTimes;
+        for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+        {
+            if( isTimeInVisibilityWindow( static_cast< double >( observationTimes.at( i ) ) ) )
+            {
+                filteredObservationTimes.push_back( observationTimes.at( i ) );
+            }
+        }
+        return filteredObservationTimes;
+    }
+
+    //! Function to retrieve the list of visibility windows.
+    /*!
+     *  Function to retrieve the list of (padded) visibility windows, as pairs of start and end time, sorted in time.
+     *  \return List of visibility windows.
+     */
+    std::vector< std::pair< double, double > > getVisibilityWindows( ) const;
+
+    //! Function to retrieve the number of evaluations of the viability margin function used to compute the windows.
+    /*!
+     *  Function to retrieve the number of evaluations of the viability margin function used to compute the windows.
+     *  \return Number of evaluations of the viability margin function.
+     */
+    int getNumberOfViabilityMarginEvaluations( ) const
+    {
+        return numberOfViabilityMarginEvaluations_;
+    }
+
+private:
+
+    //! Function to find the boundary of a visibility window between two times at which the viability differs.
+    /*!
+     *  Function to find the boundary of a visibility window between two times at which the viability differs, using a
+     *  bisection root finder.
+     *  \param isObservationViableAtTime Function returning whether an observation is viable as a function of observation time.
+     *  \param lowerBoundTime Lower bound of the time interval containing the boundary.
+     *  \param upperBoundTime Upper bound of the time interval containing the boundary.
+     *  \return Time of the window boundary.
+     */
+    double findWindowBoundary( const std::function< bool( const double ) >& isObservationViableAtTime,
+                               const double lowerBoundTime,
+                               const double upperBoundTime );
+
+    //! Function to add a visibility window to the list, padded by the boundary tolerance.
+    /*!
+     *  Function to add a visibility window to the list, padded by the boundary tolerance. If the padded window overlaps with the
+     *  previous window, the two are merged.
+     *  \param windowStartTime Start time of the window.
+     *  \param windowEndTime End time of the window.
+     */
+    void addVisibilityWindow( const double windowStartTime, const double windowEndTime );
+
+    //! Start times of the (padded) visibility windows, sorted in time.
+    std::vector< double > windowStartTimes_;
+
+    //! End times of the (padded) visibility windows, sorted in time.
+    std::vector< double > windowEndTimes_;
+
+    //! Tolerance in the times of the window boundaries (windows are padded by this value).
+    double boundaryTolerance_;
+
+    //! Number of evaluations of the viability margin function used to compute the windows.
+    int numberOfViabilityMarginEvaluations_;
+};
+
+//! Function to compute the margin by which an observation of a given link is viable at a given time
+/*!
+ *  Function to compute the margin by which an observation of a given link is viable at a given time, by computing the
+ *  observation (and associated link end times and states) and evaluating the margin of the viability calculators.
+ *  \param observationTime Time at which observation is to be evaluated
+ *  \param observationModel Model used to compute observable
+ *  \param linkEndAssociatedWithTime Reference link end for observable
+ *  \param linkViabilityCalculators List of observation viability calculators for the link.
+ *  \return Margin by which observation is viable (positive if viable).
+ */
+template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
+double computeLinkObservationViabilityMargin(
+        const double observationTime,
+        const std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const LinkEndType linkEndAssociatedWithTime,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& linkViabilityCalculators )
+{
+    std::vector< Eigen::Vector6d > vectorOfStates;
+    std::vector< double > vectorOfTimes;
+
+    observationModel->computeObservationsWithLinkEndData(
+                TimeType( observationTime ), linkEndAssociatedWithTime, vectorOfTimes, vectorOfStates );
+
+    return computeObservationViabilityMargin( vectorOfStates, vectorOfTimes, linkViabilityCalculators );
+}
+
+//! Function to create the visibility windows of a given link from its observation model and viability calculators.
+/*!
+ *  Function to create the visibility windows of a given link from its observation model and viability calculators
+ *  (see LinkVisibilityWindows).
+ *  \param observationModel Model used to compute observable
+ *  \param linkEndAssociatedWithTime Reference link end for observable
+ *  \param linkViabilityCalculators List of observation viability calculators for the link.
+ *  \param startTime Start time of the interval in which the visibility windows are to be computed.
+ *  \param endTime End time of the interval in which the visibility windows are to be computed.
+ *  \param gridTimeStep Time step of the grid on which the viability margin is evaluated to detect window boundaries.
+ *  \param boundaryTolerance Tolerance in the times of the window boundaries (windows are padded by this value).
+ *  \return Visibility windows of the link.
+ */
+template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< LinkVisibilityWindows > createLinkVisibilityWindows(
+        const std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const LinkEndType linkEndAssociatedWithTime,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& linkViabilityCalculators,
+        const double startTime,
+        const double endTime,
+        const double gridTimeStep,
+        const double boundaryTolerance = 1.0E-3 )
+{
+    return std::make_shared< LinkVisibilityWindows >(
+                std::bind( &computeLinkObservationViabilityMargin< ObservationSize, ObservationScalarType, TimeType >,
+                           std::placeholders::_1, observationModel, linkEndAssociatedWithTime, linkViabilityCalculators ),
+                startTime, endTime, gridTimeStep, boundaryTolerance );
+}
+
+} // namespace observation_models
+
+} // namespace tudat
+
+#endif // TUDAT_LINKVISIBILITYWINDOWS_H
@@ -350,11 +350,22 @@ protected:
         // Perform updates of dependent variables used by (subset of) observation partials.
         updatePartials( states, times, linkEnds, linkEndAssociatedWithTime, currentObservation );
 
-        currentLinkEndPartials = observationPartials_[ linkEnds ];
+        // Retrieve partials of current link ends (no member variable is modified, so that observations of different
+        // link ends may be processed concurrently).
+        typename std::map< LinkEnds, std::map< std::pair< int, int >, std::shared_ptr<
+                observation_partials::ObservationPartial< ObservationSize > > > >::const_iterator linkEndPartialIterator =
+                observationPartials_.find( linkEnds );
+        if( linkEndPartialIterator == observationPartials_.end( ) )
+        {
+            return partialMatrix;
+        }
+        const std::map< std::pair< int, int >, std::shared_ptr<
+                observation_partials::ObservationPartial< ObservationSize > > >& currentLinkEndPartials =
+                linkEndPartialIterator->second;
 
         // Iterate over all observation partials associated with given link ends.
         for( typename std::map< std::pair< int, int >, std::shared_ptr<
-             observation_partials::ObservationPartial< ObservationSize > > >::iterator
+             observation_partials::ObservationPartial< ObservationSize > > >::const_iterator
              partialIterator = currentLinkEndPartials.begin( );
              partialIterator != currentLinkEndPartials.end( ); partialIterator++ )
         {
@@ -415,10 +426,6 @@ protected:
     std::map< LinkEnds, std::map< std::pair< int, int >, std::shared_ptr<
     observation_partials::ObservationPartial< ObservationSize > > > > observationPartials_;
 
-    //! Pre-declared map used in computation of partials.
-    std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >
-    currentLinkEndPartials;
-
 };
 
 extern template class ObservationManagerBase< double, double >;
@@ -8,6 +8,9 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+#include <cmath>
+
 #include "Tudat/Astrodynamics/ObservationModels/observationViabilityCalculator.h"
 
 namespace tudat
@@ -50,6 +53,28 @@ bool isObservationViable(
     return isObservationFeasible;
 }
 
+//! Function to compute the margin by which an observation is viable for a list of viability calculators
+double computeObservationViabilityMargin(
+        const std::vector< Eigen::Vector6d >& states, const std::vector< double >& times,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators )
+{
+    double viabilityMargin = 1.0;
+    for( unsigned int i = 0; i < viabilityCalculators.size( ); i++ )
+    {
+        if( i == 0 )
+        {
+            viabilityMargin = viabilityCalculators.at( i )->computeViabilityMargin( states, times );
+        }
+        else
+        {
+            viabilityMargin = std::min(
+                        viabilityMargin, viabilityCalculators.at( i )->computeViabilityMargin( states, times ) );
+        }
+    }
+
+    return viabilityMargin;
+}
+
 //! Function for determining whether the elevation angle at station is sufficient to allow observation
 bool MinimumElevationAngleCalculator::isObservationViable(
         const std::vector< Eigen::Vector6d >& linkEndStates,
@@ -73,6 +98,26 @@ bool MinimumElevationAngleCalculator::isObservationViable(
     return isObservationPossible;
 }
 
+//! Function to compute the margin by which the elevation angle at station allows observation.
+double MinimumElevationAngleCalculator::computeViabilityMargin(
+        const std::vector< Eigen::Vector6d >& linkEndStates,
+        const std::vector< double >& linkEndTimes )
+{
+    double viabilityMargin = 1.0;
+    double currentElevationMargin;
+
+    // Iterate over all sets of entries of input vector for which elvation angle is to be checked.
+    for( unsigned int i = 0; i < linkEndIndices_.size( ); i++ )
+    {
+        currentElevationMargin = pointingAngleCalculator_->calculateElevationAngle(
+                    ( linkEndStates.at( linkEndIndices_.at( i ).second ) - linkEndStates.at( linkEndIndices_.at( i ).first ) )
+                    .segment( 0, 3 ), linkEndTimes.at( linkEndIndices_.at( i ).first ) ) - minimumElevationAngle_;
+        viabilityMargin = ( i == 0 ) ? currentElevationMargin : std::min( viabilityMargin, currentElevationMargin );
+    }
+
+    return viabilityMargin;
+}
+
 //! Function for determining whether the avoidance angle to a given body at station is sufficient to allow observation.
 bool BodyAvoidanceAngleCalculator::isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                                                         const std::vector< double >& linkEndTimes )
@@ -104,6 +149,30 @@ bool BodyAvoidanceAngleCalculator::isObservationViable( const std::vector< Eigen
     return isObservationPossible;
 }
 
+//! Function to compute the margin by which the avoidance angle to a given body at station allows observation.
+double BodyAvoidanceAngleCalculator::computeViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                                             const std::vector< double >& linkEndTimes )
+{
+    double viabilityMargin = 1.0;
+    double currentCosineMargin;
+    Eigen::Vector3d positionOfBodyToAvoid;
+
+    // Iterate over all sets of entries of input vector for which avoidance angle is to be checked.
+    for( unsigned int i = 0; i < linkEndIndices_.size( ); i++ )
+    {
+        positionOfBodyToAvoid = stateFunctionOfBodyToAvoid_(
+                    ( linkEndTimes.at( linkEndIndices_.at( i ).first ) + linkEndTimes.at( linkEndIndices_.at( i ).second ) ) / 2.0 )
+                .segment( 0, 3 );
+        currentCosineMargin = std::cos( bodyAvoidanceAngle_ ) - linear_algebra::computeCosineOfAngleBetweenVectors(
+                    positionOfBodyToAvoid - ( linkEndStates.at( linkEndIndices_.at( i ).first ) ).segment( 0, 3 ),
+                    linkEndStates.at( linkEndIndices_.at( i ).second ).segment( 0, 3 ) -
+                    linkEndStates.at( linkEndIndices_.at( i ).first ).segment( 0, 3 ) );
+        viabilityMargin = ( i == 0 ) ? currentCosineMargin : std::min( viabilityMargin, currentCosineMargin );
+    }
+
+    return viabilityMargin;
+}
+
 //! Function for determining whether the link is occulted during the observataion.
 bool OccultationCalculator::isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                                                  const std::vector< double >& linkEndTimes )
@@ -135,6 +204,39 @@ bool OccultationCalculator::isObservationViable( const std::vector< Eigen::Vecto
     return isObservationPossible;
 }
 
+//! Function to compute the margin by which the link is free of occultation during the observation.
+double OccultationCalculator::computeViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                                      const std::vector< double >& linkEndTimes )
+{
+    double viabilityMargin = 1.0;
+    double currentSeparationMargin;
+    Eigen::Vector3d positionOfOccultingBody;
+    Eigen::Vector3d occultingBodyRelativePosition;
+    Eigen::Vector3d observingLinkEndRelativePosition;
+
+    // Iterate over all sets of entries of input vector for which occultation is to be checked.
+    for( unsigned int i = 0; i < linkEndIndices_.size( ); i++ )
+    {
+        // Get position of occulting body
+        positionOfOccultingBody = stateFunctionOfOccultingBody_(
+                    ( linkEndTimes.at( linkEndIndices_.at( i ).first ) +
+                      linkEndTimes.at( linkEndIndices_.at( i ).second ) ) / 2.0 ).segment( 0, 3 );
+
+        // Compute apparent separation and radius, as used in computeShadowFunction (with occulted body radius of 0).
+        occultingBodyRelativePosition =
+                positionOfOccultingBody - linkEndStates.at( linkEndIndices_.at( i ).second ).segment( 0, 3 );
+        observingLinkEndRelativePosition = ( linkEndStates.at( linkEndIndices_.at( i ).first ) -
+                                             linkEndStates.at( linkEndIndices_.at( i ).second ) ).segment( 0, 3 );
+        currentSeparationMargin =
+                linear_algebra::computeAngleBetweenVectors(
+                    occultingBodyRelativePosition, observingLinkEndRelativePosition ) -
+                std::asin( std::min( radiusOfOccultingBody_ / occultingBodyRelativePosition.norm( ), 1.0 ) );
+        viabilityMargin = ( i == 0 ) ? currentSeparationMargin : std::min( viabilityMargin, currentSeparationMargin );
+    }
+
+    return viabilityMargin;
+}
+
 
 
 }
@@ -60,6 +60,25 @@ public:
      */
     virtual bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                                       const std::vector< double >& linkEndTimes ) = 0;
+
+    //! Function to compute the margin by which an observation is viable.
+    /*!
+     *  Function to compute the margin by which an observation is viable, which is positive if, and only if, the observation is
+     *  viable. Derived classes for which the viability check is based on a continuous quantity (e.g. elevation angle) return a
+     *  margin that is continuous in time, so that the boundaries of the windows in which observations are viable can be
+     *  found by root finding (see LinkVisibilityWindows). This base class implementation returns 1.0 for viable, and -1.0 for
+     *  non-viable, observations.
+     *  \param linkEndStates Vector of states of the link ends involved in the observation, in the order as provided by the
+     *  function computeObservationsAndLinkEndData of the associated ObservationModel.
+     *  \param linkEndTimes Vector of times of the link ends involved in the observation, in the order as provided by the
+     *  function computeObservationsAndLinkEndData of the associated ObservationModel.
+     *  \return Margin by which observation is viable (positive if viable).
+     */
+    virtual double computeViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                           const std::vector< double >& linkEndTimes )
+    {
+        return isObservationViable( linkEndStates, linkEndTimes ) ? 1.0 : -1.0;
+    }
 };
 
 //! Function to check whether an observation is viable
@@ -94,6 +113,21 @@ bool isObservationViable(
         const std::vector< Eigen::Vector6d >& states, const std::vector< double >& times,
         const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators );
 
+//! Function to compute the margin by which an observation is viable for a list of viability calculators
+/*!
+ * Function to compute the margin by which an observation is viable for a list of viability calculators, which is the minimum
+ * of the margins of the separate calculators (see ObservationViabilityCalculator::computeViabilityMargin).
+ * \param states Vector of states of the link ends involved in the observation, in the order as provided by the
+ * function computeObservationsAndLinkEndData of the associated ObservationModel.
+ * \param times Vector of times of the link ends involved in the observation, in the order as provided by the
+ * function computeObservationsAndLinkEndData of the associated ObservationModel.
+ * \param viabilityCalculators List of viability calculators
+ * \return Margin by which observation is viable (positive if viable; 1.0 if no viability calculators are provided).
+ */
+double computeObservationViabilityMargin(
+        const std::vector< Eigen::Vector6d >& states, const std::vector< double >& times,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators );
+
 
 //! Function to check whether an observation is possible based on minimum elevation angle criterion at one link end.
 class MinimumElevationAngleCalculator: public ObservationViabilityCalculator
@@ -133,6 +167,19 @@ public:
      */
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                               const std::vector< double >& linkEndTimes );
+
+    //! Function to compute the margin by which the elevation angle at station allows observation.
+    /*!
+     *  Function to compute the margin by which the elevation angle at station allows observation, defined as the minimum
+     *  (over all link end combinations) of the difference between the elevation angle and the minimum elevation angle.
+     *  \param linkEndStates Vector of states of the link ends involved in the observation, in the order as provided by the
+     *  function computeObservationsAndLinkEndData of the associated ObservationModel.
+     *  \param linkEndTimes Vector of times of the link ends involved in the observation, in the order as provided by the
+     *  function computeObservationsAndLinkEndData of the associated ObservationModel.
+     *  \return Margin by which observation is viable (positive if viable).
+     */
+    double computeViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                   const std::vector< double >& linkEndTimes );
 private:
 
     //! Vector of indices denoting which combinations of entries of vectors are to be used in isObservationViable  function
@@ -204,6 +251,20 @@ public:
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                               const std::vector< double >& linkEndTimes );
 
+    //! Function to compute the margin by which the avoidance angle to a given body at station allows observation.
+    /*!
+     *  Function to compute the margin by which the avoidance angle to a given body at station allows observation, defined as
+     *  the minimum (over all link end combinations) of the difference between the cosine of the minimum avoidance angle and
+     *  the cosine of the avoidance angle.
+     *  \param linkEndStates Vector of states of the link ends involved in the observation, in the order as provided by the
+     *  function computeObservationsAndLinkEndData of the associated ObservationModel.
+     *  \param linkEndTimes Vector of times of the link ends involved in the observation, in the order as provided by the
+     *  function computeObservationsAndLinkEndData of the associated ObservationModel.
+     *  \return Margin by which observation is viable (positive if viable).
+     */
+    double computeViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                   const std::vector< double >& linkEndTimes );
+
 private:
 
     //! Vector of indices denoting which combinations of entries of vectors to isObservationViable are to be used.
@@ -258,6 +319,21 @@ public:
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                               const std::vector< double >& linkEndTimes );
 
+    //! Function to compute the margin by which the link is free of occultation during the observation.
+    /*!
+     *  Function to compute the margin by which the link is free of occultation during the observation, defined as the
+     *  minimum (over all link end combinations) of the difference between the apparent separation of the center of the
+     *  occulting body and the observing link end, and the apparent radius of the occulting body, as seen from the observed
+     *  link end (consistent with the shadow function used by isObservationViable).
+     *  \param linkEndStates Vector of states of the link ends involved in the observation, in the order as provided by the
+     *  function computeObservationsAndLinkEndData of the associated ObservationModel.
+     *  \param linkEndTimes Vector of times of the link ends involved in the observation, in the order as provided by the
+     *  function computeObservationsAndLinkEndData of the associated ObservationModel.
+     *  \return Margin by which observation is viable (positive if viable).
+     */
+    double computeViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                   const std::vector< double >& linkEndTimes );
+
 private:
 
     //! Vector of indices denoting which combinations of entries of vectors to isObservationViable are to be used.
@@ -11,9 +11,12 @@
 #ifndef TUDAT_SIMULATEOBSERVATIONS_H
 #define TUDAT_SIMULATEOBSERVATIONS_H
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <boost/bind.hpp>
 
+#include "Tudat/Astrodynamics/ObservationModels/linkVisibilityWindows.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationSimulator.h"
 
 namespace tudat
@@ -53,13 +56,28 @@ struct ObservationSimulationTimeSettings
 template< typename TimeType >
 struct TabulatedObservationSimulationTimeSettings: public ObservationSimulationTimeSettings< TimeType >
 {
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param linkEndType Link end type from which observations are to be simulated.
+     *  \param simulationTimes Times at which observations are to be simulated
+     *  \param visibilityWindowGridTimeStep Time step of the grid used to precompute the windows in which observations are
+     *  viable (see LinkVisibilityWindows), after which only the simulation times inside these windows are simulated and checked
+     *  for viability. If NaN (default), all simulation times are simulated and checked for viability.
+     */
     TabulatedObservationSimulationTimeSettings(
-            const LinkEndType linkEndType, const std::vector< TimeType >& simulationTimes ): ObservationSimulationTimeSettings< TimeType >( linkEndType ),
-        simulationTimes_( simulationTimes ){ }
+            const LinkEndType linkEndType, const std::vector< TimeType >& simulationTimes,
+            const double visibilityWindowGridTimeStep = TUDAT_NAN ):
+        ObservationSimulationTimeSettings< TimeType >( linkEndType ),
+        simulationTimes_( simulationTimes ), visibilityWindowGridTimeStep_( visibilityWindowGridTimeStep ){ }
 
     ~TabulatedObservationSimulationTimeSettings( ){ }
 
+    //! Times at which observations are to be simulated
     std::vector< TimeType > simulationTimes_;
+
+    //! Time step of the grid used to precompute the visibility windows (NaN if not used).
+    double visibilityWindowGridTimeStep_;
 };
 
 //! Function to compute observations at times defined by settings object using a given observation model
@@ -90,10 +108,27 @@ simulateSingleObservationSet(
         std::shared_ptr< TabulatedObservationSimulationTimeSettings< TimeType > > tabulatedObservationSettings =
                 std::dynamic_pointer_cast< TabulatedObservationSimulationTimeSettings< TimeType > >( observationsToSimulate );
 
+        // If requested, retain only times inside precomputed visibility windows, so that observations need not be computed
+        // and checked at times where they are not viable.
+        std::vector< TimeType > observationTimes = tabulatedObservationSettings->simulationTimes_;
+        if( !std::isnan( tabulatedObservationSettings->visibilityWindowGridTimeStep_ ) &&
+                currentObservationViabilityCalculators.size( ) > 0 && observationTimes.size( ) > 0 )
+        {
+            typename std::vector< TimeType >::const_iterator firstObservationTime =
+                    std::min_element( observationTimes.begin( ), observationTimes.end( ) );
+            typename std::vector< TimeType >::const_iterator lastObservationTime =
+                    std::max_element( observationTimes.begin( ), observationTimes.end( ) );
+
+            observationTimes = createLinkVisibilityWindows< ObservationSize, ObservationScalarType, TimeType >(
+                        observationModel, observationsToSimulate->linkEndType_, currentObservationViabilityCalculators,
+                        static_cast< double >( *firstObservationTime ), static_cast< double >( *lastObservationTime ),
+                        tabulatedObservationSettings->visibilityWindowGridTimeStep_ )->filterObservationTimes( observationTimes );
+        }
+
         // Simulate observations at requested pre-defined time.
         simulatedObservations = simulateObservationsWithCheckAndLinkEndIdOutput<
                 ObservationSize, ObservationScalarType, TimeType >(
-                    tabulatedObservationSettings->simulationTimes_, observationModel, observationsToSimulate->linkEndType_,
+                    observationTimes, observationModel, observationsToSimulate->linkEndType_,
                     currentObservationViabilityCalculators );
 
     }
@@ -172,6 +172,38 @@ BOOST_AUTO_TEST_CASE( testCentralGravityPartials )
                                        testPartialWrtEarthGravitationalParameter, 1.0E-6 );
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( partialWrtEarthGravitationalParameter,
                                        partialWrtSunGravitationalParameter, std::numeric_limits< double >::epsilon(  ) );
+
+    // Create partial object using numerical differentiation, and compare with analytical results.
+    Eigen::Vector6d stateSizePerturbations;
+    stateSizePerturbations << positionPerturbation, velocityPerturbation;
+    Eigen::Vector6d nominalEarthState = earth->getState( );
+    Eigen::Vector6d nominalSunState = sun->getState( );
+    std::shared_ptr< AccelerationPartial > numericalCentralGravitationPartial =
+            createNumericalAccelerationPartial(
+                gravitationalAcceleration, std::make_pair( "Earth", earth ), std::make_pair( "Sun", sun ),
+                numerical_derivatives::NumericalJacobianSettings(
+                    numerical_derivatives::absolute_jacobian_step_size, stateSizePerturbations ) );
+    numericalCentralGravitationPartial->update( 0.0 );
+    Eigen::MatrixXd numericalPartialWrtEarthState = Eigen::MatrixXd::Zero( 3, 6 );
+    numericalCentralGravitationPartial->wrtStateOfAcceleratedBody( numericalPartialWrtEarthState.block( 0, 0, 3, 6 ) );
+    Eigen::MatrixXd numericalPartialWrtSunState = Eigen::MatrixXd::Zero( 3, 6 );
+    numericalCentralGravitationPartial->wrtStateOfAcceleratingBody( numericalPartialWrtSunState.block( 0, 0, 3, 6 ) );
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::Matrix3d( numericalPartialWrtEarthState.block( 0, 0, 3, 3 ) ),
+                                       partialWrtEarthPosition, 1.0E-8 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::Matrix3d( numericalPartialWrtEarthState.block( 0, 3, 3, 3 ) ),
+                                       partialWrtEarthVelocity, std::numeric_limits< double >::epsilon( ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::Matrix3d( numericalPartialWrtSunState.block( 0, 0, 3, 3 ) ),
+                                       partialWrtSunPosition, 1.0E-8 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::Matrix3d( numericalPartialWrtSunState.block( 0, 3, 3, 3 ) ),
+                                       partialWrtSunVelocity, std::numeric_limits< double >::epsilon( ) );
+
+    // Check that nominal states have been restored.
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( earth->getState( )( i ), nominalEarthState( i ) );
+        BOOST_CHECK_EQUAL( sun->getState( )( i ), nominalSunState( i ) );
+    }
 }
 
 BOOST_AUTO_TEST_CASE( testRadiationPressureAccelerationPartials )
@@ -658,6 +690,49 @@ BOOST_AUTO_TEST_CASE( testAerodynamicAccelerationPartials )
 
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtDragCoefficient,
                                        partialWrtDragCoefficient, 1.0E-10 );
+
+    // Create partial object using numerical differentiation (which must update the flight conditions when perturbing the
+    // states), and compare with analytical results.
+    Eigen::Vector6d stateSizePerturbations;
+    stateSizePerturbations << positionPerturbation, velocityPerturbation;
+    Eigen::Vector6d nominalVehicleState = bodyMap.at( "Vehicle" )->getState( );
+    std::shared_ptr< AccelerationPartial > numericalAerodynamicAccelerationPartial =
+            createNumericalAccelerationPartial(
+                accelerationModel, std::make_pair( "Vehicle", bodyMap[ "Vehicle" ] ),
+                std::make_pair( "Earth", bodyMap[ "Earth" ] ),
+                numerical_derivatives::NumericalJacobianSettings(
+                    numerical_derivatives::absolute_jacobian_step_size, stateSizePerturbations ) );
+    numericalAerodynamicAccelerationPartial->update( 0.0 );
+    Eigen::MatrixXd numericalPartialWrtVehicleState = Eigen::MatrixXd::Zero( 3, 6 );
+    numericalAerodynamicAccelerationPartial->wrtStateOfAcceleratedBody(
+                numericalPartialWrtVehicleState.block( 0, 0, 3, 6 ) );
+    Eigen::MatrixXd numericalPartialWrtEarthState = Eigen::MatrixXd::Zero( 3, 6 );
+    numericalAerodynamicAccelerationPartial->wrtStateOfAcceleratingBody(
+                numericalPartialWrtEarthState.block( 0, 0, 3, 6 ) );
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::Matrix3d( numericalPartialWrtVehicleState.block( 0, 0, 3, 3 ) ),
+                                       partialWrtVehiclePosition, 1.0E-6 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::Matrix3d( numericalPartialWrtVehicleState.block( 0, 3, 3, 3 ) ),
+                                       partialWrtVehicleVelocity, 1.0E-6 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::Matrix3d( numericalPartialWrtEarthState.block( 0, 0, 3, 3 ) ),
+                                       partialWrtEarthPosition, 1.0E-6 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::Matrix3d( numericalPartialWrtEarthState.block( 0, 3, 3, 3 ) ),
+                                       partialWrtEarthVelocity, 1.0E-6 );
+
+    // Check that nominal state and flight conditions have been restored.
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( bodyMap.at( "Vehicle" )->getState( )( i ), nominalVehicleState( i ) );
+    }
+    Eigen::Vector6d bodyFixedVehicleState =
+            bodyMap.at( "Vehicle" )->getFlightConditions( )->getCurrentBodyCenteredBodyFixedState( );
+    bodyMap.at( "Vehicle" )->getFlightConditions( )->resetCurrentTime( TUDAT_NAN );
+    bodyMap.at( "Vehicle" )->getFlightConditions( )->updateConditions( 0.0 );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( bodyMap.at( "Vehicle" )->getFlightConditions( )->getCurrentBodyCenteredBodyFixedState( )( i ),
+                           bodyFixedVehicleState( i ) );
+    }
 }
 
 
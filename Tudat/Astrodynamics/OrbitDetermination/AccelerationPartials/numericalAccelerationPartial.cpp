@@ -8,6 +8,7 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModelTypes.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/numericalAccelerationPartial.h"
 
 namespace tudat
@@ -522,6 +523,85 @@ Eigen::Matrix< double, 3, Eigen::Dynamic > calculateTorqueWrtParameterPartials(
 }
 
 
+//! Constructor
+NumericalAccelerationPartial::NumericalAccelerationPartial(
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+        const std::string& acceleratedBody,
+        const std::string& acceleratingBody,
+        const std::function< Eigen::Vector6d( ) > acceleratedBodyStateFunction,
+        const std::function< void( const Eigen::Vector6d& ) > acceleratedBodyStateSetFunction,
+        const std::function< Eigen::Vector6d( ) > acceleratingBodyStateFunction,
+        const std::function< void( const Eigen::Vector6d& ) > acceleratingBodyStateSetFunction,
+        const numerical_derivatives::NumericalJacobianSettings& jacobianSettings,
+        const std::function< void( const double ) > environmentUpdateFunction ):
+    AccelerationPartial( acceleratedBody, acceleratingBody,
+                         basic_astrodynamics::getAccelerationModelType( accelerationModel ) ),
+    accelerationModel_( accelerationModel ),
+    acceleratedBodyStateFunction_( acceleratedBodyStateFunction ),
+    acceleratedBodyStateSetFunction_( acceleratedBodyStateSetFunction ),
+    acceleratingBodyStateFunction_( acceleratingBodyStateFunction ),
+    acceleratingBodyStateSetFunction_( acceleratingBodyStateSetFunction ),
+    jacobianSettings_( jacobianSettings ),
+    environmentUpdateFunction_( environmentUpdateFunction )
+{
+    // Perturbations are applied to the shared environment, so perturbed accelerations are evaluated sequentially.
+    jacobianSettings_.numberOfThreads_ = 1;
+
+    // If the body exerting the acceleration is the body undergoing it, all dependencies are in the latter partial.
+    computeAcceleratingBodyPartial_ = ( acceleratingBodyStateFunction_ != nullptr ) &&
+            ( acceleratingBodyStateSetFunction_ != nullptr ) && ( acceleratingBody != acceleratedBody );
+
+    currentPartialWrtAcceleratedBodyState_.setZero( );
+    currentPartialWrtAcceleratingBodyState_.setZero( );
+}
+
+//! Function for updating partials w.r.t. the bodies' states
+void NumericalAccelerationPartial::update( const double currentTime )
+{
+    if( !( currentTime_ == currentTime ) )
+    {
+        currentPartialWrtAcceleratedBodyState_ = computePartialWrtBodyState(
+                    acceleratedBodyStateFunction_, acceleratedBodyStateSetFunction_, currentTime );
+        if( computeAcceleratingBodyPartial_ )
+        {
+            currentPartialWrtAcceleratingBodyState_ = computePartialWrtBodyState(
+                        acceleratingBodyStateFunction_, acceleratingBodyStateSetFunction_, currentTime );
+        }
+
+        currentTime_ = currentTime;
+    }
+}
+
+//! Function to numerically compute the partial of the acceleration w.r.t. the state of a single body.
+Eigen::Matrix< double, 3, 6 > NumericalAccelerationPartial::computePartialWrtBodyState(
+        const std::function< Eigen::Vector6d( ) >& bodyStateFunction,
+        const std::function< void( const Eigen::Vector6d& ) >& bodyStateSetFunction,
+        const double currentTime )
+{
+    const Eigen::Vector6d nominalState = bodyStateFunction( );
+
+    // Compute acceleration as a function of (perturbed) body state.
+    std::function< Eigen::VectorXd( const Eigen::VectorXd& ) > accelerationFunction =
+            [ & ]( const Eigen::VectorXd& perturbedState )
+    {
+        bodyStateSetFunction( perturbedState );
+        environmentUpdateFunction_( currentTime );
+        accelerationModel_->resetTime( TUDAT_NAN );
+        return Eigen::VectorXd( basic_astrodynamics::updateAndGetAcceleration< Eigen::Vector3d >(
+                                    accelerationModel_, currentTime ) );
+    };
+    Eigen::Matrix< double, 3, 6 > statePartial = numerical_derivatives::computeCentralDifferenceJacobian(
+                nominalState, accelerationFunction, jacobianSettings_ );
+
+    // Reset state/environment to original state.
+    bodyStateSetFunction( nominalState );
+    environmentUpdateFunction_( currentTime );
+    accelerationModel_->resetTime( TUDAT_NAN );
+    basic_astrodynamics::updateAndGetAcceleration< Eigen::Vector3d >( accelerationModel_, currentTime );
+
+    return statePartial;
+}
+
 }
 
 }
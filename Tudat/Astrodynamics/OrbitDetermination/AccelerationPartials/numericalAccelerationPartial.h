@@ -17,8 +17,10 @@
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModel.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/accelerationPartial.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/estimatableParameter.h"
 #include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/BasicMathematics/numericalJacobian.h"
 
 namespace tudat
 {
@@ -242,6 +244,219 @@ Eigen::Matrix< double, 3, Eigen::Dynamic > calculateTorqueWrtParameterPartials(
         const double currentTime = 0.0,
         std::function< void( const double ) > timeDependentUpdateDependentVariables = emptyTimeFunction );
 
+//! Class to calculate the partials of an acceleration w.r.t. the states of the bodies involved, by numerical differentiation.
+/*!
+ *  Class to calculate the partials of an acceleration w.r.t. the translational states of the bodies undergoing and exerting
+ *  the acceleration, by numerically differentiating the acceleration model (see computeCentralDifferenceJacobian). This
+ *  class can be used for acceleration models for which no analytical partial is implemented (see
+ *  createAnalyticalAccelerationPartial), or to validate analytical partials. Since the perturbed states are set in the
+ *  (shared) environment, the perturbed accelerations are evaluated sequentially. Only the acceleration model itself, and
+ *  the environment models updated by the environmentUpdateFunction, are made consistent with the perturbed states. No
+ *  partials w.r.t. parameters are computed by this class.
+ */
+class NumericalAccelerationPartial: public AccelerationPartial
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param accelerationModel Acceleration model for which partials are to be computed.
+     *  \param acceleratedBody Name of body undergoing acceleration.
+     *  \param acceleratingBody Name of body exerting acceleration.
+     *  \param acceleratedBodyStateFunction Function returning the current state of the body undergoing acceleration.
+     *  \param acceleratedBodyStateSetFunction Function to reset the current state of the body undergoing acceleration.
+     *  \param acceleratingBodyStateFunction Function returning the current state of the body exerting acceleration (empty
+     *  if no partial w.r.t. this state is to be computed).
+     *  \param acceleratingBodyStateSetFunction Function to reset the current state of the body exerting acceleration (empty
+     *  if no partial w.r.t. this state is to be computed).
+     *  \param jacobianSettings Settings for the numerical differentiation. The number of threads in these settings is
+     *  ignored: the perturbed accelerations are always evaluated sequentially, since each perturbation is applied to the
+     *  (single, shared) environment, and no per-thread copies of the environment are created.
+     *  \param environmentUpdateFunction Function to update the required environment models (as a function of current time)
+     *  following the change of a body state.
+     */
+    NumericalAccelerationPartial(
+            const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+            const std::string& acceleratedBody,
+            const std::string& acceleratingBody,
+            const std::function< Eigen::Vector6d( ) > acceleratedBodyStateFunction,
+            const std::function< void( const Eigen::Vector6d& ) > acceleratedBodyStateSetFunction,
+            const std::function< Eigen::Vector6d( ) > acceleratingBodyStateFunction =
+            std::function< Eigen::Vector6d( ) >( ),
+            const std::function< void( const Eigen::Vector6d& ) > acceleratingBodyStateSetFunction =
+            std::function< void( const Eigen::Vector6d& ) >( ),
+            const numerical_derivatives::NumericalJacobianSettings& jacobianSettings =
+            numerical_derivatives::NumericalJacobianSettings( ),
+            const std::function< void( const double ) > environmentUpdateFunction = emptyTimeFunction );
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration
+     *  and adding it to the existing partial block. Update( ) function must have been called during current time step
+     *  before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian position of body
+     *  undergoing acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAcceleratedBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 )
+    {
+        addPartialBlock( partialMatrix, currentPartialWrtAcceleratedBodyState_.block( 0, 0, 3, 3 ),
+                         addContribution, startRow, startColumn );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the velocity of body undergoing acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the velocity of body undergoing acceleration
+     *  and adding it to the existing partial block. Update( ) function must have been called during current time step
+     *  before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian velocity of body
+     *  undergoing acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtVelocityOfAcceleratedBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 3 )
+    {
+        addPartialBlock( partialMatrix, currentPartialWrtAcceleratedBodyState_.block( 0, 3, 3, 3 ),
+                         addContribution, startRow, startColumn );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of body exerting acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of body exerting acceleration
+     *  and adding it to the existing partial block. Update( ) function must have been called during current time step
+     *  before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian position of body
+     *  exerting acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAcceleratingBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 )
+    {
+        addPartialBlock( partialMatrix, currentPartialWrtAcceleratingBodyState_.block( 0, 0, 3, 3 ),
+                         addContribution, startRow, startColumn );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the velocity of body exerting acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the velocity of body exerting acceleration
+     *  and adding it to the existing partial block. Update( ) function must have been called during current time step
+     *  before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian velocity of body
+     *  exerting acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtVelocityOfAcceleratingBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 3 )
+    {
+        addPartialBlock( partialMatrix, currentPartialWrtAcceleratingBodyState_.block( 0, 3, 3, 3 ),
+                         addContribution, startRow, startColumn );
+    }
+
+    //! Function for updating partials w.r.t. the bodies' states
+    /*!
+     *  Function for updating partials w.r.t. the bodies' states to the current time, by numerically differentiating the
+     *  acceleration model. After the computation, the nominal states are reset, and the acceleration model (and
+     *  environment) are updated to the nominal state.
+     *  \param currentTime Time at which partials are to be calculated
+     */
+    void update( const double currentTime = TUDAT_NAN );
+
+    //! Function to retrieve the settings for the numerical differentiation.
+    /*!
+     *  Function to retrieve the settings for the numerical differentiation.
+     *  \return Settings for the numerical differentiation.
+     */
+    numerical_derivatives::NumericalJacobianSettings getJacobianSettings( )
+    {
+        return jacobianSettings_;
+    }
+
+protected:
+
+    //! Function to add (or subtract) a computed partial block to a block of the partial matrix.
+    /*!
+     *  Function to add (or subtract) a computed partial block to a block of the partial matrix.
+     *  \param partialMatrix Block of partial derivatives where current partial is to be added.
+     *  \param partialBlock Partial that is to be added.
+     *  \param addContribution Variable denoting whether to add (true) or subtract (false) the partial.
+     *  \param startRow First row in partialMatrix block where the partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the partial is to be added.
+     */
+    void addPartialBlock( Eigen::Block< Eigen::MatrixXd >& partialMatrix,
+                          const Eigen::Matrix3d& partialBlock,
+                          const bool addContribution, const int startRow, const int startColumn )
+    {
+        if( addContribution )
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) += partialBlock;
+        }
+        else
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) -= partialBlock;
+        }
+    }
+
+    //! Function to numerically compute the partial of the acceleration w.r.t. the state of a single body.
+    /*!
+     *  Function to numerically compute the partial of the acceleration w.r.t. the state of a single body, resetting the
+     *  nominal state and environment afterwards.
+     *  \param bodyStateFunction Function returning the current state of the body.
+     *  \param bodyStateSetFunction Function to reset the current state of the body.
+     *  \param currentTime Time at which partials are to be calculated
+     *  \return Partial of the acceleration w.r.t. the Cartesian state of the body.
+     */
+    Eigen::Matrix< double, 3, 6 > computePartialWrtBodyState(
+            const std::function< Eigen::Vector6d( ) >& bodyStateFunction,
+            const std::function< void( const Eigen::Vector6d& ) >& bodyStateSetFunction,
+            const double currentTime );
+
+    //! Acceleration model for which partials are to be computed.
+    std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel_;
+
+    //! Function returning the current state of the body undergoing acceleration.
+    std::function< Eigen::Vector6d( ) > acceleratedBodyStateFunction_;
+
+    //! Function to reset the current state of the body undergoing acceleration.
+    std::function< void( const Eigen::Vector6d& ) > acceleratedBodyStateSetFunction_;
+
+    //! Function returning the current state of the body exerting acceleration.
+    std::function< Eigen::Vector6d( ) > acceleratingBodyStateFunction_;
+
+    //! Function to reset the current state of the body exerting acceleration.
+    std::function< void( const Eigen::Vector6d& ) > acceleratingBodyStateSetFunction_;
+
+    //! Settings for the numerical differentiation.
+    numerical_derivatives::NumericalJacobianSettings jacobianSettings_;
+
+    //! Function to update the required environment models (as a function of current time) following the change of a body
+    //! state.
+    std::function< void( const double ) > environmentUpdateFunction_;
+
+    //! Boolean denoting whether the partial w.r.t. the state of the body exerting acceleration is computed.
+    bool computeAcceleratingBodyPartial_;
+
+    //! Current partial of acceleration w.r.t. state of body undergoing acceleration (as set by update function).
+    Eigen::Matrix< double, 3, 6 > currentPartialWrtAcceleratedBodyState_;
+
+    //! Current partial of acceleration w.r.t. state of body exerting acceleration (as set by update function).
+    Eigen::Matrix< double, 3, 6 > currentPartialWrtAcceleratingBodyState_;
+
+};
+
 } // namespace acceleration_partials
 
 } // namespace tudat
@@ -374,6 +374,42 @@ std::vector< double > getMultiArcStateEstimationArcStartTimes(
     return arcStartTimes;
 }
 
+//! Function to get the indices in the estimated parameter vector of the arc-wise initial states, per arc
+/*!
+ *  Function to get the indices in the estimated parameter vector of the arc-wise initial states, per arc. For each arc, the
+ *  list contains the indices of the initial states of all bodies for which arc-wise initial states are estimated. An
+ *  empty list is returned if no arc-wise initial states are estimated.
+ *  \param estimatableParameters List of estimated parameters
+ *  \return Indices in the estimated parameter vector of the arc-wise initial states (inner vector) for each arc (outer vector)
+ */
+template< typename InitialStateParameterType >
+std::vector< std::vector< int > > getArcWiseInitialStateParameterIndices(
+        const std::shared_ptr< EstimatableParameterSet< InitialStateParameterType > > estimatableParameters )
+{
+    // Check arc consistency
+    const int numberOfArcs = getMultiArcStateEstimationArcStartTimes( estimatableParameters, false ).size( );
+
+    std::vector< std::vector< int > > arcWiseParameterIndices( numberOfArcs );
+    std::map< int, std::shared_ptr< EstimatableParameter< Eigen::Matrix< InitialStateParameterType, Eigen::Dynamic, 1 > > > >
+            initialStateParameters = estimatableParameters->getInitialStateParameters( );
+    for( auto parameterIterator : initialStateParameters )
+    {
+        if( parameterIterator.second->getParameterName( ).first == arc_wise_initial_body_state )
+        {
+            // Arc-wise states are concatenated in arc order
+            for( int i = 0; i < numberOfArcs; i++ )
+            {
+                for( int j = 0; j < 6; j++ )
+                {
+                    arcWiseParameterIndices[ i ].push_back( parameterIterator.first + 6 * i + j );
+                }
+            }
+        }
+    }
+
+    return arcWiseParameterIndices;
+}
+
 
 } // namespace estimatable_parameters
 
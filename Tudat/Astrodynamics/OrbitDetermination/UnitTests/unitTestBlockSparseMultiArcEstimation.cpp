@@ -0,0 +1,201 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/SimulationSetup/tudatSimulationHeader.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/SimulationSetup/EstimationSetup/orbitDeterminationManager.h"
+#include "Tudat/SimulationSetup/EstimationSetup/earthOrbiterEstimationTestSetup.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+BOOST_AUTO_TEST_SUITE( test_block_sparse_multi_arc_estimation )
+
+//Using declarations.
+using namespace tudat::observation_models;
+using namespace tudat::orbit_determination;
+using namespace tudat::estimatable_parameters;
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::ephemerides;
+using namespace tudat::propagators;
+using namespace tudat::basic_astrodynamics;
+
+//! Test whether multi-arc estimation from block-sparse normal equations gives the same results as from the full partials
+//! matrix
+BOOST_AUTO_TEST_CASE( test_BlockSparseMultiArcEstimation )
+{
+    // Create Earth from analytical models.
+    const double initialTime = 1.0E7;
+    const double arcDuration = 8.0 * 3600.0;
+    const double arcSeparation = 9.0 * 3600.0;
+    const int numberOfArcs = 3;
+
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( initialTime, true );
+
+    // Create accelerations
+    std::vector< std::string > bodiesToIntegrate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    AccelerationMap accelerationModelMap = createEarthOrbiterTestAccelerationModels( bodyMap );
+
+    // Create propagation settings for each arc (arcs are separated by gaps)
+    std::vector< double > arcStartTimes;
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > propagatorSettingsList;
+    Eigen::Vector6d initialStateInKeplerianElements = getEarthOrbiterTestKeplerianInitialState( );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        arcStartTimes.push_back( initialTime + static_cast< double >( i ) * arcSeparation );
+        initialStateInKeplerianElements( trueAnomalyIndex ) += 1.0;
+        propagatorSettingsList.push_back(
+                    std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                        centralBodies, accelerationModelMap, bodiesToIntegrate,
+                        convertKeplerianToCartesianElements(
+                            initialStateInKeplerianElements, earthOrbiterTestGravitationalParameter ),
+                        arcStartTimes.at( i ) + arcDuration ) );
+    }
+    std::shared_ptr< MultiArcPropagatorSettings< double > > propagatorSettings =
+            std::make_shared< MultiArcPropagatorSettings< double > >( propagatorSettingsList );
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< IntegratorSettings< double > >( rungeKutta4, initialTime, 30.0 );
+
+    // Create parameters (arc-wise initial states, and global parameters) and orbit determination object.
+    std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable = getEarthOrbiterTestLinkEnds( );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate = createParametersToEstimate(
+                getEarthOrbiterTestParameterSettings(
+                    std::make_shared< ArcWiseInitialTranslationalStateEstimatableParameterSettings< double > >(
+                        "Vehicle", propagatorSettings->getInitialStates( ), arcStartTimes, "Earth" ) ), bodyMap );
+
+    // Check that the arc-wise block structure used for the block-sparse normal equations is identified
+    std::vector< std::vector< int > > arcWiseParameterIndices =
+            getArcWiseInitialStateParameterIndices( parametersToEstimate );
+    BOOST_CHECK_EQUAL( static_cast< int >( arcWiseParameterIndices.size( ) ), numberOfArcs );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        BOOST_CHECK_EQUAL( arcWiseParameterIndices.at( i ).size( ), 6 );
+        BOOST_CHECK_EQUAL( arcWiseParameterIndices.at( i ).at( 0 ), 6 * i );
+    }
+
+    OrbitDeterminationManager< double, double > orbitDeterminationManager(
+                bodyMap, parametersToEstimate, getEarthOrbiterTestObservationSettings( linkEndsPerObservable ),
+                integratorSettings, propagatorSettings );
+
+    // Simulate observations inside each arc
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        for( double currentTime = arcStartTimes.at( i ) + 600.0; currentTime < arcStartTimes.at( i ) + arcDuration - 600.0;
+             currentTime += 120.0 )
+        {
+            observationTimes.push_back( currentTime );
+        }
+    }
+    PodInput< double, double >::PodInputDataType observationsAndTimes = simulateEarthOrbiterTestObservations(
+                linkEndsPerObservable, observationTimes, orbitDeterminationManager.getObservationSimulators( ) );
+
+    // Define perturbation of parameters
+    Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+    const int numberOfParameters = truthParameters.rows( );
+    BOOST_CHECK_EQUAL( numberOfParameters, 6 * numberOfArcs + 4 );
+    Eigen::VectorXd parameterPerturbation = getEarthOrbiterTestParameterPerturbation( numberOfArcs );
+
+    // Define a priori covariance for (arc-wise) initial states and gravitational parameter
+    Eigen::MatrixXd inverseAprioriCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        inverseAprioriCovariance.block( 6 * i, 6 * i, 3, 3 ) = Eigen::Matrix3d::Identity( ) / ( 100.0 * 100.0 );
+        inverseAprioriCovariance.block( 6 * i + 3, 6 * i + 3, 3, 3 ) = Eigen::Matrix3d::Identity( ) / ( 0.1 * 0.1 );
+    }
+    inverseAprioriCovariance( 6 * numberOfArcs, 6 * numberOfArcs ) = 1.0 / ( 1.0E8 * 1.0E8 );
+
+    std::map< observation_models::ObservableType, double > weightPerObservable = getEarthOrbiterTestWeightPerObservable( );
+
+    // Perform estimation from full partials matrix (test 0), and from block-sparse normal equations (test 1)
+    std::vector< std::shared_ptr< PodOutput< double > > > podOutputList;
+    for( int test = 0; test < 2; test++ )
+    {
+        parametersToEstimate->resetParameterValues< double >( truthParameters );
+        std::shared_ptr< PodInput< double, double > > podInput =
+                std::make_shared< PodInput< double, double > >(
+                    observationsAndTimes, numberOfParameters, inverseAprioriCovariance, parameterPerturbation );
+        podInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
+        podInput->defineEstimationSettings( true, true, true, false, true );
+        if( test == 1 )
+        {
+            podInput->setAccumulateNormalEquations( true, 37, true );
+        }
+        podOutputList.push_back( orbitDeterminationManager.estimateParameters(
+                                     podInput, std::make_shared< EstimationConvergenceChecker >( 3 ) ) );
+    }
+
+    std::shared_ptr< PodOutput< double > > denseOutput = podOutputList.at( 0 );
+    std::shared_ptr< PodOutput< double > > blockSparseOutput = podOutputList.at( 1 );
+
+    // Check parameter corrections in each iteration, and final estimate, w.r.t. formal errors of the estimation
+    Eigen::VectorXd formalErrors = denseOutput->getFormalErrorVector( );
+    BOOST_CHECK_EQUAL( denseOutput->parameterHistory_.size( ), blockSparseOutput->parameterHistory_.size( ) );
+    for( unsigned int i = 1; i < denseOutput->parameterHistory_.size( ); i++ )
+    {
+        Eigen::VectorXd denseCorrection =
+                denseOutput->parameterHistory_.at( i ) - denseOutput->parameterHistory_.at( i - 1 );
+        Eigen::VectorXd blockSparseCorrection =
+                blockSparseOutput->parameterHistory_.at( i ) - blockSparseOutput->parameterHistory_.at( i - 1 );
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            BOOST_CHECK_SMALL( ( denseCorrection( j ) - blockSparseCorrection( j ) ) / formalErrors( j ), 1.0E-4 );
+        }
+    }
+
+    for( int j = 0; j < numberOfParameters; j++ )
+    {
+        BOOST_CHECK_SMALL( ( denseOutput->parameterEstimate_( j ) - blockSparseOutput->parameterEstimate_( j ) ) /
+                           formalErrors( j ), 1.0E-4 );
+    }
+
+    // Check residuals and inverse covariance (including the zero blocks coupling different arcs)
+    BOOST_CHECK_SMALL( ( denseOutput->residuals_ - blockSparseOutput->residuals_ ).cwiseAbs( ).maxCoeff( ), 1.0E-4 );
+
+    Eigen::MatrixXd denseInverseCovariance = denseOutput->getUnnormalizedInverseCovarianceMatrix( );
+    Eigen::MatrixXd blockSparseInverseCovariance = blockSparseOutput->getUnnormalizedInverseCovarianceMatrix( );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            BOOST_CHECK_SMALL( ( denseInverseCovariance( i, j ) - blockSparseInverseCovariance( i, j ) ) /
+                               std::sqrt( denseInverseCovariance( i, i ) * denseInverseCovariance( j, j ) ), 1.0E-10 );
+        }
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( denseOutput->getFormalErrorVector( ),
+                                       blockSparseOutput->getFormalErrorVector( ), 1.0E-8 );
+
+    // Check that estimation has converged to the true parameter values
+    Eigen::VectorXd estimationError = blockSparseOutput->parameterEstimate_ - truthParameters;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        BOOST_CHECK_SMALL( estimationError.segment( 6 * i, 3 ).norm( ), 1.0E-3 );
+        BOOST_CHECK_SMALL( estimationError.segment( 6 * i + 3, 3 ).norm( ), 1.0E-6 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
@@ -0,0 +1,282 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/SimulationSetup/tudatSimulationHeader.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/SimulationSetup/EstimationSetup/orbitDeterminationManager.h"
+#include "Tudat/SimulationSetup/EstimationSetup/earthOrbiterEstimationTestSetup.h"
+#if USE_CSPICE
+#include "Tudat/External/SpiceInterface/spiceEphemeris.h"
+#include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
+#endif
+
+namespace tudat
+{
+namespace unit_tests
+{
+BOOST_AUTO_TEST_SUITE( test_multi_threaded_estimation )
+
+//Using declarations.
+using namespace tudat::observation_models;
+using namespace tudat::orbit_determination;
+using namespace tudat::estimatable_parameters;
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::ephemerides;
+using namespace tudat::propagators;
+using namespace tudat::basic_astrodynamics;
+
+//! Function to check whether two matrices are exactly equal
+static void checkMatricesAreEqual( const Eigen::MatrixXd& firstMatrix, const Eigen::MatrixXd& secondMatrix )
+{
+    BOOST_CHECK_EQUAL( firstMatrix.rows( ), secondMatrix.rows( ) );
+    BOOST_CHECK_EQUAL( firstMatrix.cols( ), secondMatrix.cols( ) );
+    if( ( firstMatrix.rows( ) == secondMatrix.rows( ) ) && ( firstMatrix.cols( ) == secondMatrix.cols( ) ) )
+    {
+        for( int i = 0; i < firstMatrix.rows( ); i++ )
+        {
+            for( int j = 0; j < firstMatrix.cols( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( firstMatrix( i, j ), secondMatrix( i, j ) );
+            }
+        }
+    }
+}
+
+//! Function to check whether observations, partials, normal equations and estimation results are independent of the
+//! number of threads, for a given global frame origin.
+static void checkEstimationIndependenceOfNumberOfThreads( const std::string& globalFrameOrigin )
+{
+    // Create Earth from analytical models (no Spice), so that observation models can be evaluated concurrently.
+    const double initialTime = 1.0E7;
+    const double finalTime = initialTime + 86400.0;
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( initialTime, false, globalFrameOrigin );
+
+    // Create propagation settings
+    std::vector< std::string > bodiesToIntegrate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                getEarthOrbiterTestKeplerianInitialState( ), earthOrbiterTestGravitationalParameter );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >
+            ( centralBodies, createEarthOrbiterTestAccelerationModels( bodyMap ), bodiesToIntegrate,
+              systemInitialState, finalTime );
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< IntegratorSettings< double > >( rungeKutta4, initialTime, 30.0 );
+
+    // Define observation links: three sets of link ends (fewer than the maximum number of threads that is tested).
+    std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable = getEarthOrbiterTestLinkEnds( );
+
+    // Create parameters and orbit determination object.
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate = createParametersToEstimate(
+                getEarthOrbiterTestParameterSettings(
+                    std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                        "Vehicle", systemInitialState, "Earth" ) ), bodyMap );
+
+    OrbitDeterminationManager< double, double > orbitDeterminationManager(
+                bodyMap, parametersToEstimate, getEarthOrbiterTestObservationSettings( linkEndsPerObservable ),
+                integratorSettings, propagatorSettings );
+
+    // Simulate observations
+    std::vector< double > observationTimes;
+    for( double currentTime = initialTime + 600.0; currentTime < finalTime - 600.0; currentTime += 120.0 )
+    {
+        observationTimes.push_back( currentTime );
+    }
+    PodInput< double, double >::PodInputDataType observationsAndTimes = simulateEarthOrbiterTestObservations(
+                linkEndsPerObservable, observationTimes, orbitDeterminationManager.getObservationSimulators( ) );
+    int numberOfObservations = 0;
+    for( auto observableIterator : observationsAndTimes )
+    {
+        for( auto linkEndIterator : observableIterator.second )
+        {
+            numberOfObservations += linkEndIterator.second.first.rows( );
+        }
+    }
+
+    // Define perturbation of parameters
+    Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+    const int numberOfParameters = truthParameters.rows( );
+    Eigen::VectorXd parameterPerturbation = getEarthOrbiterTestParameterPerturbation( );
+
+    std::map< observation_models::ObservableType, double > weightPerObservable = getEarthOrbiterTestWeightPerObservable( );
+    Eigen::VectorXd weightsVector = Eigen::VectorXd::Zero( numberOfObservations );
+    int currentIndex = 0;
+    for( auto observableIterator : observationsAndTimes )
+    {
+        for( auto linkEndIterator : observableIterator.second )
+        {
+            weightsVector.segment( currentIndex, linkEndIterator.second.first.rows( ) ).setConstant(
+                        weightPerObservable.at( observableIterator.first ) );
+            currentIndex += linkEndIterator.second.first.rows( );
+        }
+    }
+
+    std::vector< unsigned int > numberOfThreadsList = { 1, 2, 4 };
+    std::vector< std::pair< Eigen::VectorXd, Eigen::MatrixXd > > residualsAndPartialsList;
+    std::vector< Eigen::MatrixXd > normalMatrixList;
+    std::vector< Eigen::VectorXd > normalEquationsRightHandSideList;
+    std::vector< std::vector< std::shared_ptr< PodOutput< double > > > > podOutputList;
+    for( unsigned int i = 0; i < numberOfThreadsList.size( ); i++ )
+    {
+        orbitDeterminationManager.setNumberOfThreads( numberOfThreadsList.at( i ) );
+        BOOST_CHECK_EQUAL( orbitDeterminationManager.getNumberOfThreads( ), numberOfThreadsList.at( i ) );
+
+        // Compute residuals, partials and normal equations directly, at perturbed parameter values
+        orbitDeterminationManager.resetParameterEstimate( truthParameters + parameterPerturbation );
+
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > residualsAndPartials;
+        orbitDeterminationManager.calculateObservationMatrixAndResiduals(
+                    observationsAndTimes, numberOfParameters, numberOfObservations, residualsAndPartials );
+        residualsAndPartialsList.push_back( residualsAndPartials );
+
+        Eigen::VectorXd accumulatedResiduals;
+        linear_algebra::NormalEquationsAccumulator normalEquations( numberOfParameters );
+        orbitDeterminationManager.calculateNormalEquationsAndResiduals(
+                    observationsAndTimes, numberOfObservations, weightsVector, 50, accumulatedResiduals, normalEquations );
+        checkMatricesAreEqual( accumulatedResiduals, residualsAndPartials.first );
+        normalMatrixList.push_back( normalEquations.getNormalMatrix( ) );
+        normalEquationsRightHandSideList.push_back( normalEquations.getRightHandSide( ) );
+
+        // Perform full estimation, both with full partials matrix and with accumulated normal equations
+        podOutputList.resize( i + 1 );
+        for( int useAccumulation = 0; useAccumulation < 2; useAccumulation++ )
+        {
+            parametersToEstimate->resetParameterValues< double >( truthParameters );
+            std::shared_ptr< PodInput< double, double > > podInput =
+                    std::make_shared< PodInput< double, double > >(
+                        observationsAndTimes, numberOfParameters, Eigen::MatrixXd::Zero( 0, 0 ), parameterPerturbation );
+            podInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
+            podInput->defineEstimationSettings( true, true, true, false, true );
+            if( useAccumulation == 1 )
+            {
+                podInput->setAccumulateNormalEquations( true, 50 );
+            }
+            podOutputList.at( i ).push_back( orbitDeterminationManager.estimateParameters(
+                                                 podInput, std::make_shared< EstimationConvergenceChecker >( 3 ) ) );
+        }
+    }
+
+    // Check that results with multiple threads are identical to those with a single thread
+    for( unsigned int i = 1; i < numberOfThreadsList.size( ); i++ )
+    {
+        checkMatricesAreEqual( residualsAndPartialsList.at( i ).first, residualsAndPartialsList.at( 0 ).first );
+        checkMatricesAreEqual( residualsAndPartialsList.at( i ).second, residualsAndPartialsList.at( 0 ).second );
+        checkMatricesAreEqual( normalMatrixList.at( i ), normalMatrixList.at( 0 ) );
+        checkMatricesAreEqual( normalEquationsRightHandSideList.at( i ), normalEquationsRightHandSideList.at( 0 ) );
+
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            std::shared_ptr< PodOutput< double > > podOutput = podOutputList.at( i ).at( j );
+            std::shared_ptr< PodOutput< double > > singleThreadPodOutput = podOutputList.at( 0 ).at( j );
+
+            checkMatricesAreEqual( podOutput->parameterEstimate_, singleThreadPodOutput->parameterEstimate_ );
+            checkMatricesAreEqual( podOutput->residuals_, singleThreadPodOutput->residuals_ );
+            checkMatricesAreEqual( podOutput->normalizedInformationMatrix_,
+                                   singleThreadPodOutput->normalizedInformationMatrix_ );
+            checkMatricesAreEqual( podOutput->inverseNormalizedCovarianceMatrix_,
+                                   singleThreadPodOutput->inverseNormalizedCovarianceMatrix_ );
+            checkMatricesAreEqual( podOutput->getResidualHistoryMatrix( ), singleThreadPodOutput->getResidualHistoryMatrix( ) );
+        }
+    }
+
+    // Check that estimation has converged to the true parameter values
+    for( unsigned int j = 0; j < 2; j++ )
+    {
+        Eigen::VectorXd estimationError = podOutputList.at( 0 ).at( j )->parameterEstimate_ - truthParameters;
+        BOOST_CHECK_SMALL( estimationError.segment( 0, 3 ).norm( ), 1.0E-3 );
+        BOOST_CHECK_SMALL( estimationError.segment( 3, 3 ).norm( ), 1.0E-6 );
+    }
+
+    // Check that the state of a link end body is computed without modifying the current state of the body that is its
+    // ephemeris origin (as required for concurrent evaluation of the observation models).
+    const Eigen::Vector6d earthTestState = Eigen::Vector6d::Constant( 1.0 );
+    bodyMap.at( "Earth" )->setState( earthTestState );
+    Eigen::Vector6d vehicleState =
+            bodyMap.at( "Vehicle" )->computeStateInBaseFrameFromEphemeris< double, double >( initialTime + 1234.5 );
+    checkMatricesAreEqual( bodyMap.at( "Earth" )->getState( ), earthTestState );
+    checkMatricesAreEqual( vehicleState, bodyMap.at( "Vehicle" )->getEphemeris( )->getCartesianState( initialTime + 1234.5 ) );
+}
+
+//! Test whether observations, partials, normal equations and estimation results are independent of the number of threads
+BOOST_AUTO_TEST_CASE( test_MultiThreadedEstimation )
+{
+    checkEstimationIndependenceOfNumberOfThreads( "Earth" );
+}
+
+//! Test whether results are independent of the number of threads when the ephemeris origin of a link end body (Vehicle,
+//! w.r.t. Earth) is not the global frame origin (SSB), so that the state of its origin is needed for each observation.
+BOOST_AUTO_TEST_CASE( test_MultiThreadedEstimationWithNonGlobalEphemerisOrigin )
+{
+    checkEstimationIndependenceOfNumberOfThreads( "SSB" );
+}
+
+#if USE_CSPICE
+//! Test whether bodies with environment models that call Spice directly are detected, so that the use of multiple threads
+//! can be rejected.
+BOOST_AUTO_TEST_CASE( test_SpiceEnvironmentModelsInObservations )
+{
+    // Create bodies: Earth with Spice rotation model, Moon with Spice ephemeris (origin of vehicle ephemeris), Sun with
+    // Spice ephemeris (only used for light-time correction), Mars with Spice ephemeris (not used in observations).
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = std::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( std::make_shared< ConstantEphemeris >( Eigen::Vector6d::Zero( ), "SSB" ) );
+    bodyMap[ "Earth" ]->setRotationalEphemeris( std::make_shared< SpiceRotationalEphemeris >( "ECLIPJ2000", "IAU_Earth" ) );
+    bodyMap[ "Moon" ] = std::make_shared< Body >( );
+    bodyMap[ "Moon" ]->setEphemeris( std::make_shared< SpiceEphemeris >( "Moon", "SSB", false, false ) );
+    bodyMap[ "Sun" ] = std::make_shared< Body >( );
+    bodyMap[ "Sun" ]->setEphemeris( std::make_shared< SpiceEphemeris >( "Sun", "SSB", false, false ) );
+    bodyMap[ "Mars" ] = std::make_shared< Body >( );
+    bodyMap[ "Mars" ]->setEphemeris( std::make_shared< SpiceEphemeris >( "Mars", "SSB", false, false ) );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< ConstantEphemeris >( Eigen::Vector6d::Zero( ), "Moon" ) );
+
+    LinkEnds stationLinkEnds;
+    stationLinkEnds[ transmitter ] = std::make_pair( "Earth", "Station1" );
+    stationLinkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+
+    LinkEnds vehicleLinkEnds;
+    vehicleLinkEnds[ observed_body ] = std::make_pair( "Vehicle", "" );
+
+    // Check detection of Spice models through link end bodies, ephemeris origins and light-time corrections.
+    SortedObservationSettingsMap observationSettingsMap;
+    observationSettingsMap[ position_observable ][ vehicleLinkEnds ] =
+            std::make_shared< ObservationSettings >( position_observable );
+    BOOST_CHECK( getBodiesWithSpiceEnvironmentModelsInObservations( bodyMap, observationSettingsMap ) ==
+                 std::vector< std::string >( { "Moon" } ) );
+
+    observationSettingsMap[ one_way_range ][ stationLinkEnds ] = std::make_shared< ObservationSettings >(
+                one_way_range, std::make_shared< FirstOrderRelativisticLightTimeCorrectionSettings >(
+                    std::vector< std::string >( { "Sun" } ) ) );
+    BOOST_CHECK( getBodiesWithSpiceEnvironmentModelsInObservations( bodyMap, observationSettingsMap ) ==
+                 std::vector< std::string >( { "Earth", "Moon", "Sun" } ) );
+
+    // Check that no bodies are returned if Spice models are not used in observations.
+    bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< ConstantEphemeris >( Eigen::Vector6d::Zero( ), "Earth" ) );
+    observationSettingsMap.erase( one_way_range );
+    BOOST_CHECK( getBodiesWithSpiceEnvironmentModelsInObservations( bodyMap, observationSettingsMap ).empty( ) );
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
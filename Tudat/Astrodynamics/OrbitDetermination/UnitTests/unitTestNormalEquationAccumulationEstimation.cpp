@@ -0,0 +1,161 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/SimulationSetup/tudatSimulationHeader.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/SimulationSetup/EstimationSetup/orbitDeterminationManager.h"
+#include "Tudat/SimulationSetup/EstimationSetup/earthOrbiterEstimationTestSetup.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+BOOST_AUTO_TEST_SUITE( test_normal_equation_accumulation_estimation )
+
+//Using declarations.
+using namespace tudat::observation_models;
+using namespace tudat::orbit_determination;
+using namespace tudat::estimatable_parameters;
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::ephemerides;
+using namespace tudat::propagators;
+using namespace tudat::basic_astrodynamics;
+
+//! Test whether estimation from accumulated normal equations gives the same results as from the full partials matrix
+BOOST_AUTO_TEST_CASE( test_NormalEquationAccumulationEstimation )
+{
+    // Create Earth from analytical models.
+    const double initialTime = 1.0E7;
+    const double finalTime = initialTime + 86400.0;
+    NamedBodyMap bodyMap = createEarthOrbiterTestBodies( initialTime );
+
+    // Create propagation settings
+    std::vector< std::string > bodiesToIntegrate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                getEarthOrbiterTestKeplerianInitialState( ), earthOrbiterTestGravitationalParameter );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >
+            ( centralBodies, createEarthOrbiterTestAccelerationModels( bodyMap ), bodiesToIntegrate,
+              systemInitialState, finalTime );
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< IntegratorSettings< double > >( rungeKutta4, initialTime, 30.0 );
+
+    // Create parameters and orbit determination object.
+    std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable = getEarthOrbiterTestLinkEnds( );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate = createParametersToEstimate(
+                getEarthOrbiterTestParameterSettings(
+                    std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                        "Vehicle", systemInitialState, "Earth" ) ), bodyMap );
+
+    OrbitDeterminationManager< double, double > orbitDeterminationManager(
+                bodyMap, parametersToEstimate, getEarthOrbiterTestObservationSettings( linkEndsPerObservable ),
+                integratorSettings, propagatorSettings );
+
+    // Simulate observations
+    std::vector< double > observationTimes;
+    for( double currentTime = initialTime + 600.0; currentTime < finalTime - 600.0; currentTime += 120.0 )
+    {
+        observationTimes.push_back( currentTime );
+    }
+    PodInput< double, double >::PodInputDataType observationsAndTimes = simulateEarthOrbiterTestObservations(
+                linkEndsPerObservable, observationTimes, orbitDeterminationManager.getObservationSimulators( ) );
+
+    // Define perturbation of parameters
+    Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+    const int numberOfParameters = truthParameters.rows( );
+    Eigen::VectorXd parameterPerturbation = getEarthOrbiterTestParameterPerturbation( );
+
+    // Define a priori covariance for initial state and gravitational parameter
+    Eigen::MatrixXd inverseAprioriCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    inverseAprioriCovariance.block( 0, 0, 3, 3 ) = Eigen::Matrix3d::Identity( ) / ( 100.0 * 100.0 );
+    inverseAprioriCovariance.block( 3, 3, 3, 3 ) = Eigen::Matrix3d::Identity( ) / ( 0.1 * 0.1 );
+    inverseAprioriCovariance( 6, 6 ) = 1.0 / ( 1.0E8 * 1.0E8 );
+
+    std::map< observation_models::ObservableType, double > weightPerObservable = getEarthOrbiterTestWeightPerObservable( );
+
+    // Perform estimation from full partials matrix (test 0), and from normal equations accumulated in blocks of
+    // observations (test 1)
+    std::vector< std::shared_ptr< PodOutput< double > > > podOutputList;
+    for( int test = 0; test < 2; test++ )
+    {
+        parametersToEstimate->resetParameterValues< double >( truthParameters );
+        std::shared_ptr< PodInput< double, double > > podInput =
+                std::make_shared< PodInput< double, double > >(
+                    observationsAndTimes, numberOfParameters, inverseAprioriCovariance, parameterPerturbation );
+        podInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
+        podInput->defineEstimationSettings( true, true, true, false, true );
+        if( test == 1 )
+        {
+            podInput->setAccumulateNormalEquations( true, 37 );
+        }
+        podOutputList.push_back( orbitDeterminationManager.estimateParameters(
+                                     podInput, std::make_shared< EstimationConvergenceChecker >( 3 ) ) );
+    }
+
+    std::shared_ptr< PodOutput< double > > denseOutput = podOutputList.at( 0 );
+    std::shared_ptr< PodOutput< double > > accumulatedOutput = podOutputList.at( 1 );
+
+    // Check that partials matrix is only stored when using full partials matrix
+    BOOST_CHECK_EQUAL( denseOutput->normalizedInformationMatrix_.rows( ), denseOutput->residuals_.rows( ) );
+    BOOST_CHECK_EQUAL( accumulatedOutput->normalizedInformationMatrix_.rows( ), 0 );
+
+    // Check parameter corrections in each iteration, and final estimate, w.r.t. formal errors of the estimation
+    Eigen::VectorXd formalErrors = denseOutput->getFormalErrorVector( );
+    BOOST_CHECK_EQUAL( denseOutput->parameterHistory_.size( ), accumulatedOutput->parameterHistory_.size( ) );
+    for( unsigned int i = 1; i < denseOutput->parameterHistory_.size( ); i++ )
+    {
+        Eigen::VectorXd denseCorrection =
+                denseOutput->parameterHistory_.at( i ) - denseOutput->parameterHistory_.at( i - 1 );
+        Eigen::VectorXd accumulatedCorrection =
+                accumulatedOutput->parameterHistory_.at( i ) - accumulatedOutput->parameterHistory_.at( i - 1 );
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            BOOST_CHECK_SMALL( ( denseCorrection( j ) - accumulatedCorrection( j ) ) / formalErrors( j ), 1.0E-4 );
+        }
+    }
+
+    for( int j = 0; j < numberOfParameters; j++ )
+    {
+        BOOST_CHECK_SMALL( ( denseOutput->parameterEstimate_( j ) - accumulatedOutput->parameterEstimate_( j ) ) /
+                           formalErrors( j ), 1.0E-4 );
+    }
+
+    // Check residuals and (inverse) covariance
+    BOOST_CHECK_SMALL( ( denseOutput->residuals_ - accumulatedOutput->residuals_ ).cwiseAbs( ).maxCoeff( ), 1.0E-4 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( denseOutput->getUnnormalizedInverseCovarianceMatrix( ),
+                                       accumulatedOutput->getUnnormalizedInverseCovarianceMatrix( ), 1.0E-10 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( denseOutput->getFormalErrorVector( ),
+                                       accumulatedOutput->getFormalErrorVector( ), 1.0E-8 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( denseOutput->getCorrelationMatrix( ),
+                                       accumulatedOutput->getCorrelationMatrix( ), 1.0E-8 );
+
+    // Check that estimation has converged to the true parameter values
+    Eigen::VectorXd estimationError = accumulatedOutput->parameterEstimate_ - truthParameters;
+    BOOST_CHECK_SMALL( estimationError.segment( 0, 3 ).norm( ), 1.0E-3 );
+    BOOST_CHECK_SMALL( estimationError.segment( 3, 3 ).norm( ), 1.0E-6 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
@@ -68,7 +68,10 @@ public:
         saveInformationMatrix_( true ),
         printOutput_( true ),
         saveResidualsAndParametersFromEachIteration_( true ),
-        saveStateHistoryForEachIteration_( false )
+        saveStateHistoryForEachIteration_( false ),
+        accumulateNormalEquations_( false ),
+        maximumObservationBlockSize_( 10000 ),
+        useArcWiseBlockStructure_( true )
     {
         if( inverseOfAprioriCovariance_.rows( ) == 0 )
         {
@@ -217,6 +220,37 @@ public:
         saveStateHistoryForEachIteration_ = saveStateHistoryForEachIteration;
     }
 
+    //! Function to define whether the normal equations are accumulated per block of observations
+    /*!
+     *  Function to define whether the normal equations are accumulated per block of observations during the estimation,
+     *  instead of computing the full matrix of partials (with size number of observations x number of parameters). In
+     *  this mode, the partials of at most maximumObservationBlockSize observation times (per set of link ends) are stored
+     *  at any given time, and the normal equations are solved with a (pivoted) Cholesky decomposition, with SVD only used
+     *  as fall-back. Since the matrix of partials is never stored, it is not saved in the output, regardless of the
+     *  saveInformationMatrix setting in defineEstimationSettings. For a multi-arc estimation (with arc-wise initial states),
+     *  the normal equations can additionally be stored and solved in block-sparse form (see
+     *  linear_algebra::BlockSparseNormalEquations), so that memory use and solution time scale linearly with the number of
+     *  arcs. This requires that each observation depends on the initial states of a single arc only, and that the a priori
+     *  covariance does not couple the initial states of different arcs.
+     *  \param accumulateNormalEquations Boolean denoting whether the normal equations are to be accumulated per block
+     *  \param maximumObservationBlockSize Maximum number of observation times per block, for which partials are computed
+     *  and added to the normal equations at once
+     *  \param useArcWiseBlockStructure Boolean denoting whether the normal equations of a multi-arc estimation are to be
+     *  stored and solved in block-sparse form (ignored for single-arc estimation)
+     */
+    void setAccumulateNormalEquations( const bool accumulateNormalEquations = true,
+                                       const int maximumObservationBlockSize = 10000,
+                                       const bool useArcWiseBlockStructure = true )
+    {
+        if( maximumObservationBlockSize <= 0 )
+        {
+            throw std::runtime_error( "Error when setting normal equation accumulation, block size must be positive" );
+        }
+        accumulateNormalEquations_ = accumulateNormalEquations;
+        maximumObservationBlockSize_ = maximumObservationBlockSize;
+        useArcWiseBlockStructure_ = useArcWiseBlockStructure;
+    }
+
     //! Function to return the total data structure of observations and associated times/link ends/type (by reference)
     /*!
      * Function to return the total data structure of observations and associated times/link ends/type (by reference)
@@ -320,6 +354,36 @@ public:
         return saveStateHistoryForEachIteration_;
     }
 
+    //! Function to return the boolean denoting whether the normal equations are accumulated per block of observations
+    /*!
+     * Function to return the boolean denoting whether the normal equations are accumulated per block of observations
+     * \return Boolean denoting whether the normal equations are accumulated per block of observations
+     */
+    bool getAccumulateNormalEquations( )
+    {
+        return accumulateNormalEquations_;
+    }
+
+    //! Function to return the maximum number of observation times per block, when accumulating the normal equations
+    /*!
+     * Function to return the maximum number of observation times per block, when accumulating the normal equations
+     * \return Maximum number of observation times per block, when accumulating the normal equations
+     */
+    int getMaximumObservationBlockSize( )
+    {
+        return maximumObservationBlockSize_;
+    }
+
+    //! Function to return the boolean denoting whether multi-arc normal equations are stored and solved in block-sparse form
+    /*!
+     * Function to return the boolean denoting whether multi-arc normal equations are stored and solved in block-sparse form
+     * \return Boolean denoting whether multi-arc normal equations are stored and solved in block-sparse form
+     */
+    bool getUseArcWiseBlockStructure( )
+    {
+        return useArcWiseBlockStructure_;
+    }
+
 private:
     //! Total data structure of observations and associated times/link ends/type
     PodInputDataType observationsAndTimes_;
@@ -352,6 +416,15 @@ private:
     //! Boolean denoting whether the state history is to be saved on each iteration.
     bool saveStateHistoryForEachIteration_;
 
+    //! Boolean denoting whether the normal equations are accumulated per block of observations
+    bool accumulateNormalEquations_;
+
+    //! Maximum number of observation times per block, when accumulating the normal equations
+    int maximumObservationBlockSize_;
+
+    //! Boolean denoting whether multi-arc normal equations are stored and solved in block-sparse form
+    bool useArcWiseBlockStructure_;
+
 };
 
 //! Class that is used during the orbit determination/parameter estimation to determine whether the estimation is converged.
@@ -20,6 +20,8 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
 #include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
@@ -585,6 +587,186 @@ BOOST_AUTO_TEST_CASE( test_NonConservativeForceEnvironmentUpdate )
     }
 }
 
+//! Test whether environment models that depend only on time are updated only once per distinct time.
+BOOST_AUTO_TEST_CASE( test_EnvironmentUpdateSkipping )
+{
+    // Create bodies with analytical ephemerides and rotation model.
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = std::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( std::make_shared< ephemerides::KeplerEphemeris >(
+                                          ( Eigen::Vector6d( ) << 1.496E11, 0.0167, 0.0, 1.8, 0.0, 0.1 ).finished( ),
+                                          0.0, 1.32712440018E20, "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Earth" ]->setRotationalEphemeris( std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                                                    0.1, 1.3, 0.4, 7.292115E-5, 0.0, "ECLIPJ2000", "IAU_Earth" ) );
+    bodyMap[ "Moon" ] = std::make_shared< Body >( );
+    bodyMap[ "Moon" ]->setEphemeris( std::make_shared< ephemerides::KeplerEphemeris >(
+                                         ( Eigen::Vector6d( ) << 1.5E11, 0.05, 0.1, 1.0, 0.5, 0.2 ).finished( ),
+                                         0.0, 1.32712440018E20, "SSB", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > > environmentModelsToUpdate;
+    environmentModelsToUpdate[ body_rotational_state_update ].push_back( "Earth" );
+    environmentModelsToUpdate[ body_translational_state_update ].push_back( "Moon" );
+    environmentModelsToUpdate[ body_translational_state_update ].push_back( "Earth" );
+
+    std::shared_ptr< propagators::EnvironmentUpdater< double, double > > updater =
+            std::make_shared< propagators::EnvironmentUpdater< double, double > >(
+                bodyMap, environmentModelsToUpdate );
+
+    // Check update order and dependencies
+    std::vector< std::pair< EnvironmentModelsToUpdate, std::string > > updateOrder = updater->getUpdateOrder( );
+    BOOST_CHECK_EQUAL( updateOrder.size( ), 3 );
+    BOOST_CHECK_EQUAL( updateOrder.at( 0 ).first, body_translational_state_update );
+    BOOST_CHECK_EQUAL( updateOrder.at( 0 ).second, "Moon" );
+    BOOST_CHECK_EQUAL( updateOrder.at( 1 ).first, body_translational_state_update );
+    BOOST_CHECK_EQUAL( updateOrder.at( 1 ).second, "Earth" );
+    BOOST_CHECK_EQUAL( updateOrder.at( 2 ).first, body_rotational_state_update );
+    BOOST_CHECK_EQUAL( updateOrder.at( 2 ).second, "Earth" );
+    BOOST_CHECK_EQUAL( updater->getUpdateFunctionDependencies( ).at( 2 ).size( ), 0 );
+
+    // Update environment at times of a single RK4 step, and check that environment is updated correctly.
+    const double initialTime = 1.0E7;
+    const double timeStep = 60.0;
+    std::vector< double > evaluationTimes =
+    { initialTime, initialTime + timeStep / 2.0, initialTime + timeStep / 2.0, initialTime + timeStep };
+    for( int test = 0; test < 2; test++ )
+    {
+        updater->resetUpdateStatistics( );
+        updater->setSkipRedundantUpdates( test == 0 );
+        for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+        {
+            updater->updateEnvironment(
+                        evaluationTimes.at( i ), std::unordered_map< IntegratedStateType, Eigen::VectorXd >( ) );
+
+            BOOST_CHECK_EQUAL(
+                        ( bodyMap.at( "Earth" )->getState( ) -
+                          bodyMap.at( "Earth" )->getEphemeris( )->getCartesianState( evaluationTimes.at( i ) ) ).norm( ),
+                        0.0 );
+            BOOST_CHECK_EQUAL(
+                        ( bodyMap.at( "Moon" )->getState( ) -
+                          bodyMap.at( "Moon" )->getEphemeris( )->getCartesianState( evaluationTimes.at( i ) ) ).norm( ),
+                        0.0 );
+            BOOST_CHECK_EQUAL(
+                        ( bodyMap.at( "Earth" )->getCurrentRotationToLocalFrame( ).toRotationMatrix( ) -
+                          bodyMap.at( "Earth" )->getRotationalEphemeris( )->getRotationToTargetFrame(
+                              evaluationTimes.at( i ) ).toRotationMatrix( ) ).norm( ), 0.0 );
+        }
+
+        // Check that updates at repeated time are skipped (if requested)
+        if( test == 0 )
+        {
+            BOOST_CHECK_EQUAL( updater->getNumberOfEvaluatedUpdates( ), 9 );
+            BOOST_CHECK_EQUAL( updater->getNumberOfSkippedUpdates( ), 3 );
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL( updater->getNumberOfEvaluatedUpdates( ), 12 );
+            BOOST_CHECK_EQUAL( updater->getNumberOfSkippedUpdates( ), 0 );
+        }
+    }
+
+    // Check that all models are updated after reset of cached times.
+    updater->setSkipRedundantUpdates( true );
+    updater->resetUpdateStatistics( );
+    updater->updateEnvironment( initialTime, std::unordered_map< IntegratedStateType, Eigen::VectorXd >( ) );
+    updater->updateEnvironment( initialTime, std::unordered_map< IntegratedStateType, Eigen::VectorXd >( ) );
+    updater->resetCachedUpdateTimes( );
+    updater->updateEnvironment( initialTime, std::unordered_map< IntegratedStateType, Eigen::VectorXd >( ) );
+    BOOST_CHECK_EQUAL( updater->getNumberOfEvaluatedUpdates( ), 6 );
+    BOOST_CHECK_EQUAL( updater->getNumberOfSkippedUpdates( ), 3 );
+}
+
+//! Function to propagate a vehicle about an Earth that is tidally deformed by a (propagated) moon.
+static std::map< double, Eigen::VectorXd > propagateAboutTidallyDeformedBody( const bool skipRedundantUpdates )
+{
+    // Create Earth, with tidal gravity field variations (without interpolation) due to moon.
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+    bodySettings[ "Earth" ]->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+                "ECLIPJ2000", "IAU_Earth",
+                Eigen::Quaterniond( Eigen::AngleAxisd( 0.4, Eigen::Vector3d::UnitX( ) ) ), 0.0, 7.292115E-5 );
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.84165E-4;
+    cosineCoefficients( 2, 2 ) = 2.43914E-6;
+    sineCoefficients( 2, 2 ) = -1.40016E-6;
+    bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< SphericalHarmonicsGravityFieldSettings >(
+                3.986004418E14, 6378137.0, cosineCoefficients, sineCoefficients, "IAU_Earth" );
+    std::vector< std::vector< std::complex< double > > > loveNumbers =
+    { { std::complex< double >( 0.3, 0.0 ), std::complex< double >( 0.3, 0.0 ), std::complex< double >( 0.3, 0.0 ) } };
+    bodySettings[ "Earth" ]->gravityFieldVariationSettings.push_back(
+                std::make_shared< BasicSolidBodyGravityFieldVariationSettings >(
+                    std::vector< std::string >( { "Moon" } ), loveNumbers, 6378137.0 ) );
+
+    // Create massive, close moon, so that the tidal deformation depends strongly on its current state.
+    bodySettings[ "Moon" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Moon" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+    bodySettings[ "Moon" ]->gravityFieldSettings = std::make_shared< CentralGravityFieldSettings >( 3.986004418E13 );
+
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create accelerations
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Moon" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< SphericalHarmonicAccelerationSettings >( 2, 2 ) );
+    accelerationSettings[ "Vehicle" ][ "Moon" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Moon", "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth", "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettings, bodiesToPropagate, centralBodies );
+
+    // Create propagation settings
+    Eigen::VectorXd initialStates = Eigen::VectorXd::Zero( 12 );
+    initialStates.segment( 0, 6 ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                ( Eigen::Vector6d( ) << 2.0E7, 0.05, 0.3, 0.1, 0.2, 0.0 ).finished( ), 3.986004418E14 * 1.1 );
+    initialStates.segment( 6, 6 ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                ( Eigen::Vector6d( ) << 7.0E6, 0.01, 1.0, 0.5, 1.0, 0.0 ).finished( ), 3.986004418E14 );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialStates, 4.0 * 3600.0 );
+    std::shared_ptr< numerical_integrators::IntegratorSettings< > > integratorSettings =
+            std::make_shared< numerical_integrators::IntegratorSettings< > >(
+                numerical_integrators::rungeKutta4, 0.0, 60.0 );
+
+    // Propagate dynamics, with or without skipping of redundant environment updates.
+    SingleArcDynamicsSimulator< double, double > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, false, false, false );
+    dynamicsSimulator.getEnvironmentUpdater( )->setSkipRedundantUpdates( skipRedundantUpdates );
+    dynamicsSimulator.integrateEquationsOfMotion( initialStates );
+
+    return dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+}
+
+//! Test whether skipping of environment updates leaves tidal gravity field variations unaffected, when the deforming
+//! body is numerically propagated (so that it has different states at Runge-Kutta stages that share a time).
+BOOST_AUTO_TEST_CASE( test_EnvironmentUpdateSkippingWithTidalVariations )
+{
+    std::map< double, Eigen::VectorXd > stateHistoryWithSkipping = propagateAboutTidallyDeformedBody( true );
+    std::map< double, Eigen::VectorXd > stateHistoryWithoutSkipping = propagateAboutTidallyDeformedBody( false );
+
+    BOOST_CHECK_EQUAL( stateHistoryWithSkipping.size( ), stateHistoryWithoutSkipping.size( ) );
+    std::map< double, Eigen::VectorXd >::const_iterator unskippedIterator = stateHistoryWithoutSkipping.begin( );
+    for( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = stateHistoryWithSkipping.begin( );
+         stateIterator != stateHistoryWithSkipping.end( ); stateIterator++ )
+    {
+        BOOST_CHECK_EQUAL( stateIterator->first, unskippedIterator->first );
+        for( int i = 0; i < 12; i++ )
+        {
+            BOOST_CHECK_EQUAL( stateIterator->second( i ), unskippedIterator->second( i ) );
+        }
+        unskippedIterator++;
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -10,6 +10,7 @@
 
 #define BOOST_TEST_MAIN
 
+#include <limits>
 #include <string>
 
 #include <boost/make_shared.hpp>
@@ -34,6 +35,7 @@
 #include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createNumericalSimulator.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/defaultBodies.h"
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
 
 
 namespace tudat
@@ -204,6 +206,94 @@ BOOST_AUTO_TEST_CASE( testCowellPropagatorKeplerCompare )
     }
 }
 
+//! Test whether the ephemeris that is reset from the (contiguous) propagation history, for forward and backward
+//! propagation and with a translation from the integration to the ephemeris origin, is consistent with the map of the
+//! numerical solution.
+BOOST_AUTO_TEST_CASE( testEphemerisResetFromPropagationHistory )
+{
+    Eigen::Vector6d earthState;
+    earthState << 1.0E11, -5.0E10, 2.0E9, 1.0E4, 2.0E4, -3.0E2;
+
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        // Create Earth (with constant, non-zero, state w.r.t. SSB) and vehicle
+        NamedBodyMap bodyMap;
+        bodyMap[ "Earth" ] = std::make_shared< Body >( );
+        bodyMap[ "Earth" ]->setEphemeris( std::make_shared< ConstantEphemeris >( earthState, "SSB", "ECLIPJ2000" ) );
+        bodyMap[ "Earth" ]->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+        bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+        bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< TabulatedCartesianEphemeris< > >(
+                                                std::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector6d > >( ),
+                                                "SSB", "ECLIPJ2000" ) );
+        setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+        // Create acceleration models and propagation settings (vehicle propagated w.r.t. Earth, ephemeris w.r.t. SSB)
+        SelectedAccelerationMap accelerationMap;
+        accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+        std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+        std::vector< std::string > centralBodies = { "Earth" };
+        AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                    bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+        Eigen::Vector6d initialKeplerianElements;
+        initialKeplerianElements << 7000.0E3, 0.1, 0.5, 1.0, 2.0, 3.0;
+        Eigen::Vector6d initialState = convertKeplerianToCartesianElements( initialKeplerianElements, 3.986004418E14 );
+
+        double initialTime = ( testCase == 0 ) ? 0.0 : 86400.0;
+        double finalTime = ( testCase == 0 ) ? 86400.0 : 0.0;
+        double timeStep = ( testCase == 0 ) ? 60.0 : -60.0;
+
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                    centralBodies, accelerationModelMap, bodiesToPropagate, initialState, finalTime );
+        std::shared_ptr< IntegratorSettings< > > integratorSettings =
+                std::make_shared< IntegratorSettings< > >( rungeKutta4, initialTime, timeStep );
+
+        SingleArcDynamicsSimulator< > dynamicsSimulator(
+                    bodyMap, integratorSettings, propagatorSettings, true, false, true );
+
+        // Check consistency of map and contiguous history of the numerical solution
+        const PropagationHistory< double, double >& numericalSolutionHistory =
+                dynamicsSimulator.getEquationsOfMotionNumericalSolutionHistory( );
+        std::map< double, Eigen::VectorXd > numericalSolution = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+        BOOST_CHECK_EQUAL( numericalSolutionHistory.size( ), numericalSolution.size( ) );
+        for( unsigned int i = 0; i < numericalSolutionHistory.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( numericalSolution.count( numericalSolutionHistory.getTime( i ) ), 1 );
+            BOOST_CHECK( numericalSolution.at( numericalSolutionHistory.getTime( i ) ) ==
+                         Eigen::VectorXd( numericalSolutionHistory.getState( i ) ) );
+        }
+
+        // Create interpolator from map of numerical solution (translated to SSB), as used before the ephemeris reset
+        // was performed directly from the propagation history.
+        std::map< double, Eigen::Vector6d > ephemerisInput;
+        for( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = numericalSolution.begin( );
+             stateIterator != numericalSolution.end( ); stateIterator++ )
+        {
+            ephemerisInput[ stateIterator->first ] = stateIterator->second - ( -earthState );
+        }
+        LagrangeInterpolator< double, Eigen::Vector6d > mapBasedInterpolator( ephemerisInput, 6 );
+
+        // Create ephemeris (w.r.t. Earth) directly from propagation history
+        std::shared_ptr< TabulatedCartesianEphemeris< > > historyBasedEphemeris = createTabulatedCartesianEphemeris(
+                    numericalSolutionHistory, 0, std::make_shared< LagrangeInterpolatorSettings >( 6 ), "Earth" );
+
+        // Compare reset ephemeris with both interpolated solutions
+        for( double testTime = 1000.0; testTime < 85000.0; testTime += 997.0 )
+        {
+            Eigen::Vector6d resetEphemerisState = bodyMap.at( "Vehicle" )->getEphemeris( )->getCartesianState( testTime );
+            Eigen::Vector6d mapBasedState = mapBasedInterpolator.interpolate( testTime );
+            Eigen::Vector6d historyBasedState = historyBasedEphemeris->getCartesianState( testTime ) + earthState;
+            for( int i = 0; i < 6; i++ )
+            {
+                BOOST_CHECK_EQUAL( resetEphemerisState( i ), mapBasedState( i ) );
+                BOOST_CHECK_CLOSE_FRACTION( resetEphemerisState( i ), historyBasedState( i ),
+                                            std::numeric_limits< double >::epsilon( ) );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 
@@ -0,0 +1,169 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Mathematics/Statistics/randomVariableGenerator.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/monteCarloPropagation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_monte_carlo_propagation )
+
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::basic_astrodynamics;
+
+//! Test whether Monte Carlo propagations are correct, and independent of number of threads.
+BOOST_AUTO_TEST_CASE( testParallelMonteCarloPropagation )
+{
+    const double earthGravitationalParameter = 398600.4415E9;
+    const double simulationEndEpoch = 3.0 * 3600.0;
+
+    // Set nominal initial state
+    Eigen::Vector6d nominalInitialStateInKeplerianElements;
+    nominalInitialStateInKeplerianElements << 7000.0E3, 0.05, 0.8, 1.0, 2.0, 0.5;
+
+    // Define function to create environment (without Spice), to be called once per thread.
+    std::function< NamedBodyMap( ) > bodyMapCreationFunction = [ = ]( )
+    {
+        std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+        bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+        bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                    Eigen::Vector6d::Zero( ), "SSB", "J2000" );
+        bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< CentralGravityFieldSettings >(
+                    earthGravitationalParameter );
+
+        NamedBodyMap bodyMap = createBodies( bodySettings );
+        bodyMap[ "Asterix" ] = std::make_shared< Body >( );
+        setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+        return bodyMap;
+    };
+
+    // Define function to create propagator settings, with sample as perturbation to Keplerian elements.
+    std::function< std::shared_ptr< SingleArcPropagatorSettings< double > >(
+                const NamedBodyMap&, const Eigen::VectorXd& ) > propagatorSettingsCreationFunction =
+            [ = ]( const NamedBodyMap& bodyMap, const Eigen::VectorXd& sample )
+    {
+        SelectedAccelerationMap accelerationSettings;
+        accelerationSettings[ "Asterix" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >(
+                                                                     central_gravity ) );
+        std::map< std::string, std::string > centralBodyMap = { { "Asterix", "Earth" } };
+        AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                    bodyMap, accelerationSettings, centralBodyMap );
+
+        Eigen::Vector6d initialStateInKeplerianElements = nominalInitialStateInKeplerianElements;
+        initialStateInKeplerianElements.segment( 0, 2 ) += sample;
+
+        return std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                    std::vector< std::string >( { "Earth" } ), accelerationModelMap,
+                    std::vector< std::string >( { "Asterix" } ),
+                    convertKeplerianToCartesianElements(
+                        initialStateInKeplerianElements, earthGravitationalParameter ), simulationEndEpoch );
+    };
+
+    std::function< std::shared_ptr< IntegratorSettings< double > >( const Eigen::VectorXd& ) >
+            integratorSettingsCreationFunction = [ ]( const Eigen::VectorXd& )
+    {
+        return std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 5.0 );
+    };
+
+    // Define function to retrieve final state from propagation
+    std::function< Eigen::VectorXd( SingleArcDynamicsSimulator< double, double >&, const int ) >
+            resultExtractionFunction = [ ]( SingleArcDynamicsSimulator< double, double >& dynamicsSimulator, const int )
+    {
+        return dynamicsSimulator.getEquationsOfMotionNumericalSolution( ).rbegin( )->second;
+    };
+
+    // Define distributions of semi-major axis and eccentricity perturbations.
+    std::vector< std::shared_ptr< statistics::RandomVariableGenerator< double > > > randomVariableGenerators;
+    randomVariableGenerators.push_back( statistics::createBoostContinuousRandomVariableGenerator(
+                                            statistics::normal_boost_distribution, { 0.0, 10.0E3 }, 42.0 ) );
+    randomVariableGenerators.push_back( statistics::createBoostContinuousRandomVariableGenerator(
+                                            statistics::uniform_boost_distribution, { 0.0, 0.01 }, 43.0 ) );
+
+    // Propagate samples with single thread.
+    const int numberOfSamples = 24;
+    std::pair< std::vector< Eigen::VectorXd >, std::vector< Eigen::VectorXd > > singleThreadResults =
+            executeParallelMonteCarloPropagation< Eigen::VectorXd >(
+                numberOfSamples, randomVariableGenerators, bodyMapCreationFunction,
+                propagatorSettingsCreationFunction, integratorSettingsCreationFunction, resultExtractionFunction, 1 );
+    std::vector< Eigen::VectorXd > samples = singleThreadResults.first;
+    BOOST_CHECK_EQUAL( samples.size( ), numberOfSamples );
+    BOOST_CHECK_EQUAL( singleThreadResults.second.size( ), numberOfSamples );
+
+    // Propagate same samples with multiple threads, and check that results are identical.
+    for( unsigned int numberOfThreads = 2; numberOfThreads <= 5; numberOfThreads += 3 )
+    {
+        std::vector< Eigen::VectorXd > multiThreadResults =
+                executeParallelMonteCarloPropagation< Eigen::VectorXd >(
+                    samples, bodyMapCreationFunction, propagatorSettingsCreationFunction,
+                    integratorSettingsCreationFunction, resultExtractionFunction, numberOfThreads );
+        for( int i = 0; i < numberOfSamples; i++ )
+        {
+            BOOST_CHECK_EQUAL( ( multiThreadResults.at( i ) - singleThreadResults.second.at( i ) ).cwiseAbs( ).maxCoeff( ),
+                               0.0 );
+        }
+    }
+
+    // Check that boolean results (which are not individually addressable in a std::vector< bool >) are collected
+    // correctly when using multiple threads.
+    std::function< bool( SingleArcDynamicsSimulator< double, double >&, const int ) > booleanResultExtractionFunction =
+            [ = ]( SingleArcDynamicsSimulator< double, double >& dynamicsSimulator, const int )
+    {
+        return dynamicsSimulator.getEquationsOfMotionNumericalSolution( ).rbegin( )->second.segment( 0, 3 ).norm( ) >
+                nominalInitialStateInKeplerianElements( 0 );
+    };
+    std::vector< bool > booleanResults = executeParallelMonteCarloPropagation< bool >(
+                samples, bodyMapCreationFunction, propagatorSettingsCreationFunction,
+                integratorSettingsCreationFunction, booleanResultExtractionFunction, 5 );
+    BOOST_CHECK_EQUAL( booleanResults.size( ), numberOfSamples );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        BOOST_CHECK_EQUAL( booleanResults.at( i ), singleThreadResults.second.at( i ).segment( 0, 3 ).norm( ) >
+                           nominalInitialStateInKeplerianElements( 0 ) );
+    }
+
+    // Check results against analytical Kepler orbit
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        Eigen::Vector6d initialStateInKeplerianElements = nominalInitialStateInKeplerianElements;
+        initialStateInKeplerianElements.segment( 0, 2 ) += samples.at( i );
+
+        Eigen::Vector6d expectedFinalState = convertKeplerianToCartesianElements(
+                    propagateKeplerOrbit( initialStateInKeplerianElements, simulationEndEpoch,
+                                          earthGravitationalParameter ), earthGravitationalParameter );
+        BOOST_CHECK_SMALL( ( singleThreadResults.second.at( i ) - expectedFinalState ).segment( 0, 3 ).norm( ), 1.0E-2 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
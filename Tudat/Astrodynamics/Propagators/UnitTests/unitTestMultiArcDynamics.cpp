@@ -50,7 +50,7 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
     //Load spice kernels.
     spice_interface::loadStandardSpiceKernels( );
 
-    for( unsigned testCase = 0; testCase < 3; testCase++ )
+    for( unsigned testCase = 0; testCase < 4; testCase++ )
     {
         std::vector< std::string > bodyNames;
         bodyNames.push_back( "Earth" );
@@ -170,6 +170,53 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
                         bodyMap, integratorSettings, std::make_shared< MultiArcPropagatorSettings< double > >(
                             arcPropagationSettingsList, true ), integrationArcStarts );
         }
+        // For case 3: test concurrent propagation of arcs, with separate environment and integration settings for each arc
+        else if( testCase == 3 )
+        {
+            std::vector< NamedBodyMap > arcBodyMaps;
+            std::vector< std::shared_ptr< IntegratorSettings< > > > integratorSettingsList;
+            arcPropagationSettingsList.clear( );
+            for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+            {
+                arcBodyMaps.push_back( createBodies( bodySettings ) );
+                setGlobalFrameBodyEphemerides( arcBodyMaps.at( i ), "SSB", "ECLIPJ2000" );
+
+                arcPropagationSettingsList.push_back(
+                            std::make_shared< TranslationalStatePropagatorSettings< double > >
+                            ( centralBodies, createAccelerationModelsMap(
+                                  arcBodyMaps.at( i ), accelerationMap, bodiesToIntegrate, centralBodies ),
+                              bodiesToIntegrate, systemInitialStates.at( i ), integrationArcEnds.at( i ) ) );
+                integratorSettingsList.push_back( std::make_shared< IntegratorSettings< > >
+                                                  ( rungeKutta4, integrationArcStarts.at( i ), 120.0 ) );
+            }
+
+            // Check that environment may not be shared between concurrently propagated arcs
+            BOOST_CHECK_THROW( MultiArcDynamicsSimulator< >(
+                                   bodyMap, std::vector< NamedBodyMap >( numberOfIntegrationArcs, bodyMap ),
+                                   integratorSettingsList, std::make_shared< MultiArcPropagatorSettings< double > >(
+                                       arcPropagationSettingsList ), 4, false ), std::runtime_error );
+
+            // Check that acceleration models may not be shared between concurrently propagated arcs
+            AccelerationMap sharedAccelerationModelMap = createAccelerationModelsMap(
+                        arcBodyMaps.at( 0 ), accelerationMap, bodiesToIntegrate, centralBodies );
+            std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > sharedAccelerationsSettingsList;
+            for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+            {
+                sharedAccelerationsSettingsList.push_back(
+                            std::make_shared< TranslationalStatePropagatorSettings< double > >
+                            ( centralBodies, sharedAccelerationModelMap, bodiesToIntegrate, systemInitialStates.at( i ),
+                              integrationArcEnds.at( i ) ) );
+            }
+            BOOST_CHECK_THROW( MultiArcDynamicsSimulator< >(
+                                   bodyMap, arcBodyMaps, integratorSettingsList,
+                                   std::make_shared< MultiArcPropagatorSettings< double > >(
+                                       sharedAccelerationsSettingsList ), 4, false ), std::runtime_error );
+
+            MultiArcDynamicsSimulator< > dynamicsSimulator(
+                        bodyMap, arcBodyMaps, integratorSettingsList, std::make_shared< MultiArcPropagatorSettings< double > >(
+                            arcPropagationSettingsList ), 4 );
+            BOOST_CHECK_EQUAL( dynamicsSimulator.getNumberOfThreads( ), 4 );
+        }
 
 
         std::shared_ptr< Ephemeris > moonEphemeris = bodyMap.at( "Moon" )->getEphemeris( );
@@ -201,7 +248,7 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
             }
 
             // Check if output corresponds to expected analytical solution
-            if( testCase < 2 || i == 0 )
+            if( testCase != 2 || i == 0 )
             {
                 double currentTestTime = testStartTime;
                 while( currentTestTime < testEndTime )
@@ -10,6 +10,7 @@
 
 #define BOOST_TEST_MAIN
 
+#include <functional>
 #include <string>
 #include <thread>
 
@@ -412,6 +413,126 @@ BOOST_AUTO_TEST_CASE( testEarthMoonMultiArcVariationalEquationCalculation )
 }
 
 
+//! Test whether concurrent propagation of arcs (with separate environment per arc) reproduces sequential propagation.
+BOOST_AUTO_TEST_CASE( testConcurrentMultiArcVariationalEquationCalculation )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    const double initialEphemerisTime = 1.0E7;
+    const double finalEphemerisTime = initialEphemerisTime + 4.0E6;
+    const double arcDuration = 5.0E5;
+
+    // Define function to create environment (used for the environment in which the results are set, and for each arc).
+    std::function< NamedBodyMap( ) > bodyMapCreationFunction = [ = ]( )
+    {
+        std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+                getDefaultBodySettings( { "Earth", "Moon" }, initialEphemerisTime - 3.6E4, finalEphemerisTime + 3.6E4 );
+        bodySettings[ "Moon" ]->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+        NamedBodyMap bodyMap = createBodies( bodySettings );
+        setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+        return bodyMap;
+    };
+
+    // Define arc times.
+    std::vector< double > arcStartTimes, arcEndTimes;
+    double currentStartTime = initialEphemerisTime;
+    while( currentStartTime + arcDuration < finalEphemerisTime )
+    {
+        arcStartTimes.push_back( currentStartTime );
+        arcEndTimes.push_back( currentStartTime + arcDuration );
+        currentStartTime += arcDuration;
+    }
+    const unsigned int numberOfArcs = arcStartTimes.size( );
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    std::map< std::string, std::string > centralBodyMap = { { "Moon", "Earth" } };
+
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back(
+                std::make_shared< ArcWiseInitialTranslationalStateEstimatableParameterSettings< double > >(
+                    "Moon", arcStartTimes, "Earth" ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+
+    // Define function to create propagator settings (with accelerations from given environment for each arc)
+    std::function< std::shared_ptr< MultiArcPropagatorSettings< double > >( const std::vector< NamedBodyMap >& ) >
+            propagatorSettingsCreationFunction = [ & ]( const std::vector< NamedBodyMap >& arcBodyMaps )
+    {
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > propagatorSettingsList;
+        for( unsigned int i = 0; i < numberOfArcs; i++ )
+        {
+            propagatorSettingsList.push_back(
+                        std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                            std::vector< std::string >( { "Earth" } ),
+                            createAccelerationModelsMap( arcBodyMaps.at( i ), accelerationMap, centralBodyMap ),
+                            std::vector< std::string >( { "Moon" } ),
+                            getInitialStatesOfBodies( { "Moon" }, { "Earth" }, arcBodyMaps.at( i ), arcStartTimes.at( i ) ),
+                            arcEndTimes.at( i ) ) );
+        }
+        return std::make_shared< MultiArcPropagatorSettings< double > >( propagatorSettingsList );
+    };
+
+    std::vector< std::shared_ptr< IntegratorSettings< double > > > integratorSettingsList;
+    for( unsigned int i = 0; i < numberOfArcs; i++ )
+    {
+        integratorSettingsList.push_back(
+                    std::make_shared< IntegratorSettings< double > >( rungeKutta4, arcStartTimes.at( i ), 1800.0 ) );
+    }
+
+    // Propagate arcs sequentially, using single environment
+    NamedBodyMap sequentialBodyMap = bodyMapCreationFunction( );
+    std::shared_ptr< MultiArcPropagatorSettings< double > > sequentialPropagatorSettings =
+            propagatorSettingsCreationFunction( std::vector< NamedBodyMap >( numberOfArcs, sequentialBodyMap ) );
+    std::shared_ptr< EstimatableParameterSet< double > > sequentialParameters =
+            createParametersToEstimate( parameterNames, sequentialBodyMap );
+    MultiArcVariationalEquationsSolver< double, double > sequentialVariationalEquations(
+                sequentialBodyMap, integratorSettingsList.at( 0 ), sequentialPropagatorSettings, sequentialParameters,
+                arcStartTimes, true, nullptr, false, true );
+
+    // Propagate arcs concurrently, using separate environment (and parameter set) for each arc
+    NamedBodyMap concurrentBodyMap = bodyMapCreationFunction( );
+    std::vector< NamedBodyMap > arcBodyMaps;
+    std::vector< std::shared_ptr< EstimatableParameterSet< double > > > arcParameters;
+    for( unsigned int i = 0; i < numberOfArcs; i++ )
+    {
+        arcBodyMaps.push_back( bodyMapCreationFunction( ) );
+        arcParameters.push_back( createParametersToEstimate( parameterNames, arcBodyMaps.at( i ) ) );
+        integratorSettingsList[ i ] =
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, arcStartTimes.at( i ), 1800.0 );
+    }
+    std::shared_ptr< MultiArcPropagatorSettings< double > > concurrentPropagatorSettings =
+            propagatorSettingsCreationFunction( arcBodyMaps );
+    std::shared_ptr< EstimatableParameterSet< double > > concurrentParameters =
+            createParametersToEstimate( parameterNames, concurrentBodyMap );
+    MultiArcVariationalEquationsSolver< double, double > concurrentVariationalEquations(
+                concurrentBodyMap, arcBodyMaps, integratorSettingsList, concurrentPropagatorSettings,
+                concurrentParameters, arcParameters, arcStartTimes, 3, false, true );
+
+    // Compare state (transition) histories of both propagations.
+    for( unsigned int arc = 0; arc < numberOfArcs; arc++ )
+    {
+        const double testEpoch = arcEndTimes.at( arc ) - 2.0E4;
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    concurrentVariationalEquations.getStateTransitionMatrixInterface( )->
+                    getCombinedStateTransitionAndSensitivityMatrix( testEpoch ),
+                    sequentialVariationalEquations.getStateTransitionMatrixInterface( )->
+                    getCombinedStateTransitionAndSensitivityMatrix( testEpoch ), 1.0E-12 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    concurrentBodyMap.at( "Moon" )->getEphemeris( )->getCartesianState( testEpoch ),
+                    sequentialBodyMap.at( "Moon" )->getEphemeris( )->getCartesianState( testEpoch ), 1.0E-12 );
+    }
+
+    // Check that parameter values are transferred to environments of all arcs.
+    Eigen::VectorXd parameterEstimate = concurrentParameters->getFullParameterValues< double >( );
+    parameterEstimate( parameterEstimate.rows( ) - 1 ) *= ( 1.0 + 1.0E-6 );
+    concurrentVariationalEquations.resetParameterEstimate( parameterEstimate );
+    for( unsigned int i = 0; i < numberOfArcs; i++ )
+    {
+        BOOST_CHECK_EQUAL( arcBodyMaps.at( i ).at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ),
+                           parameterEstimate( parameterEstimate.rows( ) - 1 ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -43,7 +43,8 @@ using namespace mathematical_constants;
 BOOST_AUTO_TEST_SUITE( test_hybrid_state_derivative_model )
 
 std::map< double, Eigen::VectorXd > propagateKeplerOrbitAndMassState(
-        const int simulationCase )
+        const int simulationCase,
+        const bool saveCumulativeFunctionEvaluations = true )
 {
     using namespace simulation_setup;
     using namespace propagators;
@@ -163,7 +164,21 @@ std::map< double, Eigen::VectorXd > propagateKeplerOrbitAndMassState(
 
     // Create simulation object and propagate dynamics.
     SingleArcDynamicsSimulator< > dynamicsSimulator(
-                bodyMap, integratorSettings, propagatorSettings, true, false, true );
+                bodyMap, integratorSettings, propagatorSettings, saveCumulativeFunctionEvaluations, false, true );
+    if( !saveCumulativeFunctionEvaluations )
+    {
+        dynamicsSimulator.getDynamicsStateDerivative( )->setSaveCumulativeFunctionEvaluations( false );
+        dynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+
+        // Check that only total number of function evaluations is saved (4 evaluations per RK4 step).
+        BOOST_CHECK_EQUAL( dynamicsSimulator.getCumulativeNumberOfFunctionEvaluations( ).size( ), 0 );
+        BOOST_CHECK_EQUAL( dynamicsSimulator.getDynamicsStateDerivative( )->getNumberOfFunctionEvaluations( ),
+                           4 * ( dynamicsSimulator.getEquationsOfMotionNumericalSolution( ).size( ) - 1 ) );
+    }
+    else
+    {
+        BOOST_CHECK( dynamicsSimulator.getCumulativeNumberOfFunctionEvaluations( ).size( ) > 0 );
+    }
 
     // Return propagated dynamics (if simulationCase < 3) or interpolated dynamics (else)
     if( simulationCase < 3 )
@@ -243,6 +258,27 @@ BOOST_AUTO_TEST_CASE( testHybridStateDerivativeModel )
     }
 }
 
+//! Test if propagation results are unaffected by disabling the saving of cumulative function evaluations.
+BOOST_AUTO_TEST_CASE( testCumulativeFunctionEvaluationSaving )
+{
+    for( int simulationCase = 0; simulationCase < 3; simulationCase++ )
+    {
+        std::map< double, Eigen::VectorXd > stateWithSaving = propagateKeplerOrbitAndMassState( simulationCase, true );
+        std::map< double, Eigen::VectorXd > stateWithoutSaving = propagateKeplerOrbitAndMassState( simulationCase, false );
+
+        BOOST_CHECK_EQUAL( stateWithSaving.size( ), stateWithoutSaving.size( ) );
+        std::map< double, Eigen::VectorXd >::const_iterator withoutSavingIterator = stateWithoutSaving.begin( );
+        for( std::map< double, Eigen::VectorXd >::const_iterator withSavingIterator = stateWithSaving.begin( );
+             withSavingIterator != stateWithSaving.end( ); withSavingIterator++ )
+        {
+            BOOST_CHECK_EQUAL( withSavingIterator->first, withoutSavingIterator->first );
+            BOOST_CHECK_EQUAL( ( withSavingIterator->second - withoutSavingIterator->second ).cwiseAbs( ).maxCoeff( ),
+                               0.0 );
+            withoutSavingIterator++;
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,211 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/Propagators/propagationOutputSink.h"
+#include "Tudat/InputOutput/binaryHistoryFile.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_propagation_output_sink )
+
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::basic_astrodynamics;
+
+//! Function to create propagator settings for Kepler orbit about the Earth, with relative distance as dependent variable.
+std::shared_ptr< TranslationalStatePropagatorSettings< double > > getKeplerOrbitPropagatorSettings(
+        const NamedBodyMap& bodyMap, const TranslationalPropagatorType propagatorType, const double finalTime,
+        const bool terminateExactlyOnFinalCondition )
+{
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Asterix" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >(
+                                                                 basic_astrodynamics::central_gravity ) );
+    std::map< std::string, std::string > centralBodyMap = { { "Asterix", "Earth" } };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettings, centralBodyMap );
+
+    Eigen::Vector6d initialStateInKeplerianElements;
+    initialStateInKeplerianElements << 7000.0E3, 0.05, 0.8, 1.0, 2.0, 0.5;
+
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( std::make_shared< SingleDependentVariableSaveSettings >(
+                                      relative_distance_dependent_variable, "Asterix", "Earth" ) );
+
+    return std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                std::vector< std::string >( { "Earth" } ), accelerationModelMap,
+                std::vector< std::string >( { "Asterix" } ),
+                convertKeplerianToCartesianElements(
+                    initialStateInKeplerianElements,
+                    bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) ),
+                std::make_shared< PropagationTimeTerminationSettings >( finalTime, terminateExactlyOnFinalCondition ),
+                propagatorType,
+                std::make_shared< DependentVariableSaveSettings >( dependentVariables, false ) );
+}
+
+//! Test whether output sinks receive the same output as the propagation history, with and without history in memory.
+BOOST_AUTO_TEST_CASE( testPropagationOutputSinks )
+{
+    // Create environment (without Spice).
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "J2000" );
+    bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< CentralGravityFieldSettings >( 398600.4415E9 );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Asterix" ] = std::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+
+    const boost::filesystem::path outputDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+
+    // Test for Cowell and Encke propagator (latter to check conversion to conventional state), and with and without
+    // exact termination (latter to check replacement of final step).
+    for( unsigned int testCase = 0; testCase < 4; testCase++ )
+    {
+        const TranslationalPropagatorType propagatorType = ( testCase % 2 == 0 ) ? cowell : encke;
+        const bool terminateExactly = ( testCase >= 2 );
+        const double finalTime = terminateExactly ? 3.0 * 3600.0 + 5.0 : 3.0 * 3600.0;
+
+        std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 10.0 );
+
+        // Propagate with full history in memory.
+        SingleArcDynamicsSimulator< double, double > referenceDynamicsSimulator(
+                    bodyMap, integratorSettings,
+                    getKeplerOrbitPropagatorSettings( bodyMap, propagatorType, finalTime, terminateExactly ) );
+        std::map< double, Eigen::VectorXd > referenceStateHistory =
+                referenceDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+        std::map< double, Eigen::VectorXd > referenceDependentVariableHistory =
+                referenceDynamicsSimulator.getDependentVariableHistory( );
+
+        // Create output sinks.
+        const unsigned int ringBufferCapacity = 10;
+        const unsigned int decimationFactor = 7;
+        std::shared_ptr< RingBufferOutputSink< double > > ringBufferSink =
+                std::make_shared< RingBufferOutputSink< double > >( ringBufferCapacity );
+        std::shared_ptr< BinaryFileOutputSink< double > > binaryFileSink =
+                std::make_shared< BinaryFileOutputSink< double > >( outputDirectory / "propagationOutput.bin" );
+
+        std::map< double, Eigen::VectorXd > decimatedStateHistory;
+        int numberOfFinalizations = 0;
+        std::shared_ptr< CallbackOutputSink< double > > callbackSink = std::make_shared< CallbackOutputSink< double > >(
+                    [ & ]( const double& time, const CallbackOutputSink< double >::StateView& state,
+                    const CallbackOutputSink< double >::DependentVariableView& )
+        {
+            decimatedStateHistory[ time ] = state;
+        }, [ & ]( ){ numberOfFinalizations++; } );
+        std::shared_ptr< DecimatingOutputSink< double > > decimatingSink =
+                std::make_shared< DecimatingOutputSink< double > >( callbackSink, decimationFactor );
+
+        // Propagate without history in memory, twice (to check re-initialization of sinks).
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                getKeplerOrbitPropagatorSettings( bodyMap, propagatorType, finalTime, terminateExactly );
+        propagatorSettings->setOutputSinks( { ringBufferSink, binaryFileSink, decimatingSink }, false );
+        SingleArcDynamicsSimulator< double, double > dynamicsSimulator(
+                    bodyMap, integratorSettings, propagatorSettings, false );
+        for( unsigned int i = 0; i < 2; i++ )
+        {
+            decimatedStateHistory.clear( );
+            dynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+        }
+        BOOST_CHECK_EQUAL( numberOfFinalizations, 2 );
+
+        // Check that only final state is retained in memory.
+        std::map< double, Eigen::VectorXd > stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+        std::map< double, Eigen::VectorXd > dependentVariableHistory = dynamicsSimulator.getDependentVariableHistory( );
+        BOOST_CHECK_EQUAL( stateHistory.size( ), 1 );
+        BOOST_CHECK_EQUAL( dependentVariableHistory.size( ), 1 );
+        BOOST_CHECK_EQUAL( dynamicsSimulator.getCumulativeComputationTimeHistory( ).size( ), 1 );
+        BOOST_CHECK_EQUAL( stateHistory.begin( )->first, referenceStateHistory.rbegin( )->first );
+        BOOST_CHECK_EQUAL( ( stateHistory.begin( )->second - referenceStateHistory.rbegin( )->second ).cwiseAbs( ).maxCoeff( ),
+                           0.0 );
+        if( terminateExactly )
+        {
+            BOOST_CHECK_EQUAL( stateHistory.begin( )->first, finalTime );
+        }
+
+        // Check ring buffer contents (most recent first).
+        BOOST_CHECK_EQUAL( ringBufferSink->getNumberOfSteps( ), ringBufferCapacity );
+        std::map< double, Eigen::VectorXd >::const_reverse_iterator referenceIterator = referenceStateHistory.rbegin( );
+        for( unsigned int i = 0; i < ringBufferCapacity; i++ )
+        {
+            BOOST_CHECK_EQUAL( ringBufferSink->getTime( i ), referenceIterator->first );
+            BOOST_CHECK_EQUAL( ( ringBufferSink->getState( i ) - referenceIterator->second ).cwiseAbs( ).maxCoeff( ), 0.0 );
+            BOOST_CHECK_EQUAL( ( ringBufferSink->getDependentVariables( i ) -
+                                 referenceDependentVariableHistory.at( referenceIterator->first ) ).cwiseAbs( ).maxCoeff( ),
+                               0.0 );
+            referenceIterator++;
+        }
+
+        // Check binary file contents (all steps).
+        input_output::BinaryHistoryFileReader fileReader( binaryFileSink->getFilePath( ) );
+        BOOST_CHECK_EQUAL( fileReader.getNumberOfRows( ), referenceStateHistory.size( ) );
+        BOOST_CHECK_EQUAL( fileReader.getNumberOfColumns( ), 8 );
+        BOOST_CHECK_EQUAL( fileReader.getColumnNames( ).at( 7 ), "dependent_variable_0" );
+        input_output::BinaryHistoryFileReader::DataBlock fileData = fileReader.getData( );
+        int currentRow = 0;
+        for( const auto& stateIterator : referenceStateHistory )
+        {
+            BOOST_CHECK_EQUAL( fileData( currentRow, 0 ), stateIterator.first );
+            BOOST_CHECK_EQUAL( ( fileData.block( currentRow, 1, 1, 6 ).transpose( ) - stateIterator.second ).cwiseAbs( ).maxCoeff( ),
+                               0.0 );
+            BOOST_CHECK_EQUAL( fileData( currentRow, 7 ), referenceDependentVariableHistory.at( stateIterator.first )( 0 ) );
+            currentRow++;
+        }
+
+        // Check decimated output (every n-th step and final step).
+        const unsigned int numberOfSteps = referenceStateHistory.size( );
+        BOOST_CHECK_EQUAL( decimatedStateHistory.size( ), ( numberOfSteps - 1 ) / decimationFactor + 1 +
+                           ( ( ( numberOfSteps - 1 ) % decimationFactor == 0 ) ? 0 : 1 ) );
+        int currentStep = 0;
+        for( const auto& stateIterator : referenceStateHistory )
+        {
+            if( currentStep % decimationFactor == 0 || currentStep == static_cast< int >( numberOfSteps ) - 1 )
+            {
+                BOOST_CHECK_EQUAL( ( decimatedStateHistory.at( stateIterator.first ) - stateIterator.second ).cwiseAbs( ).maxCoeff( ),
+                                   0.0 );
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL( decimatedStateHistory.count( stateIterator.first ), 0 );
+            }
+            currentStep++;
+        }
+    }
+
+    boost::filesystem::remove_all( outputDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
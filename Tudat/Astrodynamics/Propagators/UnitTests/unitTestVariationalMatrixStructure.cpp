@@ -0,0 +1,313 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Geometry>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityField.h"
+#include "Tudat/Astrodynamics/Propagators/variationalEquations.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createEstimatableParameters.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createStateDerivativePartials.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+//Using declarations.
+using namespace tudat::estimatable_parameters;
+using namespace tudat::simulation_setup;
+using namespace tudat::basic_astrodynamics;
+using namespace tudat::ephemerides;
+using namespace tudat::propagators;
+
+BOOST_AUTO_TEST_SUITE( test_variational_matrix_structure )
+
+//! Function to set the inertia tensor of a body, and the degree two gravity field that is consistent with it.
+void setBodyInertiaTensorAndGravityField(
+        const std::shared_ptr< Body > body, const Eigen::Matrix3d& inertiaTensor,
+        const double gravitationalParameter, const double referenceRadius, const std::string& fixedFrame )
+{
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    double scaledMeanMomentOfInertia;
+    gravitation::getDegreeTwoSphericalHarmonicCoefficients(
+                inertiaTensor, gravitationalParameter, referenceRadius, true,
+                cosineCoefficients, sineCoefficients, scaledMeanMomentOfInertia );
+
+    body->setBodyInertiaTensor( inertiaTensor, scaledMeanMomentOfInertia );
+    body->setGravityFieldModel( std::make_shared< gravitation::SphericalHarmonicsGravityField >(
+                                    gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                                    fixedFrame ) );
+}
+
+//! Function to check whether the structured product of the variational matrix with a given matrix is equal to the dense
+//! product, comparing each entry relative to the magnitude of the terms summed to compute it.
+void checkStructuredVariationalMatrixProduct(
+        const std::shared_ptr< VariationalEquations > variationalEquations,
+        const Eigen::MatrixXd& stateTransitionAndSensitivityMatrices )
+{
+    int numberOfRows = stateTransitionAndSensitivityMatrices.rows( );
+    int numberOfColumns = stateTransitionAndSensitivityMatrices.cols( );
+
+    // Compute product using sparsity structure of variational matrix
+    Eigen::MatrixXd structuredProduct = Eigen::MatrixXd::Constant( numberOfRows, numberOfColumns, TUDAT_NAN );
+    variationalEquations->getBodyInitialStatePartialMatrix< double >(
+                stateTransitionAndSensitivityMatrices, structuredProduct.block( 0, 0, numberOfRows, numberOfColumns ) );
+
+    // Compute dense product from full variational matrix
+    Eigen::MatrixXd variationalMatrix = variationalEquations->getVariationalMatrix( );
+    Eigen::MatrixXd denseProduct = variationalMatrix * stateTransitionAndSensitivityMatrices;
+    Eigen::MatrixXd productMagnitude =
+            variationalMatrix.cwiseAbs( ) * stateTransitionAndSensitivityMatrices.cwiseAbs( );
+
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        for( int j = 0; j < numberOfColumns; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( structuredProduct( i, j ) - denseProduct( i, j ) ),
+                               1.0E-14 * productMagnitude( i, j ) + std::numeric_limits< double >::min( ) );
+        }
+    }
+}
+
+//! Test whether the product of the variational matrix with the state transition and sensitivity matrices, computed
+//! using the precompiled sparsity structure, is equal to the dense product, for hierarchical translational dynamics
+//! of multiple bodies, combined with the rotational dynamics of multiple bodies.
+BOOST_AUTO_TEST_CASE( testStructuredVariationalMatrixProduct )
+{
+    double sunGravitationalParameter = 1.32712440018E20;
+    double earthGravitationalParameter = 3.986004418E14;
+    double moonGravitationalParameter = 4.9048695E12;
+
+    // Create bodies, with Moon orbiting Earth, and vehicle orbiting Moon.
+    NamedBodyMap bodyMap;
+    bodyMap[ "Sun" ] = std::make_shared< Body >( );
+    bodyMap[ "Sun" ]->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                        Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Sun" ]->setGravityFieldModel(
+                std::make_shared< gravitation::GravityFieldModel >( sunGravitationalParameter ) );
+
+    Eigen::Vector6d earthKeplerElements;
+    earthKeplerElements << 1.496E11, 0.0167, 1.0E-4, 1.9933, 3.0, 0.5;
+    bodyMap[ "Earth" ] = std::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                          earthKeplerElements, 0.0, sunGravitationalParameter, "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Earth" ]->setGravityFieldModel(
+                std::make_shared< gravitation::GravityFieldModel >( earthGravitationalParameter ) );
+
+    Eigen::Vector6d moonKeplerElements;
+    moonKeplerElements << 3.844E8, 0.0549, 0.0898, 2.1, 0.4, 1.2;
+    bodyMap[ "Moon" ] = std::make_shared< Body >( );
+    bodyMap[ "Moon" ]->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                         moonKeplerElements, 0.0, earthGravitationalParameter, "Earth", "ECLIPJ2000" ) );
+
+    Eigen::Vector6d vehicleKeplerElements;
+    vehicleKeplerElements << 2.5E6, 0.1, 1.2, 0.3, 1.4, 2.0;
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< KeplerEphemeris >(
+                                            vehicleKeplerElements, 0.0, moonGravitationalParameter,
+                                            "Moon", "ECLIPJ2000" ) );
+
+    // Set (non-diagonal) inertia tensors, gravity fields and rotation models of rotationally propagated bodies.
+    Eigen::Matrix3d moonInertiaTensor;
+    moonInertiaTensor << 0.3929, 0.0012, -0.0021,
+            0.0012, 0.3931, 0.0008,
+            -0.0021, 0.0008, 0.3940;
+    moonInertiaTensor *= 7.342E22 * 1737.4E3 * 1737.4E3;
+    setBodyInertiaTensorAndGravityField(
+                bodyMap.at( "Moon" ), moonInertiaTensor, moonGravitationalParameter, 1737.4E3, "Moon_Fixed" );
+    bodyMap[ "Moon" ]->setRotationalEphemeris(
+                std::make_shared< SimpleRotationalEphemeris >(
+                    0.2, 1.1, 0.3, 2.0 * mathematical_constants::PI / ( 27.3 * 86400.0 ), 0.0,
+                    "ECLIPJ2000", "Moon_Fixed" ) );
+
+    Eigen::Matrix3d vehicleInertiaTensor;
+    vehicleInertiaTensor << 5000.0, 120.0, -80.0,
+            120.0, 6500.0, 40.0,
+            -80.0, 40.0, 7200.0;
+    setBodyInertiaTensorAndGravityField(
+                bodyMap.at( "Vehicle" ), vehicleInertiaTensor, 1000.0 * physical_constants::GRAVITATIONAL_CONSTANT, 2.0,
+                "Vehicle_Fixed" );
+    bodyMap[ "Vehicle" ]->setRotationalEphemeris(
+                std::make_shared< SimpleRotationalEphemeris >(
+                    -0.4, 0.6, 1.3, 1.0E-3, 0.0, "ECLIPJ2000", "Vehicle_Fixed" ) );
+
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Define hierarchical translational dynamics.
+    std::vector< std::string > translationalBodiesToIntegrate = { "Earth", "Moon", "Vehicle" };
+    std::vector< std::string > translationalCentralBodies = { "SSB", "Earth", "Moon" };
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Earth" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Earth" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, translationalBodiesToIntegrate, translationalCentralBodies );
+
+    double initialTime = 0.0;
+    Eigen::VectorXd initialTranslationalState = getInitialStatesOfBodies(
+                translationalBodiesToIntegrate, translationalCentralBodies, bodyMap, initialTime );
+
+    // Define rotational dynamics, with torques depending on the translational states. The torque on the vehicle does not
+    // depend on the Moon's state directly, only through the vehicle's state w.r.t. the Moon (hierarchical addition).
+    std::vector< std::string > rotationalBodiesToIntegrate = { "Moon", "Vehicle" };
+
+    SelectedTorqueMap torqueMap;
+    torqueMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< TorqueSettings >( second_order_gravitational_torque ) );
+    torqueMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< TorqueSettings >( second_order_gravitational_torque ) );
+    TorqueModelMap torqueModelMap = createTorqueModelsMap( bodyMap, torqueMap, rotationalBodiesToIntegrate );
+
+    Eigen::VectorXd initialRotationalState = Eigen::VectorXd::Zero( 14 );
+    Eigen::Quaterniond moonOrientation = Eigen::Quaterniond(
+                Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) *
+                Eigen::AngleAxisd( 1.1, Eigen::Vector3d::UnitX( ) ) *
+                Eigen::AngleAxisd( -0.7, Eigen::Vector3d::UnitZ( ) ) );
+    initialRotationalState.segment( 0, 4 ) << moonOrientation.w( ), moonOrientation.x( ),
+            moonOrientation.y( ), moonOrientation.z( );
+    initialRotationalState.segment( 4, 3 ) << 1.0E-7, -2.0E-7, 2.66E-6;
+
+    Eigen::Quaterniond vehicleOrientation = Eigen::Quaterniond(
+                Eigen::AngleAxisd( -1.2, Eigen::Vector3d::UnitZ( ) ) *
+                Eigen::AngleAxisd( 0.4, Eigen::Vector3d::UnitX( ) ) *
+                Eigen::AngleAxisd( 2.1, Eigen::Vector3d::UnitZ( ) ) );
+    initialRotationalState.segment( 7, 4 ) << vehicleOrientation.w( ), vehicleOrientation.x( ),
+            vehicleOrientation.y( ), vehicleOrientation.z( );
+    initialRotationalState.segment( 11, 3 ) << 2.0E-3, 1.0E-3, -3.0E-3;
+
+    double finalTime = 3600.0;
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > propagatorSettingsList;
+    propagatorSettingsList.push_back(
+                std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                    translationalCentralBodies, accelerationModelMap, translationalBodiesToIntegrate,
+                    initialTranslationalState, finalTime ) );
+    propagatorSettingsList.push_back(
+                std::make_shared< RotationalStatePropagatorSettings< double > >(
+                    torqueModelMap, rotationalBodiesToIntegrate, initialRotationalState,
+                    std::make_shared< PropagationTimeTerminationSettings >( finalTime ) ) );
+    std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+            std::make_shared< MultiTypePropagatorSettings< double > >(
+                propagatorSettingsList, std::make_shared< PropagationTimeTerminationSettings >( finalTime ) );
+
+    std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings =
+            std::make_shared< numerical_integrators::IntegratorSettings< double > >(
+                numerical_integrators::rungeKutta4, initialTime, 60.0 );
+
+    // Define parameters: initial states, and a parameter leading to additional sensitivity matrix columns.
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    for( unsigned int i = 0; i < translationalBodiesToIntegrate.size( ); i++ )
+    {
+        parameterNames.push_back( std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                      translationalBodiesToIntegrate.at( i ), initialTranslationalState.segment( 6 * i, 6 ),
+                                      translationalCentralBodies.at( i ) ) );
+    }
+    parameterNames.push_back( std::make_shared< InitialRotationalStateEstimatableParameterSettings< double > >(
+                                  "Moon", initialRotationalState.segment( 0, 7 ), "ECLIPJ2000" ) );
+    parameterNames.push_back( std::make_shared< InitialRotationalStateEstimatableParameterSettings< double > >(
+                                  "Vehicle", initialRotationalState.segment( 7, 7 ), "ECLIPJ2000" ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+
+    // Create dynamics and variational equations, as is done by SingleArcVariationalEquationsSolver.
+    SingleArcDynamicsSimulator< double, double > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, false );
+    std::shared_ptr< DynamicsStateDerivativeModel< double, double > > dynamicsStateDerivative =
+            dynamicsSimulator.getDynamicsStateDerivative( );
+
+    std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
+            createStateDerivativePartials< double, double >(
+                dynamicsStateDerivative->getStateDerivativeModels( ), bodyMap, parametersToEstimate );
+    std::shared_ptr< VariationalEquations > variationalEquations = std::make_shared< VariationalEquations >(
+                stateDerivativePartials, parametersToEstimate, dynamicsStateDerivative->getStateTypeStartIndices( ) );
+    dynamicsStateDerivative->addVariationalEquations( variationalEquations );
+    dynamicsStateDerivative->setPropagationSettings( std::vector< IntegratedStateType >( ), true, true );
+
+    // Retrieve start indices of translational (3 bodies) and rotational (2 bodies) states.
+    std::map< IntegratedStateType, int > stateTypeStartIndices = dynamicsStateDerivative->getStateTypeStartIndices( );
+    int translationalStartIndex = stateTypeStartIndices.at( translational_state );
+    int rotationalStartIndex = stateTypeStartIndices.at( rotational_state );
+    BOOST_CHECK_EQUAL( translationalStartIndex, 0 );
+    BOOST_CHECK_EQUAL( rotationalStartIndex, 18 );
+
+    int numberOfStates = 32;
+    int numberOfParameters = variationalEquations->getNumberOfParameterValues( );
+    BOOST_CHECK_EQUAL( numberOfParameters, numberOfStates + 1 );
+
+    std::srand( 42 );
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Set dynamical state, and (non-physical) state transition and sensitivity matrices with all entries non-zero.
+        double currentTime = initialTime + test * 1800.0;
+        Eigen::MatrixXd fullState = Eigen::MatrixXd::Zero( numberOfStates, numberOfParameters + 1 );
+        fullState.block( 0, 0, numberOfStates, numberOfParameters ) =
+                Eigen::MatrixXd::Random( numberOfStates, numberOfParameters );
+        fullState.block( translationalStartIndex, numberOfParameters, 18, 1 ) = getInitialStatesOfBodies(
+                    translationalBodiesToIntegrate, translationalCentralBodies, bodyMap, currentTime );
+        fullState.block( rotationalStartIndex, numberOfParameters, 14, 1 ) = initialRotationalState;
+
+        // Update environment and partials, and evaluate variational equations
+        dynamicsStateDerivative->computeStateDerivative( currentTime, fullState );
+
+        Eigen::MatrixXd variationalMatrix = variationalEquations->getVariationalMatrix( );
+
+        // Check that the blocks for which the structure is used are set: quaternion rates (4x7 blocks), angular
+        // accelerations w.r.t. translational states (including the Moon's state for the vehicle, which is only set by
+        // the hierarchical addition), and accelerations w.r.t. states of central bodies.
+        for( unsigned int i = 0; i < rotationalBodiesToIntegrate.size( ); i++ )
+        {
+            int currentStartIndex = rotationalStartIndex + 7 * i;
+            BOOST_CHECK( variationalMatrix.block( currentStartIndex, currentStartIndex, 4, 4 ).norm( ) > 0.0 );
+            BOOST_CHECK( variationalMatrix.block( currentStartIndex, currentStartIndex + 4, 4, 3 ).norm( ) > 0.0 );
+            BOOST_CHECK( variationalMatrix.block( currentStartIndex + 4, translationalStartIndex, 3, 18 ).norm( ) > 0.0 );
+            BOOST_CHECK_EQUAL( variationalMatrix.block( currentStartIndex, translationalStartIndex, 4, 18 ).norm( ), 0.0 );
+        }
+        BOOST_CHECK( variationalMatrix.block( rotationalStartIndex + 11, translationalStartIndex + 6, 3, 3 ).norm( ) > 0.0 );
+        BOOST_CHECK( variationalMatrix.block( translationalStartIndex + 15, translationalStartIndex, 3, 3 ).norm( ) > 0.0 );
+        BOOST_CHECK( variationalMatrix.block( translationalStartIndex + 15, translationalStartIndex + 6, 3, 3 ).norm( ) > 0.0 );
+        BOOST_CHECK_EQUAL( variationalMatrix.block( translationalStartIndex, rotationalStartIndex, 18, 14 ).norm( ), 0.0 );
+
+        // Compare structured and dense product of variational matrix.
+        checkStructuredVariationalMatrixProduct(
+                    variationalEquations, fullState.block( 0, 0, numberOfStates, numberOfParameters ) );
+
+        // Compare structured and dense product for unit state transition matrix, for which the structured product must
+        // reproduce each entry of the variational matrix, regardless of the (widely varying) size of the entries.
+        Eigen::MatrixXd unitStateTransitionAndSensitivityMatrix = fullState.block( 0, 0, numberOfStates, numberOfParameters );
+        unitStateTransitionAndSensitivityMatrix.block( 0, 0, numberOfStates, numberOfStates ).setIdentity( );
+        checkStructuredVariationalMatrixProduct( variationalEquations, unitStateTransitionAndSensitivityMatrix );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
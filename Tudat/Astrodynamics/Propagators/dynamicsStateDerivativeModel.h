@@ -22,6 +22,7 @@
 
 #include <Eigen/Core>
 
+#include "Tudat/Basics/propagationHistory.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModelTypes.h"
 #include "Tudat/Astrodynamics/Propagators/bodyMassStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
@@ -129,8 +130,33 @@ public:
                     Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero(
                         conventionalStateTypeSize_.at( stateDerivativeModels.at( i )->getIntegratedStateType( )  ), 1 );
         }
+
+        // Set flat list of state derivative models and associated state indices, so that no map look-ups are required
+        // during the evaluation of the state derivative.
+        for( auto modelIterator = stateDerivativeModels_.begin( ); modelIterator != stateDerivativeModels_.end( );
+             modelIterator++ )
+        {
+            for( unsigned int i = 0; i < modelIterator->second.size( ); i++ )
+            {
+                stateDerivativeModelList_.push_back( modelIterator->second.at( i ) );
+                stateDerivativeModelTypes_.push_back( modelIterator->first );
+                propagatedStateIndexList_.push_back( propagatedStateIndices_.at( modelIterator->first ).at( i ) );
+                conventionalStateIndexList_.push_back( conventionalStateIndices_.at( modelIterator->first ).at( i ) );
+                conventionalStateTypeOffsetList_.push_back(
+                            conventionalStateIndices_.at( modelIterator->first ).at( i ).first -
+                            conventionalStateTypeStartIndex_.at( modelIterator->first ) );
+                currentConventionalStateList_.push_back(
+                            &currentStatesPerTypeInConventionalRepresentation_.at( modelIterator->first ) );
+            }
+        }
     }
 
+    //! Copy constructor (deleted, as object stores pointers to its own members)
+    DynamicsStateDerivativeModel( const DynamicsStateDerivativeModel& ) = delete;
+
+    //! Assignment operator (deleted, as object stores pointers to its own members)
+    DynamicsStateDerivativeModel& operator=( const DynamicsStateDerivativeModel& ) = delete;
+
 
     //! Function to calculate the system state derivative
     /*!
@@ -156,15 +182,10 @@ public:
         // If dynamical equations are integrated, update the environment with the current state.
         if( evaluateDynamicsEquations_ )
         {
-            // Iterate over all types of equations.
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
+            // Iterate over all state derivative models.
+            for( unsigned int i = 0; i < stateDerivativeModelList_.size( ); i++ )
             {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    stateDerivativeModelsIterator_->second.at( i )->clearStateDerivativeModel( );
-                }
+                stateDerivativeModelList_[ i ]->clearStateDerivativeModel( );
             }
 
             convertCurrentStateToGlobalRepresentationPerType( state, time, evaluateVariationalEquations_ );
@@ -185,34 +206,21 @@ public:
         }
 
         // If dynamical equations are integrated, evaluate dynamics state derivatives.
-        std::pair< int, int > currentIndices;
         if( evaluateDynamicsEquations_ )
         {
-            // Iterate over all types of equations.
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
+            // Update state derivative models
+            for( unsigned int i = 0; i < stateDerivativeModelList_.size( ); i++ )
             {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    // Update state derivative models
-                    stateDerivativeModelsIterator_->second.at( i )->updateStateDerivativeModel( time );
-                }
+                stateDerivativeModelList_[ i ]->updateStateDerivativeModel( time );
             }
 
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
+            // Evaluate and set current dynamical state derivative
+            for( unsigned int i = 0; i < stateDerivativeModelList_.size( ); i++ )
             {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    // Evaluate and set current dynamical state derivative
-                    currentIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
-
-                    stateDerivativeModelsIterator_->second.at( i )->calculateSystemStateDerivative(
-                                time, state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ),
-                                stateDerivative_.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
-                }
+                const std::pair< int, int >& currentIndices = propagatedStateIndexList_[ i ];
+                stateDerivativeModelList_[ i ]->calculateSystemStateDerivative(
+                            time, state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ),
+                            stateDerivative_.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
             }
         }
 
@@ -228,7 +236,10 @@ public:
 
         // Update counters
         functionEvaluationCounter_++;
-        cumulativeFunctionEvaluationCounter_[ time ] = functionEvaluationCounter_;
+        if( saveCumulativeFunctionEvaluations_ )
+        {
+            cumulativeFunctionEvaluationCounter_[ time ] = functionEvaluationCounter_;
+        }
 
         return stateDerivative_;
 
@@ -267,22 +278,12 @@ public:
                 Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero( totalPropagatedStateSize_, 1 );
 
         // Iterate over all state derivative models and convert associated state entries
-        std::vector< std::pair< int, int > > currentConventionalStateIndices;
-        std::vector< std::pair< int, int > > currentPropagatedStateIndices;
-        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-             stateDerivativeModelsIterator_++ )
+        for( unsigned int i = 0; i < stateDerivativeModelList_.size( ); i++ )
         {
-            currentConventionalStateIndices = conventionalStateIndices_.at( stateDerivativeModelsIterator_->first );
-            currentPropagatedStateIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first );
-            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-            {
-                internalState.segment( currentPropagatedStateIndices.at( i ).first,
-                                       currentPropagatedStateIndices.at( i ).second ) =
-                        stateDerivativeModelsIterator_->second.at( i )->convertFromOutputSolution(
-                            outputState.segment( currentConventionalStateIndices.at( i ).first,
-                                                 currentConventionalStateIndices.at( i ).second ), time );
-            }
+            internalState.segment( propagatedStateIndexList_[ i ].first, propagatedStateIndexList_[ i ].second ) =
+                    stateDerivativeModelList_[ i ]->convertFromOutputSolution(
+                        outputState.segment( conventionalStateIndexList_[ i ].first,
+                                             conventionalStateIndexList_[ i ].second ), time );
         }
 
         return internalState;
@@ -308,23 +309,13 @@ public:
                 Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero( totalConventionalStateSize_, 1 );
 
         // Iterate over all state derivative models and convert associated state entries
-        std::vector< std::pair< int, int > > currentConventionalStateIndices;
-        std::vector< std::pair< int, int > > currentPropagatedStateIndices;
-        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-             stateDerivativeModelsIterator_++ )
+        for( unsigned int i = 0; i < stateDerivativeModelList_.size( ); i++ )
         {
-            currentConventionalStateIndices = conventionalStateIndices_.at( stateDerivativeModelsIterator_->first );
-            currentPropagatedStateIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first );
-            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-            {
-                stateDerivativeModelsIterator_->second.at( i )->convertToOutputSolution(
-                            internalSolution.segment(
-                                currentPropagatedStateIndices.at( i ).first,
-                                currentPropagatedStateIndices.at( i ).second ), time,
-                            outputState.block( currentConventionalStateIndices.at( i ).first, 0,
-                                               currentConventionalStateIndices.at( i ).second, 1 ) );
-            }
+            stateDerivativeModelList_[ i ]->convertToOutputSolution(
+                        internalSolution.segment( propagatedStateIndexList_[ i ].first,
+                                                  propagatedStateIndexList_[ i ].second ), time,
+                        outputState.block( conventionalStateIndexList_[ i ].first, 0,
+                                           conventionalStateIndexList_[ i ].second, 1 ) );
         }
 
         return outputState;
@@ -355,6 +346,34 @@ public:
         }
     }
 
+    //! Function to convert the contiguous propagator-specific form of the state to the conventional form.
+    /*!
+     * Function to convert the propagator-specific form of the state to the conventional form, for a history stored in
+     * contiguous form (see PropagationHistory), such as generated by the numerical propagation.
+     * \sa SingleStateTypeDerivative::convertToOutputSolution
+     * \param convertedSolution State history in conventional form, in the same order as rawSolution (returned by
+     * reference).
+     * \param rawSolution State history in propagator-specific form (i.e. form that is used in
+     * numerical integration).
+     */
+    void convertNumericalStateSolutionsToOutputSolutions(
+            PropagationHistory< TimeType, StateScalarType >& convertedSolution,
+            const PropagationHistory< TimeType, StateScalarType >& rawSolution )
+    {
+        convertedSolution.clear( );
+        convertedSolution.reserve( rawSolution.size( ) );
+
+        // Iterate over all entries.
+        for( unsigned int i = 0; i < rawSolution.size( ); i++ )
+        {
+            // Convert solution at this time to output (Cartesian with propagation origin frame for
+            // translational dynamics) solution
+            convertedSolution.append(
+                        rawSolution.getTime( i ),
+                        convertToOutputSolution( rawSolution.getState( i ), rawSolution.getTime( i ) ) );
+        }
+    }
+
     //! Function to process the state vector during propagation.
     /*!
      * Function to process the state vector during propagation.
@@ -364,20 +383,13 @@ public:
     void postProcessState( Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& unprocessedState )
     {
         // Iterate over all state derivative models and post-process associated state entries
-        std::vector< std::pair< int, int > > currentIndices;
-        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-             stateDerivativeModelsIterator_++ )
+        for( unsigned int i = 0; i < stateDerivativeModelList_.size( ); i++ )
         {
-            currentIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first );
-            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+            if ( stateDerivativeModelList_[ i ]->isStateToBePostProcessed( ) )
             {
-                if ( stateDerivativeModelsIterator_->second.at( i )->isStateToBePostProcessed( ) )
-                {
-                    stateDerivativeModelsIterator_->second.at( i )->postProcessState(
-                                unprocessedState.block( currentIndices.at( i ).first, 0,
-                                                        currentIndices.at( i ).second, 1 ) );
-                }
+                stateDerivativeModelList_[ i ]->postProcessState(
+                            unprocessedState.block( propagatedStateIndexList_[ i ].first, 0,
+                                                    propagatedStateIndexList_[ i ].second, 1 ) );
             }
         }
     }
@@ -392,23 +404,17 @@ public:
             Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& unprocessedState )
     {
         // Iterate over all state derivative models and post-process associated state entries
-        std::vector< std::pair< int, int > > currentIndices;
         Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > currentUnprocessedState;
-        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-             stateDerivativeModelsIterator_++ )
+        for( unsigned int i = 0; i < stateDerivativeModelList_.size( ); i++ )
         {
-            currentIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first );
-            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+            if ( stateDerivativeModelList_[ i ]->isStateToBePostProcessed( ) )
             {
-            	if ( stateDerivativeModelsIterator_->second.at( i )->isStateToBePostProcessed( ) )
-                {
-                    currentUnprocessedState = unprocessedState.block( currentIndices.at( i ).first, dynamicsStartColumn_,
-                                                                      currentIndices.at( i ).second, 1 );
-                    stateDerivativeModelsIterator_->second.at( i )->postProcessState( currentUnprocessedState );
-                    unprocessedState.block( currentIndices.at( i ).first, dynamicsStartColumn_,
-                                            currentIndices.at( i ).second, 1 ) = currentUnprocessedState;
-               	}
+                const std::pair< int, int >& currentIndices = propagatedStateIndexList_[ i ];
+                currentUnprocessedState = unprocessedState.block( currentIndices.first, dynamicsStartColumn_,
+                                                                  currentIndices.second, 1 );
+                stateDerivativeModelList_[ i ]->postProcessState( currentUnprocessedState );
+                unprocessedState.block( currentIndices.first, dynamicsStartColumn_,
+                                        currentIndices.second, 1 ) = currentUnprocessedState;
             }
         }
     }
@@ -460,42 +466,38 @@ public:
     void updateStateDerivativeModelSettings(
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > initialBodyStates )
     {
-        // Iterate over all dynamics types
-        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-             stateDerivativeModelsIterator_++ )
+        // Iterate over all state derivative models
+        for( unsigned int i = 0; i < stateDerivativeModelList_.size( ); i++ )
         {
-            switch( stateDerivativeModelsIterator_->first )
+            switch( stateDerivativeModelTypes_[ i ] )
             {
             case translational_state:
             {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+                std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > currentTranslationalStateDerivative =
+                        std::dynamic_pointer_cast< NBodyStateDerivative< StateScalarType, TimeType > >(
+                            stateDerivativeModelList_[ i ] );
+                switch( currentTranslationalStateDerivative->getTranslationalPropagatorType( ) )
                 {
-                    std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > currentTranslationalStateDerivative =
-                            std::dynamic_pointer_cast< NBodyStateDerivative< StateScalarType, TimeType > >(
-                                stateDerivativeModelsIterator_->second.at( i ) );
-                    switch( currentTranslationalStateDerivative->getTranslationalPropagatorType( ) )
-                    {
-                    case cowell:
-                        break;
-                    case encke:
-                        throw std::runtime_error( "Error, reference orbit not reset in Encke propagator" );
-                        break;
-                    case gauss_keplerian:
-                        break;
-                    case gauss_modified_equinoctial:
-                        break;
-                    case unified_state_model_quaternions:
-                        break;
-                    case unified_state_model_modified_rodrigues_parameters:
-                        break;
-                    case unified_state_model_exponential_map:
-                        break;
-                    default:
-                        throw std::runtime_error( "Error when updating state derivative model settings, did not recognize translational propagator type" );
-                        break;
-                    }
+                case cowell:
+                    break;
+                case encke:
+                    throw std::runtime_error( "Error, reference orbit not reset in Encke propagator" );
+                    break;
+                case gauss_keplerian:
+                    break;
+                case gauss_modified_equinoctial:
+                    break;
+                case unified_state_model_quaternions:
+                    break;
+                case unified_state_model_modified_rodrigues_parameters:
+                    break;
+                case unified_state_model_exponential_map:
+                    break;
+                default:
+                    throw std::runtime_error( "Error when updating state derivative model settings, did not recognize translational propagator type" );
+                    break;
                 }
+                break;
             }
             case rotational_state:
                 break;
@@ -575,6 +577,30 @@ public:
         cumulativeFunctionEvaluationCounter_.clear( );
     }
 
+    //! Function to set whether the number of function evaluations is to be saved per time step
+    /*!
+     * Function to set whether the number of function evaluations is to be saved per time step (true by default). If
+     * false, the map returned by getCumulativeNumberOfFunctionEvaluations is not updated by computeStateDerivative,
+     * which removes a map insertion from each function evaluation. The total number of function evaluations is
+     * always available from getNumberOfFunctionEvaluations.
+     * \param saveCumulativeFunctionEvaluations Boolean denoting whether the number of function evaluations is to be
+     * saved per time step
+     */
+    void setSaveCumulativeFunctionEvaluations( const bool saveCumulativeFunctionEvaluations )
+    {
+        saveCumulativeFunctionEvaluations_ = saveCumulativeFunctionEvaluations;
+    }
+
+    //! Function to retrieve whether the number of function evaluations is saved per time step
+    /*!
+     * Function to retrieve whether the number of function evaluations is saved per time step
+     * \return Boolean denoting whether the number of function evaluations is saved per time step
+     */
+    bool getSaveCumulativeFunctionEvaluations( )
+    {
+        return saveCumulativeFunctionEvaluations_;
+    }
+
 private:
 
     //! Function to convert the to the conventional form in the global frame per dynamics type.
@@ -604,30 +630,15 @@ private:
             startColumn = 0;
         }
 
-        std::pair< int, int > currentPropagatedIndices, currentConventionalIndices;
-
         // Iterate over all state derivative models
-        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-             stateDerivativeModelsIterator_++ )
+        for( unsigned int i = 0; i < stateDerivativeModelList_.size( ); i++ )
         {
-            int currentStateTypeSize = 0;
-
-            // Iterate over all state derivative models of current type
-            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-            {
-                // Get state block indices of current state derivative model
-                currentPropagatedIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
-                currentConventionalIndices = conventionalStateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
-
-                // Set current block in split state (in global form)
-                stateDerivativeModelsIterator_->second.at( i )->convertCurrentStateToGlobalRepresentation(
-                            state.block( currentPropagatedIndices.first, startColumn, currentPropagatedIndices.second, 1 ), time,
-                            currentStatesPerTypeInConventionalRepresentation_.at(
-                                stateDerivativeModelsIterator_->first ).block(
-                                currentStateTypeSize, 0, currentConventionalIndices.second, 1 ) );
-
-            }
+            // Set current block in split state (in global form)
+            const std::pair< int, int >& currentPropagatedIndices = propagatedStateIndexList_[ i ];
+            stateDerivativeModelList_[ i ]->convertCurrentStateToGlobalRepresentation(
+                        state.block( currentPropagatedIndices.first, startColumn, currentPropagatedIndices.second, 1 ), time,
+                        currentConventionalStateList_[ i ]->block(
+                            conventionalStateTypeOffsetList_[ i ], 0, conventionalStateIndexList_[ i ].second, 1 ) );
         }
     }
 
@@ -659,9 +670,24 @@ private:
     std::unordered_map< IntegratedStateType,
     std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > > stateDerivativeModels_;
 
-    //! Predefined iterator for computational efficiency.
-    typename std::unordered_map< IntegratedStateType, std::vector< std::shared_ptr
-    < SingleStateTypeDerivative< StateScalarType, TimeType > > > >::iterator stateDerivativeModelsIterator_;
+    //! Complete list of state derivative models, in order of evaluation (flattened contents of stateDerivativeModels_).
+    std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > stateDerivativeModelList_;
+
+    //! State type of each entry in stateDerivativeModelList_.
+    std::vector< IntegratedStateType > stateDerivativeModelTypes_;
+
+    //! Start index and size of propagated state in full state vector, for each entry in stateDerivativeModelList_.
+    std::vector< std::pair< int, int > > propagatedStateIndexList_;
+
+    //! Start index and size of conventional state in full state vector, for each entry in stateDerivativeModelList_.
+    std::vector< std::pair< int, int > > conventionalStateIndexList_;
+
+    //! Start index of conventional state in the state vector of its type, for each entry in stateDerivativeModelList_.
+    std::vector< int > conventionalStateTypeOffsetList_;
+
+    //! Pointers to entries of currentStatesPerTypeInConventionalRepresentation_, for each entry in
+    //! stateDerivativeModelList_.
+    std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >* > currentConventionalStateList_;
 
     //! Total length of conventional state vector.
     /*!
@@ -701,6 +727,9 @@ private:
 
     //! Variable to keep track of the number of calls to the computeStateDerivative function per time step
     std::map< TimeType, unsigned int > cumulativeFunctionEvaluationCounter_;
+
+    //! Boolean denoting whether the cumulativeFunctionEvaluationCounter_ is updated at each function evaluation.
+    bool saveCumulativeFunctionEvaluations_ = true;
 };
 
 extern template class DynamicsStateDerivativeModel< double, double >;
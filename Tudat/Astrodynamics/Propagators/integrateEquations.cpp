@@ -6,6 +6,22 @@ namespace tudat
 namespace propagators
 {
 
+template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
+Eigen::MatrixXd, double, double >(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd, double > > integrator,
+        const double initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        PropagationHistory< double, double >& solutionHistory,
+        PropagationHistory< double, double >& dependentVariableHistory,
+        PropagationHistory< double, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+        const std::function< void( Eigen::MatrixXd& ) > statePostProcessingFunction,
+        const int saveFrequency,
+        const double printInterval,
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< PropagationOutputSink< double, double > > outputSink,
+        const bool keepHistoryInMemory );
+
 template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
 Eigen::MatrixXd, double, double >(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd, double > > integrator,
@@ -20,6 +36,22 @@ Eigen::MatrixXd, double, double >(
         const double printInterval,
         const std::chrono::steady_clock::time_point initialClockTime );
 
+template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
+Eigen::VectorXd, double, double >(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd, double > > integrator,
+        const double initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        PropagationHistory< double, double >& solutionHistory,
+        PropagationHistory< double, double >& dependentVariableHistory,
+        PropagationHistory< double, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+        const std::function< void( Eigen::VectorXd& ) > statePostProcessingFunction,
+        const int saveFrequency,
+        const double printInterval,
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< PropagationOutputSink< double, double > > outputSink,
+        const bool keepHistoryInMemory );
+
 template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
 Eigen::VectorXd, double, double >(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd, double > > integrator,
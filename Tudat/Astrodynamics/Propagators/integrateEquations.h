@@ -13,6 +13,7 @@
 
 #include <Eigen/Core>
 #include <boost/lambda/lambda.hpp>
+#include <algorithm>
 #include <chrono>
 #include <limits>
 
@@ -21,7 +22,9 @@
 #include "Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h"
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Basics/propagationHistory.h"
 #include "Tudat/Basics/timeType.h"
+#include "Tudat/Astrodynamics/Propagators/propagationOutputSink.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
@@ -344,10 +347,9 @@ void getFinalStateForExactTerminationCondition(
  * \param timeStep Last time step taken by integrator.
  * \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  * derivative model).
- * \param solutionHistory History of state variables that are to be saved given as map
- * (time as key; returned by reference)
- * \param dependentVariableHistory History of dependent variables that are to be saved given as map
- * (time as key; returned by reference)
+ * \param solutionHistory History of state variables that are to be saved, in order of propagation (returned by reference)
+ * \param dependentVariableHistory History of dependent variables that are to be saved, in order of propagation
+ * (returned by reference)
  * \param currentCpuTime Current run time of propagation.
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
@@ -356,8 +358,8 @@ void propagateToExactTerminationCondition(
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
         const TimeStepType timeStep,
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        PropagationHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+        PropagationHistory< TimeType, double >& dependentVariableHistory,
         const double currentCpuTime )
 {
     // Turn off step size control
@@ -378,37 +380,22 @@ void propagateToExactTerminationCondition(
     bool recomputeDependentVariables = false;
     if( dependentVariableHistory.size( ) > 0 )
     {
-        if( dependentVariableHistory.rbegin( )->first == solutionHistory.rbegin( )->first )
+        if( dependentVariableHistory.getLastTime( ) == solutionHistory.getLastTime( ) )
         {
-            if( timeStep > 0 )
-            {
-                dependentVariableHistory.erase( std::prev( dependentVariableHistory.end() ) );
-            }
-            else
-            {
-                dependentVariableHistory.erase(  dependentVariableHistory.begin( ) );
-            }
+            dependentVariableHistory.removeLastEntry( );
             recomputeDependentVariables = true;
         }
     }
 
     // Remove state entry last added, and enter converged final state
-    if( timeStep > 0 )
-    {
-        solutionHistory.erase( std::prev( solutionHistory.end() ) );
-        solutionHistory[ endTime ] = endState;
-    }
-    else
-    {
-        solutionHistory.erase( solutionHistory.begin( ) );
-        solutionHistory[ endTime ] = endState;
-    }
+    solutionHistory.removeLastEntry( );
+    solutionHistory.insertAtEnd( endTime, endState );
 
     // Recompute final dependent variables, if required
     if( recomputeDependentVariables )
     {
         integrator->getStateDerivativeFunction( )( endTime, endState );
-        dependentVariableHistory[ endTime ] = dependentVariableFunction( );
+        dependentVariableHistory.insertAtEnd( endTime, dependentVariableFunction( ) );
 
         // Check stopping conditions to be able to save details
         propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
@@ -418,6 +405,74 @@ void propagateToExactTerminationCondition(
     integrator->setStepSizeControl( true );
 }
 
+//! Function to pass the saved steps of a propagation that are final to an output sink
+/*!
+ *  Function to pass the saved steps of a propagation that are final to an output sink, and to remove them from the
+ *  propagation history if the history is not to be kept in memory. During the propagation, the last saved step is not
+ *  final, as it may still be replaced (e.g. when propagating to an exact termination condition), and it is therefore
+ *  only processed when the next step is saved, or when the propagation has finished. If the history is not kept in
+ *  memory, only the last saved step is retained in the history (and only the last cumulative computation time).
+ *  \param solutionHistory History of state variables that are saved (modified if history is not kept in memory).
+ *  \param dependentVariableHistory History of dependent variables that are saved (modified if history is not kept in
+ *  memory).
+ *  \param cumulativeComputationTimeHistory History of cumulative computation times (modified if history is not kept in
+ *  memory).
+ *  \param outputSink Sink to which the final steps are passed (none if nullptr).
+ *  \param keepHistoryInMemory Boolean denoting whether the full history is to be kept in memory.
+ *  \param numberOfProcessedSteps Number of entries at the start of the history that have already been passed to the
+ *  output sink (modified by this function).
+ *  \param isPropagationFinished Boolean denoting whether the propagation has finished, in which case the last saved step
+ *  is final.
+ */
+template< typename TimeType, typename StateScalarType >
+void processFinalPropagationOutputSteps(
+        PropagationHistory< TimeType, StateScalarType >& solutionHistory,
+        PropagationHistory< TimeType, double >& dependentVariableHistory,
+        PropagationHistory< TimeType, double >& cumulativeComputationTimeHistory,
+        const std::shared_ptr< PropagationOutputSink< StateScalarType, TimeType > >& outputSink,
+        const bool keepHistoryInMemory,
+        unsigned int& numberOfProcessedSteps,
+        const bool isPropagationFinished )
+{
+    unsigned int numberOfFinalSteps = solutionHistory.size( );
+    if( !isPropagationFinished && numberOfFinalSteps > 0 )
+    {
+        numberOfFinalSteps--;
+    }
+
+    // Pass final steps to sink, with dependent variables if they are saved at the same steps as the states.
+    if( outputSink != nullptr )
+    {
+        bool areDependentVariablesSaved = ( dependentVariableHistory.size( ) == solutionHistory.size( ) );
+        for( unsigned int i = numberOfProcessedSteps; i < numberOfFinalSteps; i++ )
+        {
+            outputSink->processStep(
+                        solutionHistory.getTime( i ), solutionHistory.getState( i ),
+                        areDependentVariablesSaved ? dependentVariableHistory.getState( i ) :
+                                                     Eigen::Map< const Eigen::MatrixXd >( nullptr, 0, 0 ) );
+        }
+    }
+    numberOfProcessedSteps = std::max( numberOfProcessedSteps, numberOfFinalSteps );
+
+    // Remove processed steps from memory, retaining the last saved step.
+    if( !keepHistoryInMemory )
+    {
+        if( solutionHistory.size( ) > 1 && numberOfProcessedSteps > 0 )
+        {
+            unsigned int numberOfStepsToRemove = std::min( numberOfProcessedSteps, solutionHistory.size( ) - 1 );
+            solutionHistory.removeFirstEntries( numberOfStepsToRemove );
+            dependentVariableHistory.removeFirstEntries(
+                        std::min( numberOfStepsToRemove, dependentVariableHistory.size( ) ) );
+            numberOfProcessedSteps -= numberOfStepsToRemove;
+        }
+
+        if( cumulativeComputationTimeHistory.size( ) > 1 )
+        {
+            cumulativeComputationTimeHistory.removeFirstEntries( cumulativeComputationTimeHistory.size( ) - 1 );
+        }
+    }
+}
+
 //! Function to numerically integrate a given first order differential equation
 /*!
  *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
@@ -425,12 +480,12 @@ void propagateToExactTerminationCondition(
  *  \param integrator Numerical integrator used for propagation
  *  \param initialTimeStep Time step to use for first step of numerical integration
  *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
- *  \param solutionHistory History of state variables that are to be saved given as map
- *  (time as key; returned by reference)
- *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
- *  (time as key; returned by reference)
- *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
- *  as map (time as key; returned by reference)
+ *  \param solutionHistory History of state variables that are to be saved, stored contiguously in order of propagation
+ *  (returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved, stored contiguously in order of
+ *  propagation (returned by reference)
+ *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved, stored
+ *  contiguously in order of propagation (returned by reference)
  *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  *  derivative model).
  *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
@@ -439,6 +494,10 @@ void propagateToExactTerminationCondition(
  *  \param printInterval Frequency with which to print progress to console (nan = never).
  *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
  *  By default now(), i.e. the moment at which this function is called.
+ *  \param outputSink Sink to which each saved step is passed during the propagation (none by default).
+ *  \param keepHistoryInMemory Boolean denoting whether the full history is to be kept in memory (default true). If false,
+ *  the histories only contain the last saved step (and last computation time) after the propagation, so that the
+ *  memory use does not depend on the length of the propagation.
  *  \return Event that triggered the termination of the propagation
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
@@ -446,14 +505,16 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const TimeStepType initialTimeStep,
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
-        std::map< TimeType, double >& cumulativeComputationTimeHistory,
+        PropagationHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+        PropagationHistory< TimeType, double >& dependentVariableHistory,
+        PropagationHistory< TimeType, double >& cumulativeComputationTimeHistory,
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
         const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
         const int saveFrequency = TUDAT_NAN,
         const TimeType printInterval = TUDAT_NAN,
-        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+        const std::shared_ptr< PropagationOutputSink< typename StateType::Scalar, TimeType > > outputSink = nullptr,
+        const bool keepHistoryInMemory = true )
 {
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason;
 
@@ -464,20 +525,27 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
 
     // Initialization of numerical solutions for variational equations
     solutionHistory.clear( );
-    solutionHistory[ currentTime ] = newState;
+    solutionHistory.append( currentTime, newState );
 
     dependentVariableHistory.clear( );
     if( !( dependentVariableFunction == nullptr ) )
     {
         integrator->getStateDerivativeFunction( )( currentTime, newState );
-        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        dependentVariableHistory.append( currentTime, dependentVariableFunction( ) );
     }
 
     // CPU time
     cumulativeComputationTimeHistory.clear( );
     double currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                 std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
-    cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+    cumulativeComputationTimeHistory.append( currentTime, currentCPUTime );
+
+    // Initialize output sink
+    unsigned int numberOfProcessedOutputSteps = 0;
+    if( outputSink != nullptr )
+    {
+        outputSink->initializePropagation( );
+    }
 
     // Set initial time step and total integration time.
     TimeStepType timeStep = initialTimeStep;
@@ -523,17 +591,25 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 currentTime = integrator->getCurrentIndependentVariable( );
                 timeStep = integrator->getNextStepSize( );
 
-                // Save integration result in map
+                // Save integration result in history
                 saveIndex++;
                 saveIndex = saveIndex % saveFrequency;
                 if( saveIndex == 0 )
                 {
-                    solutionHistory[ currentTime ] = newState;
+                    solutionHistory.insertAtEnd( currentTime, newState );
 
                     if( !( dependentVariableFunction == nullptr ) )
                     {
                         integrator->getStateDerivativeFunction( )( currentTime, newState );
-                        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        dependentVariableHistory.insertAtEnd( currentTime, dependentVariableFunction( ) );
+                    }
+
+                    // Process steps that can no longer be modified
+                    if( outputSink != nullptr || !keepHistoryInMemory )
+                    {
+                        processFinalPropagationOutputSteps(
+                                    solutionHistory, dependentVariableHistory, cumulativeComputationTimeHistory,
+                                    outputSink, keepHistoryInMemory, numberOfProcessedOutputSteps, false );
                     }
                 }
             }
@@ -548,7 +624,11 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
 
             currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                         std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
-            cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+            cumulativeComputationTimeHistory.insertAtEnd( currentTime, currentCPUTime );
+            if( !keepHistoryInMemory && cumulativeComputationTimeHistory.size( ) > 1 )
+            {
+                cumulativeComputationTimeHistory.removeFirstEntries( cumulativeComputationTimeHistory.size( ) - 1 );
+            }
 
             // Print solutions
             if( printInterval == printInterval )
@@ -607,9 +687,93 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
     }
     while( !breakPropagation );
 
+    // Process remaining steps
+    if( outputSink != nullptr || !keepHistoryInMemory )
+    {
+        processFinalPropagationOutputSteps(
+                    solutionHistory, dependentVariableHistory, cumulativeComputationTimeHistory,
+                    outputSink, keepHistoryInMemory, numberOfProcessedOutputSteps, true );
+    }
+    if( outputSink != nullptr )
+    {
+        outputSink->finalizePropagation( );
+    }
+
+    return propagationTerminationReason;
+}
+
+//! Function to numerically integrate a given first order differential equation, with output history as maps
+/*!
+ *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+ *  a single independent variable and the current state. This function provides the output as maps, and is kept for
+ *  code that requires the history in that form. The history is generated in contiguous storage during the propagation
+ *  (see PropagationHistory), and is converted to maps upon completion.
+ *  \param integrator Numerical integrator used for propagation
+ *  \param initialTimeStep Time step to use for first step of numerical integration
+ *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+ *  \param solutionHistory History of state variables that are to be saved given as map
+ *  (time as key; returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
+ *  (time as key; returned by reference)
+ *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
+ *  as map (time as key; returned by reference)
+ *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+ *  derivative model).
+ *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+ *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration time
+ *  steps, with n = saveFrequency).
+ *  \param printInterval Frequency with which to print progress to console (nan = never).
+ *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+ *  By default now(), i.e. the moment at which this function is called.
+ *  \return Event that triggered the termination of the propagation
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
+        const TimeStepType initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        std::map< TimeType, StateType >& solutionHistory,
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        std::map< TimeType, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+        const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+        const int saveFrequency = TUDAT_NAN,
+        const TimeType printInterval = TUDAT_NAN,
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+{
+    PropagationHistory< TimeType, typename StateType::Scalar > solutionPropagationHistory;
+    PropagationHistory< TimeType, double > dependentVariablePropagationHistory;
+    PropagationHistory< TimeType, double > cumulativeComputationTimePropagationHistory;
+
+    std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason =
+            integrateEquationsFromIntegrator< StateType, TimeType, TimeStepType >(
+                integrator, initialTimeStep, propagationTerminationCondition, solutionPropagationHistory,
+                dependentVariablePropagationHistory, cumulativeComputationTimePropagationHistory,
+                dependentVariableFunction, statePostProcessingFunction, saveFrequency, printInterval, initialClockTime );
+
+    solutionHistory = solutionPropagationHistory.template getMap< StateType >( );
+    dependentVariableHistory = dependentVariablePropagationHistory.template getMap< Eigen::VectorXd >( );
+    cumulativeComputationTimeHistory = cumulativeComputationTimePropagationHistory.template getMap< double >( );
+
     return propagationTerminationReason;
 }
 
+extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
+Eigen::MatrixXd, double, double >(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd, double > > integrator,
+        const double initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        PropagationHistory< double, double >& solutionHistory,
+        PropagationHistory< double, double >& dependentVariableHistory,
+        PropagationHistory< double, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+        const std::function< void( Eigen::MatrixXd& ) > statePostProcessingFunction,
+        const int saveFrequency,
+        const double printInterval,
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< PropagationOutputSink< double, double > > outputSink,
+        const bool keepHistoryInMemory );
+
 extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
 Eigen::MatrixXd, double, double >(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd, double > > integrator,
@@ -624,6 +788,21 @@ Eigen::MatrixXd, double, double >(
         const double printInterval,
         const std::chrono::steady_clock::time_point initialClockTime );
 
+extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
+Eigen::VectorXd, double, double >(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd, double > > integrator,
+        const double initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        PropagationHistory< double, double >& solutionHistory,
+        PropagationHistory< double, double >& dependentVariableHistory,
+        PropagationHistory< double, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+        const std::function< void( Eigen::VectorXd& ) > statePostProcessingFunction,
+        const int saveFrequency,
+        const double printInterval,
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< PropagationOutputSink< double, double > > outputSink,
+        const bool keepHistoryInMemory );
 
 extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
 Eigen::VectorXd, double, double >(
@@ -686,6 +865,29 @@ public:
             const TimeType printInterval = TUDAT_NAN,
             const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) );
 
+    //! Function to numerically integrate a given first order differential equation, with contiguous output history
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. Output is provided as PropagationHistory objects, which
+     *  store the history contiguously, in order of propagation. Arguments are as for the map-based version of this function,
+     *  with the addition of the outputSink and keepHistoryInMemory arguments (see integrateEquationsFromIntegrator).
+     *  \return Event that triggered the termination of the propagation
+     */
+    static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
+            std::function< StateType( const TimeType, const StateType& ) > stateDerivativeFunction,
+            PropagationHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+            const StateType initialState,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+            const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+            PropagationHistory< TimeType, double >& dependentVariableHistory,
+            PropagationHistory< TimeType, double >& cumulativeComputationTimeHistory,
+            const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+            const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+            const TimeType printInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< PropagationOutputSink< typename StateType::Scalar, TimeType > > outputSink = nullptr,
+            const bool keepHistoryInMemory = true );
+
 };
 
 //! Interface class for integrating some state derivative function.
@@ -727,6 +929,61 @@ public:
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const double printInterval = TUDAT_NAN,
             const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+    {
+        PropagationHistory< double, typename StateType::Scalar > solutionPropagationHistory;
+        PropagationHistory< double, double > dependentVariablePropagationHistory;
+        PropagationHistory< double, double > cumulativeComputationTimePropagationHistory;
+
+        std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason = integrateEquations(
+                    stateDerivativeFunction, solutionPropagationHistory, initialState, integratorSettings,
+                    propagationTerminationCondition, dependentVariablePropagationHistory,
+                    cumulativeComputationTimePropagationHistory, dependentVariableFunction, statePostProcessingFunction,
+                    printInterval, initialClockTime );
+
+        solutionHistory = solutionPropagationHistory.template getMap< StateType >( );
+        dependentVariableHistory = dependentVariablePropagationHistory.template getMap< Eigen::VectorXd >( );
+        cumulativeComputationTimeHistory = cumulativeComputationTimePropagationHistory.template getMap< double >( );
+
+        return propagationTerminationReason;
+    }
+
+    //! Function to numerically integrate a given first order differential equation, with contiguous output history
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. Output is provided as PropagationHistory objects, which
+     *  store the history contiguously, in order of propagation.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param solutionHistory History of numerical states (returned by reference)
+     *  \param initialState Initial state
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+     *  \param dependentVariableHistory History of dependent variables that are to be saved (returned by reference)
+     *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved
+     *  (returned by reference)
+     *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+     *  derivative model).
+     *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+     *  \param printInterval Frequency with which to print progress to console (nan = never).
+     *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+     *  By default now(), i.e. the moment at which this function is called.
+     *  \param outputSink Sink to which each saved step is passed during the propagation (none by default).
+     *  \param keepHistoryInMemory Boolean denoting whether the full history is to be kept in memory (default true).
+     *  \return Event that triggered the termination of the propagation
+     */
+    static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
+            std::function< StateType( const double, const StateType& ) > stateDerivativeFunction,
+            PropagationHistory< double, typename StateType::Scalar >& solutionHistory,
+            const StateType initialState,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+            const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+            PropagationHistory< double, double >& dependentVariableHistory,
+            PropagationHistory< double, double >& cumulativeComputationTimeHistory,
+            const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+            const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+            const double printInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< PropagationOutputSink< typename StateType::Scalar, double > > outputSink = nullptr,
+            const bool keepHistoryInMemory = true )
     {
         std::function< bool( const double, const double ) > stopPropagationFunction =
                 std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
@@ -749,7 +1006,9 @@ public:
                     statePostProcessingFunction,
                     integratorSettings->saveFrequency_,
                     printInterval,
-                    initialClockTime );
+                    initialClockTime,
+                    outputSink,
+                    keepHistoryInMemory );
     }
 
 };
@@ -793,6 +1052,61 @@ public:
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const Time printInterval = TUDAT_NAN,
             const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+    {
+        PropagationHistory< Time, typename StateType::Scalar > solutionPropagationHistory;
+        PropagationHistory< Time, double > dependentVariablePropagationHistory;
+        PropagationHistory< Time, double > cumulativeComputationTimePropagationHistory;
+
+        std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason = integrateEquations(
+                    stateDerivativeFunction, solutionPropagationHistory, initialState, integratorSettings,
+                    propagationTerminationCondition, dependentVariablePropagationHistory,
+                    cumulativeComputationTimePropagationHistory, dependentVariableFunction, statePostProcessingFunction,
+                    printInterval, initialClockTime );
+
+        solutionHistory = solutionPropagationHistory.template getMap< StateType >( );
+        dependentVariableHistory = dependentVariablePropagationHistory.template getMap< Eigen::VectorXd >( );
+        cumulativeComputationTimeHistory = cumulativeComputationTimePropagationHistory.template getMap< double >( );
+
+        return propagationTerminationReason;
+    }
+
+    //! Function to numerically integrate a given first order differential equation, with contiguous output history
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. Output is provided as PropagationHistory objects, which
+     *  store the history contiguously, in order of propagation.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param solutionHistory History of numerical states (returned by reference)
+     *  \param initialState Initial state
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+     *  \param dependentVariableHistory History of dependent variables that are to be saved (returned by reference)
+     *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved
+     *  (returned by reference)
+     *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+     *  derivative model).
+     *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+     *  \param printInterval Frequency with which to print progress to console (nan = never).
+     *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+     *  By default now(), i.e. the moment at which this function is called.
+     *  \param outputSink Sink to which each saved step is passed during the propagation (none by default).
+     *  \param keepHistoryInMemory Boolean denoting whether the full history is to be kept in memory (default true).
+     *  \return Event that triggered the termination of the propagation
+     */
+    static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
+            std::function< StateType( const Time, const StateType& ) > stateDerivativeFunction,
+            PropagationHistory< Time, typename StateType::Scalar >& solutionHistory,
+            const StateType initialState,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< Time > > integratorSettings,
+            const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+            PropagationHistory< Time, double >& dependentVariableHistory,
+            PropagationHistory< Time, double >& cumulativeComputationTimeHistory,
+            const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+            const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+            const Time printInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< PropagationOutputSink< typename StateType::Scalar, Time > > outputSink = nullptr,
+            const bool keepHistoryInMemory = true )
     {
         std::function< bool( const double, const double ) > stopPropagationFunction =
                 std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
@@ -815,7 +1129,9 @@ public:
                     statePostProcessingFunction,
                     integratorSettings->saveFrequency_,
                     printInterval,
-                    initialClockTime );
+                    initialClockTime,
+                    outputSink,
+                    keepHistoryInMemory );
     }
 
 };
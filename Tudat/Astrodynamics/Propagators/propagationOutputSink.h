@@ -0,0 +1,684 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONOUTPUTSINK_H
+#define TUDAT_PROPAGATIONOUTPUTSINK_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/InputOutput/binaryHistoryFile.h"
+#include "Tudat/Mathematics/NumericalIntegrators/stateHistoryRingBuffer.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Base class for objects that process the output of a propagation while it is running.
+/*!
+ *  Base class for objects that process the output of a propagation while it is running (e.g. writing it to a file, or
+ *  retaining only a part of it), so that the full history need not be kept in memory. The processStep function is
+ *  called once for each saved step (i.e. at the same epochs at which the state is saved in the propagation history), in
+ *  order of propagation. A step is only passed to the sink once it is final, i.e. when the next step has been saved or
+ *  the propagation has terminated, so that the final step is the one at the (exact) termination condition.
+ *  \tparam StateScalarType Scalar type of the state entries.
+ *  \tparam TimeType Type of the independent variable.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class PropagationOutputSink
+{
+public:
+
+    //! Typedef for view on a (matrix-valued) state, as passed to processStep.
+    typedef Eigen::Map< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > StateView;
+
+    //! Typedef for view on dependent variables, as passed to processStep (zero size if none are saved).
+    typedef Eigen::Map< const Eigen::MatrixXd > DependentVariableView;
+
+    //! Destructor
+    virtual ~PropagationOutputSink( ){ }
+
+    //! Function that is called before the start of each propagation.
+    /*!
+     *  Function that is called before the start of each propagation, which may be used to reset the sink. By default,
+     *  nothing is done.
+     */
+    virtual void initializePropagation( ){ }
+
+    //! Function to process a single saved step of the propagation.
+    /*!
+     *  Function to process a single saved step of the propagation. The views that are passed to this function are only
+     *  valid during the call, their contents must be copied if they are to be retained.
+     *  \param time Time of the step.
+     *  \param state State at the step.
+     *  \param dependentVariables Dependent variables at the step (zero size if no dependent variables are saved).
+     */
+    virtual void processStep( const TimeType& time, const StateView& state,
+                              const DependentVariableView& dependentVariables ) = 0;
+
+    //! Function that is called after the last step of each propagation has been processed.
+    /*!
+     *  Function that is called after the last step of each propagation has been processed, which may be used to flush
+     *  any output. By default, nothing is done.
+     */
+    virtual void finalizePropagation( ){ }
+};
+
+//! Propagation output sink retaining only the most recent steps in memory.
+/*!
+ *  Propagation output sink retaining only the most recent steps in memory, in a ring buffer of fixed capacity, so that
+ *  the memory use does not depend on the length of the propagation. After the first steps, no memory is allocated.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class RingBufferOutputSink: public PropagationOutputSink< StateScalarType, TimeType >
+{
+public:
+
+    using typename PropagationOutputSink< StateScalarType, TimeType >::StateView;
+    using typename PropagationOutputSink< StateScalarType, TimeType >::DependentVariableView;
+
+    //! Typedef for (matrix-valued) state entry.
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateMatrixType;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param capacity Maximum number of (most recent) steps that is retained.
+     */
+    RingBufferOutputSink( const unsigned int capacity ):
+        times_( capacity ), states_( capacity ), dependentVariables_( capacity )
+    {
+        if( capacity == 0 )
+        {
+            throw std::runtime_error( "Error when creating ring buffer output sink, capacity must be larger than 0." );
+        }
+    }
+
+    //! Destructor
+    ~RingBufferOutputSink( ){ }
+
+    //! Function that is called before the start of each propagation, removes all retained steps.
+    void initializePropagation( )
+    {
+        times_.clear( );
+        states_.clear( );
+        dependentVariables_.clear( );
+    }
+
+    //! Function to process a single saved step of the propagation, replacing the oldest step if the buffer is full.
+    /*!
+     *  Function to process a single saved step of the propagation, replacing the oldest step if the buffer is full.
+     *  \param time Time of the step.
+     *  \param state State at the step.
+     *  \param dependentVariables Dependent variables at the step (zero size if no dependent variables are saved).
+     */
+    void processStep( const TimeType& time, const StateView& state,
+                      const DependentVariableView& dependentVariables )
+    {
+        times_.push_front( time );
+        states_.push_front( state );
+        dependentVariables_.push_front( dependentVariables );
+    }
+
+    //! Function to retrieve the number of retained steps.
+    /*!
+     *  Function to retrieve the number of retained steps.
+     *  \return Number of retained steps.
+     */
+    unsigned int getNumberOfSteps( ) const
+    {
+        return times_.size( );
+    }
+
+    //! Function to retrieve the time of a retained step.
+    /*!
+     *  Function to retrieve the time of a retained step.
+     *  \param index Index of the step, counted backwards from the most recent step (index 0).
+     *  \return Time of the requested step.
+     */
+    const TimeType& getTime( const unsigned int index ) const
+    {
+        return times_.at( index );
+    }
+
+    //! Function to retrieve the state of a retained step.
+    /*!
+     *  Function to retrieve the state of a retained step.
+     *  \param index Index of the step, counted backwards from the most recent step (index 0).
+     *  \return State at the requested step.
+     */
+    const StateMatrixType& getState( const unsigned int index ) const
+    {
+        return states_.at( index );
+    }
+
+    //! Function to retrieve the dependent variables of a retained step.
+    /*!
+     *  Function to retrieve the dependent variables of a retained step.
+     *  \param index Index of the step, counted backwards from the most recent step (index 0).
+     *  \return Dependent variables at the requested step.
+     */
+    const Eigen::MatrixXd& getDependentVariables( const unsigned int index ) const
+    {
+        return dependentVariables_.at( index );
+    }
+
+    //! Function to retrieve the retained state history as a map.
+    /*!
+     *  Function to retrieve the retained state history as a map (for vector-valued states).
+     *  \return Retained state history (time as key).
+     */
+    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getStateHistory( ) const
+    {
+        std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > stateHistory;
+        for( unsigned int i = 0; i < times_.size( ); i++ )
+        {
+            stateHistory[ times_.at( i ) ] = states_.at( i );
+        }
+        return stateHistory;
+    }
+
+    //! Function to retrieve the retained dependent variable history as a map.
+    /*!
+     *  Function to retrieve the retained dependent variable history as a map.
+     *  \return Retained dependent variable history (time as key).
+     */
+    std::map< TimeType, Eigen::VectorXd > getDependentVariableHistory( ) const
+    {
+        std::map< TimeType, Eigen::VectorXd > dependentVariableHistory;
+        for( unsigned int i = 0; i < times_.size( ); i++ )
+        {
+            dependentVariableHistory[ times_.at( i ) ] = dependentVariables_.at( i );
+        }
+        return dependentVariableHistory;
+    }
+
+private:
+
+    //! Times of retained steps (most recent at front).
+    numerical_integrators::StateHistoryRingBuffer< TimeType > times_;
+
+    //! States at retained steps (most recent at front).
+    numerical_integrators::StateHistoryRingBuffer< StateMatrixType > states_;
+
+    //! Dependent variables at retained steps (most recent at front).
+    numerical_integrators::StateHistoryRingBuffer< Eigen::MatrixXd > dependentVariables_;
+};
+
+//! Propagation output sink writing each step to a binary history file.
+/*!
+ *  Propagation output sink writing each step to a binary history file (see BinaryHistoryFileWriter), as a single row
+ *  containing the time, the state entries (row by row, for matrix-valued states) and the dependent variables. The file
+ *  is (re)created at the start of each propagation, and written through a buffer, so that the memory use does not depend
+ *  on the length of the propagation. The file can be read without loading it fully using BinaryHistoryFileReader.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class BinaryFileOutputSink: public PropagationOutputSink< StateScalarType, TimeType >
+{
+public:
+
+    using typename PropagationOutputSink< StateScalarType, TimeType >::StateView;
+    using typename PropagationOutputSink< StateScalarType, TimeType >::DependentVariableView;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param filePath Path of the binary history file that is to be written.
+     *  \param columnNames Names of the columns of the file (time, state entries, dependent variables). If empty (default),
+     *  the columns are named "time", "state_i" and "dependent_variable_i".
+     */
+    BinaryFileOutputSink( const boost::filesystem::path& filePath,
+                          const std::vector< std::string >& columnNames = std::vector< std::string >( ) ):
+        filePath_( filePath ), columnNames_( columnNames ){ }
+
+    //! Destructor
+    ~BinaryFileOutputSink( ){ }
+
+    //! Function that is called before the start of each propagation, closes the file of any previous propagation.
+    void initializePropagation( )
+    {
+        fileWriter_.reset( );
+    }
+
+    //! Function to write a single saved step of the propagation to the file.
+    /*!
+     *  Function to write a single saved step of the propagation to the file. The file is created at the first step of the
+     *  propagation, when the number of columns is known.
+     *  \param time Time of the step.
+     *  \param state State at the step.
+     *  \param dependentVariables Dependent variables at the step (zero size if no dependent variables are saved).
+     */
+    void processStep( const TimeType& time, const StateView& state,
+                      const DependentVariableView& dependentVariables )
+    {
+        const int stateSize = state.size( );
+        const int dependentVariableSize = dependentVariables.size( );
+        if( fileWriter_ == nullptr )
+        {
+            createFileWriter( stateSize, dependentVariableSize );
+        }
+
+        // Collect row entries (matrix-valued states row by row), and write to file.
+        if( currentRow_.rows( ) != 1 + stateSize + dependentVariableSize )
+        {
+            throw std::runtime_error( "Error when writing propagation output to binary file " + filePath_.string( ) +
+                                      ", size of output changed during propagation." );
+        }
+        currentRow_( 0 ) = static_cast< double >( time );
+        for( int i = 0; i < state.rows( ); i++ )
+        {
+            for( int j = 0; j < state.cols( ); j++ )
+            {
+                currentRow_( 1 + i * state.cols( ) + j ) = static_cast< double >( state( i, j ) );
+            }
+        }
+        if( dependentVariableSize > 0 )
+        {
+            currentRow_.segment( 1 + stateSize, dependentVariableSize ) =
+                    Eigen::Map< const Eigen::VectorXd >( dependentVariables.data( ), dependentVariableSize );
+        }
+        fileWriter_->appendRow( currentRow_ );
+    }
+
+    //! Function that is called after the last step of each propagation has been processed, closes the file.
+    void finalizePropagation( )
+    {
+        if( fileWriter_ != nullptr )
+        {
+            fileWriter_->close( );
+        }
+    }
+
+    //! Function to retrieve the path of the binary history file that is written.
+    /*!
+     *  Function to retrieve the path of the binary history file that is written.
+     *  \return Path of the binary history file that is written.
+     */
+    boost::filesystem::path getFilePath( ) const
+    {
+        return filePath_;
+    }
+
+private:
+
+    //! Function to create the file writer, with the column names of the file.
+    void createFileWriter( const int stateSize, const int dependentVariableSize )
+    {
+        std::vector< std::string > fileColumnNames = columnNames_;
+        if( fileColumnNames.size( ) == 0 )
+        {
+            fileColumnNames.push_back( "time" );
+            for( int i = 0; i < stateSize; i++ )
+            {
+                fileColumnNames.push_back( "state_" + std::to_string( i ) );
+            }
+            for( int i = 0; i < dependentVariableSize; i++ )
+            {
+                fileColumnNames.push_back( "dependent_variable_" + std::to_string( i ) );
+            }
+        }
+        else if( static_cast< int >( fileColumnNames.size( ) ) != 1 + stateSize + dependentVariableSize )
+        {
+            throw std::runtime_error( "Error when creating binary propagation output file " + filePath_.string( ) +
+                                      ", number of column names is inconsistent with size of output." );
+        }
+
+        fileWriter_ = std::make_shared< input_output::BinaryHistoryFileWriter >( filePath_, fileColumnNames );
+        currentRow_.resize( fileColumnNames.size( ) );
+    }
+
+    //! Path of the binary history file that is written.
+    boost::filesystem::path filePath_;
+
+    //! Names of the columns of the file (empty if default names are to be used).
+    std::vector< std::string > columnNames_;
+
+    //! Object writing the binary history file of the current propagation.
+    std::shared_ptr< input_output::BinaryHistoryFileWriter > fileWriter_;
+
+    //! Pre-allocated row that is written to the file.
+    Eigen::VectorXd currentRow_;
+};
+
+//! Propagation output sink passing only every n-th step to another sink.
+/*!
+ *  Propagation output sink passing only every n-th step (starting with the initial step) to another sink, to reduce the
+ *  output rate of a propagation without modifying its integrator settings. Optionally, the final step of the
+ *  propagation is always passed on, so that the output always includes the termination state.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class DecimatingOutputSink: public PropagationOutputSink< StateScalarType, TimeType >
+{
+public:
+
+    using typename PropagationOutputSink< StateScalarType, TimeType >::StateView;
+    using typename PropagationOutputSink< StateScalarType, TimeType >::DependentVariableView;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param targetSink Sink to which the selected steps are passed.
+     *  \param decimationFactor Number n, such that every n-th step is passed to targetSink.
+     *  \param passFinalStep Boolean denoting whether the final step of the propagation is always passed to targetSink.
+     */
+    DecimatingOutputSink( const std::shared_ptr< PropagationOutputSink< StateScalarType, TimeType > > targetSink,
+                          const unsigned int decimationFactor,
+                          const bool passFinalStep = true ):
+        targetSink_( targetSink ), decimationFactor_( decimationFactor ), passFinalStep_( passFinalStep ),
+        stepCounter_( 0 ), isLastStepPassed_( true )
+    {
+        if( targetSink_ == nullptr )
+        {
+            throw std::runtime_error( "Error when creating decimating output sink, no target sink provided." );
+        }
+        if( decimationFactor_ == 0 )
+        {
+            throw std::runtime_error( "Error when creating decimating output sink, decimation factor must be larger than 0." );
+        }
+    }
+
+    //! Destructor
+    ~DecimatingOutputSink( ){ }
+
+    //! Function that is called before the start of each propagation, resets the step counter and the target sink.
+    void initializePropagation( )
+    {
+        stepCounter_ = 0;
+        isLastStepPassed_ = true;
+        targetSink_->initializePropagation( );
+    }
+
+    //! Function to process a single saved step of the propagation, passing it on if it is an n-th step.
+    /*!
+     *  Function to process a single saved step of the propagation, passing it on if it is an n-th step. If the final step
+     *  is always to be passed on, skipped steps are copied (into pre-allocated memory), so that they can be passed on
+     *  when the propagation is finalized.
+     *  \param time Time of the step.
+     *  \param state State at the step.
+     *  \param dependentVariables Dependent variables at the step (zero size if no dependent variables are saved).
+     */
+    void processStep( const TimeType& time, const StateView& state,
+                      const DependentVariableView& dependentVariables )
+    {
+        if( stepCounter_ == 0 )
+        {
+            targetSink_->processStep( time, state, dependentVariables );
+            isLastStepPassed_ = true;
+        }
+        else if( passFinalStep_ )
+        {
+            lastTime_ = time;
+            lastState_ = state;
+            lastDependentVariables_ = dependentVariables;
+            isLastStepPassed_ = false;
+        }
+
+        stepCounter_++;
+        if( stepCounter_ == decimationFactor_ )
+        {
+            stepCounter_ = 0;
+        }
+    }
+
+    //! Function that is called after the last step of each propagation, passes the final step on (if required).
+    void finalizePropagation( )
+    {
+        if( passFinalStep_ && !isLastStepPassed_ )
+        {
+            targetSink_->processStep(
+                        lastTime_, StateView( lastState_.data( ), lastState_.rows( ), lastState_.cols( ) ),
+                        DependentVariableView( lastDependentVariables_.data( ), lastDependentVariables_.rows( ),
+                                               lastDependentVariables_.cols( ) ) );
+            isLastStepPassed_ = true;
+        }
+        targetSink_->finalizePropagation( );
+    }
+
+private:
+
+    //! Sink to which the selected steps are passed.
+    std::shared_ptr< PropagationOutputSink< StateScalarType, TimeType > > targetSink_;
+
+    //! Number n, such that every n-th step is passed to targetSink_.
+    unsigned int decimationFactor_;
+
+    //! Boolean denoting whether the final step of the propagation is always passed to targetSink_.
+    bool passFinalStep_;
+
+    //! Number of steps processed since the last step that was passed on.
+    unsigned int stepCounter_;
+
+    //! Boolean denoting whether the last processed step was passed on.
+    bool isLastStepPassed_;
+
+    //! Time of the last processed step.
+    TimeType lastTime_;
+
+    //! State at the last processed step.
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > lastState_;
+
+    //! Dependent variables at the last processed step.
+    Eigen::MatrixXd lastDependentVariables_;
+};
+
+//! Propagation output sink calling a user-defined function for each step.
+template< typename StateScalarType = double, typename TimeType = double >
+class CallbackOutputSink: public PropagationOutputSink< StateScalarType, TimeType >
+{
+public:
+
+    using typename PropagationOutputSink< StateScalarType, TimeType >::StateView;
+    using typename PropagationOutputSink< StateScalarType, TimeType >::DependentVariableView;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param stepFunction Function that is called for each saved step, with time, state and dependent variables as input.
+     *  \param finalizationFunction Function that is called at the end of each propagation (none by default).
+     */
+    CallbackOutputSink(
+            const std::function< void( const TimeType&, const StateView&, const DependentVariableView& ) > stepFunction,
+            const std::function< void( ) > finalizationFunction = std::function< void( ) >( ) ):
+        stepFunction_( stepFunction ), finalizationFunction_( finalizationFunction ){ }
+
+    //! Destructor
+    ~CallbackOutputSink( ){ }
+
+    //! Function to process a single saved step of the propagation, by calling the user-defined function.
+    /*!
+     *  Function to process a single saved step of the propagation, by calling the user-defined function.
+     *  \param time Time of the step.
+     *  \param state State at the step.
+     *  \param dependentVariables Dependent variables at the step (zero size if no dependent variables are saved).
+     */
+    void processStep( const TimeType& time, const StateView& state,
+                      const DependentVariableView& dependentVariables )
+    {
+        stepFunction_( time, state, dependentVariables );
+    }
+
+    //! Function that is called after the last step of each propagation, calls the user-defined function (if any).
+    void finalizePropagation( )
+    {
+        if( finalizationFunction_ != nullptr )
+        {
+            finalizationFunction_( );
+        }
+    }
+
+private:
+
+    //! Function that is called for each saved step.
+    std::function< void( const TimeType&, const StateView&, const DependentVariableView& ) > stepFunction_;
+
+    //! Function that is called at the end of each propagation.
+    std::function< void( ) > finalizationFunction_;
+};
+
+//! Propagation output sink passing each step to a list of other sinks.
+template< typename StateScalarType = double, typename TimeType = double >
+class MultipleOutputSinks: public PropagationOutputSink< StateScalarType, TimeType >
+{
+public:
+
+    using typename PropagationOutputSink< StateScalarType, TimeType >::StateView;
+    using typename PropagationOutputSink< StateScalarType, TimeType >::DependentVariableView;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param outputSinks List of sinks to which each step is passed.
+     */
+    MultipleOutputSinks(
+            const std::vector< std::shared_ptr< PropagationOutputSink< StateScalarType, TimeType > > >& outputSinks ):
+        outputSinks_( outputSinks ){ }
+
+    //! Destructor
+    ~MultipleOutputSinks( ){ }
+
+    //! Function that is called before the start of each propagation, initializes all sinks.
+    void initializePropagation( )
+    {
+        for( unsigned int i = 0; i < outputSinks_.size( ); i++ )
+        {
+            outputSinks_[ i ]->initializePropagation( );
+        }
+    }
+
+    //! Function to process a single saved step of the propagation, by passing it to all sinks.
+    /*!
+     *  Function to process a single saved step of the propagation, by passing it to all sinks.
+     *  \param time Time of the step.
+     *  \param state State at the step.
+     *  \param dependentVariables Dependent variables at the step (zero size if no dependent variables are saved).
+     */
+    void processStep( const TimeType& time, const StateView& state,
+                      const DependentVariableView& dependentVariables )
+    {
+        for( unsigned int i = 0; i < outputSinks_.size( ); i++ )
+        {
+            outputSinks_[ i ]->processStep( time, state, dependentVariables );
+        }
+    }
+
+    //! Function that is called after the last step of each propagation, finalizes all sinks.
+    void finalizePropagation( )
+    {
+        for( unsigned int i = 0; i < outputSinks_.size( ); i++ )
+        {
+            outputSinks_[ i ]->finalizePropagation( );
+        }
+    }
+
+private:
+
+    //! List of sinks to which each step is passed.
+    std::vector< std::shared_ptr< PropagationOutputSink< StateScalarType, TimeType > > > outputSinks_;
+};
+
+//! Propagation output sink converting the propagated state, before passing it to a list of other sinks.
+/*!
+ *  Propagation output sink converting the propagated state (e.g. from the propagator-specific form used in the numerical
+ *  integration to the conventional form), before passing it to a list of other sinks. The time is passed to the other
+ *  sinks as a double, so that the same sinks can be used for propagations with any time type.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class StateConversionOutputSink: public PropagationOutputSink< StateScalarType, TimeType >
+{
+public:
+
+    using typename PropagationOutputSink< StateScalarType, TimeType >::StateView;
+    using typename PropagationOutputSink< StateScalarType, TimeType >::DependentVariableView;
+
+    //! Typedef for vector-valued state.
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > StateVectorType;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param outputSinks List of sinks to which each step is passed, with converted state.
+     *  \param stateConversionFunction Function converting the propagated state, from (propagated) state and time.
+     */
+    StateConversionOutputSink(
+            const std::vector< std::shared_ptr< PropagationOutputSink< StateScalarType, double > > >& outputSinks,
+            const std::function< StateVectorType( const StateVectorType&, const TimeType& ) > stateConversionFunction ):
+        outputSinks_( outputSinks ), stateConversionFunction_( stateConversionFunction ){ }
+
+    //! Destructor
+    ~StateConversionOutputSink( ){ }
+
+    //! Function that is called before the start of each propagation, initializes all sinks.
+    void initializePropagation( )
+    {
+        for( unsigned int i = 0; i < outputSinks_.size( ); i++ )
+        {
+            outputSinks_[ i ]->initializePropagation( );
+        }
+    }
+
+    //! Function to process a single saved step of the propagation, by converting the state and passing it to all sinks.
+    /*!
+     *  Function to process a single saved step of the propagation, by converting the state and passing it to all sinks.
+     *  \param time Time of the step.
+     *  \param state State at the step.
+     *  \param dependentVariables Dependent variables at the step (zero size if no dependent variables are saved).
+     */
+    void processStep( const TimeType& time, const StateView& state,
+                      const DependentVariableView& dependentVariables )
+    {
+        propagatedState_ = state;
+        convertedState_ = stateConversionFunction_( propagatedState_, time );
+        for( unsigned int i = 0; i < outputSinks_.size( ); i++ )
+        {
+            outputSinks_[ i ]->processStep(
+                        static_cast< double >( time ),
+                        StateView( convertedState_.data( ), convertedState_.rows( ), 1 ), dependentVariables );
+        }
+    }
+
+    //! Function that is called after the last step of each propagation, finalizes all sinks.
+    void finalizePropagation( )
+    {
+        for( unsigned int i = 0; i < outputSinks_.size( ); i++ )
+        {
+            outputSinks_[ i ]->finalizePropagation( );
+        }
+    }
+
+private:
+
+    //! List of sinks to which each step is passed, with converted state.
+    std::vector< std::shared_ptr< PropagationOutputSink< StateScalarType, double > > > outputSinks_;
+
+    //! Function converting the propagated state, from (propagated) state and time.
+    std::function< StateVectorType( const StateVectorType&, const TimeType& ) > stateConversionFunction_;
+
+    //! Pre-allocated propagated state, used as input to stateConversionFunction_.
+    StateVectorType propagatedState_;
+
+    //! Converted state at the current step.
+    StateVectorType convertedState_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONOUTPUTSINK_H
@@ -7,10 +7,9 @@
  *    a copy of the license with this file. If not, please or visit:
  *    http://tudat.tudelft.nl/LICENSE.
  */
-#include <map>
-
-
+#include <algorithm>
 #include <functional>
+#include <map>
 
 #include <Eigen/Core>
 
@@ -26,23 +25,103 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to compute the product of a single block of rows of the variational matrix with the state transition matrix
+/*!
+ *  Function to compute the product of a single block of rows of the variational matrix with the state transition matrix,
+ *  using only the non-zero column ranges of the block of rows.
+ *  \param variationalMatrix Full variational matrix
+ *  \param rowBlock Sparsity structure of the block of rows for which the product is to be computed
+ *  \param stateTransitionAndSensitivityMatrices Current combined state transition and sensitivity matrix
+ *  \param currentMatrixDerivative Matrix block to which the product is to be set (returned by reference).
+ */
+template< int NumberOfRows, typename StateScalarType >
+void computeVariationalMatrixRowBlockProduct(
+        const Eigen::MatrixXd& variationalMatrix,
+        const VariationalMatrixRowBlock& rowBlock,
+        const Eigen::Ref< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >&
+        stateTransitionAndSensitivityMatrices,
+        Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >& currentMatrixDerivative )
+{
+    const int numberOfColumns = stateTransitionAndSensitivityMatrices.cols( );
+    for( unsigned int i = 0; i < rowBlock.nonZeroColumnRanges_.size( ); i++ )
+    {
+        const int startColumn = rowBlock.nonZeroColumnRanges_[ i ].first;
+        const int rangeSize = rowBlock.nonZeroColumnRanges_[ i ].second;
+        if( i == 0 )
+        {
+            currentMatrixDerivative.template block< NumberOfRows, Eigen::Dynamic >(
+                        rowBlock.startRow_, 0, rowBlock.numberOfRows_, numberOfColumns ).noalias( ) =
+                    variationalMatrix.template block< NumberOfRows, Eigen::Dynamic >(
+                        rowBlock.startRow_, startColumn, rowBlock.numberOfRows_, rangeSize ).template
+                    cast< StateScalarType >( ) *
+                    stateTransitionAndSensitivityMatrices.block( startColumn, 0, rangeSize, numberOfColumns );
+        }
+        else
+        {
+            currentMatrixDerivative.template block< NumberOfRows, Eigen::Dynamic >(
+                        rowBlock.startRow_, 0, rowBlock.numberOfRows_, numberOfColumns ).noalias( ) +=
+                    variationalMatrix.template block< NumberOfRows, Eigen::Dynamic >(
+                        rowBlock.startRow_, startColumn, rowBlock.numberOfRows_, rangeSize ).template
+                    cast< StateScalarType >( ) *
+                    stateTransitionAndSensitivityMatrices.block( startColumn, 0, rangeSize, numberOfColumns );
+        }
+    }
+}
+
 template< typename StateScalarType >
 void VariationalEquations::getBodyInitialStatePartialMatrix(
-        const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& stateTransitionAndSensitivityMatrices,
+        const Eigen::Ref< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >&
+        stateTransitionAndSensitivityMatrices,
         Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative )
 {
     setBodyStatePartialMatrix( );
 
-    // Add partials of body positions and velocities.
-    currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, numberOfParameterValues_ ) =
-            ( variationalMatrix_.template cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices );
+    // Add partials of body positions and velocities, per block of rows of the variational matrix.
+    for( unsigned int i = 0; i < variationalMatrixRowBlocks_.size( ); i++ )
+    {
+        const VariationalMatrixRowBlock& currentRowBlock = variationalMatrixRowBlocks_[ i ];
+        if( currentRowBlock.identitySourceRow_ >= 0 )
+        {
+            currentMatrixDerivative.block( currentRowBlock.startRow_, 0, currentRowBlock.numberOfRows_,
+                                           numberOfParameterValues_ ) =
+                    stateTransitionAndSensitivityMatrices.block(
+                        currentRowBlock.identitySourceRow_, 0, currentRowBlock.numberOfRows_, numberOfParameterValues_ );
+        }
+        else if( currentRowBlock.nonZeroColumnRanges_.size( ) == 0 )
+        {
+            currentMatrixDerivative.block( currentRowBlock.startRow_, 0, currentRowBlock.numberOfRows_,
+                                           numberOfParameterValues_ ).setZero( );
+        }
+        else if( currentRowBlock.numberOfRows_ == 3 )
+        {
+            computeVariationalMatrixRowBlockProduct< 3, StateScalarType >(
+                        variationalMatrix_, currentRowBlock, stateTransitionAndSensitivityMatrices, currentMatrixDerivative );
+        }
+        else
+        {
+            computeVariationalMatrixRowBlockProduct< Eigen::Dynamic, StateScalarType >(
+                        variationalMatrix_, currentRowBlock, stateTransitionAndSensitivityMatrices, currentMatrixDerivative );
+        }
+    }
 }
 
 //! Calculates matrix containing partial derivatives of state derivatives w.r.t. body state.
 void VariationalEquations::setBodyStatePartialMatrix( )
 {
-    // Initialize partial matrix
-    variationalMatrix_.setZero( );
+    // Initialize (non-zero blocks of) partial matrix
+    for( unsigned int i = 0; i < variationalMatrixRowBlocks_.size( ); i++ )
+    {
+        if( variationalMatrixRowBlocks_[ i ].identitySourceRow_ < 0 )
+        {
+            for( unsigned int j = 0; j < variationalMatrixRowBlocks_[ i ].nonZeroColumnRanges_.size( ); j++ )
+            {
+                variationalMatrix_.block( variationalMatrixRowBlocks_[ i ].startRow_,
+                                          variationalMatrixRowBlocks_[ i ].nonZeroColumnRanges_[ j ].first,
+                                          variationalMatrixRowBlocks_[ i ].numberOfRows_,
+                                          variationalMatrixRowBlocks_[ i ].nonZeroColumnRanges_[ j ].second ).setZero( );
+            }
+        }
+    }
 
     if( dynamicalStatesToEstimate_.count( propagators::translational_state ) > 0 )
     {
@@ -68,29 +147,14 @@ void VariationalEquations::setBodyStatePartialMatrix( )
         }
     }
 
-    // Iterate over all bodies undergoing accelerations for which initial condition is to be estimated.
-    for( std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
-         std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >::iterator
-         typeIterator = statePartialList_.begin( ); typeIterator != statePartialList_.end( ); typeIterator++ )
+    // Evaluate all partials w.r.t. current states of bodies for which initial condition is to be estimated.
+    for( unsigned int i = 0; i < statePartialFunctions_.size( ); i++ )
     {
-        int startIndex = stateTypeStartIndices_.at( typeIterator->first );
-        int currentStateSize = getSingleIntegrationSize( typeIterator->first );
-        int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator->first );
-
-        for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
-        {
-            // Iterate over all bodies exerting an acceleration on this body.
-            for( statePartialIterator_ = typeIterator->second.at( i ).begin( );
-                 statePartialIterator_ != typeIterator->second.at( i ).end( );
-                 statePartialIterator_++ )
-            {
-                statePartialIterator_->second(
-                            variationalMatrix_.block(
-                                startIndex + entriesToSkipPerEntry + i* currentStateSize, statePartialIterator_->first.first,
-                                currentStateSize - entriesToSkipPerEntry, statePartialIterator_->first.second ) );
-
-            }
-        }
+        statePartialFunctions_[ i ].blockFunction_(
+                    variationalMatrix_.block( statePartialFunctions_[ i ].startRow_,
+                                              statePartialFunctions_[ i ].startColumn_,
+                                              statePartialFunctions_[ i ].numberOfRows_,
+                                              statePartialFunctions_[ i ].numberOfColumns_ ) );
     }
 
    for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
@@ -139,9 +203,14 @@ void VariationalEquations::setStatePartialFunctionList( )
          stateDerivativeTypeIterator_ != stateDerivativePartialList_.end( );
          stateDerivativeTypeIterator_++ )
     {
+        int startIndex = stateTypeStartIndices_.at( stateDerivativeTypeIterator_->first );
+        int currentStateSize = getSingleIntegrationSize( stateDerivativeTypeIterator_->first );
+        int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( stateDerivativeTypeIterator_->first );
+
         // Iterate over all bodies undergoing 'accelerations' for which initial state is to be estimated.
         for( unsigned int i = 0; i < stateDerivativeTypeIterator_->second.size( ); i++ )
         {
+            // Partials w.r.t. same state are ordered by column, as in multimap used previously.
             std::multimap< std::pair< int, int >, std::function< void( Eigen::Block< Eigen::MatrixXd > ) > >
                     currentBodyPartialList;
 
@@ -174,19 +243,143 @@ void VariationalEquations::setStatePartialFunctionList( )
                     }
                 }
             }
-            statePartialList_[ stateDerivativeTypeIterator_->first ].push_back( currentBodyPartialList );
+
+            // Add partials of current body to list, with location in variational matrix
+            for( auto partialIterator = currentBodyPartialList.begin( ); partialIterator != currentBodyPartialList.end( );
+                 partialIterator++ )
+            {
+                statePartialFunctions_.push_back(
+                            VariationalMatrixBlockFunction(
+                                startIndex + entriesToSkipPerEntry + i * currentStateSize, partialIterator->first.first,
+                                currentStateSize - entriesToSkipPerEntry, partialIterator->first.second,
+                                partialIterator->second ) );
+            }
         }
     }
 }
 
+//! Function (called by constructor) to determine the sparsity structure of the variational matrix
+void VariationalEquations::setVariationalMatrixStructure( )
+{
+    variationalMatrixRowBlocks_.clear( );
+
+    // Non-zero columns of each block of rows, and start row of identity block in each row block (-1 if none)
+    std::vector< std::vector< bool > > nonZeroColumns;
+    std::vector< int > identityStartColumns;
+    std::map< int, int > rowBlockIndices;
+
+    // Define blocks of rows: for each body, the rows that are/are not set by the partial functions.
+    for( std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap >::iterator
+         typeIterator = stateDerivativePartialList_.begin( ); typeIterator != stateDerivativePartialList_.end( );
+         typeIterator++ )
+    {
+        int startIndex = stateTypeStartIndices_.at( typeIterator->first );
+        int currentStateSize = getSingleIntegrationSize( typeIterator->first );
+        int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator->first );
+
+        for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
+        {
+            int currentBodyStartIndex = startIndex + i * currentStateSize;
+            if( entriesToSkipPerEntry > 0 )
+            {
+                VariationalMatrixRowBlock currentRowBlock;
+                currentRowBlock.startRow_ = currentBodyStartIndex;
+                currentRowBlock.numberOfRows_ = entriesToSkipPerEntry;
+                currentRowBlock.identitySourceRow_ = -1;
+                variationalMatrixRowBlocks_.push_back( currentRowBlock );
+                nonZeroColumns.push_back( std::vector< bool >( totalDynamicalStateSize_, false ) );
+                identityStartColumns.push_back( -1 );
+
+                // Velocity block of translational state, set to identity
+                if( typeIterator->first == propagators::translational_state )
+                {
+                    identityStartColumns.back( ) = currentBodyStartIndex + 3;
+                    std::fill( nonZeroColumns.back( ).begin( ) + currentBodyStartIndex + 3,
+                               nonZeroColumns.back( ).begin( ) + currentBodyStartIndex + 6, true );
+                }
+                // Quaternion and angular velocity blocks of rotational state
+                else if( typeIterator->first == propagators::rotational_state )
+                {
+                    std::fill( nonZeroColumns.back( ).begin( ) + currentBodyStartIndex,
+                               nonZeroColumns.back( ).begin( ) + currentBodyStartIndex + 7, true );
+                }
+            }
+
+            VariationalMatrixRowBlock currentRowBlock;
+            currentRowBlock.startRow_ = currentBodyStartIndex + entriesToSkipPerEntry;
+            currentRowBlock.numberOfRows_ = currentStateSize - entriesToSkipPerEntry;
+            currentRowBlock.identitySourceRow_ = -1;
+            rowBlockIndices[ currentRowBlock.startRow_ ] = variationalMatrixRowBlocks_.size( );
+            variationalMatrixRowBlocks_.push_back( currentRowBlock );
+            nonZeroColumns.push_back( std::vector< bool >( totalDynamicalStateSize_, false ) );
+            identityStartColumns.push_back( -1 );
+        }
+    }
+
+    // Set columns that are set by partial functions
+    for( unsigned int i = 0; i < statePartialFunctions_.size( ); i++ )
+    {
+        std::vector< bool >& currentNonZeroColumns =
+                nonZeroColumns.at( rowBlockIndices.at( statePartialFunctions_[ i ].startRow_ ) );
+        std::fill( currentNonZeroColumns.begin( ) + statePartialFunctions_[ i ].startColumn_,
+                   currentNonZeroColumns.begin( ) + statePartialFunctions_[ i ].startColumn_ +
+                   statePartialFunctions_[ i ].numberOfColumns_, true );
+    }
+
+    // Set columns that are set by adding column blocks (for hierarchical dynamics), in the order in which they are added.
+    for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < nonZeroColumns.size( ); j++ )
+        {
+            if( std::find( nonZeroColumns.at( j ).begin( ) + statePartialAdditionIndices_.at( i ).first,
+                           nonZeroColumns.at( j ).begin( ) + statePartialAdditionIndices_.at( i ).first + 3, true ) !=
+                    nonZeroColumns.at( j ).begin( ) + statePartialAdditionIndices_.at( i ).first + 3 )
+            {
+                std::fill( nonZeroColumns.at( j ).begin( ) + statePartialAdditionIndices_.at( i ).second,
+                           nonZeroColumns.at( j ).begin( ) + statePartialAdditionIndices_.at( i ).second + 3, true );
+            }
+        }
+    }
+
+    // Set non-zero column ranges, and use identity block only if it is the only non-zero block in its rows.
+    for( unsigned int i = 0; i < variationalMatrixRowBlocks_.size( ); i++ )
+    {
+        const std::vector< bool >& currentNonZeroColumns = nonZeroColumns.at( i );
+        int currentColumn = 0;
+        while( currentColumn < totalDynamicalStateSize_ )
+        {
+            if( currentNonZeroColumns.at( currentColumn ) )
+            {
+                int rangeStartColumn = currentColumn;
+                while( currentColumn < totalDynamicalStateSize_ && currentNonZeroColumns.at( currentColumn ) )
+                {
+                    currentColumn++;
+                }
+                variationalMatrixRowBlocks_[ i ].nonZeroColumnRanges_.push_back(
+                            std::make_pair( rangeStartColumn, currentColumn - rangeStartColumn ) );
+            }
+            else
+            {
+                currentColumn++;
+            }
+        }
+
+        if( identityStartColumns.at( i ) >= 0 && variationalMatrixRowBlocks_[ i ].nonZeroColumnRanges_.size( ) == 1 &&
+                variationalMatrixRowBlocks_[ i ].nonZeroColumnRanges_.at( 0 ) ==
+                std::make_pair( identityStartColumns.at( i ), variationalMatrixRowBlocks_[ i ].numberOfRows_ ) )
+        {
+            variationalMatrixRowBlocks_[ i ].identitySourceRow_ = identityStartColumns.at( i );
+        }
+    }
+}
 
 template void VariationalEquations::getBodyInitialStatePartialMatrix< double >(
-        const Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic >& stateTransitionAndSensitivityMatrices,
+        const Eigen::Ref< const Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic > >& stateTransitionAndSensitivityMatrices,
         Eigen::Block< Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative );
 
 //#if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 template void VariationalEquations::getBodyInitialStatePartialMatrix< long double >(
-        const Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic >& stateTransitionAndSensitivityMatrices,
+        const Eigen::Ref< const Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > >& stateTransitionAndSensitivityMatrices,
         Eigen::Block< Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative );
 //#endif
 
@@ -32,6 +32,66 @@ namespace tudat
 namespace propagators
 {
 
+//! Function adding a partial derivative w.r.t. a current state to the variational matrix, with location of its block.
+struct VariationalMatrixBlockFunction
+{
+    //! Constructor
+    /*!
+     * Constructor
+     * \param startRow Start row of block in variational matrix
+     * \param startColumn Start column of block in variational matrix
+     * \param numberOfRows Number of rows of block in variational matrix
+     * \param numberOfColumns Number of columns of block in variational matrix
+     * \param blockFunction Function adding the partial derivative to the given block of the variational matrix
+     */
+    VariationalMatrixBlockFunction(
+            const int startRow, const int startColumn, const int numberOfRows, const int numberOfColumns,
+            const std::function< void( Eigen::Block< Eigen::MatrixXd > ) > blockFunction ):
+        startRow_( startRow ), startColumn_( startColumn ), numberOfRows_( numberOfRows ),
+        numberOfColumns_( numberOfColumns ), blockFunction_( blockFunction ){ }
+
+    //! Start row of block in variational matrix
+    int startRow_;
+
+    //! Start column of block in variational matrix
+    int startColumn_;
+
+    //! Number of rows of block in variational matrix
+    int numberOfRows_;
+
+    //! Number of columns of block in variational matrix
+    int numberOfColumns_;
+
+    //! Function adding the partial derivative to the given block of the variational matrix
+    std::function< void( Eigen::Block< Eigen::MatrixXd > ) > blockFunction_;
+};
+
+//! Sparsity structure of a block of rows of the variational matrix (e.g. velocity or acceleration rows of a single body)
+/*!
+ *  Sparsity structure of a block of rows of the variational matrix (e.g. velocity or acceleration rows of a single body),
+ *  which is used to compute the product of the variational matrix and the state transition matrix by skipping the zero
+ *  blocks, and by copying rows of the state transition matrix for the identity blocks.
+ */
+struct VariationalMatrixRowBlock
+{
+    //! Start row of the block of rows
+    int startRow_;
+
+    //! Number of rows in the block of rows
+    int numberOfRows_;
+
+    //! Row of the state transition matrix that is to be copied for this row block (-1 if not an identity block).
+    /*!
+     *  Start row of the state transition matrix that is to be copied for this row block, if the only non-zero block in
+     *  these rows is an identity matrix (e.g. the velocity block of the translational state derivative). Equal to -1
+     *  otherwise.
+     */
+    int identitySourceRow_;
+
+    //! List of non-zero ranges of columns in the block of rows (first: start column, second: number of columns)
+    std::vector< std::pair< int, int > > nonZeroColumnRanges_;
+};
+
 //! Class from which the variational equations can be evaluated.
 /*!
  *  Class from which the variational equations can be evaluated. The time derivative of the state transition  and
@@ -104,6 +164,7 @@ public:
         setTranslationalStatePartialFrameScalingFunctions( parametersToEstimate );
         setRotationalStatePartialScalingFunctions( parametersToEstimate );
         setParameterPartialFunctionList( parametersToEstimate );
+        setVariationalMatrixStructure( );
     }
 
     //! Calculates matrix containing partial derivatives of state derivatives w.r.t. body state.
@@ -117,14 +178,17 @@ public:
     //! Function to compute the contribution of the derivatives w.r.t. current states in the variational equations
     /*!
      *  Function to compute the contribution of the derivatives w.r.t. current states in the variational equations,
-     *  e.g. first term in Eq. (7.45) in (Montenbruck & Gill, 2000).
+     *  e.g. first term in Eq. (7.45) in (Montenbruck & Gill, 2000). The product of the variational matrix with the
+     *  state transition and sensitivity matrices is computed per block of rows (see VariationalMatrixRowBlock), skipping
+     *  the zero blocks of the variational matrix, and copying the rows for the identity blocks.
      *  \param stateTransitionAndSensitivityMatrices Current combined state transition and sensitivity matric
      *  \param currentMatrixDerivative Matrix block which is to return (by reference) the given contribution to the
      *  variational equations.
      */
     template< typename StateScalarType >
     void getBodyInitialStatePartialMatrix(
-            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& stateTransitionAndSensitivityMatrices,
+            const Eigen::Ref< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >&
+            stateTransitionAndSensitivityMatrices,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative );
 
     //! Calculates matrix containing partial derivatives of state derivatives w.r.t. parameters.
@@ -197,7 +261,7 @@ public:
      */
     template< typename StateScalarType >
     void evaluateVariationalEquations(
-            const double time, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >&
+            const double time, const Eigen::Ref< const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >&
             stateTransitionAndSensitivityMatrices,
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative )
     {
@@ -280,18 +344,36 @@ public:
     {
         return numberOfParameterValues_;
     }
-    
+
+    //! Function to retrieve the current matrix of partial derivatives of state derivatives w.r.t. body state.
+    /*!
+     *  Function to retrieve the current matrix of partial derivatives of state derivatives w.r.t. body state, as last
+     *  computed by setBodyStatePartialMatrix.
+     *  \return Matrix containing partial derivatives of state derivative w.r.t. body state
+     */
+    const Eigen::MatrixXd& getVariationalMatrix( )
+    {
+        return variationalMatrix_;
+    }
+
 protected:
     
 private:
     
-    //! Function (called by constructor) to set up the statePartialList_ member from the state derivative partials
+    //! Function (called by constructor) to set up the statePartialFunctions_ member from the state derivative partials
     /*!
      * Function (called by constructor) to set up the functions to evaluate the partial derivatives of the state derivatives
-     * w.r.t. a current state (stored in the statePartialList_ member) from the state derivative partials.
+     * w.r.t. a current state (stored in the statePartialFunctions_ member) from the state derivative partials.
      */
     void setStatePartialFunctionList( );
 
+    //! Function (called by constructor) to determine the sparsity structure of the variational matrix
+    /*!
+     * Function (called by constructor) to determine the sparsity structure of the variational matrix (stored in the
+     * variationalMatrixRowBlocks_ member), from the blocks that are set by setBodyStatePartialMatrix.
+     */
+    void setVariationalMatrixStructure( );
+
     //! Function to add parameter partial functions for single state derivative model, and set of parameter objects.
     /*!
      *  Function to add parameter partial functions for single state derivative model, and set of parameter objects.
@@ -517,20 +599,16 @@ private:
     //! Map of start entry in sensitivity matrix of each type of estimated dynamics.
     std::map< IntegratedStateType, int > stateTypeStartIndices_;
     
-    //! List of all functions returning current partial derivative w.r.t. a current dynamical state
+    //! List of all functions adding current partial derivative w.r.t. a current dynamical state to the variational matrix
     /*!
-     *  List of all functions returning current partial derivative w.r.t. a current dynamical state (map key). The
-     *  vector entries correspond to the entries in the outer vector of StateDerivativePartialsMaps in
-     *  stateDerivativePartialList_. The multimaps inside the vector provide the functions (as values) adding the
-     *  partials to a given matrix block and the start column and number of columns in matrix partial (as keys).
+     *  List of all functions adding current partial derivative w.r.t. a current dynamical state to the variational
+     *  matrix, with the location of the block in the variational matrix to which they are to be added, in the order in
+     *  which they are to be evaluated.
      */
-    std::map< IntegratedStateType,
-    std::vector< std::multimap< std::pair< int, int >, std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >
-    statePartialList_;
-    
-    //! Pre-defined iterator for efficiency.
-    std::multimap< std::pair< int, int >, std::function< void( Eigen::Block< Eigen::MatrixXd > ) > >::iterator
-    statePartialIterator_;
+    std::vector< VariationalMatrixBlockFunction > statePartialFunctions_;
+
+    //! Sparsity structure of the variational matrix, per block of rows (see VariationalMatrixRowBlock)
+    std::vector< VariationalMatrixRowBlock > variationalMatrixRowBlocks_;
     
     //! Vector of pair providing indices of column blocks of variational equations to add to other column blocks
     /*!
@@ -585,12 +663,12 @@ private:
 };
 
 extern template void VariationalEquations::getBodyInitialStatePartialMatrix< double >(
-        const Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic >& stateTransitionAndSensitivityMatrices,
+        const Eigen::Ref< const Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic > >& stateTransitionAndSensitivityMatrices,
         Eigen::Block< Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative );
 
 //#if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 extern template void VariationalEquations::getBodyInitialStatePartialMatrix< long double >(
-        const Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic >& stateTransitionAndSensitivityMatrices,
+        const Eigen::Ref< const Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > >& stateTransitionAndSensitivityMatrices,
         Eigen::Block< Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative );
 //#endif
 
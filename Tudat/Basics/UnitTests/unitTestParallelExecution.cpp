@@ -0,0 +1,181 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_parallel_execution )
+
+//! Test whether results of parallel execution are independent of number of threads
+BOOST_AUTO_TEST_CASE( testParallelExecutionDeterminism )
+{
+    const int numberOfTasks = 1000;
+
+    // Compute results for various number of threads, writing output to rows of matrix
+    std::vector< unsigned int > numberOfThreads = { 1, 2, 3, 8, 2000 };
+    std::vector< Eigen::MatrixXd > results;
+    for( unsigned int i = 0; i < numberOfThreads.size( ); i++ )
+    {
+        Eigen::MatrixXd currentResults = Eigen::MatrixXd::Zero( numberOfTasks, 3 );
+        std::vector< int > numberOfCalls( numberOfTasks, 0 );
+        utilities::executeParallelTasks(
+                    numberOfTasks, [ & ]( const int taskIndex )
+        {
+            double sum = 0.0;
+            for( int j = 0; j <= taskIndex; j++ )
+            {
+                sum += std::sin( static_cast< double >( j ) );
+            }
+            currentResults.row( taskIndex ) << static_cast< double >( taskIndex ), sum, std::sqrt( sum * sum );
+            numberOfCalls[ taskIndex ]++;
+        }, numberOfThreads.at( i ) );
+        results.push_back( currentResults );
+
+        // Check that each task is executed exactly once
+        for( int j = 0; j < numberOfTasks; j++ )
+        {
+            BOOST_CHECK_EQUAL( numberOfCalls.at( j ), 1 );
+        }
+    }
+
+    for( unsigned int i = 1; i < results.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( ( results.at( i ) - results.at( 0 ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    }
+
+    // Check that no tasks does not lead to errors
+    utilities::executeParallelTasks( 0, [ & ]( const int ){ throw std::runtime_error( "Error" ); }, 4 );
+
+    BOOST_CHECK( utilities::getNumberOfAvailableThreads( ) >= 1 );
+}
+
+//! Test whether exceptions in tasks are propagated deterministically
+BOOST_AUTO_TEST_CASE( testParallelExecutionExceptions )
+{
+    for( unsigned int numberOfThreads = 1; numberOfThreads < 5; numberOfThreads++ )
+    {
+        std::vector< int > numberOfCalls( 100, 0 );
+        std::string errorMessage;
+        try
+        {
+            utilities::executeParallelTasks(
+                        100, [ & ]( const int taskIndex )
+            {
+                numberOfCalls[ taskIndex ]++;
+                if( taskIndex % 10 == 7 )
+                {
+                    throw std::runtime_error( "Error in task " + std::to_string( taskIndex ) );
+                }
+            }, numberOfThreads );
+        }
+        catch( const std::runtime_error& caughtError )
+        {
+            errorMessage = caughtError.what( );
+        }
+
+        // Check that error of first failed task is rethrown
+        BOOST_CHECK_EQUAL( errorMessage, "Error in task 7" );
+
+        // When using multiple threads, all tasks are executed; when executing sequentially, execution stops at error
+        int numberOfExecutedTasks = 0;
+        for( unsigned int i = 0; i < numberOfCalls.size( ); i++ )
+        {
+            numberOfExecutedTasks += numberOfCalls.at( i );
+        }
+        BOOST_CHECK_EQUAL( numberOfExecutedTasks, ( numberOfThreads == 1 ) ? 8 : 100 );
+    }
+}
+
+//! Test whether thread indices are provided correctly
+BOOST_AUTO_TEST_CASE( testParallelExecutionThreadIndices )
+{
+    for( unsigned int numberOfThreads = 1; numberOfThreads < 5; numberOfThreads++ )
+    {
+        // Count number of tasks per thread index, using per-thread counter that is not protected by lock.
+        std::vector< int > numberOfTasksPerThread( numberOfThreads, 0 );
+        std::vector< unsigned int > threadIndices( 200, numberOfThreads );
+        utilities::executeParallelTasksWithThreadIndex(
+                    200, [ & ]( const int taskIndex, const unsigned int threadIndex )
+        {
+            threadIndices[ taskIndex ] = threadIndex;
+            numberOfTasksPerThread[ threadIndex ]++;
+        }, numberOfThreads );
+
+        int totalNumberOfTasks = 0;
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            totalNumberOfTasks += numberOfTasksPerThread.at( i );
+        }
+        BOOST_CHECK_EQUAL( totalNumberOfTasks, 200 );
+
+        for( unsigned int i = 0; i < threadIndices.size( ); i++ )
+        {
+            BOOST_CHECK( threadIndices.at( i ) < numberOfThreads );
+        }
+    }
+}
+
+//! Test whether a single Lagrange interpolator (with hunting algorithm) can be used concurrently
+BOOST_AUTO_TEST_CASE( testConcurrentInterpolation )
+{
+    std::map< double, Eigen::Vector3d > dataMap;
+    for( int i = 0; i < 200; i++ )
+    {
+        const double time = 10.0 * static_cast< double >( i );
+        dataMap[ time ] = ( Eigen::Vector3d( ) << std::sin( time / 300.0 ), std::cos( time / 500.0 ), time ).finished( );
+    }
+    interpolators::LagrangeInterpolator< double, Eigen::Vector3d > interpolator(
+                dataMap, 8, interpolators::huntingAlgorithm );
+
+    const int numberOfTasks = 64;
+    const int evaluationsPerTask = 500;
+
+    std::vector< Eigen::Matrix3Xd > results;
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads *= 4 )
+    {
+        Eigen::Matrix3Xd currentResults = Eigen::Matrix3Xd::Zero( 3, numberOfTasks * evaluationsPerTask );
+        utilities::executeParallelTasks(
+                    numberOfTasks, [ & ]( const int taskIndex )
+        {
+            // Evaluate interpolator at times spread over full interval, in different order for each task
+            for( int j = 0; j < evaluationsPerTask; j++ )
+            {
+                const double evaluationTime = std::fmod(
+                            50.0 + 3.7 * static_cast< double >( j ) * static_cast< double >( taskIndex + 1 ), 1900.0 );
+                currentResults.col( taskIndex * evaluationsPerTask + j ) = interpolator.interpolate( evaluationTime );
+            }
+        }, numberOfThreads );
+        results.push_back( currentResults );
+    }
+
+    BOOST_CHECK_EQUAL( ( results.at( 1 ) - results.at( 0 ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
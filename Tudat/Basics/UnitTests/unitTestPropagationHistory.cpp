@@ -0,0 +1,158 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/propagationHistory.h"
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Basics/timeType.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_propagation_history )
+
+//! Test whether contiguous history reproduces the map that would be generated from the same entries
+BOOST_AUTO_TEST_CASE( testPropagationHistoryMapCompatibility )
+{
+    // Fill history and reference map with same (vector-valued) data
+    PropagationHistory< double, double > history;
+    std::map< double, Eigen::VectorXd > referenceMap;
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        double currentTime = 10.0 * static_cast< double >( i );
+        Eigen::VectorXd currentState = Eigen::VectorXd::Random( 7 );
+        history.append( currentTime, currentState );
+        referenceMap[ currentTime ] = currentState;
+    }
+
+    BOOST_CHECK_EQUAL( history.size( ), 100 );
+    BOOST_CHECK_EQUAL( history.getNumberOfRows( ), 7 );
+    BOOST_CHECK_EQUAL( history.getNumberOfColumns( ), 1 );
+
+    // Check map view, direct entry access and block view
+    std::map< double, Eigen::VectorXd > historyMap = history.getMap< Eigen::VectorXd >( );
+    BOOST_CHECK_EQUAL( historyMap.size( ), referenceMap.size( ) );
+
+    unsigned int counter = 0;
+    for( std::map< double, Eigen::VectorXd >::const_iterator mapIterator = referenceMap.begin( );
+         mapIterator != referenceMap.end( ); mapIterator++ )
+    {
+        BOOST_CHECK_EQUAL( history.getTime( counter ), mapIterator->first );
+        for( int j = 0; j < 7; j++ )
+        {
+            BOOST_CHECK_EQUAL( historyMap.at( mapIterator->first )( j ), mapIterator->second( j ) );
+            BOOST_CHECK_EQUAL( history.getState( counter )( j ), mapIterator->second( j ) );
+            BOOST_CHECK_EQUAL( history.getStateBlock( )( j, counter ), mapIterator->second( j ) );
+        }
+        counter++;
+    }
+
+    // Check sub-block retrieval
+    std::map< double, Eigen::Vector3d > subMap = history.getMap< Eigen::Vector3d >( 2, 3 );
+    for( std::map< double, Eigen::VectorXd >::const_iterator mapIterator = referenceMap.begin( );
+         mapIterator != referenceMap.end( ); mapIterator++ )
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( subMap.at( mapIterator->first ), mapIterator->second.segment( 2, 3 ),
+                                           std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Check that inconsistent entries are rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        history.append( 1.0E4, Eigen::VectorXd::Zero( 6 ) );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test replacement/removal of last entries, matrix-valued and scalar entries, and reversed histories
+BOOST_AUTO_TEST_CASE( testPropagationHistoryModification )
+{
+    // Create backwards history of matrix-valued entries
+    PropagationHistory< Time, double > history;
+    for( int i = 0; i < 10; i++ )
+    {
+        history.append( Time( -i, 0.0L ), Eigen::Matrix< double, 3, 2 >::Constant( static_cast< double >( i ) ) );
+    }
+
+    // Overwrite last entry, and remove one before
+    history.insertAtEnd( Time( -9, 0.0L ), Eigen::Matrix< double, 3, 2 >::Constant( 20.0 ) );
+    BOOST_CHECK_EQUAL( history.size( ), 10 );
+    BOOST_CHECK_EQUAL( history.getLastState( )( 2, 1 ), 20.0 );
+
+    history.removeLastEntry( );
+    BOOST_CHECK_EQUAL( history.size( ), 9 );
+    BOOST_CHECK_EQUAL( history.getLastTime( ) == Time( -8, 0.0L ), true );
+    BOOST_CHECK_EQUAL( history.getLastState( )( 1, 0 ), 8.0 );
+
+    // Check map (sorted in increasing time)
+    std::map< Time, Eigen::MatrixXd > historyMap = history.getMap< Eigen::MatrixXd >( );
+    BOOST_CHECK_EQUAL( historyMap.size( ), 9 );
+    BOOST_CHECK_EQUAL( historyMap.begin( )->second( 0, 0 ), 8.0 );
+    BOOST_CHECK_EQUAL( historyMap.rbegin( )->second( 0, 0 ), 0.0 );
+
+    // Remove first entries
+    history.removeFirstEntries( 7 );
+    BOOST_CHECK_EQUAL( history.size( ), 2 );
+    BOOST_CHECK_EQUAL( history.getTime( 0 ) == Time( -7, 0.0L ), true );
+    BOOST_CHECK_EQUAL( history.getState( 0 )( 2, 1 ), 7.0 );
+    BOOST_CHECK_EQUAL( history.getLastState( )( 0, 0 ), 8.0 );
+    BOOST_CHECK_THROW( history.removeFirstEntries( 3 ), std::runtime_error );
+
+    // Check scalar history
+    PropagationHistory< double, double > scalarHistory;
+    scalarHistory.append( 0.0, 1.0 );
+    scalarHistory.insertAtEnd( 1.0, 2.0 );
+    scalarHistory.insertAtEnd( 1.0, 3.0 );
+    std::map< double, double > scalarMap = scalarHistory.getMap< double >( );
+    BOOST_CHECK_EQUAL( scalarMap.size( ), 2 );
+    BOOST_CHECK_EQUAL( scalarMap.at( 1.0 ), 3.0 );
+}
+
+//! Test retrieval of time-sorted vectors from backwards history
+BOOST_AUTO_TEST_CASE( testPropagationHistorySorting )
+{
+    PropagationHistory< double, long double > history;
+    for( int i = 0; i < 20; i++ )
+    {
+        Eigen::Matrix< long double, 8, 1 > currentState;
+        currentState.setConstant( static_cast< long double >( -i ) );
+        history.append( static_cast< double >( -i ), currentState );
+    }
+
+    std::vector< double > sortedTimes;
+    std::vector< Eigen::Matrix< long double, 6, 1 > > sortedStates;
+    history.getSortedTimesAndStates( 1, 6, sortedTimes, sortedStates );
+
+    BOOST_CHECK_EQUAL( sortedTimes.size( ), 20 );
+    for( unsigned int i = 0; i < sortedTimes.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( sortedTimes.at( i ), static_cast< double >( i ) - 19.0 );
+        BOOST_CHECK_EQUAL( sortedStates.at( i )( 5 ), static_cast< long double >( i ) - 19.0L );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,152 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_PARALLEL_EXECUTION_H
+#define TUDAT_PARALLEL_EXECUTION_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the number of threads that can run concurrently on the current machine.
+/*!
+ * Function to retrieve the number of threads that can run concurrently on the current machine, as reported by
+ * std::thread::hardware_concurrency. If this number cannot be determined, 1 is returned.
+ * \return Number of threads that can run concurrently on the current machine (at least 1).
+ */
+inline unsigned int getNumberOfAvailableThreads( )
+{
+    const unsigned int numberOfThreads = std::thread::hardware_concurrency( );
+    return ( numberOfThreads > 0 ) ? numberOfThreads : 1;
+}
+
+//! Function to execute a set of independent tasks, distributing them over a number of threads, providing thread index.
+/*!
+ * Function to execute a set of independent tasks, distributing them over a number of threads. This function is
+ * identical to executeParallelTasks, except that the taskFunction also receives the index of the thread that executes
+ * the task (from 0 to numberOfThreads - 1, where index 0 is the calling thread). All tasks with the same thread index
+ * are executed sequentially by the same thread, so that the thread index can be used to access objects that are to be
+ * reused between tasks but may not be accessed concurrently (for instance a per-thread copy of the environment). Which
+ * tasks are executed by which thread depends on the timing of the tasks, so that results should not depend on the
+ * history of such per-thread objects.
+ * \param numberOfTasks Number of tasks that are to be executed.
+ * \param taskFunction Function executing a single task, with task index and thread index as input.
+ * \param numberOfThreads Maximum number of threads that are to be used (including the calling thread).
+ */
+inline void executeParallelTasksWithThreadIndex(
+        const int numberOfTasks,
+        const std::function< void( const int, const unsigned int ) >& taskFunction,
+        const unsigned int numberOfThreads )
+{
+    if( numberOfTasks <= 0 )
+    {
+        return;
+    }
+
+    // Execute tasks sequentially, if required.
+    if( numberOfThreads <= 1 || numberOfTasks == 1 )
+    {
+        for( int i = 0; i < numberOfTasks; i++ )
+        {
+            taskFunction( i, 0 );
+        }
+        return;
+    }
+
+    std::atomic< int > nextTaskIndex( 0 );
+    std::vector< std::exception_ptr > taskExceptions( numberOfTasks );
+
+    // Define function executed by each thread: process tasks until none remain.
+    std::function< void( const unsigned int ) > threadFunction = [ & ]( const unsigned int threadIndex )
+    {
+        int currentTaskIndex;
+        while( ( currentTaskIndex = nextTaskIndex.fetch_add( 1 ) ) < numberOfTasks )
+        {
+            try
+            {
+                taskFunction( currentTaskIndex, threadIndex );
+            }
+            catch( ... )
+            {
+                taskExceptions[ currentTaskIndex ] = std::current_exception( );
+            }
+        }
+    };
+
+    // Start worker threads, and let calling thread participate in processing tasks.
+    const unsigned int numberOfUsedThreads = std::min( numberOfThreads, static_cast< unsigned int >( numberOfTasks ) );
+    std::vector< std::thread > workerThreads;
+    workerThreads.reserve( numberOfUsedThreads - 1 );
+    for( unsigned int i = 1; i < numberOfUsedThreads; i++ )
+    {
+        workerThreads.push_back( std::thread( threadFunction, i ) );
+    }
+    threadFunction( 0 );
+
+    for( unsigned int i = 0; i < workerThreads.size( ); i++ )
+    {
+        workerThreads.at( i ).join( );
+    }
+
+    // Rethrow exception of first failed task, if any.
+    for( int i = 0; i < numberOfTasks; i++ )
+    {
+        if( taskExceptions.at( i ) != nullptr )
+        {
+            std::rethrow_exception( taskExceptions.at( i ) );
+        }
+    }
+}
+
+//! Function to execute a set of independent tasks, distributing them over a number of threads.
+/*!
+ * Function to execute a set of independent tasks, distributing them over a number of threads. Each task is identified
+ * by its index (from 0 to numberOfTasks - 1), which is passed to the taskFunction. Tasks are distributed dynamically:
+ * each thread retrieves the next unprocessed task index when it has finished its previous task, so that tasks of
+ * unequal duration are balanced over the threads. The function returns when all tasks are finished. If the number of
+ * threads is 1 (or less), or there is only a single task, the tasks are executed sequentially in the calling thread,
+ * in order of increasing index.
+ *
+ * The taskFunction must be safe to call concurrently for different task indices. To obtain results that are
+ * independent of the number of threads, each task should write its output only to a location determined by its
+ * index (e.g. pre-allocated entries of a vector, or rows of a matrix), and not depend on the order in which tasks are
+ * executed.
+ *
+ * If one or more tasks throw an exception, the remaining tasks are still executed, after which the exception thrown by
+ * the task with the lowest index is rethrown, so that the error that is reported is independent of the number of
+ * threads.
+ * \param numberOfTasks Number of tasks that are to be executed.
+ * \param taskFunction Function executing a single task, with task index as input.
+ * \param numberOfThreads Maximum number of threads that are to be used (including the calling thread).
+ */
+inline void executeParallelTasks( const int numberOfTasks,
+                                  const std::function< void( const int ) >& taskFunction,
+                                  const unsigned int numberOfThreads )
+{
+    executeParallelTasksWithThreadIndex(
+                numberOfTasks, [ & ]( const int taskIndex, const unsigned int ){ taskFunction( taskIndex ); },
+                numberOfThreads );
+}
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLEL_EXECUTION_H
@@ -0,0 +1,437 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONHISTORY_H
+#define TUDAT_PROPAGATIONHISTORY_H
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+//! Class to store a time history of (matrix-valued) states in contiguous, column-wise storage.
+/*!
+ *  Class to store a time history of (matrix-valued) states in contiguous, column-wise storage. Contrary to a
+ *  std::map< TimeType, StateType >, which performs a separate heap allocation for each entry, this class stores all
+ *  times in a single vector, and all states in a single block of memory (one column of numberOfRows * numberOfColumns
+ *  entries per saved time, in the column-major order of Eigen). Entries are appended in the order in which they are
+ *  generated (i.e. in decreasing order of time for backwards propagation). The getMap function provides a
+ *  std::map view of the data for code that requires the history in that form.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+class PropagationHistory
+{
+public:
+
+    //! Typedef for (matrix-valued) state entry
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateMatrixType;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfRows Number of rows in each state entry. If 0 (default), the size is set when adding the first entry.
+     *  \param numberOfColumns Number of columns in each state entry. Ignored if numberOfRows is 0.
+     */
+    PropagationHistory( const int numberOfRows = 0, const int numberOfColumns = 1 ):
+        numberOfRows_( numberOfRows ), numberOfColumns_( ( numberOfRows > 0 ) ? numberOfColumns : 0 )
+    { }
+
+    //! Constructor from map of states
+    /*!
+     *  Constructor from map of states, entries are stored in increasing order of time.
+     *  \param stateMap Map of states (time as key) from which history is to be created.
+     */
+    template< typename StateType >
+    explicit PropagationHistory( const std::map< TimeType, StateType >& stateMap ):
+        numberOfRows_( 0 ), numberOfColumns_( 0 )
+    {
+        reserve( stateMap.size( ) );
+        for( typename std::map< TimeType, StateType >::const_iterator stateIterator = stateMap.begin( );
+             stateIterator != stateMap.end( ); stateIterator++ )
+        {
+            append( stateIterator->first, stateIterator->second );
+        }
+    }
+
+    //! Function to reserve memory for a given number of entries.
+    /*!
+     *  Function to reserve memory for a given number of entries. If the size of the state entries is not yet known,
+     *  only the memory for the times is reserved.
+     *  \param numberOfEntries Number of entries for which memory is to be reserved
+     */
+    void reserve( const unsigned int numberOfEntries )
+    {
+        times_.reserve( numberOfEntries );
+        if( numberOfRows_ > 0 )
+        {
+            stateData_.reserve( numberOfEntries * getEntrySize( ) );
+        }
+    }
+
+    //! Function to remove all entries.
+    /*!
+     *  Function to remove all entries, the allocated memory and size of the state entries are retained.
+     */
+    void clear( )
+    {
+        times_.clear( );
+        stateData_.clear( );
+    }
+
+    //! Function to add an entry at the end of the history.
+    /*!
+     *  Function to add an entry at the end of the history. The size of the first state that is added determines the size
+     *  of all entries, an exception is thrown if subsequent states are of different size.
+     *  \param time Time of entry
+     *  \param state State at given time
+     */
+    template< typename Derived >
+    void append( const TimeType& time, const Eigen::MatrixBase< Derived >& state )
+    {
+        checkEntrySize( state.rows( ), state.cols( ) );
+        times_.push_back( time );
+        for( int j = 0; j < state.cols( ); j++ )
+        {
+            for( int i = 0; i < state.rows( ); i++ )
+            {
+                stateData_.push_back( static_cast< StateScalarType >( state( i, j ) ) );
+            }
+        }
+    }
+
+    //! Function to add a scalar entry at the end of the history.
+    /*!
+     *  Function to add a scalar entry at the end of the history, requires the history to contain 1x1 entries.
+     *  \param time Time of entry
+     *  \param value Value at given time
+     */
+    void append( const TimeType& time, const StateScalarType value )
+    {
+        checkEntrySize( 1, 1 );
+        times_.push_back( time );
+        stateData_.push_back( value );
+    }
+
+    //! Function to add an entry at the end of the history, overwriting the last entry if it has the same time.
+    /*!
+     *  Function to add an entry at the end of the history, overwriting the last entry if it has the same time. For
+     *  a history that is generated in (increasing or decreasing) order of time, this is equivalent to setting a map entry
+     *  using the [ ] operator.
+     *  \param time Time of entry
+     *  \param state State at given time
+     */
+    template< typename StateType >
+    void insertAtEnd( const TimeType& time, const StateType& state )
+    {
+        if( times_.size( ) > 0 && times_.back( ) == time )
+        {
+            removeLastEntry( );
+        }
+        append( time, state );
+    }
+
+    //! Function to remove the last entry of the history.
+    void removeLastEntry( )
+    {
+        if( times_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when removing entry from propagation history, history is empty." );
+        }
+        times_.pop_back( );
+        stateData_.resize( stateData_.size( ) - getEntrySize( ) );
+    }
+
+    //! Function to remove the first entries of the history.
+    /*!
+     *  Function to remove the first entries of the history (i.e. the entries that were added first). The allocated
+     *  memory is retained, so that a history from which processed entries are regularly removed does not grow.
+     *  \param numberOfEntries Number of entries that are to be removed
+     */
+    void removeFirstEntries( const unsigned int numberOfEntries )
+    {
+        if( numberOfEntries > times_.size( ) )
+        {
+            throw std::runtime_error( "Error when removing " + std::to_string( numberOfEntries ) +
+                                      " entries from propagation history of size " + std::to_string( times_.size( ) ) );
+        }
+        times_.erase( times_.begin( ), times_.begin( ) + numberOfEntries );
+        stateData_.erase( stateData_.begin( ), stateData_.begin( ) + numberOfEntries * getEntrySize( ) );
+    }
+
+    //! Function to return the number of entries in the history.
+    /*!
+     *  Function to return the number of entries in the history.
+     *  \return Number of entries in the history.
+     */
+    unsigned int size( ) const
+    {
+        return times_.size( );
+    }
+
+    //! Function to check whether the history contains any entries.
+    /*!
+     *  Function to check whether the history contains any entries.
+     *  \return True if the history contains no entries.
+     */
+    bool empty( ) const
+    {
+        return times_.empty( );
+    }
+
+    //! Function to retrieve the time of a single entry.
+    /*!
+     *  Function to retrieve the time of a single entry.
+     *  \param index Index of entry (in order in which entries were added).
+     *  \return Time of requested entry.
+     */
+    const TimeType& getTime( const unsigned int index ) const
+    {
+        return times_.at( index );
+    }
+
+    //! Function to retrieve the time of the last entry that was added.
+    /*!
+     *  Function to retrieve the time of the last entry that was added.
+     *  \return Time of the last entry that was added.
+     */
+    const TimeType& getLastTime( ) const
+    {
+        return times_.back( );
+    }
+
+    //! Function to retrieve the times of all entries.
+    /*!
+     *  Function to retrieve the times of all entries.
+     *  \return Times of all entries, in order in which entries were added.
+     */
+    const std::vector< TimeType >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the state of a single entry.
+    /*!
+     *  Function to retrieve the state of a single entry, as a view on the internal storage (no copy is made).
+     *  The returned object is invalidated when new entries are added to the history.
+     *  \param index Index of entry (in order in which entries were added).
+     *  \return State of requested entry.
+     */
+    Eigen::Map< const StateMatrixType > getState( const unsigned int index ) const
+    {
+        if( index >= times_.size( ) )
+        {
+            throw std::runtime_error( "Error when retrieving entry " + std::to_string( index ) +
+                                      " from propagation history of size " + std::to_string( times_.size( ) ) );
+        }
+        return Eigen::Map< const StateMatrixType >(
+                    stateData_.data( ) + index * getEntrySize( ), numberOfRows_, numberOfColumns_ );
+    }
+
+    //! Function to retrieve the state of the last entry that was added.
+    /*!
+     *  Function to retrieve the state of the last entry that was added (see getState).
+     *  \return State of the last entry that was added.
+     */
+    Eigen::Map< const StateMatrixType > getLastState( ) const
+    {
+        return getState( times_.size( ) - 1 );
+    }
+
+    //! Function to retrieve all states as a single matrix.
+    /*!
+     *  Function to retrieve all states as a single matrix, as a view on the internal storage (no copy is made). Each column
+     *  of the returned matrix contains a single entry, with the columns of matrix-valued states stacked on top of each
+     *  other.
+     *  \return Matrix with all states, one column per entry.
+     */
+    Eigen::Map< const StateMatrixType > getStateBlock( ) const
+    {
+        return Eigen::Map< const StateMatrixType >( stateData_.data( ), getEntrySize( ), times_.size( ) );
+    }
+
+    //! Function to retrieve the raw contiguous state data.
+    /*!
+     *  Function to retrieve the raw contiguous state data.
+     *  \return Vector with all state entries, each stored in column-major order, in order in which entries were added.
+     */
+    const std::vector< StateScalarType >& getStateData( ) const
+    {
+        return stateData_;
+    }
+
+    //! Function to retrieve the number of rows of each state entry.
+    /*!
+     *  Function to retrieve the number of rows of each state entry.
+     *  \return Number of rows of each state entry (0 if not yet set).
+     */
+    int getNumberOfRows( ) const
+    {
+        return numberOfRows_;
+    }
+
+    //! Function to retrieve the number of columns of each state entry.
+    /*!
+     *  Function to retrieve the number of columns of each state entry.
+     *  \return Number of columns of each state entry (0 if not yet set).
+     */
+    int getNumberOfColumns( ) const
+    {
+        return numberOfColumns_;
+    }
+
+    //! Function to create a map of the history.
+    /*!
+     *  Function to create a map of the history, for use with code that requires the history as a std::map. Note that this
+     *  function copies the full history.
+     *  \tparam StateType Type of map values, either a scalar (for 1x1 entries) or an Eigen::Matrix.
+     *  \return Map of the history (time as key).
+     */
+    template< typename StateType >
+    std::map< TimeType, StateType > getMap( ) const
+    {
+        std::map< TimeType, StateType > historyMap;
+        for( unsigned int i = 0; i < times_.size( ); i++ )
+        {
+            getEntry( i, historyMap[ times_[ i ] ] );
+        }
+        return historyMap;
+    }
+
+    //! Function to create a map of a subset of the state rows of the history.
+    /*!
+     *  Function to create a map of a subset of the state rows of the history, for instance the Cartesian state of a single
+     *  body from the concatenated state of all propagated bodies. Only applicable for vector-valued entries.
+     *  \param startRow First row of the state entries that is to be retrieved
+     *  \param numberOfRows Number of rows of the state entries that are to be retrieved
+     *  \return Map of the requested state rows (time as key).
+     */
+    template< typename StateType >
+    std::map< TimeType, StateType > getMap( const int startRow, const int numberOfRows ) const
+    {
+        checkRowRange( startRow, numberOfRows );
+
+        std::map< TimeType, StateType > historyMap;
+        for( unsigned int i = 0; i < times_.size( ); i++ )
+        {
+            historyMap[ times_[ i ] ] = getState( i ).block( startRow, 0, numberOfRows, 1 ).template cast<
+                    typename StateType::Scalar >( );
+        }
+        return historyMap;
+    }
+
+    //! Function to retrieve the times and a subset of the state rows of the history, sorted in increasing order of time.
+    /*!
+     *  Function to retrieve the times and a subset of the state rows of the history, sorted in increasing order of time
+     *  (i.e. reversed if the history was generated by a backwards propagation). The output is in the form required by the
+     *  vector-based constructors of the interpolators.
+     *  \param startRow First row of the state entries that is to be retrieved
+     *  \param numberOfRows Number of rows of the state entries that are to be retrieved
+     *  \param sortedTimes Times of the history, in increasing order (returned by reference)
+     *  \param sortedStates Requested rows of the states, in increasing order of time (returned by reference)
+     */
+    template< typename StateType >
+    void getSortedTimesAndStates( const int startRow, const int numberOfRows,
+                                  std::vector< TimeType >& sortedTimes,
+                                  std::vector< StateType >& sortedStates ) const
+    {
+        checkRowRange( startRow, numberOfRows );
+
+        bool isHistoryReversed = ( times_.size( ) > 1 ) && ( times_.back( ) < times_.front( ) );
+
+        sortedTimes.resize( times_.size( ) );
+        sortedStates.resize( times_.size( ) );
+        for( unsigned int i = 0; i < times_.size( ); i++ )
+        {
+            unsigned int entryIndex = isHistoryReversed ? ( times_.size( ) - 1 - i ) : i;
+            sortedTimes[ i ] = times_[ entryIndex ];
+            sortedStates[ i ] = getState( entryIndex ).block( startRow, 0, numberOfRows, 1 ).template cast<
+                    typename StateType::Scalar >( );
+        }
+    }
+
+private:
+
+    //! Function to return the number of scalar entries in a single state.
+    unsigned int getEntrySize( ) const
+    {
+        return numberOfRows_ * numberOfColumns_;
+    }
+
+    //! Function to check (and, if not yet set, set) the size of the state entries.
+    void checkEntrySize( const int numberOfRows, const int numberOfColumns )
+    {
+        if( numberOfRows_ == 0 )
+        {
+            numberOfRows_ = numberOfRows;
+            numberOfColumns_ = numberOfColumns;
+            stateData_.reserve( times_.capacity( ) * getEntrySize( ) );
+        }
+        else if( numberOfRows != numberOfRows_ || numberOfColumns != numberOfColumns_ )
+        {
+            throw std::runtime_error(
+                        "Error when adding entry to propagation history, size of entry (" + std::to_string( numberOfRows ) +
+                        "x" + std::to_string( numberOfColumns ) + ") is inconsistent with existing entries (" +
+                        std::to_string( numberOfRows_ ) + "x" + std::to_string( numberOfColumns_ ) + ")." );
+        }
+    }
+
+    //! Function to check whether a requested subset of rows is consistent with the size of the state entries.
+    void checkRowRange( const int startRow, const int numberOfRows ) const
+    {
+        if( numberOfColumns_ > 1 )
+        {
+            throw std::runtime_error( "Error when retrieving rows from propagation history, entries are not vectors." );
+        }
+        if( startRow < 0 || numberOfRows < 0 || ( times_.size( ) > 0 && startRow + numberOfRows > numberOfRows_ ) )
+        {
+            throw std::runtime_error( "Error when retrieving rows from propagation history, requested rows are out of bounds." );
+        }
+    }
+
+    //! Function to retrieve a single entry as an Eigen matrix.
+    template< int NumberOfRows, int NumberOfColumns, int Options, int MaximumRows, int MaximumColumns >
+    void getEntry( const unsigned int index,
+                   Eigen::Matrix< StateScalarType, NumberOfRows, NumberOfColumns,
+                   Options, MaximumRows, MaximumColumns >& entry ) const
+    {
+        entry = getState( index );
+    }
+
+    //! Function to retrieve a single entry as a scalar.
+    void getEntry( const unsigned int index, StateScalarType& entry ) const
+    {
+        if( getEntrySize( ) != 1 )
+        {
+            throw std::runtime_error( "Error when retrieving scalar entry from propagation history, entries are not scalars." );
+        }
+        entry = stateData_[ index ];
+    }
+
+    //! Number of rows of each state entry.
+    int numberOfRows_;
+
+    //! Number of columns of each state entry.
+    int numberOfColumns_;
+
+    //! Times of all entries, in order in which they were added.
+    std::vector< TimeType > times_;
+
+    //! Contiguous storage of all state entries, in order in which they were added.
+    std::vector< StateScalarType > stateData_;
+};
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONHISTORY_H
@@ -38,6 +38,10 @@
   list(APPEND TUDAT_EXTERNAL_LIBRARIES gsl)
  endif()
 
+ # Find threading library, used for parallel execution of independent tasks.
+ find_package(Threads REQUIRED)
+ list(APPEND TUDAT_EXTERNAL_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+
  # Find PaGMO library on local system.
  if( USE_PAGMO )
    list(APPEND TUDAT_EXTERNAL_LIBRARIES pthread)
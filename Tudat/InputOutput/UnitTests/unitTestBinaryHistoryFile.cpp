@@ -0,0 +1,191 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/binaryHistoryFile.h"
+#include "Tudat/InputOutput/readHistoryFromFile.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::input_output;
+
+BOOST_AUTO_TEST_SUITE( test_binary_history_file )
+
+//! Test whether data written to binary history file is read back exactly, both by row and by column.
+BOOST_AUTO_TEST_CASE( testBinaryHistoryFileRoundTrip )
+{
+    const boost::filesystem::path filePath =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( ) / "history.bin";
+    const std::vector< std::string > columnNames = { "epoch", "x", "y", "z", "a_very_long_column_name_0123456789" };
+
+    // Write rows, using both appendRow functions.
+    const int numberOfRows = 1000;
+    Eigen::MatrixXd expectedData = Eigen::MatrixXd::Zero( numberOfRows, columnNames.size( ) );
+    {
+        BinaryHistoryFileWriter fileWriter( filePath, columnNames, 1024 );
+        for( int i = 0; i < numberOfRows; i++ )
+        {
+            expectedData( i, 0 ) = 10.0 * i;
+            expectedData.block( i, 1, 1, 4 ) = Eigen::RowVector4d::Random( );
+            if( i % 2 == 0 )
+            {
+                fileWriter.appendRow( expectedData.row( i ).transpose( ) );
+            }
+            else
+            {
+                fileWriter.appendRow( expectedData( i, 0 ), expectedData.block( i, 1, 1, 4 ).transpose( ) );
+            }
+        }
+        BOOST_CHECK_EQUAL( fileWriter.getNumberOfRows( ), numberOfRows );
+
+        // Check that rows with wrong size are rejected.
+        BOOST_CHECK_THROW( fileWriter.appendRow( Eigen::VectorXd::Zero( 3 ) ), std::runtime_error );
+        BOOST_CHECK_THROW( fileWriter.appendRow( 0.0, Eigen::VectorXd::Zero( 5 ) ), std::runtime_error );
+    }
+
+    // Read file, and check header and contents.
+    {
+        BinaryHistoryFileReader fileReader( filePath );
+        BOOST_CHECK_EQUAL( fileReader.getNumberOfColumns( ), columnNames.size( ) );
+        BOOST_CHECK_EQUAL( fileReader.getNumberOfRows( ), numberOfRows );
+        for( unsigned int i = 0; i < columnNames.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( fileReader.getColumnNames( ).at( i ), columnNames.at( i ) );
+            BOOST_CHECK_EQUAL( fileReader.getColumnIndex( columnNames.at( i ) ), i );
+        }
+        BOOST_CHECK_THROW( fileReader.getColumnIndex( "w" ), std::runtime_error );
+        BOOST_CHECK_THROW( fileReader.getColumn( 5 ), std::runtime_error );
+
+        BinaryHistoryFileReader::DataBlock data = fileReader.getData( );
+        BOOST_CHECK_EQUAL( ( data - expectedData ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+        BinaryHistoryFileReader::DataColumn yColumn = fileReader.getColumn( "y" );
+        BOOST_CHECK_EQUAL( ( yColumn - expectedData.col( 2 ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+        std::map< double, Eigen::VectorXd > dataMap = fileReader.getDataMap( );
+        BOOST_CHECK_EQUAL( dataMap.size( ), numberOfRows );
+        for( int i = 0; i < numberOfRows; i++ )
+        {
+            BOOST_CHECK_EQUAL( ( dataMap.at( 10.0 * i ) - expectedData.block( i, 1, 1, 4 ).transpose( ) ).cwiseAbs( ).maxCoeff( ),
+                               0.0 );
+        }
+    }
+
+    // Append incomplete row (as for an interrupted write), and check that it is ignored.
+    {
+        std::ofstream fileStream( filePath.string( ).c_str( ), std::ios::binary | std::ios::app );
+        const double partialRow[ 2 ] = { 1.0, 2.0 };
+        fileStream.write( reinterpret_cast< const char* >( partialRow ), sizeof( partialRow ) );
+    }
+    {
+        BinaryHistoryFileReader fileReader( filePath );
+        BOOST_CHECK_EQUAL( fileReader.getNumberOfRows( ), numberOfRows );
+        BOOST_CHECK_EQUAL( fileReader.getColumn( 0 )( numberOfRows - 1 ), expectedData( numberOfRows - 1, 0 ) );
+    }
+
+    // Check that a file that is not a binary history file is rejected.
+    {
+        std::ofstream fileStream( filePath.string( ).c_str( ) );
+        fileStream << "0.0 1.0 2.0 3.0 4.0 5.0 6.0 7.0 8.0 9.0 10.0" << std::endl;
+    }
+    BOOST_CHECK_THROW( BinaryHistoryFileReader fileReader( filePath ), std::runtime_error );
+
+    boost::filesystem::remove_all( filePath.parent_path( ) );
+}
+
+//! Test whether data map written to binary history file is identical to data map written to text file.
+BOOST_AUTO_TEST_CASE( testBinaryHistoryFileDataMap )
+{
+    const boost::filesystem::path outputDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( );
+
+    // Create state history, similar to propagation output.
+    const int numberOfEntries = 20000;
+    std::map< double, Eigen::VectorXd > stateHistory;
+    std::map< double, Eigen::Matrix< double, 2, 3 > > matrixHistory;
+    std::map< double, double > scalarHistory;
+    for( int i = 0; i < numberOfEntries; i++ )
+    {
+        stateHistory[ 60.0 * i ] = Eigen::VectorXd::Random( 6 ) * 1.0E7;
+        matrixHistory[ 60.0 * i ] = Eigen::Matrix< double, 2, 3 >::Random( );
+        scalarHistory[ 60.0 * i ] = static_cast< double >( i ) / 3.0;
+    }
+
+    // Write state history to text and binary file, and read both back.
+    writeDataMapToTextFile( stateHistory, "stateHistory.dat", outputDirectory );
+    writeDataMapToBinaryFile( stateHistory, outputDirectory / "stateHistory.bin" );
+
+    std::map< double, Eigen::VectorXd > textStateHistory = readVectorHistoryFromFile< double, double >(
+                6, ( outputDirectory / "stateHistory.dat" ).string( ) );
+    std::map< double, Eigen::VectorXd > binaryStateHistory =
+            BinaryHistoryFileReader( outputDirectory / "stateHistory.bin" ).getDataMap( );
+
+    // Check that binary file is read back exactly, and text file up to its precision.
+    BOOST_CHECK_EQUAL( binaryStateHistory.size( ), stateHistory.size( ) );
+    BOOST_CHECK_EQUAL( textStateHistory.size( ), stateHistory.size( ) );
+    for( const auto& stateIterator : stateHistory )
+    {
+        BOOST_CHECK_EQUAL( ( binaryStateHistory.at( stateIterator.first ) - stateIterator.second ).cwiseAbs( ).maxCoeff( ),
+                           0.0 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( textStateHistory.at( stateIterator.first ), stateIterator.second, 1.0E-14 );
+    }
+
+    // Check default column names, and row-by-row storage of matrix entries.
+    writeDataMapToBinaryFile( matrixHistory, outputDirectory / "matrixHistory.bin" );
+    BinaryHistoryFileReader matrixFileReader( outputDirectory / "matrixHistory.bin" );
+    BOOST_CHECK_EQUAL( matrixFileReader.getNumberOfColumns( ), 7 );
+    BOOST_CHECK_EQUAL( matrixFileReader.getColumnNames( ).at( 0 ), "key" );
+    BOOST_CHECK_EQUAL( matrixFileReader.getColumnNames( ).at( 6 ), "value_5" );
+    std::map< double, Eigen::VectorXd > matrixEntriesFromFile = matrixFileReader.getDataMap( );
+    for( const auto& matrixIterator : matrixHistory )
+    {
+        Eigen::Matrix< double, 2, 3 > matrixFromFile = Eigen::Map< const Eigen::Matrix< double, 2, 3, Eigen::RowMajor > >(
+                    matrixEntriesFromFile.at( matrixIterator.first ).data( ) );
+        BOOST_CHECK_EQUAL( ( matrixFromFile - matrixIterator.second ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    }
+
+    // Check scalar data map.
+    writeDataMapToBinaryFile( scalarHistory, outputDirectory / "scalarHistory.bin", { "time", "value" } );
+    BinaryHistoryFileReader scalarFileReader( outputDirectory / "scalarHistory.bin" );
+    BOOST_CHECK_EQUAL( scalarFileReader.getColumnNames( ).at( 0 ), "time" );
+    BOOST_CHECK_EQUAL( scalarFileReader.getNumberOfRows( ), numberOfEntries );
+    BinaryHistoryFileReader::DataColumn scalarColumn = scalarFileReader.getColumn( "value" );
+    for( int i = 0; i < numberOfEntries; i++ )
+    {
+        BOOST_CHECK_EQUAL( scalarColumn( i ), scalarHistory.at( 60.0 * i ) );
+    }
+
+    BOOST_CHECK_THROW( writeDataMapToBinaryFile( std::map< double, Eigen::VectorXd >( ),
+                                                 outputDirectory / "emptyHistory.bin" ), std::runtime_error );
+
+    boost::filesystem::remove_all( outputDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -29,6 +29,7 @@
 
 #include <boost/filesystem.hpp>
 
+#include "Tudat/Basics/propagationHistory.h"
 #include "Tudat/InputOutput/streamFilters.h"
 
 namespace tudat
@@ -302,6 +303,75 @@ void writeDataMapToTextFile(
                             precisionOfKeyType, precisionOfValueType, delimiter );
 }
 
+//! Write propagation history to text file.
+/*!
+ * Writes data stored in a contiguous propagation history to text file, in the same format as writeDataMapToTextFile
+ * for a map of the same data (i.e. in increasing order of time, with matrix-valued entries written row by row). The
+ * entries are written directly from the contiguous storage, without creating a map.
+ * \tparam TimeType Data type for time.
+ * \tparam StateScalarType Data type for the entries of the states.
+ * \param history Propagation history with data.
+ * \param outputFilename Output filename.
+ * \param outputDirectory Output directory. This can be passed as a string as well. It will be
+ *          created if it does not exist.
+ * \param fileHeader Text to be placed at the head of the output file. N.B: This string MUST end in
+ *          a newline/return character, or the first line of data will not be printed on a new
+ *          line.
+ * \param precisionOfKeyType Number of significant digits of time to output.
+ * \param precisionOfValueType Number of significant digits of states to output.
+ * \param delimiter Delimiter character, to delimit data entries in file.
+ */
+template< typename TimeType, typename StateScalarType >
+void writeDataMapToTextFile(
+        const PropagationHistory< TimeType, StateScalarType >& history, const std::string& outputFilename,
+        const boost::filesystem::path& outputDirectory, const std::string& fileHeader = "",
+        const int precisionOfKeyType = 16, const int precisionOfValueType = 16,
+        const std::string& delimiter = "\t" )
+{
+    // Check if output directory exists; create it if it doesn't.
+    if ( !boost::filesystem::exists( outputDirectory ) )
+    {
+        boost::filesystem::create_directories( outputDirectory );
+    }
+
+    // Open output file.
+    std::string outputDirectoryAndFilename = outputDirectory.string( ) + "/" + outputFilename;
+    std::ofstream outputFile_( outputDirectoryAndFilename.c_str( ) );
+
+    // Write file header to file.
+    outputFile_ << fileHeader;
+
+    // Write history in increasing order of time (i.e. reversed if the history was generated backwards in time).
+    const unsigned int numberOfEntries = history.size( );
+    const bool isHistoryReversed = ( numberOfEntries > 1 ) && ( history.getLastTime( ) < history.getTime( 0 ) );
+    const int numberOfRows = history.getNumberOfRows( );
+    const int numberOfColumns = history.getNumberOfColumns( );
+    const std::vector< StateScalarType >& stateData = history.getStateData( );
+    for( unsigned int i = 0; i < numberOfEntries; i++ )
+    {
+        unsigned int entryIndex = isHistoryReversed ? ( numberOfEntries - 1 - i ) : i;
+        unsigned int entryStart = entryIndex * numberOfRows * numberOfColumns;
+
+        outputFile_ << std::setprecision( precisionOfKeyType )
+                    << std::left << std::setw( precisionOfKeyType + 1 )
+                    << history.getTime( entryIndex );
+        for( int j = 0; j < numberOfRows; j++ )
+        {
+            for( int k = 0; k < numberOfColumns; k++ )
+            {
+                outputFile_ << delimiter << " "
+                            << std::setprecision( precisionOfValueType ) << std::left
+                            << std::setw( precisionOfValueType + 1 )
+                            << stateData[ entryStart + k * numberOfRows + j ];
+            }
+        }
+        outputFile_ << std::endl;
+    }
+
+    // Close output file.
+    outputFile_.close( );
+}
+
 //! Write data map to text file.
 /*!
  * Writes data stored in a map to text file, using default KeyType-precision and
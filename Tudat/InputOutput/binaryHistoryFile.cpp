@@ -0,0 +1,311 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "Tudat/InputOutput/binaryHistoryFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Identifier at start of binary history file.
+static const char binaryHistoryFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'H', 'S', 'T' };
+
+//! Tag used to identify byte order of binary history file.
+static const std::uint32_t binaryHistoryFileByteOrderTag = 0x01020304;
+
+//! Byte order tag of binary history file, as read on a machine with different byte order than the writing machine.
+static const std::uint32_t binaryHistoryFileSwappedByteOrderTag = 0x04030201;
+
+//! Version of binary history file format.
+static const std::uint32_t binaryHistoryFileVersion = 1;
+
+//! Size of fixed part of binary history file header (before column names).
+static const std::uint64_t binaryHistoryFileFixedHeaderSize = 32;
+
+//! Alignment of start of data in binary history file.
+static const std::uint64_t binaryHistoryFileDataAlignment = 64;
+
+//! Constructor, creates the file and writes its header.
+BinaryHistoryFileWriter::BinaryHistoryFileWriter( const boost::filesystem::path& filePath,
+                                                  const std::vector< std::string >& columnNames,
+                                                  const unsigned int bufferSize ):
+    filePath_( filePath ), columnNames_( columnNames ), buffer_( bufferSize ), numberOfRows_( 0 )
+{
+    if( columnNames_.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating binary history file " + filePath_.string( ) +
+                                  ", no columns defined." );
+    }
+
+    // Create output directory, if needed.
+    if( !filePath_.parent_path( ).empty( ) && !boost::filesystem::exists( filePath_.parent_path( ) ) )
+    {
+        boost::filesystem::create_directories( filePath_.parent_path( ) );
+    }
+
+    // Set buffer (before opening file), and open file.
+    if( buffer_.size( ) > 0 )
+    {
+        fileStream_.rdbuf( )->pubsetbuf( buffer_.data( ), static_cast< std::streamsize >( buffer_.size( ) ) );
+    }
+    fileStream_.open( filePath_.string( ).c_str( ), std::ios::binary | std::ios::trunc );
+    if( !fileStream_.is_open( ) )
+    {
+        throw std::runtime_error( "Error when creating binary history file, could not open file " +
+                                  filePath_.string( ) );
+    }
+
+    // Determine size of header.
+    std::uint64_t headerSize = binaryHistoryFileFixedHeaderSize;
+    for( unsigned int i = 0; i < columnNames_.size( ); i++ )
+    {
+        headerSize += 4 + columnNames_.at( i ).size( );
+    }
+    const std::uint64_t dataOffset = binaryHistoryFileDataAlignment *
+            ( ( headerSize + binaryHistoryFileDataAlignment - 1 ) / binaryHistoryFileDataAlignment );
+
+    // Fill header.
+    std::vector< char > header( dataOffset, 0 );
+    const std::uint64_t numberOfColumns = columnNames_.size( );
+    std::memcpy( header.data( ), binaryHistoryFileIdentifier, 8 );
+    std::memcpy( header.data( ) + 8, &binaryHistoryFileByteOrderTag, 4 );
+    std::memcpy( header.data( ) + 12, &binaryHistoryFileVersion, 4 );
+    std::memcpy( header.data( ) + 16, &numberOfColumns, 8 );
+    std::memcpy( header.data( ) + 24, &dataOffset, 8 );
+
+    std::uint64_t currentOffset = binaryHistoryFileFixedHeaderSize;
+    for( unsigned int i = 0; i < columnNames_.size( ); i++ )
+    {
+        const std::uint32_t nameLength = columnNames_.at( i ).size( );
+        std::memcpy( header.data( ) + currentOffset, &nameLength, 4 );
+        std::memcpy( header.data( ) + currentOffset + 4, columnNames_.at( i ).c_str( ), nameLength );
+        currentOffset += 4 + nameLength;
+    }
+
+    fileStream_.write( header.data( ), static_cast< std::streamsize >( header.size( ) ) );
+    if( !fileStream_.good( ) )
+    {
+        throw std::runtime_error( "Error when writing header of binary history file " + filePath_.string( ) );
+    }
+}
+
+//! Destructor, flushes and closes the file.
+BinaryHistoryFileWriter::~BinaryHistoryFileWriter( )
+{
+    if( fileStream_.is_open( ) )
+    {
+        fileStream_.close( );
+    }
+}
+
+//! Function to append a row to the file.
+void BinaryHistoryFileWriter::appendRow( const Eigen::Ref< const Eigen::VectorXd >& rowValues )
+{
+    checkRowAppend( rowValues.rows( ), columnNames_.size( ) );
+    fileStream_.write( reinterpret_cast< const char* >( rowValues.data( ) ),
+                       static_cast< std::streamsize >( rowValues.rows( ) * sizeof( double ) ) );
+    numberOfRows_++;
+}
+
+//! Function to append a row to the file, with the value of the first column given separately.
+void BinaryHistoryFileWriter::appendRow( const double firstColumnValue,
+                                         const Eigen::Ref< const Eigen::VectorXd >& otherColumnValues )
+{
+    checkRowAppend( otherColumnValues.rows( ) + 1, columnNames_.size( ) );
+    fileStream_.write( reinterpret_cast< const char* >( &firstColumnValue ), sizeof( double ) );
+    fileStream_.write( reinterpret_cast< const char* >( otherColumnValues.data( ) ),
+                       static_cast< std::streamsize >( otherColumnValues.rows( ) * sizeof( double ) ) );
+    numberOfRows_++;
+}
+
+//! Function to write all buffered rows to the file.
+void BinaryHistoryFileWriter::flush( )
+{
+    if( fileStream_.is_open( ) )
+    {
+        fileStream_.flush( );
+    }
+}
+
+//! Function to flush and close the file, after which no more rows can be appended.
+void BinaryHistoryFileWriter::close( )
+{
+    if( fileStream_.is_open( ) )
+    {
+        fileStream_.close( );
+        if( fileStream_.fail( ) )
+        {
+            throw std::runtime_error( "Error when closing binary history file " + filePath_.string( ) );
+        }
+    }
+}
+
+//! Function to check whether a row can be appended to the file, throws exception if not.
+void BinaryHistoryFileWriter::checkRowAppend( const int numberOfValues, const int expectedNumberOfValues )
+{
+    if( !fileStream_.is_open( ) )
+    {
+        throw std::runtime_error( "Error when appending row to binary history file " + filePath_.string( ) +
+                                  ", file is closed." );
+    }
+    else if( numberOfValues != expectedNumberOfValues )
+    {
+        throw std::runtime_error( "Error when appending row to binary history file " + filePath_.string( ) +
+                                  ", row has " + std::to_string( numberOfValues ) + " values, but file has " +
+                                  std::to_string( expectedNumberOfValues ) + " columns." );
+    }
+    else if( !fileStream_.good( ) )
+    {
+        throw std::runtime_error( "Error when appending row to binary history file " + filePath_.string( ) +
+                                  ", file stream is in error state." );
+    }
+}
+
+//! Constructor, maps the file into memory and reads its header.
+BinaryHistoryFileReader::BinaryHistoryFileReader( const boost::filesystem::path& filePath ):
+    filePath_( filePath ), data_( nullptr ), numberOfRows_( 0 )
+{
+    if( !boost::filesystem::exists( filePath_ ) ||
+            boost::filesystem::file_size( filePath_ ) < binaryHistoryFileFixedHeaderSize )
+    {
+        throw std::runtime_error( "Error when reading binary history file, file " + filePath_.string( ) +
+                                  " does not exist or is not a binary history file." );
+    }
+
+    // Map file into memory.
+    try
+    {
+        fileMapping_ = boost::interprocess::file_mapping(
+                    filePath_.string( ).c_str( ), boost::interprocess::read_only );
+        mappedRegion_ = boost::interprocess::mapped_region( fileMapping_, boost::interprocess::read_only );
+    }
+    catch( const boost::interprocess::interprocess_exception& caughtException )
+    {
+        throw std::runtime_error( "Error when reading binary history file, could not map file " +
+                                  filePath_.string( ) + " into memory: " + caughtException.what( ) );
+    }
+    const char* fileContents = static_cast< const char* >( mappedRegion_.get_address( ) );
+    const std::uint64_t fileSize = mappedRegion_.get_size( );
+
+    // Read and check fixed part of header.
+    if( std::memcmp( fileContents, binaryHistoryFileIdentifier, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading binary history file, file " + filePath_.string( ) +
+                                  " is not a binary history file." );
+    }
+
+    std::uint32_t byteOrderTag;
+    std::uint32_t fileVersion;
+    std::uint64_t numberOfColumns;
+    std::uint64_t dataOffset;
+    std::memcpy( &byteOrderTag, fileContents + 8, 4 );
+    std::memcpy( &fileVersion, fileContents + 12, 4 );
+    std::memcpy( &numberOfColumns, fileContents + 16, 8 );
+    std::memcpy( &dataOffset, fileContents + 24, 8 );
+
+    if( byteOrderTag == binaryHistoryFileSwappedByteOrderTag )
+    {
+        throw std::runtime_error( "Error when reading binary history file " + filePath_.string( ) +
+                                  ", file was written on a machine with different byte order." );
+    }
+    else if( byteOrderTag != binaryHistoryFileByteOrderTag )
+    {
+        throw std::runtime_error( "Error when reading binary history file " + filePath_.string( ) +
+                                  ", byte order tag not recognized." );
+    }
+    else if( fileVersion != binaryHistoryFileVersion )
+    {
+        throw std::runtime_error( "Error when reading binary history file " + filePath_.string( ) +
+                                  ", file format version " + std::to_string( fileVersion ) + " not supported." );
+    }
+    else if( numberOfColumns == 0 || dataOffset > fileSize || dataOffset % sizeof( double ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading binary history file " + filePath_.string( ) +
+                                  ", header is corrupted." );
+    }
+
+    // Read column names.
+    std::uint64_t currentOffset = binaryHistoryFileFixedHeaderSize;
+    for( std::uint64_t i = 0; i < numberOfColumns; i++ )
+    {
+        std::uint32_t nameLength;
+        if( currentOffset + 4 > dataOffset )
+        {
+            throw std::runtime_error( "Error when reading binary history file " + filePath_.string( ) +
+                                      ", header is corrupted." );
+        }
+        std::memcpy( &nameLength, fileContents + currentOffset, 4 );
+        if( currentOffset + 4 + nameLength > dataOffset )
+        {
+            throw std::runtime_error( "Error when reading binary history file " + filePath_.string( ) +
+                                      ", header is corrupted." );
+        }
+        columnNames_.push_back( std::string( fileContents + currentOffset + 4, nameLength ) );
+        currentOffset += 4 + nameLength;
+    }
+
+    // Set data, ignoring incomplete final row (if any).
+    data_ = reinterpret_cast< const double* >( fileContents + dataOffset );
+    numberOfRows_ = static_cast< Eigen::Index >( ( fileSize - dataOffset ) / ( numberOfColumns * sizeof( double ) ) );
+}
+
+//! Function to retrieve the index of a column, from its name.
+int BinaryHistoryFileReader::getColumnIndex( const std::string& columnName ) const
+{
+    for( unsigned int i = 0; i < columnNames_.size( ); i++ )
+    {
+        if( columnNames_.at( i ) == columnName )
+        {
+            return static_cast< int >( i );
+        }
+    }
+    throw std::runtime_error( "Error when retrieving column " + columnName + " from binary history file " +
+                              filePath_.string( ) + ", column not found." );
+}
+
+//! Function to retrieve a view of all data in the file, without copying.
+BinaryHistoryFileReader::DataBlock BinaryHistoryFileReader::getData( ) const
+{
+    return DataBlock( data_, numberOfRows_, getNumberOfColumns( ) );
+}
+
+//! Function to retrieve a view of a single column of the file, without copying.
+BinaryHistoryFileReader::DataColumn BinaryHistoryFileReader::getColumn( const int columnIndex ) const
+{
+    if( columnIndex < 0 || columnIndex >= getNumberOfColumns( ) )
+    {
+        throw std::runtime_error( "Error when retrieving column " + std::to_string( columnIndex ) +
+                                  " from binary history file " + filePath_.string( ) + ", column not found." );
+    }
+    return DataColumn( data_ + columnIndex, numberOfRows_, Eigen::InnerStride< >( getNumberOfColumns( ) ) );
+}
+
+//! Function to copy the data in the file to a map, with the values of the first column as keys.
+std::map< double, Eigen::VectorXd > BinaryHistoryFileReader::getDataMap( ) const
+{
+    std::map< double, Eigen::VectorXd > dataMap;
+    DataBlock data = getData( );
+    for( Eigen::Index i = 0; i < numberOfRows_; i++ )
+    {
+        dataMap[ data( i, 0 ) ] = data.block( i, 1, 1, data.cols( ) - 1 ).transpose( );
+    }
+    return dataMap;
+}
+
+} // namespace input_output
+
+} // namespace tudat
@@ -0,0 +1,336 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Layout of binary history files (version 1), all integers are unsigned and stored in the byte order of the
+ *      machine that wrote the file (as identified by the byte order tag):
+ *        bytes 0-7     File identifier "TUDATHST".
+ *        bytes 8-11    Byte order tag, 32-bit integer 0x01020304.
+ *        bytes 12-15   File format version, 32-bit integer.
+ *        bytes 16-23   Number of columns, 64-bit integer.
+ *        bytes 24-31   Offset of first data entry w.r.t. start of file (multiple of 64), 64-bit integer.
+ *        bytes 32-...  For each column: length of column name (32-bit integer), followed by column name.
+ *        Zero padding up to data offset.
+ *        Data, as rows of IEEE-754 double precision values (one value per column), stored contiguously.
+ *      The number of rows is not stored in the header, but follows from the file size, so that a file can be
+ *      appended to during a propagation, and is readable (up to the last complete row) at any time.
+ *
+ */
+
+#ifndef TUDAT_BINARYHISTORYFILE_H
+#define TUDAT_BINARYHISTORYFILE_H
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Class to write a history of vectors to a binary file, by appending one row (e.g. one epoch) at a time.
+/*!
+ *  Class to write a history of vectors to a self-describing binary file (see binaryHistoryFile.h for the layout), by
+ *  appending one row at a time. The file header (containing the column names) is written on construction, after
+ *  which rows may be appended during (for instance) a propagation, without keeping the history in memory. Rows are
+ *  written through a (large) buffer, which is flushed when calling flush( ) or close( ), or when the object is
+ *  destroyed.
+ */
+class BinaryHistoryFileWriter
+{
+public:
+
+    //! Constructor, creates the file and writes its header.
+    /*!
+     *  Constructor, creates the file (creating its directory if needed, and overwriting any existing file) and writes
+     *  its header.
+     *  \param filePath Path of the file that is to be written.
+     *  \param columnNames Names of the columns of the file (defining the number of values in each row).
+     *  \param bufferSize Size (in bytes) of the buffer through which the data is written (default 1 MB).
+     */
+    BinaryHistoryFileWriter( const boost::filesystem::path& filePath,
+                             const std::vector< std::string >& columnNames,
+                             const unsigned int bufferSize = 1048576 );
+
+    //! Destructor, flushes and closes the file.
+    ~BinaryHistoryFileWriter( );
+
+    //! Function to append a row to the file.
+    /*!
+     *  Function to append a row to the file.
+     *  \param rowValues Values of the row that is to be appended (size must be equal to number of columns).
+     */
+    void appendRow( const Eigen::Ref< const Eigen::VectorXd >& rowValues );
+
+    //! Function to append a row to the file, with the value of the first column given separately.
+    /*!
+     *  Function to append a row to the file, with the value of the first column (typically the epoch) given
+     *  separately from the remaining values.
+     *  \param firstColumnValue Value of the first column of the row that is to be appended.
+     *  \param otherColumnValues Values of the other columns of the row that is to be appended (size must be equal to
+     *  number of columns minus one).
+     */
+    void appendRow( const double firstColumnValue, const Eigen::Ref< const Eigen::VectorXd >& otherColumnValues );
+
+    //! Function to write all buffered rows to the file.
+    void flush( );
+
+    //! Function to flush and close the file, after which no more rows can be appended.
+    void close( );
+
+    //! Function to retrieve the names of the columns of the file.
+    /*!
+     *  Function to retrieve the names of the columns of the file.
+     *  \return Names of the columns of the file.
+     */
+    const std::vector< std::string >& getColumnNames( ) const { return columnNames_; }
+
+    //! Function to retrieve the number of rows that have been appended to the file.
+    /*!
+     *  Function to retrieve the number of rows that have been appended to the file.
+     *  \return Number of rows that have been appended to the file.
+     */
+    unsigned long long getNumberOfRows( ) const { return numberOfRows_; }
+
+    //! Function to retrieve the path of the file.
+    /*!
+     *  Function to retrieve the path of the file.
+     *  \return Path of the file.
+     */
+    boost::filesystem::path getFilePath( ) const { return filePath_; }
+
+private:
+
+    //! Function to check whether a row can be appended to the file, throws exception if not.
+    void checkRowAppend( const int numberOfValues, const int expectedNumberOfValues );
+
+    //! Path of the file.
+    boost::filesystem::path filePath_;
+
+    //! Names of the columns of the file.
+    std::vector< std::string > columnNames_;
+
+    //! Buffer through which data is written to file.
+    std::vector< char > buffer_;
+
+    //! Stream to which data is written.
+    std::ofstream fileStream_;
+
+    //! Number of rows that have been appended to the file.
+    unsigned long long numberOfRows_;
+};
+
+//! Class to read a binary history file, by mapping its contents into memory.
+/*!
+ *  Class to read a binary history file (see binaryHistoryFile.h for the layout), by mapping its contents into memory.
+ *  The data is not copied, but accessed directly (as Eigen::Map objects) in the memory-mapped file, so that only the
+ *  parts of the file that are actually accessed are read from disk. The data objects returned by this class are only
+ *  valid during the lifetime of the reader object. Files written on a machine with a different byte order can not be
+ *  read.
+ */
+class BinaryHistoryFileReader
+{
+public:
+
+    //! Typedef for matrix view of all data in the file (one row per entry, one column per variable).
+    typedef Eigen::Map< const Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > > DataBlock;
+
+    //! Typedef for vector view of a single column of the file.
+    typedef Eigen::Map< const Eigen::VectorXd, Eigen::Unaligned, Eigen::InnerStride< > > DataColumn;
+
+    //! Constructor, maps the file into memory and reads its header.
+    /*!
+     *  Constructor, maps the file into memory and reads its header. Any incomplete row at the end of the file (e.g.
+     *  when reading a file that is being written) is ignored.
+     *  \param filePath Path of the file that is to be read.
+     */
+    BinaryHistoryFileReader( const boost::filesystem::path& filePath );
+
+    //! Function to retrieve the names of the columns of the file.
+    /*!
+     *  Function to retrieve the names of the columns of the file.
+     *  \return Names of the columns of the file.
+     */
+    const std::vector< std::string >& getColumnNames( ) const { return columnNames_; }
+
+    //! Function to retrieve the index of a column, from its name.
+    /*!
+     *  Function to retrieve the index of a column, from its name (throws exception if no column has this name).
+     *  \param columnName Name of the column.
+     *  \return Index of the (first) column with given name.
+     */
+    int getColumnIndex( const std::string& columnName ) const;
+
+    //! Function to retrieve the number of columns of the file.
+    /*!
+     *  Function to retrieve the number of columns of the file.
+     *  \return Number of columns of the file.
+     */
+    int getNumberOfColumns( ) const { return static_cast< int >( columnNames_.size( ) ); }
+
+    //! Function to retrieve the number of (complete) rows in the file.
+    /*!
+     *  Function to retrieve the number of (complete) rows in the file.
+     *  \return Number of (complete) rows in the file.
+     */
+    Eigen::Index getNumberOfRows( ) const { return numberOfRows_; }
+
+    //! Function to retrieve a view of all data in the file, without copying.
+    /*!
+     *  Function to retrieve a view of all data in the file, without copying.
+     *  \return Matrix view of all data in the file (one row per entry, one column per variable).
+     */
+    DataBlock getData( ) const;
+
+    //! Function to retrieve a view of a single column of the file, without copying.
+    /*!
+     *  Function to retrieve a view of a single column of the file, without copying.
+     *  \param columnIndex Index of the column.
+     *  \return Vector view of the column.
+     */
+    DataColumn getColumn( const int columnIndex ) const;
+
+    //! Function to retrieve a view of a single column of the file, without copying.
+    /*!
+     *  Function to retrieve a view of a single column of the file, without copying.
+     *  \param columnName Name of the column.
+     *  \return Vector view of the column.
+     */
+    DataColumn getColumn( const std::string& columnName ) const
+    {
+        return getColumn( getColumnIndex( columnName ) );
+    }
+
+    //! Function to copy the data in the file to a map, with the values of the first column as keys.
+    /*!
+     *  Function to copy the data in the file to a map, with the values of the first column (typically the epoch) as
+     *  keys, and the other columns as values, as returned by readVectorHistoryFromFile for text files.
+     *  \return Map with data in file.
+     */
+    std::map< double, Eigen::VectorXd > getDataMap( ) const;
+
+private:
+
+    //! Path of the file.
+    boost::filesystem::path filePath_;
+
+    //! Object representing the mapping of the file.
+    boost::interprocess::file_mapping fileMapping_;
+
+    //! Memory-mapped region of the file.
+    boost::interprocess::mapped_region mappedRegion_;
+
+    //! Names of the columns of the file.
+    std::vector< std::string > columnNames_;
+
+    //! Pointer to the first data entry in the memory-mapped file.
+    const double* data_;
+
+    //! Number of (complete) rows in the file.
+    Eigen::Index numberOfRows_;
+};
+
+//! Function to write a data map to a binary history file.
+/*!
+ *  Function to write a data map to a binary history file (see binaryHistoryFile.h for the layout), as the binary
+ *  equivalent of writeDataMapToTextFile. Each map entry is written as a single row, with the key in the first column.
+ *  Matrix-valued entries are written row by row (as in writeDataMapToTextFile).
+ *  \param dataMap Data map that is to be written.
+ *  \param filePath Path of the file that is to be written.
+ *  \param columnNames Names of the columns. If empty (default), the first column is named "key", and the other columns
+ *  "value_i", with i the index of the entry in the map values.
+ */
+template< typename KeyType, typename ScalarType,
+          int NumberOfRows, int NumberOfColumns, int Options, int MaximumRows, int MaximumCols >
+void writeDataMapToBinaryFile(
+        const std::map< KeyType, Eigen::Matrix< ScalarType, NumberOfRows, NumberOfColumns, Options,
+        MaximumRows, MaximumCols > >& dataMap,
+        const boost::filesystem::path& filePath,
+        const std::vector< std::string >& columnNames = std::vector< std::string >( ) )
+{
+    if( dataMap.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when writing data map to binary file " + filePath.string( ) +
+                                  ", map is empty." );
+    }
+
+    const int numberOfRows = dataMap.begin( )->second.rows( );
+    const int numberOfValues = dataMap.begin( )->second.size( );
+
+    // Set default column names, if needed.
+    std::vector< std::string > fileColumnNames = columnNames;
+    if( fileColumnNames.size( ) == 0 )
+    {
+        fileColumnNames.push_back( "key" );
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            fileColumnNames.push_back( "value_" + std::to_string( i ) );
+        }
+    }
+
+    BinaryHistoryFileWriter fileWriter( filePath, fileColumnNames );
+    Eigen::VectorXd currentValues = Eigen::VectorXd::Zero( numberOfValues );
+    for( const auto& mapIterator : dataMap )
+    {
+        if( mapIterator.second.size( ) != numberOfValues )
+        {
+            throw std::runtime_error( "Error when writing data map to binary file " + filePath.string( ) +
+                                      ", map values have inconsistent sizes." );
+        }
+
+        // Store matrix entries row by row.
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            currentValues( i ) = static_cast< double >( mapIterator.second( i / ( numberOfValues / numberOfRows ),
+                                                                            i % ( numberOfValues / numberOfRows ) ) );
+        }
+        fileWriter.appendRow( static_cast< double >( mapIterator.first ), currentValues );
+    }
+    fileWriter.close( );
+}
+
+//! Function to write a map of scalar data to a binary history file.
+/*!
+ *  Function to write a map of scalar data to a binary history file (see binaryHistoryFile.h for the layout). Each map
+ *  entry is written as a single row, with the key in the first column and the value in the second column.
+ *  \param dataMap Data map that is to be written.
+ *  \param filePath Path of the file that is to be written.
+ *  \param columnNames Names of the two columns (default "key" and "value").
+ */
+template< typename KeyType, typename ValueType >
+void writeDataMapToBinaryFile(
+        const std::map< KeyType, ValueType >& dataMap,
+        const boost::filesystem::path& filePath,
+        const std::vector< std::string >& columnNames = { "key", "value" } )
+{
+    BinaryHistoryFileWriter fileWriter( filePath, columnNames );
+    Eigen::VectorXd currentValue = Eigen::VectorXd::Zero( 1 );
+    for( const auto& mapIterator : dataMap )
+    {
+        currentValue( 0 ) = static_cast< double >( mapIterator.second );
+        fileWriter.appendRow( static_cast< double >( mapIterator.first ), currentValue );
+    }
+    fileWriter.close( );
+}
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_BINARYHISTORYFILE_H
@@ -73,6 +73,20 @@ void to_json( nlohmann::json& jsonObject, const std::shared_ptr< EphemerisSettin
         jsonObject[ K::useLongDoubleStates ] = interpolatedSpiceEphemerisSettings->getUseLongDoubleStates( );
         return;
     }
+    case chebyshev_spice_ephemeris:
+    {
+        std::shared_ptr< ChebyshevSpiceEphemerisSettings > chebyshevSpiceEphemerisSettings =
+                std::dynamic_pointer_cast< ChebyshevSpiceEphemerisSettings >( ephemerisSettings );
+        assertNonnullptrPointer( chebyshevSpiceEphemerisSettings );
+        jsonObject[ K::initialTime ] = chebyshevSpiceEphemerisSettings->getInitialTime( );
+        jsonObject[ K::finalTime ] = chebyshevSpiceEphemerisSettings->getFinalTime( );
+        jsonObject[ K::positionTolerance ] = chebyshevSpiceEphemerisSettings->getPositionTolerance( );
+        jsonObject[ K::velocityTolerance ] = chebyshevSpiceEphemerisSettings->getVelocityTolerance( );
+        jsonObject[ K::numberOfCoefficientsPerSegment ] =
+                chebyshevSpiceEphemerisSettings->getNumberOfCoefficientsPerSegment( );
+        jsonObject[ K::initialSegmentDuration ] = chebyshevSpiceEphemerisSettings->getInitialSegmentDuration( );
+        return;
+    }
     case tabulated_ephemeris:
     {
         std::shared_ptr< TabulatedEphemerisSettings > tabulatedEphemerisSettings =
@@ -172,6 +186,21 @@ void from_json( const nlohmann::json& jsonObject, std::shared_ptr< EphemerisSett
                     interpolatedSpiceEphemerisSettings );
         break;
     }
+    case chebyshev_spice_ephemeris:
+    {
+        ChebyshevSpiceEphemerisSettings defaults( TUDAT_NAN, TUDAT_NAN );
+        ephemerisSettings = std::make_shared< ChebyshevSpiceEphemerisSettings >(
+                    getValue< double >( jsonObject, K::initialTime ),
+                    getValue< double >( jsonObject, K::finalTime ),
+                    defaults.getFrameOrigin( ),
+                    defaults.getFrameOrientation( ),
+                    getValue( jsonObject, K::positionTolerance, defaults.getPositionTolerance( ) ),
+                    getValue( jsonObject, K::velocityTolerance, defaults.getVelocityTolerance( ) ),
+                    getValue( jsonObject, K::numberOfCoefficientsPerSegment,
+                              defaults.getNumberOfCoefficientsPerSegment( ) ),
+                    getValue( jsonObject, K::initialSegmentDuration, defaults.getInitialSegmentDuration( ) ) );
+        break;
+    }
     case constant_ephemeris:
     {
         ConstantEphemerisSettings defaults( ( Eigen::Vector6d( ) ) );
@@ -68,7 +68,8 @@ static std::map< EphemerisType, std::string > ephemerisTypes =
     { interpolated_spice, "interpolatedSpice" },
     { constant_ephemeris, "constant" },
     { kepler_ephemeris, "kepler" },
-    { custom_ephemeris, "custom" }
+    { custom_ephemeris, "custom" },
+    { chebyshev_spice_ephemeris, "chebyshevSpice" }
 };
 
 //! `EphemerisType` not supported by `json_interface`.
@@ -13,6 +13,7 @@
 
 #include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
 #include "Tudat/SimulationSetup/EstimationSetup/variationalEquationsSolver.h"
+#include "Tudat/InputOutput/binaryHistoryFile.h"
 #include "Tudat/JsonInterface/Propagation/variable.h"
 
 #include "Tudat/JsonInterface/Support/valueAccess.h"
@@ -63,6 +64,11 @@ public:
 
     //! Whether to print only the values corresponding to the final integration step.
     bool onlyFinalStep_ = false;
+
+    //! Whether to write the results to a binary history file (see binaryHistoryFile.h) instead of a text file.
+    //! For binary output, the header and numerical precision are ignored, and the columns are named after the variables.
+    //! As for text output, variational equations results can only be exported with epochs in the first column.
+    bool binaryFormat_ = false;
 };
 
 //! Create a `json` object from a shared pointer to a `ExportSettings` object.
@@ -257,7 +263,40 @@ void exportResultsOfDynamicsSimulator(
             results[ epoch ] = result;
         }
 
-        if ( exportSettings->epochsInFirstColumn_ )
+        if ( exportSettings->binaryFormat_ )
+        {
+            // Name columns after variables, with index of entry appended for non-scalar variables.
+            std::vector< std::string > columnNames;
+            if ( exportSettings->epochsInFirstColumn_ )
+            {
+                columnNames.push_back( "epoch" );
+            }
+            for ( unsigned int i = 0; i < variables.size( ); ++i )
+            {
+                const std::string variableID = getVariableId( variables.at( i ) );
+                for ( unsigned int j = 0; j < variableSizes.at( i ); ++j )
+                {
+                    columnNames.push_back( variableSizes.at( i ) == 1 ? variableID :
+                                                                        variableID + "_" + std::to_string( j ) );
+                }
+            }
+
+            // Write results to binary file, row by row.
+            BinaryHistoryFileWriter fileWriter( exportSettings->outputFile_, columnNames );
+            for ( const auto& entry : results )
+            {
+                if ( exportSettings->epochsInFirstColumn_ )
+                {
+                    fileWriter.appendRow( static_cast< double >( entry.first ), entry.second );
+                }
+                else
+                {
+                    fileWriter.appendRow( entry.second );
+                }
+            }
+            fileWriter.close( );
+        }
+        else if ( exportSettings->epochsInFirstColumn_ )
         {
             // Write results map to file.
             writeDataMapToTextFile( results,
@@ -299,7 +338,18 @@ void exportResultsOfVariationalEquations(
             {
             case stateTransitionMatrix:
             {
-                if ( exportSettings->epochsInFirstColumn_ )
+                if ( !exportSettings->epochsInFirstColumn_ )
+                {
+                    // Not supported for either text or binary format.
+                    throw std::runtime_error( "Error saving state transition/sensitivity matrix without epochs not yet supported" );
+                }
+                else if ( exportSettings->binaryFormat_ )
+                {
+                    // Write results map to binary file, with matrix entries stored row by row.
+                    writeDataMapToBinaryFile( variationalEquationsSolver->getNumericalVariationalEquationsSolution( )[ 0 ],
+                                              exportSettings->outputFile_ );
+                }
+                else
                 {
                     // Write results map to file.
                     writeDataMapToTextFile( variationalEquationsSolver->getNumericalVariationalEquationsSolution( )[ 0 ],
@@ -307,15 +357,22 @@ void exportResultsOfVariationalEquations(
                                             exportSettings->header_,
                                             exportSettings->numericalPrecision_ );
                 }
-                else
-                {
-                    throw std::runtime_error( "Error saving state transition/sensitivity matrix without epochs not yet supported" );
-                }
                 break;
             }
             case sensitivityMatrix:
             {
-                if ( exportSettings->epochsInFirstColumn_ )
+                if ( !exportSettings->epochsInFirstColumn_ )
+                {
+                    // Not supported for either text or binary format.
+                    throw std::runtime_error( "Error saving state transition/sensitivity matrix without epochs not yet supported" );
+                }
+                else if ( exportSettings->binaryFormat_ )
+                {
+                    // Write results map to binary file, with matrix entries stored row by row.
+                    writeDataMapToBinaryFile( variationalEquationsSolver->getNumericalVariationalEquationsSolution( )[ 1 ],
+                                              exportSettings->outputFile_ );
+                }
+                else
                 {
                     // Write results map to file.
                     writeDataMapToTextFile( variationalEquationsSolver->getNumericalVariationalEquationsSolution( )[ 1 ],
@@ -323,10 +380,6 @@ void exportResultsOfVariationalEquations(
                                             exportSettings->header_,
                                             exportSettings->numericalPrecision_ );
                 }
-                else
-                {
-                    throw std::runtime_error( "Error saving state transition/sensitivity matrix without epochs not yet supported" );
-                }
                 break;
             }
             default:
@@ -169,6 +169,10 @@ const std::string Keys::Body::Ephemeris::centralBodyGravitationalParameter = "ce
 const std::string Keys::Body::Ephemeris::rootFinderAbsoluteTolerance = "rootFinderAbsoluteTolerance";
 const std::string Keys::Body::Ephemeris::rootFinderMaximumNumberOfIterations = "rootFinderMaximumNumberOfIterations";
 const std::string Keys::Body::Ephemeris::bodyStateHistory = "bodyStateHistory";
+const std::string Keys::Body::Ephemeris::positionTolerance = "positionTolerance";
+const std::string Keys::Body::Ephemeris::velocityTolerance = "velocityTolerance";
+const std::string Keys::Body::Ephemeris::numberOfCoefficientsPerSegment = "numberOfCoefficientsPerSegment";
+const std::string Keys::Body::Ephemeris::initialSegmentDuration = "initialSegmentDuration";
 
 // //  Body::GravityField
 const std::string Keys::Body::gravityField = "gravityField";
@@ -478,6 +482,7 @@ const std::string Keys::Export::epochsInFirstColumn = "epochsInFirstColumn";
 const std::string Keys::Export::onlyInitialStep = "onlyInitialStep";
 const std::string Keys::Export::onlyFinalStep = "onlyFinalStep";
 const std::string Keys::Export::numericalPrecision = "numericalPrecision";
+const std::string Keys::Export::binaryFormat = "binaryFormat";
 
 
 //  Options
@@ -167,6 +167,10 @@ struct Keys
             static const std::string rootFinderAbsoluteTolerance;
             static const std::string rootFinderMaximumNumberOfIterations;
             static const std::string bodyStateHistory;
+            static const std::string positionTolerance;
+            static const std::string velocityTolerance;
+            static const std::string numberOfCoefficientsPerSegment;
+            static const std::string initialSegmentDuration;
         };
 
         static const std::string gravityField;
@@ -517,6 +521,7 @@ struct Keys
         static const std::string onlyInitialStep;
         static const std::string onlyFinalStep;
         static const std::string numericalPrecision;
+        static const std::string binaryFormat;
     };
 
     static const std::string options;
@@ -72,6 +72,7 @@ BOOST_AUTO_TEST_CASE( test_json_export_partial_result )
     manualSettings->onlyInitialStep_ = true;
     manualSettings->onlyFinalStep_ = true;
     manualSettings->numericalPrecision_ = 6;
+    manualSettings->binaryFormat_ = true;
 
     // Compare
     BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
@@ -0,0 +1,255 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/blockSparseNormalEquations.h"
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_block_sparse_normal_equations )
+
+using namespace tudat::linear_algebra;
+
+//! Function to get indices of arc-wise states of two bodies (ordered as arc-wise initial state parameters in estimation)
+std::vector< std::vector< int > > getTestArcWiseParameterIndices( const int numberOfArcs )
+{
+    std::vector< std::vector< int > > arcWiseParameterIndices( numberOfArcs );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        for( int body = 0; body < 2; body++ )
+        {
+            for( int j = 0; j < 6; j++ )
+            {
+                arcWiseParameterIndices[ i ].push_back( 6 * body * numberOfArcs + 6 * i + j );
+            }
+        }
+    }
+    return arcWiseParameterIndices;
+}
+
+//! Function to create matrix of partials in which each observation depends on the states of a single arc (or none)
+Eigen::MatrixXd getTestArcWiseInformationMatrix(
+        const std::vector< std::vector< int > >& arcWiseParameterIndices, const int numberOfParameters,
+        const int numberOfObservationsPerArc, const int numberOfGlobalOnlyObservations )
+{
+    const int numberOfArcs = arcWiseParameterIndices.size( );
+    const int numberOfLocalParameters = 12 * numberOfArcs;
+
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Zero(
+                numberOfArcs * numberOfObservationsPerArc + numberOfGlobalOnlyObservations, numberOfParameters );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        for( unsigned int j = 0; j < arcWiseParameterIndices.at( i ).size( ); j++ )
+        {
+            informationMatrix.block( i * numberOfObservationsPerArc, arcWiseParameterIndices.at( i ).at( j ),
+                                     numberOfObservationsPerArc, 1 ) =
+                    Eigen::VectorXd::Random( numberOfObservationsPerArc );
+        }
+    }
+    informationMatrix.rightCols( numberOfParameters - numberOfLocalParameters ) = Eigen::MatrixXd::Random(
+                informationMatrix.rows( ), numberOfParameters - numberOfLocalParameters );
+
+    // Scale partials of first global parameter, to test normalization
+    informationMatrix.col( numberOfLocalParameters ) *= 1.0E4;
+
+    return informationMatrix;
+}
+
+//! Test whether block-sparse normal equations and their solution are equal to those of full normal equations
+BOOST_AUTO_TEST_CASE( testBlockSparseNormalEquations )
+{
+    const int numberOfArcs = 8;
+    const int numberOfGlobalParameters = 5;
+    const int numberOfParameters = 12 * numberOfArcs + numberOfGlobalParameters;
+
+    std::vector< std::vector< int > > arcWiseParameterIndices = getTestArcWiseParameterIndices( numberOfArcs );
+    Eigen::MatrixXd informationMatrix = getTestArcWiseInformationMatrix(
+                arcWiseParameterIndices, numberOfParameters, 50, 20 );
+
+    // Shuffle observations, so that each block contains observations of various arcs
+    Eigen::PermutationMatrix< Eigen::Dynamic, Eigen::Dynamic > permutation( informationMatrix.rows( ) );
+    permutation.setIdentity( );
+    for( int i = 0; i < permutation.size( ); i++ )
+    {
+        std::swap( permutation.indices( )( i ), permutation.indices( )( ( 7 * i ) % permutation.size( ) ) );
+    }
+    informationMatrix = permutation * informationMatrix;
+
+    const int numberOfObservations = informationMatrix.rows( );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Ones( numberOfObservations );
+
+    // Accumulate dense and block-sparse normal equations (latter in two parts)
+    NormalEquationsAccumulator denseNormalEquations( numberOfParameters );
+    BlockSparseNormalEquations blockSparseNormalEquations( numberOfParameters, arcWiseParameterIndices );
+    BlockSparseNormalEquations secondBlockSparseNormalEquations( numberOfParameters, arcWiseParameterIndices );
+    const int blockSize = 37;
+    for( int i = 0; i < numberOfObservations; i += blockSize )
+    {
+        const int currentBlockSize = std::min( blockSize, numberOfObservations - i );
+        denseNormalEquations.addObservations( informationMatrix.block( i, 0, currentBlockSize, numberOfParameters ),
+                                              residuals.segment( i, currentBlockSize ),
+                                              weights.segment( i, currentBlockSize ) );
+        ( ( i < numberOfObservations / 2 ) ? blockSparseNormalEquations : secondBlockSparseNormalEquations ).addObservations(
+                    informationMatrix.block( i, 0, currentBlockSize, numberOfParameters ),
+                    residuals.segment( i, currentBlockSize ), weights.segment( i, currentBlockSize ) );
+    }
+    blockSparseNormalEquations.addNormalEquations( secondBlockSparseNormalEquations );
+
+    BOOST_CHECK_EQUAL( blockSparseNormalEquations.getNumberOfObservations( ), numberOfObservations );
+    BOOST_CHECK_EQUAL( blockSparseNormalEquations.getNumberOfLocalParameterSets( ), numberOfArcs );
+    BOOST_CHECK_EQUAL( blockSparseNormalEquations.getNumberOfGlobalParameters( ), numberOfGlobalParameters );
+
+    // Compare unnormalized normal equations
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockSparseNormalEquations.getNormalMatrix( ),
+                                       denseNormalEquations.getNormalMatrix( ), 1.0E-12 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockSparseNormalEquations.getRightHandSide( ),
+                                       denseNormalEquations.getRightHandSide( ), 1.0E-12 );
+
+    // Compare normalized normal equations
+    Eigen::MatrixXd normalizedNormalMatrix;
+    Eigen::VectorXd normalizedRightHandSide;
+    Eigen::VectorXd normalizationTerms;
+    denseNormalEquations.getNormalizedNormalEquations( normalizedNormalMatrix, normalizedRightHandSide, normalizationTerms );
+    Eigen::VectorXd blockSparseNormalizationTerms = blockSparseNormalEquations.normalize( );
+
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_EQUAL( blockSparseNormalizationTerms( i ), normalizationTerms( i ) );
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockSparseNormalEquations.getNormalMatrix( ), normalizedNormalMatrix, 1.0E-12 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockSparseNormalEquations.getRightHandSide( ), normalizedRightHandSide, 1.0E-12 );
+
+    // Compare solution with (block-diagonal) a priori information
+    Eigen::MatrixXd inverseAPrioriCovariance = 1.0E-3 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+    inverseAPrioriCovariance( arcWiseParameterIndices.at( 1 ).at( 0 ), arcWiseParameterIndices.at( 1 ).at( 7 ) ) = 1.0E-4;
+    inverseAPrioriCovariance( arcWiseParameterIndices.at( 1 ).at( 7 ), arcWiseParameterIndices.at( 1 ).at( 0 ) ) = 1.0E-4;
+    inverseAPrioriCovariance( arcWiseParameterIndices.at( 2 ).at( 3 ), numberOfParameters - 1 ) = 1.0E-4;
+    inverseAPrioriCovariance( numberOfParameters - 1, arcWiseParameterIndices.at( 2 ).at( 3 ) ) = 1.0E-4;
+
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > expectedOutput = performLeastSquaresAdjustmentFromNormalEquations(
+                normalizedNormalMatrix, normalizedRightHandSide, inverseAPrioriCovariance );
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > blockSparseOutput =
+            performLeastSquaresAdjustmentFromBlockSparseNormalEquations(
+                blockSparseNormalEquations, inverseAPrioriCovariance );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockSparseOutput.first, expectedOutput.first, 1.0E-10 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockSparseOutput.second, expectedOutput.second, 1.0E-12 );
+
+    // Compare solution with linear constraint (solved with full normal equations)
+    Eigen::MatrixXd constraintMultiplier = Eigen::MatrixXd::Zero( 1, numberOfParameters );
+    constraintMultiplier( 0, arcWiseParameterIndices.at( 0 ).at( 0 ) ) = 1.0;
+    constraintMultiplier( 0, arcWiseParameterIndices.at( 3 ).at( 0 ) ) = -1.0;
+    Eigen::VectorXd constraintRightHandSide = Eigen::VectorXd::Zero( 1 );
+    expectedOutput = performLeastSquaresAdjustmentFromNormalEquations(
+                normalizedNormalMatrix, normalizedRightHandSide, inverseAPrioriCovariance, 1, 1.0E8,
+                constraintMultiplier, constraintRightHandSide );
+    blockSparseOutput = performLeastSquaresAdjustmentFromBlockSparseNormalEquations(
+                blockSparseNormalEquations, inverseAPrioriCovariance, 1, 1.0E8,
+                constraintMultiplier, constraintRightHandSide );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockSparseOutput.first, expectedOutput.first, 1.0E-10 );
+    BOOST_CHECK_SMALL( blockSparseOutput.first( arcWiseParameterIndices.at( 0 ).at( 0 ) ) -
+                       blockSparseOutput.first( arcWiseParameterIndices.at( 3 ).at( 0 ) ), 1.0E-12 );
+
+    // Check that a priori information coupling different arcs is rejected
+    Eigen::MatrixXd invalidInverseAPrioriCovariance = inverseAPrioriCovariance;
+    invalidInverseAPrioriCovariance( arcWiseParameterIndices.at( 0 ).at( 0 ), arcWiseParameterIndices.at( 1 ).at( 0 ) ) =
+            1.0E-4;
+    BOOST_CHECK_THROW( performLeastSquaresAdjustmentFromBlockSparseNormalEquations(
+                           blockSparseNormalEquations, invalidInverseAPrioriCovariance ), std::runtime_error );
+
+    // Check that observations depending on multiple arcs are rejected
+    Eigen::MatrixXd invalidInformationMatrix = Eigen::MatrixXd::Zero( 2, numberOfParameters );
+    invalidInformationMatrix( 1, arcWiseParameterIndices.at( 0 ).at( 11 ) ) = 1.0;
+    invalidInformationMatrix( 1, arcWiseParameterIndices.at( 4 ).at( 2 ) ) = 1.0;
+    BOOST_CHECK_THROW( blockSparseNormalEquations.addObservations(
+                           invalidInformationMatrix, Eigen::VectorXd::Zero( 2 ), Eigen::VectorXd::Ones( 2 ) ),
+                       std::runtime_error );
+
+    // Check invalid parameter sets
+    BOOST_CHECK_THROW( BlockSparseNormalEquations( 10, { { 0, 1 }, { 1, 2 } } ), std::runtime_error );
+    BOOST_CHECK_THROW( BlockSparseNormalEquations( 10, { { 0, 10 } } ), std::runtime_error );
+}
+
+//! Test whether block-sparse solution falls back to full solution if arc is not observable
+BOOST_AUTO_TEST_CASE( testBlockSparseNormalEquationsFallBack )
+{
+    const int numberOfArcs = 3;
+    const int numberOfParameters = 12 * numberOfArcs + 2;
+
+    std::vector< std::vector< int > > arcWiseParameterIndices = getTestArcWiseParameterIndices( numberOfArcs );
+    Eigen::MatrixXd informationMatrix = getTestArcWiseInformationMatrix(
+                arcWiseParameterIndices, numberOfParameters, 30, 0 );
+
+    // Remove all observations of second arc, except one
+    informationMatrix.block( 31, 0, 29, numberOfParameters ).setZero( );
+
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( informationMatrix.rows( ) );
+    Eigen::VectorXd weights = Eigen::VectorXd::Ones( informationMatrix.rows( ) );
+
+    NormalEquationsAccumulator denseNormalEquations( numberOfParameters );
+    denseNormalEquations.addObservations( informationMatrix, residuals, weights );
+    BlockSparseNormalEquations blockSparseNormalEquations( numberOfParameters, arcWiseParameterIndices );
+    blockSparseNormalEquations.addObservations( informationMatrix, residuals, weights );
+
+    Eigen::VectorXd expectedSolution = solveSystemOfEquationsWithCholesky(
+                denseNormalEquations.getNormalMatrix( ), denseNormalEquations.getRightHandSide( ), false );
+    Eigen::VectorXd blockSparseSolution = blockSparseNormalEquations.solve( false );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockSparseSolution, expectedSolution, 1.0E-12 );
+}
+
+//! Compare block-sparse and full solution of normal equations for many arcs
+BOOST_AUTO_TEST_CASE( testBlockSparseNormalEquationsManyArcs )
+{
+    const int numberOfArcs = 100;
+    const int numberOfGlobalParameters = 10;
+    const int numberOfParameters = 12 * numberOfArcs + numberOfGlobalParameters;
+
+    std::vector< std::vector< int > > arcWiseParameterIndices = getTestArcWiseParameterIndices( numberOfArcs );
+    Eigen::MatrixXd informationMatrix = getTestArcWiseInformationMatrix(
+                arcWiseParameterIndices, numberOfParameters, 50, 0 );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( informationMatrix.rows( ) );
+    Eigen::VectorXd weights = Eigen::VectorXd::Ones( informationMatrix.rows( ) );
+
+    // Accumulate and solve full normal equations
+    NormalEquationsAccumulator denseNormalEquations( numberOfParameters );
+    denseNormalEquations.addObservations( informationMatrix, residuals, weights );
+    Eigen::VectorXd denseSolution = solveSystemOfEquationsWithCholesky(
+                denseNormalEquations.getNormalMatrix( ), denseNormalEquations.getRightHandSide( ) );
+
+    // Accumulate and solve block-sparse normal equations
+    BlockSparseNormalEquations blockSparseNormalEquations( numberOfParameters, arcWiseParameterIndices );
+    blockSparseNormalEquations.addObservations( informationMatrix, residuals, weights );
+    Eigen::VectorXd blockSparseSolution = blockSparseNormalEquations.solve( );
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( blockSparseSolution, denseSolution, 1.0E-8 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,183 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_least_squares_estimation )
+
+using namespace tudat::linear_algebra;
+
+//! Function to create matrix of partials with columns of very different magnitude (as in orbit determination)
+Eigen::MatrixXd getTestInformationMatrix( const int numberOfObservations, const int numberOfParameters )
+{
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        informationMatrix.col( i ) *= std::pow( 10.0, static_cast< double >( ( 3 * i ) % 13 ) - 6.0 );
+    }
+    return informationMatrix;
+}
+
+//! Test whether incrementally accumulated normal equations are equal to those computed from full matrix of partials
+BOOST_AUTO_TEST_CASE( testNormalEquationsAccumulation )
+{
+    const int numberOfObservations = 5000;
+    const int numberOfParameters = 20;
+
+    Eigen::MatrixXd informationMatrix = getTestInformationMatrix( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) + Eigen::VectorXd::Ones(
+                numberOfObservations );
+    Eigen::MatrixXd inverseAPrioriCovariance = 1.0E-3 * Eigen::MatrixXd::Identity(
+                numberOfParameters, numberOfParameters );
+
+    // Compute normalized matrix of partials and normalization terms directly
+    Eigen::VectorXd expectedNormalizationTerms = Eigen::VectorXd::Zero( numberOfParameters );
+    Eigen::MatrixXd normalizedInformationMatrix = informationMatrix;
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        double minimum = informationMatrix.col( i ).minCoeff( );
+        double maximum = informationMatrix.col( i ).maxCoeff( );
+        expectedNormalizationTerms( i ) = ( std::fabs( minimum ) > maximum ) ? minimum : maximum;
+        normalizedInformationMatrix.col( i ) /= expectedNormalizationTerms( i );
+    }
+
+    // Compute reference solution from full (normalized) matrix of partials
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > expectedOutput = performLeastSquaresAdjustmentFromInformationMatrix(
+                normalizedInformationMatrix, residuals, weights, inverseAPrioriCovariance );
+
+    // Accumulate normal equations for various block sizes
+    std::vector< int > blockSizes = { 1, 7, 1000, numberOfObservations };
+    for( unsigned int i = 0; i < blockSizes.size( ); i++ )
+    {
+        // Accumulate first half and second half of blocks separately, and combine afterwards
+        NormalEquationsAccumulator normalEquations( numberOfParameters );
+        NormalEquationsAccumulator secondNormalEquations( numberOfParameters );
+        for( int startIndex = 0; startIndex < numberOfObservations; startIndex += blockSizes.at( i ) )
+        {
+            int currentBlockSize = std::min( blockSizes.at( i ), numberOfObservations - startIndex );
+            ( ( startIndex < numberOfObservations / 2 ) ? normalEquations : secondNormalEquations ).addObservations(
+                        informationMatrix.block( startIndex, 0, currentBlockSize, numberOfParameters ),
+                        residuals.segment( startIndex, currentBlockSize ),
+                        weights.segment( startIndex, currentBlockSize ) );
+        }
+        normalEquations.addNormalEquations( secondNormalEquations );
+        BOOST_CHECK_EQUAL( normalEquations.getNumberOfObservations( ), numberOfObservations );
+
+        // Check unnormalized normal equations
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    normalEquations.getNormalMatrix( ),
+                    Eigen::MatrixXd( informationMatrix.transpose( ) * weights.asDiagonal( ) * informationMatrix ), 1.0E-12 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    normalEquations.getRightHandSide( ),
+                    Eigen::VectorXd( informationMatrix.transpose( ) * weights.cwiseProduct( residuals ) ), 1.0E-12 );
+
+        // Check normalized normal equations, and solution
+        Eigen::MatrixXd normalizedNormalMatrix;
+        Eigen::VectorXd normalizedRightHandSide, normalizationTerms;
+        normalEquations.getNormalizedNormalEquations( normalizedNormalMatrix, normalizedRightHandSide, normalizationTerms );
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            BOOST_CHECK_EQUAL( normalizationTerms( j ), expectedNormalizationTerms( j ) );
+        }
+
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > leastSquaresOutput = performLeastSquaresAdjustmentFromNormalEquations(
+                    normalizedNormalMatrix, normalizedRightHandSide, inverseAPrioriCovariance );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( leastSquaresOutput.first, expectedOutput.first, 1.0E-10 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( leastSquaresOutput.second, expectedOutput.second, 1.0E-12 );
+    }
+
+    // Check constrained solution (first two parameters equal)
+    Eigen::MatrixXd constraintMultiplier = Eigen::MatrixXd::Zero( 1, numberOfParameters );
+    constraintMultiplier( 0, 0 ) = 1.0;
+    constraintMultiplier( 0, 1 ) = -1.0;
+    Eigen::VectorXd constraintRightHandSide = Eigen::VectorXd::Zero( 1 );
+
+    NormalEquationsAccumulator normalEquations( numberOfParameters );
+    normalEquations.addObservations( normalizedInformationMatrix, residuals, weights );
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > constrainedOutput = performLeastSquaresAdjustmentFromNormalEquations(
+                normalEquations.getNormalMatrix( ), normalEquations.getRightHandSide( ), inverseAPrioriCovariance, true, 1.0E8,
+                constraintMultiplier, constraintRightHandSide );
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > expectedConstrainedOutput =
+            performLeastSquaresAdjustmentFromInformationMatrix(
+                normalizedInformationMatrix, residuals, weights, inverseAPrioriCovariance, true, 1.0E8,
+                constraintMultiplier, constraintRightHandSide );
+    BOOST_CHECK_EQUAL( constrainedOutput.first.rows( ), numberOfParameters + 1 );
+    BOOST_CHECK_SMALL( constrainedOutput.first( 0 ) - constrainedOutput.first( 1 ), 1.0E-12 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( constrainedOutput.first.segment( 0, numberOfParameters ),
+                                       expectedConstrainedOutput.first.segment( 0, numberOfParameters ), 1.0E-10 );
+
+    // Check that inconsistent input is rejected
+    BOOST_CHECK_THROW( normalEquations.addObservations( Eigen::MatrixXd::Zero( 3, numberOfParameters + 1 ),
+                                                        Eigen::VectorXd::Zero( 3 ), Eigen::VectorXd::Ones( 3 ) ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( normalEquations.addObservations( Eigen::MatrixXd::Zero( 3, numberOfParameters ),
+                                                        Eigen::VectorXd::Zero( 2 ), Eigen::VectorXd::Ones( 3 ) ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( normalEquations.addObservations( Eigen::MatrixXd::Zero( 3, numberOfParameters ),
+                                                        Eigen::VectorXd::Zero( 3 ), -Eigen::VectorXd::Ones( 3 ) ),
+                       std::runtime_error );
+}
+
+//! Test Cholesky solution of normal equations, and fall-back to SVD for singular normal equations
+BOOST_AUTO_TEST_CASE( testCholeskyNormalEquationsSolution )
+{
+    const int numberOfObservations = 1000;
+    const int numberOfParameters = 10;
+
+    // Check Cholesky and SVD solution of well-conditioned problem
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::MatrixXd normalMatrix = informationMatrix.transpose( ) * informationMatrix;
+    Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) * residuals;
+
+    Eigen::VectorXd choleskySolution = solveSystemOfEquationsWithCholesky( normalMatrix, rightHandSide );
+    Eigen::VectorXd svdSolution = solveSystemOfEquationsWithSvd( normalMatrix, rightHandSide, false );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( choleskySolution, svdSolution, 1.0E-12 );
+
+    // Check that only lower triangular part of matrix is used.
+    Eigen::MatrixXd lowerNormalMatrix = normalMatrix.triangularView< Eigen::Lower >( );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( solveSystemOfEquationsWithCholesky( lowerNormalMatrix, rightHandSide ),
+                                       svdSolution, 1.0E-12 );
+
+    // Create rank-deficient problem (two identical columns), and check that (minimum-norm) SVD solution is returned
+    informationMatrix.col( 3 ) = informationMatrix.col( 7 );
+    normalMatrix = informationMatrix.transpose( ) * informationMatrix;
+    rightHandSide = informationMatrix.transpose( ) * residuals;
+
+    choleskySolution = solveSystemOfEquationsWithCholesky( normalMatrix, rightHandSide, false );
+    svdSolution = solveSystemOfEquationsWithSvd( normalMatrix, rightHandSide, false );
+    BOOST_CHECK_EQUAL( choleskySolution.allFinite( ), true );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( choleskySolution, svdSolution, 1.0E-12 );
+    BOOST_CHECK_SMALL( choleskySolution( 3 ) - choleskySolution( 7 ), 1.0E-10 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,159 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <atomic>
+#include <complex>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/numericalJacobian.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_numerical_jacobian )
+
+//! Test function (implemented for real and complex input), with 4 outputs and 3 inputs.
+template< typename ScalarType >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > evaluateTestFunction(
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& input )
+{
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > output( 4 );
+    output( 0 ) = input( 0 ) * input( 0 ) * input( 1 );
+    output( 1 ) = std::sin( input( 2 ) ) * input( 0 );
+    output( 2 ) = std::exp( input( 1 ) ) * input( 2 );
+    output( 3 ) = ScalarType( 1.0 ) / ( input( 0 ) * input( 0 ) + input( 1 ) * input( 1 ) + input( 2 ) * input( 2 ) );
+    return output;
+}
+
+//! Analytical Jacobian of evaluateTestFunction
+Eigen::MatrixXd computeTestFunctionJacobian( const Eigen::VectorXd& input )
+{
+    Eigen::MatrixXd jacobian = Eigen::MatrixXd::Zero( 4, 3 );
+    jacobian( 0, 0 ) = 2.0 * input( 0 ) * input( 1 );
+    jacobian( 0, 1 ) = input( 0 ) * input( 0 );
+    jacobian( 1, 0 ) = std::sin( input( 2 ) );
+    jacobian( 1, 2 ) = std::cos( input( 2 ) ) * input( 0 );
+    jacobian( 2, 1 ) = std::exp( input( 1 ) ) * input( 2 );
+    jacobian( 2, 2 ) = std::exp( input( 1 ) );
+    jacobian.block( 3, 0, 1, 3 ) = -2.0 * input.transpose( ) / std::pow( input.squaredNorm( ), 2.0 );
+    return jacobian;
+}
+
+BOOST_AUTO_TEST_CASE( testNumericalJacobian )
+{
+    using namespace numerical_derivatives;
+
+    Eigen::VectorXd input = ( Eigen::VectorXd( 3 ) << 1.3, -0.4, 2.1 ).finished( );
+    Eigen::MatrixXd analyticalJacobian = computeTestFunctionJacobian( input );
+
+    std::function< Eigen::VectorXd( const Eigen::VectorXd& ) > realFunction = &evaluateTestFunction< double >;
+    std::function< Eigen::VectorXcd( const Eigen::VectorXcd& ) > complexFunction =
+            &evaluateTestFunction< std::complex< double > >;
+
+    // Test central difference Jacobians of various orders, with optimal step size.
+    {
+        Eigen::MatrixXd numericalJacobian = computeCentralDifferenceJacobian( input, realFunction );
+        BOOST_CHECK_SMALL( ( analyticalJacobian - numericalJacobian ).cwiseAbs( ).maxCoeff( ), 1.0E-9 );
+
+        numericalJacobian = computeCentralDifferenceJacobian(
+                    input, realFunction, NumericalJacobianSettings(
+                        optimal_jacobian_step_size, Eigen::VectorXd::Zero( 0 ), 0.0, 0.0, order4 ) );
+        BOOST_CHECK_SMALL( ( analyticalJacobian - numericalJacobian ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+
+        numericalJacobian = computeCentralDifferenceJacobian(
+                    input, realFunction, NumericalJacobianSettings(
+                        optimal_jacobian_step_size, Eigen::VectorXd::Zero( 0 ), 0.0, 0.0, order8 ) );
+        BOOST_CHECK_SMALL( ( analyticalJacobian - numericalJacobian ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+    }
+
+    // Test central difference Jacobian with absolute and relative step sizes.
+    {
+        Eigen::MatrixXd numericalJacobian = computeCentralDifferenceJacobian(
+                    input, realFunction, NumericalJacobianSettings(
+                        absolute_jacobian_step_size, ( Eigen::VectorXd( 3 ) << 1.0E-6, 2.0E-6, 1.0E-5 ).finished( ) ) );
+        BOOST_CHECK_SMALL( ( analyticalJacobian - numericalJacobian ).cwiseAbs( ).maxCoeff( ), 1.0E-8 );
+
+        numericalJacobian = computeCentralDifferenceJacobian(
+                    input, realFunction, NumericalJacobianSettings(
+                        relative_jacobian_step_size, Eigen::VectorXd::Zero( 0 ), 1.0E-6, 1.0E-6 ) );
+        BOOST_CHECK_SMALL( ( analyticalJacobian - numericalJacobian ).cwiseAbs( ).maxCoeff( ), 1.0E-8 );
+
+        bool isExceptionCaught = false;
+        try
+        {
+            computeCentralDifferenceJacobian(
+                        input, realFunction, NumericalJacobianSettings(
+                            absolute_jacobian_step_size, Eigen::VectorXd::Constant( 2, 1.0E-6 ) ) );
+        }
+        catch( std::runtime_error const& )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK( isExceptionCaught );
+    }
+
+    // Test complex-step Jacobian, which should be accurate to machine precision.
+    {
+        Eigen::MatrixXd numericalJacobian = computeComplexStepJacobian( input, complexFunction );
+        BOOST_CHECK_SMALL( ( analyticalJacobian - numericalJacobian ).cwiseAbs( ).maxCoeff( ),
+                           4.0 * std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Test parallel computation of Jacobian, with a separate function for each thread.
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads++ )
+    {
+        NumericalJacobianSettings jacobianSettings(
+                    optimal_jacobian_step_size, Eigen::VectorXd::Zero( 0 ), 0.0, 0.0, order4, numberOfThreads );
+
+        std::atomic< int > numberOfCreatedFunctions( 0 );
+        Eigen::MatrixXd parallelJacobian = computeCentralDifferenceJacobian(
+                    input, [ & ]( )
+        {
+            numberOfCreatedFunctions++;
+            return realFunction;
+        }, jacobianSettings );
+        Eigen::MatrixXd serialJacobian = computeCentralDifferenceJacobian( input, realFunction, jacobianSettings );
+
+        BOOST_CHECK( numberOfCreatedFunctions <= static_cast< int >( numberOfThreads ) );
+        for( int i = 0; i < serialJacobian.rows( ); i++ )
+        {
+            for( int j = 0; j < serialJacobian.cols( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( parallelJacobian( i, j ), serialJacobian( i, j ) );
+            }
+        }
+
+        Eigen::MatrixXd parallelComplexStepJacobian = computeComplexStepJacobian(
+                    input, [ & ]( ){ return complexFunction; }, jacobianSettings );
+        Eigen::MatrixXd serialComplexStepJacobian = computeComplexStepJacobian( input, complexFunction );
+        for( int i = 0; i < serialJacobian.rows( ); i++ )
+        {
+            for( int j = 0; j < serialJacobian.cols( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( parallelComplexStepJacobian( i, j ), serialComplexStepJacobian( i, j ) );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,558 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Mathematics/BasicMathematics/blockSparseNormalEquations.h"
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Constructor
+BlockSparseNormalEquations::BlockSparseNormalEquations(
+        const int numberOfParameters,
+        const std::vector< std::vector< int > >& localParameterIndices ):
+    numberOfParameters_( numberOfParameters ), localParameterIndices_( localParameterIndices ),
+    parameterSetIndices_( numberOfParameters, -1 ), indicesInParameterSet_( numberOfParameters, -1 ),
+    numberOfObservations_( 0 )
+{
+    // Assign parameters to sets of local parameters
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < localParameterIndices_.at( i ).size( ); j++ )
+        {
+            const int parameterIndex = localParameterIndices_.at( i ).at( j );
+            if( parameterIndex < 0 || parameterIndex >= numberOfParameters_ )
+            {
+                throw std::runtime_error( "Error when creating block-sparse normal equations, parameter index " +
+                                          std::to_string( parameterIndex ) + " is out of range" );
+            }
+            else if( parameterSetIndices_.at( parameterIndex ) != -1 )
+            {
+                throw std::runtime_error( "Error when creating block-sparse normal equations, parameter index " +
+                                          std::to_string( parameterIndex ) + " is in multiple local sets" );
+            }
+            parameterSetIndices_[ parameterIndex ] = i;
+            indicesInParameterSet_[ parameterIndex ] = j;
+        }
+    }
+
+    // Identify global parameters
+    for( int i = 0; i < numberOfParameters_; i++ )
+    {
+        if( parameterSetIndices_.at( i ) == -1 )
+        {
+            indicesInParameterSet_[ i ] = globalParameterIndices_.size( );
+            globalParameterIndices_.push_back( i );
+        }
+    }
+
+    // Initialize normal equation blocks
+    const int numberOfGlobalParameters = globalParameterIndices_.size( );
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        const int numberOfLocalParameters = localParameterIndices_.at( i ).size( );
+        localNormalMatrices_.push_back( Eigen::MatrixXd::Zero( numberOfLocalParameters, numberOfLocalParameters ) );
+        localGlobalNormalMatrices_.push_back( Eigen::MatrixXd::Zero( numberOfLocalParameters, numberOfGlobalParameters ) );
+        localRightHandSides_.push_back( Eigen::VectorXd::Zero( numberOfLocalParameters ) );
+    }
+    globalNormalMatrix_ = Eigen::MatrixXd::Zero( numberOfGlobalParameters, numberOfGlobalParameters );
+    globalRightHandSide_ = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+
+    minimumPartials_ = Eigen::VectorXd::Zero( numberOfParameters_ );
+    maximumPartials_ = Eigen::VectorXd::Zero( numberOfParameters_ );
+}
+
+//! Function to add a block of observations to the normal equations
+void BlockSparseNormalEquations::addObservations(
+        const Eigen::MatrixXd& informationMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix )
+{
+    if( informationMatrix.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when adding observations to block-sparse normal equations, number of parameters "
+                                  "is inconsistent" );
+    }
+
+    if( ( informationMatrix.rows( ) != observationResiduals.rows( ) ) ||
+            ( informationMatrix.rows( ) != diagonalOfWeightMatrix.rows( ) ) )
+    {
+        throw std::runtime_error( "Error when adding observations to block-sparse normal equations, number of "
+                                  "observations is inconsistent" );
+    }
+
+    if( informationMatrix.rows( ) == 0 )
+    {
+        return;
+    }
+
+    if( diagonalOfWeightMatrix.minCoeff( ) < 0.0 )
+    {
+        throw std::runtime_error( "Error when adding observations to block-sparse normal equations, weights must be "
+                                  "non-negative" );
+    }
+
+    // Determine the set of local parameters on which each observation depends
+    const int numberOfRows = informationMatrix.rows( );
+    std::vector< int > rowSetIndices( numberOfRows, -1 );
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        const int currentSetIndex = i;
+        for( unsigned int j = 0; j < localParameterIndices_.at( i ).size( ); j++ )
+        {
+            const int currentColumn = localParameterIndices_.at( i ).at( j );
+            for( int k = 0; k < numberOfRows; k++ )
+            {
+                if( informationMatrix( k, currentColumn ) != 0.0 )
+                {
+                    if( rowSetIndices[ k ] == -1 )
+                    {
+                        rowSetIndices[ k ] = currentSetIndex;
+                    }
+                    else if( rowSetIndices[ k ] != currentSetIndex )
+                    {
+                        throw std::runtime_error(
+                                    "Error when adding observations to block-sparse normal equations, observation depends "
+                                    "on local parameter sets " + std::to_string( rowSetIndices[ k ] ) + " and " +
+                                    std::to_string( currentSetIndex ) );
+                    }
+                }
+            }
+        }
+    }
+
+    // Add observations, grouped by set of local parameters
+    std::map< int, std::vector< int > > rowIndicesPerSet;
+    for( int k = 0; k < numberOfRows; k++ )
+    {
+        rowIndicesPerSet[ rowSetIndices[ k ] ].push_back( k );
+    }
+
+    for( std::map< int, std::vector< int > >::const_iterator setIterator = rowIndicesPerSet.begin( );
+         setIterator != rowIndicesPerSet.end( ); setIterator++ )
+    {
+        addObservationsOfLocalParameterSet(
+                    setIterator->first, setIterator->second, informationMatrix, observationResiduals,
+                    diagonalOfWeightMatrix );
+    }
+
+    // Update extreme values of partials
+    if( numberOfObservations_ == 0 )
+    {
+        minimumPartials_ = informationMatrix.colwise( ).minCoeff( ).transpose( );
+        maximumPartials_ = informationMatrix.colwise( ).maxCoeff( ).transpose( );
+    }
+    else
+    {
+        minimumPartials_ = minimumPartials_.cwiseMin( informationMatrix.colwise( ).minCoeff( ).transpose( ) );
+        maximumPartials_ = maximumPartials_.cwiseMax( informationMatrix.colwise( ).maxCoeff( ).transpose( ) );
+    }
+
+    numberOfObservations_ += numberOfRows;
+}
+
+//! Function to add observations (rows of H) depending on a single set of local parameters to the normal equations
+void BlockSparseNormalEquations::addObservationsOfLocalParameterSet(
+        const int localSetIndex,
+        const std::vector< int >& rowIndices,
+        const Eigen::MatrixXd& informationMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix )
+{
+    const int numberOfRows = rowIndices.size( );
+    const int numberOfGlobalParameters = globalParameterIndices_.size( );
+
+    // Retrieve square root of weights, and weighted residuals and global partials of current observations
+    Eigen::VectorXd squareRootOfWeights( numberOfRows );
+    Eigen::VectorXd weightedResiduals( numberOfRows );
+    Eigen::MatrixXd weightedGlobalPartials( numberOfRows, numberOfGlobalParameters );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        squareRootOfWeights( i ) = std::sqrt( diagonalOfWeightMatrix( rowIndices[ i ] ) );
+        weightedResiduals( i ) = squareRootOfWeights( i ) * observationResiduals( rowIndices[ i ] );
+        for( int j = 0; j < numberOfGlobalParameters; j++ )
+        {
+            weightedGlobalPartials( i, j ) = squareRootOfWeights( i ) *
+                    informationMatrix( rowIndices[ i ], globalParameterIndices_[ j ] );
+        }
+    }
+
+    // Update global blocks
+    if( numberOfGlobalParameters > 0 )
+    {
+        globalNormalMatrix_.selfadjointView< Eigen::Lower >( ).rankUpdate( weightedGlobalPartials.transpose( ) );
+        globalRightHandSide_.noalias( ) += weightedGlobalPartials.transpose( ) * weightedResiduals;
+    }
+
+    // Update blocks of local parameters
+    if( localSetIndex >= 0 )
+    {
+        const std::vector< int >& currentLocalIndices = localParameterIndices_.at( localSetIndex );
+        const int numberOfLocalParameters = currentLocalIndices.size( );
+
+        Eigen::MatrixXd weightedLocalPartials( numberOfRows, numberOfLocalParameters );
+        for( int i = 0; i < numberOfRows; i++ )
+        {
+            for( int j = 0; j < numberOfLocalParameters; j++ )
+            {
+                weightedLocalPartials( i, j ) = squareRootOfWeights( i ) *
+                        informationMatrix( rowIndices[ i ], currentLocalIndices[ j ] );
+            }
+        }
+
+        localNormalMatrices_[ localSetIndex ].selfadjointView< Eigen::Lower >( ).rankUpdate(
+                    weightedLocalPartials.transpose( ) );
+        localRightHandSides_[ localSetIndex ].noalias( ) += weightedLocalPartials.transpose( ) * weightedResiduals;
+        if( numberOfGlobalParameters > 0 )
+        {
+            localGlobalNormalMatrices_[ localSetIndex ].noalias( ) +=
+                    weightedLocalPartials.transpose( ) * weightedGlobalPartials;
+        }
+    }
+}
+
+//! Function to add the normal equations accumulated by another object to those of this object.
+void BlockSparseNormalEquations::addNormalEquations( const BlockSparseNormalEquations& otherNormalEquations )
+{
+    if( ( otherNormalEquations.numberOfParameters_ != numberOfParameters_ ) ||
+            ( otherNormalEquations.localParameterIndices_ != localParameterIndices_ ) )
+    {
+        throw std::runtime_error( "Error when combining block-sparse normal equations, parameter structure is inconsistent" );
+    }
+
+    if( otherNormalEquations.numberOfObservations_ == 0 )
+    {
+        return;
+    }
+
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        localNormalMatrices_[ i ].triangularView< Eigen::Lower >( ) += otherNormalEquations.localNormalMatrices_[ i ];
+        localGlobalNormalMatrices_[ i ] += otherNormalEquations.localGlobalNormalMatrices_[ i ];
+        localRightHandSides_[ i ] += otherNormalEquations.localRightHandSides_[ i ];
+    }
+    globalNormalMatrix_.triangularView< Eigen::Lower >( ) += otherNormalEquations.globalNormalMatrix_;
+    globalRightHandSide_ += otherNormalEquations.globalRightHandSide_;
+
+    if( numberOfObservations_ == 0 )
+    {
+        minimumPartials_ = otherNormalEquations.minimumPartials_;
+        maximumPartials_ = otherNormalEquations.maximumPartials_;
+    }
+    else
+    {
+        minimumPartials_ = minimumPartials_.cwiseMin( otherNormalEquations.minimumPartials_ );
+        maximumPartials_ = maximumPartials_.cwiseMax( otherNormalEquations.maximumPartials_ );
+    }
+
+    numberOfObservations_ += otherNormalEquations.numberOfObservations_;
+}
+
+//! Function to add a (full) matrix to the normal matrix
+void BlockSparseNormalEquations::addToNormalMatrix( const Eigen::MatrixXd& matrixToAdd )
+{
+    if( ( matrixToAdd.rows( ) != numberOfParameters_ ) || ( matrixToAdd.cols( ) != numberOfParameters_ ) )
+    {
+        throw std::runtime_error( "Error when adding matrix to block-sparse normal equations, size is inconsistent" );
+    }
+
+    // Add each entry to the associated block (only lower triangular part of symmetric blocks is used).
+    for( int j = 0; j < numberOfParameters_; j++ )
+    {
+        const int columnSetIndex = parameterSetIndices_[ j ];
+        const int columnIndexInSet = indicesInParameterSet_[ j ];
+        for( int i = 0; i < numberOfParameters_; i++ )
+        {
+            const double currentEntry = matrixToAdd( i, j );
+            if( currentEntry == 0.0 )
+            {
+                continue;
+            }
+
+            const int rowSetIndex = parameterSetIndices_[ i ];
+            const int rowIndexInSet = indicesInParameterSet_[ i ];
+            if( rowSetIndex == -1 && columnSetIndex == -1 )
+            {
+                if( rowIndexInSet >= columnIndexInSet )
+                {
+                    globalNormalMatrix_( rowIndexInSet, columnIndexInSet ) += currentEntry;
+                }
+            }
+            else if( rowSetIndex == columnSetIndex )
+            {
+                if( rowIndexInSet >= columnIndexInSet )
+                {
+                    localNormalMatrices_[ rowSetIndex ]( rowIndexInSet, columnIndexInSet ) += currentEntry;
+                }
+            }
+            else if( columnSetIndex == -1 )
+            {
+                localGlobalNormalMatrices_[ rowSetIndex ]( rowIndexInSet, columnIndexInSet ) += currentEntry;
+            }
+            else if( rowSetIndex != -1 )
+            {
+                throw std::runtime_error( "Error when adding matrix to block-sparse normal equations, matrix couples local "
+                                          "parameter sets " + std::to_string( rowSetIndex ) + " and " +
+                                          std::to_string( columnSetIndex ) );
+            }
+        }
+    }
+}
+
+//! Function to reset the normal equations to zero
+void BlockSparseNormalEquations::reset( )
+{
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        localNormalMatrices_[ i ].setZero( );
+        localGlobalNormalMatrices_[ i ].setZero( );
+        localRightHandSides_[ i ].setZero( );
+    }
+    globalNormalMatrix_.setZero( );
+    globalRightHandSide_.setZero( );
+    minimumPartials_.setZero( );
+    maximumPartials_.setZero( );
+    numberOfObservations_ = 0;
+}
+
+//! Function to normalize the normal equations
+Eigen::VectorXd BlockSparseNormalEquations::normalize( )
+{
+    Eigen::VectorXd normalizationTerms = getPartialsNormalizationTerms( minimumPartials_, maximumPartials_ );
+    Eigen::VectorXd inverseNormalizationTerms = normalizationTerms.cwiseInverse( );
+
+    // Retrieve scaling of global parameters
+    Eigen::VectorXd inverseGlobalNormalizationTerms( globalParameterIndices_.size( ) );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        inverseGlobalNormalizationTerms( i ) = inverseNormalizationTerms( globalParameterIndices_[ i ] );
+    }
+
+    // Scale blocks of local parameters
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        Eigen::VectorXd inverseLocalNormalizationTerms( localParameterIndices_.at( i ).size( ) );
+        for( unsigned int j = 0; j < localParameterIndices_.at( i ).size( ); j++ )
+        {
+            inverseLocalNormalizationTerms( j ) = inverseNormalizationTerms( localParameterIndices_.at( i ).at( j ) );
+        }
+
+        localNormalMatrices_[ i ] = inverseLocalNormalizationTerms.asDiagonal( ) * localNormalMatrices_[ i ] *
+                inverseLocalNormalizationTerms.asDiagonal( );
+        localGlobalNormalMatrices_[ i ] = inverseLocalNormalizationTerms.asDiagonal( ) * localGlobalNormalMatrices_[ i ] *
+                inverseGlobalNormalizationTerms.asDiagonal( );
+        localRightHandSides_[ i ] = localRightHandSides_[ i ].cwiseProduct( inverseLocalNormalizationTerms );
+    }
+
+    // Scale global blocks
+    globalNormalMatrix_ = inverseGlobalNormalizationTerms.asDiagonal( ) * globalNormalMatrix_ *
+            inverseGlobalNormalizationTerms.asDiagonal( );
+    globalRightHandSide_ = globalRightHandSide_.cwiseProduct( inverseGlobalNormalizationTerms );
+
+    // Update extreme values of (now normalized) partials
+    Eigen::VectorXd scaledMinimumPartials = minimumPartials_.cwiseProduct( inverseNormalizationTerms );
+    Eigen::VectorXd scaledMaximumPartials = maximumPartials_.cwiseProduct( inverseNormalizationTerms );
+    minimumPartials_ = scaledMinimumPartials.cwiseMin( scaledMaximumPartials );
+    maximumPartials_ = scaledMinimumPartials.cwiseMax( scaledMaximumPartials );
+
+    return normalizationTerms;
+}
+
+//! Function to solve the normal equations, using a Schur complement of the local parameters
+Eigen::VectorXd BlockSparseNormalEquations::solve(
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber ) const
+{
+    const int numberOfGlobalParameters = globalParameterIndices_.size( );
+
+    // Decompose blocks of local parameters, and compute reduced normal equations of global parameters
+    Eigen::MatrixXd reducedGlobalNormalMatrix = globalNormalMatrix_.selfadjointView< Eigen::Lower >( );
+    Eigen::VectorXd reducedGlobalRightHandSide = globalRightHandSide_;
+    std::vector< Eigen::LDLT< Eigen::MatrixXd, Eigen::Lower > > localDecompositions( localParameterIndices_.size( ) );
+
+    bool isDecompositionValid = true;
+    double maximumConditionNumber = 0.0;
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        if( localParameterIndices_.at( i ).size( ) == 0 )
+        {
+            continue;
+        }
+
+        localDecompositions[ i ].compute( localNormalMatrices_[ i ] );
+        if( !isCholeskyDecompositionPositiveDefinite( localDecompositions[ i ] ) )
+        {
+            isDecompositionValid = false;
+            break;
+        }
+        maximumConditionNumber = std::max( maximumConditionNumber, 1.0 / localDecompositions[ i ].rcond( ) );
+
+        if( numberOfGlobalParameters > 0 )
+        {
+            reducedGlobalNormalMatrix.noalias( ) -= localGlobalNormalMatrices_[ i ].transpose( ) *
+                    localDecompositions[ i ].solve( localGlobalNormalMatrices_[ i ] );
+            reducedGlobalRightHandSide.noalias( ) -= localGlobalNormalMatrices_[ i ].transpose( ) *
+                    localDecompositions[ i ].solve( localRightHandSides_[ i ] );
+        }
+    }
+
+    // Solve reduced normal equations for global parameters
+    Eigen::VectorXd globalSolution = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+    if( isDecompositionValid && numberOfGlobalParameters > 0 )
+    {
+        Eigen::LDLT< Eigen::MatrixXd, Eigen::Lower > globalDecomposition( reducedGlobalNormalMatrix );
+        if( !isCholeskyDecompositionPositiveDefinite( globalDecomposition ) )
+        {
+            isDecompositionValid = false;
+        }
+        else
+        {
+            maximumConditionNumber = std::max( maximumConditionNumber, 1.0 / globalDecomposition.rcond( ) );
+            globalSolution = globalDecomposition.solve( reducedGlobalRightHandSide );
+        }
+    }
+
+    // Revert to solution of full normal equations if decomposition is not usable.
+    if( !isDecompositionValid )
+    {
+        std::cerr << "Warning when performing least squares, block-sparse normal matrix is not positive definite, "
+                  << "solving full normal equations" << std::endl;
+        return solveSystemOfEquationsWithCholesky(
+                    getNormalMatrix( ), getRightHandSide( ), checkConditionNumber, maximumAllowedConditionNumber );
+    }
+
+    if( checkConditionNumber && ( maximumConditionNumber > maximumAllowedConditionNumber ) )
+    {
+        std::cerr << "Warning when performing least squares, condition number of block is (estimated as) "
+                  << maximumConditionNumber << std::endl;
+    }
+
+    // Set solution of global parameters, and back-substitute to obtain solution for local parameters
+    Eigen::VectorXd solution = Eigen::VectorXd::Zero( numberOfParameters_ );
+    for( int i = 0; i < numberOfGlobalParameters; i++ )
+    {
+        solution( globalParameterIndices_[ i ] ) = globalSolution( i );
+    }
+
+    for( unsigned int i = 0; i < localParameterIndices_.size( ); i++ )
+    {
+        if( localParameterIndices_.at( i ).size( ) == 0 )
+        {
+            continue;
+        }
+
+        Eigen::VectorXd localSolution = localDecompositions[ i ].solve(
+                    localRightHandSides_[ i ] - localGlobalNormalMatrices_[ i ] * globalSolution );
+        for( unsigned int j = 0; j < localParameterIndices_.at( i ).size( ); j++ )
+        {
+            solution( localParameterIndices_.at( i ).at( j ) ) = localSolution( j );
+        }
+    }
+
+    return solution;
+}
+
+//! Function to retrieve the (full, dense) normal matrix
+Eigen::MatrixXd BlockSparseNormalEquations::getNormalMatrix( ) const
+{
+    Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ );
+
+    // Set global block
+    const int numberOfGlobalParameters = globalParameterIndices_.size( );
+    for( int j = 0; j < numberOfGlobalParameters; j++ )
+    {
+        for( int i = j; i < numberOfGlobalParameters; i++ )
+        {
+            normalMatrix( globalParameterIndices_[ i ], globalParameterIndices_[ j ] ) = globalNormalMatrix_( i, j );
+            normalMatrix( globalParameterIndices_[ j ], globalParameterIndices_[ i ] ) = globalNormalMatrix_( i, j );
+        }
+    }
+
+    // Set local blocks, and coupling to global parameters
+    for( unsigned int k = 0; k < localParameterIndices_.size( ); k++ )
+    {
+        const std::vector< int >& currentLocalIndices = localParameterIndices_.at( k );
+        const int numberOfLocalParameters = currentLocalIndices.size( );
+        for( int j = 0; j < numberOfLocalParameters; j++ )
+        {
+            for( int i = j; i < numberOfLocalParameters; i++ )
+            {
+                normalMatrix( currentLocalIndices[ i ], currentLocalIndices[ j ] ) = localNormalMatrices_[ k ]( i, j );
+                normalMatrix( currentLocalIndices[ j ], currentLocalIndices[ i ] ) = localNormalMatrices_[ k ]( i, j );
+            }
+
+            for( int i = 0; i < numberOfGlobalParameters; i++ )
+            {
+                normalMatrix( currentLocalIndices[ j ], globalParameterIndices_[ i ] ) =
+                        localGlobalNormalMatrices_[ k ]( j, i );
+                normalMatrix( globalParameterIndices_[ i ], currentLocalIndices[ j ] ) =
+                        localGlobalNormalMatrices_[ k ]( j, i );
+            }
+        }
+    }
+
+    return normalMatrix;
+}
+
+//! Function to retrieve the (full) right-hand side of the normal equations
+Eigen::VectorXd BlockSparseNormalEquations::getRightHandSide( ) const
+{
+    Eigen::VectorXd rightHandSide = Eigen::VectorXd::Zero( numberOfParameters_ );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        rightHandSide( globalParameterIndices_[ i ] ) = globalRightHandSide_( i );
+    }
+
+    for( unsigned int k = 0; k < localParameterIndices_.size( ); k++ )
+    {
+        for( unsigned int i = 0; i < localParameterIndices_.at( k ).size( ); i++ )
+        {
+            rightHandSide( localParameterIndices_.at( k ).at( i ) ) = localRightHandSides_[ k ]( i );
+        }
+    }
+    return rightHandSide;
+}
+
+//! Function to perform an iteration of least squares estimation from block-sparse normal equations and a priori information
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromBlockSparseNormalEquations(
+        BlockSparseNormalEquations normalEquations,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
+    // Solve full (indefinite) system if constraints are provided
+    if( constraintMultiplier.rows( ) != 0 )
+    {
+        return performLeastSquaresAdjustmentFromNormalEquations(
+                    normalEquations.getNormalMatrix( ), normalEquations.getRightHandSide( ),
+                    inverseOfAPrioriCovarianceMatrix, checkConditionNumber, maximumAllowedConditionNumber,
+                    constraintMultiplier, constraintRightHandside );
+    }
+
+    normalEquations.addToNormalMatrix( inverseOfAPrioriCovarianceMatrix );
+    Eigen::VectorXd parameterAdjustment = normalEquations.solve( checkConditionNumber, maximumAllowedConditionNumber );
+    return std::make_pair( parameterAdjustment, normalEquations.getNormalMatrix( ) );
+}
+
+} // namespace linear_algebra
+
+} // namespace tudat
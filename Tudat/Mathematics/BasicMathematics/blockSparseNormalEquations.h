@@ -0,0 +1,247 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_BLOCKSPARSENORMALEQUATIONS_H
+#define TUDAT_BLOCKSPARSENORMALEQUATIONS_H
+
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Cholesky>
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Class to accumulate and solve block-structured normal equations of a weighted least squares problem
+/*!
+ * Class to accumulate and solve the normal equations H^T*W*H and H^T*W*y of a weighted least squares problem, for which
+ * the parameters can be split into a number of sets of local parameters (e.g. the initial states of the arcs of a
+ * multi-arc estimation) and a set of global parameters. Each observation may only depend on the parameters of a single
+ * local set (and on any of the global parameters). Consequently, the normal matrix is block-diagonal in the local
+ * parameters, bordered by the coupling to the global parameters:
+ *
+ *      | A_1         B_1 |
+ *      |     ...     ... |
+ *      |         A_k B_k |
+ *      | B_1^T..B_k^T  C |
+ *
+ * Only the blocks A_i, B_i and C are stored, so that the memory use scales linearly with the number of local sets. The
+ * normal equations are solved by first reducing the local parameters (Schur complement of the A_i blocks), solving the
+ * reduced system for the global parameters, and subsequently back-substituting for the local parameters. All
+ * decompositions are (pivoted) Cholesky decompositions, so that the solution time also scales linearly with the number of
+ * local sets.
+ */
+class BlockSparseNormalEquations
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param numberOfParameters Total number of estimated parameters
+     * \param localParameterIndices List of sets of local parameters, each of which is defined by the indices of its
+     * parameters in the full parameter vector. All parameters not in any of the sets are global parameters.
+     */
+    BlockSparseNormalEquations( const int numberOfParameters,
+                                const std::vector< std::vector< int > >& localParameterIndices );
+
+    //! Function to add a block of observations to the normal equations
+    /*!
+     * Function to add a block of observations to the normal equations. The observations in the block may depend on
+     * different sets of local parameters, but each single observation (row) may depend on only one such set (an exception
+     * is thrown otherwise).
+     * \param informationMatrix Matrix containing partial derivatives of observations (rows) w.r.t. all estimated
+     * parameters (columns), for the current block of observations
+     * \param observationResiduals Difference between measured and simulated observations, for the current block
+     * \param diagonalOfWeightMatrix Diagonal of observation weights matrix for the current block (all weights must be
+     * non-negative)
+     */
+    void addObservations( const Eigen::MatrixXd& informationMatrix,
+                          const Eigen::VectorXd& observationResiduals,
+                          const Eigen::VectorXd& diagonalOfWeightMatrix );
+
+    //! Function to add the normal equations accumulated by another object to those of this object.
+    /*!
+     * Function to add the normal equations accumulated by another object (with identical parameter structure) to those
+     * of this object.
+     * \param otherNormalEquations Object containing normal equations that are to be added.
+     */
+    void addNormalEquations( const BlockSparseNormalEquations& otherNormalEquations );
+
+    //! Function to add a (full) matrix to the normal matrix
+    /*!
+     * Function to add a (full) matrix to the normal matrix, for instance the inverse a priori covariance matrix. Entries
+     * of the matrix that couple different sets of local parameters must be zero (an exception is thrown otherwise).
+     * \param matrixToAdd Matrix (size number of parameters x number of parameters) to add to the normal matrix.
+     */
+    void addToNormalMatrix( const Eigen::MatrixXd& matrixToAdd );
+
+    //! Function to reset the normal equations to zero
+    void reset( );
+
+    //! Function to normalize the normal equations
+    /*!
+     * Function to normalize the normal equations, so that they are equal to those that would have been obtained from a
+     * matrix of partials H with its columns divided by their largest absolute value (see getPartialsNormalizationTerms).
+     * \return Values by which the columns of H are divided
+     */
+    Eigen::VectorXd normalize( );
+
+    //! Function to solve the normal equations, using a Schur complement of the local parameters
+    /*!
+     * Function to solve the normal equations, by reducing the local parameters (Schur complement of their blocks), solving
+     * for the global parameters, and back-substituting for the local parameters. If any of the blocks of local parameters
+     * (or the reduced system) is found to be not positive definite, a warning is printed and the full system is solved
+     * with solveSystemOfEquationsWithCholesky (which uses an SVD as fall-back).
+     * \param checkConditionNumber Boolean to denote whether the condition number is checked (warning is printed
+     * when (estimated) value exceeds maximumAllowedConditionNumber)
+     * \param maximumAllowedConditionNumber Maximum value of the condition number that is allowed (warning printed when
+     * exceeded)
+     * \return Solution of the normal equations
+     */
+    Eigen::VectorXd solve( const bool checkConditionNumber = 1,
+                           const double maximumAllowedConditionNumber = 1.0E8 ) const;
+
+    //! Function to retrieve the (full, dense) normal matrix
+    /*!
+     * Function to retrieve the (full, dense) normal matrix. Note that this matrix has a size that scales quadratically with
+     * the number of sets of local parameters.
+     * \return Full normal matrix
+     */
+    Eigen::MatrixXd getNormalMatrix( ) const;
+
+    //! Function to retrieve the (full) right-hand side of the normal equations
+    /*!
+     * Function to retrieve the (full) right-hand side of the normal equations
+     * \return Right-hand side of the normal equations
+     */
+    Eigen::VectorXd getRightHandSide( ) const;
+
+    //! Function to retrieve the number of observations that have been added
+    /*!
+     * Function to retrieve the number of observations that have been added
+     * \return Number of observations that have been added
+     */
+    int getNumberOfObservations( ) const
+    {
+        return numberOfObservations_;
+    }
+
+    //! Function to retrieve the number of sets of local parameters
+    /*!
+     * Function to retrieve the number of sets of local parameters
+     * \return Number of sets of local parameters
+     */
+    int getNumberOfLocalParameterSets( ) const
+    {
+        return localParameterIndices_.size( );
+    }
+
+    //! Function to retrieve the number of global parameters
+    /*!
+     * Function to retrieve the number of global parameters
+     * \return Number of global parameters
+     */
+    int getNumberOfGlobalParameters( ) const
+    {
+        return globalParameterIndices_.size( );
+    }
+
+private:
+
+    //! Function to add observations (rows of H) depending on a single set of local parameters to the normal equations
+    /*!
+     * Function to add observations (rows of H) depending on a single set of local parameters to the normal equations
+     * \param localSetIndex Index of set of local parameters (-1 if observations depend on global parameters only)
+     * \param rowIndices Rows of the input matrix that are to be added
+     * \param informationMatrix Matrix containing partial derivatives of observations w.r.t. all estimated parameters
+     * \param observationResiduals Difference between measured and simulated observations
+     * \param diagonalOfWeightMatrix Diagonal of observation weights matrix
+     */
+    void addObservationsOfLocalParameterSet(
+            const int localSetIndex,
+            const std::vector< int >& rowIndices,
+            const Eigen::MatrixXd& informationMatrix,
+            const Eigen::VectorXd& observationResiduals,
+            const Eigen::VectorXd& diagonalOfWeightMatrix );
+
+    //! Total number of estimated parameters
+    int numberOfParameters_;
+
+    //! Indices in full parameter vector of parameters in each set of local parameters
+    std::vector< std::vector< int > > localParameterIndices_;
+
+    //! Indices in full parameter vector of global parameters
+    std::vector< int > globalParameterIndices_;
+
+    //! Index of set of local parameters to which each parameter belongs (-1 for global parameters)
+    std::vector< int > parameterSetIndices_;
+
+    //! Index of each parameter in its set of local parameters (or in list of global parameters)
+    std::vector< int > indicesInParameterSet_;
+
+    //! Normal matrix blocks of each set of local parameters (A_i; only lower triangular part is updated)
+    std::vector< Eigen::MatrixXd > localNormalMatrices_;
+
+    //! Normal matrix blocks coupling each set of local parameters to global parameters (B_i)
+    std::vector< Eigen::MatrixXd > localGlobalNormalMatrices_;
+
+    //! Normal matrix block of global parameters (C; only lower triangular part is updated)
+    Eigen::MatrixXd globalNormalMatrix_;
+
+    //! Right-hand sides of the normal equations for each set of local parameters
+    std::vector< Eigen::VectorXd > localRightHandSides_;
+
+    //! Right-hand side of the normal equations for the global parameters
+    Eigen::VectorXd globalRightHandSide_;
+
+    //! Minimum value of each column of H
+    Eigen::VectorXd minimumPartials_;
+
+    //! Maximum value of each column of H
+    Eigen::VectorXd maximumPartials_;
+
+    //! Number of observations that have been added
+    int numberOfObservations_;
+};
+
+//! Function to perform an iteration of least squares estimation from block-sparse normal equations and a priori information
+/*!
+ * Function to perform an iteration of least squares estimation from block-sparse normal equations and a priori information
+ * (see BlockSparseNormalEquations). If linear constraints are provided, the full normal equations are formed and solved
+ * with performLeastSquaresAdjustmentFromNormalEquations.
+ * \param normalEquations Block-sparse normal equations H^T*W*H and H^T*W*y (without a priori information)
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix, which may not couple different sets of
+ * local parameters
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \return Pair containing: (first: parameter adjustment, second: (full) inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromBlockSparseNormalEquations(
+        BlockSparseNormalEquations normalEquations,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ) );
+
+} // namespace linear_algebra
+
+} // namespace tudat
+
+#endif // TUDAT_BLOCKSPARSENORMALEQUATIONS_H
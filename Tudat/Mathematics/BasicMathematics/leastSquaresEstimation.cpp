@@ -11,6 +11,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <limits>
 
 #include <Eigen/LU>
 
@@ -93,28 +94,206 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
                 Eigen::MatrixXd::Zero( informationMatrix.cols( ), informationMatrix.cols( ) ) );
 }
 
-//! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
-//! information
-std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
+//! Function to check whether a (pivoted) Cholesky decomposition succeeded, and the decomposed matrix is positive definite
+bool isCholeskyDecompositionPositiveDefinite( const Eigen::LDLT< Eigen::MatrixXd, Eigen::Lower >& choleskyDecomposition )
+{
+    if( choleskyDecomposition.info( ) != Eigen::Success )
+    {
+        return false;
+    }
+    else if( choleskyDecomposition.rows( ) == 0 )
+    {
+        return true;
+    }
+
+    Eigen::VectorXd diagonalOfDecomposition = choleskyDecomposition.vectorD( );
+    return ( diagonalOfDecomposition.minCoeff( ) >
+             diagonalOfDecomposition.maxCoeff( ) * std::numeric_limits< double >::epsilon( ) );
+}
+
+//! Solve symmetric system of equations with (pivoted) Cholesky decomposition, using SVD as fall-back.
+Eigen::VectorXd solveSystemOfEquationsWithCholesky( const Eigen::MatrixXd& matrixToInvert,
+                                                    const Eigen::VectorXd& rightHandSideVector,
+                                                    const bool checkConditionNumber,
+                                                    const double maximumAllowedConditionNumber )
+{
+    Eigen::LDLT< Eigen::MatrixXd, Eigen::Lower > choleskyDecomposition( matrixToInvert );
+
+    // Revert to SVD if decomposition is not usable.
+    if( !isCholeskyDecompositionPositiveDefinite( choleskyDecomposition ) )
+    {
+        std::cerr << "Warning when performing least squares, normal matrix is not positive definite, "
+                  << "solving with SVD" << std::endl;
+        return solveSystemOfEquationsWithSvd(
+                    matrixToInvert.selfadjointView< Eigen::Lower >( ), rightHandSideVector,
+                    checkConditionNumber, maximumAllowedConditionNumber );
+    }
+
+    if( checkConditionNumber )
+    {
+        double conditionNumber = 1.0 / choleskyDecomposition.rcond( );
+
+        if( conditionNumber > maximumAllowedConditionNumber )
+        {
+            std::cerr << "Warning when performing least squares, condition number is (estimated as) "
+                      << conditionNumber << std::endl;
+        }
+    }
+    return choleskyDecomposition.solve( rightHandSideVector );
+}
+
+//! Function to compute the values by which the columns of a matrix of partials are divided to normalize them
+Eigen::VectorXd getPartialsNormalizationTerms( const Eigen::VectorXd& minimumPartials,
+                                               const Eigen::VectorXd& maximumPartials )
+{
+    Eigen::VectorXd normalizationTerms = Eigen::VectorXd( minimumPartials.rows( ) );
+    for( int i = 0; i < normalizationTerms.rows( ); i++ )
+    {
+        if( std::fabs( minimumPartials( i ) ) > maximumPartials( i ) )
+        {
+            normalizationTerms( i ) = minimumPartials( i );
+        }
+        else
+        {
+            normalizationTerms( i ) = maximumPartials( i );
+        }
+
+        if( normalizationTerms( i ) == 0.0 )
+        {
+            normalizationTerms( i ) = 1.0;
+        }
+    }
+    return normalizationTerms;
+}
+
+//! Constructor
+NormalEquationsAccumulator::NormalEquationsAccumulator( const int numberOfParameters ):
+    normalMatrix_( Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) ),
+    rightHandSide_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+    minimumPartials_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+    maximumPartials_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+    numberOfObservations_( 0 ){ }
+
+//! Function to add a block of observations to the normal equations
+void NormalEquationsAccumulator::addObservations(
         const Eigen::MatrixXd& informationMatrix,
         const Eigen::VectorXd& observationResiduals,
-        const Eigen::VectorXd& diagonalOfWeightMatrix,
-        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
-        const bool checkConditionNumber,
-        const double maximumAllowedConditionNumber,
-        const Eigen::MatrixXd& constraintMultiplier,
-        const Eigen::VectorXd& constraintRightHandside )
+        const Eigen::VectorXd& diagonalOfWeightMatrix )
 {
-//    std::cout<<"Residuals "<<observationResiduals.transpose( )<<std::endl;
-//    std::cout<<"Weight diag. "<<diagonalOfWeightMatrix.transpose( )<<std::endl;
-//    std::cout<<"Partials "<<informationMatrix.transpose( )<<std::endl;
+    if( informationMatrix.cols( ) != normalMatrix_.cols( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, number of parameters is inconsistent" );
+    }
 
-    Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) *
-            ( diagonalOfWeightMatrix.cwiseProduct( observationResiduals ) );
-    Eigen::MatrixXd inverseOfCovarianceMatrix = calculateInverseOfUpdatedCovarianceMatrix(
-                informationMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix );
+    if( ( informationMatrix.rows( ) != observationResiduals.rows( ) ) ||
+            ( informationMatrix.rows( ) != diagonalOfWeightMatrix.rows( ) ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, number of observations is inconsistent" );
+    }
 
-    // Add constraints to inverse covariance matrix if required
+    if( informationMatrix.rows( ) == 0 )
+    {
+        return;
+    }
+
+    if( diagonalOfWeightMatrix.minCoeff( ) < 0.0 )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, weights must be non-negative" );
+    }
+
+    // Update normal equations, using the (symmetric) rank update H^T*W*H = ( W^1/2*H )^T*( W^1/2*H )
+    Eigen::MatrixXd weightedInformationMatrix = diagonalOfWeightMatrix.cwiseSqrt( ).asDiagonal( ) * informationMatrix;
+    normalMatrix_.selfadjointView< Eigen::Lower >( ).rankUpdate( weightedInformationMatrix.transpose( ) );
+    rightHandSide_ += informationMatrix.transpose( ) * diagonalOfWeightMatrix.cwiseProduct( observationResiduals );
+
+    // Update extreme values of partials
+    if( numberOfObservations_ == 0 )
+    {
+        minimumPartials_ = informationMatrix.colwise( ).minCoeff( ).transpose( );
+        maximumPartials_ = informationMatrix.colwise( ).maxCoeff( ).transpose( );
+    }
+    else
+    {
+        minimumPartials_ = minimumPartials_.cwiseMin( informationMatrix.colwise( ).minCoeff( ).transpose( ) );
+        maximumPartials_ = maximumPartials_.cwiseMax( informationMatrix.colwise( ).maxCoeff( ).transpose( ) );
+    }
+
+    numberOfObservations_ += informationMatrix.rows( );
+}
+
+//! Function to add the normal equations accumulated by another object to those of this object.
+void NormalEquationsAccumulator::addNormalEquations( const NormalEquationsAccumulator& otherNormalEquations )
+{
+    if( otherNormalEquations.normalMatrix_.cols( ) != normalMatrix_.cols( ) )
+    {
+        throw std::runtime_error( "Error when combining normal equations, number of parameters is inconsistent" );
+    }
+
+    if( otherNormalEquations.numberOfObservations_ == 0 )
+    {
+        return;
+    }
+
+    normalMatrix_.triangularView< Eigen::Lower >( ) += otherNormalEquations.normalMatrix_;
+    rightHandSide_ += otherNormalEquations.rightHandSide_;
+
+    if( numberOfObservations_ == 0 )
+    {
+        minimumPartials_ = otherNormalEquations.minimumPartials_;
+        maximumPartials_ = otherNormalEquations.maximumPartials_;
+    }
+    else
+    {
+        minimumPartials_ = minimumPartials_.cwiseMin( otherNormalEquations.minimumPartials_ );
+        maximumPartials_ = maximumPartials_.cwiseMax( otherNormalEquations.maximumPartials_ );
+    }
+
+    numberOfObservations_ += otherNormalEquations.numberOfObservations_;
+}
+
+//! Function to reset the normal equations to zero
+void NormalEquationsAccumulator::reset( )
+{
+    normalMatrix_.setZero( );
+    rightHandSide_.setZero( );
+    minimumPartials_.setZero( );
+    maximumPartials_.setZero( );
+    numberOfObservations_ = 0;
+}
+
+//! Function to retrieve the (full, symmetric) normal matrix H^T*W*H
+Eigen::MatrixXd NormalEquationsAccumulator::getNormalMatrix( ) const
+{
+    return normalMatrix_.selfadjointView< Eigen::Lower >( );
+}
+
+//! Function to retrieve the values by which the columns of H are to be divided to normalize them
+Eigen::VectorXd NormalEquationsAccumulator::getNormalizationTerms( ) const
+{
+    return getPartialsNormalizationTerms( minimumPartials_, maximumPartials_ );
+}
+
+//! Function to retrieve the normal equations, computed for the normalized matrix of partial derivatives.
+void NormalEquationsAccumulator::getNormalizedNormalEquations(
+        Eigen::MatrixXd& normalizedNormalMatrix,
+        Eigen::VectorXd& normalizedRightHandSide,
+        Eigen::VectorXd& normalizationTerms ) const
+{
+    normalizationTerms = getNormalizationTerms( );
+    Eigen::VectorXd inverseNormalizationTerms = normalizationTerms.cwiseInverse( );
+
+    normalizedNormalMatrix = inverseNormalizationTerms.asDiagonal( ) * getNormalMatrix( ) *
+            inverseNormalizationTerms.asDiagonal( );
+    normalizedRightHandSide = rightHandSide_.cwiseProduct( inverseNormalizationTerms );
+}
+
+//! Function to add linear constraints to the normal equations
+void addLinearConstraintsToNormalEquations(
+        Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        Eigen::VectorXd& rightHandSide,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
     if( constraintMultiplier.rows( ) != 0 )
     {
         if( constraintMultiplier.rows( ) != constraintRightHandside.rows( ) )
@@ -122,7 +301,7 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible" );
         }
 
-        if( constraintMultiplier.cols( ) != informationMatrix.cols( ) )
+        if( constraintMultiplier.cols( ) != inverseOfCovarianceMatrix.cols( ) )
         {
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible with partials" );
         }
@@ -142,6 +321,32 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
         rightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
         rightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
     }
+}
+
+//! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
+//! information
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
+        const Eigen::MatrixXd& informationMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
+//    std::cout<<"Residuals "<<observationResiduals.transpose( )<<std::endl;
+//    std::cout<<"Weight diag. "<<diagonalOfWeightMatrix.transpose( )<<std::endl;
+//    std::cout<<"Partials "<<informationMatrix.transpose( )<<std::endl;
+
+    Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) *
+            ( diagonalOfWeightMatrix.cwiseProduct( observationResiduals ) );
+    Eigen::MatrixXd inverseOfCovarianceMatrix = calculateInverseOfUpdatedCovarianceMatrix(
+                informationMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix );
+
+    // Add constraints to inverse covariance matrix if required
+    addLinearConstraintsToNormalEquations(
+                inverseOfCovarianceMatrix, rightHandSide, constraintMultiplier, constraintRightHandside );
 
 //    std::cout<<"RHS "<<rightHandSide.transpose( )<<std::endl;
 //    std::cout<<"Inv cov "<<inverseOfCovarianceMatrix<<std::endl;
@@ -152,6 +357,37 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
 
 }
 
+//! Function to perform an iteration of least squares estimation from normal equations and a priori information
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::VectorXd& rightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
+    Eigen::MatrixXd inverseOfCovarianceMatrix = normalMatrix + inverseOfAPrioriCovarianceMatrix;
+    Eigen::VectorXd constrainedRightHandSide = rightHandSide;
+
+    // Solve with Cholesky decomposition if system is not constrained, and with SVD otherwise (system is indefinite)
+    Eigen::VectorXd parameterAdjustment;
+    if( constraintMultiplier.rows( ) == 0 )
+    {
+        parameterAdjustment = solveSystemOfEquationsWithCholesky(
+                    inverseOfCovarianceMatrix, constrainedRightHandSide, checkConditionNumber, maximumAllowedConditionNumber );
+    }
+    else
+    {
+        addLinearConstraintsToNormalEquations(
+                    inverseOfCovarianceMatrix, constrainedRightHandSide, constraintMultiplier, constraintRightHandside );
+        parameterAdjustment = solveSystemOfEquationsWithSvd(
+                    inverseOfCovarianceMatrix, constrainedRightHandSide, checkConditionNumber, maximumAllowedConditionNumber );
+    }
+
+    return std::make_pair( parameterAdjustment, inverseOfCovarianceMatrix );
+}
+
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals
 std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
         const Eigen::MatrixXd& informationMatrix,
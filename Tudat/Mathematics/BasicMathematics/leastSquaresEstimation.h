@@ -19,6 +19,7 @@
 
 #include <Eigen/Core>
 #include <Eigen/SVD>
+#include <Eigen/Cholesky>
 
 #include <boost/function.hpp>
 
@@ -169,6 +170,195 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
         const bool checkConditionNumber = 1,
         const double maximumAllowedConditionNumber = 1.0E8 );
 
+//! Function to check whether a (pivoted) Cholesky decomposition succeeded, and the decomposed matrix is positive definite
+/*!
+ * Function to check whether a (pivoted) Cholesky decomposition succeeded, and the decomposed matrix is positive definite,
+ * i.e. whether all entries of the diagonal matrix D of the decomposition are larger than the product of machine precision
+ * and the largest entry of D.
+ * \param choleskyDecomposition Pivoted Cholesky (LDLT) decomposition that is to be checked
+ * \return True if decomposition can be used to solve system of equations
+ */
+bool isCholeskyDecompositionPositiveDefinite( const Eigen::LDLT< Eigen::MatrixXd, Eigen::Lower >& choleskyDecomposition );
+
+//! Solve symmetric system of equations with (pivoted) Cholesky decomposition, using SVD as fall-back.
+/*!
+ * Solve system of equations A*x = b for the vector x, where A is a symmetric (normal equations) matrix, using a pivoted
+ * Cholesky (LDLT) decomposition of A. Only the lower triangular part of A is used. If the decomposition fails, or A is
+ * found to be not positive definite (for instance due to a rank deficiency), a warning is printed, and the system is
+ * solved with an SVD decomposition instead (as in solveSystemOfEquationsWithSvd), including the condition number check.
+ * \param matrixToInvert Symmetric matrix A that is to be inverted to solve the equation
+ * \param rightHandSideVector Vector on the righthandside of the matrix equation that is to be solved
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when (estimated) value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * (warning printed when exceeded)
+ * \return Solution x of matrix equation A*x=b
+ */
+Eigen::VectorXd solveSystemOfEquationsWithCholesky( const Eigen::MatrixXd& matrixToInvert,
+                                                    const Eigen::VectorXd& rightHandSideVector,
+                                                    const bool checkConditionNumber = 1,
+                                                    const double maximumAllowedConditionNumber = 1.0E8 );
+
+//! Function to compute the values by which the columns of a matrix of partials are divided to normalize them
+/*!
+ * Function to compute the values by which the columns of a matrix of partials are divided to normalize them to the range
+ * [-1,1], from the minimum and maximum value of each column. For each column, this is the entry with the largest absolute
+ * value (with its sign, or 1 if the column is zero).
+ * \param minimumPartials Minimum value of each column of the matrix of partials
+ * \param maximumPartials Maximum value of each column of the matrix of partials
+ * \return Values by which the columns of the matrix of partials are to be divided to normalize them
+ */
+Eigen::VectorXd getPartialsNormalizationTerms( const Eigen::VectorXd& minimumPartials,
+                                               const Eigen::VectorXd& maximumPartials );
+
+//! Class to incrementally accumulate the normal equations of a weighted least squares problem
+/*!
+ * Class to incrementally accumulate the normal equations H^T*W*H and H^T*W*y of a weighted least squares problem, where
+ * H is the matrix of partial derivatives of the observations w.r.t. the estimated parameters, W the (diagonal) weights
+ * matrix and y the vector of observation residuals. Blocks of observations are added one at a time, so that the full matrix
+ * H never needs to be stored. In addition to the normal equations, the largest (in absolute sense) value of each column of
+ * H is tracked, so that the normal equations can be normalized in the same manner as would be done for the full matrix H.
+ */
+class NormalEquationsAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param numberOfParameters Number of estimated parameters (columns of the matrix of partial derivatives)
+     */
+    NormalEquationsAccumulator( const int numberOfParameters );
+
+    //! Function to add a block of observations to the normal equations
+    /*!
+     * Function to add a block of observations to the normal equations, updating H^T*W*H and H^T*W*y
+     * \param informationMatrix Matrix containing partial derivatives of observations (rows) w.r.t. estimated parameters
+     * (columns), for the current block of observations
+     * \param observationResiduals Difference between measured and simulated observations, for the current block
+     * \param diagonalOfWeightMatrix Diagonal of observation weights matrix for the current block (all weights must be
+     * non-negative)
+     */
+    void addObservations( const Eigen::MatrixXd& informationMatrix,
+                          const Eigen::VectorXd& observationResiduals,
+                          const Eigen::VectorXd& diagonalOfWeightMatrix );
+
+    //! Function to add the normal equations accumulated by another object to those of this object.
+    /*!
+     * Function to add the normal equations accumulated by another object to those of this object (e.g. to combine
+     * results accumulated independently for different sets of observations).
+     * \param otherNormalEquations Object containing normal equations that are to be added.
+     */
+    void addNormalEquations( const NormalEquationsAccumulator& otherNormalEquations );
+
+    //! Function to reset the normal equations to zero
+    void reset( );
+
+    //! Function to retrieve the (full, symmetric) normal matrix H^T*W*H
+    /*!
+     * Function to retrieve the (full, symmetric) normal matrix H^T*W*H
+     * \return Normal matrix H^T*W*H
+     */
+    Eigen::MatrixXd getNormalMatrix( ) const;
+
+    //! Function to retrieve the right-hand side of the normal equations H^T*W*y
+    /*!
+     * Function to retrieve the right-hand side of the normal equations H^T*W*y
+     * \return Right-hand side of the normal equations H^T*W*y
+     */
+    Eigen::VectorXd getRightHandSide( ) const
+    {
+        return rightHandSide_;
+    }
+
+    //! Function to retrieve the number of observations that have been added
+    /*!
+     * Function to retrieve the number of observations that have been added
+     * \return Number of observations that have been added
+     */
+    int getNumberOfObservations( ) const
+    {
+        return numberOfObservations_;
+    }
+
+    //! Function to retrieve the values by which the columns of H are to be divided to normalize them
+    /*!
+     * Function to retrieve the values by which the columns of H are to be divided to normalize them to the range [-1,1].
+     * For each column, this is the entry with the largest absolute value (with its sign, or 1 if column is zero).
+     * \return Values by which the columns of H are to be divided to normalize them
+     */
+    Eigen::VectorXd getNormalizationTerms( ) const;
+
+    //! Function to retrieve the normal equations, computed for the normalized matrix of partial derivatives.
+    /*!
+     * Function to retrieve the normal equations, computed for the normalized matrix of partial derivatives (with columns
+     * of H divided by the output of getNormalizationTerms).
+     * \param normalizedNormalMatrix Normal matrix of normalized partials (returned by reference)
+     * \param normalizedRightHandSide Right-hand side of normal equations of normalized partials (returned by reference)
+     * \param normalizationTerms Values by which the columns of H are divided (returned by reference)
+     */
+    void getNormalizedNormalEquations( Eigen::MatrixXd& normalizedNormalMatrix,
+                                       Eigen::VectorXd& normalizedRightHandSide,
+                                       Eigen::VectorXd& normalizationTerms ) const;
+
+private:
+
+    //! Normal matrix H^T*W*H (only lower triangular part is updated)
+    Eigen::MatrixXd normalMatrix_;
+
+    //! Right-hand side of the normal equations H^T*W*y
+    Eigen::VectorXd rightHandSide_;
+
+    //! Minimum value of each column of H
+    Eigen::VectorXd minimumPartials_;
+
+    //! Maximum value of each column of H
+    Eigen::VectorXd maximumPartials_;
+
+    //! Number of observations that have been added
+    int numberOfObservations_;
+};
+
+//! Function to add linear constraints to the normal equations
+/*!
+ * Function to add linear constraints C*x = d to the normal equations, by appending them as Lagrange multiplier rows and
+ * columns to the inverse covariance matrix and right-hand side (both modified by this function).
+ * \param inverseOfCovarianceMatrix Inverse covariance matrix (normal matrix), to which constraints are to be added
+ * \param rightHandSide Right-hand side of normal equations, to which constraints are to be added
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint (C)
+ * \param constraintRightHandside Right-hand side estimation linear constraint (d)
+ */
+void addLinearConstraintsToNormalEquations(
+        Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        Eigen::VectorXd& rightHandSide,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside );
+
+//! Function to perform an iteration of least squares estimation from normal equations and a priori information
+/*!
+ * Function to perform an iteration of least squares estimation from (accumulated) normal equations and a priori information,
+ * as is typically done in orbit determination. In contrast to performLeastSquaresAdjustmentFromInformationMatrix, the
+ * system is solved with a (pivoted) Cholesky decomposition (see solveSystemOfEquationsWithCholesky), with SVD only used as
+ * fall-back. If linear constraints are provided, the resulting system is indefinite, and it is solved with SVD.
+ * \param normalMatrix Normal matrix H^T*W*H
+ * \param rightHandSide Right-hand side of the normal equations H^T*W*y
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::VectorXd& rightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ) );
+
 //! Function to fit a univariate polynomial through a set of data
 /*!
  *  Function to fit a univariate polynomial through a set of data. User must provide independent variables and observations
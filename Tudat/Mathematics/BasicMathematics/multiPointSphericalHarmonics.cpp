@@ -0,0 +1,224 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+#include "Tudat/Mathematics/BasicMathematics/multiPointSphericalHarmonics.h"
+
+namespace tudat
+{
+namespace basic_mathematics
+{
+
+//! Update maximum degree and order of cache
+void MultiPointSphericalHarmonicsCache::resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder )
+{
+    maximumDegree_ = maximumDegree;
+    maximumOrder_ = maximumOrder;
+
+    if( maximumOrder_ > maximumDegree_ )
+    {
+        maximumOrder_ = maximumDegree_;
+    }
+
+    // Recursion coefficients are needed up to one order beyond the maximum order, for the derivatives.
+    const int numberOfCoefficients = ( maximumDegree_ + 1 ) * ( maximumOrder_ + 2 );
+    sectoralRecursionCoefficients_.assign( maximumDegree_ + 1, 0.0 );
+    firstVerticalRecursionCoefficients_.assign( numberOfCoefficients, 0.0 );
+    secondVerticalRecursionCoefficients_.assign( numberOfCoefficients, 0.0 );
+    derivativeNormalizations_.assign( numberOfCoefficients, 0.0 );
+
+    for( int i = 2; i <= maximumDegree_; i++ )
+    {
+        sectoralRecursionCoefficients_[ i ] = std::sqrt(
+                    ( 2.0 * static_cast< double >( i ) + 1.0 ) / ( 6.0 * static_cast< double >( i ) ) );
+    }
+
+    for( int i = 0; i <= maximumDegree_; i++ )
+    {
+        for( int j = 0; ( j <= i ) && ( j <= maximumOrder_ + 1 ); j++ )
+        {
+            const double degree = static_cast< double >( i );
+            const double order = static_cast< double >( j );
+
+            // Compute coefficients of geodesy-normalized vertical recursion (see computeGeodesyLegendrePolynomialVertical)
+            if( i > j )
+            {
+                const double commonFactor = std::sqrt( ( 2.0 * degree + 1.0 ) / ( ( degree + order ) * ( degree - order ) ) );
+                firstVerticalRecursionCoefficients_[ getCoefficientIndex( i, j ) ] =
+                        commonFactor * std::sqrt( 2.0 * degree - 1.0 );
+                if( i > j + 1 )
+                {
+                    secondVerticalRecursionCoefficients_[ getCoefficientIndex( i, j ) ] =
+                            commonFactor * std::sqrt( ( degree + order - 1.0 ) * ( degree - order - 1.0 ) /
+                                                      ( 2.0 * degree - 3.0 ) );
+                }
+            }
+
+            // Compute normalization correction factor for derivative.
+            derivativeNormalizations_[ getCoefficientIndex( i, j ) ] = std::sqrt(
+                        ( degree + order + 1.0 ) * ( degree - order ) );
+            if( j == 0 )
+            {
+                derivativeNormalizations_[ getCoefficientIndex( i, j ) ] *= std::sqrt( 0.5 );
+            }
+        }
+    }
+
+    numberOfPoints_ = 0;
+    currentOrder_ = -1;
+}
+
+//! Update cached variables to new block of points.
+void MultiPointSphericalHarmonicsCache::update( const Eigen::ArrayXd& radii,
+                                                const Eigen::ArrayXd& polynomialParameters,
+                                                const Eigen::ArrayXd& longitudes,
+                                                const double referenceRadius )
+{
+    if( polynomialParameters.rows( ) != radii.rows( ) || longitudes.rows( ) != radii.rows( ) )
+    {
+        std::stringstream errorMessage;
+        errorMessage << "Error when updating multi-point spherical harmonics cache, input sizes are inconsistent: "
+                     << radii.rows( ) << ", " << polynomialParameters.rows( ) << ", " << longitudes.rows( ) << std::endl;
+        throw std::runtime_error( errorMessage.str( ) );
+    }
+
+    numberOfPoints_ = static_cast< int >( radii.rows( ) );
+
+    // Set trigonometric functions of latitude.
+    polynomialParameters_ = polynomialParameters;
+    cosinesOfLatitude_ = ( 1.0 - polynomialParameters_.square( ) ).sqrt( );
+    inverseCosinesOfLatitude_ = cosinesOfLatitude_.inverse( );
+    tangentsOverCosinesOfLatitude_ = polynomialParameters_ * inverseCosinesOfLatitude_.square( );
+
+    // Set sines and cosines of multiples of longitude, using angle-addition recursion.
+    sinesOfLongitude_.resize( numberOfPoints_, maximumOrder_ + 1 );
+    cosinesOfLongitude_.resize( numberOfPoints_, maximumOrder_ + 1 );
+    sinesOfLongitude_.col( 0 ).setZero( );
+    cosinesOfLongitude_.col( 0 ).setOnes( );
+    if( maximumOrder_ > 0 )
+    {
+        sinesOfLongitude_.col( 1 ) = longitudes.sin( );
+        cosinesOfLongitude_.col( 1 ) = longitudes.cos( );
+    }
+    for( int i = 2; i <= maximumOrder_; i++ )
+    {
+        sinesOfLongitude_.col( i ) = sinesOfLongitude_.col( i - 1 ) * cosinesOfLongitude_.col( 1 ) +
+                cosinesOfLongitude_.col( i - 1 ) * sinesOfLongitude_.col( 1 );
+        cosinesOfLongitude_.col( i ) = cosinesOfLongitude_.col( i - 1 ) * cosinesOfLongitude_.col( 1 ) -
+                sinesOfLongitude_.col( i - 1 ) * sinesOfLongitude_.col( 1 );
+    }
+
+    // Set powers of reference radius over distance.
+    referenceRadiusRatioPowers_.resize( numberOfPoints_, maximumDegree_ + 2 );
+    referenceRadiusRatioPowers_.col( 0 ).setOnes( );
+    referenceRadiusRatioPowers_.col( 1 ) = referenceRadius / radii;
+    for( int i = 2; i <= maximumDegree_ + 1; i++ )
+    {
+        referenceRadiusRatioPowers_.col( i ) =
+                referenceRadiusRatioPowers_.col( i - 1 ) * referenceRadiusRatioPowers_.col( 1 );
+    }
+
+    // Compute Legendre polynomials of order 0 and 1, and derivatives of order 0.
+    currentLegendrePolynomials_.resize( numberOfPoints_, maximumDegree_ + 1 );
+    nextLegendrePolynomials_.resize( numberOfPoints_, maximumDegree_ + 1 );
+    currentLegendrePolynomialDerivatives_.resize( numberOfPoints_, maximumDegree_ + 1 );
+
+    currentOrder_ = 0;
+    computeLegendrePolynomialsOfOrder( 0, nextLegendrePolynomials_, currentLegendrePolynomials_ );
+    computeLegendrePolynomialsOfOrder( 1, currentLegendrePolynomials_, nextLegendrePolynomials_ );
+    computeCurrentLegendrePolynomialDerivatives( );
+}
+
+//! Function to compute the Legendre polynomials (and derivatives) of the next order.
+void MultiPointSphericalHarmonicsCache::incrementOrder( )
+{
+    if( currentOrder_ < 0 || currentOrder_ >= maximumOrder_ )
+    {
+        std::stringstream errorMessage;
+        errorMessage << "Error when incrementing order of multi-point spherical harmonics cache, current order is "
+                     << currentOrder_ << ", maximum order is " << maximumOrder_ << std::endl;
+        throw std::runtime_error( errorMessage.str( ) );
+    }
+
+    currentOrder_++;
+    currentLegendrePolynomials_.swap( nextLegendrePolynomials_ );
+    computeLegendrePolynomialsOfOrder( currentOrder_ + 1, currentLegendrePolynomials_, nextLegendrePolynomials_ );
+    computeCurrentLegendrePolynomialDerivatives( );
+}
+
+//! Function to compute the Legendre polynomials of a single order, for all degrees and all points in block.
+void MultiPointSphericalHarmonicsCache::computeLegendrePolynomialsOfOrder(
+        const int order,
+        const Eigen::ArrayXXd& previousOrderPolynomials,
+        Eigen::ArrayXXd& legendrePolynomials )
+{
+    if( order > maximumDegree_ )
+    {
+        legendrePolynomials.setZero( );
+        return;
+    }
+
+    // Compute sectoral term, explicitly for degree and order <= 1.
+    if( order == 0 )
+    {
+        legendrePolynomials.col( 0 ).setOnes( );
+    }
+    else
+    {
+        legendrePolynomials.col( order - 1 ).setZero( );
+        if( order == 1 )
+        {
+            legendrePolynomials.col( 1 ) = std::sqrt( 3.0 ) * cosinesOfLatitude_;
+        }
+        else
+        {
+            legendrePolynomials.col( order ) = ( sectoralRecursionCoefficients_[ order ] * std::sqrt( 3.0 ) ) *
+                    cosinesOfLatitude_ * previousOrderPolynomials.col( order - 1 );
+        }
+    }
+
+    // Compute zonal/tesseral terms through vertical recursion.
+    if( order + 1 <= maximumDegree_ )
+    {
+        legendrePolynomials.col( order + 1 ) =
+                firstVerticalRecursionCoefficients_[ getCoefficientIndex( order + 1, order ) ] *
+                polynomialParameters_ * legendrePolynomials.col( order );
+    }
+    for( int i = order + 2; i <= maximumDegree_; i++ )
+    {
+        legendrePolynomials.col( i ) =
+                firstVerticalRecursionCoefficients_[ getCoefficientIndex( i, order ) ] *
+                polynomialParameters_ * legendrePolynomials.col( i - 1 ) -
+                secondVerticalRecursionCoefficients_[ getCoefficientIndex( i, order ) ] *
+                legendrePolynomials.col( i - 2 );
+    }
+}
+
+//! Function to compute the Legendre polynomial derivatives of current order.
+void MultiPointSphericalHarmonicsCache::computeCurrentLegendrePolynomialDerivatives( )
+{
+    // Compute derivatives (see computeGeodesyLegendrePolynomialDerivative); polynomials of next order are zero for
+    // degree equal to current order.
+    const double order = static_cast< double >( currentOrder_ );
+    for( int i = currentOrder_; i <= maximumDegree_; i++ )
+    {
+        currentLegendrePolynomialDerivatives_.col( i ) =
+                derivativeNormalizations_[ getCoefficientIndex( i, currentOrder_ ) ] *
+                nextLegendrePolynomials_.col( i ) * inverseCosinesOfLatitude_ -
+                order * tangentsOverCosinesOfLatitude_ * currentLegendrePolynomials_.col( i );
+    }
+}
+
+} // namespace basic_mathematics
+} // namespace tudat
@@ -0,0 +1,281 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      The recursions in this file are identical to those used by the LegendreCache and
+ *      SphericalHarmonicsCache classes (geodesy-normalized sectoral and vertical recursions), but
+ *      are evaluated for a block of points at once. All per-point quantities are stored in
+ *      column-major Eigen arrays with the point index running fastest, so that each step of the
+ *      recursion is a single contiguous array expression that Eigen evaluates using packet (SIMD)
+ *      instructions (SSE2/AVX/AVX-512, depending on the compiler flags used for the build).
+ *
+ */
+
+#ifndef TUDAT_MULTI_POINT_SPHERICAL_HARMONICS_H
+#define TUDAT_MULTI_POINT_SPHERICAL_HARMONICS_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+namespace basic_mathematics
+{
+
+//! Cache object for evaluating geodesy-normalized spherical harmonic terms at a block of points simultaneously.
+/*!
+ *  Cache object for evaluating geodesy-normalized spherical harmonic terms at a block of points simultaneously. The
+ *  object stores, for each point in the block, the cosine of the latitude, the sine and cosine of the order times the
+ *  longitude and the ratio of the reference radius and the distance to the power degree (+1). The geodesy-normalized
+ *  associated Legendre polynomials (and their derivatives w.r.t. the sine of the latitude) are computed order by order:
+ *  after a call to update, the polynomials of order 0 are available, and each call to incrementOrder makes the
+ *  polynomials of the next order available. This limits the memory footprint to a few columns of length
+ *  (maximum degree + 1) per point, independently of the maximum order, which keeps the working set in cache for high
+ *  degree and order fields. All recursion coefficients are computed once, when the maximum degree and order are set.
+ */
+class MultiPointSphericalHarmonicsCache
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumDegree Maximum degree to which to update cache
+     * \param maximumOrder Maximum order to which to update cache
+     */
+    MultiPointSphericalHarmonicsCache( const int maximumDegree = 0, const int maximumOrder = 0 )
+    {
+        resetMaximumDegreeAndOrder( maximumDegree, maximumOrder );
+    }
+
+    //! Update maximum degree and order of cache
+    /*!
+     * Update maximum degree and order of cache, and recompute the coefficients of the Legendre polynomial recursions.
+     * \param maximumDegree Maximum degree to which to update cache
+     * \param maximumOrder Maximum order to which to update cache
+     */
+    void resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder );
+
+    //! Update cached variables to new block of points.
+    /*!
+     * Update cached variables to new block of points, and compute the Legendre polynomials (and derivatives) of order 0.
+     * All input arrays must be of equal size, which defines the number of points in the block.
+     * \param radii Distances of points from origin
+     * \param polynomialParameters Input parameters to Legendre polynomials (sines of latitude) of points
+     * \param longitudes Longitudes of points
+     * \param referenceRadius Reference (typically equatorial) radius of gravity field.
+     */
+    void update( const Eigen::ArrayXd& radii,
+                 const Eigen::ArrayXd& polynomialParameters,
+                 const Eigen::ArrayXd& longitudes,
+                 const double referenceRadius );
+
+    //! Function to compute the Legendre polynomials (and derivatives) of the next order.
+    /*!
+     * Function to compute the Legendre polynomials (and derivatives) of the next order, using the sectoral and vertical
+     * recursions for all points in the current block.
+     */
+    void incrementOrder( );
+
+    //! Function to get the maximum degree of cache.
+    /*!
+     * Function to get the maximum degree of cache
+     * \return Maximum degree of cache.
+     */
+    int getMaximumDegree( )
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to get the maximum order of cache.
+    /*!
+     * Function to get the maximum order of cache.
+     * \return Maximum order of cache.
+     */
+    int getMaximumOrder( )
+    {
+        return maximumOrder_;
+    }
+
+    //! Function to get the number of points in the current block.
+    /*!
+     * Function to get the number of points in the current block.
+     * \return Number of points in the current block.
+     */
+    int getNumberOfPoints( )
+    {
+        return numberOfPoints_;
+    }
+
+    //! Function to get the order for which the Legendre polynomials are currently available.
+    /*!
+     * Function to get the order for which the Legendre polynomials are currently available.
+     * \return Order for which the Legendre polynomials are currently available.
+     */
+    int getCurrentOrder( )
+    {
+        return currentOrder_;
+    }
+
+    //! Function to retrieve the Legendre polynomials of current order at given degree, for all points in block.
+    /*!
+     * Function to retrieve the Legendre polynomials of current order at given degree, for all points in block.
+     * \param degree Degree of polynomials that are to be retrieved (must be >= current order).
+     * \return Legendre polynomials of current order at given degree, for all points in block.
+     */
+    Eigen::ArrayXXd::ConstColXpr getLegendrePolynomials( const int degree ) const
+    {
+        return currentLegendrePolynomials_.col( degree );
+    }
+
+    //! Function to retrieve the Legendre polynomial derivatives of current order at given degree, for all points.
+    /*!
+     * Function to retrieve the Legendre polynomial derivatives (w.r.t. polynomial parameter) of current order at given
+     * degree, for all points in block.
+     * \param degree Degree of polynomial derivatives that are to be retrieved (must be >= current order).
+     * \return Legendre polynomial derivatives of current order at given degree, for all points in block.
+     */
+    Eigen::ArrayXXd::ConstColXpr getLegendrePolynomialDerivatives( const int degree ) const
+    {
+        return currentLegendrePolynomialDerivatives_.col( degree );
+    }
+
+    //! Function to retrieve the sines of m times the longitude, for all points in block.
+    /*!
+     * Function to retrieve the sines of m times the longitude, for all points in block.
+     * \param order Order as input to sine( order * longitude )
+     * \return Sine( order * longitude ), for all points in block.
+     */
+    Eigen::ArrayXXd::ConstColXpr getSinesOfMultipleLongitude( const int order ) const
+    {
+        return sinesOfLongitude_.col( order );
+    }
+
+    //! Function to retrieve the cosines of m times the longitude, for all points in block.
+    /*!
+     * Function to retrieve the cosines of m times the longitude, for all points in block.
+     * \param order Order as input to cosine( order * longitude )
+     * \return Cosine( order * longitude ), for all points in block.
+     */
+    Eigen::ArrayXXd::ConstColXpr getCosinesOfMultipleLongitude( const int order ) const
+    {
+        return cosinesOfLongitude_.col( order );
+    }
+
+    //! Function to get an integer power of the reference radius divided by the distance, for all points in block.
+    /*!
+     * Function to get an integer power of the reference radius divided by the distance, for all points in block.
+     * \param degreePlusOne Power to which the ratio of reference radius and distance is to be computed (typically
+     * degree + 1).
+     * \return Ratio of reference radius and distance to power of input argument, for all points in block.
+     */
+    Eigen::ArrayXXd::ConstColXpr getReferenceRadiusRatioPowers( const int degreePlusOne ) const
+    {
+        return referenceRadiusRatioPowers_.col( degreePlusOne );
+    }
+
+    //! Function to retrieve the cosines of the latitude, for all points in block.
+    /*!
+     * Function to retrieve the cosines of the latitude (complement of polynomial parameter), for all points in block.
+     * \return Cosines of the latitude, for all points in block.
+     */
+    const Eigen::ArrayXd& getCosinesOfLatitude( ) const
+    {
+        return cosinesOfLatitude_;
+    }
+
+private:
+
+    //! Function to compute the Legendre polynomials of a single order, for all degrees and all points in block.
+    /*!
+     * Function to compute the Legendre polynomials of a single order, for all degrees and all points in block.
+     * \param order Order of polynomials that are to be computed.
+     * \param previousOrderPolynomials Legendre polynomials of order - 1 (not used if order is 0).
+     * \param legendrePolynomials Legendre polynomials of requested order (returned by reference). Entries of degree
+     * order - 1 are set to zero, entries of lower degree are not modified.
+     */
+    void computeLegendrePolynomialsOfOrder( const int order,
+                                            const Eigen::ArrayXXd& previousOrderPolynomials,
+                                            Eigen::ArrayXXd& legendrePolynomials );
+
+    //! Function to compute the Legendre polynomial derivatives of current order.
+    void computeCurrentLegendrePolynomialDerivatives( );
+
+    //! Function to get the index in the (flattened) lists of recursion coefficients.
+    /*!
+     * Function to get the index in the (flattened) lists of recursion coefficients.
+     * \param degree Degree of term
+     * \param order Order of term
+     * \return Index in lists of recursion coefficients
+     */
+    int getCoefficientIndex( const int degree, const int order ) const
+    {
+        return degree * ( maximumOrder_ + 2 ) + order;
+    }
+
+    //! Maximum degree of cache.
+    int maximumDegree_;
+
+    //! Maximum order of cache.
+    int maximumOrder_;
+
+    //! Number of points in current block.
+    int numberOfPoints_;
+
+    //! Order for which Legendre polynomials are currently available.
+    int currentOrder_;
+
+    //! Coefficients of sectoral Legendre polynomial recursion (one per degree).
+    std::vector< double > sectoralRecursionCoefficients_;
+
+    //! Coefficients multiplying the one degree prior polynomial in vertical Legendre polynomial recursion.
+    std::vector< double > firstVerticalRecursionCoefficients_;
+
+    //! Coefficients multiplying the two degrees prior polynomial in vertical Legendre polynomial recursion.
+    std::vector< double > secondVerticalRecursionCoefficients_;
+
+    //! Normalization corrections for Legendre polynomial derivatives.
+    std::vector< double > derivativeNormalizations_;
+
+    //! Current polynomial parameters (sines of latitude) of points in block.
+    Eigen::ArrayXd polynomialParameters_;
+
+    //! Current cosines of latitude of points in block.
+    Eigen::ArrayXd cosinesOfLatitude_;
+
+    //! Current inverse of cosines of latitude of points in block.
+    Eigen::ArrayXd inverseCosinesOfLatitude_;
+
+    //! Current sines of latitude divided by squared cosines of latitude of points in block.
+    Eigen::ArrayXd tangentsOverCosinesOfLatitude_;
+
+    //! Legendre polynomials of current order (point index as row, degree as column).
+    Eigen::ArrayXXd currentLegendrePolynomials_;
+
+    //! Legendre polynomials of next order (point index as row, degree as column).
+    Eigen::ArrayXXd nextLegendrePolynomials_;
+
+    //! Legendre polynomial derivatives of current order (point index as row, degree as column).
+    Eigen::ArrayXXd currentLegendrePolynomialDerivatives_;
+
+    //! Sines of order times longitude (point index as row, order as column).
+    Eigen::ArrayXXd sinesOfLongitude_;
+
+    //! Cosines of order times longitude (point index as row, order as column).
+    Eigen::ArrayXXd cosinesOfLongitude_;
+
+    //! Powers of reference radius over distance (point index as row, power as column).
+    Eigen::ArrayXXd referenceRadiusRatioPowers_;
+};
+
+} // namespace basic_mathematics
+} // namespace tudat
+
+#endif // TUDAT_MULTI_POINT_SPHERICAL_HARMONICS_H
@@ -0,0 +1,227 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Press W.H., et al. Numerical Recipes in C++: The Art of Scientific Computing. Cambridge
+ *          University Press, February 2002.
+ *      Martins, J.R.R.A., Sturdza, P., Alonso, J.J., "The Complex-Step Derivative Approximation",
+ *          ACM Transactions on Mathematical Software, September 2003.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Mathematics/BasicMathematics/numericalJacobian.h"
+
+namespace tudat
+{
+
+namespace numerical_derivatives
+{
+
+//! Function to compute the perturbation step sizes for a numerical Jacobian.
+Eigen::VectorXd getNumericalJacobianStepSizes(
+        const Eigen::VectorXd& input,
+        const NumericalJacobianSettings& jacobianSettings,
+        const bool isComplexStep )
+{
+    Eigen::VectorXd stepSizes = Eigen::VectorXd::Zero( input.rows( ) );
+
+    switch( jacobianSettings.stepSizeType_ )
+    {
+    case absolute_jacobian_step_size:
+    {
+        if( jacobianSettings.absoluteStepSizes_.rows( ) == 1 )
+        {
+            stepSizes.setConstant( jacobianSettings.absoluteStepSizes_( 0 ) );
+        }
+        else if( jacobianSettings.absoluteStepSizes_.rows( ) == input.rows( ) )
+        {
+            stepSizes = jacobianSettings.absoluteStepSizes_;
+        }
+        else
+        {
+            throw std::runtime_error(
+                        "Error when computing numerical Jacobian step sizes, number of absolute step sizes (" +
+                        std::to_string( jacobianSettings.absoluteStepSizes_.rows( ) ) +
+                        ") is incompatible with input size (" + std::to_string( input.rows( ) ) + ")" );
+        }
+        break;
+    }
+    case relative_jacobian_step_size:
+    {
+        for( int i = 0; i < input.rows( ); i++ )
+        {
+            stepSizes( i ) = std::max( jacobianSettings.minimumStepSize_,
+                                       std::fabs( jacobianSettings.relativeStepSize_ * input( i ) ) );
+        }
+        break;
+    }
+    case optimal_jacobian_step_size:
+    {
+        // Balance truncation error (O(h^order)) and round-off error (O(eps/h)); complex-step has no round-off error.
+        const double optimalRelativeStepSize = isComplexStep ? 1.0E-20 :
+            std::pow( std::numeric_limits< double >::epsilon( ),
+                      1.0 / ( static_cast< double >( jacobianSettings.order_ ) + 1.0 ) );
+        for( int i = 0; i < input.rows( ); i++ )
+        {
+            stepSizes( i ) = optimalRelativeStepSize * std::max( std::fabs( input( i ) ), 1.0 );
+        }
+        break;
+    }
+    default:
+        throw std::runtime_error( "Error when computing numerical Jacobian step sizes, step size type " +
+                                  std::to_string( jacobianSettings.stepSizeType_ ) + " not recognized" );
+    }
+
+    for( int i = 0; i < input.rows( ); i++ )
+    {
+        if( !( stepSizes( i ) > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when computing numerical Jacobian step sizes, step size " +
+                                      std::to_string( i ) + " is not positive" );
+        }
+
+        // Ensure that perturbed input is exactly representable, see (Press W.H., et al., 2002).
+        if( !isComplexStep )
+        {
+            const volatile double temporaryVariable = input( i ) + stepSizes( i );
+            stepSizes( i ) = temporaryVariable - input( i );
+        }
+    }
+
+    return stepSizes;
+}
+
+//! Function to compute the columns of a Jacobian concurrently, using a separate function object for each thread
+template< typename FunctionType >
+Eigen::MatrixXd computeJacobianColumnsConcurrently(
+        const int numberOfColumns,
+        const std::function< FunctionType( ) >& functionCreator,
+        const std::function< Eigen::VectorXd( const int, const FunctionType& ) >& columnFunction,
+        const unsigned int numberOfThreads )
+{
+    // Function objects are created by the thread that uses them, and each entry is accessed by a single thread only.
+    std::vector< FunctionType > threadFunctions( std::max( numberOfThreads, 1u ) );
+    std::vector< Eigen::VectorXd > jacobianColumns( numberOfColumns );
+
+    utilities::executeParallelTasksWithThreadIndex(
+                numberOfColumns, [ & ]( const int columnIndex, const unsigned int threadIndex )
+    {
+        if( !threadFunctions[ threadIndex ] )
+        {
+            threadFunctions[ threadIndex ] = functionCreator( );
+        }
+        jacobianColumns[ columnIndex ] = columnFunction( columnIndex, threadFunctions[ threadIndex ] );
+    }, numberOfThreads );
+
+    // Assemble Jacobian from its columns.
+    Eigen::MatrixXd jacobian;
+    for( int i = 0; i < numberOfColumns; i++ )
+    {
+        if( i == 0 )
+        {
+            jacobian.resize( jacobianColumns.at( 0 ).rows( ), numberOfColumns );
+        }
+        else if( jacobianColumns.at( i ).rows( ) != jacobian.rows( ) )
+        {
+            throw std::runtime_error( "Error when computing numerical Jacobian, function output size is not constant" );
+        }
+        jacobian.col( i ) = jacobianColumns.at( i );
+    }
+    return jacobian;
+}
+
+//! Function to compute a Jacobian using a central difference method, distributing the columns over a number of threads.
+Eigen::MatrixXd computeCentralDifferenceJacobian(
+        const Eigen::VectorXd& input,
+        const std::function< std::function< Eigen::VectorXd( const Eigen::VectorXd& ) >( ) >& functionCreator,
+        const NumericalJacobianSettings& jacobianSettings )
+{
+    typedef std::function< Eigen::VectorXd( const Eigen::VectorXd& ) > JacobianFunction;
+
+    const std::map< int, double >& coefficients = getCentralDifferenceCoefficients( jacobianSettings.order_ );
+    const Eigen::VectorXd stepSizes = getNumericalJacobianStepSizes( input, jacobianSettings, false );
+
+    return computeJacobianColumnsConcurrently< JacobianFunction >(
+                input.rows( ), functionCreator,
+                [ & ]( const int columnIndex, const JacobianFunction& function )
+    {
+        Eigen::VectorXd perturbedInput = input;
+        Eigen::VectorXd jacobianColumn;
+        for( std::map< int, double >::const_iterator coefficientIterator = coefficients.begin( );
+             coefficientIterator != coefficients.end( ); coefficientIterator++ )
+        {
+            perturbedInput( columnIndex ) = input( columnIndex ) + coefficientIterator->first * stepSizes( columnIndex );
+            if( coefficientIterator == coefficients.begin( ) )
+            {
+                jacobianColumn = function( perturbedInput ) * ( coefficientIterator->second / stepSizes( columnIndex ) );
+            }
+            else
+            {
+                jacobianColumn += function( perturbedInput ) * ( coefficientIterator->second / stepSizes( columnIndex ) );
+            }
+        }
+        return jacobianColumn;
+    }, jacobianSettings.numberOfThreads_ );
+}
+
+//! Function to compute a Jacobian using a central difference method, evaluating a single function sequentially.
+Eigen::MatrixXd computeCentralDifferenceJacobian(
+        const Eigen::VectorXd& input,
+        const std::function< Eigen::VectorXd( const Eigen::VectorXd& ) >& function,
+        const NumericalJacobianSettings& jacobianSettings )
+{
+    NumericalJacobianSettings sequentialSettings = jacobianSettings;
+    sequentialSettings.numberOfThreads_ = 1;
+    return computeCentralDifferenceJacobian(
+                input, [ & ]( ){ return function; }, sequentialSettings );
+}
+
+//! Function to compute a Jacobian using the complex-step method, distributing the columns over a number of threads.
+Eigen::MatrixXd computeComplexStepJacobian(
+        const Eigen::VectorXd& input,
+        const std::function< std::function< Eigen::VectorXcd( const Eigen::VectorXcd& ) >( ) >& functionCreator,
+        const NumericalJacobianSettings& jacobianSettings )
+{
+    typedef std::function< Eigen::VectorXcd( const Eigen::VectorXcd& ) > JacobianFunction;
+
+    const Eigen::VectorXd stepSizes = getNumericalJacobianStepSizes( input, jacobianSettings, true );
+
+    return computeJacobianColumnsConcurrently< JacobianFunction >(
+                input.rows( ), functionCreator,
+                [ & ]( const int columnIndex, const JacobianFunction& function )
+    {
+        Eigen::VectorXcd perturbedInput = input.cast< std::complex< double > >( );
+        perturbedInput( columnIndex ) += std::complex< double >( 0.0, stepSizes( columnIndex ) );
+        return Eigen::VectorXd( function( perturbedInput ).imag( ) / stepSizes( columnIndex ) );
+    }, jacobianSettings.numberOfThreads_ );
+}
+
+//! Function to compute a Jacobian using the complex-step method, evaluating a single function sequentially.
+Eigen::MatrixXd computeComplexStepJacobian(
+        const Eigen::VectorXd& input,
+        const std::function< Eigen::VectorXcd( const Eigen::VectorXcd& ) >& function,
+        const NumericalJacobianSettings& jacobianSettings )
+{
+    NumericalJacobianSettings sequentialSettings = jacobianSettings;
+    sequentialSettings.numberOfThreads_ = 1;
+    return computeComplexStepJacobian(
+                input, [ & ]( ){ return function; }, sequentialSettings );
+}
+
+} // namespace numerical_derivatives
+
+} // namespace tudat
@@ -0,0 +1,178 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Press W.H., et al. Numerical Recipes in C++: The Art of Scientific Computing. Cambridge
+ *          University Press, February 2002.
+ *      Martins, J.R.R.A., Sturdza, P., Alonso, J.J., "The Complex-Step Derivative Approximation",
+ *          ACM Transactions on Mathematical Software, September 2003.
+ *
+ */
+
+#ifndef TUDAT_NUMERICAL_JACOBIAN_H
+#define TUDAT_NUMERICAL_JACOBIAN_H
+
+#include <complex>
+#include <functional>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/numericalDerivative.h"
+
+namespace tudat
+{
+
+namespace numerical_derivatives
+{
+
+//! Enum listing the available methods to select the perturbation step sizes of a numerical Jacobian.
+enum JacobianStepSizeTypes
+{
+    absolute_jacobian_step_size,
+    relative_jacobian_step_size,
+    optimal_jacobian_step_size
+};
+
+//! Class defining the settings for the computation of a numerical Jacobian.
+class NumericalJacobianSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param stepSizeType Method by which the perturbation step sizes are selected. For absolute_jacobian_step_size, the
+     * step sizes are taken from absoluteStepSizes. For relative_jacobian_step_size, the step size of each entry is the
+     * maximum of minimumStepSize and relativeStepSize times the absolute value of the entry. For
+     * optimal_jacobian_step_size, the relative step size is set such that the truncation and round-off errors of the
+     * method are balanced (eps^(1/(order+1)) for central differences), with a minimum step equal to this relative value.
+     * Relative and optimal step sizes assume that the magnitude of each input entry is representative of its scale; for
+     * entries that are close to zero but are combined with large values in the function (e.g. the position of a body at
+     * the origin), absolute step sizes should be used.
+     * \param absoluteStepSizes Absolute perturbation step sizes, one per entry of the input vector (or a single value used
+     * for all entries). Only used for absolute_jacobian_step_size.
+     * \param relativeStepSize Relative perturbation step size. Only used for relative_jacobian_step_size.
+     * \param minimumStepSize Minimum perturbation step size. Only used for relative_jacobian_step_size.
+     * \param order Order of the central difference method (not used for complex-step Jacobians).
+     * \param numberOfThreads Number of threads over which the columns of the Jacobian are distributed.
+     */
+    NumericalJacobianSettings(
+            const JacobianStepSizeTypes stepSizeType = optimal_jacobian_step_size,
+            const Eigen::VectorXd& absoluteStepSizes = Eigen::VectorXd::Zero( 0 ),
+            const double relativeStepSize = 1.0E-8,
+            const double minimumStepSize = 1.0E-8,
+            const CentralDifferenceOrders order = order2,
+            const unsigned int numberOfThreads = 1 ):
+        stepSizeType_( stepSizeType ), absoluteStepSizes_( absoluteStepSizes ), relativeStepSize_( relativeStepSize ),
+        minimumStepSize_( minimumStepSize ), order_( order ), numberOfThreads_( numberOfThreads ){ }
+
+    //! Method by which the perturbation step sizes are selected.
+    JacobianStepSizeTypes stepSizeType_;
+
+    //! Absolute perturbation step sizes (only used for absolute_jacobian_step_size).
+    Eigen::VectorXd absoluteStepSizes_;
+
+    //! Relative perturbation step size (only used for relative_jacobian_step_size).
+    double relativeStepSize_;
+
+    //! Minimum perturbation step size (only used for relative_jacobian_step_size).
+    double minimumStepSize_;
+
+    //! Order of the central difference method (not used for complex-step Jacobians).
+    CentralDifferenceOrders order_;
+
+    //! Number of threads over which the columns of the Jacobian are distributed.
+    unsigned int numberOfThreads_;
+};
+
+//! Function to compute the perturbation step sizes for a numerical Jacobian.
+/*!
+ * Function to compute the perturbation step sizes for a numerical Jacobian, from the settings for the Jacobian (see
+ * NumericalJacobianSettings). For finite differences, the step sizes are modified such that the perturbed input values
+ * are exactly representable, see (Press W.H., et al., 2002).
+ * \param input Nominal input vector at which the Jacobian is to be computed.
+ * \param jacobianSettings Settings for the computation of the Jacobian.
+ * \param isComplexStep Boolean denoting whether the step sizes are used for a complex-step Jacobian.
+ * \return Perturbation step size for each entry of the input vector.
+ */
+Eigen::VectorXd getNumericalJacobianStepSizes(
+        const Eigen::VectorXd& input,
+        const NumericalJacobianSettings& jacobianSettings,
+        const bool isComplexStep = false );
+
+//! Function to compute a Jacobian using a central difference method, distributing the columns over a number of threads.
+/*!
+ * Function to compute a Jacobian of a vector function with vector output using a central difference method. The columns
+ * of the Jacobian are computed concurrently, distributed over the number of threads defined in the settings. Since the
+ * function that is to be differentiated will typically modify an environment (e.g. set a perturbed body state and update
+ * the environment models), it may not be evaluated concurrently. Therefore, the functionCreator is called (once, from the
+ * thread that uses it) to create a separate function for each thread, which should use its own environment (e.g. one
+ * created by a separate call to createBodies). The results are independent of the number of threads.
+ * \param input Nominal input vector at which the Jacobian is to be computed.
+ * \param functionCreator Function that creates the function that is to be differentiated, called once per thread.
+ * \param jacobianSettings Settings for the computation of the Jacobian.
+ * \return Jacobian of the function, evaluated at the nominal input.
+ */
+Eigen::MatrixXd computeCentralDifferenceJacobian(
+        const Eigen::VectorXd& input,
+        const std::function< std::function< Eigen::VectorXd( const Eigen::VectorXd& ) >( ) >& functionCreator,
+        const NumericalJacobianSettings& jacobianSettings = NumericalJacobianSettings( ) );
+
+//! Function to compute a Jacobian using a central difference method, evaluating a single function sequentially.
+/*!
+ * Function to compute a Jacobian of a vector function with vector output using a central difference method. The function
+ * is evaluated sequentially (regardless of the number of threads in the settings), so that it may modify a shared
+ * environment.
+ * \param input Nominal input vector at which the Jacobian is to be computed.
+ * \param function Function that is to be differentiated.
+ * \param jacobianSettings Settings for the computation of the Jacobian.
+ * \return Jacobian of the function, evaluated at the nominal input.
+ */
+Eigen::MatrixXd computeCentralDifferenceJacobian(
+        const Eigen::VectorXd& input,
+        const std::function< Eigen::VectorXd( const Eigen::VectorXd& ) >& function,
+        const NumericalJacobianSettings& jacobianSettings = NumericalJacobianSettings( ) );
+
+//! Function to compute a Jacobian using the complex-step method, distributing the columns over a number of threads.
+/*!
+ * Function to compute a Jacobian of a vector function with vector output using the complex-step method
+ * (Martins et al., 2003): J_i = Im( f( x + i*h*e_i ) ) / h. The function must be implemented for complex input (using
+ * only analytic operations on the input), but in return the Jacobian is free of subtractive cancellation, so that it is
+ * accurate to machine precision for very small step sizes. The columns are computed concurrently, using a separate
+ * function for each thread (see computeCentralDifferenceJacobian).
+ * \param input Nominal input vector at which the Jacobian is to be computed.
+ * \param functionCreator Function that creates the function that is to be differentiated, called once per thread.
+ * \param jacobianSettings Settings for the computation of the Jacobian (order is not used).
+ * \return Jacobian of the function, evaluated at the nominal input.
+ */
+Eigen::MatrixXd computeComplexStepJacobian(
+        const Eigen::VectorXd& input,
+        const std::function< std::function< Eigen::VectorXcd( const Eigen::VectorXcd& ) >( ) >& functionCreator,
+        const NumericalJacobianSettings& jacobianSettings = NumericalJacobianSettings( ) );
+
+//! Function to compute a Jacobian using the complex-step method, evaluating a single function sequentially.
+/*!
+ * Function to compute a Jacobian of a vector function with vector output using the complex-step method (see
+ * computeComplexStepJacobian with function creator input). The function is evaluated sequentially, regardless of the
+ * number of threads in the settings.
+ * \param input Nominal input vector at which the Jacobian is to be computed.
+ * \param function Function that is to be differentiated.
+ * \param jacobianSettings Settings for the computation of the Jacobian (order is not used).
+ * \return Jacobian of the function, evaluated at the nominal input.
+ */
+Eigen::MatrixXd computeComplexStepJacobian(
+        const Eigen::VectorXd& input,
+        const std::function< Eigen::VectorXcd( const Eigen::VectorXcd& ) >& function,
+        const NumericalJacobianSettings& jacobianSettings = NumericalJacobianSettings( ) );
+
+} // namespace numerical_derivatives
+
+} // namespace tudat
+
+#endif // TUDAT_NUMERICAL_JACOBIAN_H
@@ -16,6 +16,7 @@
 
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
+#include "Tudat/Mathematics/Interpolators/hermiteCubicSplineInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 
 namespace tudat
@@ -565,6 +566,81 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
 }
 
 
+//! Test whether interpolation at multiple values reproduces interpolation at single values.
+BOOST_AUTO_TEST_CASE( test_interpolation_at_multiple_values )
+{
+    using namespace interpolators;
+
+    // Create data on non-equidistant grid.
+    std::vector< double > independentValues;
+    std::vector< Eigen::Vector3d > dependentValues;
+    std::vector< Eigen::Vector3d > derivativeValues;
+    for( int i = 0; i < 200; i++ )
+    {
+        const double currentValue = 10.0 * static_cast< double >( i ) + std::sin( static_cast< double >( i ) );
+        independentValues.push_back( currentValue );
+        dependentValues.push_back( Eigen::Vector3d( std::sin( currentValue / 100.0 ), std::cos( currentValue / 70.0 ),
+                                                    currentValue * currentValue ) );
+        derivativeValues.push_back( Eigen::Vector3d( std::cos( currentValue / 100.0 ) / 100.0,
+                                                     -std::sin( currentValue / 70.0 ) / 70.0, 2.0 * currentValue ) );
+    }
+
+    // Create sorted list of values at which to interpolate, including data points and values outside domain.
+    std::vector< double > targetValues;
+    for( int i = 0; i < 5000; i++ )
+    {
+        targetValues.push_back( -50.0 + 0.41 * static_cast< double >( i ) );
+    }
+    targetValues.push_back( independentValues.at( 100 ) );
+    targetValues.push_back( independentValues.at( 150 ) );
+    targetValues.push_back( independentValues.back( ) );
+    targetValues.push_back( independentValues.back( ) + 3.0 );
+    std::sort( targetValues.begin( ), targetValues.end( ) );
+
+    // Create interpolators, using binary search for single-value interpolation.
+    std::vector< std::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector3d > > > interpolatorList;
+    interpolatorList.push_back( std::make_shared< LagrangeInterpolator< double, Eigen::Vector3d > >(
+                                    independentValues, dependentValues, 8, binarySearch ) );
+    interpolatorList.push_back( std::make_shared< LagrangeInterpolator< double, Eigen::Vector3d > >(
+                                    independentValues, dependentValues, 6, binarySearch,
+                                    lagrange_cubic_spline_boundary_interpolation, use_default_value,
+                                    std::make_pair( Eigen::Vector3d::Constant( -1.0 ),
+                                                    Eigen::Vector3d::Constant( 1.0 ) ) ) );
+    interpolatorList.push_back( std::make_shared< CubicSplineInterpolator< double, Eigen::Vector3d > >(
+                                    independentValues, dependentValues, binarySearch ) );
+    interpolatorList.push_back( std::make_shared< HermiteCubicSplineInterpolator< double, Eigen::Vector3d > >(
+                                    independentValues, dependentValues, derivativeValues, binarySearch ) );
+    interpolatorList.push_back( std::make_shared< LinearInterpolator< double, Eigen::Vector3d > >(
+                                    independentValues, dependentValues, binarySearch, use_boundary_value ) );
+
+    for( unsigned int i = 0; i < interpolatorList.size( ); i++ )
+    {
+        // Interpolate at sorted values, and compare to single-value interpolation.
+        std::vector< Eigen::Vector3d > interpolatedValues =
+                interpolatorList.at( i )->interpolateAtMultipleValues( targetValues );
+        BOOST_CHECK_EQUAL( interpolatedValues.size( ), targetValues.size( ) );
+        for( unsigned int j = 0; j < targetValues.size( ); j++ )
+        {
+            Eigen::Vector3d expectedValue = interpolatorList.at( i )->interpolate( targetValues.at( j ) );
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_EQUAL( interpolatedValues.at( j )( k ), expectedValue( k ) );
+            }
+        }
+
+        // Interpolate at unsorted values, and compare to single-value interpolation.
+        std::vector< double > unsortedTargetValues = { 1500.0, 3.0, 1999.0, -5.0, 777.7 };
+        interpolatedValues = interpolatorList.at( i )->interpolateAtMultipleValues( unsortedTargetValues );
+        for( unsigned int j = 0; j < unsortedTargetValues.size( ); j++ )
+        {
+            Eigen::Vector3d expectedValue = interpolatorList.at( i )->interpolate( unsortedTargetValues.at( j ) );
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_EQUAL( interpolatedValues.at( j )( k ), expectedValue( k ) );
+            }
+        }
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -618,6 +618,82 @@ BOOST_AUTO_TEST_CASE( test2DimensionsUserExtrapolationCase )
     }
 }
 
+//! Test whether multilinear functions are reproduced exactly (also when extrapolating), with vector-valued dependent
+//! variables, and with the independent variables provided both as vector and as fixed-size array.
+BOOST_AUTO_TEST_CASE( test3DimensionsMultiLinearFunction )
+{
+    using namespace interpolators;
+
+    // Define non-uniform grid of independent variables.
+    std::vector< std::vector< double > > independentValues( 3 );
+    independentValues[ 0 ] = { -2.0, -1.5, 0.0, 0.3, 2.5, 4.0 };
+    independentValues[ 1 ] = { 10.0, 11.0, 15.0, 16.0 };
+    independentValues[ 2 ] = { -0.5, 0.0, 0.25, 0.75, 1.0, 3.0, 3.5 };
+
+    // Define multilinear function, of which each entry has different coefficients.
+    Eigen::Matrix< double, 6, 8 > functionCoefficients = Eigen::Matrix< double, 6, 8 >::Random( );
+    auto computeFunctionValue = [ & ]( const double x, const double y, const double z )
+    {
+        Eigen::Matrix< double, 8, 1 > basisFunctions;
+        basisFunctions << 1.0, x, y, z, x * y, x * z, y * z, x * y * z;
+        Eigen::Vector6d functionValue = functionCoefficients * basisFunctions;
+        return functionValue;
+    };
+
+    // Tabulate function at grid points.
+    boost::multi_array< Eigen::Vector6d, 3 > dependentValues;
+    dependentValues.resize( boost::extents[ 6 ][ 4 ][ 7 ] );
+    for ( unsigned int i = 0; i < 6; i++ )
+    {
+        for ( unsigned int j = 0; j < 4; j++ )
+        {
+            for ( unsigned int k = 0; k < 7; k++ )
+            {
+                dependentValues[ i ][ j ][ k ] = computeFunctionValue(
+                            independentValues[ 0 ][ i ], independentValues[ 1 ][ j ], independentValues[ 2 ][ k ] );
+            }
+        }
+    }
+
+    // Test for both lookup schemes.
+    for ( unsigned int lookupScheme = 0; lookupScheme < 2; lookupScheme++ )
+    {
+        MultiLinearInterpolator< double, Eigen::Vector6d, 3 > threeDimensionalInterpolator(
+                    independentValues, dependentValues, static_cast< AvailableLookupScheme >( lookupScheme ) );
+
+        // Test at grid points, inside and outside of grid.
+        for ( unsigned int testPoint = 0; testPoint < 1000; testPoint++ )
+        {
+            std::vector< double > targetValue( 3 );
+            Eigen::Vector3d randomValues = Eigen::Vector3d::Random( );
+            for ( unsigned int i = 0; i < 3; i++ )
+            {
+                double rangeSize = independentValues[ i ].back( ) - independentValues[ i ].front( );
+                if ( testPoint < 10 )
+                {
+                    targetValue[ i ] = independentValues[ i ][ testPoint % independentValues[ i ].size( ) ];
+                }
+                else
+                {
+                    targetValue[ i ] = independentValues[ i ].front( ) - 0.1 * rangeSize +
+                            0.6 * rangeSize * ( randomValues( i ) + 1.0 );
+                }
+            }
+
+            Eigen::Vector6d expectedValue = computeFunctionValue( targetValue[ 0 ], targetValue[ 1 ], targetValue[ 2 ] );
+            Eigen::Vector6d interpolatedValue = threeDimensionalInterpolator.interpolate( targetValue );
+            Eigen::Vector6d interpolatedValueFromArray = threeDimensionalInterpolator.interpolateFromArray(
+                        boost::array< double, 3 >( { { targetValue[ 0 ], targetValue[ 1 ], targetValue[ 2 ] } } ) );
+
+            for ( unsigned int i = 0; i < 6; i++ )
+            {
+                BOOST_CHECK_SMALL( interpolatedValue( i ) - expectedValue( i ), 1.0E-10 );
+                BOOST_CHECK_EQUAL( interpolatedValue( i ), interpolatedValueFromArray( i ) );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -295,6 +295,23 @@ public:
         int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour(
                     targetIndependentVariableValue );
 
+        return interpolateInInterval( targetIndependentVariableValue, lowerEntry_ );
+    }
+
+protected:
+
+    //! Function to perform interpolation in a given interval of the independent variable data.
+    /*!
+     *  Function to perform interpolation in a given interval of the independent variable data, without applying
+     *  boundary handling (see interpolate function).
+     *  \param targetIndependentVariableValue Target independent variable value at which point the interpolation is
+     *      performed.
+     *  \param lowerEntry_ Index of nearest lower neighbour of targetIndependentVariableValue in independentValues_.
+     *  \return Interpolated dependent variable value.
+     */
+    DependentVariableType interpolateInInterval(
+            const IndependentVariableType targetIndependentVariableValue, const int lowerEntry_ )
+    {
         // Get independent variable values bounding interval in which requested value lies.
         IndependentVariableType lowerValue, upperValue;
         ScalarType squareDifference;
@@ -319,7 +336,11 @@ public:
                 coefficientD_ * secondDerivativeOfCurve_[ lowerEntry_ + 1 ];
     }
 
-protected:
+    //! Function to check whether the interpolateInInterval function is implemented (true for this class).
+    bool isInterpolationInIntervalImplemented( )
+    {
+        return true;
+    }
 
 private:
 
@@ -172,10 +172,26 @@ public:
         // Determine the lower entry in the table corresponding to the target independent variable value.
         int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue );
 
+        return interpolateInInterval( targetIndependentVariableValue, lowerEntry_ );
+    }
+
+protected:
+
+    //! Function to perform interpolation in a given interval of the independent variable data.
+    /*!
+     *  Function to perform interpolation in a given interval of the independent variable data, without applying
+     *  boundary handling (see interpolate function).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param lowerEntry_ Index of nearest lower neighbour of targetIndependentVariableValue in independentValues_.
+     *  \return Interpolated value of interpolated dependent variable.
+     */
+    DependentVariableType interpolateInInterval(
+            const IndependentVariableType targetIndependentVariableValue, const int lowerEntry_ )
+    {
         // Compute Hermite spline
         IndependentVariableType factor = ( targetIndependentVariableValue - independentValues_[ lowerEntry_ ] ) /
                 ( independentValues_[ lowerEntry_ + 1 ] - independentValues_[ lowerEntry_ ] );
-        targetValue =
+        DependentVariableType targetValue =
                 coefficients_[ 0 ][ lowerEntry_ ] * factor * factor * factor +
                 coefficients_[ 1 ][ lowerEntry_ ] * factor * factor +
                 coefficients_[ 2 ][ lowerEntry_ ] * factor +
@@ -184,7 +200,11 @@ public:
         return targetValue;
     }
 
-protected:
+    //! Function to check whether the interpolateInInterval function is implemented (true for this class).
+    bool isInterpolationInIntervalImplemented( )
+    {
+        return true;
+    }
 
     //! Compute coefficients of the splines
     void computeCoefficients( )
@@ -137,9 +137,6 @@ public:
         // interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        // Pre-allocate cache vector for computational efficiency.
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Constructor from map of independent/dependent data.
@@ -210,8 +207,6 @@ public:
         //interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Destructor.
@@ -248,6 +243,34 @@ public:
         int lowerEntry = lookUpScheme_->findNearestLowerNeighbour(
                     targetIndependentVariableValue );
 
+        return interpolateInInterval( targetIndependentVariableValue, lowerEntry );
+    }
+
+    //! Function to retrieve the number of stages of interpolator
+    /*!
+     *  Function to retrieve the number of stages of interpolator
+     *  \return Number of stages of interpolator
+     */
+    int getNumberOfStages( )
+    {
+        return numberOfStages_;
+    }
+
+protected:
+
+    //! Function to perform interpolation in a given interval of the independent variable data.
+    /*!
+     *  Function to perform interpolation in a given interval of the independent variable data, without applying
+     *  boundary handling (see interpolate function).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param lowerEntry Index of nearest lower neighbour of targetIndependentVariableValue in independentValues_.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateInInterval(
+            const IndependentVariableType targetIndependentVariableValue, const int lowerEntry )
+    {
+        DependentVariableType interpolatedValue = zeroEntry_;
+
         // Check if requested interval is inside region in which centered lagrange interpolation
         // can be used.
         if( lowerEntry < offsetEntries_ )
@@ -297,18 +320,16 @@ public:
             }
             else
             {
-                // Set up repeated numerator and cache of independent variable values from which
-                // interpolant is created.
+                // Set up repeated numerator from which interpolant is created. The differences in independent variable
+                // values are recomputed below (rather than cached in a member), so that interpolate may be called
+                // concurrently.
                 int j = 0;
                 for( int i = 0; i <= 2 * offsetEntries_ + 1; i++ )
                 {
                     j = i + lowerEntry - offsetEntries_;
-                    independentVariableDifferenceCache[ i ] =
-                            static_cast< ScalarType >(
+                    repeatedNumerator *= static_cast< ScalarType >(
                                 targetIndependentVariableValue - independentValues_[ j ] );
 
-                    repeatedNumerator *= independentVariableDifferenceCache[ i ];
-
                 }
 
                 // Evaluate interpolating polynomial at requested data point.
@@ -317,7 +338,7 @@ public:
                     j = i + lowerEntry - offsetEntries_;
                     interpolatedValue += dependentValues_[ j ]  *
                             ( repeatedNumerator /
-                              ( independentVariableDifferenceCache[ i ] *
+                              ( static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ j ] ) *
                                 denominators[ lowerEntry ][ j - lowerEntry + offsetEntries_ ] ) );
                 }
             }
@@ -326,18 +347,12 @@ public:
         return interpolatedValue;
     }
 
-    //! Function to retrieve the number of stages of interpolator
-    /*!
-     *  Function to retrieve the number of stages of interpolator
-     *  \return Number of stages of interpolator
-     */
-    int getNumberOfStages( )
+    //! Function to check whether the interpolateInInterval function is implemented (true for this class).
+    bool isInterpolationInIntervalImplemented( )
     {
-        return numberOfStages_;
+        return true;
     }
 
-protected:
-
 private:
 
     //! Function called at initialization which pre-computes the denominators of the
@@ -461,8 +476,6 @@ private:
      */
     int offsetEntries_;
 
-    std::vector< ScalarType > independentVariableDifferenceCache;
-
     //! Interpolator to be used at beginning of domain.
     std::shared_ptr< OneDimensionalInterpolator
     < IndependentVariableType, DependentVariableType > > beginInterpolator_;
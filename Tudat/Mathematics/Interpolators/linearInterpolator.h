@@ -230,15 +230,35 @@ public:
         int newNearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour(
                     independentVariableValue );
 
+        return interpolateInInterval( independentVariableValue, newNearestLowerIndex );
+    }
+
+protected:
+
+    //! Function to perform interpolation in a given interval of the independent variable data.
+    /*!
+     * Function to perform interpolation in a given interval of the independent variable data, without applying
+     * boundary handling (see interpolate function).
+     * \param independentVariableValue Value of independent variable at which interpolation is to take place.
+     * \param newNearestLowerIndex Index of nearest lower neighbour of independentVariableValue in independentValues_.
+     * \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateInInterval(
+            const IndependentVariableType independentVariableValue, const int newNearestLowerIndex )
+    {
         // Perform linear interpolation.
-        interpolatedValue = dependentValues_[ newNearestLowerIndex ] +
+        return dependentValues_[ newNearestLowerIndex ] +
                 ( independentVariableValue - independentValues_[ newNearestLowerIndex ] ) /
                 ( independentValues_[ newNearestLowerIndex + 1 ] -
                 independentValues_[ newNearestLowerIndex ] ) *
                 ( dependentValues_[ newNearestLowerIndex + 1 ] -
                 dependentValues_[ newNearestLowerIndex ] );
+    }
 
-        return interpolatedValue;
+    //! Function to check whether the interpolateInInterval function is implemented (true for this class).
+    bool isInterpolationInIntervalImplemented( )
+    {
+        return true;
     }
 
 };
@@ -12,6 +12,7 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <atomic>
 #include <vector>
 
 #include <memory>
@@ -123,20 +124,23 @@ public:
         int newNearestLowerIndex = 0;
 
         // If this is first call of function, use binary search.
-        if ( !isFirstLookupDone )
+        if ( !isFirstLookupDone.load( std::memory_order_relaxed ) )
         {
             newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
                     < IndependentVariableType >( independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
+            isFirstLookupDone.store( true, std::memory_order_relaxed );
         }
 
         else
         {
+            // Retrieve value from previous call (which is only used as initial guess, so concurrent calls are allowed).
+            const int previousNearestLowerIndex = previousNearestLowerIndex_.load( std::memory_order_relaxed );
+
             // If requested value is in same interval, return same value as previous time.
             if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_, valueToLookup, independentVariableValues_ ) )
+                 ( previousNearestLowerIndex, valueToLookup, independentVariableValues_ ) )
             {
-                newNearestLowerIndex = previousNearestLowerIndex_;
+                newNearestLowerIndex = previousNearestLowerIndex;
             }
 
             // Otherwise, perform hunting algorithm.
@@ -145,12 +149,12 @@ public:
                 newNearestLowerIndex =
                         basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
                         IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
+                        (  valueToLookup, previousNearestLowerIndex, independentVariableValues_ );
             }
         }
 
         // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
+        previousNearestLowerIndex_.store( newNearestLowerIndex, std::memory_order_relaxed );
 
         return newNearestLowerIndex;
     }
@@ -161,13 +165,13 @@ private:
     /*!
      * Boolean to denote whether a lookup has been done.
      */
-    bool isFirstLookupDone;
+    std::atomic< bool > isFirstLookupDone;
 
     //! Nearest left index during previous call.
     /*!
-     * Nearest left index during previous call
+     * Nearest left index during previous call (atomic, so that lookups may be performed concurrently).
      */
-    int previousNearestLowerIndex_;
+    std::atomic< int > previousNearestLowerIndex_;
 };
 
 //! Look-up scheme class for nearest left neighbour search using binary search algorithm.
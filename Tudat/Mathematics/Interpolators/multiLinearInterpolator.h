@@ -30,6 +30,7 @@
 #ifndef TUDAT_MULTI_LINEAR_INTERPOLATOR_H
 #define TUDAT_MULTI_LINEAR_INTERPOLATOR_H
 
+#include <algorithm>
 #include <vector>
 
 #include <boost/array.hpp>
@@ -50,8 +51,12 @@ namespace interpolators
 //! Class for performing multi-linear interpolation for arbitrary number of independent variables.
 /*!
  * Class for performing multi-linear interpolation for arbitrary number of independent variables.
- * Interpolation is calculated recursively over all dimensions of independent variables. Note
- * that the types (i.e. double, float) of all independent variables must be the same.
+ * The dependent variables at the 2^n corners of the grid hyper-rectangle are retrieved directly
+ * from the (contiguous) data array, using offsets that are precomputed from the array strides,
+ * after which the interpolation is calculated successively over all dimensions of independent
+ * variables. No memory is allocated on the heap during the interpolation (for fixed-size
+ * dependent variable types). Note that the types (i.e. double, float) of all independent
+ * variables must be the same.
  * \tparam IndependentVariableType Type for independent variables.
  * \tparam DependentVariableType Type for dependent variable.
  * \tparam NumberOfDimensions Number of independent variables.
@@ -126,6 +131,9 @@ public:
 
         // Create lookup scheme from independent variable data points.
         this->makeLookupSchemes( selectedLookupScheme );
+
+        // Precompute offsets of grid hyper-rectangle corners in data array.
+        setCornerOffsets( );
     }
 
     //! Constructor taking independent and dependent variable data.
@@ -181,41 +189,76 @@ public:
         }
 
         // Create local copy of current independent variables
-        std::vector< IndependentVariableType > localIndependentValuesToInterpolate = independentValuesToInterpolate;
+        boost::array< IndependentVariableType, NumberOfDimensions > localIndependentValuesToInterpolate;
+        std::copy( independentValuesToInterpolate.begin( ), independentValuesToInterpolate.end( ),
+                   localIndependentValuesToInterpolate.begin( ) );
+
+        return interpolateFromArray( localIndependentValuesToInterpolate );
+    }
 
+    //! Function to perform interpolation, with independent variables provided as fixed-size array.
+    /*!
+     *  This function performs the multilinear interpolation. The 2^n grid points surrounding the requested point are
+     *  retrieved from the data array using the precomputed corner offsets, after which the interpolation is performed
+     *  for one dimension at a time, starting from the last dimension.
+     *  \param independentValuesToInterpolate Array of values of independent variables at which
+     *      the value of the dependent variable is to be determined (passed by value, as it may be modified
+     *      by the boundary handling).
+     *  \return Interpolated value of dependent variable in all dimensions.
+     */
+    DependentVariableType interpolateFromArray(
+            boost::array< IndependentVariableType, NumberOfDimensions > independentValuesToInterpolate )
+    {
         // Check that independent variables are in range
         bool useValue = false;
         DependentVariableType currentDependentVariable;
         for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
-            this->checkBoundaryCase( i, useValue, localIndependentValuesToInterpolate.at( i ), currentDependentVariable );
+            this->checkBoundaryCase( i, useValue, independentValuesToInterpolate[ i ], currentDependentVariable );
             if ( useValue )
             {
                 return currentDependentVariable;
             }
         }
 
-        // Determine the nearest lower neighbours.
-        std::vector< int > nearestLowerIndices;
-        nearestLowerIndices.resize( NumberOfDimensions );
+        // Determine the nearest lower neighbours, the offset of the lower corner in the data array, and the
+        // fractions of data points above and below independent variable value in each dimension.
+        boost::array< IndependentVariableType, NumberOfDimensions > upperFractions;
+        boost::array< IndependentVariableType, NumberOfDimensions > lowerFractions;
+        std::ptrdiff_t lowerCornerOffset = 0;
         for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
-            nearestLowerIndices[ i ] = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
-                        localIndependentValuesToInterpolate[ i ] );
+            int nearestLowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
+                        independentValuesToInterpolate[ i ] );
+            lowerCornerOffset += nearestLowerIndex * dataStrides_[ i ];
+
+            const IndependentVariableType& lowerValue = independentValues_[ i ][ nearestLowerIndex ];
+            const IndependentVariableType& upperValue = independentValues_[ i ][ nearestLowerIndex + 1 ];
+            upperFractions[ i ] = ( independentValuesToInterpolate[ i ] - lowerValue ) / ( upperValue - lowerValue );
+            lowerFractions[ i ] = -( independentValuesToInterpolate[ i ] - upperValue ) / ( upperValue - lowerValue );
         }
 
-        // Initialize function evaluation indices to -1 for debugging purposes.
-        boost::array< unsigned int, NumberOfDimensions > interpolationIndices;
-        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        // Retrieve dependent variable values at all corners of the grid hyper-rectangle
+        boost::array< DependentVariableType, numberOfCorners_ > cornerValues;
+        const DependentVariableType* lowerCornerData = dependentData_.data( ) + lowerCornerOffset;
+        for ( unsigned int j = 0; j < numberOfCorners_; j++ )
+        {
+            cornerValues[ j ] = lowerCornerData[ cornerOffsets_[ j ] ];
+        }
+
+        // Interpolate in one dimension at a time, starting from the last dimension. Each step halves the number of
+        // corner values, combining the values at the lower (even index) and upper (odd index) grid points.
+        for ( int i = NumberOfDimensions - 1; i >= 0; i-- )
         {
-            interpolationIndices[ i ] = -1;
+            for ( unsigned int j = 0; j < ( 1u << i ); j++ )
+            {
+                cornerValues[ j ] = upperFractions[ i ] * cornerValues[ 2 * j + 1 ] +
+                        lowerFractions[ i ] * cornerValues[ 2 * j ];
+            }
         }
 
-        // Call first step of interpolation, this function calls itself at subsequent independent
-        // variable dimensions to evaluate and properly scale dependent variable table values at
-        // all 2^n grid edges.
-        return performRecursiveInterpolationStep( 0, localIndependentValuesToInterpolate,
-                                                  interpolationIndices, nearestLowerIndices );
+        // Return interpolated value.
+        return cornerValues[ 0 ];
     }
 
 private:
@@ -264,80 +307,41 @@ private:
         }
     }
 
-    //! Perform the step in a single dimension of the interpolation process.
+    //! Function to compute the offsets of the grid hyper-rectangle corners in the dependent data array.
     /*!
-     * Function calculates single dimension of the interpolation process. Function calls itself if
-     * final dimension not yet reached. Calling this function with currentDimension = 0 will result
-     * in 2^{NumberOfDimensions} number of calls to the function at currentDimension =
-     * NumberOfDimensions -1. As such, the complete series of calls, starting at currentDimension =
-     * 0, retrieves the dependent variable values at all edges of the grid hyper-rectangle and
-     * properly scales them.
-     * \param currentDimension Dimension in which this interpolation step is to be performed.
-     * \param independentValuesToInterpolate Vector of values of independent variables at which
-     *          interpolation is to be performed.
-     * \param currentArrayIndices Array of indices modified at index = currentDimension at each
-     *          call of function. Variable is passed to dependentData in highest step to return
-     *          data for interpolation.
-     * \param nearestLowerIndices Indices in subvectors of independentValues_ vector. That is, the
-     *  n-th entry of nearestLowerIndices represent the nearest lower neighbour in the n-th
-     *  interpolation dimension of the independent variable vectors.
-     * \return Interpolated value in a single dimension
+     * Function to compute the offsets of the grid hyper-rectangle corners in the dependent data array, relative to the
+     * lower corner (i.e. the nearest lower neighbour in all dimensions), from the strides of the data array. The bits of
+     * the corner index denote whether the lower (0) or upper (1) grid point is used in each dimension, with the first
+     * dimension as most significant bit.
      */
-    DependentVariableType performRecursiveInterpolationStep(
-            const unsigned int currentDimension,
-            const std::vector< IndependentVariableType >& independentValuesToInterpolate,
-            boost::array< unsigned int, NumberOfDimensions > currentArrayIndices,
-            const std::vector< int >& nearestLowerIndices )
+    void setCornerOffsets( )
     {
-        IndependentVariableType upperFraction, lowerFraction;
-        DependentVariableType upperContribution, lowerContribution;
-
-        // Calculate fractions of data points above and below independent
-        // variable value to be added to interpolated value.
-        upperFraction = ( independentValuesToInterpolate[ currentDimension ] -
-                          independentValues_[ currentDimension ]
-                          [ nearestLowerIndices[ currentDimension ] ] ) /
-                ( independentValues_[ currentDimension ]
-                  [ nearestLowerIndices[ currentDimension ] + 1 ] -
-                independentValues_[ currentDimension ]
-                [ nearestLowerIndices[ currentDimension ] ] );
-        lowerFraction = -( independentValuesToInterpolate[ currentDimension ] -
-                           independentValues_[ currentDimension ]
-                           [ nearestLowerIndices[ currentDimension ] + 1 ] ) /
-                ( independentValues_[ currentDimension ]
-                  [ nearestLowerIndices[ currentDimension ] + 1 ] -
-                independentValues_[ currentDimension ]
-                [ nearestLowerIndices[ currentDimension ] ] );
-
-        // If at top dimension, call dependent variable data.
-        if ( currentDimension == NumberOfDimensions - 1 )
+        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
-            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentDimension ];
-            lowerContribution = dependentData_( currentArrayIndices );
-            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentDimension ]
-                    + 1;
-            upperContribution = dependentData_( currentArrayIndices );
+            dataStrides_[ i ] = dependentData_.strides( )[ i ];
         }
 
-        // If at lower dimension, update currentArrayIndices and call function with
-        // currentDimension++.
-        else
+        for ( unsigned int j = 0; j < numberOfCorners_; j++ )
         {
-            currentArrayIndices[ currentDimension ] = nearestLowerIndices[ currentDimension ];
-            lowerContribution = performRecursiveInterpolationStep(
-                        currentDimension + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
-            currentArrayIndices[ currentDimension ] = nearestLowerIndices[ currentDimension ] + 1;
-            upperContribution = performRecursiveInterpolationStep(
-                        currentDimension + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
+            cornerOffsets_[ j ] = 0;
+            for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+            {
+                if ( ( j >> ( NumberOfDimensions - 1 - i ) ) & 1u )
+                {
+                    cornerOffsets_[ j ] += dataStrides_[ i ];
+                }
+            }
         }
-
-        // Return interpolated value.
-        DependentVariableType returnValue = upperFraction * upperContribution +
-                lowerFraction * lowerContribution;
-        return returnValue;
     }
+
+    //! Number of corners of grid hyper-rectangle.
+    static const unsigned int numberOfCorners_ = 1u << NumberOfDimensions;
+
+    //! Strides of the dependent data array in each dimension.
+    boost::array< std::ptrdiff_t, NumberOfDimensions > dataStrides_;
+
+    //! Offsets of grid hyper-rectangle corners in dependent data array, relative to lower corner.
+    boost::array< std::ptrdiff_t, numberOfCorners_ > cornerOffsets_;
 };
 
 extern template class MultiLinearInterpolator< double, Eigen::Vector6d, 1 >;
@@ -12,6 +12,7 @@
 #ifndef TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 #define TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 
+#include <algorithm>
 #include <vector>
 #include <iostream>
 
@@ -23,6 +24,7 @@
 #include "Tudat/Mathematics/Interpolators/interpolator.h"
 
 #include "Tudat/Basics/identityElements.h"
+#include "Tudat/Basics/utilityMacros.h"
 
 namespace tudat
 {
@@ -111,6 +113,62 @@ public:
     virtual DependentVariableType
     interpolate( const IndependentVariableType independentVariableValue ) = 0;
 
+    //! Function to perform interpolation at a list of values of the independent variable.
+    /*!
+     *  Function to perform interpolation at a list of values of the independent variable. If the input values are
+     *  sorted in ascending order (and the derived class implements the interpolateInInterval function), the interval
+     *  in which each value lies is found by a single sweep over the independent variable data, continuing from the
+     *  interval of the previous value, instead of by a separate call to the look-up scheme for each value. This is
+     *  typically much faster when interpolating at a large number of sorted values (e.g. observation times). For
+     *  unsorted input, the interpolate function is called for each value separately. Boundary handling is identical
+     *  to that of the interpolate function.
+     *  \param independentVariableValues Values of independent variable at which the value of the dependent variable
+     *      is to be determined.
+     *  \return Interpolated values of dependent variable, in the same order as independentVariableValues.
+     */
+    std::vector< DependentVariableType > interpolateAtMultipleValues(
+            const std::vector< IndependentVariableType >& independentVariableValues )
+    {
+        std::vector< DependentVariableType > interpolatedValues;
+        interpolatedValues.reserve( independentVariableValues.size( ) );
+
+        if( !isInterpolationInIntervalImplemented( ) ||
+                !std::is_sorted( independentVariableValues.begin( ), independentVariableValues.end( ) ) )
+        {
+            for( unsigned int i = 0; i < independentVariableValues.size( ); i++ )
+            {
+                interpolatedValues.push_back( interpolate( independentVariableValues[ i ] ) );
+            }
+        }
+        else
+        {
+            // Iterate over all values, and move lower entry forward until current value is in interval.
+            const int maximumLowerEntry = static_cast< int >( independentValues_.size( ) ) - 2;
+            int lowerEntry = 0;
+            DependentVariableType boundaryValue = defaultExtrapolationValue_.first;
+            bool useBoundaryValue = false;
+            for( unsigned int i = 0; i < independentVariableValues.size( ); i++ )
+            {
+                useBoundaryValue = false;
+                this->checkBoundaryCase( boundaryValue, useBoundaryValue, independentVariableValues[ i ] );
+                if( useBoundaryValue )
+                {
+                    interpolatedValues.push_back( boundaryValue );
+                }
+                else
+                {
+                    while( ( lowerEntry < maximumLowerEntry ) &&
+                           !( independentVariableValues[ i ] < independentValues_[ lowerEntry + 1 ] ) )
+                    {
+                        lowerEntry++;
+                    }
+                    interpolatedValues.push_back( interpolateInInterval( independentVariableValues[ i ], lowerEntry ) );
+                }
+            }
+        }
+        return interpolatedValues;
+    }
+
     //! Function to perform interpolation, with non-const input argument.
     /*!
      *  This function performs the interpolation, with non-const input argument. Function calls the interpolate function and is
@@ -168,6 +226,35 @@ public:
 
 protected:
 
+    //! Function to perform interpolation in a given interval of the independent variable data.
+    /*!
+     *  Function to perform interpolation in a given interval of the independent variable data, without applying
+     *  boundary handling. Used by interpolateAtMultipleValues, which determines the interval directly. This base class
+     *  implementation throws an exception; derived classes that implement it must override
+     *  isInterpolationInIntervalImplemented to return true.
+     *  \param targetIndependentVariableValue Independent variable value at which the value of the dependent variable
+     *      is to be determined.
+     *  \param lowerEntry Index of nearest lower neighbour of targetIndependentVariableValue in independentValues_.
+     *  \return Interpolated value of dependent variable.
+     */
+    virtual DependentVariableType interpolateInInterval(
+            const IndependentVariableType targetIndependentVariableValue, const int lowerEntry )
+    {
+        TUDAT_UNUSED_PARAMETER( targetIndependentVariableValue );
+        TUDAT_UNUSED_PARAMETER( lowerEntry );
+        throw std::runtime_error( "Error, interpolation in given interval not implemented for this interpolator." );
+    }
+
+    //! Function to check whether the interpolateInInterval function is implemented by the derived class.
+    /*!
+     *  Function to check whether the interpolateInInterval function is implemented by the derived class.
+     *  \return True if interpolateInInterval function is implemented by the derived class (false for base class).
+     */
+    virtual bool isInterpolationInIntervalImplemented( )
+    {
+        return false;
+    }
+
     //! Function to return the condition of the current independent variable.
     /*!
      *  Function to return the condition of the current independent variable, i.e. whether the
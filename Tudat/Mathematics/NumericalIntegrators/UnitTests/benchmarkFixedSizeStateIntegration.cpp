@@ -0,0 +1,109 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      This program is not a unit test, and is not registered with ctest, since its output (integration steps per
+ *      second) depends on the machine and build type. It compares the throughput of the Runge-Kutta integrators for
+ *      fixed-size (Eigen::Vector6d) and dynamic-size (Eigen::VectorXd) state types, and returns a non-zero exit code
+ *      only if both state types do not produce the same integration.
+ *
+ */
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/utilityMacros.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+
+//! Function to compute the state derivative of a (normalized) Keplerian orbit, for a given state type.
+template< typename StateType >
+StateType computeKeplerOrbitStateDerivative( const double time, const StateType& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    StateType stateDerivative = StateType::Zero( state.rows( ), 1 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+    return stateDerivative;
+}
+
+//! Function to integrate (normalized) Keplerian orbit for a given state type, and time the integration.
+template< typename StateType >
+StateType integrateKeplerOrbit(
+        const std::shared_ptr< tudat::numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const StateType& initialState, const double finalTime, int& numberOfSteps, double& integrationTime )
+{
+    std::shared_ptr< tudat::numerical_integrators::NumericalIntegrator< double, StateType > > integrator =
+            tudat::numerical_integrators::createIntegrator< double, StateType >(
+                &computeKeplerOrbitStateDerivative< StateType >, initialState, integratorSettings );
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    numberOfSteps = 0;
+    double stepSize = integratorSettings->initialTimeStep_;
+    while( integrator->getCurrentIndependentVariable( ) < finalTime )
+    {
+        integrator->performIntegrationStep( stepSize );
+        stepSize = integrator->getNextStepSize( );
+        numberOfSteps++;
+    }
+    integrationTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    return integrator->getCurrentState( );
+}
+
+//! Execute benchmark of integration with fixed-size state types against integration with dynamic-size state types.
+int main( )
+{
+    using namespace tudat::numerical_integrators;
+
+    Eigen::Vector6d initialState;
+    initialState << 1.0, 0.0, 0.1, 0.0, 1.1, 0.05;
+    const double finalTime = 1000.0;
+
+    std::vector< std::pair< std::string, RungeKuttaCoefficients::CoefficientSets > > coefficientSets;
+    coefficientSets.push_back( std::make_pair( "RKF4(5)", RungeKuttaCoefficients::rungeKuttaFehlberg45 ) );
+    coefficientSets.push_back( std::make_pair( "RKF7(8)", RungeKuttaCoefficients::rungeKuttaFehlberg78 ) );
+    coefficientSets.push_back( std::make_pair( "DP8(7)", RungeKuttaCoefficients::rungeKutta87DormandPrince ) );
+
+    bool areResultsEqual = true;
+    for( unsigned int i = 0; i < coefficientSets.size( ); i++ )
+    {
+        std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                    0.0, 0.01, coefficientSets.at( i ).second, 1.0E-6, 1.0, 1.0E-12, 1.0E-12 );
+
+        int numberOfDynamicSizeSteps, numberOfFixedSizeSteps;
+        double dynamicSizeTime, fixedSizeTime;
+        const Eigen::VectorXd dynamicSizeState = integrateKeplerOrbit< Eigen::VectorXd >(
+                    integratorSettings, Eigen::VectorXd( initialState ), finalTime,
+                    numberOfDynamicSizeSteps, dynamicSizeTime );
+        const Eigen::Vector6d fixedSizeState = integrateKeplerOrbit< Eigen::Vector6d >(
+                    integratorSettings, initialState, finalTime, numberOfFixedSizeSteps, fixedSizeTime );
+
+        std::cout << coefficientSets.at( i ).first << ", " << numberOfFixedSizeSteps << " steps: dynamic-size state "
+                  << static_cast< double >( numberOfDynamicSizeSteps ) / dynamicSizeTime
+                  << " steps/s, fixed-size state "
+                  << static_cast< double >( numberOfFixedSizeSteps ) / fixedSizeTime << " steps/s, speed-up "
+                  << dynamicSizeTime / fixedSizeTime << std::endl;
+
+        if( numberOfDynamicSizeSteps != numberOfFixedSizeSteps ||
+                ( dynamicSizeState - fixedSizeState ).norm( ) > 1.0E-12 * fixedSizeState.norm( ) )
+        {
+            std::cerr << "Error, " << coefficientSets.at( i ).first
+                      << " integration differs between fixed- and dynamic-size states." << std::endl;
+            areResultsEqual = false;
+        }
+    }
+
+    return areResultsEqual ? 0 : 1;
+}
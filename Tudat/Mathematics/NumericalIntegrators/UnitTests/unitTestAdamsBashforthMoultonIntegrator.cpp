@@ -25,6 +25,7 @@
 
 #include <limits>
 #include <cmath>
+#include <stdexcept>
 
 #include <Eigen/Core>
 
@@ -33,6 +34,7 @@
 #include "Tudat/Mathematics/NumericalIntegrators/adamsBashforthMoultonIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+#include "Tudat/Mathematics/NumericalIntegrators/stateHistoryRingBuffer.h"
 #include "Tudat/Mathematics/NumericalIntegrators/UnitTests/numericalIntegratorTestFunctions.h"
 
 namespace tudat
@@ -164,6 +166,58 @@ BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_Compare78_VanDerPol
     BOOST_CHECK_SMALL( std::fabs( difference( 1 ) ), 5E-12 );
 }
 
+//! Test ring buffer used to store state and derivative histories
+BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_StateHistoryRingBuffer )
+{
+    StateHistoryRingBuffer< Eigen::VectorXd > buffer( 4, Eigen::VectorXd::Zero( 3 ) );
+    BOOST_CHECK_EQUAL( buffer.capacity( ), 4 );
+    BOOST_CHECK( buffer.empty( ) );
+    BOOST_CHECK_THROW( buffer.front( ), std::out_of_range );
+
+    // Fill buffer beyond capacity (wrapping around storage), oldest entries should be discarded.
+    const double* storageOfFirstEntry = nullptr;
+    for( int i = 0; i < 6; i++ )
+    {
+        buffer.push_front( Eigen::VectorXd::Constant( 3, static_cast< double >( i ) ) );
+        if( i == 0 )
+        {
+            storageOfFirstEntry = buffer.front( ).data( );
+        }
+    }
+    BOOST_CHECK_EQUAL( buffer.size( ), 4 );
+    for( unsigned int i = 0; i < buffer.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( buffer.at( i )( 0 ), static_cast< double >( 5 - i ) );
+    }
+    BOOST_CHECK_THROW( buffer.at( 4 ), std::out_of_range );
+    BOOST_CHECK_THROW( buffer.push_back( Eigen::VectorXd::Zero( 3 ) ), std::runtime_error );
+
+    // Check removal and addition at both ends.
+    buffer.pop_back( );
+    buffer.pop_front( );
+    BOOST_CHECK_EQUAL( buffer.size( ), 2 );
+    BOOST_CHECK_EQUAL( buffer.front( )( 0 ), 4.0 );
+    BOOST_CHECK_EQUAL( buffer.back( )( 0 ), 3.0 );
+    buffer.push_back( Eigen::VectorXd::Constant( 3, -1.0 ) );
+    BOOST_CHECK_EQUAL( buffer.back( )( 0 ), -1.0 );
+    buffer.truncate( 1 );
+    BOOST_CHECK_EQUAL( buffer.size( ), 1 );
+    BOOST_CHECK_EQUAL( buffer.back( )( 0 ), 4.0 );
+
+    // Check that entries retain their memory when reused.
+    buffer.clear( );
+    buffer.push_front( Eigen::VectorXd::Constant( 3, 2.0 ) );
+    BOOST_CHECK_EQUAL( buffer.front( ).data( ), storageOfFirstEntry );
+
+    // Check swapping of buffers.
+    StateHistoryRingBuffer< Eigen::VectorXd > otherBuffer( 2, Eigen::VectorXd::Zero( 3 ) );
+    buffer.swap( otherBuffer );
+    BOOST_CHECK( buffer.empty( ) );
+    BOOST_CHECK_EQUAL( buffer.capacity( ), 2 );
+    BOOST_CHECK_EQUAL( otherBuffer.size( ), 1 );
+    BOOST_CHECK_EQUAL( otherBuffer.front( ).data( ), storageOfFirstEntry );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
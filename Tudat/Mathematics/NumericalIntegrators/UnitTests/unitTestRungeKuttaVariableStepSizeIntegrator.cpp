@@ -28,15 +28,19 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKutta4Integrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
 #include "Tudat/Basics/testMacros.h"
+#include "Tudat/Basics/utilityMacros.h"
 #include "Tudat/Mathematics/NumericalIntegrators/UnitTests/numericalIntegratorTestFunctions.h"
 
+#include <cmath>
 #include <limits>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 namespace tudat
 {
@@ -313,6 +317,91 @@ BOOST_AUTO_TEST_CASE( testVariableStepIntegrateToFunction )
     BOOST_CHECK_CLOSE_FRACTION( fixedStepIntegratedValue.x( ), integratedValue.x( ), 1.0E-10 );
 }
 
+//! Function to compute the state derivative of a (normalized) Keplerian orbit, with additional constant mass rate
+//! for state size 7, for a given state type.
+template< typename StateType >
+StateType computeKeplerOrbitStateDerivative( const double time, const StateType& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    StateType stateDerivative = StateType::Zero( state.rows( ), 1 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+    if( state.rows( ) == 7 )
+    {
+        stateDerivative( 6 ) = -1.0E-3;
+    }
+    return stateDerivative;
+}
+
+//! Function to integrate (normalized) Keplerian orbit, created through createIntegrator for a given state type.
+template< typename StateType >
+StateType integrateKeplerOrbit(
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const StateType& initialState, const double finalTime, int& numberOfSteps, double& reachedTime )
+{
+    std::shared_ptr< numerical_integrators::NumericalIntegrator< double, StateType > > integrator =
+            numerical_integrators::createIntegrator< double, StateType >(
+                &computeKeplerOrbitStateDerivative< StateType >, initialState, integratorSettings );
+
+    numberOfSteps = 0;
+    double stepSize = integratorSettings->initialTimeStep_;
+    while( integrator->getCurrentIndependentVariable( ) < finalTime )
+    {
+        integrator->performIntegrationStep( stepSize );
+        stepSize = integrator->getNextStepSize( );
+        numberOfSteps++;
+    }
+    reachedTime = integrator->getCurrentIndependentVariable( );
+    return integrator->getCurrentState( );
+}
+
+//! Test whether fixed-size state types give the same results as dynamic-size state types.
+BOOST_AUTO_TEST_CASE( testFixedSizeStateIntegration )
+{
+    using namespace numerical_integrators;
+
+    Eigen::Vector7d initialState;
+    initialState << 1.0, 0.0, 0.1, 0.0, 1.1, 0.05, 1.0;
+
+    std::vector< std::shared_ptr< IntegratorSettings< double > > > integratorSettingsList;
+    integratorSettingsList.push_back( std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 0.01 ) );
+    integratorSettingsList.push_back( std::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                                          0.0, 0.01, RungeKuttaCoefficients::rungeKuttaFehlberg45,
+                                          1.0E-6, 1.0, 1.0E-10, 1.0E-10 ) );
+    integratorSettingsList.push_back( std::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                                          0.0, 0.01, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                                          1.0E-6, 1.0, 1.0E-12, 1.0E-12 ) );
+    integratorSettingsList.push_back( std::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                                          0.0, 0.01, RungeKuttaCoefficients::rungeKutta87DormandPrince,
+                                          1.0E-6, 1.0, 1.0E-12, 1.0E-12 ) );
+
+    for( unsigned int i = 0; i < integratorSettingsList.size( ); i++ )
+    {
+        int numberOfDynamicSizeSteps, numberOfFixedSizeSteps;
+        double reachedTime;
+
+        // Compare 6-dimensional states
+        Eigen::VectorXd dynamicSizeState = integrateKeplerOrbit< Eigen::VectorXd >(
+                    integratorSettingsList.at( i ), Eigen::VectorXd( initialState.segment( 0, 6 ) ), 10.0,
+                    numberOfDynamicSizeSteps, reachedTime );
+        Eigen::Vector6d fixedSizeState = integrateKeplerOrbit< Eigen::Vector6d >(
+                    integratorSettingsList.at( i ), Eigen::Vector6d( initialState.segment( 0, 6 ) ), 10.0,
+                    numberOfFixedSizeSteps, reachedTime );
+        BOOST_CHECK_EQUAL( numberOfDynamicSizeSteps, numberOfFixedSizeSteps );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( dynamicSizeState, fixedSizeState, 1.0E-14 );
+
+        // Compare 7-dimensional states
+        dynamicSizeState = integrateKeplerOrbit< Eigen::VectorXd >(
+                    integratorSettingsList.at( i ), Eigen::VectorXd( initialState ), 10.0,
+                    numberOfDynamicSizeSteps, reachedTime );
+        Eigen::Vector7d fixedSizeStateWithMass = integrateKeplerOrbit< Eigen::Vector7d >(
+                    integratorSettingsList.at( i ), initialState, 10.0, numberOfFixedSizeSteps, reachedTime );
+        BOOST_CHECK_EQUAL( numberOfDynamicSizeSteps, numberOfFixedSizeSteps );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( dynamicSizeState, fixedSizeStateWithMass, 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( fixedSizeStateWithMass( 6 ), 1.0 - 1.0E-3 * reachedTime, 1.0E-12 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
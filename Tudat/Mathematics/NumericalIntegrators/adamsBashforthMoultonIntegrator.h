@@ -21,7 +21,6 @@
 #ifndef TUDAT_ADAMS_BASHFORTH_MOULTON_INTEGRATOR_H
 #define TUDAT_ADAMS_BASHFORTH_MOULTON_INTEGRATOR_H
 
-#include <deque>
 #include <algorithm>
 #include <limits>
 
@@ -33,6 +32,7 @@
 #include "Tudat/Mathematics/NumericalIntegrators/reinitializableNumericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/stateHistoryRingBuffer.h"
 
 namespace tudat
 {
@@ -120,8 +120,11 @@ public:
         order_ = minimumOrder_;
         stepSize_ = 1.;
         fixedSingleStep_ = fixedStepSize_;
-        
-        // Start filling the state and state derivative history deques.
+
+        // Allocate state and state derivative histories, and workspace for integration steps.
+        initializeWorkspace( );
+
+        // Start filling the state and state derivative histories.
         stateHistory_.push_front( currentState_ );
         derivHistory_.push_front( this->stateDerivativeFunction_(
                                       currentIndependentVariable_, currentState_ ));
@@ -220,15 +223,11 @@ public:
     {
         // If stepSize is not same as old, clear the step-size dependent histories.
         if ( stepSize != stepSize_ ){
-            // Pop all values from the history deque (the history is
+            // Pop all values from the history (the history is
             // invalid as it is dependent on the stepSize), except for
             // the current state and state derivative.
-            while ( stateHistory_.size( ) > 1 ) {
-                stateHistory_.pop_back( );
-            }
-            while ( derivHistory_.size( ) > 1 ) {
-                derivHistory_.pop_back( );
-            }
+            stateHistory_.truncate( 1 );
+            derivHistory_.truncate( 1 );
             stepSize_ = stepSize;
             
             // Allow single step integrator to determine own stepsize
@@ -253,49 +252,40 @@ public:
 
         // Remove old elements so enough are left to calculate predicted and corrected.
         // max twice the order, to facilitatie a doubling, halving, and order change.
-        while ( stateHistory_.size( ) > order_ * 2 ) {
-            stateHistory_.pop_back( );
-        }
-        while ( derivHistory_.size( ) > order_ * 2 ) {
-            derivHistory_.pop_back( );
-        }
+        stateHistory_.truncate( order_ * 2 );
+        derivHistory_.truncate( order_ * 2 );
         unsigned int sizeStateHistory = stateHistory_.size( );
         unsigned int sizeDerivativeHistory = derivHistory_.size( );
         unsigned int possibleOrder = std::min( sizeStateHistory, sizeDerivativeHistory );
 
-        StateType correctedState;
-        StateType predictedState;
-
         // Check if enough history steps are available to perform AM
         // step if not use a single-step method.
         if ( possibleOrder < minimumOrder_ || possibleOrder < order_ ){
-            correctedState = performSingleStep( );
+            correctedState_ = performSingleStep( );
         } else {
-            StateType predictedState = performPredictorStep( order_, false );
+            performPredictorStep( order_, false, predictedState_ );
             predictedDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_ +
-                                                                   stepSize_, predictedState );
-            correctedState  = performCorrectorStep( predictedState, order_, false );
-            absoluteError_ = estimateAbsoluteError( predictedState, correctedState, order_ );
-            relativeError_ = estimateRelativeError( predictedState, correctedState, absoluteError_ );
+                                                                   stepSize_, predictedState_ );
+            performCorrectorStep( order_, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_, absoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, absoluteError_, relativeError_ );
         }
 
         // Change order to one that gives a higher predicted accuracy
         // Add tolenaces
-        StateType predictorAbsoluteError;
-        StateType predictorRelativeError;
-        
+
         // If order is not fixed, order is not max yet and enough
         // history is available, then predict the error of an order
         // more.
         if ( !fixedOrder_ && order_ < maximumOrder_ && order_ < possibleOrder ) {
-            predictedState = performPredictorStep( order_ + 1, false );
-            correctedState = performCorrectorStep( predictedState, order_ + 1, false );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, correctedState, order_ + 1 );
-            predictorRelativeError = estimateRelativeError( predictedState, correctedState, predictorAbsoluteError );
+            performPredictorStep( order_ + 1, false, predictedState_ );
+            performCorrectorStep( order_ + 1, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_ + 1, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, predictorAbsoluteError_, predictorRelativeError_ );
 
             // If the predicted error is less than the current error,
             // increase the error.
-            if ( errorCompare( predictorAbsoluteError, predictorRelativeError, absoluteError_, relativeError_ ) ){
+            if ( errorCompare( predictorAbsoluteError_, predictorRelativeError_, absoluteError_, relativeError_ ) ){
                 
                 order_++;
             }
@@ -303,33 +293,31 @@ public:
             // and there is enough history available, then predict the
             // error of an order less.
         } else if ( !fixedOrder_ && order_ > minimumOrder_ && order_ - 1 <= possibleOrder ) {
-            predictedState = performPredictorStep( order_ - 1, false );
-            correctedState = performCorrectorStep( predictedState, order_ - 1, false );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, correctedState, order_ - 1 );
-            predictorRelativeError = estimateRelativeError( predictedState, correctedState, predictorAbsoluteError );
+            performPredictorStep( order_ - 1, false, predictedState_ );
+            performCorrectorStep( order_ - 1, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_ - 1, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, predictorAbsoluteError_, predictorRelativeError_ );
             // If it is less than the current order, lower the order.
-            if ( errorCompare( predictorAbsoluteError, predictorRelativeError, absoluteError_, relativeError_ ) ){
+            if ( errorCompare( predictorAbsoluteError_, predictorRelativeError_, absoluteError_, relativeError_ ) ){
                 order_--;
             } else {
-                predictorAbsoluteError = absoluteError_;
-                predictorRelativeError = relativeError_;
+                predictorAbsoluteError_ = absoluteError_;
+                predictorRelativeError_ = relativeError_;
             }
         } else {
-            predictorAbsoluteError = absoluteError_;
-            predictorRelativeError = relativeError_;
+            predictorAbsoluteError_ = absoluteError_;
+            predictorRelativeError_ = relativeError_;
         }
 
         // If the error (after order change) is too big, stepsize
         // isn't fixed and will not become too small, then halve the
         // stepsize.
-        if ( errorTooLarge( predictorAbsoluteError, predictorRelativeError )
+        if ( errorTooLarge( predictorAbsoluteError_, predictorRelativeError_ )
              && std::fabs( stepSize_ / 2.0 )> minimumStepSize_ && !fixedStepSize_ ) {
 
-            // Set up new data for halving
-            std::deque< StateType > tempStateHistory;
-            std::deque< StateType > tempDerivativeHistory;
-            StateType midState = currentState_;
-            StateDerivativeType midDerivative = midState;
+            // Set up new data for halving (in pre-allocated temporary histories)
+            temporaryStateHistory_.clear( );
+            temporaryDerivativeHistory_.clear( );
             unsigned int interpolationStateIndex;
             unsigned int interpolationDerivativeIndex;
 
@@ -348,44 +336,44 @@ public:
             for( unsigned int i = 0; i < possibleHalvingOrder ; i++ ){
                 // If states are even, they already exist, no need to interpolate
                 if ( i % 2 == 0 ){
-                    tempStateHistory.push_back( stateHistory_.at( i / 2 ));
-                    tempDerivativeHistory.push_back( derivHistory_.at( i / 2 ));
+                    temporaryStateHistory_.push_back( stateHistory_.at( i / 2 ));
+                    temporaryDerivativeHistory_.push_back( derivHistory_.at( i / 2 ));
                 } else {
                     // Reset midpoint state and deriv to zero
-                    midState = 0 * midState;
-                    midDerivative = midState;
+                    midState_.setZero( );
+                    midDerivative_.setZero( );
                     interpolationDerivativeIndex = ( order_ - 1 ) * ( order_ - 1 ) + ( i - 1 ) / 2;
                     interpolationStateIndex = interpolationDerivativeIndex - order_ + 1;
                     for( unsigned int j = 0; j < order_; j++ ){
-                        midState += interpolationCoefficients[ interpolationStateIndex ][ j ] *
+                        midState_ += interpolationCoefficients[ interpolationStateIndex ][ j ] *
                                 stateHistory_.at( j ) + interpolationCoefficients[ interpolationStateIndex ][ order_ + j ] *
                                 derivHistory_.at( j ) * stepSize_;
-                        midDerivative += interpolationCoefficients[ interpolationDerivativeIndex ][ j ] *
+                        midDerivative_ += interpolationCoefficients[ interpolationDerivativeIndex ][ j ] *
                                 stateHistory_.at( j ) / stepSize_
                                 + interpolationCoefficients[ interpolationDerivativeIndex ][ order_ + j ] *
                                 derivHistory_.at( j );
                     }
-                    tempStateHistory.push_back( midState );
-                    tempDerivativeHistory.push_back( midDerivative );
+                    temporaryStateHistory_.push_back( midState_ );
+                    temporaryDerivativeHistory_.push_back( midDerivative_ );
                 }
             }
             
-            // Set the new history and stepsize
-            stateHistory_ = tempStateHistory;
-            derivHistory_ = tempDerivativeHistory;
+            // Set the new history (swapping memory with temporary histories) and stepsize
+            stateHistory_.swap( temporaryStateHistory_ );
+            derivHistory_.swap( temporaryDerivativeHistory_ );
             stepSize_ = stepSize_ / 2.0;
             
             // Temporarily turn halving off.
             fixedStepSize_ = true;
-            StateType halvedState = performIntegrationStep( );
+            performIntegrationStep( );
             fixedStepSize_ = false;
-            return halvedState;
+            return currentState_;
         } // end if ( errorTooLarge( ...
         
         // If the error (after order change ) is too small, the
         // stepsize isn't fixed and the and will not become too big,
         // then double the stepsize.
-        if ( errorTooSmall( predictorAbsoluteError, predictorRelativeError )
+        if ( errorTooSmall( predictorAbsoluteError_, predictorRelativeError_ )
              && sizeDerivativeHistory >= 2 * order_
              && std::fabs( stepSize_ * 2.0 ) <= maximumStepSize_ && !fixedStepSize_ ) {
             
@@ -398,39 +386,39 @@ public:
             // 2. The difference in the derivative of the predicted state (predictedDerivative_)
             //    at the normal stepsize (already computed) with the doubled stepsize (not computed)
             //    is neglibile. This assumption saves one function evaluation.
-            // It's possible to reuse previously defined variables here except for correctedState
+            // It's possible to reuse previously defined variables here except for correctedState_
             // which is still used below.
-            predictedState = performPredictorStep( order_ , true );
-            StateType doubleStepCorrectedState = performCorrectorStep( predictedState, order_, true );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, doubleStepCorrectedState, order_ );
-            predictorRelativeError = estimateRelativeError( predictedState, doubleStepCorrectedState,
-                                                            predictorAbsoluteError );
+            performPredictorStep( order_ , true, predictedState_ );
+            performCorrectorStep( order_, true, doubleStepCorrectedState_ );
+            estimateAbsoluteError( predictedState_, doubleStepCorrectedState_, order_, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, doubleStepCorrectedState_,
+                                   predictorAbsoluteError_, predictorRelativeError_ );
 
             // Only update the history if the error will not be too large
-            if ( !errorTooLarge( predictorAbsoluteError, predictorRelativeError ) ) {
+            if ( !errorTooLarge( predictorAbsoluteError_, predictorRelativeError_ ) ) {
                 // Note that the history should be at least 7 to allow successful
                 // continuation of the AM scheme.
-                std::deque< StateType > tempStateHistory;
-                std::deque< StateType > tempDerivativeHistory;
+                temporaryStateHistory_.clear( );
+                temporaryDerivativeHistory_.clear( );
                 
                 // Use old history to fill new history, skipping every other entry starting at 1
                 for( unsigned int i = 1; i < sizeStateHistory; i += 2 ) {
-                    tempStateHistory.push_back( stateHistory_.at( i ));
+                    temporaryStateHistory_.push_back( stateHistory_.at( i ));
                 }
                 for( unsigned int i = 1; i < sizeDerivativeHistory; i += 2 ){
-                    tempDerivativeHistory.push_back( derivHistory_.at( i ));
+                    temporaryDerivativeHistory_.push_back( derivHistory_.at( i ));
                 }
                 
-                // Set the new history and stepsize
-                stateHistory_ = tempStateHistory;
-                derivHistory_ = tempDerivativeHistory;
+                // Set the new history (swapping memory with temporary histories) and stepsize
+                stateHistory_.swap( temporaryStateHistory_ );
+                derivHistory_.swap( temporaryDerivativeHistory_ );
                 stepSize_ = stepSize_ * 2.0;
             }
         } // end if ( errorTooSmall( ...
 
         // Move computed state to history
         currentIndependentVariable_ += lastStepSize_;
-        currentState_ = correctedState;
+        currentState_ = correctedState_;
         stateHistory_.push_front( currentState_ );
         derivHistory_.push_front( this->stateDerivativeFunction_(
                                       currentIndependentVariable_, currentState_ ) );
@@ -752,6 +740,37 @@ protected:
      */
     const static double interpolationCoefficients[ 132 ][ 24 ];
 
+    //! Maximum number of entries in state and derivative histories.
+    /*!
+     * Maximum number of entries in state and derivative histories: twice the maximum order for which coefficients are
+     * available (to allow doubling of the step size), plus one entry for the new state and one for a rollback.
+     */
+    static const unsigned int maximumHistorySize = 2 * 12 + 2;
+
+    //! Function to allocate state and derivative histories, and workspace for integration steps.
+    /*!
+     * Function to allocate state and derivative histories, and workspace for integration steps, with entries of the
+     * size of the current state, so that no heap allocations are needed when performing integration steps.
+     */
+    void initializeWorkspace( )
+    {
+        stateHistory_ = StateHistoryRingBuffer< StateType >( maximumHistorySize, currentState_ );
+        derivHistory_ = StateHistoryRingBuffer< StateType >( maximumHistorySize, currentState_ );
+        temporaryStateHistory_ = StateHistoryRingBuffer< StateType >( maximumHistorySize, currentState_ );
+        temporaryDerivativeHistory_ = StateHistoryRingBuffer< StateType >( maximumHistorySize, currentState_ );
+
+        predictedState_ = currentState_;
+        correctedState_ = currentState_;
+        doubleStepCorrectedState_ = currentState_;
+        absoluteError_ = currentState_;
+        relativeError_ = currentState_;
+        predictorAbsoluteError_ = currentState_;
+        predictorRelativeError_ = currentState_;
+        predictedDerivative_ = currentState_;
+        midState_ = currentState_;
+        midDerivative_ = currentState_;
+    }
+
     //! Perform integration step.
     /*!
      * Perform integration step using built-in Runge-Kutta fourth
@@ -800,7 +819,7 @@ protected:
         }
         
         // Even if a different step size is suggested, let's stick with the old one, since the goal is to start
-        // filling up the deque at a constant stepsize interval
+        // filling up the history at a constant stepsize interval
         stepSize_ = lastStepSize_; // singleStepIntegrator_.getNextStepSize( );
 
         // Disregard the ABAM error control in the performIntegrationStep function when using single steps.
@@ -815,40 +834,38 @@ protected:
      * Using the order find predicted estimate using the Adams-Bashforth predictor
      * \param order Order of the integration.
      * \param doubleStep Boolean if stepsize should be considered double, true for estimating doubling error.
-     * \return state after predictor step
+     * \param predictedState State after predictor step (returned by reference, to reuse its memory).
      */
-    StateType performPredictorStep( unsigned int order, bool doubleStep )
+    void performPredictorStep( unsigned int order, bool doubleStep, StateType& predictedState )
     {
         // Calculate predicted state
         unsigned int stepsToSkip = static_cast< unsigned int>( doubleStep );
         TimeStepType stepSize = stepSize_ * static_cast< double >( stepsToSkip + 1 );
-        StateType predictedState = stateHistory_.at( stepsToSkip );
+        predictedState = stateHistory_.at( stepsToSkip );
         for ( unsigned int i = 0; i < order; i++ ){
             predictedState += extrapolationCoefficients[ order * 2 - 2 ][ i ] * stepSize *
                     derivHistory_.at( i * ( stepsToSkip + 1 ) + stepsToSkip );
         }
-        return predictedState;
     }
 
     //! Perform correcter step.
     /*!
-     * Using the order and predicted state, find corrected estimate using the Adams-Moulton corrector
-     * \param predictedState by the predictor.
+     * Using the order and derivative of the predicted state (predictedDerivative_), find corrected estimate using the
+     * Adams-Moulton corrector
      * \param order of the integration.
      * \param doubleStep boolean if stepsize should be considered double, true for estimating doubling error.
-     * \return  after corrector step
+     * \param correctedState State after corrector step (returned by reference, to reuse its memory).
      */
-    StateType performCorrectorStep( StateType predictedState, unsigned int order, bool doubleStep )
+    void performCorrectorStep( unsigned int order, bool doubleStep, StateType& correctedState )
     {
         unsigned int stepsToSkip = static_cast< unsigned int>( doubleStep );
         TimeStepType stepSize = stepSize_ * static_cast< double >( stepsToSkip + 1 );
-        StateType correctedState = stateHistory_.at( stepsToSkip ) + extrapolationCoefficients[ order * 2 - 1 ][ 0 ] *
+        correctedState = stateHistory_.at( stepsToSkip ) + extrapolationCoefficients[ order * 2 - 1 ][ 0 ] *
                 stepSize * predictedDerivative_;
         for ( unsigned int i = 1; i < order; i++ ){
             correctedState += stepSize * extrapolationCoefficients[ order * 2 - 1 ][ i ] *
                     derivHistory_.at( ( i - 1 ) * ( stepsToSkip + 1 ) + stepsToSkip );
         }
-        return correctedState;
     }
 
     //! Estimate the absolute error
@@ -857,12 +874,13 @@ protected:
      * \param predictedState by the predictor.
      * \param correctedState by the corrector.
      * \param order of the integration.
-     * \return absolute error vector.
+     * \param absoluteError Absolute error vector (returned by reference, to reuse its memory).
      */
-    StateType estimateAbsoluteError( StateType predictedState, StateType correctedState, unsigned int order )
+    void estimateAbsoluteError( const StateType& predictedState, const StateType& correctedState, unsigned int order,
+                                StateType& absoluteError )
     {
         // Estimate the maximum truncation error
-        return truncationErrorCoefficients[ order ] * ( predictedState - correctedState ).cwiseAbs( ).array( );
+        absoluteError = truncationErrorCoefficients[ order ] * ( predictedState - correctedState ).cwiseAbs( ).array( );
     }
 
     //! Estimate the relative error
@@ -871,12 +889,14 @@ protected:
      * \param predictedState by the predictor.
      * \param correctedState by the corrector.
      * \param absoluteError
-     * \return relative error vector.
+     * \param relativeError Relative error vector (returned by reference, to reuse its memory).
      */
-    StateType estimateRelativeError( StateType predictedState, StateType correctedState, StateType absoluteError )
+    void estimateRelativeError( const StateType& predictedState, const StateType& correctedState,
+                                const StateType& absoluteError, StateType& relativeError )
     {
         // Estimate the maximum truncation error
-        return absoluteError.cwiseQuotient( ( correctedState.cwiseAbs( ) ).cwiseMax( predictedState.cwiseAbs( ) ) );
+        relativeError = absoluteError.cwiseQuotient(
+                    ( correctedState.cwiseAbs( ) ).cwiseMax( predictedState.cwiseAbs( ) ) );
     }
 
     //! Compare two errors
@@ -889,21 +909,21 @@ protected:
      * \param relativeError2 relative error two.
      * \return true if one is better than two, false otherwise.
      */
-    bool errorCompare( StateType absoluteError1, StateType relativeError1,
-                       StateType absoluteError2, StateType relativeError2 )
+    bool errorCompare( const StateType& absoluteError1, const StateType& relativeError1,
+                       const StateType& absoluteError2, const StateType& relativeError2 )
     {
         // Find compound error
-        StateType c1 = absoluteError1.cwiseMin( relativeError1 );
-        StateType c2 = absoluteError2.cwiseMin( relativeError2 );
         bool oneBetter = true;
         if( strictCompare_ ){
             // Needs to be better or equal for each component
-            for( int i = 0; i < c1.size( ); ++i ){
-                oneBetter = oneBetter && ( c1( i ) <= c2( i ) );
+            for( int i = 0; i < absoluteError1.size( ); ++i ){
+                oneBetter = oneBetter && ( std::min( absoluteError1( i ), relativeError1( i ) ) <=
+                                           std::min( absoluteError2( i ), relativeError2( i ) ) );
             }
         } else {
             // Needs to be overal better
-            oneBetter = ( c1.norm( ) <= c2.norm( ) );
+            oneBetter = ( absoluteError1.cwiseMin( relativeError1 ).norm( ) <=
+                          absoluteError2.cwiseMin( relativeError2 ).norm( ) );
         }
         return oneBetter;
     }
@@ -916,7 +936,7 @@ protected:
      * \param relativeError relative error.
      * \return true if one error is too big, false if within limits
      */
-    bool errorTooLarge( StateType absoluteError, StateType relativeError )
+    bool errorTooLarge( const StateType& absoluteError, const StateType& relativeError )
     {
         bool belowLimit = true;
         // All components needs to be below the upper limit (tol)
@@ -936,7 +956,7 @@ protected:
      * \param relativeError relative error.
      * \return true if one error is too small, false if within limits
      */
-    bool errorTooSmall( StateType absoluteError, StateType relativeError )
+    bool errorTooSmall( const StateType& absoluteError, const StateType& relativeError )
     {
         bool belowLimit = true;
         // All components need to be above lower limit ( tol / bw )
@@ -964,15 +984,65 @@ protected:
 
     //! State history.
     /*!
-     * History of states, dynamic deque size depends on order.
+     * History of states, number of entries depends on order (allocated for maximum order on construction).
      */
-    std::deque<StateType> stateHistory_;
+    StateHistoryRingBuffer< StateType > stateHistory_;
 
     //! Derivative history.
     /*!
-     * History of derivatives, dynamic deque size depends on order.
+     * History of derivatives, number of entries depends on order (allocated for maximum order on construction).
+     */
+    StateHistoryRingBuffer< StateType > derivHistory_;
+
+    //! Temporary state history.
+    /*!
+     * Temporary state history, used when resampling the history after halving or doubling the step size (after which
+     * its memory is swapped with stateHistory_).
+     */
+    StateHistoryRingBuffer< StateType > temporaryStateHistory_;
+
+    //! Temporary derivative history.
+    /*!
+     * Temporary derivative history, used when resampling the history after halving or doubling the step size (after
+     * which its memory is swapped with derivHistory_).
      */
-    std::deque<StateType> derivHistory_;
+    StateHistoryRingBuffer< StateType > temporaryDerivativeHistory_;
+
+    //! Predicted state.
+    /*!
+     * Predicted state, as computed by performPredictorStep( ) (pre-allocated workspace).
+     */
+    StateType predictedState_;
+
+    //! Corrected state.
+    /*!
+     * Corrected state, as computed by performCorrectorStep( ) (pre-allocated workspace).
+     */
+    StateType correctedState_;
+
+    //! Corrected state for doubled step size.
+    /*!
+     * Corrected state, as computed by performCorrectorStep( ) when estimating doubling error (pre-allocated workspace).
+     */
+    StateType doubleStepCorrectedState_;
+
+    //! Absolute truncation error for changed order or step size.
+    /*!
+     * Absolute truncation error, estimated for order or step size change (pre-allocated workspace).
+     */
+    StateType predictorAbsoluteError_;
+
+    //! Relative truncation error for changed order or step size.
+    /*!
+     * Relative truncation error, estimated for order or step size change (pre-allocated workspace).
+     */
+    StateType predictorRelativeError_;
+
+    //! Interpolated state at mid-point, used during halving (pre-allocated workspace).
+    StateType midState_;
+
+    //! Interpolated state derivative at mid-point, used during halving (pre-allocated workspace).
+    StateDerivativeType midDerivative_;
 
     //! Last state.
     /*!
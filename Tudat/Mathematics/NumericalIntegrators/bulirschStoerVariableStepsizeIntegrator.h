@@ -126,14 +126,7 @@ public:
         minimumFactorDecreaseForNextStepSize_( minimumFactorDecreaseForNextStepSize ),
         isMinimumStepSizeViolated_( false )
     {
-        maximumStepIndex_ = sequence_.size( ) - 1;
-        subSteps_.resize( maximumStepIndex_ + 1 );
-
-        integratedStates_.resize( maximumStepIndex_ + 1  );
-        for( unsigned int i = 0; i < maximumStepIndex_ + 1 ; i++ )
-        {
-            integratedStates_[ i ].resize( maximumStepIndex_ + 1  );
-        }
+        initializeWorkspace( );
     }
 
     //! Default constructor.
@@ -179,14 +172,7 @@ public:
         minimumFactorDecreaseForNextStepSize_( minimumFactorDecreaseForNextStepSize ),
         isMinimumStepSizeViolated_( false )
     {
-        maximumStepIndex_ = sequence_.size( ) - 1;
-        subSteps_.resize( maximumStepIndex_ + 1 );
-
-        integratedStates_.resize( maximumStepIndex_ + 1  );
-        for( unsigned int i = 0; i < maximumStepIndex_ + 1 ; i++ )
-        {
-            integratedStates_[ i ].resize( maximumStepIndex_ + 1  );
-        }
+        initializeWorkspace( );
     }
 
     ~BulirschStoerVariableStepSizeIntegrator( ){ }
@@ -224,10 +210,6 @@ public:
      */
     virtual StateType performIntegrationStep( const TimeStepType stepSize )
     {
-        StateType stateAtFirstPoint_;
-        StateType stateAtCenterPoint_;
-        StateType stateAtLastPoint_;
-
         bool stepSuccessful = 0;
 
         // Compute sub steps to take.
@@ -249,14 +231,15 @@ public:
             IndependentVariableType independentVariableAtFirstPoint_ = currentIndependentVariable_;
             for ( unsigned int j = 0; j < sequence_.at( i ) - 1; j++ )
             {
-                stateAtLastPoint_ = executeMidPointMethod(
-                            stateAtFirstPoint_, stateAtCenterPoint_,
-                            independentVariableAtFirstPoint_, subSteps_.at( i ) );
+                executeMidPointMethod( stateAtFirstPoint_, stateAtCenterPoint_,
+                                       independentVariableAtFirstPoint_, subSteps_.at( i ), stateAtLastPoint_ );
 
                 if ( j < sequence_.at( i ) - 2 )
                 {
-                    stateAtFirstPoint_ = stateAtCenterPoint_;
-                    stateAtCenterPoint_ = stateAtLastPoint_;
+                    // Shift states by swapping their memory (first <- center, center <- last), the state at the last
+                    // point is overwritten in the next iteration.
+                    stateAtFirstPoint_.swap( stateAtCenterPoint_ );
+                    stateAtCenterPoint_.swap( stateAtLastPoint_ );
                     independentVariableAtFirstPoint_ += subSteps_.at( i );
                 }
             }
@@ -276,11 +259,9 @@ public:
 
             if( i == maximumStepIndex_ )
             {
-                const StateType errorTolerance_ =
-                        ( integratedStates_.at( i ).at( i ).array( ).abs( ) * relativeErrorTolerance_.array( ) ).matrix( )
-                        + absoluteErrorTolerance_;
-
-                double maximumAllowableErrorValue = errorTolerance_.array( ).maxCoeff( );
+                double maximumAllowableErrorValue =
+                        ( integratedStates_.at( i ).at( i ).array( ).abs( ) * relativeErrorTolerance_.array( )
+                          + absoluteErrorTolerance_.array( ) ).maxCoeff( );
                 double maximumErrorValue = ( integratedStates_.at( i ).at( i ) - integratedStates_.at( i ).at( i - 1 ) ).array( ).abs( ).maxCoeff( );
 
                 errorScaleTerm = safetyFactorForNextStepSize_ * std::pow( maximumAllowableErrorValue / maximumErrorValue,
@@ -481,23 +462,55 @@ private:
      * \param stateAtCenterPoint State at center point.
      * \param independentVariableAtFirstPoint Independent variable at first point.
      * \param subStepSize Sub step size between successive states used by mid-point method.
-     * \return Result of midpoint method
+     * \param stateAtLastPoint Result of midpoint method (returned by reference, to reuse its memory).
      */
-    StateType executeMidPointMethod( StateType stateAtFirstPoint, StateType stateAtCenterPoint,
-                                     const IndependentVariableType independentVariableAtFirstPoint,
-                                     const IndependentVariableType subStepSize )
+    void executeMidPointMethod( const StateType& stateAtFirstPoint, const StateType& stateAtCenterPoint,
+                                const IndependentVariableType independentVariableAtFirstPoint,
+                                const IndependentVariableType subStepSize, StateType& stateAtLastPoint )
     {
-        return stateAtFirstPoint + 2.0 * subStepSize
+        stateAtLastPoint = stateAtFirstPoint + 2.0 * subStepSize
                 * this->stateDerivativeFunction_( independentVariableAtFirstPoint + subStepSize,
                                                   stateAtCenterPoint );
     }
 
+    //! Function to allocate the extrapolation table and workspace for integration steps.
+    /*!
+     * Function to allocate the extrapolation table and workspace for integration steps, with entries of the size of
+     * the current state, so that no heap allocations are needed when performing integration steps.
+     */
+    void initializeWorkspace( )
+    {
+        maximumStepIndex_ = sequence_.size( ) - 1;
+        subSteps_.resize( maximumStepIndex_ + 1 );
+
+        integratedStates_.resize( maximumStepIndex_ + 1  );
+        for( unsigned int i = 0; i < maximumStepIndex_ + 1 ; i++ )
+        {
+            integratedStates_[ i ].resize( maximumStepIndex_ + 1, currentState_ );
+        }
+
+        stateAtFirstPoint_ = currentState_;
+        stateAtCenterPoint_ = currentState_;
+        stateAtLastPoint_ = currentState_;
+        lastState_ = currentState_;
+    }
+
+    //! Extrapolation table, with results of modified mid-point method (first index) and extrapolations (second index).
     std::vector< std::vector< StateType > > integratedStates_;
 
     unsigned int maximumStepIndex_;
 
     std::vector< double > subSteps_;
 
+    //! State at first point of current mid-point method evaluation (pre-allocated workspace).
+    StateType stateAtFirstPoint_;
+
+    //! State at center point of current mid-point method evaluation (pre-allocated workspace).
+    StateType stateAtCenterPoint_;
+
+    //! State at last point of current mid-point method evaluation (pre-allocated workspace).
+    StateType stateAtLastPoint_;
+
 };
 
 extern template class BulirschStoerVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
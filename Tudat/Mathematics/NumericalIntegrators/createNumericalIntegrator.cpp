@@ -53,6 +53,17 @@ Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic >, long double > > cr
         const Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings );
 
 
+template std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::Vector6d,
+Eigen::Vector6d, double > > createIntegrator< double, Eigen::Vector6d, double >(
+        std::function< Eigen::Vector6d( const double, const Eigen::Vector6d& ) > stateDerivativeFunction,
+        const Eigen::Vector6d initialState, std::shared_ptr< IntegratorSettings< double > > integratorSettings );
+
+template std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::Vector7d,
+Eigen::Vector7d, double > > createIntegrator< double, Eigen::Vector7d, double >(
+        std::function< Eigen::Vector7d( const double, const Eigen::Vector7d& ) > stateDerivativeFunction,
+        const Eigen::Vector7d initialState, std::shared_ptr< IntegratorSettings< double > > integratorSettings );
+
+
 } // namespace numerical_integrators
 
 } // namespace tudat
@@ -800,6 +800,17 @@ Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double > > createIntegrato
         std::function< Eigen::Matrix< long double, Eigen::Dynamic, 1 >(
             const Time, const Eigen::Matrix< long double, Eigen::Dynamic, 1 >& ) > stateDerivativeFunction,
         const Eigen::Matrix< long double, Eigen::Dynamic, 1 > initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings );
+
+extern template std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::Vector6d,
+Eigen::Vector6d, double > > createIntegrator< double, Eigen::Vector6d, double >(
+        std::function< Eigen::Vector6d( const double, const Eigen::Vector6d& ) > stateDerivativeFunction,
+        const Eigen::Vector6d initialState, std::shared_ptr< IntegratorSettings< double > > integratorSettings );
+
+extern template std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::Vector7d,
+Eigen::Vector7d, double > > createIntegrator< double, Eigen::Vector7d, double >(
+        std::function< Eigen::Vector7d( const double, const Eigen::Vector7d& ) > stateDerivativeFunction,
+        const Eigen::Vector7d initialState, std::shared_ptr< IntegratorSettings< double > > integratorSettings );
+
 } // namespace numerical_integrators
 
 } // namespace tudat
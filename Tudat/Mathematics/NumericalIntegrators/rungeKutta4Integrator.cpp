@@ -7,6 +7,7 @@ namespace numerical_integrators
 
 template class RungeKutta4Integrator < double, Eigen::VectorXd, Eigen::VectorXd >;
 template class RungeKutta4Integrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+template class RungeKutta4Integrator < double, Eigen::Vector7d, Eigen::Vector7d >;
 template class RungeKutta4Integrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
 } // namespace numerical_integrators
@@ -109,49 +109,39 @@ public:
         lastIndependentVariable_ = currentIndependentVariable_;
         lastState_ = currentState_;
 
-        // Calculate k1-k4.
-        StateDerivativeType k1, k2, k3, k4;
-        for ( unsigned int i = 1; i <= 4; i++ )
+        // Calculate k1-k4, stored in pre-allocated members (so that no memory is allocated for fixed-size states, or
+        // dynamic-size states of constant size). Return immediately if the propagation termination condition has been
+        // reached while computing k1, k2, k3 or k4 (the current state, which is not recomputed yet, will be discarded).
+        k1_ = stepSize * this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+        if ( isTerminationConditionReachedDuringStep( currentIndependentVariable_ ) )
         {
-            IndependentVariableType time;
-            StateType state;
-            switch ( i )
-            {
-            case 1:
-                time = currentIndependentVariable_;
-                state = currentState_;
-                k1 = stepSize * this->stateDerivativeFunction_( time, state );
-                break;
-            case 2:
-                time = currentIndependentVariable_ + stepSize / 2.0;
-                state = static_cast< StateType >( currentState_ + k1 / 2.0 );
-                k2 = stepSize * this->stateDerivativeFunction_( time, state );
-                break;
-            case 3:
-                time = currentIndependentVariable_ + stepSize / 2.0;
-                state = static_cast< StateType >( currentState_ + k2 / 2.0 );
-                k3 = stepSize * this->stateDerivativeFunction_( time, state );
-                break;
-            case 4:
-                time = currentIndependentVariable_ + stepSize;
-                state = static_cast< StateType >( currentState_ + k3 );
-                k4 = stepSize * this->stateDerivativeFunction_( time, state );
-                break;
-            }
-
-            // Check if propagation should terminate because the propagation termination condition has been reached
-            // while computing k1, k2, k3 or k4. If so, return immediately the current state (not recomputed yet),
-            // which will be discarded.
-            if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
-            {
-                this->propagationTerminationConditionReachedDuringStep_ = true;
-                return currentState_;
-            }
+            return currentState_;
+        }
+
+        intermediateState_ = currentState_ + k1_ / 2.0;
+        k2_ = stepSize * this->stateDerivativeFunction_( currentIndependentVariable_ + stepSize / 2.0, intermediateState_ );
+        if ( isTerminationConditionReachedDuringStep( currentIndependentVariable_ + stepSize / 2.0 ) )
+        {
+            return currentState_;
+        }
+
+        intermediateState_ = currentState_ + k2_ / 2.0;
+        k3_ = stepSize * this->stateDerivativeFunction_( currentIndependentVariable_ + stepSize / 2.0, intermediateState_ );
+        if ( isTerminationConditionReachedDuringStep( currentIndependentVariable_ + stepSize / 2.0 ) )
+        {
+            return currentState_;
+        }
+
+        intermediateState_ = currentState_ + k3_;
+        k4_ = stepSize * this->stateDerivativeFunction_( currentIndependentVariable_ + stepSize, intermediateState_ );
+        if ( isTerminationConditionReachedDuringStep( currentIndependentVariable_ + stepSize ) )
+        {
+            return currentState_;
         }
 
         stepSize_ = stepSize;
         currentIndependentVariable_ += stepSize_;
-        currentState_ += ( k1 + 2.0 * k2 + 2.0 * k3 + k4 ) / 6.0;
+        currentState_ += ( k1_ + 2.0 * k2_ + 2.0 * k3_ + k4_ ) / 6.0;
 
         // Return the integration result.
         return currentState_;
@@ -236,6 +226,23 @@ public:
 
 protected:
 
+    //! Function to check whether the propagation termination condition has been reached during the current step.
+    /*!
+     * Function to check whether the propagation termination condition has been reached while computing one of the
+     * stages of the current step, setting the associated flag if this is the case.
+     * \param time Independent variable at which the stage was computed.
+     * \return True if the propagation termination condition has been reached.
+     */
+    bool isTerminationConditionReachedDuringStep( const IndependentVariableType time )
+    {
+        if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
+        {
+            this->propagationTerminationConditionReachedDuringStep_ = true;
+            return true;
+        }
+        return false;
+    }
+
     //! Last used step size.
     /*!
      * Last used step size, passed to either integrateTo() or performIntegrationStep().
@@ -266,10 +273,17 @@ protected:
      */
     StateType lastState_;
 
+    //! Intermediate state at which the state derivative is evaluated (pre-allocated).
+    StateType intermediateState_;
+
+    //! State increments k1-k4 of the current step (pre-allocated).
+    StateDerivativeType k1_, k2_, k3_, k4_;
+
 };
 
 extern template class RungeKutta4Integrator < double, Eigen::VectorXd, Eigen::VectorXd >;
 extern template class RungeKutta4Integrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+extern template class RungeKutta4Integrator < double, Eigen::Vector7d, Eigen::Vector7d >;
 extern template class RungeKutta4Integrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
 
@@ -7,6 +7,7 @@ namespace numerical_integrators
 
 template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
 template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::Vector7d, Eigen::Vector7d >;
 template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
 } // namespace numerical_integrators
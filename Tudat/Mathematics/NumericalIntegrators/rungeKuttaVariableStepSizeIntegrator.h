@@ -145,6 +145,8 @@ public:
                         this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
                         std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8 );
         }
+
+        initializeStepComputation( );
     }
 
     //! Default constructor.
@@ -208,6 +210,8 @@ public:
                         this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
                         std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8 );
         }
+
+        initializeStepComputation( );
     }
 
     //! Get step size of the next step.
@@ -343,6 +347,29 @@ public:
 
 protected:
 
+    //! Function to set up the quantities that are re-used in each integration step.
+    /*!
+     * Function to set up the quantities that are re-used in each integration step: the indices of the non-zero entries
+     * in each row of the a-coefficient matrix of the Butcher tableau (so that zero entries are skipped when computing
+     * the intermediate states), and the memory for the state derivatives of all stages.
+     */
+    void initializeStepComputation( )
+    {
+        const int numberOfStages = this->coefficients_.cCoefficients.rows( );
+        nonZeroACoefficientIndices_.resize( numberOfStages );
+        for ( int stage = 0; stage < numberOfStages; stage++ )
+        {
+            for ( int column = 0; column < stage; column++ )
+            {
+                if ( this->coefficients_.aCoefficients( stage, column ) != 0.0 )
+                {
+                    nonZeroACoefficientIndices_[ stage ].push_back( column );
+                }
+            }
+        }
+        currentStateDerivatives_.reserve( numberOfStages );
+    }
+
     //! Computes the next step size and validates the result.
     /*!
      * Computes the next step size based on a higher and lower order estimate, determines if the
@@ -483,10 +510,23 @@ protected:
     //! Boolean denoting whether step size control is to be used
     bool useStepSizeControl_;
 
+    //! Indices of the non-zero entries in each row of the a-coefficient matrix of the Butcher tableau.
+    std::vector< std::vector< int > > nonZeroACoefficientIndices_;
+
+    //! Intermediate state at which the state derivative of the current stage is evaluated (pre-allocated).
+    StateType intermediateState_;
+
+    //! Lower order estimate of the state at the end of the current step (pre-allocated).
+    StateType lowerOrderEstimate_;
+
+    //! Higher order estimate of the state at the end of the current step (pre-allocated).
+    StateType higherOrderEstimate_;
+
 };
 
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::Vector7d, Eigen::Vector7d >;
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
 
@@ -496,30 +536,30 @@ StateType
 RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
 ::performIntegrationStep( const TimeStepType stepSize )
 {
-    // Define and allocated vector for the number of stages.
+    // Reset vector of state derivatives (memory for all stages is retained between steps).
     currentStateDerivatives_.clear( );
-    currentStateDerivatives_.reserve( this->coefficients_.cCoefficients.rows( ) );
 
-    // Define lower and higher order estimates.
-    StateType lowerOrderEstimate( this->currentState_ ), higherOrderEstimate( this->currentState_ );
+    // Initialize lower and higher order estimates. For fixed-size states, and dynamic-size states of constant size,
+    // these (and the intermediate state below) are assigned without memory allocation.
+    lowerOrderEstimate_ = this->currentState_;
+    higherOrderEstimate_ = this->currentState_;
 
     // Compute the k_i state derivatives per stage.
     for ( int stage = 0; stage < this->coefficients_.cCoefficients.rows( ); stage++ )
     {
-        // Compute the intermediate state to pass to the state derivative for this stage.
-        StateType intermediateState( this->currentState_ );
-
-        // Compute the intermediate state.
-        for ( int column = 0; column < stage; column++ )
+        // Compute the intermediate state to pass to the state derivative for this stage, using only the non-zero
+        // coefficients of the Butcher tableau.
+        intermediateState_ = this->currentState_;
+        for ( const int column : nonZeroACoefficientIndices_[ stage ] )
         {
-            intermediateState += stepSize * this->coefficients_.aCoefficients( stage, column ) *
+            intermediateState_ += stepSize * this->coefficients_.aCoefficients( stage, column ) *
                     currentStateDerivatives_[ column ];
         }
 
         // Compute the state derivative.
         const IndependentVariableType time = this->currentIndependentVariable_ +
                 this->coefficients_.cCoefficients( stage ) * stepSize;
-        currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+        currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState_ ) );
 
         // Check if propagation should terminate because the propagation termination condition has been reached
         // while computing the intermediate state.
@@ -530,16 +570,22 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
             return this->currentState_;
         }
 
-        // Update the estimate.
-        lowerOrderEstimate += this->coefficients_.bCoefficients( 0, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
-        higherOrderEstimate += this->coefficients_.bCoefficients( 1, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
+        // Update the estimates.
+        if ( this->coefficients_.bCoefficients( 0, stage ) != 0.0 )
+        {
+            lowerOrderEstimate_ += this->coefficients_.bCoefficients( 0, stage ) * stepSize *
+                    currentStateDerivatives_[ stage ];
+        }
+        if ( this->coefficients_.bCoefficients( 1, stage ) != 0.0 )
+        {
+            higherOrderEstimate_ += this->coefficients_.bCoefficients( 1, stage ) * stepSize *
+                    currentStateDerivatives_[ stage ];
+        }
     }
 
     // Determine if the error was within bounds and compute a new step size.
-    if ( computeNextStepSizeAndValidateResult( lowerOrderEstimate,
-                                               higherOrderEstimate, stepSize ) )
+    if ( computeNextStepSizeAndValidateResult( lowerOrderEstimate_,
+                                               higherOrderEstimate_, stepSize ) )
     {
         // Accept the current step.
         this->lastIndependentVariable_ = this->currentIndependentVariable_;
@@ -549,11 +595,11 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
         switch ( this->coefficients_.orderEstimateToIntegrate )
         {
         case RungeKuttaCoefficients::lower:
-            this->currentState_ = lowerOrderEstimate;
+            this->currentState_ = lowerOrderEstimate_;
             return this->currentState_;
 
         case RungeKuttaCoefficients::higher:
-            this->currentState_ = higherOrderEstimate;
+            this->currentState_ = higherOrderEstimate_;
             return this->currentState_;
 
         default: // The default case will never occur because OrderEstimateToIntegrate is an enum.
@@ -652,25 +698,13 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
 {
     TUDAT_UNUSED_PARAMETER( minimumAndMaximumFactorsForNextStepSize );
 
-    // Compute the truncation error based on the higher and lower order estimates.
-    const StateType truncationError_ =
-            ( higherOrderEstimate - lowerOrderEstimate ).array( ).abs( );
-
-    // Compute error tolerance based on relative and absolute error tolerances.
-    const StateType errorTolerance_ =
-            ( higherOrderEstimate.array( ).abs( ) *
-              relativeErrorTolerance.array( ) ).matrix( )
-            + absoluteErrorTolerance;
-
-    // Compute relative truncation error. This will indicate if the current step satisfies the
-    // required tolerances.
-    const StateType relativeTruncationError_ = truncationError_.array( ) /
-            errorTolerance_.array( );
-
-    // Compute the maximum error based on the largest coefficient in the relative truncation error
-    // matrix.
-    const typename StateType::Scalar maximumErrorInState_
-            = relativeTruncationError_.array( ).abs( ).maxCoeff( );
+    // Compute the maximum relative truncation error, based on the difference between the higher and lower order
+    // estimates, and the error tolerance based on relative and absolute error tolerances. This will indicate if the
+    // current step satisfies the required tolerances. The expression is evaluated element-wise, without temporaries.
+    const typename StateType::Scalar maximumErrorInState_ =
+            ( ( higherOrderEstimate - lowerOrderEstimate ).array( ).abs( ) /
+              ( higherOrderEstimate.array( ).abs( ) * relativeErrorTolerance.array( ) +
+                absoluteErrorTolerance.array( ) ) ).maxCoeff( );
 
     // Compute the new step size. This is based off of the equation given in
     // (Montenbruck and Gill, 2005).
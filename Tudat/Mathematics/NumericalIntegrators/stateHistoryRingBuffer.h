@@ -0,0 +1,259 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_STATE_HISTORY_RING_BUFFER_H
+#define TUDAT_STATE_HISTORY_RING_BUFFER_H
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Fixed-capacity double-ended ring buffer of (state) entries, reusing the memory of its entries.
+/*!
+ *  Fixed-capacity double-ended ring buffer of (state) entries, used to store the state and state derivative histories
+ *  of multi-step integrators. All entries are created when constructing the buffer, and are subsequently only
+ *  assigned to. Contrary to a std::deque or boost::circular_buffer (which construct and destroy an entry for each
+ *  push and pop), adding and removing entries therefore does not require any heap allocation for dynamic-size Eigen
+ *  types, provided that the size of the assigned entries does not change. Entries are indexed from the front (index 0)
+ *  to the back (index size( ) - 1). If an entry is added to the front of a full buffer, the entry at the back is
+ *  discarded.
+ *  \tparam EntryType Type of entries that are stored in the buffer.
+ */
+template< typename EntryType >
+class StateHistoryRingBuffer
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, creates all entries of the buffer as copies of a template entry.
+     *  \param capacity Maximum number of entries that can be stored in the buffer.
+     *  \param templateEntry Entry used to initialize (and set the size of) all entries in the buffer.
+     */
+    StateHistoryRingBuffer( const unsigned int capacity = 0, const EntryType& templateEntry = EntryType( ) ):
+        entries_( capacity, templateEntry ), firstIndex_( 0 ), numberOfEntries_( 0 ){ }
+
+    //! Function to retrieve the number of entries currently stored in the buffer.
+    /*!
+     *  Function to retrieve the number of entries currently stored in the buffer.
+     *  \return Number of entries currently stored in the buffer.
+     */
+    unsigned int size( ) const { return numberOfEntries_; }
+
+    //! Function to retrieve the maximum number of entries that can be stored in the buffer.
+    /*!
+     *  Function to retrieve the maximum number of entries that can be stored in the buffer.
+     *  \return Maximum number of entries that can be stored in the buffer.
+     */
+    unsigned int capacity( ) const { return entries_.size( ); }
+
+    //! Function to check whether the buffer is empty.
+    /*!
+     *  Function to check whether the buffer is empty.
+     *  \return True if no entries are stored in the buffer.
+     */
+    bool empty( ) const { return numberOfEntries_ == 0; }
+
+    //! Function to retrieve an entry of the buffer, with bounds checking.
+    /*!
+     *  Function to retrieve an entry of the buffer, with bounds checking.
+     *  \param index Index of entry, counted from the front of the buffer.
+     *  \return Entry at requested index.
+     */
+    EntryType& at( const unsigned int index )
+    {
+        checkIndex( index );
+        return entries_[ getStorageIndex( index ) ];
+    }
+
+    //! Function to retrieve an entry of the buffer, with bounds checking (const version).
+    /*!
+     *  Function to retrieve an entry of the buffer, with bounds checking (const version).
+     *  \param index Index of entry, counted from the front of the buffer.
+     *  \return Entry at requested index.
+     */
+    const EntryType& at( const unsigned int index ) const
+    {
+        checkIndex( index );
+        return entries_[ getStorageIndex( index ) ];
+    }
+
+    //! Function to retrieve the entry at the front of the buffer.
+    /*!
+     *  Function to retrieve the entry at the front of the buffer.
+     *  \return Entry at the front of the buffer.
+     */
+    EntryType& front( ){ return at( 0 ); }
+
+    //! Function to retrieve the entry at the front of the buffer (const version).
+    /*!
+     *  Function to retrieve the entry at the front of the buffer (const version).
+     *  \return Entry at the front of the buffer.
+     */
+    const EntryType& front( ) const { return at( 0 ); }
+
+    //! Function to retrieve the entry at the back of the buffer.
+    /*!
+     *  Function to retrieve the entry at the back of the buffer.
+     *  \return Entry at the back of the buffer.
+     */
+    EntryType& back( ){ return at( numberOfEntries_ - 1 ); }
+
+    //! Function to retrieve the entry at the back of the buffer (const version).
+    /*!
+     *  Function to retrieve the entry at the back of the buffer (const version).
+     *  \return Entry at the back of the buffer.
+     */
+    const EntryType& back( ) const { return at( numberOfEntries_ - 1 ); }
+
+    //! Function to add an entry to the front of the buffer.
+    /*!
+     *  Function to add an entry to the front of the buffer, by assigning it to the (pre-existing) storage of the new
+     *  front entry. If the buffer is full, the entry at the back is discarded.
+     *  \param entry Entry that is to be added.
+     */
+    template< typename InputEntryType >
+    void push_front( const InputEntryType& entry )
+    {
+        checkCapacity( );
+        firstIndex_ = ( firstIndex_ == 0 ) ? ( entries_.size( ) - 1 ) : ( firstIndex_ - 1 );
+        if( numberOfEntries_ < entries_.size( ) )
+        {
+            numberOfEntries_++;
+        }
+        entries_[ firstIndex_ ] = entry;
+    }
+
+    //! Function to add an entry to the back of the buffer.
+    /*!
+     *  Function to add an entry to the back of the buffer, by assigning it to the (pre-existing) storage of the new
+     *  back entry.
+     *  \param entry Entry that is to be added.
+     */
+    template< typename InputEntryType >
+    void push_back( const InputEntryType& entry )
+    {
+        checkCapacity( );
+        if( numberOfEntries_ == entries_.size( ) )
+        {
+            throw std::runtime_error( "Error when adding entry to back of ring buffer, buffer is full." );
+        }
+        numberOfEntries_++;
+        entries_[ getStorageIndex( numberOfEntries_ - 1 ) ] = entry;
+    }
+
+    //! Function to remove the entry at the front of the buffer.
+    void pop_front( )
+    {
+        if( numberOfEntries_ > 0 )
+        {
+            firstIndex_ = getStorageIndex( 1 );
+            numberOfEntries_--;
+        }
+    }
+
+    //! Function to remove the entry at the back of the buffer.
+    void pop_back( )
+    {
+        if( numberOfEntries_ > 0 )
+        {
+            numberOfEntries_--;
+        }
+    }
+
+    //! Function to reduce the number of entries in the buffer, removing entries from the back.
+    /*!
+     *  Function to reduce the number of entries in the buffer, removing entries from the back. If the buffer does not
+     *  contain more than the requested number of entries, it is not modified.
+     *  \param maximumNumberOfEntries Maximum number of entries that are to be retained.
+     */
+    void truncate( const unsigned int maximumNumberOfEntries )
+    {
+        if( numberOfEntries_ > maximumNumberOfEntries )
+        {
+            numberOfEntries_ = maximumNumberOfEntries;
+        }
+    }
+
+    //! Function to remove all entries from the buffer (retaining the memory of the entries).
+    void clear( )
+    {
+        firstIndex_ = 0;
+        numberOfEntries_ = 0;
+    }
+
+    //! Function to swap the contents of this buffer with those of another buffer.
+    /*!
+     *  Function to swap the contents of this buffer with those of another buffer. The memory of the entries is swapped
+     *  as well, so that no entries are copied.
+     *  \param otherBuffer Buffer with which the contents are to be swapped.
+     */
+    void swap( StateHistoryRingBuffer< EntryType >& otherBuffer )
+    {
+        entries_.swap( otherBuffer.entries_ );
+        std::swap( firstIndex_, otherBuffer.firstIndex_ );
+        std::swap( numberOfEntries_, otherBuffer.numberOfEntries_ );
+    }
+
+private:
+
+    //! Function to compute the index in entries_ of an entry, from its index counted from the front of the buffer.
+    unsigned int getStorageIndex( const unsigned int index ) const
+    {
+        unsigned int storageIndex = firstIndex_ + index;
+        if( storageIndex >= entries_.size( ) )
+        {
+            storageIndex -= entries_.size( );
+        }
+        return storageIndex;
+    }
+
+    //! Function to check whether an entry exists in the buffer, throws exception if not.
+    void checkIndex( const unsigned int index ) const
+    {
+        if( index >= numberOfEntries_ )
+        {
+            throw std::out_of_range( "Error when retrieving entry " + std::to_string( index ) +
+                                     " from ring buffer, buffer contains only " +
+                                     std::to_string( numberOfEntries_ ) + " entries." );
+        }
+    }
+
+    //! Function to check whether entries can be added to the buffer, throws exception if not.
+    void checkCapacity( ) const
+    {
+        if( entries_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when adding entry to ring buffer, buffer has zero capacity." );
+        }
+    }
+
+    //! Storage of all entries in the buffer, including those that are currently not in use.
+    std::vector< EntryType > entries_;
+
+    //! Index in entries_ of the entry at the front of the buffer.
+    unsigned int firstIndex_;
+
+    //! Number of entries currently stored in the buffer.
+    unsigned int numberOfEntries_;
+};
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_STATE_HISTORY_RING_BUFFER_H
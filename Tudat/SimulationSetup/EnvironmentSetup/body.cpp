@@ -48,6 +48,34 @@ Eigen::Matrix< long double, 6, 1 > BaseStateInterface::getBaseFrameState( const
     return getBaseFrameLongDoubleState( time );
 }
 
+//! Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+template< >
+Eigen::Matrix< double, 6, 1 > BaseStateInterface::computeBaseFrameState( const double time )
+{
+    return computeBaseFrameDoubleState( time );
+}
+
+//! Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+template< >
+Eigen::Matrix< long double, 6, 1 > BaseStateInterface::computeBaseFrameState( const double time )
+{
+    return computeBaseFrameLongDoubleState( time );
+}
+
+//! Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+template< >
+Eigen::Matrix< double, 6, 1 > BaseStateInterface::computeBaseFrameState( const Time time )
+{
+    return computeBaseFrameDoubleState( time );
+}
+
+//! Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+template< >
+Eigen::Matrix< long double, 6, 1 > BaseStateInterface::computeBaseFrameState( const Time time )
+{
+    return computeBaseFrameLongDoubleState( time );
+}
+
 
 
 
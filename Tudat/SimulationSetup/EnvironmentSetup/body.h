@@ -75,6 +75,18 @@ public:
     Eigen::Matrix< OutputStateScalarType, 6, 1 > getBaseFrameState(
             const OutputTimeType time );
 
+    //! Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+    /*!
+     *  Function through which the state of baseFrameId_ in the inertial frame can be determined, without modifying the
+     *  current state of any body in the origin chain, so that it may be called concurrently.
+     *  \param time Time at which state is to be computed
+     *  
+eturn Inertial state of frame origin at requested time
+     */
+    template< typename OutputTimeType, typename OutputStateScalarType >
+    Eigen::Matrix< OutputStateScalarType, 6, 1 > computeBaseFrameState(
+            const OutputTimeType time );
+
 protected:
 
     //! Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined
@@ -113,6 +125,46 @@ protected:
      */
     virtual Eigen::Matrix< long double, 6, 1 > getBaseFrameLongDoubleState( const Time& time ) = 0;
 
+    //! Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined, without
+    //! side effects (double time and double state scalar).
+    /*!
+     *  Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined, without
+     *  side effects (double time and double state scalar).
+     *  \param time Time at which state is to be computed
+     *  \return Inertial state of frame origin at requested time
+     */
+    virtual Eigen::Matrix< double, 6, 1 > computeBaseFrameDoubleState( const double time ) = 0;
+
+    //! Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined, without
+    //! side effects (double time and long double state scalar).
+    /*!
+     *  Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined, without
+     *  side effects (double time and long double state scalar).
+     *  \param time Time at which state is to be computed
+     *  \return Inertial state of frame origin at requested time
+     */
+    virtual Eigen::Matrix< long double, 6, 1 > computeBaseFrameLongDoubleState( const double time ) = 0;
+
+    //! Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined, without
+    //! side effects (Time object time and double state scalar).
+    /*!
+     *  Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined, without
+     *  side effects (Time object time and double state scalar).
+     *  \param time Time at which state is to be computed
+     *  \return Inertial state of frame origin at requested time
+     */
+    virtual Eigen::Matrix< double, 6, 1 > computeBaseFrameDoubleState( const Time& time ) = 0;
+
+    //! Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined, without
+    //! side effects (Time object time and long double state scalar).
+    /*!
+     *  Pure virtual function through which the state of baseFrameId_ in the inertial frame can be determined, without
+     *  side effects (Time object time and long double state scalar).
+     *  \param time Time at which state is to be computed
+     *  \return Inertial state of frame origin at requested time
+     */
+    virtual Eigen::Matrix< long double, 6, 1 > computeBaseFrameLongDoubleState( const Time& time ) = 0;
+
     //! Name of frame origin for which inertial state is computed by this class
     std::string baseFrameId_;
 };
@@ -130,13 +182,20 @@ public:
      * \param stateFunction Function returning frame's inertial state as a function of time.
      * \param subtractStateFunction Boolean denoting whether to subtract or add the state function (i.e. whether to multiply
      * result of stateFunction by -1).
+     * \param stateComputationFunction Function returning frame's inertial state as a function of time, without modifying
+     * the current state of any body (used by computeBaseFrameState). If empty (default), stateFunction is used, in which
+     * case it must be free of side effects itself.
      */
     BaseStateInterfaceImplementation(
             const std::string baseFrameId,
             const std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction,
-            const bool subtractStateFunction = 0 ):
+            const bool subtractStateFunction = 0,
+            const std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateComputationFunction =
+            nullptr ):
         BaseStateInterface( baseFrameId ),
-        stateFunction_( stateFunction ), stateMultiplier_( ( subtractStateFunction == 0 ) ? 1.0 : -1.0 )
+        stateFunction_( stateFunction ),
+        stateComputationFunction_( ( stateComputationFunction == nullptr ) ? stateFunction : stateComputationFunction ),
+        stateMultiplier_( ( subtractStateFunction == 0 ) ? 1.0 : -1.0 )
     { }
 
     //! Destructor
@@ -193,11 +252,64 @@ protected:
         return static_cast< long double >( stateMultiplier_ ) * std::move( stateFunction_( time ) ).template cast< long double >( );
     }
 
+    //! Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+    /*!
+     *  Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+     *  (double time and double state scalar).
+     *  \param time Time at which state is to be computed
+     *  \return Inertial state of frame origin at requested time
+     */
+    Eigen::Matrix< double, 6, 1 > computeBaseFrameDoubleState( const double time )
+    {
+        return static_cast< double >( stateMultiplier_ ) * stateComputationFunction_( time ).template cast< double >( );
+    }
+
+    //! Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+    /*!
+     *  Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+     *  (double time and long double state scalar).
+     *  \param time Time at which state is to be computed
+     *  \return Inertial state of frame origin at requested time
+     */
+    Eigen::Matrix< long double, 6, 1 > computeBaseFrameLongDoubleState( const double time )
+    {
+        return static_cast< long double >( stateMultiplier_ ) *
+                stateComputationFunction_( time ).template cast< long double >( );
+    }
+
+    //! Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+    /*!
+     *  Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+     *  (Time object time and double state scalar).
+     *  \param time Time at which state is to be computed
+     *  \return Inertial state of frame origin at requested time
+     */
+    Eigen::Matrix< double, 6, 1 > computeBaseFrameDoubleState( const Time& time )
+    {
+        return static_cast< double >( stateMultiplier_ ) * stateComputationFunction_( time ).template cast< double >( );
+    }
+
+    //! Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+    /*!
+     *  Function through which the state of baseFrameId_ in the inertial frame can be determined, without side effects
+     *  (Time object time and long double state scalar).
+     *  \param time Time at which state is to be computed
+     *  \return Inertial state of frame origin at requested time
+     */
+    Eigen::Matrix< long double, 6, 1 > computeBaseFrameLongDoubleState( const Time& time )
+    {
+        return static_cast< long double >( stateMultiplier_ ) *
+                stateComputationFunction_( time ).template cast< long double >( );
+    }
+
 private:
 
     //! Function returning frame's inertial state as a function of time.
     std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction_;
 
+    //! Function returning frame's inertial state as a function of time, without modifying the current state of any body.
+    std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateComputationFunction_;
+
     //! Value (1 or -1) by which to multiply the state returned by stateFunction_.
     int stateMultiplier_;
 };
@@ -378,6 +490,40 @@ public:
         }
     }
 
+    //! Templated function to compute the state of the body from its ephemeris and global-to-ephemeris-frame function,
+    //! without modifying the current state of the body.
+    /*!
+     * Templated function to compute the state of the body from its ephemeris and global-to-ephemeris-frame function,
+     * returning the state with the requested precision. Unlike the getStateInBaseFrameFromEphemeris function, this
+     * function does not modify the currentState_ / currentLongState_ variables (and does not use the state computed at
+     * the previous call), of this body or of the bodies in the chain of its ephemeris origins (see
+     * BaseStateInterface::computeBaseFrameState), so that it may be called concurrently (provided that the ephemeris
+     * models are thread-safe).
+     * It is used for the state functions of the observation models, which are evaluated concurrently by the
+     * OrbitDeterminationManager.
+     * \param time Time at which to evaluate states.
+     * \return State at requested time
+     */
+    template< typename StateScalarType = double, typename TimeType = double >
+    Eigen::Matrix< StateScalarType, 6, 1 > computeStateInBaseFrameFromEphemeris( const TimeType time )
+    {
+        // If body is not global frame origin, compute state.
+        if( bodyIsGlobalFrameOrigin_  == 0 )
+        {
+            return bodyEphemeris_->getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time ) +
+                    ephemerisFrameToBaseFrame_->computeBaseFrameState< TimeType, StateScalarType >( time );
+        }
+        // If body is global frame origin, state is zero.
+        else if( bodyIsGlobalFrameOrigin_ == 1 )
+        {
+            return Eigen::Matrix< StateScalarType, 6, 1 >::Zero( );
+        }
+        else
+        {
+            throw std::runtime_error( "Error when getting body state, global origin not yet defined." );
+        }
+    }
+
     //! Templated function to get the current berycentric state of the body from its ephemeris andcglobal-to-ephemeris-frame
     //! function.
     /*!
@@ -408,6 +554,27 @@ public:
         }
     }
 
+    //! Templated function to compute the berycentric state of the body from its ephemeris and global-to-ephemeris-frame
+    //! function, without modifying the current state of the body.
+    /*!
+     * Templated function to compute the berycentric state of the body from its ephemeris and global-to-ephemeris-frame
+     * function. Unlike the getGlobalFrameOriginBarycentricStateFromEphemeris function, this function does not modify the
+     * currentBarycentricState_ / currentBarycentricLongState_ variables, so that it may be called concurrently. This
+     * function can ONLY be called if this body is the global frame origin, otherwise an exception is thrown
+     * \param time Time at which to evaluate states.
+     * \return Barycentric State at requested time
+     */
+    template< typename StateScalarType = double, typename TimeType = double >
+    Eigen::Matrix< StateScalarType, 6, 1 > computeGlobalFrameOriginBarycentricStateFromEphemeris( const TimeType time )
+    {
+        if( bodyIsGlobalFrameOrigin_ != 1 )
+        {
+            throw std::runtime_error( "Error, calling global frame origin barycentric state on body that is not global frame origin" );
+        }
+
+        return ephemerisFrameToBaseFrame_->computeBaseFrameState< TimeType, StateScalarType >( time );
+    }
+
     //! Get current state.
     /*!
      * Returns the internally stored current state vector.
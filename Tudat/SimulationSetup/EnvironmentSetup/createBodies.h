@@ -199,9 +199,12 @@ void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
                         std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction =
                                 std::bind( &Body::getStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
                                              bodyMap.at( ephemerisFrameOrigin ), std::placeholders::_1 );
+                        std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateComputationFunction =
+                                std::bind( &Body::computeStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
+                                             bodyMap.at( ephemerisFrameOrigin ), std::placeholders::_1 );
                         std::shared_ptr< BaseStateInterface > baseStateInterface =
                                 std::make_shared< BaseStateInterfaceImplementation< TimeType, StateScalarType > >(
-                                    ephemerisFrameOrigin, stateFunction );
+                                    ephemerisFrameOrigin, stateFunction, false, stateComputationFunction );
                         bodyIterator->second->setEphemerisFrameToBaseFrame( baseStateInterface );
                     }
                 }
@@ -232,9 +235,12 @@ void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
                         std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction =
                                std::bind( &Body::getGlobalFrameOriginBarycentricStateFromEphemeris< StateScalarType, TimeType >,
                                              bodyMap.at( globalFrameOrigin ), std::placeholders::_1 );
+                        std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateComputationFunction =
+                               std::bind( &Body::computeGlobalFrameOriginBarycentricStateFromEphemeris< StateScalarType, TimeType >,
+                                             bodyMap.at( globalFrameOrigin ), std::placeholders::_1 );
                         std::shared_ptr< BaseStateInterface > baseStateInterface =
                                 std::make_shared< BaseStateInterfaceImplementation< TimeType, StateScalarType > >(
-                                    globalFrameOrigin, stateFunction, true );
+                                    globalFrameOrigin, stateFunction, true, stateComputationFunction );
                         bodyIterator->second->setEphemerisFrameToBaseFrame( baseStateInterface );
                     }
                     else
@@ -253,9 +259,13 @@ void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
                             std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction =
                                     std::bind( &Body::getStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
                                                  bodyMap.at( ephemerisFrameOrigin ), std::placeholders::_1 );
+                            std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) >
+                                    stateComputationFunction =
+                                    std::bind( &Body::computeStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
+                                                 bodyMap.at( ephemerisFrameOrigin ), std::placeholders::_1 );
                             std::shared_ptr< BaseStateInterface > baseStateInterface =
                                     std::make_shared< BaseStateInterfaceImplementation< TimeType, StateScalarType > >(
-                                        ephemerisFrameOrigin, stateFunction, false );
+                                        ephemerisFrameOrigin, stateFunction, false, stateComputationFunction );
                             bodyIterator->second->setEphemerisFrameToBaseFrame( baseStateInterface );
                         }
                     }
@@ -31,6 +31,51 @@ namespace simulation_setup
 
 using namespace ephemerides;
 
+#if USE_CSPICE
+//! Function to retrieve the name of the body in Spice from which the ephemeris of a body is created
+/*!
+ *  Function to retrieve the name of the body in Spice from which the ephemeris of a body is created. Since only the
+ *  barycenters of planetary systems are included in the standard DE ephemerides, 'Barycenter' is appended to the
+ *  body name for the outer planets.
+ *  \param bodyName Name of body for which the ephemeris is to be created
+ *  \return Name of body in Spice
+ */
+static std::string getSpiceEphemerisInputBodyName( const std::string& bodyName )
+{
+    std::string inputName = bodyName;
+    if( bodyName == "Mars" ||
+            bodyName == "Jupiter"  || bodyName == "Saturn" ||
+            bodyName == "Uranus" || bodyName == "Neptune" )
+    {
+        inputName += " Barycenter";
+        std::cerr << "Warning, position of " << bodyName << " taken as barycenter of that body's "
+                  << "planetary system." << std::endl;
+    }
+    return inputName;
+}
+
+//! Function to create an ephemeris, consisting of Chebyshev segments, fitted to data from Spice.
+std::shared_ptr< ephemerides::ChebyshevEphemeris > createChebyshevEphemerisFromSpice(
+        const std::string& body,
+        const double initialTime,
+        const double endTime,
+        const std::string& observerName,
+        const std::string& referenceFrameName,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int numberOfCoefficientsPerSegment,
+        const double initialSegmentDuration )
+{
+    return fitChebyshevEphemeris(
+                [ = ]( const double time )
+    {
+        return spice_interface::getBodyCartesianStateAtEpoch(
+                    body, observerName, referenceFrameName, "none", time );
+    }, initialTime, endTime, numberOfCoefficientsPerSegment, positionTolerance, velocityTolerance,
+    initialSegmentDuration, 1000000, observerName, referenceFrameName );
+}
+#endif
+
 //! Function to create a ephemeris model.
 std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
         const std::shared_ptr< EphemerisSettings > ephemerisSettings,
@@ -93,18 +138,7 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             }
             else
             {
-                // Since only the barycenters of planetary systems are included in the standard DE
-                // ephemerides, append 'Barycenter' to body name.
-                std::string inputName;
-                inputName = bodyName;
-                if( bodyName == "Mars" ||
-                        bodyName == "Jupiter"  || bodyName == "Saturn" ||
-                        bodyName == "Uranus" || bodyName == "Neptune" )
-                {
-                    inputName += " Barycenter";
-                    std::cerr << "Warning, position of " << bodyName << " taken as barycenter of that body's "
-                              << "planetary system." << std::endl;
-                }
+                std::string inputName = getSpiceEphemerisInputBodyName( bodyName );
 
                 // Create corresponding ephemeris object.
                 if( !interpolatedEphemerisSettings->getUseLongDoubleStates( ) )
@@ -137,6 +171,32 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             }
             break;
         }
+        case chebyshev_spice_ephemeris:
+        {
+            // Check consistency of type and class.
+            std::shared_ptr< ChebyshevSpiceEphemerisSettings > chebyshevEphemerisSettings =
+                    std::dynamic_pointer_cast< ChebyshevSpiceEphemerisSettings >( ephemerisSettings );
+            if( chebyshevEphemerisSettings == nullptr )
+            {
+                throw std::runtime_error(
+                            "Error, expected Chebyshev spice ephemeris settings for body " + bodyName );
+            }
+            else
+            {
+                // Create corresponding ephemeris object.
+                ephemeris = createChebyshevEphemerisFromSpice(
+                            getSpiceEphemerisInputBodyName( bodyName ),
+                            chebyshevEphemerisSettings->getInitialTime( ),
+                            chebyshevEphemerisSettings->getFinalTime( ),
+                            chebyshevEphemerisSettings->getFrameOrigin( ),
+                            chebyshevEphemerisSettings->getFrameOrientation( ),
+                            chebyshevEphemerisSettings->getPositionTolerance( ),
+                            chebyshevEphemerisSettings->getVelocityTolerance( ),
+                            chebyshevEphemerisSettings->getNumberOfCoefficientsPerSegment( ),
+                            chebyshevEphemerisSettings->getInitialSegmentDuration( ) );
+            }
+            break;
+        }
 #endif
         case tabulated_ephemeris:
         {
@@ -326,6 +386,13 @@ std::pair< double, double > getSafeInterpolationInterval( const std::shared_ptr<
     {
         safeInterval = getTabulatedEphemerisSafeInterval( ephemerisModel );
     }
+    // Check if model is Chebyshev ephemeris, and retrieve validity interval from model
+    else if( std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( ephemerisModel ) != nullptr )
+    {
+        std::shared_ptr< ephemerides::ChebyshevEphemeris > chebyshevEphemerisModel  =
+                std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( ephemerisModel );
+        safeInterval = std::make_pair( chebyshevEphemerisModel->getStartTime( ), chebyshevEphemerisModel->getEndTime( ) );
+    }
     // Check if model is multi-arc, and retrieve safe intervals from first and last arc.
     else if( std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( ephemerisModel ) != nullptr )
     {
@@ -18,6 +18,7 @@
 
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 #include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositionsBase.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
@@ -42,7 +43,8 @@ enum EphemerisType
     interpolated_spice,
     constant_ephemeris,
     kepler_ephemeris,
-    custom_ephemeris
+    custom_ephemeris,
+    chebyshev_spice_ephemeris
 };
 
 //! Class for providing settings for ephemeris model.
@@ -322,6 +324,109 @@ private:
     bool useLongDoubleStates_;
 };
 
+//! EphemerisSettings derived class for defining settings of an ephemeris fitted (as Chebyshev segments) to Spice data.
+/*!
+ *  EphemerisSettings derived class for defining settings of an ephemeris fitted (as Chebyshev segments) to Spice
+ *  data. When creating the ephemeris, Spice is only called during the fit; the resulting ChebyshevEphemeris is not
+ *  modified after its creation, and does not call Spice. Unlike ephemerides that call Spice directly (which is not
+ *  thread-safe), it may therefore be evaluated concurrently from multiple threads, for instance when running
+ *  independent propagations in parallel with the same environment.
+ */
+class ChebyshevSpiceEphemerisSettings: public DirectSpiceEphemerisSettings
+{
+public:
+
+    //! Constructor.
+    /*! Constructor, sets the properties from which the Spice data is to be fitted.
+     * \param initialTime Initial time of interval on which ephemeris is to be fitted to Spice data.
+     * \param finalTime Final time of interval on which ephemeris is to be fitted to Spice data.
+     * \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *        (optional "SSB" by default).
+     * \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be
+     *          calculated (optional "ECLIPJ2000" by default).
+     * \param positionTolerance Maximum allowed position error of fit (optional 1 mm by default).
+     * \param velocityTolerance Maximum allowed velocity error of fit (optional 1 micrometer/s by default).
+     * \param numberOfCoefficientsPerSegment Number of Chebyshev coefficients per segment (optional 14 by default).
+     * \param initialSegmentDuration Initial (maximum) segment duration (optional 1 day by default).
+     */
+    ChebyshevSpiceEphemerisSettings( const double initialTime,
+                                     const double finalTime,
+                                     const std::string frameOrigin = "SSB",
+                                     const std::string frameOrientation = "ECLIPJ2000",
+                                     const double positionTolerance = 1.0E-3,
+                                     const double velocityTolerance = 1.0E-6,
+                                     const int numberOfCoefficientsPerSegment = 14,
+                                     const double initialSegmentDuration = 86400.0 ):
+        DirectSpiceEphemerisSettings( frameOrigin, frameOrientation, 0, 0, 0,
+                                      chebyshev_spice_ephemeris ),
+        initialTime_( initialTime ), finalTime_( finalTime ),
+        positionTolerance_( positionTolerance ), velocityTolerance_( velocityTolerance ),
+        numberOfCoefficientsPerSegment_( numberOfCoefficientsPerSegment ),
+        initialSegmentDuration_( initialSegmentDuration ){ }
+
+    //! Function to return initial time of interval on which ephemeris is to be fitted to Spice data.
+    /*!
+     *  Function to return initial time of interval on which ephemeris is to be fitted to Spice data.
+     *  \return Initial time of interval on which ephemeris is to be fitted to Spice data.
+     */
+    double getInitialTime( ){ return initialTime_; }
+
+    //! Function to return final time of interval on which ephemeris is to be fitted to Spice data.
+    /*!
+     *  Function to return final time of interval on which ephemeris is to be fitted to Spice data.
+     *  \return Final time of interval on which ephemeris is to be fitted to Spice data.
+     */
+    double getFinalTime( ){ return finalTime_; }
+
+    //! Function to return maximum allowed position error of fit.
+    /*!
+     *  Function to return maximum allowed position error of fit.
+     *  \return Maximum allowed position error of fit.
+     */
+    double getPositionTolerance( ){ return positionTolerance_; }
+
+    //! Function to return maximum allowed velocity error of fit.
+    /*!
+     *  Function to return maximum allowed velocity error of fit.
+     *  \return Maximum allowed velocity error of fit.
+     */
+    double getVelocityTolerance( ){ return velocityTolerance_; }
+
+    //! Function to return number of Chebyshev coefficients per segment.
+    /*!
+     *  Function to return number of Chebyshev coefficients per segment.
+     *  \return Number of Chebyshev coefficients per segment.
+     */
+    int getNumberOfCoefficientsPerSegment( ){ return numberOfCoefficientsPerSegment_; }
+
+    //! Function to return initial (maximum) segment duration.
+    /*!
+     *  Function to return initial (maximum) segment duration.
+     *  \return Initial (maximum) segment duration.
+     */
+    double getInitialSegmentDuration( ){ return initialSegmentDuration_; }
+
+private:
+
+    //! Initial time of interval on which ephemeris is to be fitted to Spice data.
+    double initialTime_;
+
+    //! Final time of interval on which ephemeris is to be fitted to Spice data.
+    double finalTime_;
+
+    //! Maximum allowed position error of fit.
+    double positionTolerance_;
+
+    //! Maximum allowed velocity error of fit.
+    double velocityTolerance_;
+
+    //! Number of Chebyshev coefficients per segment.
+    int numberOfCoefficientsPerSegment_;
+
+    //! Initial (maximum) segment duration.
+    double initialSegmentDuration_;
+};
+
 //! EphemerisSettings derived class for defining settings of an approximate ephemeris for major
 //! planets.
 /*!
@@ -678,6 +783,34 @@ std::shared_ptr< ephemerides::Ephemeris > createTabulatedEphemerisFromSpice(
     return std::make_shared< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
                 interpolator, observerName, referenceFrameName );
 }
+
+//! Function to create an ephemeris, consisting of Chebyshev segments, fitted to data from Spice.
+/*!
+ *  Function to create an ephemeris, consisting of Chebyshev segments, fitted to data from Spice (see
+ *  ephemerides::fitChebyshevEphemeris). Spice is only called when creating the ephemeris. The resulting ephemeris
+ *  does not call Spice, and is not modified after creation, so that it can be safely evaluated from multiple threads.
+ * \param body Name of body for which ephemeris data is to be retrieved.
+ * \param initialTime Initial time of interval on which ephemeris is to be fitted to Spice data.
+ * \param endTime Final time of interval on which ephemeris is to be fitted to Spice data.
+ * \param observerName Name of body relative to which the ephemeris is to be calculated.
+ * \param referenceFrameName Orientatioan of the reference frame in which the epehemeris is to be
+ *          calculated.
+ * \param positionTolerance Maximum allowed position error of fit.
+ * \param velocityTolerance Maximum allowed velocity error of fit.
+ * \param numberOfCoefficientsPerSegment Number of Chebyshev coefficients per segment.
+ * \param initialSegmentDuration Initial (maximum) segment duration.
+ * \return Chebyshev ephemeris fitted to data from Spice.
+ */
+std::shared_ptr< ephemerides::ChebyshevEphemeris > createChebyshevEphemerisFromSpice(
+        const std::string& body,
+        const double initialTime,
+        const double endTime,
+        const std::string& observerName,
+        const std::string& referenceFrameName,
+        const double positionTolerance = 1.0E-3,
+        const double velocityTolerance = 1.0E-6,
+        const int numberOfCoefficientsPerSegment = 14,
+        const double initialSegmentDuration = 86400.0 );
 #endif
 
 //! Function to create a ephemeris model.
@@ -696,7 +829,8 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
 /*!
  * Function that retrieves the time interval at which an ephemeris can be safely interrogated. For most ephemeris types,
  * this function returns the full range of double values ( lowest( ) to max( ) ). For the tabulated ephemeris, the interval
- * on which the interpolator inside this object is valid is checked and returned
+ * on which the interpolator inside this object is valid is checked and returned. For the Chebyshev ephemeris, the
+ * validity interval of the ephemeris is returned.
  * \param ephemerisModel Ephemeris model for which the interval is to be determined.
  * \return The time interval at which the ephemeris can be safely interrogated
  */
@@ -8,6 +8,9 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <iomanip>
+#include <sstream>
+
 #include <boost/make_shared.hpp>
 #include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
 
@@ -20,6 +23,7 @@
 #if USE_SOFA
 #include "Tudat/Astrodynamics/Ephemerides/itrsToGcrsRotationModel.h"
 #include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationAnglesCache.h"
 #include "Tudat/Astrodynamics/EarthOrientation/shortPeriodEarthOrientationCorrectionCalculator.h"
 #include "Tudat/Mathematics/Interpolators/jumpDataLinearInterpolator.h"
 #endif
@@ -30,6 +34,112 @@ namespace tudat
 namespace simulation_setup
 {
 
+#if USE_SOFA
+//! Function to create the object calculating the Earth orientation angles of a GCRS<->ITRS rotation model
+std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > createEarthOrientationAnglesCalculator(
+        const std::shared_ptr< GcrsToItrsRotationModelSettings > rotationModelSettings )
+{
+    // Read EOP file
+    std::shared_ptr< earth_orientation::EOPReader > eopReader = std::make_shared< earth_orientation::EOPReader >(
+                rotationModelSettings->getEopFile( ),
+                rotationModelSettings->getEopFileFormat( ),
+                rotationModelSettings->getNutationTheory( ) );
+
+    // Load polar motion corrections
+    std::shared_ptr< interpolators::LinearInterpolator< double, Eigen::Vector2d > > cipInItrsInterpolator =
+            std::make_shared< interpolators::LinearInterpolator< double, Eigen::Vector2d > >(
+                eopReader->getCipInItrsMapInSecondsSinceJ2000( ) );
+
+    // Load nutation corrections
+    std::shared_ptr< interpolators::LinearInterpolator< double, Eigen::Vector2d > > cipInGcrsCorrectionInterpolator =
+            std::make_shared< interpolators::LinearInterpolator< double, Eigen::Vector2d > >(
+                eopReader->getCipInGcrsCorrectionMapInSecondsSinceJ2000( ) );
+
+    // Create polar motion correction (sub-diural frequencies) object
+    std::shared_ptr< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > >
+            shortPeriodPolarMotionCalculator =
+            std::make_shared< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > >(
+                rotationModelSettings->getPolarMotionCorrectionSettings( )->conversionFactor_,
+                rotationModelSettings->getPolarMotionCorrectionSettings( )->minimumAmplitude_,
+                rotationModelSettings->getPolarMotionCorrectionSettings( )->amplitudesFiles_,
+                rotationModelSettings->getPolarMotionCorrectionSettings( )->argumentMultipliersFile_ );
+
+    // Create full polar motion calculator
+    std::shared_ptr< earth_orientation::PolarMotionCalculator > polarMotionCalculator =
+            std::make_shared< earth_orientation::PolarMotionCalculator >
+            ( cipInItrsInterpolator, shortPeriodPolarMotionCalculator );
+
+    // Create IAU 2006 precession/nutation calculator
+    std::shared_ptr< earth_orientation::PrecessionNutationCalculator > precessionNutationCalculator =
+            std::make_shared< earth_orientation::PrecessionNutationCalculator >(
+                rotationModelSettings->getNutationTheory( ), cipInGcrsCorrectionInterpolator );
+
+    // Create UT1 correction (sub-diural frequencies) object
+    std::shared_ptr< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< double > >
+            ut1CorrectionSettings =
+            std::make_shared< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< double > >(
+                rotationModelSettings->getUt1CorrectionSettings( )->conversionFactor_,
+                rotationModelSettings->getUt1CorrectionSettings( )->minimumAmplitude_,
+                rotationModelSettings->getUt1CorrectionSettings( )->amplitudesFiles_,
+                rotationModelSettings->getUt1CorrectionSettings( )->argumentMultipliersFile_ );
+
+    std::shared_ptr< interpolators::OneDimensionalInterpolator < double, double > > dailyUtcUt1CorrectionInterpolator =
+            std::make_shared< interpolators::JumpDataLinearInterpolator< double, double > >(
+                eopReader->getUt1MinusUtcMapInSecondsSinceJ2000( ), 0.5, 1.0 );
+
+    // Create default time scale converter
+    std::shared_ptr< earth_orientation::TerrestrialTimeScaleConverter > terrestrialTimeScaleConverter =
+            std::make_shared< earth_orientation::TerrestrialTimeScaleConverter >
+            (  dailyUtcUt1CorrectionInterpolator, ut1CorrectionSettings );
+
+    // Create Earth orientation angles calculator
+    return std::make_shared< earth_orientation::EarthOrientationAnglesCalculator >(
+                polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
+}
+
+//! Function to create a string that uniquely identifies the settings of an EOP short-period correction
+/*!
+ *  Function to create a string that uniquely identifies the settings of an EOP short-period correction
+ *  \param correctionSettings Settings for the EOP short-period correction
+ *  \return String that uniquely identifies the settings
+ */
+static std::string getEopCorrectionSettingsIdentifier( const std::shared_ptr< EopCorrectionSettings > correctionSettings )
+{
+    std::ostringstream identifierStream;
+    identifierStream << std::setprecision( 17 ) << correctionSettings->conversionFactor_ << ";"
+                     << correctionSettings->minimumAmplitude_ << ";";
+    for( unsigned int i = 0; i < correctionSettings->amplitudesFiles_.size( ); i++ )
+    {
+        identifierStream << correctionSettings->amplitudesFiles_.at( i ) << ";";
+    }
+    for( unsigned int i = 0; i < correctionSettings->argumentMultipliersFile_.size( ); i++ )
+    {
+        identifierStream << correctionSettings->argumentMultipliersFile_.at( i ) << ";";
+    }
+    return identifierStream.str( );
+}
+
+//! Function to create a string that uniquely identifies the Earth orientation angles cache of a GCRS<->ITRS rotation model
+std::string getEarthOrientationAnglesCacheIdentifier(
+        const std::shared_ptr< GcrsToItrsRotationModelSettings > rotationModelSettings )
+{
+    std::shared_ptr< EarthOrientationAnglesCacheSettings > cacheSettings = rotationModelSettings->getAnglesCacheSettings( );
+
+    std::ostringstream identifierStream;
+    identifierStream << std::setprecision( 17 )
+                     << rotationModelSettings->getNutationTheory( ) << ";"
+                     << rotationModelSettings->getEopFile( ) << ";"
+                     << rotationModelSettings->getEopFileFormat( ) << ";"
+                     << rotationModelSettings->getInputTimeScale( ) << ";"
+                     << getEopCorrectionSettingsIdentifier( rotationModelSettings->getUt1CorrectionSettings( ) )
+                     << getEopCorrectionSettingsIdentifier( rotationModelSettings->getPolarMotionCorrectionSettings( ) )
+                     << cacheSettings->timeStep_ << ";"
+                     << cacheSettings->interpolationOrder_ << ";"
+                     << cacheSettings->numberOfTimeStepsPerWindow_;
+    return identifierStream.str( );
+}
+#endif
+
 //! Function to create a rotation model.
 std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
         const std::shared_ptr< RotationModelSettings > rotationModelSettings,
@@ -79,65 +189,33 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
         }
         else
         {
-            std::shared_ptr< earth_orientation::EOPReader > eopReader = std::make_shared< earth_orientation::EOPReader >(
-                        gcrsToItrsRotationSettings->getEopFile( ),
-                        gcrsToItrsRotationSettings->getEopFileFormat( ),
-                        gcrsToItrsRotationSettings->getNutationTheory( ) );
-
-            // Load polar motion corrections
-            std::shared_ptr< interpolators::LinearInterpolator< double, Eigen::Vector2d > > cipInItrsInterpolator =
-                    std::make_shared< interpolators::LinearInterpolator< double, Eigen::Vector2d > >(
-                        eopReader->getCipInItrsMapInSecondsSinceJ2000( ) );
-
-            // Load nutation corrections
-            std::shared_ptr< interpolators::LinearInterpolator< double, Eigen::Vector2d > > cipInGcrsCorrectionInterpolator =
-                    std::make_shared< interpolators::LinearInterpolator< double, Eigen::Vector2d > >(
-                        eopReader->getCipInGcrsCorrectionMapInSecondsSinceJ2000( ) );
-
-            // Create polar motion correction (sub-diural frequencies) object
-            std::shared_ptr< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > >
-                    shortPeriodPolarMotionCalculator =
-                    std::make_shared< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > >(
-                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->conversionFactor_,
-                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->minimumAmplitude_,
-                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->amplitudesFiles_,
-                        gcrsToItrsRotationSettings->getPolarMotionCorrectionSettings( )->argumentMultipliersFile_ );
-
-            // Create full polar motion calculator
-            std::shared_ptr< earth_orientation::PolarMotionCalculator > polarMotionCalculator =
-                    std::make_shared< earth_orientation::PolarMotionCalculator >
-                    ( cipInItrsInterpolator, shortPeriodPolarMotionCalculator );
-
-            // Create IAU 2006 precession/nutation calculator
-            std::shared_ptr< earth_orientation::PrecessionNutationCalculator > precessionNutationCalculator =
-                    std::make_shared< earth_orientation::PrecessionNutationCalculator >(
-                        gcrsToItrsRotationSettings->getNutationTheory( ), cipInGcrsCorrectionInterpolator );
-
-            // Create UT1 correction (sub-diural frequencies) object
-            std::shared_ptr< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< double > >
-                    ut1CorrectionSettings =
-                    std::make_shared< earth_orientation::ShortPeriodEarthOrientationCorrectionCalculator< double > >(
-                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->conversionFactor_,
-                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->minimumAmplitude_,
-                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->amplitudesFiles_,
-                        gcrsToItrsRotationSettings->getUt1CorrectionSettings( )->argumentMultipliersFile_ );
-
-            std::shared_ptr< interpolators::OneDimensionalInterpolator < double, double > > dailyUtcUt1CorrectionInterpolator =
-                    std::make_shared< interpolators::JumpDataLinearInterpolator< double, double > >(
-                        eopReader->getUt1MinusUtcMapInSecondsSinceJ2000( ), 0.5, 1.0 );
-
-            // Create default time scale converter
-            std::shared_ptr< earth_orientation::TerrestrialTimeScaleConverter > terrestrialTimeScaleConverter =
-                    std::make_shared< earth_orientation::TerrestrialTimeScaleConverter >
-                    (  dailyUtcUt1CorrectionInterpolator, ut1CorrectionSettings );
-
-            // Create rotation model
-            std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > earthOrientationCalculator =
-                    std::make_shared< earth_orientation::EarthOrientationAnglesCalculator >(
-                        polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
+            // Create rotation model, using (process-wide) angles cache if requested
+            std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > earthOrientationCalculator;
+            std::shared_ptr< earth_orientation::EarthOrientationAnglesCache > anglesCache;
+            if( gcrsToItrsRotationSettings->getAnglesCacheSettings( ) != nullptr )
+            {
+                anglesCache = earth_orientation::getSharedEarthOrientationAnglesCache(
+                            getEarthOrientationAnglesCacheIdentifier( gcrsToItrsRotationSettings ),
+                            [ & ]( )
+                {
+                    std::shared_ptr< EarthOrientationAnglesCacheSettings > cacheSettings =
+                            gcrsToItrsRotationSettings->getAnglesCacheSettings( );
+                    return std::make_shared< earth_orientation::EarthOrientationAnglesCache >(
+                                createEarthOrientationAnglesCalculator( gcrsToItrsRotationSettings ),
+                                gcrsToItrsRotationSettings->getInputTimeScale( ),
+                                cacheSettings->timeStep_, cacheSettings->interpolationOrder_,
+                                cacheSettings->numberOfTimeStepsPerWindow_ );
+                } );
+                earthOrientationCalculator = anglesCache->getAnglesCalculator( );
+            }
+            else
+            {
+                earthOrientationCalculator = createEarthOrientationAnglesCalculator( gcrsToItrsRotationSettings );
+            }
+
             rotationalEphemeris = std::make_shared< ephemerides::GcrsToItrsRotationModel >(
                         earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ),
-                        gcrsToItrsRotationSettings->getOriginalFrame( ) );
+                        gcrsToItrsRotationSettings->getOriginalFrame( ), anglesCache );
 
             break;
         }
@@ -22,6 +22,9 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
 #include "Tudat/External/SofaInterface/earthOrientation.h"
+#if USE_SOFA
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#endif
 
 namespace tudat
 {
@@ -205,6 +208,33 @@ struct EopCorrectionSettings
     std::vector< std::string > argumentMultipliersFile_;
 };
 
+//! Struct that holds settings for caching the Earth orientation angles (see EarthOrientationAnglesCache)
+struct EarthOrientationAnglesCacheSettings
+{
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param timeStep Time step between grid points at which the angles are computed.
+     *  \param interpolationOrder Number of grid points used for the Lagrange interpolation (must be even).
+     *  \param numberOfTimeStepsPerWindow Number of time steps in a single window that is created at once.
+     */
+    EarthOrientationAnglesCacheSettings(
+            const double timeStep = 60.0,
+            const int interpolationOrder = 8,
+            const int numberOfTimeStepsPerWindow = 1440 ):
+        timeStep_( timeStep ), interpolationOrder_( interpolationOrder ),
+        numberOfTimeStepsPerWindow_( numberOfTimeStepsPerWindow ){ }
+
+    //! Time step between grid points at which the angles are computed.
+    double timeStep_;
+
+    //! Number of grid points used for the Lagrange interpolation.
+    int interpolationOrder_;
+
+    //! Number of time steps in a single window that is created at once.
+    int numberOfTimeStepsPerWindow_;
+};
+
 //! Settings for creating a GCRS<->ITRS rotation model
 class GcrsToItrsRotationModelSettings: public RotationModelSettings
 {
@@ -219,6 +249,9 @@ public:
      * \param eopFileFormat Identifier for file format that is provided
      * \param ut1CorrectionSettings Settings for short-period UT1-UTC variations
      * \param polarMotionCorrectionSettings Settings for short-period polar motion variations
+     * \param anglesCacheSettings Settings for the process-wide cache from which the Earth orientation angles are
+     * interpolated, which is shared by all rotation models with identical settings (if nullptr, default, angles are
+     * computed directly).
      */
     GcrsToItrsRotationModelSettings(
             const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006,
@@ -246,11 +279,12 @@ public:
                     input_output::getEarthOrientationDataFilesPath( ) +
                     "polarMotionLibrationFundamentalArgumentMultipliersQuasiDiurnalOnly.txt",
                     input_output::getEarthOrientationDataFilesPath( ) +
-                    "polarMotionOceanTidesFundamentalArgumentMultipliers.txt" } ) ):
+                    "polarMotionOceanTidesFundamentalArgumentMultipliers.txt" } ),
+            const std::shared_ptr< EarthOrientationAnglesCacheSettings > anglesCacheSettings = nullptr ):
         RotationModelSettings( gcrs_to_itrs_rotation_model, baseFrameName, "ITRS" ),
         inputTimeScale_( inputTimeScale ), nutationTheory_( nutationTheory ), eopFile_( eopFile ),
         eopFileFormat_( "C04" ), ut1CorrectionSettings_( ut1CorrectionSettings ),
-        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ){ }
+        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ), anglesCacheSettings_( anglesCacheSettings ){ }
 
     //! Destructor
     ~GcrsToItrsRotationModelSettings( ){ }
@@ -314,6 +348,26 @@ public:
         return polarMotionCorrectionSettings_;
     }
 
+    //! Function to retrieve the settings for caching the Earth orientation angles
+    /*!
+     * Function to retrieve the settings for caching the Earth orientation angles (nullptr if no cache is used)
+     * \return Settings for caching the Earth orientation angles
+     */
+    std::shared_ptr< EarthOrientationAnglesCacheSettings > getAnglesCacheSettings( )
+    {
+        return anglesCacheSettings_;
+    }
+
+    //! Function to reset the settings for caching the Earth orientation angles
+    /*!
+     * Function to reset the settings for caching the Earth orientation angles
+     * \param anglesCacheSettings Settings for caching the Earth orientation angles (nullptr if no cache is to be used)
+     */
+    void resetAnglesCacheSettings( const std::shared_ptr< EarthOrientationAnglesCacheSettings > anglesCacheSettings )
+    {
+        anglesCacheSettings_ = anglesCacheSettings;
+    }
+
 private:
 
     //! Time scale in which input to the rotation model class is provided
@@ -334,7 +388,30 @@ private:
     //! Settings for short-period polar motion variations
     std::shared_ptr< EopCorrectionSettings > polarMotionCorrectionSettings_;
 
+    //! Settings for caching the Earth orientation angles (nullptr if no cache is used)
+    std::shared_ptr< EarthOrientationAnglesCacheSettings > anglesCacheSettings_;
+
 };
+
+//! Function to create the object calculating the Earth orientation angles of a GCRS<->ITRS rotation model
+/*!
+ *  Function to create the object calculating the Earth orientation angles of a GCRS<->ITRS rotation model, reading the EOP
+ *  and short-period correction files defined by the settings.
+ *  \param rotationModelSettings Settings for the GCRS<->ITRS rotation model
+ *  \return Object calculating the Earth orientation angles
+ */
+std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > createEarthOrientationAnglesCalculator(
+        const std::shared_ptr< GcrsToItrsRotationModelSettings > rotationModelSettings );
+
+//! Function to create a string that uniquely identifies the Earth orientation angles cache of a GCRS<->ITRS rotation model
+/*!
+ *  Function to create a string that uniquely identifies the Earth orientation angles cache of a GCRS<->ITRS rotation model,
+ *  used to share the cache between all rotation models with identical settings (including the cache settings).
+ *  \param rotationModelSettings Settings for the GCRS<->ITRS rotation model (with non-nullptr angles cache settings)
+ *  \return String that uniquely identifies the Earth orientation angles cache
+ */
+std::string getEarthOrientationAnglesCacheIdentifier(
+        const std::shared_ptr< GcrsToItrsRotationModelSettings > rotationModelSettings );
 #endif
 
 //! Function to create a rotation model.
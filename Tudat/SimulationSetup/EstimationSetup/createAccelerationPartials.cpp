@@ -74,13 +74,64 @@ std::vector< std::shared_ptr< orbit_determination::TidalLoveNumberPartialInterfa
     return loveNumberInterfaces;
 }
 
+//! Function to update the environment models of a body that depend on its translational state.
+void updateTranslationalStateDependentEnvironment(
+        const std::shared_ptr< simulation_setup::Body > body, const double currentTime )
+{
+    // Reset state-dependent rotation of body.
+    bool isRotationStateDependent = ( body->getRotationalEphemeris( ) == nullptr ) &&
+            ( body->getDependentOrientationCalculator( ) != nullptr );
+    if( isRotationStateDependent )
+    {
+        body->getDependentOrientationCalculator( )->resetCurrentTime( TUDAT_NAN );
+    }
+
+    // Update flight conditions (including aerodynamic angles) to current states.
+    if( body->getFlightConditions( ) != nullptr )
+    {
+        body->getFlightConditions( )->resetCurrentTime( TUDAT_NAN );
+        body->getFlightConditions( )->updateConditions( currentTime );
+    }
+
+    // Update rotation of body from current states and flight conditions.
+    if( isRotationStateDependent )
+    {
+        body->setCurrentRotationalStateToLocalFrameFromEphemeris( currentTime );
+    }
+}
+
+//! Function to create an acceleration partial derivative object that computes the state partials numerically.
+std::shared_ptr< acceleration_partials::AccelerationPartial > createNumericalAccelerationPartial(
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+        const std::pair< std::string, std::shared_ptr< simulation_setup::Body > > acceleratedBody,
+        const std::pair< std::string, std::shared_ptr< simulation_setup::Body > > acceleratingBody,
+        const numerical_derivatives::NumericalJacobianSettings& jacobianSettings )
+{
+    // Set state functions of body exerting acceleration, if it exists.
+    std::function< Eigen::Vector6d( ) > acceleratingBodyStateFunction;
+    std::function< void( const Eigen::Vector6d& ) > acceleratingBodyStateSetFunction;
+    if( acceleratingBody.second != nullptr )
+    {
+        acceleratingBodyStateFunction = std::bind( &Body::getState, acceleratingBody.second );
+        acceleratingBodyStateSetFunction = std::bind( &Body::setState, acceleratingBody.second, std::placeholders::_1 );
+    }
+
+    return std::make_shared< acceleration_partials::NumericalAccelerationPartial >(
+                accelerationModel, acceleratedBody.first, acceleratingBody.first,
+                std::bind( &Body::getState, acceleratedBody.second ),
+                std::bind( &Body::setState, acceleratedBody.second, std::placeholders::_1 ),
+                acceleratingBodyStateFunction, acceleratingBodyStateSetFunction, jacobianSettings,
+                std::bind( &updateTranslationalStateDependentEnvironment, acceleratedBody.second, std::placeholders::_1 ) );
+}
+
 template std::shared_ptr< acceleration_partials::AccelerationPartial > createAnalyticalAccelerationPartial< double >(
         std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
         const std::pair< std::string, std::shared_ptr< simulation_setup::Body > > acceleratedBody,
         const std::pair< std::string, std::shared_ptr< simulation_setup::Body > > acceleratingBody,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 template std::shared_ptr< acceleration_partials::AccelerationPartial > createAnalyticalAccelerationPartial< long double >(
@@ -89,19 +140,22 @@ template std::shared_ptr< acceleration_partials::AccelerationPartial > createAna
         const std::pair< std::string, std::shared_ptr< simulation_setup::Body > > acceleratingBody,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< long double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 #endif
 
 template orbit_determination::StateDerivativePartialsMap createAccelerationPartialsMap< double >(
         const basic_astrodynamics::AccelerationMap& accelerationMap,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
         template orbit_determination::StateDerivativePartialsMap createAccelerationPartialsMap< long double >(
                 const basic_astrodynamics::AccelerationMap& accelerationMap,
                 const simulation_setup::NamedBodyMap& bodyMap,
                 const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< long double > >
-                parametersToEstimate );
+                parametersToEstimate,
+                const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 }
 
@@ -26,6 +26,7 @@
 #include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/mutualSphericalHarmonicGravityPartial.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/empiricalAccelerationPartial.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/directTidalDissipationAccelerationPartial.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/numericalAccelerationPartial.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/ObservationPartials/rotationMatrixPartial.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createCartesianStatePartials.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModelTypes.h"
@@ -48,6 +49,39 @@ std::vector< std::shared_ptr< orbit_determination::TidalLoveNumberPartialInterfa
         const NamedBodyMap& bodyMap,
         const std::string& acceleratingBodyName );
 
+//! Function to update the environment models of a body that depend on its translational state.
+/*!
+ *  Function to update the environment models of a body that depend on its translational state (and that of its central
+ *  body), for use when the states are perturbed to compute numerical partials. The flight conditions of the body are
+ *  recomputed, as is its rotation if it is computed from a dependent orientation calculator (e.g. from aerodynamic
+ *  angles), rather than from a rotational ephemeris.
+ *  \param body Body for which the state-dependent environment is to be updated.
+ *  \param currentTime Time at which the environment is to be updated.
+ */
+void updateTranslationalStateDependentEnvironment(
+        const std::shared_ptr< simulation_setup::Body > body, const double currentTime );
+
+//! Function to create an acceleration partial derivative object that computes the state partials numerically.
+/*!
+ *  Function to create an acceleration partial derivative object that computes the partials w.r.t. the translational states
+ *  of the bodies undergoing and exerting the acceleration by numerical differentiation (see NumericalAccelerationPartial).
+ *  When perturbing the body states, the acceleration model itself is updated, as are the flight conditions and the
+ *  state-dependent rotation of the body undergoing the acceleration (see updateTranslationalStateDependentEnvironment).
+ *  Any other environment models that depend on the perturbed states (e.g. those of other bodies) are not updated, so
+ *  their influence on the acceleration is not included in the partials.
+ *  \param accelerationModel Acceleration model for which a partial derivative is to be computed.
+ *  \param acceleratedBody Pair of name and object of body undergoing acceleration
+ *  \param acceleratingBody Pair of name and object of body exerting acceleration (object may be nullptr)
+ *  \param jacobianSettings Settings for the numerical differentiation. The numerical partial is always evaluated
+ *  sequentially, so the number of threads in these settings is not used (see NumericalAccelerationPartial).
+ *  \return Single (numerical) acceleration partial derivative object.
+ */
+std::shared_ptr< acceleration_partials::AccelerationPartial > createNumericalAccelerationPartial(
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+        const std::pair< std::string, std::shared_ptr< simulation_setup::Body > > acceleratedBody,
+        const std::pair< std::string, std::shared_ptr< simulation_setup::Body > > acceleratingBody,
+        const numerical_derivatives::NumericalJacobianSettings& jacobianSettings );
+
 //! Function to create a single acceleration partial derivative object.
 /*!
  *  Function to create a single acceleration partial derivative object.
@@ -57,6 +91,9 @@ std::vector< std::shared_ptr< orbit_determination::TidalLoveNumberPartialInterfa
  *  \param bodyMap List of all body objects
  *  \param parametersToEstimate List of parameters that are to be estimated. Empty by default, only required for selected
  *  types of partials (e.g. spherical harmonic acceleration w.r.t. rotational parameters).
+ *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no analytical
+ *  partial is implemented (see createNumericalAccelerationPartial). If nullptr (default), an exception is thrown for such
+ *  acceleration models.
  *  \return Single acceleration partial derivative object.
  */
 template< typename InitialStateParameterType = double >
@@ -67,7 +104,8 @@ std::shared_ptr< acceleration_partials::AccelerationPartial > createAnalyticalAc
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< InitialStateParameterType > >
         parametersToEstimate =
-        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< InitialStateParameterType > >( ) )
+        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< InitialStateParameterType > >( ),
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr )
 {
     using namespace gravitation;
     using namespace basic_astrodynamics;
@@ -395,9 +433,17 @@ std::shared_ptr< acceleration_partials::AccelerationPartial > createAnalyticalAc
         break;
     }
     default:
-        std::string errorMessage = "Acceleration model " + std::to_string( accelerationType ) +
-                " not found when making acceleration partial";
-        throw std::runtime_error( errorMessage );
+        if( numericalPartialSettings != nullptr )
+        {
+            accelerationPartial = createNumericalAccelerationPartial(
+                        accelerationModel, acceleratedBody, acceleratingBody, *numericalPartialSettings );
+        }
+        else
+        {
+            std::string errorMessage = "Acceleration model " + std::to_string( accelerationType ) +
+                    " not found when making acceleration partial";
+            throw std::runtime_error( errorMessage );
+        }
         break;
     }
 
@@ -410,7 +456,8 @@ extern template std::shared_ptr< acceleration_partials::AccelerationPartial > cr
         const std::pair< std::string, std::shared_ptr< simulation_setup::Body > > acceleratingBody,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 extern template std::shared_ptr< acceleration_partials::AccelerationPartial > createAnalyticalAccelerationPartial< long double >(
         std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
@@ -418,7 +465,8 @@ extern template std::shared_ptr< acceleration_partials::AccelerationPartial > cr
         const std::pair< std::string, std::shared_ptr< simulation_setup::Body > > acceleratingBody,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< long double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 #endif
 
 //! This function creates acceleration partial objects for translational dynamics
@@ -430,6 +478,9 @@ extern template std::shared_ptr< acceleration_partials::AccelerationPartial > cr
  *   body.
  *  \param bodyMap List of body objects constituting environment for calculations.
  *  \param parametersToEstimate List of parameters which are to be estimated.
+ *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no analytical
+ *  partial is implemented. If nullptr (default), an exception is thrown for such acceleration models. Such numerical
+ *  partials are evaluated sequentially, regardless of the number of threads in these settings.
  *  \return List of acceleration-partial-calculating objects in StateDerivativePartialsMap type.
  */
 template< typename InitialStateParameterType >
@@ -437,7 +488,8 @@ orbit_determination::StateDerivativePartialsMap createAccelerationPartialsMap(
         const basic_astrodynamics::AccelerationMap& accelerationMap,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< InitialStateParameterType > >
-        parametersToEstimate )
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr )
 {
     // Declare return map.
     orbit_determination::StateDerivativePartialsMap accelerationPartialsList;
@@ -494,7 +546,7 @@ orbit_determination::StateDerivativePartialsMap createAccelerationPartialsMap(
                                         innerAccelerationIterator->second[ j ],
                                         std::make_pair( acceleratedBody, acceleratedBodyObject ),
                                         std::make_pair( acceleratingBody, acceleratingBodyObject ),
-                                        bodyMap, parametersToEstimate );
+                                        bodyMap, parametersToEstimate, numericalPartialSettings );
 
                             accelerationPartialVector.push_back( currentAccelerationPartial );
                             accelerationPartialsMap[ acceleratedBody ][ acceleratingBody ].push_back(
@@ -517,14 +569,16 @@ extern template orbit_determination::StateDerivativePartialsMap createAccelerati
 const basic_astrodynamics::AccelerationMap& accelerationMap,
 const simulation_setup::NamedBodyMap& bodyMap,
 const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > >
-parametersToEstimate );
+parametersToEstimate,
+const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 extern template orbit_determination::StateDerivativePartialsMap createAccelerationPartialsMap< long double >(
 const basic_astrodynamics::AccelerationMap& accelerationMap,
 const simulation_setup::NamedBodyMap& bodyMap,
 const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< long double > >
-parametersToEstimate );
+parametersToEstimate,
+const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 #endif
 
 } // namespace simulation_setup
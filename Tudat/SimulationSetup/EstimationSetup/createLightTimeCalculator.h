@@ -42,7 +42,7 @@ std::shared_ptr< ephemerides::Ephemeris > createReferencePointEphemeris(
 
     // Create list of state/rotation functions that are to be used
     std::map< int, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType& ) > > stationEphemerisVector;
-    stationEphemerisVector[ 2 ] = std::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris
+    stationEphemerisVector[ 2 ] = std::bind( &simulation_setup::Body::computeStateInBaseFrameFromEphemeris
                                                < StateScalarType, TimeType >, bodyWithReferencePoint, std::placeholders::_1 );
     stationEphemerisVector[ 0 ] = referencePointStateFunction;
 
@@ -97,7 +97,7 @@ std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType& ) > getLi
     {
         // Create function to calculate state of transmitting ground station.
         linkEndCompleteEphemerisFunction =
-                std::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
+                std::bind( &simulation_setup::Body::computeStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
                                                         bodyWithLinkEnd, std::placeholders::_1 );
     }
     return linkEndCompleteEphemerisFunction;
@@ -123,6 +123,35 @@ std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > getLin
     return getLinkEndCompleteEphemerisFunction< TimeType, StateScalarType >( bodyMap.at( linkEndId.first ), linkEndId );
 }
 
+//! Class defining the settings for warm-starting the light-time iteration from previous solutions.
+/*!
+ *  Class defining the settings for warm-starting the light-time iteration from previous solutions (see
+ *  LightTimeCalculator::setWarmStartSettings). If an object of this type is provided when creating a light-time
+ *  calculator, warm start is used for that calculator.
+ */
+class LightTimeWarmStartSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param extrapolationOrder Order of polynomial used to extrapolate previous solutions (0 is use most recent
+     *  solution directly).
+     *  \param maximumTimeInterval Maximum difference between input time and time of most recent solution for which
+     *  warm start is used.
+     */
+    LightTimeWarmStartSettings( const int extrapolationOrder = 2,
+                                const double maximumTimeInterval = 600.0 ):
+        extrapolationOrder_( extrapolationOrder ), maximumTimeInterval_( maximumTimeInterval ){ }
+
+    //! Order of polynomial used to extrapolate previous solutions.
+    int extrapolationOrder_;
+
+    //! Maximum difference between input time and time of most recent solution for which warm start is used.
+    double maximumTimeInterval_;
+};
+
 //! Function to create a light-time calculation object
 /*!
  *  Function to create a light-time calculation object from light time correction settings environment and link end
@@ -134,6 +163,7 @@ std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > getLin
  *  light time.
  *  \param transmittingLinkEnd Identifier for transmitting link end.
  *  \param receivingLinkEnd Identifier for receiving link end.
+ *  \param warmStartSettings Settings for warm-starting the light-time iteration (default nullptr: no warm start).
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
 std::shared_ptr< observation_models::LightTimeCalculator< ObservationScalarType, TimeType > >
@@ -143,7 +173,8 @@ createLightTimeCalculator(
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::vector< std::shared_ptr< LightTimeCorrectionSettings > >& lightTimeCorrections,
         const LinkEndId& transmittingLinkEnd,
-        const LinkEndId& receivingLinkEnd )
+        const LinkEndId& receivingLinkEnd,
+        const std::shared_ptr< LightTimeWarmStartSettings > warmStartSettings = nullptr )
 {
     std::vector< std::shared_ptr< LightTimeCorrection > > lightTimeCorrectionFunctions;
 
@@ -157,8 +188,17 @@ createLightTimeCalculator(
     }
 
     // Create light time calculator.
-    return std::make_shared< LightTimeCalculator< ObservationScalarType, TimeType > >
+    std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > lightTimeCalculator =
+            std::make_shared< LightTimeCalculator< ObservationScalarType, TimeType > >
             ( transmitterCompleteEphemeris, receiverCompleteEphemeris, lightTimeCorrectionFunctions );
+
+    // Set light-time iteration warm start, if required.
+    if( warmStartSettings != nullptr )
+    {
+        lightTimeCalculator->setWarmStartSettings(
+                    true, warmStartSettings->extrapolationOrder_, warmStartSettings->maximumTimeInterval_ );
+    }
+    return lightTimeCalculator;
 }
 
 //! Function to create a light-time calculation object
@@ -170,6 +210,7 @@ createLightTimeCalculator(
  *  \param bodyMap List of body objects that comprises the environment
  *  \param lightTimeCorrections List of light time corrections (w.r.t. Euclidean distance) that are applied when computing
  *  light time.
+ *  \param warmStartSettings Settings for warm-starting the light-time iteration (default nullptr: no warm start).
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
 std::shared_ptr< observation_models::LightTimeCalculator< ObservationScalarType, TimeType > >
@@ -178,7 +219,8 @@ createLightTimeCalculator(
         const LinkEndId& receivingLinkEnd,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::vector< std::shared_ptr< LightTimeCorrectionSettings > >& lightTimeCorrections =
-        std::vector< std::shared_ptr< LightTimeCorrectionSettings > >( ) )
+        std::vector< std::shared_ptr< LightTimeCorrectionSettings > >( ),
+        const std::shared_ptr< LightTimeWarmStartSettings > warmStartSettings = nullptr )
 {
 
     // Get link end state functions and create light time calculator.
@@ -187,7 +229,7 @@ createLightTimeCalculator(
                     transmittingLinkEnd, bodyMap ),
                 getLinkEndCompleteEphemerisFunction< TimeType, ObservationScalarType >(
                     receivingLinkEnd, bodyMap ),
-                bodyMap, lightTimeCorrections, transmittingLinkEnd, receivingLinkEnd );
+                bodyMap, lightTimeCorrections, transmittingLinkEnd, receivingLinkEnd, warmStartSettings );
 }
 
 } // namespace observation_models
@@ -68,6 +68,9 @@ std::shared_ptr< propagators::SingleArcDynamicsSimulator< StateScalarType, TimeT
  *  (default true) after propagation and resetting of state transition interface.
  *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
  *  end of this contructor.
+ *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no analytical
+ *  partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown for such
+ *  acceleration models.
  *  \return Single-arc variational equations solver object
  */
 template< typename StateScalarType = double, typename TimeType = double >
@@ -81,12 +84,13 @@ createSingleArcVariationalEquationsSolver(
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings
         = std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
         const bool clearNumericalSolution = 1,
-        const bool integrateEquationsOnCreation = 1 )
+        const bool integrateEquationsOnCreation = 1,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr )
 {
     return std::make_shared< propagators::SingleArcVariationalEquationsSolver< StateScalarType, TimeType > >(
                 bodyMap, integratorSettings, propagatorSettings, parametersToEstimate,
                 integrateDynamicalAndVariationalEquationsConcurrently, variationalOnlyIntegratorSettings,
-                clearNumericalSolution, integrateEquationsOnCreation );
+                clearNumericalSolution, integrateEquationsOnCreation, true, numericalPartialSettings );
 }
 
 //! Function to create multi-arc variational equations solver object
@@ -104,6 +108,9 @@ createSingleArcVariationalEquationsSolver(
  *  (default true) after propagation and resetting of state transition interface.
  *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
  *  end of this contructor.
+ *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no analytical
+ *  partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown for such
+ *  acceleration models.
  *  \return Multi-arc variational equations solver object
  */
 template< typename StateScalarType = double, typename TimeType = double >
@@ -117,14 +124,15 @@ createMultiArcVariationalEquationsSolver(
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings
         = std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
         const bool clearNumericalSolution = 1,
-        const bool integrateEquationsOnCreation = 1 )
+        const bool integrateEquationsOnCreation = 1,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr )
 {
     std::vector< double > arcStartTimes = estimatable_parameters::getMultiArcStateEstimationArcStartTimes(
                 parametersToEstimate, true );
     return std::make_shared< propagators::MultiArcVariationalEquationsSolver< StateScalarType, TimeType > >(
                 bodyMap, integratorSettings, propagatorSettings, parametersToEstimate, arcStartTimes,
                 integrateDynamicalAndVariationalEquationsConcurrently, variationalOnlyIntegratorSettings,
-                clearNumericalSolution, integrateEquationsOnCreation );
+                clearNumericalSolution, integrateEquationsOnCreation, true, numericalPartialSettings );
 }
 
 
@@ -143,6 +151,9 @@ createMultiArcVariationalEquationsSolver(
  *  (default true) after propagation and resetting of state transition interface.
  *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
  *  end of this contructor.
+ *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no analytical
+ *  partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown for such
+ *  acceleration models.
  *  \return Hybrid-arc variational equations solver object
  */
 template< typename StateScalarType = double, typename TimeType = double >
@@ -156,14 +167,15 @@ createHybridArcVariationalEquationsSolver(
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings
         = std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
         const bool clearNumericalSolution = 1,
-        const bool integrateEquationsOnCreation = 1 )
+        const bool integrateEquationsOnCreation = 1,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr )
 {
     std::vector< double > arcStartTimes = estimatable_parameters::getMultiArcStateEstimationArcStartTimes(
                 parametersToEstimate, false );
     return std::make_shared< propagators::HybridArcVariationalEquationsSolver< StateScalarType, TimeType > >(
                 bodyMap, integratorSettings, propagatorSettings, parametersToEstimate, arcStartTimes,
                 integrateDynamicalAndVariationalEquationsConcurrently,
-                clearNumericalSolution, integrateEquationsOnCreation );
+                clearNumericalSolution, integrateEquationsOnCreation, numericalPartialSettings );
 }
 
 //! Function to create variational equations solver object
@@ -181,6 +193,9 @@ createHybridArcVariationalEquationsSolver(
 *  (default true) after propagation and resetting of state transition interface.
 *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
 *  end of this contructor.
+*  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no analytical
+*  partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown for such
+*  acceleration models.
 *  \return Variational equations solver object
 */
 template< typename StateScalarType = double, typename TimeType = double >
@@ -194,25 +209,29 @@ createVariationalEquationsSolver(
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings
         = std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
         const bool clearNumericalSolution = 1,
-        const bool integrateEquationsOnCreation = 1 )
+        const bool integrateEquationsOnCreation = 1,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr )
 {
     if( std::dynamic_pointer_cast< propagators::SingleArcPropagatorSettings< StateScalarType > >( propagatorSettings ) != nullptr )
     {
         return createSingleArcVariationalEquationsSolver(
                     bodyMap, integratorSettings, propagatorSettings, parametersToEstimate, integrateDynamicalAndVariationalEquationsConcurrently,
-                    variationalOnlyIntegratorSettings, clearNumericalSolution, integrateEquationsOnCreation );
+                    variationalOnlyIntegratorSettings, clearNumericalSolution, integrateEquationsOnCreation,
+                    numericalPartialSettings );
     }
     else if( std::dynamic_pointer_cast< propagators::MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings ) != nullptr )
     {
         return createMultiArcVariationalEquationsSolver(
                     bodyMap, integratorSettings, propagatorSettings, parametersToEstimate, integrateDynamicalAndVariationalEquationsConcurrently,
-                    variationalOnlyIntegratorSettings, clearNumericalSolution, integrateEquationsOnCreation );
+                    variationalOnlyIntegratorSettings, clearNumericalSolution, integrateEquationsOnCreation,
+                    numericalPartialSettings );
     }
     else if( std::dynamic_pointer_cast< propagators::HybridArcPropagatorSettings< StateScalarType > >( propagatorSettings ) != nullptr )
     {
         return createHybridArcVariationalEquationsSolver(
                     bodyMap, integratorSettings, propagatorSettings, parametersToEstimate, integrateDynamicalAndVariationalEquationsConcurrently,
-                    variationalOnlyIntegratorSettings, clearNumericalSolution, integrateEquationsOnCreation );
+                    variationalOnlyIntegratorSettings, clearNumericalSolution, integrateEquationsOnCreation,
+                    numericalPartialSettings );
     }
     else
     {
@@ -272,7 +291,8 @@ createSingleArcVariationalEquationsSolver< double, double >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 extern template std::shared_ptr< propagators::SingleArcDynamicsSimulator< double, double > >
 createSingleArcDynamicsSimulator< double, double >(
@@ -292,7 +312,8 @@ createMultiArcVariationalEquationsSolver< double, double >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 extern template std::shared_ptr< propagators::HybridArcVariationalEquationsSolver< double, double > >
 createHybridArcVariationalEquationsSolver< double, double >(
@@ -303,7 +324,8 @@ createHybridArcVariationalEquationsSolver< double, double >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 
 extern template std::shared_ptr< propagators::VariationalEquationsSolver< double, double > >
@@ -315,7 +337,8 @@ createVariationalEquationsSolver< double, double >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 
@@ -356,7 +379,8 @@ createSingleArcVariationalEquationsSolver< double, Time >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 extern template std::shared_ptr< propagators::SingleArcVariationalEquationsSolver< long double, Time > >
 createSingleArcVariationalEquationsSolver< long double, Time >(
@@ -367,7 +391,8 @@ createSingleArcVariationalEquationsSolver< long double, Time >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 extern template std::shared_ptr< propagators::SingleArcVariationalEquationsSolver< long double, double > >
 createSingleArcVariationalEquationsSolver< long double, double >(
@@ -378,7 +403,8 @@ createSingleArcVariationalEquationsSolver< long double, double >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 
 
@@ -391,7 +417,8 @@ createHybridArcVariationalEquationsSolver< double, Time >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 extern template std::shared_ptr< propagators::HybridArcVariationalEquationsSolver< long double, Time > >
 createHybridArcVariationalEquationsSolver< long double, Time >(
@@ -402,7 +429,8 @@ createHybridArcVariationalEquationsSolver< long double, Time >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 extern template std::shared_ptr< propagators::HybridArcVariationalEquationsSolver< long double, double > >
 createHybridArcVariationalEquationsSolver< long double, double >(
@@ -413,7 +441,8 @@ createHybridArcVariationalEquationsSolver< long double, double >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 
 
@@ -426,7 +455,8 @@ createMultiArcVariationalEquationsSolver< double, Time >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 extern template std::shared_ptr< propagators::MultiArcVariationalEquationsSolver< long double, Time > >
 createMultiArcVariationalEquationsSolver< long double, Time >(
@@ -437,7 +467,8 @@ createMultiArcVariationalEquationsSolver< long double, Time >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 extern template std::shared_ptr< propagators::MultiArcVariationalEquationsSolver< long double, double > >
 createMultiArcVariationalEquationsSolver< long double, double >(
@@ -448,7 +479,8 @@ createMultiArcVariationalEquationsSolver< long double, double >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 
 
@@ -462,7 +494,8 @@ createVariationalEquationsSolver< double, Time >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 extern template std::shared_ptr< propagators::VariationalEquationsSolver< long double, Time > >
 createVariationalEquationsSolver< long double, Time >(
@@ -473,7 +506,8 @@ createVariationalEquationsSolver< long double, Time >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 extern template std::shared_ptr< propagators::VariationalEquationsSolver< long double, double > >
 createVariationalEquationsSolver< long double, double >(
@@ -484,7 +518,8 @@ createVariationalEquationsSolver< long double, double >(
         const bool integrateDynamicalAndVariationalEquationsConcurrently,
         const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings,
         const bool clearNumericalSolution,
-        const bool integrateEquationsOnCreation );
+        const bool integrateEquationsOnCreation,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 #endif
 
@@ -193,13 +193,17 @@ public:
      * \param lightTimeCorrections Settings for a single light-time correction that is to be used for the observation model
      * (nullptr if none)
      * \param biasSettings Settings for the observation bias model that is to be used (default none: nullptr)
+     * \param lightTimeWarmStartSettings Settings for warm-starting the light-time iteration(s) of the observation model
+     * (default none: nullptr)
      */
     ObservationSettings(
             const observation_models::ObservableType observableType,
             const std::shared_ptr< LightTimeCorrectionSettings > lightTimeCorrections,
-            const std::shared_ptr< ObservationBiasSettings > biasSettings = nullptr ):
+            const std::shared_ptr< ObservationBiasSettings > biasSettings = nullptr,
+            const std::shared_ptr< LightTimeWarmStartSettings > lightTimeWarmStartSettings = nullptr ):
         observableType_( observableType ),
-        biasSettings_( biasSettings )
+        biasSettings_( biasSettings ),
+        lightTimeWarmStartSettings_( lightTimeWarmStartSettings )
     {
         if( lightTimeCorrections != nullptr )
         {
@@ -214,14 +218,17 @@ public:
      * \param lightTimeCorrectionsList List of settings for a single light-time correction that is to be used for the observation
      * model
      * \param biasSettings Settings for the observation bias model that is to be used (default none: nullptr)
+     * \param lightTimeWarmStartSettings Settings for warm-starting the light-time iteration(s) of the observation model
+     * (default none: nullptr)
      */
     ObservationSettings(
             const observation_models::ObservableType observableType,
             const std::vector< std::shared_ptr< LightTimeCorrectionSettings > > lightTimeCorrectionsList =
             std::vector< std::shared_ptr< LightTimeCorrectionSettings > >( ),
-            const std::shared_ptr< ObservationBiasSettings > biasSettings = nullptr ):
+            const std::shared_ptr< ObservationBiasSettings > biasSettings = nullptr,
+            const std::shared_ptr< LightTimeWarmStartSettings > lightTimeWarmStartSettings = nullptr ):
         observableType_( observableType ),lightTimeCorrectionsList_( lightTimeCorrectionsList ),
-        biasSettings_( biasSettings ){ }
+        biasSettings_( biasSettings ), lightTimeWarmStartSettings_( lightTimeWarmStartSettings ){ }
 
     //! Destructor
     virtual ~ObservationSettings( ){ }
@@ -234,6 +241,14 @@ public:
 
     //! Settings for the observation bias model that is to be used (default none: nullptr)
     std::shared_ptr< ObservationBiasSettings > biasSettings_;
+
+    //! Settings for warm-starting the light-time iteration(s) of the observation model (default none: nullptr).
+    /*!
+     *  Settings for warm-starting the light-time iteration(s) of the observation model (default none: nullptr). If set, each
+     *  light-time calculator of the observation model starts its iteration from the extrapolated previous solutions of that
+     *  calculator (see LightTimeCalculator::setWarmStartSettings).
+     */
+    std::shared_ptr< LightTimeWarmStartSettings > lightTimeWarmStartSettings_;
 };
 
 //! Enum defining all possible types of proper time rate computations in one-way Doppler
@@ -837,7 +852,8 @@ public:
                     ObservationScalarType, TimeType > >(
                         createLightTimeCalculator< ObservationScalarType, TimeType >(
                             linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                            bodyMap, observationSettings->lightTimeCorrectionsList_ ),
+                            bodyMap, observationSettings->lightTimeCorrectionsList_,
+                            observationSettings->lightTimeWarmStartSettings_ ),
                         observationBias );
 
             break;
@@ -876,7 +892,8 @@ public:
                         ObservationScalarType, TimeType > >(
                             createLightTimeCalculator< ObservationScalarType, TimeType >(
                                 linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                                bodyMap, observationSettings->lightTimeCorrectionsList_ ),
+                                bodyMap, observationSettings->lightTimeCorrectionsList_,
+                                observationSettings->lightTimeWarmStartSettings_ ),
                             observationBias );
             }
             else
@@ -888,7 +905,8 @@ public:
                         ObservationScalarType, TimeType > >(
                             createLightTimeCalculator< ObservationScalarType, TimeType >(
                                 linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                                bodyMap, observationSettings->lightTimeCorrectionsList_ ),
+                                bodyMap, observationSettings->lightTimeCorrectionsList_,
+                                observationSettings->lightTimeWarmStartSettings_ ),
                             createOneWayDopplerProperTimeCalculator< ObservationScalarType, TimeType >(
                                 oneWayDopplerSettings->transmitterProperTimeRateSettings_, linkEnds, bodyMap, transmitter ),
                             createOneWayDopplerProperTimeCalculator< ObservationScalarType, TimeType >(
@@ -952,11 +970,13 @@ public:
                             std::dynamic_pointer_cast< OneWayDopplerObservationModel< ObservationScalarType, TimeType > >(
                                 ObservationModelCreator< 1, ObservationScalarType, TimeType >::createObservationModel(
                                     uplinkLinkEnds, std::make_shared< ObservationSettings >(
-                                        one_way_doppler, observationSettings->lightTimeCorrectionsList_ ), bodyMap ) ),
+                                        one_way_doppler, observationSettings->lightTimeCorrectionsList_, nullptr,
+                                        observationSettings->lightTimeWarmStartSettings_ ), bodyMap ) ),
                             std::dynamic_pointer_cast< OneWayDopplerObservationModel< ObservationScalarType, TimeType > >(
                                 ObservationModelCreator< 1, ObservationScalarType, TimeType >::createObservationModel(
                                     downlinkLinkEnds, std::make_shared< ObservationSettings >(
-                                        one_way_doppler, observationSettings->lightTimeCorrectionsList_ ), bodyMap ) ),
+                                        one_way_doppler, observationSettings->lightTimeCorrectionsList_, nullptr,
+                                        observationSettings->lightTimeWarmStartSettings_ ), bodyMap ) ),
                             observationBias );
             }
             else
@@ -1013,10 +1033,12 @@ public:
                     ObservationScalarType, TimeType > >(
                         createLightTimeCalculator< ObservationScalarType, TimeType >(
                             linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                            bodyMap, observationSettings->lightTimeCorrectionsList_ ),
+                            bodyMap, observationSettings->lightTimeCorrectionsList_,
+                            observationSettings->lightTimeWarmStartSettings_ ),
                         createLightTimeCalculator< ObservationScalarType, TimeType >(
                             linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                            bodyMap, observationSettings->lightTimeCorrectionsList_ ),
+                            bodyMap, observationSettings->lightTimeCorrectionsList_,
+                            observationSettings->lightTimeWarmStartSettings_ ),
                         rangeRateObservationSettings->integrationTimeFunction_,
                         observationBias );
 
@@ -1107,14 +1129,17 @@ public:
                                 createLightTimeCalculator< ObservationScalarType, TimeType >(
                                     transmitterIterator->second, receiverIterator->second,
                                     bodyMap, nWayRangeObservationSettings->oneWayRangeObsevationSettings_.at( i )->
-                                    lightTimeCorrectionsList_ ) );
+                                    lightTimeCorrectionsList_,
+                                    nWayRangeObservationSettings->oneWayRangeObsevationSettings_.at( i )->
+                                    lightTimeWarmStartSettings_ ) );
                 }
                 else
                 {
                     lightTimeCalculators.push_back(
                                 createLightTimeCalculator< ObservationScalarType, TimeType >(
                                     transmitterIterator->second, receiverIterator->second,
-                                    bodyMap, observationSettings->lightTimeCorrectionsList_ ) );
+                                    bodyMap, observationSettings->lightTimeCorrectionsList_,
+                                    observationSettings->lightTimeWarmStartSettings_ ) );
                 }
 
                 transmitterIterator++;
@@ -1200,7 +1225,8 @@ public:
                     ObservationScalarType, TimeType > >(
                         createLightTimeCalculator< ObservationScalarType, TimeType >(
                             linkEnds.at( transmitter ), linkEnds.at( receiver ),
-                            bodyMap, observationSettings->lightTimeCorrectionsList_ ),
+                            bodyMap, observationSettings->lightTimeCorrectionsList_,
+                            observationSettings->lightTimeWarmStartSettings_ ),
                         observationBias );
 
             break;
@@ -1282,7 +1308,7 @@ public:
             // Create observation model
             observationModel = std::make_shared< PositionObservationModel<
                     ObservationScalarType, TimeType > >(
-                        std::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris<
+                        std::bind( &simulation_setup::Body::computeStateInBaseFrameFromEphemeris<
                                      ObservationScalarType, TimeType >,
                                      bodyMap.at( linkEnds.at( observed_body ).first ), std::placeholders::_1 ),
                         observationBias );
@@ -12,7 +12,8 @@ template std::map< propagators::IntegratedStateType, orbit_determination::StateD
         stateDerivativeModels,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 template std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap > createStateDerivativePartials< long double, double >(
@@ -21,21 +22,24 @@ template std::map< propagators::IntegratedStateType, orbit_determination::StateD
         stateDerivativeModels,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< long double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 template std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap > createStateDerivativePartials< double, Time >(
         const std::unordered_map< propagators::IntegratedStateType,
         std::vector< std::shared_ptr< propagators::SingleStateTypeDerivative< double, Time > > > >
         stateDerivativeModels,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 template std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap > createStateDerivativePartials< long double, Time >(
         const std::unordered_map< propagators::IntegratedStateType,
         std::vector< std::shared_ptr< propagators::SingleStateTypeDerivative< long double, Time > > > >
         stateDerivativeModels,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< long double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 #endif
 
 } // namespace simulation_setup
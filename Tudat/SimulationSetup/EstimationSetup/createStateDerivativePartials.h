@@ -32,6 +32,9 @@ namespace simulation_setup
  *  \param bodyMap List of boy objects storing environment models of simulation
  *  \param parametersToEstimate Object containing all parameters that are to be estimated and their current settings and
  *  values.
+ *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no analytical
+ *  partial is implemented (see createAccelerationPartialsMap). If nullptr (default), an exception is thrown for such
+ *  acceleration models.
  *  return List partials of state derivative models from. The key is the type of dynamics for which partials are taken,
  *  the values are StateDerivativePartialsMap (see StateDerivativePartialsMap definition for details).
  */
@@ -42,7 +45,8 @@ std::map< propagators::IntegratedStateType, orbit_determination::StateDerivative
         stateDerivativeModels,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > >
-        parametersToEstimate )
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr )
 {
     std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials;
 
@@ -72,7 +76,7 @@ std::map< propagators::IntegratedStateType, orbit_determination::StateDerivative
                             stateDerivativeIterator->second.at( 0 ) )->getFullAccelerationsMap( );
                 stateDerivativePartials[ propagators::translational_state ] =
                         createAccelerationPartialsMap< StateScalarType >(
-                            accelerationModelList, bodyMap, parametersToEstimate );
+                            accelerationModelList, bodyMap, parametersToEstimate, numericalPartialSettings );
             }
             break;
         }
@@ -111,7 +115,8 @@ extern template std::map< propagators::IntegratedStateType, orbit_determination:
         stateDerivativeModels,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 extern template std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap > createStateDerivativePartials< long double, double >(
@@ -120,21 +125,24 @@ extern template std::map< propagators::IntegratedStateType, orbit_determination:
         stateDerivativeModels,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< long double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 extern template std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap > createStateDerivativePartials< double, Time >(
         const std::unordered_map< propagators::IntegratedStateType,
         std::vector< std::shared_ptr< propagators::SingleStateTypeDerivative< double, Time > > > >
         stateDerivativeModels,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 extern template std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap > createStateDerivativePartials< long double, Time >(
         const std::unordered_map< propagators::IntegratedStateType,
         std::vector< std::shared_ptr< propagators::SingleStateTypeDerivative< long double, Time > > > >
         stateDerivativeModels,
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< long double > >
-        parametersToEstimate );
+        parametersToEstimate,
+        const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings );
 #endif
 
 } // namespace simulation_setup
@@ -0,0 +1,187 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/multiArcEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createGroundStations.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/EstimationSetup/earthOrbiterEstimationTestSetup.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace observation_models;
+using namespace estimatable_parameters;
+using namespace simulation_setup;
+using namespace ephemerides;
+
+//! Function to create the bodies for the analytical Earth orbiter estimation test setup.
+NamedBodyMap createEarthOrbiterTestBodies(
+        const double initialTime, const bool useMultiArcEphemeris, const std::string& globalFrameOrigin )
+{
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+    bodySettings[ "Earth" ]->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+                "ECLIPJ2000", "IAU_Earth",
+                Eigen::Quaterniond( Eigen::AngleAxisd( 0.4, Eigen::Vector3d::UnitX( ) ) ), initialTime,
+                2.0 * mathematical_constants::PI / physical_constants::JULIAN_DAY );
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.84165E-4;
+    cosineCoefficients( 2, 2 ) = 2.43914E-6;
+    sineCoefficients( 2, 2 ) = -1.40016E-6;
+    bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< SphericalHarmonicsGravityFieldSettings >(
+                earthOrbiterTestGravitationalParameter, 6378137.0, cosineCoefficients, sineCoefficients, "IAU_Earth" );
+    bodySettings[ "Earth" ]->shapeModelSettings = std::make_shared< SphericalBodyShapeSettings >( 6378137.0 );
+
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    if( useMultiArcEphemeris )
+    {
+        bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< MultiArcEphemeris >(
+                                                std::map< double, std::shared_ptr< Ephemeris > >( ),
+                                                "Earth", "ECLIPJ2000" ) );
+    }
+    else
+    {
+        bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< TabulatedCartesianEphemeris< > >(
+                                                std::shared_ptr< interpolators::OneDimensionalInterpolator
+                                                < double, Eigen::Vector6d > >( ), "Earth", "ECLIPJ2000" ) );
+    }
+    setGlobalFrameBodyEphemerides( bodyMap, globalFrameOrigin, "ECLIPJ2000" );
+
+    createGroundStation( bodyMap.at( "Earth" ), "Station1", ( Eigen::Vector3d( ) << 4.0E6, 2.0E6, 4.3E6 ).finished( ) );
+    createGroundStation( bodyMap.at( "Earth" ), "Station2", ( Eigen::Vector3d( ) << -3.0E6, 4.5E6, -2.8E6 ).finished( ) );
+
+    return bodyMap;
+}
+
+//! Function to create the acceleration models for the Vehicle in the analytical Earth orbiter estimation test setup.
+basic_astrodynamics::AccelerationMap createEarthOrbiterTestAccelerationModels( const NamedBodyMap& bodyMap )
+{
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< SphericalHarmonicAccelerationSettings >( 2, 2 ) );
+    return createAccelerationModelsMap(
+                bodyMap, accelerationMap, std::vector< std::string >( { "Vehicle" } ),
+                std::vector< std::string >( { "Earth" } ) );
+}
+
+//! Function to retrieve the nominal Keplerian initial state of the Vehicle in the analytical Earth orbiter test setup.
+Eigen::Vector6d getEarthOrbiterTestKeplerianInitialState( )
+{
+    Eigen::Vector6d initialStateInKeplerianElements;
+    initialStateInKeplerianElements << 7200.0E3, 0.05, 1.2, 2.3, 0.4, 1.9;
+    return initialStateInKeplerianElements;
+}
+
+//! Function to retrieve the link ends per observable for the analytical Earth orbiter estimation test setup.
+std::map< ObservableType, std::vector< LinkEnds > > getEarthOrbiterTestLinkEnds( )
+{
+    std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable;
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair( "Earth", "Station1" );
+    linkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+    linkEndsPerObservable[ one_way_range ].push_back( linkEnds );
+    linkEnds.clear( );
+    linkEnds[ transmitter ] = std::make_pair( "Vehicle", "" );
+    linkEnds[ receiver ] = std::make_pair( "Earth", "Station2" );
+    linkEndsPerObservable[ one_way_range ].push_back( linkEnds );
+    linkEndsPerObservable[ angular_position ].push_back( linkEnds );
+
+    return linkEndsPerObservable;
+}
+
+//! Function to create the observation settings for a list of link ends per observable.
+ObservationSettingsMap getEarthOrbiterTestObservationSettings(
+        const std::map< ObservableType, std::vector< LinkEnds > >& linkEndsPerObservable )
+{
+    ObservationSettingsMap observationSettingsMap;
+    for( auto linkEndIterator = linkEndsPerObservable.begin( ); linkEndIterator != linkEndsPerObservable.end( );
+         linkEndIterator++ )
+    {
+        for( unsigned int i = 0; i < linkEndIterator->second.size( ); i++ )
+        {
+            observationSettingsMap.insert( std::make_pair( linkEndIterator->second.at( i ),
+                                                           std::make_shared< ObservationSettings >( linkEndIterator->first ) ) );
+        }
+    }
+    return observationSettingsMap;
+}
+
+//! Function to retrieve the parameter settings for the analytical Earth orbiter estimation test setup.
+std::vector< std::shared_ptr< EstimatableParameterSettings > > getEarthOrbiterTestParameterSettings(
+        const std::shared_ptr< EstimatableParameterSettings > initialStateParameterSettings )
+{
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( initialStateParameterSettings );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    parameterNames.push_back( std::make_shared< SphericalHarmonicEstimatableParameterSettings >(
+                                  2, 0, 2, 2, "Earth", spherical_harmonics_cosine_coefficient_block ) );
+    return parameterNames;
+}
+
+//! Function to simulate the observations for the analytical Earth orbiter estimation test setup.
+simulation_setup::PodInput< double, double >::PodInputDataType simulateEarthOrbiterTestObservations(
+        const std::map< ObservableType, std::vector< LinkEnds > >& linkEndsPerObservable,
+        const std::vector< double >& observationTimes,
+        const std::map< ObservableType, std::shared_ptr< ObservationSimulatorBase< double, double > > >&
+        observationSimulators )
+{
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > >
+            measurementSimulationInput;
+    for( auto linkEndIterator = linkEndsPerObservable.begin( ); linkEndIterator != linkEndsPerObservable.end( );
+         linkEndIterator++ )
+    {
+        for( unsigned int i = 0; i < linkEndIterator->second.size( ); i++ )
+        {
+            measurementSimulationInput[ linkEndIterator->first ][ linkEndIterator->second.at( i ) ] =
+                    std::make_pair( observationTimes, receiver );
+        }
+    }
+    return simulateObservations< double, double >( measurementSimulationInput, observationSimulators );
+}
+
+//! Function to retrieve the initial parameter perturbation for the analytical Earth orbiter estimation test setup.
+Eigen::VectorXd getEarthOrbiterTestParameterPerturbation( const int numberOfArcs )
+{
+    Eigen::VectorXd parameterPerturbation = Eigen::VectorXd::Zero( 6 * numberOfArcs + 4 );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        parameterPerturbation.segment( 6 * i, 3 ) = Eigen::Vector3d::Constant( 10.0 );
+        parameterPerturbation.segment( 6 * i + 3, 3 ) = Eigen::Vector3d::Constant( 1.0E-2 );
+    }
+    parameterPerturbation( 6 * numberOfArcs ) = 1.0E7;
+    parameterPerturbation( 6 * numberOfArcs + 1 ) = 1.0E-8;
+    return parameterPerturbation;
+}
+
+//! Function to retrieve the weight per observable for the analytical Earth orbiter estimation test setup.
+std::map< ObservableType, double > getEarthOrbiterTestWeightPerObservable( )
+{
+    std::map< ObservableType, double > weightPerObservable;
+    weightPerObservable[ one_way_range ] = 1.0;
+    weightPerObservable[ angular_position ] = 1.0 / ( 1.0E-5 * 1.0E-5 );
+    return weightPerObservable;
+}
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,140 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_EARTHORBITERESTIMATIONTESTSETUP_H
+#define TUDAT_EARTHORBITERESTIMATIONTESTSETUP_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
+#include "Tudat/Astrodynamics/ObservationModels/observationSimulator.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/podInputOutputTypes.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createObservationModel.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createEstimatableParameters.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+//! Gravitational parameter of the Earth in the analytical Earth orbiter estimation test setup.
+const double earthOrbiterTestGravitationalParameter = 3.986004418E14;
+
+//! Function to create the bodies for the analytical Earth orbiter estimation test setup.
+/*!
+ *  Function to create the bodies for the analytical Earth orbiter estimation test setup. The Earth has a constant
+ *  ephemeris, a simple rotation model, a degree/order 2 spherical harmonic gravity field and a spherical shape, so that
+ *  no Spice kernels are needed. Ground stations Station1 and Station2 are created on the Earth, and an (empty) Vehicle
+ *  is added, with its ephemeris w.r.t. the Earth to be reset by the orbit determination manager.
+ *  \param initialTime Reference epoch of the Earth rotation model.
+ *  \param useMultiArcEphemeris Boolean denoting whether the Vehicle gets a multi-arc ephemeris (for multi-arc
+ *  estimation), or a tabulated ephemeris (for single-arc estimation).
+ *  \param globalFrameOrigin Global frame origin (Earth or SSB). If SSB is used, the ephemeris origin of the Vehicle
+ *  (Earth) differs from the global frame origin.
+ *  \return Bodies for the analytical Earth orbiter estimation test setup.
+ */
+simulation_setup::NamedBodyMap createEarthOrbiterTestBodies(
+        const double initialTime, const bool useMultiArcEphemeris = false, const std::string& globalFrameOrigin = "Earth" );
+
+//! Function to create the acceleration models for the Vehicle in the analytical Earth orbiter estimation test setup.
+/*!
+ *  Function to create the acceleration models for the Vehicle in the analytical Earth orbiter estimation test setup
+ *  (degree/order 2 spherical harmonic acceleration of the Earth, with Earth as central body).
+ *  \param bodyMap Bodies created by createEarthOrbiterTestBodies.
+ *  \return Acceleration models acting on the Vehicle.
+ */
+basic_astrodynamics::AccelerationMap createEarthOrbiterTestAccelerationModels(
+        const simulation_setup::NamedBodyMap& bodyMap );
+
+//! Function to retrieve the nominal Keplerian initial state of the Vehicle in the analytical Earth orbiter test setup.
+/*!
+ *  Function to retrieve the nominal Keplerian initial state of the Vehicle in the analytical Earth orbiter test setup.
+ *  \return Keplerian initial state of the Vehicle (semi-major axis, eccentricity, inclination, argument of periapsis,
+ *  longitude of ascending node, true anomaly).
+ */
+Eigen::Vector6d getEarthOrbiterTestKeplerianInitialState( );
+
+//! Function to retrieve the link ends per observable for the analytical Earth orbiter estimation test setup.
+/*!
+ *  Function to retrieve the link ends per observable for the analytical Earth orbiter estimation test setup: one-way
+ *  range from Station1 to the Vehicle, and one-way range and angular position from the Vehicle to Station2.
+ *  \return Link ends per observable type.
+ */
+std::map< observation_models::ObservableType, std::vector< observation_models::LinkEnds > >
+getEarthOrbiterTestLinkEnds( );
+
+//! Function to create the observation settings for a list of link ends per observable.
+/*!
+ *  Function to create the observation settings (without light-time corrections or biases) for a list of link ends per
+ *  observable.
+ *  \param linkEndsPerObservable Link ends per observable type.
+ *  \return Observation settings for each set of link ends.
+ */
+observation_models::ObservationSettingsMap getEarthOrbiterTestObservationSettings(
+        const std::map< observation_models::ObservableType, std::vector< observation_models::LinkEnds > >&
+        linkEndsPerObservable );
+
+//! Function to retrieve the parameter settings for the analytical Earth orbiter estimation test setup.
+/*!
+ *  Function to retrieve the parameter settings for the analytical Earth orbiter estimation test setup: the (single- or
+ *  arc-wise) initial state of the Vehicle, followed by the gravitational parameter of the Earth and its degree 2
+ *  cosine coefficients.
+ *  \param initialStateParameterSettings Settings for the (single- or arc-wise) initial state of the Vehicle.
+ *  \return Settings for the parameters to estimate.
+ */
+std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSettings > >
+getEarthOrbiterTestParameterSettings(
+        const std::shared_ptr< estimatable_parameters::EstimatableParameterSettings > initialStateParameterSettings );
+
+//! Function to simulate the observations for the analytical Earth orbiter estimation test setup.
+/*!
+ *  Function to simulate the observations for the analytical Earth orbiter estimation test setup, with the same
+ *  observation times (referenced to the receiver) for each set of link ends.
+ *  \param linkEndsPerObservable Link ends per observable type.
+ *  \param observationTimes Times at which observations are to be simulated.
+ *  \param observationSimulators Observation simulators, as retrieved from the orbit determination manager.
+ *  \return Simulated observations and associated times.
+ */
+simulation_setup::PodInput< double, double >::PodInputDataType simulateEarthOrbiterTestObservations(
+        const std::map< observation_models::ObservableType, std::vector< observation_models::LinkEnds > >&
+        linkEndsPerObservable,
+        const std::vector< double >& observationTimes,
+        const std::map< observation_models::ObservableType,
+        std::shared_ptr< observation_models::ObservationSimulatorBase< double, double > > >& observationSimulators );
+
+//! Function to retrieve the initial parameter perturbation for the analytical Earth orbiter estimation test setup.
+/*!
+ *  Function to retrieve the initial parameter perturbation for the analytical Earth orbiter estimation test setup
+ *  (parameter order as defined by getEarthOrbiterTestParameterSettings).
+ *  \param numberOfArcs Number of arcs for which an initial state of the Vehicle is estimated.
+ *  \return Initial parameter perturbation.
+ */
+Eigen::VectorXd getEarthOrbiterTestParameterPerturbation( const int numberOfArcs = 1 );
+
+//! Function to retrieve the weight per observable for the analytical Earth orbiter estimation test setup.
+/*!
+ *  Function to retrieve the weight per observable for the analytical Earth orbiter estimation test setup.
+ *  \return Weight per observable type.
+ */
+std::map< observation_models::ObservableType, double > getEarthOrbiterTestWeightPerObservable( );
+
+} // namespace unit_tests
+
+} // namespace tudat
+
+#endif // TUDAT_EARTHORBITERESTIMATIONTESTSETUP_H
@@ -1,3 +1,9 @@
+#include <set>
+
+#if USE_CSPICE
+#include "Tudat/External/SpiceInterface/spiceEphemeris.h"
+#include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
+#endif
 #include "Tudat/SimulationSetup/EstimationSetup/orbitDeterminationManager.h"
 
 namespace tudat
@@ -6,6 +12,77 @@ namespace tudat
 namespace simulation_setup
 {
 
+//! Function to retrieve the bodies involved in observation models for which an environment model calls Spice directly
+std::vector< std::string > getBodiesWithSpiceEnvironmentModelsInObservations(
+        const NamedBodyMap& bodyMap,
+        const observation_models::SortedObservationSettingsMap& observationSettingsMap )
+{
+    std::set< std::string > bodiesWithSpiceEnvironmentModels;
+
+#if USE_CSPICE
+    // Retrieve all bodies that are directly involved in the observation models.
+    std::set< std::string > bodiesToCheck;
+    for( observation_models::SortedObservationSettingsMap::const_iterator observablesIterator =
+         observationSettingsMap.begin( ); observablesIterator != observationSettingsMap.end( ); observablesIterator++ )
+    {
+        for( std::map< observation_models::LinkEnds, std::shared_ptr< observation_models::ObservationSettings > >::
+             const_iterator linkEndIterator = observablesIterator->second.begin( );
+             linkEndIterator != observablesIterator->second.end( ); linkEndIterator++ )
+        {
+            for( observation_models::LinkEnds::const_iterator linkEndBodyIterator = linkEndIterator->first.begin( );
+                 linkEndBodyIterator != linkEndIterator->first.end( ); linkEndBodyIterator++ )
+            {
+                bodiesToCheck.insert( linkEndBodyIterator->second.first );
+            }
+
+            std::vector< std::shared_ptr< observation_models::LightTimeCorrectionSettings > > lightTimeCorrections =
+                    linkEndIterator->second->lightTimeCorrectionsList_;
+            for( unsigned int i = 0; i < lightTimeCorrections.size( ); i++ )
+            {
+                std::shared_ptr< observation_models::FirstOrderRelativisticLightTimeCorrectionSettings >
+                        relativisticCorrectionSettings = std::dynamic_pointer_cast<
+                        observation_models::FirstOrderRelativisticLightTimeCorrectionSettings >(
+                            lightTimeCorrections.at( i ) );
+                if( relativisticCorrectionSettings != nullptr )
+                {
+                    std::vector< std::string > perturbingBodies = relativisticCorrectionSettings->getPerturbingBodies( );
+                    bodiesToCheck.insert( perturbingBodies.begin( ), perturbingBodies.end( ) );
+                }
+            }
+        }
+    }
+
+    // Check environment models of bodies, and add ephemeris origins to bodies that are to be checked.
+    std::set< std::string > checkedBodies;
+    while( bodiesToCheck.size( ) > 0 )
+    {
+        std::string currentBody = *bodiesToCheck.begin( );
+        bodiesToCheck.erase( bodiesToCheck.begin( ) );
+        checkedBodies.insert( currentBody );
+        if( bodyMap.count( currentBody ) == 0 )
+        {
+            continue;
+        }
+
+        std::shared_ptr< ephemerides::Ephemeris > currentEphemeris = bodyMap.at( currentBody )->getEphemeris( );
+        if( std::dynamic_pointer_cast< ephemerides::SpiceEphemeris >( currentEphemeris ) != nullptr ||
+                std::dynamic_pointer_cast< ephemerides::SpiceRotationalEphemeris >(
+                    bodyMap.at( currentBody )->getRotationalEphemeris( ) ) != nullptr )
+        {
+            bodiesWithSpiceEnvironmentModels.insert( currentBody );
+        }
+
+        if( currentEphemeris != nullptr &&
+                checkedBodies.count( currentEphemeris->getReferenceFrameOrigin( ) ) == 0 )
+        {
+            bodiesToCheck.insert( currentEphemeris->getReferenceFrameOrigin( ) );
+        }
+    }
+#endif
+
+    return std::vector< std::string >( bodiesWithSpiceEnvironmentModels.begin( ), bodiesWithSpiceEnvironmentModels.end( ) );
+}
+
 
 template class OrbitDeterminationManager< double, double >;
 
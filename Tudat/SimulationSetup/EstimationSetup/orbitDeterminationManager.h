@@ -15,7 +15,9 @@
 
 #include <boost/make_shared.hpp>
 
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/Mathematics/BasicMathematics/blockSparseNormalEquations.h"
 #include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationManager.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/podInputOutputTypes.h"
@@ -76,6 +78,20 @@ Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getConcatenatedWeights
     return concatenatedWeights;
 }
 
+//! Function to retrieve the bodies involved in observation models for which an environment model calls Spice directly
+/*!
+ *  Function to retrieve the bodies involved in observation models for which the ephemeris and/or rotation model calls
+ *  Spice directly (SpiceEphemeris, SpiceRotationalEphemeris). Such models cannot be evaluated concurrently, since Spice is
+ *  not re-entrant. The bodies that are checked are the link end bodies, the origins of their ephemerides (recursively),
+ *  and the perturbing bodies of first-order relativistic light-time corrections.
+ *  \param bodyMap Map of body objects with names of bodies, storing all environment models used in simulation.
+ *  \param observationSettingsMap Sets of observation model settings per link ends
+ *  \return Names of bodies with ephemeris and/or rotation model calling Spice directly (empty if Spice is not used).
+ */
+std::vector< std::string > getBodiesWithSpiceEnvironmentModelsInObservations(
+        const NamedBodyMap& bodyMap,
+        const observation_models::SortedObservationSettingsMap& observationSettingsMap );
+
 //! Top-level class for performing orbit determination.
 /*!
  *  Top-level class for performing orbit determination. All required propagation/estimation settings are provided to
@@ -120,6 +136,9 @@ public:
      *  \param propagatorSettings Settings for propagator.
      *  \param propagateOnCreation Boolean denoting whether initial propagatoon is to be performed upon object creation (default
      *  true)
+     *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no
+     *  analytical partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown
+     *  for such acceleration models.
      */
     OrbitDeterminationManager(
             const NamedBodyMap &bodyMap,
@@ -128,11 +147,12 @@ public:
             const observation_models::SortedObservationSettingsMap& observationSettingsMap,
             const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
-            const bool propagateOnCreation = true ):
-        parametersToEstimate_( parametersToEstimate )
+            const bool propagateOnCreation = true,
+            const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr ):
+        parametersToEstimate_( parametersToEstimate ), numberOfThreads_( 1 )
     {
         initializeOrbitDeterminationManager( bodyMap, observationSettingsMap, integratorSettings, propagatorSettings,
-                                             propagateOnCreation );
+                                             propagateOnCreation, numericalPartialSettings );
     }
 
     //! Constructor
@@ -147,6 +167,9 @@ public:
      *  \param propagatorSettings Settings for propagator.
      *  \param propagateOnCreation Boolean denoting whether initial propagatoon is to be performed upon object creation (default
      *  true)
+     *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no
+     *  analytical partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown
+     *  for such acceleration models.
      */
     OrbitDeterminationManager(
             const NamedBodyMap &bodyMap,
@@ -155,12 +178,13 @@ public:
             const observation_models::ObservationSettingsMap& observationSettingsMap,
             const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
-            const bool propagateOnCreation = true ):
-        parametersToEstimate_( parametersToEstimate )
+            const bool propagateOnCreation = true,
+            const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr ):
+        parametersToEstimate_( parametersToEstimate ), numberOfThreads_( 1 )
     {
         initializeOrbitDeterminationManager( bodyMap, observation_models::convertUnsortedToSortedObservationSettingsMap(
                                                  observationSettingsMap ), integratorSettings, propagatorSettings,
-                                             propagateOnCreation );
+                                             propagateOnCreation, numericalPartialSettings );
     }
 
     //! Function to retrieve map of all observation managers
@@ -266,7 +290,11 @@ public:
     /*!
      *  This function calculates the observation partials matrix and residuals, based on the state transition matrix,
      *  sensitivity matrix and body states resulting from the previous numerical integration iteration.
-     *  Partials and observations are calculated by the observationManagers_.
+     *  Partials and observations are calculated by the observationManagers_. The observations of different link ends
+     *  (and observable types) may be computed concurrently, using the number of threads set by setNumberOfThreads. The
+     *  observations of a single set of link ends are always computed sequentially, in order of the input times, and each
+     *  set of link ends writes only to its own (pre-determined) rows of the output. Consequently, the results are
+     *  identical for any number of threads.
      *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
      *  \param parameterVectorSize Length of the vector of estimated parameters
      *  \param totalObservationSize Total number of observations in observationsAndTimes map.
@@ -281,48 +309,189 @@ public:
         residualsAndPartials.second = Eigen::MatrixXd::Zero( totalObservationSize, parameterVectorSize );
         residualsAndPartials.first = Eigen::VectorXd::Zero( totalObservationSize );
 
-        // Declare variable denoting current index in vector of all observations.
-        int startIndex = 0;
-
-        // Iterate over all observable types in observationsAndTimes
-        std::vector< TimeType > simulationInputTime;
-        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
-             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        // Create list of tasks (one per observable type and set of link ends), with associated start index in vector of
+        // all observations.
+        std::vector< std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >
+                taskObservationManagers;
+        std::vector< observation_models::ObservableType > taskObservableTypes;
+        std::vector< typename SingleObservablePodInputType::const_iterator > taskDataIterators;
+        std::vector< int > taskStartIndices;
+        std::vector< std::pair< int, int > > observableStartIndicesAndSizes;
+        createObservationTasks( observationsAndTimes, taskObservationManagers, taskObservableTypes, taskDataIterators,
+                                taskStartIndices, observableStartIndicesAndSizes );
+
+        // Compute observations and partials for each set of link ends, writing results to associated rows.
+        utilities::executeParallelTasks(
+                    static_cast< int >( taskDataIterators.size( ) ),
+                    [ & ]( const int taskIndex )
         {
-            int observableStartIndex = startIndex;
+            typename SingleObservablePodInputType::const_iterator dataIterator = taskDataIterators.at( taskIndex );
+            const int currentStartIndex = taskStartIndices.at( taskIndex );
+
+            // Compute estimated ranges and range partials from current parameter estimate.
+            std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                    taskObservationManagers.at( taskIndex )->computeObservationsWithPartials(
+                        dataIterator->second.second.first, dataIterator->first, dataIterator->second.second.second );
+
+            // Compute residuals for current link ends and observabel type.
+            residualsAndPartials.first.segment( currentStartIndex, dataIterator->second.first.size( ) ) =
+                    ( dataIterator->second.first - observationsWithPartials.first ).template cast< double >( );
+
+            // Set current observation partials in matrix of all partials
+            residualsAndPartials.second.block(
+                        currentStartIndex, 0, dataIterator->second.first.size( ), parameterVectorSize ) =
+                    observationsWithPartials.second;
+        }, numberOfThreads_ );
+
+        // Check residuals of each observable type.
+        checkResidualDiscontinuities( observationsAndTimes, residualsAndPartials.first, observableStartIndicesAndSizes );
+    }
 
-            // Iterate over all link ends for current observable type in observationsAndTimes
-            for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
-                 dataIterator != observablesIterator->second.end( ); dataIterator++  )
+    //! Function to calculate the normal equations and residuals, without storing the full observation partials matrix
+    /*!
+     *  This function calculates the residuals and the normal equations (H^T*W*H and H^T*W*y), based on the state transition
+     *  matrix, sensitivity matrix and body states resulting from the previous numerical integration iteration. The
+     *  observations of each set of link ends are processed in blocks of (at most) maximumObservationBlockSize observation
+     *  times, in order of the input times, and the partials of each block are added to the normal equations and then
+     *  discarded. As in calculateObservationMatrixAndResiduals, different sets of link ends may be processed concurrently.
+     *  Each set of link ends accumulates its own normal equations, which are summed in a fixed order afterwards, so that
+     *  the results are identical for any number of threads. Since residuals are added to the normal equations per block,
+     *  discontinuities in the residuals are checked per set of link ends (rather than per observable type).
+     *  \tparam NormalEquationsType Type used to store the normal equations (linear_algebra::NormalEquationsAccumulator or
+     *  linear_algebra::BlockSparseNormalEquations)
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+     *  \param weightsVector Concatenated diagonal of observation weights matrix (same order as observationsAndTimes)
+     *  \param maximumObservationBlockSize Maximum number of observation times per block
+     *  \param residuals Residuals of computed w.r.t. input observable values (return by reference).
+     *  \param normalEquations Accumulated normal equations of all observations (return by reference). Must be created for
+     *  the correct number of parameters (and parameter structure) on input; any existing contents are reset.
+     */
+    template< typename NormalEquationsType >
+    void calculateNormalEquationsAndResiduals(
+            const PodInputType& observationsAndTimes, const int totalObservationSize,
+            const Eigen::VectorXd& weightsVector, const int maximumObservationBlockSize,
+            Eigen::VectorXd& residuals, NormalEquationsType& normalEquations )
+    {
+        // Initialize return data.
+        residuals = Eigen::VectorXd::Zero( totalObservationSize );
+        normalEquations.reset( );
+
+        // Create list of tasks (one per observable type and set of link ends), with associated start index in vector of
+        // all observations.
+        std::vector< std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >
+                taskObservationManagers;
+        std::vector< observation_models::ObservableType > taskObservableTypes;
+        std::vector< typename SingleObservablePodInputType::const_iterator > taskDataIterators;
+        std::vector< int > taskStartIndices;
+        std::vector< std::pair< int, int > > observableStartIndicesAndSizes;
+        createObservationTasks( observationsAndTimes, taskObservationManagers, taskObservableTypes, taskDataIterators,
+                                taskStartIndices, observableStartIndicesAndSizes );
+
+        // Compute normal equations for each set of link ends, processing observations in blocks.
+        std::vector< NormalEquationsType > taskNormalEquations( taskDataIterators.size( ), normalEquations );
+        utilities::executeParallelTasks(
+                    static_cast< int >( taskDataIterators.size( ) ),
+                    [ & ]( const int taskIndex )
+        {
+            typename SingleObservablePodInputType::const_iterator dataIterator = taskDataIterators.at( taskIndex );
+            const std::vector< TimeType >& observationTimes = dataIterator->second.second.first;
+            const int numberOfObservations = dataIterator->second.first.size( );
+
+            int currentObservationIndex = 0;
+            std::vector< TimeType > blockTimes;
+            for( unsigned int blockStartIndex = 0; blockStartIndex < observationTimes.size( );
+                 blockStartIndex += maximumObservationBlockSize )
             {
-                simulationInputTime.clear( );
-                simulationInputTime = dataIterator->second.second.first;
-
-                // Compute estimated ranges and range partials from current parameter estimate.
-                std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
-                observationsWithPartials = observationManagers_[ observablesIterator->first ]->
-                        computeObservationsWithPartials(
-                            simulationInputTime, dataIterator->first, dataIterator->second.second.second );
+                // Compute estimated observations and partials for current block of observation times.
+                blockTimes.assign( observationTimes.begin( ) + blockStartIndex,
+                                   observationTimes.begin( ) + std::min(
+                                       blockStartIndex + maximumObservationBlockSize,
+                                       static_cast< unsigned int >( observationTimes.size( ) ) ) );
+                std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                        taskObservationManagers.at( taskIndex )->computeObservationsWithPartials(
+                            blockTimes, dataIterator->first, dataIterator->second.second.second );
+
+                const int blockSize = observationsWithPartials.first.rows( );
+                if( currentObservationIndex + blockSize > numberOfObservations )
+                {
+                    throw std::runtime_error( "Error when computing normal equations, number of computed observations "
+                                              "is inconsistent with input" );
+                }
 
-                // Compute residuals for current link ends and observabel type.
-                residualsAndPartials.first.segment( startIndex, dataIterator->second.first.size( ) ) =
-                        ( dataIterator->second.first - observationsWithPartials.first ).template cast< double >( );
+                // Compute residuals for current block, and check for discontinuities (including last residual of previous
+                // block), before adding block to normal equations.
+                const int currentStartIndex = taskStartIndices.at( taskIndex ) + currentObservationIndex;
+                residuals.segment( currentStartIndex, blockSize ) =
+                        ( dataIterator->second.first.segment( currentObservationIndex, blockSize ) -
+                          observationsWithPartials.first ).template cast< double >( );
+                const int numberOfPreviousEntries = ( currentObservationIndex > 0 ) ? 1 : 0;
+                observation_models::checkObservationResidualDiscontinuities(
+                            residuals.block( currentStartIndex - numberOfPreviousEntries, 0,
+                                             blockSize + numberOfPreviousEntries, 1 ),
+                            taskObservableTypes.at( taskIndex ) );
+
+                taskNormalEquations.at( taskIndex ).addObservations(
+                            observationsWithPartials.second, residuals.segment( currentStartIndex, blockSize ),
+                            weightsVector.segment( currentStartIndex, blockSize ) );
+
+                currentObservationIndex += blockSize;
+            }
 
-                // Set current observation partials in matrix of all partials
-                residualsAndPartials.second.block( startIndex, 0, dataIterator->second.first.size( ), parameterVectorSize ) =
-                        observationsWithPartials.second;
+            if( currentObservationIndex != numberOfObservations )
+            {
+                throw std::runtime_error( "Error when computing normal equations, number of computed observations "
+                                          "is inconsistent with input" );
+            }
+        }, numberOfThreads_ );
 
-                // Increment current index of observation.
-                startIndex += dataIterator->second.first.size( );
+        // Sum normal equations of all sets of link ends (in fixed order).
+        for( unsigned int i = 0; i < taskNormalEquations.size( ); i++ )
+        {
+            normalEquations.addNormalEquations( taskNormalEquations.at( i ) );
+        }
+    }
 
+    //! Function to set the number of threads used to compute observations and partials.
+    /*!
+     *  Function to set the number of threads used to compute observations and partials (in
+     *  calculateObservationMatrixAndResiduals). By default, a single thread is used. Observations of different sets of
+     *  link ends are distributed over the threads, so no speed-up is obtained beyond the number of sets of link ends.
+     *  Note that the use of multiple threads requires that the environment models used in the observation models
+     *  (e.g. ephemerides, rotation models) can be evaluated concurrently. This is NOT the case for models that directly
+     *  call Spice, which is not re-entrant. These include the default rotation models of celestial bodies, and their
+     *  default ephemerides if no interpolation interval is provided. An exception is thrown if more than one thread is
+     *  requested while such a model is used by the observation models (see
+     *  getBodiesWithSpiceEnvironmentModelsInObservations). Tabulated, interpolated and Chebyshev models, and those
+     *  of numerically propagated bodies, are thread-safe.
+     *  \param numberOfThreads Number of threads used to compute observations and partials.
+     */
+    void setNumberOfThreads( const unsigned int numberOfThreads )
+    {
+        if( numberOfThreads > 1 && bodiesWithSpiceEnvironmentModels_.size( ) > 0 )
+        {
+            std::string bodyList;
+            for( unsigned int i = 0; i < bodiesWithSpiceEnvironmentModels_.size( ); i++ )
+            {
+                bodyList += " " + bodiesWithSpiceEnvironmentModels_.at( i );
             }
-
-            int currentObservableSize = startIndex - observableStartIndex;
-            observation_models::checkObservationResidualDiscontinuities(
-                        residualsAndPartials.first.block( observableStartIndex, 0, currentObservableSize, 1 ),
-                        observablesIterator->first );
+            throw std::runtime_error(
+                        "Error when setting number of threads in OrbitDeterminationManager, observation models use "
+                        "ephemeris and/or rotation models that call Spice directly, which cannot be evaluated concurrently, "
+                        "for bodies:" + bodyList );
         }
+        numberOfThreads_ = std::max( numberOfThreads, 1u );
+    }
 
+    //! Function to retrieve the number of threads used to compute observations and partials.
+    /*!
+     *  Function to retrieve the number of threads used to compute observations and partials.
+     *  \return Number of threads used to compute observations and partials.
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
     }
 
 
@@ -418,7 +587,9 @@ public:
         ParameterVectorType bestParameterEstimate = ParameterVectorType::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestResiduals = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
-        Eigen::MatrixXd bestInformationMatrix = Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
+        Eigen::MatrixXd bestInformationMatrix = podInput->getAccumulateNormalEquations( ) ?
+                    Eigen::MatrixXd::Zero( 0, parameterVectorSize ) :
+                    Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestWeightsMatrixDiagonal = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
         Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Constant( parameterVectorSize, parameterVectorSize, TUDAT_NAN );
 
@@ -440,6 +611,14 @@ public:
 
         int numberOfEstimatedParameters = parameterVectorSize;
 
+        // Retrieve indices of arc-wise initial states, to use block-sparse normal equations for multi-arc estimation.
+        std::vector< std::vector< int > > arcWiseParameterIndices;
+        if( podInput->getAccumulateNormalEquations( ) && podInput->getUseArcWiseBlockStructure( ) )
+        {
+            arcWiseParameterIndices = estimatable_parameters::getArcWiseInitialStateParameterIndices(
+                        parametersToEstimate_ );
+        }
+
         bool exceptionDuringPropagation = false, exceptionDuringInversion = false;
         // Iterate until convergence (at least once)
         int numberOfIterations = 0;
@@ -475,12 +654,40 @@ public:
             {
                 std::cout << "Calculating residuals and partials " << totalNumberOfObservations << std::endl;
             }
-            // Calculate residuals and observation matrix for current parameter estimate.
+            // Calculate residuals and observation matrix (or normal equations) for current parameter estimate.
+            Eigen::VectorXd weightsVector = getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) );
             std::pair< Eigen::VectorXd, Eigen::MatrixXd > residualsAndPartials;
-            calculateObservationMatrixAndResiduals(
-                        podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations, residualsAndPartials );
-
-            Eigen::VectorXd transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+            Eigen::VectorXd transformationData;
+            Eigen::MatrixXd normalizedNormalMatrix;
+            Eigen::VectorXd normalizedNormalEquationsRightHandSide;
+            std::shared_ptr< linear_algebra::BlockSparseNormalEquations > blockSparseNormalEquations;
+            if( podInput->getAccumulateNormalEquations( ) && arcWiseParameterIndices.size( ) > 1 )
+            {
+                blockSparseNormalEquations = std::make_shared< linear_algebra::BlockSparseNormalEquations >(
+                            parameterVectorSize, arcWiseParameterIndices );
+                calculateNormalEquationsAndResiduals(
+                            podInput->getObservationsAndTimes( ), totalNumberOfObservations,
+                            weightsVector, podInput->getMaximumObservationBlockSize( ), residualsAndPartials.first,
+                            *blockSparseNormalEquations );
+                transformationData = blockSparseNormalEquations->normalize( );
+            }
+            else if( podInput->getAccumulateNormalEquations( ) )
+            {
+                linear_algebra::NormalEquationsAccumulator normalEquations( parameterVectorSize );
+                calculateNormalEquationsAndResiduals(
+                            podInput->getObservationsAndTimes( ), totalNumberOfObservations,
+                            weightsVector, podInput->getMaximumObservationBlockSize( ), residualsAndPartials.first,
+                            normalEquations );
+                normalEquations.getNormalizedNormalEquations(
+                            normalizedNormalMatrix, normalizedNormalEquationsRightHandSide, transformationData );
+            }
+            else
+            {
+                calculateObservationMatrixAndResiduals(
+                            podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations,
+                            residualsAndPartials );
+                transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+            }
 
             Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = Eigen::MatrixXd::Zero(
                         numberOfEstimatedParameters, numberOfEstimatedParameters );
@@ -502,11 +709,29 @@ public:
                 Eigen::MatrixXd constraintStateMultiplier;
                 Eigen::VectorXd constraintRightHandSide;
                 parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
-                leastSquaresOutput =
-                        std::move( linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
-                                       residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
-                                       residualsAndPartials.first, getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ),
-                                       normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                if( blockSparseNormalEquations != nullptr )
+                {
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromBlockSparseNormalEquations(
+                                           *blockSparseNormalEquations, normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8,
+                                           constraintStateMultiplier, constraintRightHandSide ) );
+                }
+                else if( podInput->getAccumulateNormalEquations( ) )
+                {
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                                           normalizedNormalMatrix, normalizedNormalEquationsRightHandSide,
+                                           normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8,
+                                           constraintStateMultiplier, constraintRightHandSide ) );
+                }
+                else
+                {
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                                           residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
+                                           residualsAndPartials.first, weightsVector,
+                                           normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                }
 
                 if( constraintStateMultiplier.rows( ) > 0 )
                 {
@@ -567,11 +792,11 @@ public:
                 bestResidual = residualRms;
                 bestParameterEstimate = std::move( oldParameterEstimate );
                 bestResiduals = std::move( residualsAndPartials.first );
-                if( podInput->getSaveInformationMatrix( ) )
+                if( podInput->getSaveInformationMatrix( ) && !podInput->getAccumulateNormalEquations( ) )
                 {
                     bestInformationMatrix = std::move( residualsAndPartials.second );
                 }
-                bestWeightsMatrixDiagonal = std::move( getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ) );
+                bestWeightsMatrixDiagonal = std::move( weightsVector );
                 bestTransformationData = std::move( transformationData );
                 bestInverseNormalizedCovarianceMatrix = std::move( leastSquaresOutput.second );
             }
@@ -730,6 +955,76 @@ public:
 
 protected:
 
+    //! Function to create the list of tasks for computing observations and partials
+    /*!
+     *  Function to create the list of tasks for computing observations and partials (one per observable type and set of
+     *  link ends), with associated start index in the vector of all observations.
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param taskObservationManagers Observation manager for each task (returned by reference)
+     *  \param taskObservableTypes Observable type of each task (returned by reference)
+     *  \param taskDataIterators Iterator to input data of each task (returned by reference)
+     *  \param taskStartIndices Start index of each task in vector of all observations (returned by reference)
+     *  \param observableStartIndicesAndSizes Start index and number of observations of each observable type in vector of
+     *  all observations (returned by reference)
+     */
+    void createObservationTasks(
+            const PodInputType& observationsAndTimes,
+            std::vector< std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >&
+            taskObservationManagers,
+            std::vector< observation_models::ObservableType >& taskObservableTypes,
+            std::vector< typename SingleObservablePodInputType::const_iterator >& taskDataIterators,
+            std::vector< int >& taskStartIndices,
+            std::vector< std::pair< int, int > >& observableStartIndicesAndSizes )
+    {
+        int startIndex = 0;
+        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        {
+            int observableStartIndex = startIndex;
+
+            // Iterate over all link ends for current observable type in observationsAndTimes
+            for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
+                 dataIterator != observablesIterator->second.end( ); dataIterator++  )
+            {
+                taskObservationManagers.push_back( observationManagers_[ observablesIterator->first ] );
+                taskObservableTypes.push_back( observablesIterator->first );
+                taskDataIterators.push_back( dataIterator );
+                taskStartIndices.push_back( startIndex );
+
+                // Increment current index of observation.
+                startIndex += dataIterator->second.first.size( );
+            }
+
+            observableStartIndicesAndSizes.push_back( std::make_pair( observableStartIndex, startIndex - observableStartIndex ) );
+        }
+    }
+
+    //! Function to check the residuals of each observable type for discontinuities
+    /*!
+     *  Function to check the residuals of each observable type for discontinuities (correcting angular residuals for jumps
+     *  of 2 pi)
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param residuals Residuals of all observations (modified by this function, if discontinuities are corrected)
+     *  \param observableStartIndicesAndSizes Start index and number of observations of each observable type in vector of
+     *  all observations
+     */
+    void checkResidualDiscontinuities(
+            const PodInputType& observationsAndTimes,
+            Eigen::VectorXd& residuals,
+            const std::vector< std::pair< int, int > >& observableStartIndicesAndSizes )
+    {
+        int observableIndex = 0;
+        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        {
+            observation_models::checkObservationResidualDiscontinuities(
+                        residuals.block( observableStartIndicesAndSizes.at( observableIndex ).first, 0,
+                                         observableStartIndicesAndSizes.at( observableIndex ).second, 1 ),
+                        observablesIterator->first );
+            observableIndex++;
+        }
+    }
+
     //! Function called by either constructor to initialize the object.
     /*!
      *  Function called by either constructor to initialize the object.
@@ -741,13 +1036,17 @@ protected:
      *  \param propagatorSettings Settings for propagator.
      *  \param propagateOnCreation Boolean denoting whether initial propagatoon is to be performed upon object creation (default
      *  true)
+     *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no
+     *  analytical partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown
+     *  for such acceleration models.
      */
     void initializeOrbitDeterminationManager(
             const NamedBodyMap &bodyMap,
             const observation_models::SortedObservationSettingsMap& observationSettingsMap,
             const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
-            const bool propagateOnCreation = true )
+            const bool propagateOnCreation = true,
+            const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr )
     {
         using namespace numerical_integrators;
         using namespace orbit_determination;
@@ -772,7 +1071,8 @@ protected:
             variationalEquationsSolver_ =
                     simulation_setup::createVariationalEquationsSolver(
                         bodyMap, integratorSettings, propagatorSettings, parametersToEstimate_, 1,
-                        std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ), 0, propagateOnCreation );
+                        std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ), 0, propagateOnCreation,
+                        numericalPartialSettings );
         }
 
         if( integrateAndEstimateOrbit_ )
@@ -800,6 +1100,10 @@ protected:
                         stateTransitionAndSensitivityMatrixInterface_ );
         }
 
+        // Retrieve bodies for which observation models cannot be evaluated concurrently.
+        bodiesWithSpiceEnvironmentModels_ = getBodiesWithSpiceEnvironmentModelsInObservations(
+                    bodyMap, observationSettingsMap );
+
         // Set current parameter estimate from body initial states and parameter set.
         currentParameterEstimate_ = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
 
@@ -855,6 +1159,12 @@ protected:
     std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface >
     stateTransitionAndSensitivityMatrixInterface_;
 
+    //! Number of threads used to compute observations and partials.
+    unsigned int numberOfThreads_;
+
+    //! Names of bodies involved in observation models with ephemeris and/or rotation model calling Spice directly.
+    std::vector< std::string > bodiesWithSpiceEnvironmentModels_;
+
 };
 
 extern template class OrbitDeterminationManager< double, double >;
@@ -16,6 +16,7 @@
 #include <boost/tuple/tuple_comparison.hpp>
 #include <boost/tuple/tuple_io.hpp>
 
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Basics/utilities.h"
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
@@ -597,6 +598,9 @@ public:
      *  end of this contructor (default true).
      *  \param setIntegratedResult Boolean to determine whether to automatically use the integrated results to set
      *  ephemerides (default true).
+     *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no
+     *  analytical partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown
+     *  for such acceleration models.
      */
     SingleArcVariationalEquationsSolver(
             const simulation_setup::NamedBodyMap& bodyMap,
@@ -608,7 +612,8 @@ public:
             = std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
             const bool clearNumericalSolution = true,
             const bool integrateEquationsOnCreation = true,
-            const bool setIntegratedResult = true ):
+            const bool setIntegratedResult = true,
+            const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr ):
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodyMap, parametersToEstimate, clearNumericalSolution ),
         integratorSettings_( integratorSettings ),
@@ -638,7 +643,8 @@ public:
                     stateDerivativePartials =
                     simulation_setup::createStateDerivativePartials
                     < StateScalarType, TimeType >(
-                        getStateDerivativeModelMapFromVector( stateDerivativeModels ), bodyMap, parametersToEstimate );
+                        getStateDerivativeModelMapFromVector( stateDerivativeModels ), bodyMap, parametersToEstimate,
+                        numericalPartialSettings );
 
             // Create simulation object for dynamics only.
             if( propagatorSettings_->getDependentVariablesToSave( ) != nullptr )
@@ -730,6 +736,7 @@ public:
             // Integrate variational and state equations.
             dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 1 );
             dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
+            dynamicsSimulator_->getEnvironmentUpdater( )->resetCachedUpdateTimes( );
 
             std::map< TimeType, Eigen::VectorXd > dependentVariableHistory;
             std::map< TimeType, MatrixType > rawNumericalSolution;
@@ -771,6 +778,7 @@ public:
             // Integrate variational equations.
             dynamicsStateDerivative_->setPropagationSettings( { translational_state }, 0, 1 );
             dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
+            dynamicsSimulator_->getEnvironmentUpdater( )->resetCachedUpdateTimes( );
 
             Eigen::MatrixXd initialVariationalState = this->createInitialVariationalEquationsSolution( );
             std::map< double, Eigen::MatrixXd > rawNumericalSolution;
@@ -1034,6 +1042,9 @@ public:
      *  end of this contructor (default false).
      *  \param resetMultiArcDynamicsAfterPropagation Boolean denoting whether to reset the multi-arc dynamics after
      *  propagation (default true).
+     *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no
+     *  analytical partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown
+     *  for such acceleration models.
      */
     MultiArcVariationalEquationsSolver(
             const simulation_setup::NamedBodyMap& bodyMap,
@@ -1046,7 +1057,8 @@ public:
             std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
             const bool clearNumericalSolution = true,
             const bool integrateEquationsOnCreation = false,
-            const bool resetMultiArcDynamicsAfterPropagation = true ):
+            const bool resetMultiArcDynamicsAfterPropagation = true,
+            const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr ):
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodyMap, parametersToEstimate, clearNumericalSolution ),
         propagatorSettings_( std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings ) ),
@@ -1068,37 +1080,10 @@ public:
                     bodyMap, integratorSettings, propagatorSettings, arcStartTimes,
                     false, clearNumericalSolution, resetMultiArcDynamicsAfterPropagation_ );
 
-
-        std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators =
-                dynamicsSimulator_->getSingleArcDynamicsSimulators( );
-
-        if( arcStartTimes.size( ) != singleArcDynamicsSimulators.size( ) )
-        {
-            throw std::runtime_error( "Error when making multi-arc variational equartions solver, input is inconsistent" );
-        }
-
-        for( unsigned int i = 0; i < singleArcDynamicsSimulators.size( ); i++ )
-        {
-            dynamicsStateDerivatives_.push_back( singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ) );
-            // Create variational equations objects.
-            std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
-                    simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
-                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ), bodyMap, parametersToEstimate );
-            std::shared_ptr< VariationalEquations > variationalEquationsObject_ =
-                    std::make_shared< VariationalEquations >(
-                        stateDerivativePartials, parametersToEstimate_, dynamicsStateDerivatives_.at( i )->getStateTypeStartIndices( ) );
-
-            dynamicsStateDerivatives_.at( i )->addVariationalEquations( variationalEquationsObject_ );
-            arcStartTimes_.push_back( arcStartTimes.at( i ) );
-        }
-
-        numberOfArcs_ = dynamicsStateDerivatives_.size( );
-        // Resize solution of variational equations to 2 (state transition and sensitivity matrices)
-        variationalEquationsSolution_.resize( numberOfArcs_ );
-        for( int i = 0; i < numberOfArcs_; i++ )
-        {
-            variationalEquationsSolution_[ i ].resize( 2 );
-        }
+        initializeArcVariationalEquations(
+                    std::vector< simulation_setup::NamedBodyMap >( arcStartTimes.size( ), bodyMap ),
+                    std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > >(
+                        arcStartTimes.size( ), parametersToEstimate ), arcStartTimes, numericalPartialSettings );
 
         // Integrate variational equations from initial state estimate.
         if( integrateEquationsOnCreation )
@@ -1114,6 +1099,82 @@ public:
         }
     }
 
+    //! Constructor with separate environment per arc, allowing arcs to be propagated concurrently.
+    /*!
+     *  Constructor with separate environment per arc, sets up object for automatic evaluation and numerical integration of
+     *  variational equations and equations of motion, where the arcs may be propagated concurrently (see
+     *  MultiArcDynamicsSimulator). For this, each arc requires its own environment (arcBodyMaps), from which the
+     *  acceleration models in the settings of that arc are created, and its own set of estimated parameters
+     *  (arcParametersToEstimate), created from that environment with the same settings as parametersToEstimate. Before
+     *  each propagation, the current values of parametersToEstimate are copied to the parameter sets of all arcs, so that
+     *  the parameter estimate only needs to be reset in parametersToEstimate. The equations of motion and variational
+     *  equations are always propagated concurrently (i.e. in a single propagation per arc).
+     *  \param bodyMap Map of bodies (with names), in which the results of the propagation are set.
+     *  \param arcBodyMaps List of maps of bodies (with names), used as environment for the propagation of each arc.
+     *  \param integratorSettings List of integrator settings for numerical integrator, defined per arc.
+     *  \param propagatorSettings Settings for propagator.
+     *  \param parametersToEstimate Object containing all parameters that are to be estimated and their current settings
+     *  and values.
+     *  \param arcParametersToEstimate List of objects containing all parameters that are to be estimated, created from the
+     *  environment of each arc.
+     *  \param arcStartTimes Start times for separate arcs
+     *  \param numberOfThreads Maximum number of threads that are to be used to propagate the arcs (by default, number of
+     *  available threads).
+     *  \param clearNumericalSolution Boolean to determine whether to clear the raw numerical solution member variables
+     *  (default true) after propagation and resetting of state transition interface.
+     *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
+     *  end of this contructor (default false).
+     *  \param resetMultiArcDynamicsAfterPropagation Boolean denoting whether to reset the multi-arc dynamics after
+     *  propagation (default true).
+     *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no
+     *  analytical partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown
+     *  for such acceleration models.
+     */
+    MultiArcVariationalEquationsSolver(
+            const simulation_setup::NamedBodyMap& bodyMap,
+            const std::vector< simulation_setup::NamedBodyMap >& arcBodyMaps,
+            const std::vector< std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > > integratorSettings,
+            const std::shared_ptr< PropagatorSettings< StateScalarType > > propagatorSettings,
+            const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > parametersToEstimate,
+            const std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > >&
+            arcParametersToEstimate,
+            const std::vector< double > arcStartTimes,
+            const unsigned int numberOfThreads = utilities::getNumberOfAvailableThreads( ),
+            const bool clearNumericalSolution = true,
+            const bool integrateEquationsOnCreation = false,
+            const bool resetMultiArcDynamicsAfterPropagation = true,
+            const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr ):
+        VariationalEquationsSolver< StateScalarType, TimeType >(
+            bodyMap, parametersToEstimate, clearNumericalSolution ),
+        propagatorSettings_( std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings ) ),
+        resetMultiArcDynamicsAfterPropagation_( resetMultiArcDynamicsAfterPropagation )
+    {
+        if(  std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings ) == nullptr )
+        {
+            throw std::runtime_error( "Error when making multi-arc variational equartions solver, input is single-arc" );
+        }
+        checkMultiArcPropagatorSettingsAndParameterEstimationConsistency(
+                    propagatorSettings_, parametersToEstimate, arcStartTimes );
+
+        parameterVectorSize_ = estimatable_parameters::getSingleArcParameterSetSize( parametersToEstimate );
+
+        stateTransitionMatrixSize_ -= ( parametersToEstimate->getParameterSetSize( ) -
+                                        estimatable_parameters::getSingleArcParameterSetSize( parametersToEstimate ) );
+
+        dynamicsSimulator_ =  std::make_shared< MultiArcDynamicsSimulator< StateScalarType, TimeType > >(
+                    bodyMap, arcBodyMaps, integratorSettings, propagatorSettings, numberOfThreads,
+                    false, clearNumericalSolution, resetMultiArcDynamicsAfterPropagation_ );
+
+        initializeArcVariationalEquations(
+                    arcBodyMaps, arcParametersToEstimate, arcStartTimes, numericalPartialSettings );
+
+        // Integrate variational equations from initial state estimate.
+        if( integrateEquationsOnCreation )
+        {
+            integrateVariationalAndDynamicalEquations( propagatorSettings_->getInitialStateList( ) , 1 );
+        }
+    }
+
     //! Destructor
     /*!
      *  Destructor
@@ -1130,6 +1191,7 @@ public:
     void integrateDynamicalEquationsOfMotionOnly(
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& initialStateEstimate )
     {
+        updateArcParameterValues( );
         for( int i = 0; i < numberOfArcs_; i++ )
         {
             dynamicsStateDerivatives_.at( i )->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
@@ -1148,6 +1210,7 @@ public:
     void integrateDynamicalEquationsOfMotionOnly(
             const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& initialStateEstimate )
     {
+        updateArcParameterValues( );
         for( int i = 0; i < numberOfArcs_; i++ )
         {
             dynamicsStateDerivatives_.at( i )->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
@@ -1205,6 +1268,8 @@ public:
         bool updateInitialStates = false;
         std::vector< VectorType > arcInitialStates;
 
+        updateArcParameterValues( );
+
         // Retrieve single-arc dynamics simulator objects
         std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators =
                 dynamicsSimulator_->getSingleArcDynamicsSimulators( );
@@ -1220,8 +1285,6 @@ public:
         if( integrateEquationsConcurrently )
         {
             // Allocate maps that stored numerical solution for equations of motion
-            std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
-                    currentEquationsOfMotionNumericalSolutionsRaw;
             std::vector< std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
                     equationsOfMotionNumericalSolutions;
             std::vector< std::map< TimeType, Eigen::Matrix< double, Eigen::Dynamic, 1 > > >
@@ -1233,77 +1296,44 @@ public:
             dependentVariableHistorySolutions.resize( numberOfArcs_ );
             cumulativeComputationTimeHistorySolutions.resize( numberOfArcs_ );
 
-            // Integrate equations for all arcs.
-            for( int i = 0; i < numberOfArcs_; i++ )
+            if( ( dynamicsSimulator_->getNumberOfThreads( ) > 1 ) &&
+                    MultiArcDynamicsSimulator< StateScalarType, TimeType >::areArcInitialStatesIndependent(
+                        initialStateEstimate ) )
             {
-                // Retrieve integrator settings, and ensure correct initial time.
-                std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings =
-                        singleArcDynamicsSimulators.at( i )->getIntegratorSettings( );
-                integratorSettings->initialTime_ = arcStartTimes_.at( i );
-
-                // Set state derivative model to propagate both variational equations and equations of motion
-                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( )->setPropagationSettings(
-                            std::vector< IntegratedStateType >( ), 1, 1 );
-
-
-                // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from
-                // previous arc
-                VectorType currentArcInitialState;
-
-                if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStateEstimate.at( i ) ) ) )
+                // Integrate equations for all arcs concurrently (each arc using its own environment and result entries)
+                utilities::executeParallelTasks(
+                            numberOfArcs_, [ & ]( const int arcIndex )
                 {
-                    currentArcInitialState = initialStateEstimate.at( i );
-                }
-                else
+                    integrateSingleArcVariationalAndDynamicalEquations(
+                                arcIndex, initialStateEstimate.at( arcIndex ), equationsOfMotionNumericalSolutions,
+                                dependentVariableHistorySolutions, cumulativeComputationTimeHistorySolutions );
+                }, dynamicsSimulator_->getNumberOfThreads( ) );
+            }
+            else
+            {
+                // Integrate equations for all arcs.
+                for( int i = 0; i < numberOfArcs_; i++ )
                 {
-                    currentArcInitialState = getArcInitialStateFromPreviousArcResult(
-                                equationsOfMotionNumericalSolutions.at( i - 1 ), arcStartTimes_.at( i ) );
-                    updateInitialStates = true;
-                }
-                arcInitialStates.push_back( currentArcInitialState );
-
-                // Update state derivative model to (possible) update in state.
-                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( )->
-                        template updateStateDerivativeModelSettings( currentArcInitialState );
-
-                // Create initial state for combined variational/equations of motion.
-                MatrixType initialVariationalState = this->createInitialConditions(
-                            currentArcInitialState );
-
+                    // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken
+                    // from previous arc
+                    VectorType currentArcInitialState;
 
-                // Integrate variational and state equations.
-                dynamicsSimulator_->getDynamicsStateDerivative( ).at( i )->resetFunctionEvaluationCounter( );
-                std::map< TimeType, MatrixType > rawNumericalSolution;
-                EquationIntegrationInterface< MatrixType, TimeType >::integrateEquations(
-                            singleArcDynamicsSimulators.at( i )->getStateDerivativeFunction( ),
-                            rawNumericalSolution,
-                            initialVariationalState, integratorSettings,
-                            singleArcDynamicsSimulators.at( i )->getPropagationTerminationCondition( ),
-                            dependentVariableHistorySolutions.at( i ),
-                            cumulativeComputationTimeHistorySolutions.at( i ),
-                            singleArcDynamicsSimulators.at( i )->getDependentVariablesFunctions( ),
-                            std::bind(
-                                &DynamicsStateDerivativeModel< TimeType, StateScalarType >::postProcessStateAndVariationalEquations,
-                                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ), std::placeholders::_1 ) );
-
-                // Extract solution of equations of motion.
-                utilities::createVectorBlockMatrixHistory(
-                            rawNumericalSolution, currentEquationsOfMotionNumericalSolutionsRaw,
-                            std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
-
-
-                // Transform equations of motion solution to output formulation
-                convertNumericalStateSolutionsToOutputSolutions(
-                            equationsOfMotionNumericalSolutions[ i ], currentEquationsOfMotionNumericalSolutionsRaw,
-                            dynamicsStateDerivatives_.at( i ) );
-                arcStartTimes_[ i ] = equationsOfMotionNumericalSolutions[ i ].begin( )->first;
-
-                // Save state transition and sensitivity matrix solutions for current arc.
-                setVariationalEquationsSolution(
-                            rawNumericalSolution, variationalEquationsSolution_[ i ],
-                            std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
-                            stateTransitionMatrixSize_, parameterVectorSize_ );
+                    if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStateEstimate.at( i ) ) ) )
+                    {
+                        currentArcInitialState = initialStateEstimate.at( i );
+                    }
+                    else
+                    {
+                        currentArcInitialState = getArcInitialStateFromPreviousArcResult(
+                                    equationsOfMotionNumericalSolutions.at( i - 1 ), arcStartTimes_.at( i ) );
+                        updateInitialStates = true;
+                    }
+                    arcInitialStates.push_back( currentArcInitialState );
 
+                    integrateSingleArcVariationalAndDynamicalEquations(
+                                i, currentArcInitialState, equationsOfMotionNumericalSolutions,
+                                dependentVariableHistorySolutions, cumulativeComputationTimeHistorySolutions );
+                }
             }
 
             // Process numerical solution of equations of motion
@@ -1364,6 +1394,7 @@ public:
 
                 // Integrate variational equations for current arc
                 dynamicsSimulator_->getDynamicsStateDerivative( ).at( i )->resetFunctionEvaluationCounter( );
+                singleArcDynamicsSimulators.at( i )->getEnvironmentUpdater( )->resetCachedUpdateTimes( );
                 EquationIntegrationInterface< MatrixType, TimeType >::integrateEquations(
                             singleArcDynamicsSimulators.at( i )->getStateDerivativeFunction( ),
                             rawNumericalSolutions, initialVariationalState,
@@ -1474,6 +1505,158 @@ protected:
 
 private:
 
+    //! Function to create the variational equations for each arc, and initialize the associated member variables.
+    /*!
+     *  Function to create the variational equations for each arc (from the state derivative models of the single-arc
+     *  dynamics simulators), and initialize the associated member variables.
+     *  \param arcBodyMaps List of maps of bodies (with names), used as environment for the propagation of each arc.
+     *  \param arcParametersToEstimate List of objects containing all parameters that are to be estimated, used for the
+     *  variational equations of each arc.
+     *  \param arcStartTimes Start times for separate arcs
+     *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no
+     *  analytical partial is implemented (may be nullptr).
+     */
+    void initializeArcVariationalEquations(
+            const std::vector< simulation_setup::NamedBodyMap >& arcBodyMaps,
+            const std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > >&
+            arcParametersToEstimate,
+            const std::vector< double >& arcStartTimes,
+            const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings )
+    {
+        std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators =
+                dynamicsSimulator_->getSingleArcDynamicsSimulators( );
+
+        if( ( arcStartTimes.size( ) != singleArcDynamicsSimulators.size( ) ) ||
+                ( arcParametersToEstimate.size( ) != singleArcDynamicsSimulators.size( ) ) )
+        {
+            throw std::runtime_error( "Error when making multi-arc variational equartions solver, input is inconsistent" );
+        }
+
+        for( unsigned int i = 0; i < singleArcDynamicsSimulators.size( ); i++ )
+        {
+            if( arcParametersToEstimate.at( i )->getParameterSetSize( ) != parametersToEstimate_->getParameterSetSize( ) )
+            {
+                throw std::runtime_error( "Error when making multi-arc variational equartions solver, parameter set of arc " +
+                                          std::to_string( i ) + " is inconsistent" );
+            }
+
+            dynamicsStateDerivatives_.push_back( singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ) );
+            // Create variational equations objects.
+            std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
+                    simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
+                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ), arcBodyMaps.at( i ),
+                        arcParametersToEstimate.at( i ), numericalPartialSettings );
+            std::shared_ptr< VariationalEquations > variationalEquationsObject_ =
+                    std::make_shared< VariationalEquations >(
+                        stateDerivativePartials, arcParametersToEstimate.at( i ),
+                        dynamicsStateDerivatives_.at( i )->getStateTypeStartIndices( ) );
+
+            dynamicsStateDerivatives_.at( i )->addVariationalEquations( variationalEquationsObject_ );
+            arcStartTimes_.push_back( arcStartTimes.at( i ) );
+        }
+        arcParametersToEstimate_ = arcParametersToEstimate;
+
+        numberOfArcs_ = dynamicsStateDerivatives_.size( );
+        // Resize solution of variational equations to 2 (state transition and sensitivity matrices)
+        variationalEquationsSolution_.resize( numberOfArcs_ );
+        for( int i = 0; i < numberOfArcs_; i++ )
+        {
+            variationalEquationsSolution_[ i ].resize( 2 );
+        }
+    }
+
+    //! Function to copy the current parameter values to the parameter sets of all arcs (if these are separate objects)
+    void updateArcParameterValues( )
+    {
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentParameterValues;
+        for( unsigned int i = 0; i < arcParametersToEstimate_.size( ); i++ )
+        {
+            if( arcParametersToEstimate_.at( i ) != parametersToEstimate_ )
+            {
+                if( currentParameterValues.rows( ) == 0 )
+                {
+                    currentParameterValues = parametersToEstimate_->template getFullParameterValues< StateScalarType >( );
+                }
+                arcParametersToEstimate_.at( i )->template resetParameterValues< StateScalarType >( currentParameterValues );
+            }
+        }
+    }
+
+    //! Function to integrate variational equations and equations of motion for a single arc.
+    /*!
+     *  Function to integrate variational equations and equations of motion for a single arc, and store the results in the
+     *  entries of the solution lists for that arc. Since only the entries of the given arc are modified, this function may
+     *  be called concurrently for different arcs (provided that the arcs do not share environment or integrator settings
+     *  objects).
+     *  \param arcIndex Index of arc that is to be propagated.
+     *  \param arcInitialState Initial state of the equations of motion for the arc.
+     *  \param equationsOfMotionNumericalSolutions List of numerical solutions of equations of motion, per arc (modified
+     *  by this function).
+     *  \param dependentVariableHistorySolutions List of dependent variable histories, per arc (modified by this function).
+     *  \param cumulativeComputationTimeHistorySolutions List of cumulative computation time histories, per arc (modified
+     *  by this function).
+     */
+    void integrateSingleArcVariationalAndDynamicalEquations(
+            const int arcIndex, const VectorType& arcInitialState,
+            std::vector< std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >&
+            equationsOfMotionNumericalSolutions,
+            std::vector< std::map< TimeType, Eigen::Matrix< double, Eigen::Dynamic, 1 > > >& dependentVariableHistorySolutions,
+            std::vector< std::map< TimeType, double > >& cumulativeComputationTimeHistorySolutions )
+    {
+        std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > singleArcDynamicsSimulator =
+                dynamicsSimulator_->getSingleArcDynamicsSimulators( ).at( arcIndex );
+
+        // Retrieve integrator settings, and ensure correct initial time.
+        std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings =
+                singleArcDynamicsSimulator->getIntegratorSettings( );
+        integratorSettings->initialTime_ = arcStartTimes_.at( arcIndex );
+
+        // Set state derivative model to propagate both variational equations and equations of motion
+        singleArcDynamicsSimulator->getDynamicsStateDerivative( )->setPropagationSettings(
+                    std::vector< IntegratedStateType >( ), 1, 1 );
+
+        // Update state derivative model to (possible) update in state.
+        singleArcDynamicsSimulator->getDynamicsStateDerivative( )->
+                template updateStateDerivativeModelSettings( arcInitialState );
+
+        // Create initial state for combined variational/equations of motion.
+        MatrixType initialVariationalState = this->createInitialConditions( arcInitialState );
+
+        // Integrate variational and state equations.
+        dynamicsStateDerivatives_.at( arcIndex )->resetFunctionEvaluationCounter( );
+        singleArcDynamicsSimulator->getEnvironmentUpdater( )->resetCachedUpdateTimes( );
+        std::map< TimeType, MatrixType > rawNumericalSolution;
+        EquationIntegrationInterface< MatrixType, TimeType >::integrateEquations(
+                    singleArcDynamicsSimulator->getStateDerivativeFunction( ),
+                    rawNumericalSolution,
+                    initialVariationalState, integratorSettings,
+                    singleArcDynamicsSimulator->getPropagationTerminationCondition( ),
+                    dependentVariableHistorySolutions.at( arcIndex ),
+                    cumulativeComputationTimeHistorySolutions.at( arcIndex ),
+                    singleArcDynamicsSimulator->getDependentVariablesFunctions( ),
+                    std::bind(
+                        &DynamicsStateDerivativeModel< TimeType, StateScalarType >::postProcessStateAndVariationalEquations,
+                        singleArcDynamicsSimulator->getDynamicsStateDerivative( ), std::placeholders::_1 ) );
+
+        // Extract solution of equations of motion.
+        std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > currentEquationsOfMotionNumericalSolutionsRaw;
+        utilities::createVectorBlockMatrixHistory(
+                    rawNumericalSolution, currentEquationsOfMotionNumericalSolutionsRaw,
+                    std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
+
+        // Transform equations of motion solution to output formulation
+        convertNumericalStateSolutionsToOutputSolutions(
+                    equationsOfMotionNumericalSolutions[ arcIndex ], currentEquationsOfMotionNumericalSolutionsRaw,
+                    dynamicsStateDerivatives_.at( arcIndex ) );
+        arcStartTimes_[ arcIndex ] = equationsOfMotionNumericalSolutions[ arcIndex ].begin( )->first;
+
+        // Save state transition and sensitivity matrix solutions for current arc.
+        setVariationalEquationsSolution(
+                    rawNumericalSolution, variationalEquationsSolution_[ arcIndex ],
+                    std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
+                    stateTransitionMatrixSize_, parameterVectorSize_ );
+    }
+
     //! Reset solutions of variational equations.
     /*!
      *  Reset solutions of variational equations (stateTransitionMatrixInterpolator_ and sensitivityMatrixInterpolator_) for each
@@ -1545,6 +1728,10 @@ private:
     //! Number of arcs over which propagation is to be performed.
     int numberOfArcs_;
 
+    //! Objects containing the parameters that are to be estimated, used for the variational equations of each arc.
+    std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > >
+    arcParametersToEstimate_;
+
     //! Boolean denoting whether to reset the multi-arc dynamics after propagation.
     const bool resetMultiArcDynamicsAfterPropagation_;
 
@@ -1585,6 +1772,9 @@ public:
      *  (default true) after propagation and resetting of state transition interface.
      *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
      *  end of this contructor.
+     *  \param numericalPartialSettings Settings for numerical partials, used for acceleration models for which no
+     *  analytical partial is implemented (see createStateDerivativePartials). If nullptr (default), an exception is thrown
+     *  for such acceleration models.
      */
     HybridArcVariationalEquationsSolver(
             const simulation_setup::NamedBodyMap& bodyMap,
@@ -1594,7 +1784,8 @@ public:
             const std::vector< double > arcStartTimes,
             const bool integrateDynamicalAndVariationalEquationsConcurrently = true,
             const bool clearNumericalSolution = true,
-            const bool integrateEquationsOnCreation = false ):
+            const bool integrateEquationsOnCreation = false,
+            const std::shared_ptr< numerical_derivatives::NumericalJacobianSettings > numericalPartialSettings = nullptr ):
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodyMap, parametersToEstimate, clearNumericalSolution ),
         integratorSettings_( integratorSettings ),
@@ -1633,7 +1824,7 @@ public:
                     bodyMap, integratorSettings, originalPopagatorSettings_->getMultiArcPropagatorSettings( ),
                     originalMultiArcParametersToEstimate_, arcStartTimes, integrateDynamicalAndVariationalEquationsConcurrently,
                     std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
-                    false, false, false );
+                    false, false, false, numericalPartialSettings );
 
         // Create variational equations solvers for single- and multi-arc
         integratorSettings->initialTime_ = arcStartTimes.at( 0 );
@@ -1641,12 +1832,12 @@ public:
                     bodyMap, integratorSettings, propagatorSettings_->getSingleArcPropagatorSettings( ),
                     singleArcParametersToEstimate_, integrateDynamicalAndVariationalEquationsConcurrently,
                     std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
-                    false, false );
+                    false, false, true, numericalPartialSettings );
         multiArcSolver_ = std::make_shared< MultiArcVariationalEquationsSolver< StateScalarType, TimeType > >(
                     bodyMap, integratorSettings, extendedMultiArcSettings,
                     multiArcParametersToEstimate_, arcStartTimes, integrateDynamicalAndVariationalEquationsConcurrently,
                     std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
-                    false, false, false );
+                    false, false, false, numericalPartialSettings );
 
         // Create function to retrieve single-arc initial states for extended multi-arc
         std::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType > > singleArcPropagationSettings =
@@ -12,11 +12,13 @@
 #define TUDAT_DYNAMICSSIMULATOR_H
 
 #include <vector>
+#include <set>
 #include <string>
 #include <chrono>
 
 #include <boost/make_shared.hpp>
 
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Basics/tudatTypeTraits.h"
 #include "Tudat/Basics/utilities.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
@@ -503,18 +505,41 @@ public:
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& initialStates )
     {
 
-        // Empty solution maps
+        // Empty solution histories
         equationsOfMotionNumericalSolution_.clear( );
         equationsOfMotionNumericalSolutionRaw_.clear( );
+        clearNumericalSolutionMaps( );
 
         // Reset functions
         dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
         dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
         dynamicsStateDerivative_->resetCumulativeFunctionEvaluationCounter( );
+        environmentUpdater_->resetCachedUpdateTimes( );
 
         // Reset initial time to ensure consistency with multi-arc propagation.
         integratorSettings_->initialTime_ = this->initialPropagationTime_;
 
+        // Check whether history is available to set integrated result.
+        if( this->setIntegratedResult_ && !propagatorSettings_->getKeepHistoryInMemory( ) )
+        {
+            throw std::runtime_error( "Error when propagating dynamics, integrated result cannot be set if propagation "
+                                      "history is not kept in memory." );
+        }
+
+        // Create sink passing output (in conventional form) to sinks defined in propagator settings.
+        std::shared_ptr< PropagationOutputSink< StateScalarType, TimeType > > outputSink;
+        if( propagatorSettings_->getOutputSinks( ).size( ) > 0 )
+        {
+            std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative =
+                    dynamicsStateDerivative_;
+            outputSink = std::make_shared< StateConversionOutputSink< StateScalarType, TimeType > >(
+                        propagatorSettings_->getOutputSinks( ),
+                        [ = ]( const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& propagatedState, const TimeType& time )
+            {
+                return dynamicsStateDerivative->convertToOutputSolution( propagatedState, time );
+            } );
+        }
+
         // Integrate equations of motion numerically.
         resetPropagationTerminationConditions( );
         propagationTerminationReason_ =
@@ -528,7 +553,9 @@ public:
                     dependentVariablesFunctions_,
                     statePostProcessingFunction_,
                     propagatorSettings_->getPrintInterval( ),
-                    initialClockTime_ );
+                    initialClockTime_,
+                    outputSink,
+                    propagatorSettings_->getKeepHistoryInMemory( ) );
 
         // Convert numerical solution to conventional state
         dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
@@ -552,20 +579,55 @@ public:
 
     //! Function to return the map of state history of numerically integrated bodies.
     /*!
-     * Function to return the map of state history of numerically integrated bodies.
+     * Function to return the map of state history of numerically integrated bodies. The map is created from
+     * equationsOfMotionNumericalSolution_ on the first call after a propagation, and reused by subsequent calls.
      * \return Map of state history of numerically integrated bodies.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionNumericalSolution( )
+    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolution( )
+    {
+        if( equationsOfMotionNumericalSolutionMap_.empty( ) && !equationsOfMotionNumericalSolution_.empty( ) )
+        {
+            equationsOfMotionNumericalSolutionMap_ = equationsOfMotionNumericalSolution_.template getMap<
+                    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( );
+        }
+        return equationsOfMotionNumericalSolutionMap_;
+    }
+
+    //! Function to return the contiguous state history of numerically integrated bodies.
+    /*!
+     * Function to return the contiguous state history of numerically integrated bodies. Contrary to
+     * getEquationsOfMotionNumericalSolution, no map of the history is created.
+     * \return State history of numerically integrated bodies, in order of propagation.
+     */
+    const PropagationHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionHistory( )
     {
         return equationsOfMotionNumericalSolution_;
     }
 
     //! Function to return the map of state history of numerically integrated bodies, in propagation coordinates.
     /*!
-     * Function to return the map of state history of numerically integrated bodies, in propagation coordinates.
+     * Function to return the map of state history of numerically integrated bodies, in propagation coordinates. The map is
+     * created from equationsOfMotionNumericalSolutionRaw_ on the first call after a propagation, and reused by subsequent
+     * calls.
      * \return Map of state history of numerically integrated bodies, in propagation coordinates.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionNumericalSolutionRaw( )
+    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolutionRaw( )
+    {
+        if( equationsOfMotionNumericalSolutionRawMap_.empty( ) && !equationsOfMotionNumericalSolutionRaw_.empty( ) )
+        {
+            equationsOfMotionNumericalSolutionRawMap_ = equationsOfMotionNumericalSolutionRaw_.template getMap<
+                    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( );
+        }
+        return equationsOfMotionNumericalSolutionRawMap_;
+    }
+
+    //! Function to return the contiguous state history of numerically integrated bodies, in propagation coordinates.
+    /*!
+     * Function to return the contiguous state history of numerically integrated bodies, in propagation coordinates. Contrary
+     * to getEquationsOfMotionNumericalSolutionRaw, no copy of the history is made.
+     * \return State history of numerically integrated bodies, in propagation coordinates, in order of propagation.
+     */
+    const PropagationHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionRawHistory( )
     {
         return equationsOfMotionNumericalSolutionRaw_;
     }
@@ -576,6 +638,17 @@ public:
      * \return Map of dependent variable history that was saved during numerical propagation.
      */
     std::map< TimeType, Eigen::VectorXd > getDependentVariableHistory( )
+    {
+        return dependentVariableHistory_.template getMap< Eigen::VectorXd >( );
+    }
+
+    //! Function to return the contiguous dependent variable history that was saved during numerical propagation.
+    /*!
+     * Function to return the contiguous dependent variable history that was saved during numerical propagation. Contrary
+     * to getDependentVariableHistory, no copy of the history is made.
+     * \return Dependent variable history that was saved during numerical propagation, in order of propagation.
+     */
+    const PropagationHistory< TimeType, double >& getDependentVariablePropagationHistory( )
     {
         return dependentVariableHistory_;
     }
@@ -587,7 +660,35 @@ public:
      */
     std::map< TimeType, double > getCumulativeComputationTimeHistory( )
     {
-        return cumulativeComputationTimeHistory_;
+        return cumulativeComputationTimeHistory_.template getMap< double >( );
+    }
+
+    //! Function to move the numerical solution of the last propagation out of this object.
+    /*!
+     * Function to move the numerical solution of the last propagation out of this object, in the form of maps (as returned by
+     * getEquationsOfMotionNumericalSolution, getDependentVariableHistory and getCumulativeComputationTimeHistory). The
+     * (raw and conventional) state histories, dependent variable history, cumulative computation time history and the maps
+     * created from them by this object are released, so that no copy of the solution is retained by this object.
+     * \param equationsOfMotionNumericalSolution Map of state history of numerically integrated bodies (returned by
+     * reference).
+     * \param dependentVariableHistory Map of dependent variable history (returned by reference).
+     * \param cumulativeComputationTimeHistory Map of cumulative computation time history (returned by reference).
+     */
+    void releaseNumericalSolution(
+            std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+            std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+            std::map< TimeType, double >& cumulativeComputationTimeHistory )
+    {
+        getEquationsOfMotionNumericalSolution( );
+        equationsOfMotionNumericalSolution = std::move( equationsOfMotionNumericalSolutionMap_ );
+        dependentVariableHistory = getDependentVariableHistory( );
+        cumulativeComputationTimeHistory = getCumulativeComputationTimeHistory( );
+
+        equationsOfMotionNumericalSolution_ = PropagationHistory< TimeType, StateScalarType >( );
+        equationsOfMotionNumericalSolutionRaw_ = PropagationHistory< TimeType, StateScalarType >( );
+        dependentVariableHistory_ = PropagationHistory< TimeType, double >( );
+        cumulativeComputationTimeHistory_ = PropagationHistory< TimeType, double >( );
+        clearNumericalSolutionMaps( );
     }
 
     //! Function to return the map of number of cumulative function evaluations that was saved during numerical propagation.
@@ -646,13 +747,15 @@ public:
             const std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
             const bool processSolution = true )
     {
-        equationsOfMotionNumericalSolution_ = equationsOfMotionNumericalSolution;
+        equationsOfMotionNumericalSolution_ = PropagationHistory< TimeType, StateScalarType >(
+                    equationsOfMotionNumericalSolution );
+        clearNumericalSolutionMaps( );
         if( processSolution )
         {
             processNumericalEquationsOfMotionSolution( );
         }
 
-        dependentVariableHistory_ = dependentVariableHistory;
+        dependentVariableHistory_ = PropagationHistory< TimeType, double >( dependentVariableHistory );
     }
 
     //! Function to get the settings for the numerical integrator.
@@ -830,6 +933,7 @@ public:
         {
             equationsOfMotionNumericalSolution_.clear( );
             equationsOfMotionNumericalSolutionRaw_.clear( );
+            clearNumericalSolutionMaps( );
         }
 
         for( simulation_setup::NamedBodyMap::const_iterator
@@ -842,6 +946,13 @@ public:
 
 protected:
 
+    //! Function to clear the maps of the numerical solution, which are created when requested by the user.
+    void clearNumericalSolutionMaps( )
+    {
+        equationsOfMotionNumericalSolutionMap_.clear( );
+        equationsOfMotionNumericalSolutionRawMap_.clear( );
+    }
+
     //! List of object (per dynamics type) that process the integrated numerical solution by updating the environment
     std::map< IntegratedStateType, std::vector< std::shared_ptr<
     IntegratedStateProcessor< TimeType, StateScalarType > > > > integratedStateProcessors_;
@@ -896,29 +1007,36 @@ protected:
     //! Object for retrieving ephemerides for transformation of reference frame (origins)
     std::shared_ptr< ephemerides::ReferenceFrameManager > frameManager_;
 
-    //! Map of state history of numerically integrated bodies.
+    //! History of state of numerically integrated bodies.
     /*!
-     *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
-     *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution). Key of map denotes time,
-     *  values are concatenated vectors of integrated body states (order defined by propagatorSettings_).
-     *  NOTE: this map is empty if clearNumericalSolutions_ is set to true.
+     *  History of state of numerically integrated bodies, i.e. the result of the numerical integration, transformed
+     *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution), stored contiguously in order
+     *  of propagation. Entries are concatenated vectors of integrated body states (order defined by propagatorSettings_).
+     *  NOTE: this history is empty if clearNumericalSolutions_ is set to true.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolution_;
+    PropagationHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolution_;
 
-    //! Map of state history of numerically integrated bodies.
+    //! Map of equationsOfMotionNumericalSolution_, created when first requested (see getEquationsOfMotionNumericalSolution).
+    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionMap_;
+
+    //! History of state of numerically integrated bodies.
     /*!
-    *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, in the
-    *  original propagation coordinates. Key of map denotes time, values are concatenated vectors of integrated body
-    * states (order defined by propagatorSettings_).
-    *  NOTE: this map is empty if clearNumericalSolutions_ is set to true.
+    *  History of state of numerically integrated bodies, i.e. the result of the numerical integration, in the
+    *  original propagation coordinates, stored contiguously in order of propagation. Entries are concatenated vectors
+    *  of integrated body states (order defined by propagatorSettings_).
+    *  NOTE: this history is empty if clearNumericalSolutions_ is set to true.
     */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRaw_;
+    PropagationHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRaw_;
+
+    //! Map of equationsOfMotionNumericalSolutionRaw_, created when first requested (see
+    //! getEquationsOfMotionNumericalSolutionRaw).
+    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRawMap_;
 
-    //! Map of dependent variable history that was saved during numerical propagation.
-    std::map< TimeType, Eigen::VectorXd > dependentVariableHistory_;
+    //! History of dependent variables that was saved during numerical propagation (in order of propagation).
+    PropagationHistory< TimeType, double > dependentVariableHistory_;
 
-    //! Map of cumulative computation time history that was saved during numerical propagation.
-    std::map< TimeType, double > cumulativeComputationTimeHistory_;
+    //! History of cumulative computation time that was saved during numerical propagation (in order of propagation).
+    PropagationHistory< TimeType, double > cumulativeComputationTimeHistory_;
 
     //! Map of cumulative number of function evaluations that was saved during numerical propagation.
     std::map< TimeType, unsigned int > cumulativeNumberOfFunctionEvaluations_;
@@ -1054,7 +1172,7 @@ public:
             const bool clearNumericalSolutions = true,
             const bool setIntegratedResult = true ):
         DynamicsSimulator< StateScalarType, TimeType >(
-            bodyMap, clearNumericalSolutions, setIntegratedResult )
+            bodyMap, clearNumericalSolutions, setIntegratedResult ), numberOfThreads_( 1 )
     {
         multiArcPropagatorSettings_ =
                 std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings );
@@ -1083,6 +1201,7 @@ public:
                                 bodyMap, integratorSettings, singleArcSettings.at( i ), false, false, true ) );
                 singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
             }
+            initializeIntegratedStateProcessors( singleArcSettings );
 
             equationsOfMotionNumericalSolution_.resize( arcStartTimes.size( ) );
             dependentVariableHistory_.resize( arcStartTimes.size( ) );
@@ -1117,8 +1236,49 @@ public:
             const bool areEquationsOfMotionToBeIntegrated = true,
             const bool clearNumericalSolutions = true,
             const bool setIntegratedResult = true ):
+        MultiArcDynamicsSimulator(
+            bodyMap, std::vector< simulation_setup::NamedBodyMap >( integratorSettings.size( ), bodyMap ),
+            integratorSettings, propagatorSettings, 1,
+            areEquationsOfMotionToBeIntegrated, clearNumericalSolutions, setIntegratedResult ){ }
+
+    //! Constructor of multi-arc simulator with separate environment per arc, allowing arcs to be propagated concurrently.
+    /*!
+     *  Constructor of multi-arc simulator with separate environment and integration settings per arc, allowing arcs to be
+     *  propagated concurrently. The environment models (bodies) contain mutable state that is updated during the
+     *  propagation, so that arcs can only be propagated concurrently if each arc uses its own environment: the
+     *  acceleration models (and other models) in the settings of each arc must be created from the corresponding entry of
+     *  arcBodyMaps. The results of all arcs are combined (into a multi-arc ephemeris, if setIntegratedResult is true) in
+     *  the bodyMap environment, after all arcs have been propagated.
+     *
+     *  Arcs are only propagated concurrently if none of the initial states is to be taken from the previous arc (denoted
+     *  by NaN entries in initial state); otherwise, the arcs are propagated sequentially. If more than one thread is used,
+     *  this constructor checks that no body, integrator settings, propagator settings or acceleration model objects are
+     *  shared between arcs (see checkArcIndependence). Whether the models in the settings of each arc were created from
+     *  its own entry of arcBodyMaps is not checked.
+     *  \param bodyMap Map of bodies (with names), in which the results of the propagation are set.
+     *  \param arcBodyMaps List of maps of bodies (with names), used as environment for the propagation of each arc.
+     *  \param integratorSettings List of integrator settings for numerical integrator, defined per arc.
+     *  \param propagatorSettings Propagator settings for dynamics (must be of multi arc type)
+     *  \param numberOfThreads Maximum number of threads that are to be used to propagate the arcs (by default, number of
+     *  available threads).
+     *  \param areEquationsOfMotionToBeIntegrated Boolean to denote whether equations of motion should be integrated at
+     *  the end of the contructor or not.
+     *  \param clearNumericalSolutions Boolean to determine whether to clear the raw numerical solution member variables
+     *  after propagation and resetting ephemerides (default true).
+     *  \param setIntegratedResult Boolean to determine whether to automatically use the integrated results to set
+     *  ephemerides (default true).
+     */
+    MultiArcDynamicsSimulator(
+            const simulation_setup::NamedBodyMap& bodyMap,
+            const std::vector< simulation_setup::NamedBodyMap >& arcBodyMaps,
+            const std::vector< std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > > integratorSettings,
+            const std::shared_ptr< PropagatorSettings< StateScalarType > > propagatorSettings,
+            const unsigned int numberOfThreads = utilities::getNumberOfAvailableThreads( ),
+            const bool areEquationsOfMotionToBeIntegrated = true,
+            const bool clearNumericalSolutions = true,
+            const bool setIntegratedResult = true ):
         DynamicsSimulator< StateScalarType, TimeType >(
-            bodyMap, clearNumericalSolutions, setIntegratedResult )
+            bodyMap, clearNumericalSolutions, setIntegratedResult ), numberOfThreads_( std::max( numberOfThreads, 1u ) )
     {
         multiArcPropagatorSettings_ =
                 std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings );
@@ -1131,11 +1291,17 @@ public:
             std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > > singleArcSettings =
                     multiArcPropagatorSettings_->getSingleArcSettings( );
 
-            if( singleArcSettings.size( ) != integratorSettings.size( ) )
+            if( ( singleArcSettings.size( ) != integratorSettings.size( ) ) ||
+                    ( singleArcSettings.size( ) != arcBodyMaps.size( ) ) )
             {
                 throw std::runtime_error( "Error when creating multi-arc dynamics simulator, input sizes are inconsistent" );
             }
 
+            if( numberOfThreads_ > 1 )
+            {
+                checkArcIndependence( arcBodyMaps, integratorSettings, singleArcSettings );
+            }
+
             arcStartTimes_.resize( singleArcSettings.size( ) );
 
             // Create dynamics simulators
@@ -1143,9 +1309,11 @@ public:
             {
                 singleArcDynamicsSimulators_.push_back(
                             std::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
-                                bodyMap, integratorSettings.at( i ), singleArcSettings.at( i ), false, false, true ) );
+                                arcBodyMaps.at( i ), integratorSettings.at( i ), singleArcSettings.at( i ),
+                                false, false, true ) );
                 singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
             }
+            initializeIntegratedStateProcessors( singleArcSettings );
 
             equationsOfMotionNumericalSolution_.resize( singleArcSettings.size( ) );
             dependentVariableHistory_.resize( singleArcSettings.size( ) );
@@ -1226,36 +1394,41 @@ public:
         std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > arcInitialStateList;
         bool updateInitialStates = false;
 
-        // Propagate dynamics for each arc
-        for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+        if( ( numberOfThreads_ > 1 ) && areArcInitialStatesIndependent( initialStatesList ) )
         {
-            // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from previous
-            // arc
-            if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStatesList.at( i ) ) ) )
+            // Propagate dynamics for all arcs concurrently (each arc using its own environment and result entries)
+            utilities::executeParallelTasks(
+                        static_cast< int >( singleArcDynamicsSimulators_.size( ) ),
+                        [ & ]( const int arcIndex )
             {
-                currentArcInitialState = initialStatesList.at( i );
-            }
-            else
+                integrateSingleArcEquationsOfMotion( arcIndex, initialStatesList.at( arcIndex ) );
+            }, numberOfThreads_ );
+        }
+        else
+        {
+            // Propagate dynamics for each arc
+            for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
             {
-                currentArcInitialState = getArcInitialStateFromPreviousArcResult(
-                            equationsOfMotionNumericalSolution_.at( i - 1 ),
-                            singleArcDynamicsSimulators_.at( i )->getInitialPropagationTime( ) );
+                // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from
+                // previous arc
+                if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStatesList.at( i ) ) ) )
+                {
+                    currentArcInitialState = initialStatesList.at( i );
+                }
+                else
+                {
+                    currentArcInitialState = getArcInitialStateFromPreviousArcResult(
+                                equationsOfMotionNumericalSolution_.at( i - 1 ),
+                                singleArcDynamicsSimulators_.at( i )->getInitialPropagationTime( ) );
 
-                // If arc initial state is taken from previous arc, this indicates that the initial states in propagator settings
-                // need to be updated.
-                updateInitialStates = true;
+                    // If arc initial state is taken from previous arc, this indicates that the initial states in propagator
+                    // settings need to be updated.
+                    updateInitialStates = true;
+                }
+                arcInitialStateList.push_back( currentArcInitialState );
+
+                integrateSingleArcEquationsOfMotion( i, currentArcInitialState );
             }
-            arcInitialStateList.push_back( currentArcInitialState );
-
-            singleArcDynamicsSimulators_.at( i )->integrateEquationsOfMotion( currentArcInitialState );
-            equationsOfMotionNumericalSolution_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getEquationsOfMotionNumericalSolution( ) );
-            dependentVariableHistory_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getDependentVariableHistory( ) );
-            cumulativeComputationTimeHistory_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getCumulativeComputationTimeHistory( ) );
-            propagationTerminationReasons_[ i ] = singleArcDynamicsSimulators_.at( i )->getPropagationTerminationReason( );
-            arcStartTimes_[ i ] = equationsOfMotionNumericalSolution_[ i ].begin( )->first;
         }
 
         if( updateInitialStates )
@@ -1403,6 +1576,37 @@ public:
         return arcStartTimes_;
     }
 
+    //! Function to retrieve the maximum number of threads that is used to propagate the arcs concurrently.
+    /*!
+     * Function to retrieve the maximum number of threads that is used to propagate the arcs concurrently.
+     * \return Maximum number of threads that is used to propagate the arcs concurrently (1 if arcs are propagated
+     * sequentially).
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+    //! Function to check whether none of the arc initial states is to be taken from the previous arc.
+    /*!
+     * Function to check whether none of the arc initial states is to be taken from the previous arc (which is denoted by
+     * NaN entries in the initial state of an arc), so that the arcs can be propagated independently.
+     * \param initialStatesList Initial states of all arcs.
+     * \return True if none of the initial states (other than that of the first arc) contains NaN entries.
+     */
+    static bool areArcInitialStatesIndependent(
+            const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& initialStatesList )
+    {
+        for( unsigned int i = 1; i < initialStatesList.size( ); i++ )
+        {
+            if( linear_algebra::doesMatrixHaveNanEntries( initialStatesList.at( i ) ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     //! Get whether the integration was completed successfully.
     /*!
      * @copybrief integrationCompletedSuccessfully
@@ -1430,8 +1634,7 @@ public:
     void processNumericalEquationsOfMotionSolution( )
     {
         resetIntegratedMultiArcStatesWithEqualArcDynamics(
-                    equationsOfMotionNumericalSolution_,
-                    singleArcDynamicsSimulators_.at( 0 )->getIntegratedStateProcessors( ), arcStartTimes_ );
+                    equationsOfMotionNumericalSolution_, integratedStateProcessors_, arcStartTimes_ );
 
         if( clearNumericalSolutions_ )
         {
@@ -1445,6 +1648,150 @@ public:
 
 protected:
 
+    //! Function to create the objects used to process the numerically integrated results of all arcs.
+    /*!
+     *  Function to create the objects used to process the numerically integrated results of all arcs, which set the
+     *  results in bodyMap_. The single-arc dynamics simulators may use a separate environment per arc, so their state
+     *  processors cannot be used for this. The dynamics of all arcs are required to be equal, so the processors are
+     *  created from the settings of the first arc.
+     *  \param singleArcSettings Propagator settings for each arc.
+     */
+    void initializeIntegratedStateProcessors(
+            const std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > >& singleArcSettings )
+    {
+        if( singleArcSettings.size( ) > 0 )
+        {
+            integratedStateProcessors_ = createIntegratedStateProcessors< TimeType, StateScalarType >(
+                        singleArcSettings.at( 0 ), bodyMap_, createFrameManager( bodyMap_ ) );
+        }
+    }
+
+    //! Function to propagate the dynamics of a single arc, and store the results for that arc.
+    /*!
+     *  Function to propagate the dynamics of a single arc, and store the results in the entries of the member variables
+     *  for that arc. Since only the entries of the given arc are modified, this function may be called concurrently for
+     *  different arcs (provided that the arcs do not share environment or integrator settings objects).
+     *  \param arcIndex Index of arc that is to be propagated.
+     *  \param arcInitialState Initial state of the arc.
+     */
+    void integrateSingleArcEquationsOfMotion(
+            const unsigned int arcIndex, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& arcInitialState )
+    {
+        singleArcDynamicsSimulators_.at( arcIndex )->integrateEquationsOfMotion( arcInitialState );
+        singleArcDynamicsSimulators_.at( arcIndex )->releaseNumericalSolution(
+                    equationsOfMotionNumericalSolution_[ arcIndex ], dependentVariableHistory_[ arcIndex ],
+                    cumulativeComputationTimeHistory_[ arcIndex ] );
+        propagationTerminationReasons_[ arcIndex ] =
+                singleArcDynamicsSimulators_.at( arcIndex )->getPropagationTerminationReason( );
+        arcStartTimes_[ arcIndex ] = equationsOfMotionNumericalSolution_[ arcIndex ].begin( )->first;
+    }
+
+    //! Function to retrieve the acceleration models of (translational) single-arc propagator settings
+    /*!
+     *  Function to retrieve the acceleration models of single-arc propagator settings, including those in translational
+     *  settings of multi-type propagator settings.
+     *  \param singleArcSettings Single-arc propagator settings from which the acceleration models are to be retrieved.
+     *  \param accelerationModels List of acceleration models, to which the models are added (returned by reference).
+     */
+    void getArcAccelerationModels(
+            const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > singleArcSettings,
+            std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > >& accelerationModels )
+    {
+        if( std::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType > >( singleArcSettings ) != nullptr )
+        {
+            basic_astrodynamics::AccelerationMap accelerationMap =
+                    std::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType > >(
+                        singleArcSettings )->getAccelerationsMap( );
+            for( auto bodyUndergoingIterator : accelerationMap )
+            {
+                for( auto bodyExertingIterator : bodyUndergoingIterator.second )
+                {
+                    accelerationModels.insert( accelerationModels.end( ), bodyExertingIterator.second.begin( ),
+                                               bodyExertingIterator.second.end( ) );
+                }
+            }
+        }
+        else if( std::dynamic_pointer_cast< MultiTypePropagatorSettings< StateScalarType > >( singleArcSettings ) != nullptr )
+        {
+            for( auto typeIterator : std::dynamic_pointer_cast< MultiTypePropagatorSettings< StateScalarType > >(
+                     singleArcSettings )->propagatorSettingsMap_ )
+            {
+                for( unsigned int i = 0; i < typeIterator.second.size( ); i++ )
+                {
+                    getArcAccelerationModels( typeIterator.second.at( i ), accelerationModels );
+                }
+            }
+        }
+    }
+
+    //! Function to check that no body, integrator settings, propagator settings or acceleration objects are shared between
+    //! arcs.
+    /*!
+     *  Function to check that no body, integrator settings, propagator settings or acceleration model objects are shared
+     *  between arcs, which is required for the arcs to be propagated concurrently. An exception is thrown if this
+     *  condition is not met. Note that only the identity of these objects is checked: it is NOT checked that the
+     *  acceleration models of each arc were created from the body map of that arc (and not from bodies of another arc, or
+     *  of a common body map), which is the responsibility of the user.
+     *  \param arcBodyMaps List of maps of bodies (with names), used as environment for the propagation of each arc.
+     *  \param integratorSettings List of integrator settings for numerical integrator, defined per arc.
+     *  \param singleArcSettings List of propagator settings, defined per arc.
+     */
+    void checkArcIndependence(
+            const std::vector< simulation_setup::NamedBodyMap >& arcBodyMaps,
+            const std::vector< std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > >& integratorSettings,
+            const std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > >& singleArcSettings )
+    {
+        std::set< std::shared_ptr< simulation_setup::Body > > arcBodies;
+        for( unsigned int i = 0; i < arcBodyMaps.size( ); i++ )
+        {
+            for( auto bodyIterator : arcBodyMaps.at( i ) )
+            {
+                if( !arcBodies.insert( bodyIterator.second ).second )
+                {
+                    throw std::runtime_error(
+                                "Error when creating multi-arc dynamics simulator for concurrent propagation, body " +
+                                bodyIterator.first + " is shared between arcs." );
+                }
+            }
+        }
+
+        std::set< std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > > arcIntegratorSettings(
+                    integratorSettings.begin( ), integratorSettings.end( ) );
+        if( arcIntegratorSettings.size( ) != integratorSettings.size( ) )
+        {
+            throw std::runtime_error(
+                        "Error when creating multi-arc dynamics simulator for concurrent propagation, integrator settings "
+                        "are shared between arcs." );
+        }
+
+        std::set< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > > arcPropagatorSettings(
+                    singleArcSettings.begin( ), singleArcSettings.end( ) );
+        if( arcPropagatorSettings.size( ) != singleArcSettings.size( ) )
+        {
+            throw std::runtime_error(
+                        "Error when creating multi-arc dynamics simulator for concurrent propagation, propagator settings "
+                        "are shared between arcs." );
+        }
+
+        std::set< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > > previousArcsAccelerationModels;
+        for( unsigned int i = 0; i < singleArcSettings.size( ); i++ )
+        {
+            std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > > currentArcAccelerationModels;
+            getArcAccelerationModels( singleArcSettings.at( i ), currentArcAccelerationModels );
+            for( unsigned int j = 0; j < currentArcAccelerationModels.size( ); j++ )
+            {
+                if( previousArcsAccelerationModels.count( currentArcAccelerationModels.at( j ) ) > 0 )
+                {
+                    throw std::runtime_error(
+                                "Error when creating multi-arc dynamics simulator for concurrent propagation, acceleration "
+                                "models are shared between arcs." );
+                }
+            }
+            previousArcsAccelerationModels.insert(
+                        currentArcAccelerationModels.begin( ), currentArcAccelerationModels.end( ) );
+        }
+    }
+
     //! List of maps of state history of numerically integrated states.
     /*!
      *  List of maps of state history of numerically integrated states. Each entry in the list contains data on a single arc.
@@ -1460,6 +1807,10 @@ protected:
     //! Objects used to compute the dynamics of the sepatrate arcs
     std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators_;
 
+    //! Objects used to process the numerically integrated results of all arcs, setting them in bodyMap_.
+    std::map< IntegratedStateType, std::vector< std::shared_ptr<
+    IntegratedStateProcessor< TimeType, StateScalarType > > > > integratedStateProcessors_;
+
     //! List of start times of each arc. NOTE: This list is updated after every propagation.
     std::vector< double > arcStartTimes_;
 
@@ -1468,6 +1819,9 @@ protected:
 
     //! Propagator settings used by this objec
     std::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > multiArcPropagatorSettings_;
+
+    //! Maximum number of threads that is used to propagate the arcs concurrently (1 if arcs are propagated sequentially).
+    unsigned int numberOfThreads_;
 };
 
 //! Class for performing full numerical integration of a dynamical system, with a compbination of single and multi-arc propagations
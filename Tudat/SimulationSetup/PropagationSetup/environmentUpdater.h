@@ -11,6 +11,7 @@
 #ifndef TUDAT_ENVIRONMENTUPDATER_H
 #define TUDAT_ENVIRONMENTUPDATER_H
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <map>
@@ -65,7 +66,8 @@ public:
             std::vector< std::pair< std::string, std::string > > >& integratedStates =
             ( std::map< IntegratedStateType,
               std::vector< std::pair< std::string, std::string > > >( ) ) ):
-        bodyList_( bodyList ), integratedStates_( integratedStates )
+        bodyList_( bodyList ), integratedStates_( integratedStates ), skipRedundantUpdates_( true ),
+        numberOfEvaluatedUpdates_( 0 ), numberOfSkippedUpdates_( 0 )
     {
         // Set update function to be evaluated as dependent variables of state and time during each
         // integration time step.
@@ -86,6 +88,12 @@ public:
      * convertCurrentStateToGlobalRepresentationPerType function of the DynamicsStateDerivativeModel.
      * \param setIntegratedStatesFromEnvironment Integrated state types which are not to be used for
      * updating the environment, but which are to be set from existing environment models instead.
+     *
+     * Update functions of environment models that depend only on time (see setUpdateFunctionOrder) are evaluated at
+     * most once per distinct time: if such a model was already updated to currentTime by a previous call to this
+     * function, its update (and associated reset) is skipped. This prevents, for instance, recomputation of rotation
+     * models and ephemerides at the intermediate steps of a Runge-Kutta integrator that share the same time.
+     * The cached times are cleared by resetCachedUpdateTimes, which is called automatically before any propagation.
      */
     void updateEnvironment(
             const TimeType currentTime,
@@ -103,9 +111,19 @@ public:
                                       std::to_string( integratedStates_.size( ) ) );
         }
 
+        // Determine which updates can be skipped, since the model has already been updated to the current time.
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            skipCurrentUpdate_[ i ] = skipRedundantUpdates_ && isUpdateFunctionOnlyTimeDependent_[ i ] &&
+                    isUpdateFunctionTimeSet_[ i ] && ( updateFunctionTimes_[ i ] == currentTime );
+        }
+
         for( unsigned int i = 0; i < resetFunctionVector_.size( ); i++ )
         {
-            resetFunctionVector_.at( i ).template get< 2 >( )( );
+            if( ( resetFunctionUpdateIndices_.at( i ) < 0 ) || !skipCurrentUpdate_[ resetFunctionUpdateIndices_.at( i ) ] )
+            {
+                resetFunctionVector_.at( i ).template get< 2 >( )( );
+            }
         }
 
         // Set integrated state variables in environment.
@@ -118,10 +136,104 @@ public:
         // determined by setUpdateFunctions
         for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
         {
-            updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+            if( skipCurrentUpdate_[ i ] )
+            {
+                numberOfSkippedUpdates_++;
+            }
+            else
+            {
+                updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+                numberOfEvaluatedUpdates_++;
+
+                if( isUpdateFunctionOnlyTimeDependent_[ i ] )
+                {
+                    updateFunctionTimes_[ i ] = currentTime;
+                    isUpdateFunctionTimeSet_[ i ] = true;
+                }
+            }
         }
     }
 
+    //! Function to clear the times to which the (only time-dependent) environment models were last updated.
+    /*!
+     * Function to clear the times to which the (only time-dependent) environment models were last updated, so that all
+     * environment models are updated on the next call to updateEnvironment. This function must be called whenever the
+     * environment models may have been modified outside of this object (e.g. due to a change in estimated parameters,
+     * or the resetting of ephemerides after a propagation). It is called automatically before each propagation.
+     */
+    void resetCachedUpdateTimes( )
+    {
+        isUpdateFunctionTimeSet_.assign( updateFunctionVector_.size( ), false );
+    }
+
+    //! Function to set whether updates of environment models that are already at the current time are skipped
+    /*!
+     * Function to set whether updates of environment models that depend only on time, and which have already been
+     * updated to the current time, are skipped (true by default).
+     * \param skipRedundantUpdates Boolean denoting whether redundant updates are skipped.
+     */
+    void setSkipRedundantUpdates( const bool skipRedundantUpdates )
+    {
+        skipRedundantUpdates_ = skipRedundantUpdates;
+        resetCachedUpdateTimes( );
+    }
+
+    //! Function to retrieve the number of update functions evaluated since creation/last statistics reset
+    /*!
+     * Function to retrieve the number of update functions evaluated since creation/last call to resetUpdateStatistics
+     * \return Number of update functions evaluated since creation/last call to resetUpdateStatistics
+     */
+    unsigned int getNumberOfEvaluatedUpdates( )
+    {
+        return numberOfEvaluatedUpdates_;
+    }
+
+    //! Function to retrieve the number of update functions skipped since creation/last statistics reset
+    /*!
+     * Function to retrieve the number of update functions that were skipped since creation/last call to
+     * resetUpdateStatistics, because the associated environment model had already been updated to the current time.
+     * \return Number of update functions skipped since creation/last call to resetUpdateStatistics
+     */
+    unsigned int getNumberOfSkippedUpdates( )
+    {
+        return numberOfSkippedUpdates_;
+    }
+
+    //! Function to reset the number of evaluated and skipped update functions to zero.
+    void resetUpdateStatistics( )
+    {
+        numberOfEvaluatedUpdates_ = 0;
+        numberOfSkippedUpdates_ = 0;
+    }
+
+    //! Function to retrieve the list of environment updates, in the order in which they are evaluated.
+    /*!
+     * Function to retrieve the list of environment updates (type and associated body), in the order in which they are
+     * evaluated.
+     * \return List of environment updates, in the order in which they are evaluated.
+     */
+    std::vector< std::pair< EnvironmentModelsToUpdate, std::string > > getUpdateOrder( )
+    {
+        std::vector< std::pair< EnvironmentModelsToUpdate, std::string > > updateOrder;
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            updateOrder.push_back( std::make_pair( updateFunctionVector_.at( i ).template get< 0 >( ),
+                                                   updateFunctionVector_.at( i ).template get< 1 >( ) ) );
+        }
+        return updateOrder;
+    }
+
+    //! Function to retrieve the indices (in update order) of the updates on which each update depends
+    /*!
+     * Function to retrieve the indices (in the list returned by getUpdateOrder) of the updates on which each update
+     * depends, i.e. which must be evaluated before it.
+     * \return Indices of the updates on which each update depends.
+     */
+    std::vector< std::vector< int > > getUpdateFunctionDependencies( )
+    {
+        return updateFunctionDependencies_;
+    }
+
 private:
 
     //! Function to set numerically integrated states in environment.
@@ -249,143 +361,169 @@ private:
         }
     }
 
+    //! Function to find the index of an update function in updateFunctionVector_.
+    /*!
+     *  Function to find the index of an update function in updateFunctionVector_.
+     *  \param updateType Type of environment update
+     *  \param bodyName Name of body for which environment model is updated.
+     *  \return Index of update function in updateFunctionVector_ (-1 if not found).
+     */
+    int findUpdateFunctionIndex( const EnvironmentModelsToUpdate updateType, const std::string& bodyName )
+    {
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            if( ( updateFunctionVector_.at( i ).template get< 0 >( ) == updateType ) &&
+                    ( updateFunctionVector_.at( i ).template get< 1 >( ) == bodyName ) )
+            {
+                return static_cast< int >( i );
+            }
+        }
+        return -1;
+    }
+
     //! Function to set the order in which the updateFunctionVector_ is to be updated.
     /*!
-     *  Function to set the order in which the updateFunctionVector_ is to be updated. Order is determined recursively in
-     *  this function,  the variable iterationNumber keeps track of the number of nested calls to the function.
-     *  \param iterationNumber Number of subsequent calls to this funtion
+     *  Function to set the order in which the updateFunctionVector_ is to be updated. First, the dependencies between
+     *  the update functions are determined. Currently, the only explicit dependency is that of a rotation model
+     *  defined by an AerodynamicAngleCalculator (and the associated flight conditions), which requires the
+     *  state/orientation of the central body and the state of the vehicle to be updated first. The update functions
+     *  are then sorted topologically, retaining the original order (as given by the EnvironmentModelsToUpdate
+     *  enum) where allowed by the dependencies. Finally, the update functions that depend only on time are identified:
+     *  translational and rotational ephemerides (neither of which are numerically integrated in the current
+     *  propagation). These are only evaluated once per distinct time by updateEnvironment. Time-dependent gravity
+     *  fields are not regarded as depending only on time, since (non-interpolated) tidal variations are computed
+     *  from the current states and orientations of the deformed and deforming bodies.
      */
-    void setUpdateFunctionOrder( const int iterationNumber = 0 )
+    void setUpdateFunctionOrder( )
     {
-        bool rerunUpdateOrder = 0;
+        const int numberOfUpdates = static_cast< int >( updateFunctionVector_.size( ) );
 
-        // Iterate over all update functions
-        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        // Determine, per update function, indices of update functions that are to be evaluated before it.
+        std::vector< std::vector< int > > dependencies( numberOfUpdates );
+        for( int i = 0; i < numberOfUpdates; i++ )
         {
-            // Check if environment model is rotational state.
-            if( updateFunctionVector_.at( i ).template get< 0 >( ) == body_rotational_state_update )
+            // Check if environment model is rotational state, and body has no rotational ephemeris.
+            if( updateFunctionVector_.at( i ).template get< 0 >( ) == body_rotational_state_update &&
+                    bodyList_.at( updateFunctionVector_.at( i ).template get< 1 >( ) )->getRotationalEphemeris( ) == nullptr )
             {
-                // Check id body has no rotational ephemeris (i.e. if rotation comes from iterationNumber ).
-                if( bodyList_.at( updateFunctionVector_.at( i ).template get< 1 >( ) )->getRotationalEphemeris( ) == nullptr )
-                {
-                    // Check if DependentOrientationCalculator is an AerodynamicAngleCalculator.
-                    std::shared_ptr< reference_frames::DependentOrientationCalculator > dependentOrientationCalculator =
+                // Check if DependentOrientationCalculator is an AerodynamicAngleCalculator.
+                std::shared_ptr< reference_frames::AerodynamicAngleCalculator > aerodynamicAngleCalculator =
+                        std::dynamic_pointer_cast< reference_frames::AerodynamicAngleCalculator >(
                             bodyList_.at( updateFunctionVector_.at( i ).template get< 1 >( ) )->
-                            getDependentOrientationCalculator( );
-                    std::shared_ptr< reference_frames::AerodynamicAngleCalculator > aerodynamicAngleCalculator =
-                            std::dynamic_pointer_cast< reference_frames::AerodynamicAngleCalculator >(
-                                dependentOrientationCalculator );
-
-                    // Check if properties of AerodynamicAngleCalculator are such that a different update order is warranted.
-                    if( std::dynamic_pointer_cast< reference_frames::AerodynamicAngleCalculator >(
-                                dependentOrientationCalculator ) != nullptr )
+                            getDependentOrientationCalculator( ) );
+                if( aerodynamicAngleCalculator != nullptr )
+                {
+                    const std::string& vehicleName = updateFunctionVector_.at( i ).template get< 1 >( );
+                    std::vector< int > stateDependencies;
+                    stateDependencies.push_back( findUpdateFunctionIndex(
+                                                     body_translational_state_update,
+                                                     aerodynamicAngleCalculator->getCentralBodyName( ) ) );
+                    stateDependencies.push_back( findUpdateFunctionIndex(
+                                                     body_rotational_state_update,
+                                                     aerodynamicAngleCalculator->getCentralBodyName( ) ) );
+                    stateDependencies.push_back( findUpdateFunctionIndex(
+                                                     body_translational_state_update, vehicleName ) );
+                    stateDependencies.erase( std::remove( stateDependencies.begin( ), stateDependencies.end( ), -1 ),
+                                             stateDependencies.end( ) );
+
+                    // Flight conditions depend on states; vehicle rotation depends on states and flight conditions.
+                    int flightConditionsIndex = findUpdateFunctionIndex( vehicle_flight_conditions_update, vehicleName );
+                    dependencies.at( i ) = stateDependencies;
+                    if( flightConditionsIndex >= 0 )
                     {
-                        unsigned int centralTranslationalUpdateIndex = 0;
-                        unsigned int centralRotationalUpdateIndex = 0;
-                        unsigned int vehicleTranslationalUpdateIndex = 0;
-                        unsigned int vehicleRotationalUpdateIndex = i;
-                        unsigned int flightCoditionsUpdateIndex = 0;
-
-                        bool centralTranslationalUpdateIndexSet = false;
-                        bool centralRotationalUpdateIndexSet = false;
-                        bool vehicleTranslationalUpdateIndexSet = false;
-                        bool flightConditionsUpdateIndexSet = false;
-
-                        // Check if the state or orientation of the central body of AerodynamicAngleCalculator is updated.
-                        for( unsigned int j = 0; j < updateFunctionVector_.size( ); j++ )
-                        {
-                            if( ( updateFunctionVector_.at( j ).template get< 0 >( ) == body_translational_state_update ) &&
-                                    ( updateFunctionVector_.at( j ).template get< 1 >( ) ==
-                                      aerodynamicAngleCalculator->getCentralBodyName( ) ) )
-                            {
-                                centralTranslationalUpdateIndex = j;
-                                centralTranslationalUpdateIndexSet = true;
-                            }
-
-                            if( ( updateFunctionVector_.at( j ).template get< 0 >( ) == body_rotational_state_update ) &&
-                                    ( updateFunctionVector_.at( j ).template get< 1 >( ) ==
-                                      aerodynamicAngleCalculator->getCentralBodyName( ) ) )
-                            {
-                                centralRotationalUpdateIndex = j;
-                                centralRotationalUpdateIndexSet = true;
-                            }
-
-                            if( ( updateFunctionVector_.at( j ).template get< 0 >( ) == body_translational_state_update ) &&
-                                    ( updateFunctionVector_.at( j ).template get< 1 >( ) ==
-                                      updateFunctionVector_.at( i ).template get< 1 >( ) ) )
-                            {
-                                vehicleTranslationalUpdateIndex = j;
-                                vehicleTranslationalUpdateIndexSet = true;
-                            }
-
-                            if( ( updateFunctionVector_.at( j ).template get< 0 >( ) == vehicle_flight_conditions_update ) &&
-                                    ( updateFunctionVector_.at( j ).template get< 1 >( ) ==
-                                      updateFunctionVector_.at( i ).template get< 1 >( ) ) )
-                            {
-                                flightCoditionsUpdateIndex = j;
-                                flightConditionsUpdateIndexSet = true;
-                            }
-                        }
-
-
-                        std::vector< int > indices;
-                        std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, std::function< void( const double ) > > > updatesToMove;
-
-                        if( centralTranslationalUpdateIndexSet )
-                        {
-                            indices.push_back( centralTranslationalUpdateIndex );
-                            updatesToMove.push_back( updateFunctionVector_.at( centralTranslationalUpdateIndex ) );
-                        }
-
-                        if( centralRotationalUpdateIndexSet )
-                        {
-                            indices.push_back( centralRotationalUpdateIndex );
-                            updatesToMove.push_back( updateFunctionVector_.at( centralRotationalUpdateIndex ) );
-                        }
+                        dependencies.at( i ).push_back( flightConditionsIndex );
+                        dependencies.at( flightConditionsIndex ).insert(
+                                    dependencies.at( flightConditionsIndex ).end( ),
+                                    stateDependencies.begin( ), stateDependencies.end( ) );
+                    }
+                }
+            }
+        }
 
-                        if( vehicleTranslationalUpdateIndexSet )
+        // Sort update functions topologically; of the update functions of which all dependencies have been evaluated,
+        // the one with the lowest original index is added first.
+        std::vector< int > sortedIndices;
+        std::vector< bool > isIndexSorted( numberOfUpdates, false );
+        while( static_cast< int >( sortedIndices.size( ) ) < numberOfUpdates )
+        {
+            int nextIndex = -1;
+            for( int i = 0; i < numberOfUpdates && nextIndex < 0; i++ )
+            {
+                if( !isIndexSorted.at( i ) )
+                {
+                    bool areDependenciesSorted = true;
+                    for( unsigned int j = 0; j < dependencies.at( i ).size( ); j++ )
+                    {
+                        if( !isIndexSorted.at( dependencies.at( i ).at( j ) ) && ( dependencies.at( i ).at( j ) != i ) )
                         {
-                            indices.push_back( vehicleTranslationalUpdateIndex );
-                            updatesToMove.push_back( updateFunctionVector_.at( vehicleTranslationalUpdateIndex ) );
+                            areDependenciesSorted = false;
                         }
+                    }
 
-                        if( flightConditionsUpdateIndexSet )
-                        {
-                            indices.push_back( flightCoditionsUpdateIndex );
-                            updatesToMove.push_back( updateFunctionVector_.at( flightCoditionsUpdateIndex ) );
-                        }
+                    if( areDependenciesSorted )
+                    {
+                        nextIndex = i;
+                    }
+                }
+            }
 
-                        indices.push_back( vehicleRotationalUpdateIndex );
-                        updatesToMove.push_back( updateFunctionVector_.at( vehicleRotationalUpdateIndex ) );
-                        std::vector< int > unorderedIndices = indices;
-                        std::sort( indices.begin( ), indices.end( ) );
+            if( nextIndex < 0 )
+            {
+                throw std::runtime_error( "Error when finding update order; circular dependency in environment updates" );
+            }
+            sortedIndices.push_back( nextIndex );
+            isIndexSorted[ nextIndex ] = true;
+        }
 
-                        if( indices != unorderedIndices )
-                        {
+        // Reorder update functions, and set dependencies in terms of new indices.
+        std::vector< int > newIndices( numberOfUpdates );
+        std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, std::function< void( const double ) > > >
+                unsortedUpdateFunctionVector = updateFunctionVector_;
+        for( int i = 0; i < numberOfUpdates; i++ )
+        {
+            updateFunctionVector_[ i ] = unsortedUpdateFunctionVector.at( sortedIndices.at( i ) );
+            newIndices[ sortedIndices.at( i ) ] = i;
+        }
 
-                            for( unsigned int k = 0; k < updatesToMove.size( ); k++ )
-                            {
-                                updateFunctionVector_[ indices.at( k ) ] = updatesToMove.at( k );
-                            }
-                            rerunUpdateOrder = true;
-                            break;
-                        }
-                    }
-                }
+        updateFunctionDependencies_.clear( );
+        updateFunctionDependencies_.resize( numberOfUpdates );
+        for( int i = 0; i < numberOfUpdates; i++ )
+        {
+            for( unsigned int j = 0; j < dependencies.at( sortedIndices.at( i ) ).size( ); j++ )
+            {
+                updateFunctionDependencies_[ i ].push_back( newIndices.at( dependencies.at( sortedIndices.at( i ) ).at( j ) ) );
             }
         }
 
-        // Define escape condition in case of infinite loop.
-        if( iterationNumber > 10000 )
+        // Determine which update functions depend only on time (both directly, and through their dependencies).
+        isUpdateFunctionOnlyTimeDependent_.resize( numberOfUpdates );
+        for( int i = 0; i < numberOfUpdates; i++ )
         {
-            throw std::runtime_error( "Error when finding update order; stuck in infinite loop" );
+            const EnvironmentModelsToUpdate updateType = updateFunctionVector_.at( i ).template get< 0 >( );
+            bool isOnlyTimeDependent =
+                    ( updateType == body_translational_state_update ) ||
+                    ( ( updateType == body_rotational_state_update ) &&
+                      ( bodyList_.at( updateFunctionVector_.at( i ).template get< 1 >( ) )->getRotationalEphemeris( ) != nullptr ) );
+            for( unsigned int j = 0; j < updateFunctionDependencies_.at( i ).size( ); j++ )
+            {
+                isOnlyTimeDependent = isOnlyTimeDependent &&
+                        isUpdateFunctionOnlyTimeDependent_.at( updateFunctionDependencies_.at( i ).at( j ) );
+            }
+            isUpdateFunctionOnlyTimeDependent_[ i ] = isOnlyTimeDependent;
         }
 
-        // Rerun function if needed.
-        if( rerunUpdateOrder )
+        // Associate reset functions with update functions.
+        resetFunctionUpdateIndices_.clear( );
+        for( unsigned int i = 0; i < resetFunctionVector_.size( ); i++ )
         {
-            setUpdateFunctionOrder( iterationNumber + 1 );
+            resetFunctionUpdateIndices_.push_back( findUpdateFunctionIndex(
+                                                       resetFunctionVector_.at( i ).template get< 0 >( ),
+                                                       resetFunctionVector_.at( i ).template get< 1 >( ) ) );
         }
+
+        skipCurrentUpdate_.assign( numberOfUpdates, false );
+        updateFunctionTimes_.resize( numberOfUpdates );
+        resetCachedUpdateTimes( );
     }
 
     //! Function to set the update functions for the environment from the required update settings.
@@ -682,8 +820,32 @@ private:
     //! time step).
     std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, std::function< void( ) > > > resetFunctionVector_;
 
+    //! Indices (in updateFunctionVector_) of update functions that are to be evaluated before each update function.
+    std::vector< std::vector< int > > updateFunctionDependencies_;
+
+    //! Indices (in updateFunctionVector_) of update functions associated with each entry of resetFunctionVector_.
+    std::vector< int > resetFunctionUpdateIndices_;
+
+    //! List of booleans denoting, per update function, whether the environment model depends only on time.
+    std::vector< bool > isUpdateFunctionOnlyTimeDependent_;
+
+    //! List of times to which update functions (that depend only on time) were last evaluated.
+    std::vector< TimeType > updateFunctionTimes_;
+
+    //! List of booleans denoting, per update function, whether the entry in updateFunctionTimes_ is valid.
+    std::vector< bool > isUpdateFunctionTimeSet_;
+
+    //! Pre-allocated list of booleans denoting, per update function, whether it is skipped in current update.
+    std::vector< bool > skipCurrentUpdate_;
+
+    //! Boolean denoting whether updates of only time-dependent models that are already at current time are skipped.
+    bool skipRedundantUpdates_;
 
+    //! Number of update functions evaluated since creation/last call to resetUpdateStatistics.
+    unsigned int numberOfEvaluatedUpdates_;
 
+    //! Number of update functions skipped since creation/last call to resetUpdateStatistics.
+    unsigned int numberOfSkippedUpdates_;
 
     //! Predefined state history iterator for computational efficiency.
     typename std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::const_iterator
@@ -0,0 +1,145 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_MONTECARLOPROPAGATION_H
+#define TUDAT_MONTECARLOPROPAGATION_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Mathematics/Statistics/randomSampling.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to perform a Monte Carlo analysis, propagating the dynamics for each sample in parallel.
+/*!
+ *  Function to perform a Monte Carlo analysis, propagating the dynamics for each sample in parallel. The environment,
+ *  acceleration models and (during propagation) dynamics simulator all contain mutable state, so that they cannot be
+ *  shared between concurrent propagations. Therefore, a separate environment is created for each thread (by calling
+ *  bodyMapCreationFunction, sequentially before the propagations are started), which the thread reuses for all
+ *  samples it processes. For each sample, the propagator and
+ *  integrator settings (incl. acceleration models) are created from the thread's environment by the
+ *  propagatorSettingsCreationFunction and integratorSettingsCreationFunction. These functions receive the sample
+ *  vector, which may be used to perturb the initial state, or to modify properties of bodies in the environment (in
+ *  which case all sample-dependent properties must be set for each sample, as the environment is reused). After the
+ *  propagation, the resultExtractionFunction is called to retrieve the required output from the dynamics simulator,
+ *  allowing the (potentially large) numerical solution to be reduced to only the relevant quantities.
+ *
+ *  Results are stored in a pre-allocated array, at the index of the corresponding sample, so that no locking is
+ *  required to collect the results, and the output is identical for any number of threads. Note that the creation
+ *  functions must not use any objects that are not thread-safe (such as direct Spice ephemerides, see
+ *  ChebyshevSpiceEphemerisSettings for a thread-safe alternative), unless they are created inside the function.
+ *  \param samples List of samples (e.g. initial state or parameter perturbations) for which propagation is performed.
+ *  \param bodyMapCreationFunction Function creating the environment that is used by a single thread.
+ *  \param propagatorSettingsCreationFunction Function creating propagator settings, from environment and sample.
+ *  \param integratorSettingsCreationFunction Function creating integrator settings, from sample.
+ *  \param resultExtractionFunction Function retrieving result of a single propagation, from dynamics simulator (after
+ *  propagation) and sample index.
+ *  \param numberOfThreads Maximum number of threads that are to be used (by default, number of available threads)
+ *  \return Results of the propagations, in the same order as the samples.
+ */
+template< typename ResultType, typename StateScalarType = double, typename TimeType = double >
+std::vector< ResultType > executeParallelMonteCarloPropagation(
+        const std::vector< Eigen::VectorXd >& samples,
+        const std::function< simulation_setup::NamedBodyMap( ) > bodyMapCreationFunction,
+        const std::function< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > >(
+            const simulation_setup::NamedBodyMap&, const Eigen::VectorXd& ) > propagatorSettingsCreationFunction,
+        const std::function< std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > >(
+            const Eigen::VectorXd& ) > integratorSettingsCreationFunction,
+        const std::function< ResultType( SingleArcDynamicsSimulator< StateScalarType, TimeType >&, const int ) >
+        resultExtractionFunction,
+        const unsigned int numberOfThreads = utilities::getNumberOfAvailableThreads( ) )
+{
+    const int numberOfSamples = static_cast< int >( samples.size( ) );
+
+    // Create environment for each thread (sequentially, so that environment creation need not be thread-safe).
+    const unsigned int numberOfUsedThreads = std::max(
+                1u, std::min( numberOfThreads, static_cast< unsigned int >( std::max( numberOfSamples, 1 ) ) ) );
+    std::vector< simulation_setup::NamedBodyMap > bodyMapPerThread;
+    for( unsigned int i = 0; i < numberOfUsedThreads; i++ )
+    {
+        bodyMapPerThread.push_back( bodyMapCreationFunction( ) );
+    }
+
+    // Collect results in array with addressable elements (unlike std::vector< bool >), so that concurrent writes to
+    // different samples do not conflict.
+    std::unique_ptr< ResultType[ ] > sampleResults( new ResultType[ numberOfSamples ] );
+    utilities::executeParallelTasksWithThreadIndex(
+                numberOfSamples, [ & ]( const int sampleIndex, const unsigned int threadIndex )
+    {
+        const simulation_setup::NamedBodyMap& bodyMap = bodyMapPerThread.at( threadIndex );
+
+        // Propagate dynamics for current sample.
+        SingleArcDynamicsSimulator< StateScalarType, TimeType > dynamicsSimulator(
+                    bodyMap, integratorSettingsCreationFunction( samples[ sampleIndex ] ),
+                    propagatorSettingsCreationFunction( bodyMap, samples[ sampleIndex ] ),
+                    true, false, false );
+
+        sampleResults[ sampleIndex ] = resultExtractionFunction( dynamicsSimulator, sampleIndex );
+    }, numberOfUsedThreads );
+
+    return std::vector< ResultType >( std::make_move_iterator( sampleResults.get( ) ),
+                                      std::make_move_iterator( sampleResults.get( ) + numberOfSamples ) );
+}
+
+//! Function to perform a Monte Carlo analysis, with randomly generated samples, propagating the dynamics in parallel.
+/*!
+ *  Function to perform a Monte Carlo analysis, with randomly generated samples, propagating the dynamics in parallel.
+ *  The samples are generated (before the propagations are started, in the calling thread) using the
+ *  generateRandomSampleFromGenerator function, so that the samples do not depend on the number of threads. See the
+ *  executeParallelMonteCarloPropagation function taking a list of samples for details on the propagation.
+ *  \param numberOfSamples Number of samples that are to be generated and propagated.
+ *  \param randomVariableGenerators Probability distributions for the entries of the sample vectors.
+ *  \param bodyMapCreationFunction Function creating the environment that is used by a single thread.
+ *  \param propagatorSettingsCreationFunction Function creating propagator settings, from environment and sample.
+ *  \param integratorSettingsCreationFunction Function creating integrator settings, from sample.
+ *  \param resultExtractionFunction Function retrieving result of a single propagation, from dynamics simulator (after
+ *  propagation) and sample index.
+ *  \param numberOfThreads Maximum number of threads that are to be used (by default, number of available threads)
+ *  \return Pair with generated samples (first) and results of the propagations, in the same order (second).
+ */
+template< typename ResultType, typename StateScalarType = double, typename TimeType = double >
+std::pair< std::vector< Eigen::VectorXd >, std::vector< ResultType > > executeParallelMonteCarloPropagation(
+        const int numberOfSamples,
+        const std::vector< std::shared_ptr< statistics::RandomVariableGenerator< double > > > randomVariableGenerators,
+        const std::function< simulation_setup::NamedBodyMap( ) > bodyMapCreationFunction,
+        const std::function< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > >(
+            const simulation_setup::NamedBodyMap&, const Eigen::VectorXd& ) > propagatorSettingsCreationFunction,
+        const std::function< std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > >(
+            const Eigen::VectorXd& ) > integratorSettingsCreationFunction,
+        const std::function< ResultType( SingleArcDynamicsSimulator< StateScalarType, TimeType >&, const int ) >
+        resultExtractionFunction,
+        const unsigned int numberOfThreads = utilities::getNumberOfAvailableThreads( ) )
+{
+    std::vector< Eigen::VectorXd > samples =
+            statistics::generateRandomSampleFromGenerator( numberOfSamples, randomVariableGenerators );
+    return std::make_pair( samples, executeParallelMonteCarloPropagation< ResultType, StateScalarType, TimeType >(
+                               samples, bodyMapCreationFunction, propagatorSettingsCreationFunction,
+                               integratorSettingsCreationFunction, resultExtractionFunction, numberOfThreads ) );
+}
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_MONTECARLOPROPAGATION_H
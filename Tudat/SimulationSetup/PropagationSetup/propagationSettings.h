@@ -24,6 +24,7 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModel.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/massRateModel.h"
+#include "Tudat/Astrodynamics/Propagators/propagationOutputSink.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/rotationalMotionStateDerivative.h"
@@ -166,7 +167,8 @@ public:
                                  const double printInterval = TUDAT_NAN ):
         PropagatorSettings< StateScalarType >( initialBodyStates, false ),
         stateType_( stateType ), terminationSettings_( terminationSettings ),
-        dependentVariablesToSave_( dependentVariablesToSave ), printInterval_( printInterval)
+        dependentVariablesToSave_( dependentVariablesToSave ), printInterval_( printInterval),
+        keepHistoryInMemory_( true )
     { }
 
     //! Virtual destructor.
@@ -240,6 +242,54 @@ public:
         terminationSettings_ = terminationSettings;
     }
 
+    //! Function to retrieve the sinks to which the output is passed during propagation.
+    /*!
+     * Function to retrieve the sinks to which the output is passed during propagation.
+     * \return Sinks to which the output is passed during propagation (default none).
+     */
+    std::vector< std::shared_ptr< PropagationOutputSink< StateScalarType > > > getOutputSinks( )
+    {
+        return outputSinks_;
+    }
+
+    //! Function to set the sinks to which the output is passed during propagation.
+    /*!
+     * Function to set the sinks to which the output is passed during propagation. Each saved step is passed to the sinks
+     * (with the state in conventional form) as soon as it is final, so that the output can be processed while the
+     * propagation is running.
+     * \param outputSinks Sinks to which the output is passed during propagation.
+     * \param keepHistoryInMemory Boolean denoting whether the full propagation history is (also) to be kept in memory.
+     */
+    void setOutputSinks( const std::vector< std::shared_ptr< PropagationOutputSink< StateScalarType > > >& outputSinks,
+                         const bool keepHistoryInMemory = true )
+    {
+        outputSinks_ = outputSinks;
+        keepHistoryInMemory_ = keepHistoryInMemory;
+    }
+
+    //! Function to retrieve whether the full propagation history is to be kept in memory.
+    /*!
+     * Function to retrieve whether the full propagation history is to be kept in memory.
+     * \return Boolean denoting whether the full propagation history is to be kept in memory (default true).
+     */
+    bool getKeepHistoryInMemory( )
+    {
+        return keepHistoryInMemory_;
+    }
+
+    //! Function to set whether the full propagation history is to be kept in memory.
+    /*!
+     * Function to set whether the full propagation history is to be kept in memory. If false, only the final state,
+     * dependent variables and computation time are retained by the dynamics simulator, so that the memory use does not
+     * depend on the length of the propagation. The output should then be obtained from the output sinks. Note that the
+     * integrated results can then not be set in the environment.
+     * \param keepHistoryInMemory Boolean denoting whether the full propagation history is to be kept in memory.
+     */
+    void setKeepHistoryInMemory( const bool keepHistoryInMemory )
+    {
+        keepHistoryInMemory_ = keepHistoryInMemory;
+    }
+
 protected:
 
     //!Type of state being propagated
@@ -255,6 +305,12 @@ protected:
     //! current state and time are to be printed to console (default never).
     double printInterval_;
 
+    //! Sinks to which the output is passed during propagation (default none).
+    std::vector< std::shared_ptr< PropagationOutputSink< StateScalarType > > > outputSinks_;
+
+    //! Boolean denoting whether the full propagation history is to be kept in memory (default true).
+    bool keepHistoryInMemory_;
+
 };
 
 //! Function to get the total size of multi-arc initial state vector
@@ -11,6 +11,8 @@
 #ifndef TUDAT_SETNUMERICALLYINTEGRATEDSTATES_H
 #define TUDAT_SETNUMERICALLYINTEGRATEDSTATES_H
 
+#include <type_traits>
+
 #include "Tudat/Basics/utilities.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/Astrodynamics/Ephemerides/frameManager.h"
@@ -141,6 +143,46 @@ void resetIntegratedEphemerisOfBody(
     }
 }
 
+//! Function to reset the tabulated ephemeris of a body from time-sorted vectors of times and states
+/*!
+ * Function to reset the tabulated ephemeris of a body from time-sorted vectors of times and states. If the ephemeris of
+ * the body is of type TabulatedCartesianEphemeris< StateScalarType, TimeType >, the interpolator is created directly from
+ * the vectors. Otherwise, the map-based resetIntegratedEphemerisOfBody function is used.
+ * \param bodyMap List of bodies used in simulations.
+ * \param ephemerisTimes Times of new state history of the body, in increasing order
+ * \param ephemerisStates New states of the body at ephemerisTimes
+ * \param bodyToIntegrate Name of body for which the ephemeris is to be reset.
+ */
+template< typename TimeType, typename StateScalarType >
+void resetIntegratedEphemerisOfBody(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< TimeType >& ephemerisTimes,
+        const std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisStates,
+        const std::string& bodyToIntegrate )
+{
+    std::shared_ptr< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > > tabulatedEphemeris =
+            std::dynamic_pointer_cast< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                bodyMap.at( bodyToIntegrate )->getEphemeris( ) );
+    if( tabulatedEphemeris != nullptr )
+    {
+        // Create interpolator with same settings as createStateInterpolator
+        tabulatedEphemeris->resetInterpolator(
+                    ephemerides::createTabulatedStateInterpolator(
+                        ephemerisTimes, ephemerisStates,
+                        std::make_shared< interpolators::LagrangeInterpolatorSettings >(
+                            6, std::is_same< TimeType, Time >::value ) ) );
+    }
+    else
+    {
+        std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > ephemerisInput;
+        for( unsigned int i = 0; i < ephemerisTimes.size( ); i++ )
+        {
+            ephemerisInput[ ephemerisTimes.at( i ) ] = ephemerisStates.at( i );
+        }
+        resetIntegratedEphemerisOfBody( bodyMap, ephemerisInput, bodyToIntegrate );
+    }
+}
+
 //! Function to convert output of translational motion to input for the ephemeris.
 /*!
  * Function to convert output of translational motion from the numerical integrator to the required
@@ -241,6 +283,44 @@ void getSingleBodyStateHistoryFromPropagationOutpiut(
                 bodyIndex, translationalStateStartIndex, equationsOfMotionNumericalSolution, ephemerisInput, integrationToEphemerisFrameFunction );
 }
 
+//! Function to extract the numerical solution for the translational dynamics of a single body from contiguous propagation
+//! history.
+/*!
+ * Function to extract the numerical solution for the translational dynamics of a single body from contiguous propagation
+ * history (see PropagationHistory), sorted in increasing order of time. Function performs frame translation if required.
+ * \param bodyIndex Index of integrated body for which the state is to be retrieved
+ * \param startIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start.
+ * \param equationsOfMotionNumericalSolution Numerical solution of dynamics, with translational results in Cartesian elements
+ * w.r.t. integratation origins.
+ * \param ephemerisTimes Times of state history of requested body, in increasing order (returned by reference)
+ * \param ephemerisStates State history of requested body, w.r.t. the origin with which its ephemeris is defined
+ * (returned by reference)
+ * \param integrationToEphemerisFrameFunction Function to provide the state of the ephemeris origin of the current body
+ * w.r.t. its integration origin (nullptr if no translation is needed).
+ */
+template< typename TimeType, typename StateScalarType >
+void getSingleBodyStateHistoryFromPropagationOutput(
+        const int bodyIndex,
+        const int startIndex,
+        const PropagationHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        std::vector< TimeType >& ephemerisTimes,
+        std::vector< Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisStates,
+        const std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) >
+        integrationToEphemerisFrameFunction = nullptr )
+{
+    equationsOfMotionNumericalSolution.getSortedTimesAndStates(
+                startIndex + 6 * bodyIndex, 6, ephemerisTimes, ephemerisStates );
+
+    // Add required translation from integrationToEphemerisFrameFunction
+    if( integrationToEphemerisFrameFunction != nullptr )
+    {
+        for( unsigned int i = 0; i < ephemerisTimes.size( ); i++ )
+        {
+            ephemerisStates[ i ] -= integrationToEphemerisFrameFunction( ephemerisTimes[ i ] );
+        }
+    }
+}
+
 //! Create and reset ephemerides interpolator
 /*!
  * Creates and resets the interpolator for the ephemerides of the integrated bodies from the
@@ -283,6 +363,62 @@ void createAndSetInterpolatorsForEphemerides(
     }
 }
 
+//! Create and reset ephemerides interpolator from contiguous propagation history
+/*!
+ * Creates and resets the interpolator for the ephemerides of the integrated bodies from the
+ * numerical integration results, stored as contiguous propagation history (see PropagationHistory), without creating an
+ * intermediate map of the states.
+ * \param bodyMap List of bodies used in simulations.
+ * \param bodiesToIntegrate List of names of bodies which are numericall integrated (in the order in
+ * which they are in the equationsOfMotionNumericalSolution entries.
+ * \param startIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start.
+ * \param ephemerisUpdateOrder Order in which to update the ephemeris objects.
+ * \param equationsOfMotionNumericalSolution Numerical solution of translational equations of
+ * motion, in Cartesian elements w.r.t. integratation origins.
+ * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
+ * origins of each body w.r.t. their respective integration origins.
+ */
+template< typename TimeType, typename StateScalarType >
+void createAndSetInterpolatorsForEphemerides(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string >& bodiesToIntegrate,
+        const int startIndex,
+        const std::vector< std::string >& ephemerisUpdateOrder,
+        const PropagationHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        const std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
+        integrationToEphemerisFrameFunctions =
+        std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
+{
+    std::vector< TimeType > ephemerisTimes;
+    std::vector< Eigen::Matrix< StateScalarType, 6, 1 > > ephemerisStates;
+
+    // Iterate over all bodies that are integrated numerically and create state interpolator.
+    for( unsigned int i = 0; i < ephemerisUpdateOrder.size( ); i++ )
+    {
+        std::vector< std::string >::const_iterator bodyFindIterator = std::find(
+                    bodiesToIntegrate.begin( ), bodiesToIntegrate.end( ), ephemerisUpdateOrder.at( i ) );
+        if( bodyFindIterator == bodiesToIntegrate.end( ) )
+        {
+            throw std::runtime_error( "Error when creating and setting ephemeris after integration, cannot find body " +
+                                      ephemerisUpdateOrder.at( i ) );
+        }
+        int bodyIndex = std::distance( bodiesToIntegrate.begin( ), bodyFindIterator );
+
+        std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > integrationToEphemerisFrameFunction =
+                nullptr;
+        if( integrationToEphemerisFrameFunctions.count( ephemerisUpdateOrder.at( i ) ) > 0 )
+        {
+            integrationToEphemerisFrameFunction = integrationToEphemerisFrameFunctions.at( ephemerisUpdateOrder.at( i ) );
+        }
+
+        getSingleBodyStateHistoryFromPropagationOutput(
+                    bodyIndex, startIndex, equationsOfMotionNumericalSolution, ephemerisTimes, ephemerisStates,
+                    integrationToEphemerisFrameFunction );
+        resetIntegratedEphemerisOfBody(
+                    bodyMap, ephemerisTimes, ephemerisStates, bodiesToIntegrate.at( bodyIndex ) );
+    }
+}
+
 //! Resets the ephemerides of the integrated bodies from the numerical integration results.
 /*!
  * Resets the ephemerides of the integrated bodies from the numerical integration results, and
@@ -338,6 +474,60 @@ void resetIntegratedEphemerides(
                 equationsOfMotionNumericalSolution, integrationToEphemerisFrameFunctions );
 }
 
+//! Resets the ephemerides of the integrated bodies from the numerical integration results, stored as contiguous history.
+/*!
+ * Resets the ephemerides of the integrated bodies from the numerical integration results, stored as contiguous propagation
+ * history (see PropagationHistory), and performs associated computation for ephemeris-dependent environment variables.
+ * \param bodyMap List of bodies used in simulations.
+ * \param equationsOfMotionNumericalSolution Numerical solution of translational equations of
+ * motion, in Cartesian elements w.r.t. integratation origins.
+ * \param bodiesToIntegrate List of names of bodies which are numerically integrated (in the order in
+ * which they are in the equationsOfMotionNumericalSolution entries.
+ * \param startIndexAndSize Pair with start index and total (contiguous) size of integrated states in entries of
+ * equationsOfMotionNumericalSolution
+ * \param ephemerisUpdateOrder Order in which to update the ephemeris objects (empty if arbitrary).
+ * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
+ * origins of each body w.r.t. their respective integration origins.
+ */
+template< typename TimeType, typename StateScalarType >
+void resetIntegratedEphemerides(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const PropagationHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        const std::vector< std::string >& bodiesToIntegrate,
+        const std::pair< unsigned int, unsigned int > startIndexAndSize,
+        std::vector< std::string > ephemerisUpdateOrder = std::vector< std::string >( ),
+        const std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
+        integrationToEphemerisFrameFunctions =
+        std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
+{
+    // Set update order arbitrarily if no order is provided.
+    if( ephemerisUpdateOrder.size( ) == 0 )
+    {
+        ephemerisUpdateOrder = bodiesToIntegrate;
+    }
+    // Check input consistency
+    else if( ephemerisUpdateOrder.size( ) != bodiesToIntegrate.size( ) )
+    {
+        throw std::runtime_error( "Error when resetting ephemerides, input vectors have inconsistent size" );
+    }
+
+    if( static_cast< unsigned int >( equationsOfMotionNumericalSolution.getNumberOfRows( ) )
+            < startIndexAndSize.first + startIndexAndSize.second )
+    {
+        throw std::runtime_error( "Error when resetting ephemerides, input solution inconsistent with start index and size." );
+    }
+
+    if( startIndexAndSize.second != 6 * bodiesToIntegrate.size( ) )
+    {
+        throw std::runtime_error( "Error when resetting ephemerides, number of bodies inconsistent with input size." );
+    }
+
+    // Create interpolators from numerical integration results (states) at discrete times.
+    createAndSetInterpolatorsForEphemerides(
+                bodyMap, bodiesToIntegrate, startIndexAndSize.first, ephemerisUpdateOrder,
+                equationsOfMotionNumericalSolution, integrationToEphemerisFrameFunctions );
+}
+
 //! Resets the ephemerides of the integrated bodies from the numerical multi-arc integration results.
 /*!
  * Resets the ephemerides of the integrated bodies from the numerical multi-arc integration results, and
@@ -664,6 +854,20 @@ public:
     virtual void processIntegratedStates(
             const std::map< TimeType, Eigen::Matrix< StateScalarType,
             Eigen::Dynamic, 1 > >& numericalSolution ) = 0;
+
+    //! Function that processes the entries of the stateType_ in the full numericalSolution, stored as contiguous history
+    /*!
+     * Function that processes the entries of the stateType_ in the full numericalSolution, stored as contiguous history
+     * (see PropagationHistory). By default, the history is converted to a map, and processed by the map-based
+     * processIntegratedStates function.
+     * \param numericalSolution Full numerical solution, in global representation (see
+     * convertToOutputSolution function in associated SingleStateTypeDerivative derived class.
+     */
+    virtual void processIntegratedStates(
+            const PropagationHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        processIntegratedStates( numericalSolution.template getMap< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ) );
+    }
     
     virtual void processIntegratedMultiArcStates(
             const std::vector< std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >& numericalSolution,
@@ -742,6 +946,22 @@ public:
                     bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_, ephemerisUpdateOrder_,
                     integrationToEphemerisFrameFunctions_ );
     }
+
+    //! Function processing single-arc translational state, resetting bodies' ephemerides with new states
+    /*!
+     * Function processing single-arc translational state, resetting bodies' ephemerides with new states in numericalSolution
+     * variable, stored as contiguous history (see PropagationHistory). The ephemeris interpolators are created directly
+     * from the history, without an intermediate map of the states.
+     * \param numericalSolution Full numerical solution, in global representation (see
+     * convertToOutputSolution function in NBodyStateDerivative class.
+     */
+    void processIntegratedStates(
+            const PropagationHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        resetIntegratedEphemerides< TimeType, StateScalarType >(
+                    bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_, ephemerisUpdateOrder_,
+                    integrationToEphemerisFrameFunctions_ );
+    }
     
     //! Function processing multi-arc translational state, resetting bodies' ephemerides with new states
     /*!
@@ -1108,6 +1328,34 @@ void resetIntegratedStates(
     }
 }
 
+//! Function resetting dynamical properties of environment from numerical dynamics solution, stored as contiguous history
+/*!
+ * Function to reset the dynamical properties of the environment from the numerically integrated
+ * dynamics solution, stored as contiguous history (see PropagationHistory)
+ * \param equationsOfMotionNumericalSolution Solution produced by the numerical integration, in the
+ * 'conventional form'
+ * \sa SingleStateTypeDerivative::convertToOutputSolution
+ * \param integratedStateProcessors List of objects (per dynamics type) used to process integrated
+ * results into environment
+ */
+template< typename TimeType, typename StateScalarType >
+void resetIntegratedStates(
+        const PropagationHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        const std::map< IntegratedStateType, std::vector< std::shared_ptr<
+        IntegratedStateProcessor< TimeType, StateScalarType > > > >  integratedStateProcessors )
+{
+    for( typename std::map< IntegratedStateType, std::vector< std::shared_ptr< IntegratedStateProcessor<
+         TimeType, StateScalarType > > > >::const_iterator updateIterator = integratedStateProcessors.begin( );
+         updateIterator != integratedStateProcessors.end( ); updateIterator++ )
+    {
+        for( unsigned int i = 0; i < updateIterator->second.size( ); i++ )
+        {
+            updateIterator->second.at( i )->processIntegratedStates(
+                        equationsOfMotionNumericalSolution );
+        }
+    }
+}
+
 //! Function resetting dynamical properties of environment from numerical multi-arc dynamics solution
 /*!
  * Function to reset the dynamical properties of the environment from the numerically integrated multi-arc
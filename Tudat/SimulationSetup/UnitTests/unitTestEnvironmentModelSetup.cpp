@@ -11,6 +11,7 @@
 #define BOOST_TEST_MAIN
 
 #include <limits>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/make_shared.hpp>
@@ -35,6 +36,7 @@
 #include "Tudat/Astrodynamics/Gravitation/centralGravityModel.h"
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "Tudat/Astrodynamics/Gravitation/basicSolidBodyTideGravityFieldVariations.h"
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Basics/testMacros.h"
 
 #if USE_CSPICE
@@ -289,6 +291,53 @@ BOOST_AUTO_TEST_CASE( test_ephemerisSetup )
                     std::numeric_limits< double >::epsilon( ) );
     }
 
+    {
+        // Create ephemeris fitted to spice data
+        const double positionTolerance = 1.0E-3;
+        const double velocityTolerance = 1.0E-8;
+        std::shared_ptr< EphemerisSettings > chebyshevEphemerisSettings =
+                std::make_shared< ChebyshevSpiceEphemerisSettings >(
+                    1.0E7 - 5.0 * 86400.0, 1.0E7 + 5.0 * 86400.0, "Earth", "J2000",
+                    positionTolerance, velocityTolerance );
+        std::shared_ptr< ephemerides::Ephemeris > chebyshevEphemeris =
+                createBodyEphemeris( chebyshevEphemerisSettings, "Moon" );
+
+        std::pair< double, double > safeInterval = getSafeInterpolationInterval( chebyshevEphemeris );
+        BOOST_CHECK_EQUAL( safeInterval.first, 1.0E7 - 5.0 * 86400.0 );
+        BOOST_CHECK_CLOSE_FRACTION( safeInterval.second, 1.0E7 + 5.0 * 86400.0, 1.0E-15 );
+
+        // Compare fitted ephemeris against direct spice state.
+        const int numberOfTestTimes = 1000;
+        std::vector< double > testTimes;
+        for( int i = 0; i < numberOfTestTimes; i++ )
+        {
+            testTimes.push_back( 1.0E7 - 5.0 * 86400.0 + 863.0 * static_cast< double >( i ) );
+            Eigen::Vector6d stateDifference =
+                    spice_interface::getBodyCartesianStateAtEpoch( "Moon", "Earth", "J2000", "None", testTimes.at( i ) ) -
+                    chebyshevEphemeris->getCartesianState( testTimes.at( i ) );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 2.0 * positionTolerance );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 2.0 * velocityTolerance );
+        }
+
+        // Check that fitted ephemeris can be evaluated concurrently, with results identical to sequential evaluation.
+        std::vector< Eigen::Vector6d > sequentialStates( numberOfTestTimes );
+        std::vector< Eigen::Vector6d > concurrentStates( numberOfTestTimes );
+        utilities::executeParallelTasks(
+                    numberOfTestTimes, [ & ]( const int i )
+        {
+            sequentialStates[ i ] = chebyshevEphemeris->getCartesianState( testTimes.at( i ) );
+        }, 1 );
+        utilities::executeParallelTasks(
+                    numberOfTestTimes, [ & ]( const int i )
+        {
+            concurrentStates[ i ] = chebyshevEphemeris->getCartesianState( testTimes.at( i ) );
+        }, 4 );
+        for( int i = 0; i < numberOfTestTimes; i++ )
+        {
+            BOOST_CHECK( sequentialStates.at( i ) == concurrentStates.at( i ) );
+        }
+    }
+
 
 }
 #endif
@@ -819,6 +868,23 @@ BOOST_AUTO_TEST_CASE( test_earthRotationModelSetup )
             }
         }
     }
+
+    // Create rotation models using (process-wide) cache of Earth orientation angles, and check that cache is shared
+    rotationSettings->resetAnglesCacheSettings( std::make_shared< EarthOrientationAnglesCacheSettings >( 60.0, 8 ) );
+    std::shared_ptr< tudat::ephemerides::GcrsToItrsRotationModel > cachedEarthRotationModel =
+            std::dynamic_pointer_cast< tudat::ephemerides::GcrsToItrsRotationModel >(
+                createRotationModel( rotationSettings, "Earth" ) );
+    std::shared_ptr< tudat::ephemerides::GcrsToItrsRotationModel > secondCachedEarthRotationModel =
+            std::dynamic_pointer_cast< tudat::ephemerides::GcrsToItrsRotationModel >(
+                createRotationModel( rotationSettings, "Earth" ) );
+    BOOST_CHECK( cachedEarthRotationModel->getAnglesCache( ) != nullptr );
+    BOOST_CHECK_EQUAL( cachedEarthRotationModel->getAnglesCache( ), secondCachedEarthRotationModel->getAnglesCache( ) );
+
+    Eigen::Matrix3d cachedMatrixDeviation =
+            cachedEarthRotationModel->getRotationToBaseFrame( testTime ).toRotationMatrix( ) -
+            rotationMatrix.toRotationMatrix( );
+    BOOST_CHECK_SMALL( cachedMatrixDeviation.cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+    tudat::earth_orientation::clearSharedEarthOrientationAnglesCaches( );
 }
 #endif
 